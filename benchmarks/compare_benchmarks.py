@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""Comparaison de mesures de performances de Magix3D à une référence.
+
+Signale les couples (scénario, taille) dont la durée ou le pic de mémoire
+dépasse la référence au delà des tolérances, ainsi que les étapes du
+profileur dont la durée cumulée a significativement augmenté. Retourne 1 en
+cas de régression.
+
+Usage : compare_benchmarks.py baseline.json benchmarks.json
+            [--time-tolerance 0.15] [--rss-tolerance 0.10]
+"""
+import argparse
+import json
+import sys
+
+# durée (s) en deçà de laquelle une étape n'est pas comparée (bruit)
+MIN_PHASE_SECONDS = 0.05
+
+
+def load(file_name):
+    with open(file_name) as stream:
+        data = json.load(stream)
+    return {(r["scenario"], r["size"]): r for r in data["results"]}
+
+
+def ratio(current, reference):
+    return current / reference if reference > 0 else 1.
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--time-tolerance", type=float, default=.15,
+                        help="augmentation relative tolérée des durées")
+    parser.add_argument("--rss-tolerance", type=float, default=.10,
+                        help="augmentation relative tolérée du pic de mémoire")
+    args = parser.parse_args()
+
+    try:
+        baseline = load(args.baseline)
+    except IOError:
+        print("Référence %s absente : copier un fichier de résultats pour en créer une."
+              % args.baseline, file=sys.stderr)
+        return 2
+    current = load(args.current)
+
+    regressions = 0
+    print("%-20s %8s %10s %10s %7s %9s" % ("scénario", "taille", "réf (s)",
+                                           "mesure (s)", "durée", "mémoire"))
+    for key in sorted(current):
+        result = current[key]
+        if key not in baseline:
+            print("%-20s %8d %10s %10.3f   (pas de référence)"
+                  % (key[0], key[1], "-", result["wall_seconds"]))
+            continue
+        reference = baseline[key]
+        time_ratio = ratio(result["wall_seconds"], reference["wall_seconds"])
+        rss_ratio = ratio(result["peak_rss_bytes"], reference["peak_rss_bytes"])
+        flags = []
+        if time_ratio > 1. + args.time_tolerance:
+            flags.append("DUREE")
+        if rss_ratio > 1. + args.rss_tolerance:
+            flags.append("MEMOIRE")
+        print("%-20s %8d %10.3f %10.3f %+6.0f%% %+8.0f%% %s"
+              % (key[0], key[1], reference["wall_seconds"], result["wall_seconds"],
+                 100. * (time_ratio - 1.), 100. * (rss_ratio - 1.), " ".join(flags)))
+        if flags:
+            regressions += 1
+
+        # Les étapes responsables :
+        for phase, measure in sorted(result.get("phases", {}).items()):
+            reference_phase = reference.get("phases", {}).get(phase)
+            if reference_phase is None or measure["seconds"] < MIN_PHASE_SECONDS:
+                continue
+            phase_ratio = ratio(measure["seconds"], reference_phase["seconds"])
+            if phase_ratio > 1. + args.time_tolerance:
+                print("    %-60s %8.3f -> %8.3f s (%+.0f%%)"
+                      % (phase, reference_phase["seconds"], measure["seconds"],
+                         100. * (phase_ratio - 1.)))
+        for counter, value in sorted(result.get("counters", {}).items()):
+            reference_value = reference.get("counters", {}).get(counter)
+            if reference_value is not None and reference_value != value:
+                print("    compteur %-51s %8g -> %8g" % (counter, reference_value, value))
+
+    missing = sorted(set(baseline) - set(current))
+    for key in missing:
+        print("%-20s %8d   non mesuré" % key)
+
+    print("%d régression(s)" % regressions)
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,170 @@
+# -*- coding: utf-8 -*-
+"""Scénarios de mesure de performances de Magix3D.
+
+Chaque scénario est une fonction paramétrée par une taille, autonome (pas de
+données externes), qui construit son modèle via pyMagix3D et retourne un
+dictionnaire de compteurs propres au scénario (nombre de blocs, de mailles,
+taille des fichiers écrits, ...).
+"""
+import os
+
+import pyMagix3D as Mgx3D
+
+# nom du scénario -> (fonction, tailles par défaut, tailles en mode rapide)
+SCENARIOS = {}
+
+
+def scenario(name, sizes, quick_sizes):
+    def register(function):
+        SCENARIOS[name] = (function, sizes, quick_sizes)
+        return function
+    return register
+
+
+def _new_session():
+    ctx = Mgx3D.getStdContext()
+    ctx.clearSession()
+    return ctx
+
+
+@scenario("box_blocking", [4, 8, 12], [2, 4])
+def box_blocking(n, workdir):
+    """Blocage d'une boite en n x n x n blocs, puis maillage."""
+    ctx = _new_session()
+    tm = ctx.getTopoManager()
+    mm = ctx.getMeshManager()
+    tm.setDefaultNbMeshingEdges(10)
+    tm.newIJKBoxesWithTopo(n, n, n, False)
+    mm.newAllBlocksMesh().waitFor()
+    return {"blocks": tm.getNbBlocks(), "regions": mm.getNbRegions()}
+
+
+@scenario("ogrid_cylinder", [10, 20, 40], [5, 10])
+def ogrid_cylinder(n, workdir):
+    """Cylindre avec topologie en o-grid de résolution n, puis maillage."""
+    ctx = _new_session()
+    tm = ctx.getTopoManager()
+    mm = ctx.getMeshManager()
+    tm.newCylinderWithTopo(Mgx3D.Point(0, 0, 0), 1, Mgx3D.Vector(10, 0, 0),
+                           360, True, .5, n, n, n)
+    mm.newAllBlocksMesh().waitFor()
+    return {"blocks": tm.getNbBlocks(), "regions": mm.getNbRegions()}
+
+
+def _solids(gm, n):
+    """n boites se recouvrant partiellement, alignées selon x."""
+    names = []
+    for i in range(n):
+        gm.newBox(Mgx3D.Point(.75 * i, 0, 0), Mgx3D.Point(.75 * i + 1, 1, 1))
+        names.append("Vol%04d" % i)
+    return names
+
+
+@scenario("glue_solids", [4, 8, 16], [2, 4])
+def glue_solids(n, workdir):
+    """Collage de n volumes construits à partir de primitives."""
+    ctx = _new_session()
+    gm = ctx.getGeomManager()
+    gm.glue(_solids(gm, n))
+    return {"volumes": gm.getNbVolumes(), "surfaces": gm.getNbSurfaces()}
+
+
+@scenario("fuse_solids", [4, 8, 16], [2, 4])
+def fuse_solids(n, workdir):
+    """Fusion de n volumes construits à partir de primitives."""
+    ctx = _new_session()
+    gm = ctx.getGeomManager()
+    gm.fuse(_solids(gm, n))
+    return {"volumes": gm.getNbVolumes(), "surfaces": gm.getNbSurfaces()}
+
+
+def _mesh_for_export(ctx, cells):
+    """Maillage d'une boite d'environ cells mailles."""
+    tm = ctx.getTopoManager()
+    mm = ctx.getMeshManager()
+    n = max(1, int(round(cells ** (1. / 3.))))
+    tm.newBoxWithTopo(Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), n, n, n)
+    mm.newAllBlocksMesh().waitFor()
+    return mm
+
+
+def _export(write, extension, cells, workdir):
+    ctx = _new_session()
+    mm = _mesh_for_export(ctx, cells)
+    file_name = os.path.join(workdir, "export." + extension)
+    write(mm, file_name)
+    return {"regions": mm.getNbRegions(),
+            "bytes": os.path.getsize(file_name) if os.path.exists(file_name) else 0}
+
+
+@scenario("export_vtk", [10 ** 5, 10 ** 6], [10 ** 4])
+def export_vtk(cells, workdir):
+    """Ecriture d'un maillage de cells mailles au format VTK."""
+    return _export(lambda mm, f: mm.writeVTK(f), "vtk", cells, workdir)
+
+
+@scenario("export_mli", [10 ** 5, 10 ** 6], [10 ** 4])
+def export_mli(cells, workdir):
+    """Ecriture d'un maillage de cells mailles au format MLI."""
+    return _export(lambda mm, f: mm.writeMli(f), "mli", cells, workdir)
+
+
+@scenario("export_cgns", [10 ** 5, 10 ** 6], [10 ** 4])
+def export_cgns(cells, workdir):
+    """Ecriture d'un maillage de cells mailles au format CGNS."""
+    return _export(lambda mm, f: mm.writeCGNS(f), "cgns", cells, workdir)
+
+
+@scenario("script_replay", [1000, 5000], [200])
+def script_replay(k, workdir):
+    """Rejeu d'un script de k commandes (sommets et segments)."""
+    _new_session()
+    file_name = os.path.join(workdir, "replay.py")
+    with open(file_name, "w") as script:
+        script.write("import pyMagix3D as Mgx3D\n")
+        script.write("ctx = Mgx3D.getStdContext()\n")
+        script.write("gm = ctx.getGeomManager()\n")
+        vertices = k // 2 + 1
+        for i in range(vertices):
+            script.write("gm.newVertex(Mgx3D.Point(%d, %d, 0))\n" % (i, i % 2))
+        for i in range(k - vertices):
+            script.write("gm.newSegment(\"Pt%04d\", \"Pt%04d\")\n" % (i, i + 1))
+    with open(file_name) as script:
+        code = compile(script.read(), file_name, "exec")
+    exec(code, {"__name__": "__replay__"})
+    gm = Mgx3D.getStdContext().getGeomManager()
+    return {"commands": k, "vertices": gm.getNbVertices(), "curves": gm.getNbCurves()}
+
+
+def _topo_replay(k, workdir, unused_traces):
+    ctx = _new_session()
+    ctx.setUnusedTracesFormatting(unused_traces)
+    file_name = os.path.join(workdir, "topo_replay.py")
+    with open(file_name, "w") as script:
+        script.write("import pyMagix3D as Mgx3D\n")
+        script.write("ctx = Mgx3D.getStdContext()\n")
+        script.write("tm = ctx.getTopoManager()\n")
+        script.write("tm.newBoxWithTopo(Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), 10, 10, 10)\n")
+        for i in range(k - 1):
+            script.write("tm.setNbMeshingEdges(\"Ar%04d\", %d, [])\n" % (i % 4, 10 + i % 5))
+    with open(file_name) as script:
+        code = compile(script.read(), file_name, "exec")
+    try:
+        exec(code, {"__name__": "__replay__"})
+    finally:
+        ctx.setUnusedTracesFormatting(False)
+    return {"commands": k, "blocks": ctx.getTopoManager().getNbBlocks()}
+
+
+@scenario("topo_replay", [1000, 5000], [200])
+def topo_replay(k, workdir):
+    """Rejeu d'un script de k commandes topologiques, traces inactives."""
+    return _topo_replay(k, workdir, False)
+
+
+@scenario("topo_replay_unused_traces", [1000, 5000], [200])
+def topo_replay_unused_traces(k, workdir):
+    """Rejeu de topo_replay en formatant les traces sans les afficher, comme
+    avant MGX_TRACE : l'écart avec topo_replay est le gain du test du niveau
+    de trace avant formatage."""
+    return _topo_replay(k, workdir, True)
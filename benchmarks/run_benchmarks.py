@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""Exécution des scénarios de mesure de performances de Magix3D.
+
+Chaque couple (scénario, taille) est exécuté dans un processus dédié afin de
+mesurer son pic de mémoire résidente. Les résultats (durée, pic de mémoire,
+compteurs du scénario et mesures par étape du profileur de commandes) sont
+enregistrés dans un fichier JSON comparable à une référence avec
+compare_benchmarks.py.
+
+Usage : run_benchmarks.py [--quick] [--only s1,s2] [--output benchmarks.json]
+"""
+import argparse
+import json
+import os
+import platform
+import resource
+import subprocess
+import sys
+import tempfile
+import time
+
+FORMAT_VERSION = 1
+
+
+def phases_from_trace(trace_file):
+    """Agrège par étape (type de commande/étape) les mesures d'une trace."""
+    phases = {}
+    counters = {}
+    with open(trace_file) as trace:
+        events = json.load(trace)["traceEvents"]
+    for event in events:
+        if event["ph"] == "X":
+            name = event["name"]
+            if event.get("cat", "Magix3D") != "Magix3D":
+                name = event["cat"] + "/" + name
+            phase = phases.setdefault(name, {"count": 0, "seconds": 0.})
+            phase["count"] += 1
+            phase["seconds"] += event["dur"] * 1e-6
+        elif event["ph"] == "C":
+            counters[event["name"]] = event["args"]["value"]
+    return phases, counters
+
+
+def run_one(name, size):
+    """Exécute un scénario dans le processus courant et affiche son résultat
+    (JSON) sur la sortie standard."""
+    import mgx_benchmarks
+    import pyMagix3D as Mgx3D
+
+    function = mgx_benchmarks.SCENARIOS[name][0]
+    ctx = Mgx3D.getStdContext()
+    with tempfile.TemporaryDirectory(prefix="mgx_bench_") as workdir:
+        ctx.resetProfiling()
+        ctx.setProfiling(True)
+        start = time.perf_counter()
+        counters = function(size, workdir)
+        wall = time.perf_counter() - start
+        ctx.setProfiling(False)
+        trace_file = os.path.join(workdir, "trace.json")
+        ctx.saveProfilingTrace(trace_file)
+        phases, profiler_counters = phases_from_trace(trace_file)
+    counters.update(profiler_counters)
+    # ru_maxrss est en kilo-octets sous Linux
+    peak_rss = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss * 1024
+    print(json.dumps({"scenario": name, "size": size, "wall_seconds": wall,
+                      "peak_rss_bytes": peak_rss, "counters": counters,
+                      "phases": phases}))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--quick", action="store_true",
+                        help="tailles réduites (vérification rapide)")
+    parser.add_argument("--only", default="",
+                        help="scénarios à exécuter, séparés par des virgules")
+    parser.add_argument("--output", default="benchmarks.json",
+                        help="fichier JSON des résultats")
+    parser.add_argument("--run-one", nargs=2, metavar=("SCENARIO", "SIZE"),
+                        help=argparse.SUPPRESS)
+    args = parser.parse_args()
+
+    sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+    if args.run_one:
+        run_one(args.run_one[0], int(args.run_one[1]))
+        return 0
+
+    import mgx_benchmarks
+    names = [n for n in args.only.split(",") if n] or sorted(mgx_benchmarks.SCENARIOS)
+    results = []
+    failures = 0
+    for name in names:
+        if name not in mgx_benchmarks.SCENARIOS:
+            print("Scénario inconnu : %s" % name, file=sys.stderr)
+            return 2
+        sizes = mgx_benchmarks.SCENARIOS[name][2 if args.quick else 1]
+        for size in sizes:
+            print("%s(%d) ..." % (name, size), flush=True)
+            process = subprocess.run(
+                [sys.executable, os.path.abspath(__file__), "--run-one", name, str(size)],
+                stdout=subprocess.PIPE, universal_newlines=True)
+            lines = process.stdout.strip().splitlines()
+            if process.returncode != 0 or not lines:
+                print("%s(%d) : ECHEC (code %d)" % (name, size, process.returncode),
+                      file=sys.stderr)
+                failures += 1
+                continue
+            # Le résultat est la dernière ligne, les précédentes sont les
+            # éventuels affichages de Magix3D.
+            result = json.loads(lines[-1])
+            results.append(result)
+            print("%s(%d) : %.3f s, %.1f Mo" % (name, size, result["wall_seconds"],
+                                                result["peak_rss_bytes"] / 2. ** 20))
+
+    with open(args.output, "w") as output:
+        json.dump({"format": FORMAT_VERSION, "host": platform.node(),
+                   "python": platform.python_version(), "quick": args.quick,
+                   "results": results}, output, indent=1, sort_keys=True)
+    print("Résultats enregistrés dans %s" % args.output)
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
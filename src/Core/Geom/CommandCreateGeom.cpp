@@ -41,10 +41,10 @@ CommandCreateGeom::~CommandCreateGeom()
     Internal::InfoCommand& icmd = getInfoCommand();
 
     if (!getContext().isFinished()) {
-        for (uint i = 0; i < icmd.getNbGeomInfoEntity(); i++) {
-            GeomEntity *ge = 0;
-            Internal::InfoCommand::type t;
-            icmd.getGeomInfoEntity(i, ge, t);
+        const std::vector<Internal::InfoCommand::GeomEntityInfo>& geom_entities_info = icmd.getGeomInfoEntities();
+        for (uint i=0; i<geom_entities_info.size(); i++) {
+            Geom::GeomEntity* ge = geom_entities_info[i].m_geom_entity;
+            Internal::InfoCommand::type t = geom_entities_info[i].m_type;
 
             if (ge) {
                 if (Internal::InfoCommand::DELETED == t) {
@@ -65,10 +65,10 @@ void CommandCreateGeom::postExecute(bool hasError)
 		std::cout<<"CommandCreateGeom::postExecute en erreur => destruction des entités"<<std::endl;
 	    // Suppression par le manager des entités détruites
 	    Internal::InfoCommand& icmd = getInfoCommand();
-		for (uint i=0; i<icmd.getNbGeomInfoEntity(); i++) {
-			GeomEntity* ge = 0;
-			Internal::InfoCommand::type t;
-			icmd.getGeomInfoEntity(i, ge, t);
+		const std::vector<Internal::InfoCommand::GeomEntityInfo>& geom_entities_info = icmd.getGeomInfoEntities();
+		for (uint i=0; i<geom_entities_info.size(); i++) {
+			Geom::GeomEntity* ge = geom_entities_info[i].m_geom_entity;
+			Internal::InfoCommand::type t = geom_entities_info[i].m_type;
 
 			if (ge){
 				if (Internal::InfoCommand::DELETED == t) {
@@ -92,23 +92,19 @@ GeomManager& CommandCreateGeom::getGeomManager()
 /*----------------------------------------------------------------------------*/
 void CommandCreateGeom::internalUndo()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandCreateGeom::internalUndo pour la commande " << getName ( )
-        << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandCreateGeom::internalUndo pour la commande " << getName ( )
+        << " de nom unique " << getUniqueName ( ));
 
     AutoReferencedMutex autoMutex (getMutex ( ));
 
     // les entités détruites sont dites créées et inversement
     getInfoCommand().permCreatedDeleted();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandCreateGeom::internalRedo()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandCreateGeom::internalRedo pour la commande " << getName ( )
-        << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandCreateGeom::internalRedo pour la commande " << getName ( )
+        << " de nom unique " << getUniqueName ( ));
 
     AutoReferencedMutex	autoMutex (getMutex ( ));
 
@@ -118,8 +114,6 @@ void CommandCreateGeom::internalRedo()
     getInfoCommand().permCreatedDeleted();
 
 	startingOrcompletionLog (false);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandCreateGeom::
@@ -24,9 +24,8 @@ CommandCreateWithOtherGeomEntities::CommandCreateWithOtherGeomEntities(Internal:
 /*----------------------------------------------------------------------------*/
 void CommandCreateWithOtherGeomEntities::internalUndo()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandCreateWithOtherGeomEntities::internalUndo pour la commande " << getName ( )
-                << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandCreateWithOtherGeomEntities::internalUndo pour la commande " << getName ( )
+                << " de nom unique " << getUniqueName ( ));
 
     AutoReferencedMutex autoMutex (getMutex ( ));
 
@@ -35,15 +34,12 @@ void CommandCreateWithOtherGeomEntities::internalUndo()
 
     // les entités détruites sont dites créées et inversement
     getInfoCommand().permCreatedDeleted();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandCreateWithOtherGeomEntities::internalRedo()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandCreateWithOtherGeomEntities::internalRedo pour la commande " << getName ( )
-                << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandCreateWithOtherGeomEntities::internalRedo pour la commande " << getName ( )
+                << " de nom unique " << getUniqueName ( ));
 
     AutoReferencedMutex autoMutex (getMutex ( ));
 
@@ -56,8 +52,6 @@ void CommandCreateWithOtherGeomEntities::internalRedo()
     getInfoCommand().permCreatedDeleted();
 
     startingOrcompletionLog (false);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 } // end namespace Geom
@@ -147,9 +147,8 @@ void CommandEditGeom::internalExecute()
 /*----------------------------------------------------------------------------*/
 void CommandEditGeom::internalUndo()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandEditGeom::internalUndo pour la commande " << getName ( )
-                << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandEditGeom::internalUndo pour la commande " << getName ( )
+                << " de nom unique " << getUniqueName ( ));
 
     AutoReferencedMutex autoMutex (getMutex ( ));
 
@@ -160,15 +159,12 @@ void CommandEditGeom::internalUndo()
     getInfoCommand().permCreatedDeleted();
 
     if (m_impl) m_impl->performUndo();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandEditGeom::internalRedo()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandEditGeom::internalRedo pour la commande " << getName ( )
-                << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandEditGeom::internalRedo pour la commande " << getName ( )
+                << " de nom unique " << getUniqueName ( ));
 
     AutoReferencedMutex autoMutex (getMutex ( ));
 
@@ -183,8 +179,6 @@ void CommandEditGeom::internalRedo()
     if (m_impl) m_impl->performRedo();
 
     startingOrcompletionLog (false);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 
 /*----------------------------------------------------------------------------*/
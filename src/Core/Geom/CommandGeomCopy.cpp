@@ -153,10 +153,9 @@ void CommandGeomCopy::internalSpecificPreExecute()
 void CommandGeomCopy::internalSpecificExecute()
 {
 
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandGeomCopy::execute pour la commande " << getName ( )
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandGeomCopy::execute pour la commande " << getName ( )
                        << " de nom unique " << getUniqueName ( )
-                       << std::ios_base::fixed << TkUtil::setprecision (8);
+                       << std::ios_base::fixed << TkUtil::setprecision (8));
 
     for(unsigned int i=0;i<4;i++){
         std::list<GeomEntity*>::iterator it = m_ref_entities[i].begin();
@@ -233,8 +232,6 @@ void CommandGeomCopy::internalSpecificExecute()
             m_ref_to_new_entities.insert(std::pair<GeomEntity*,GeomEntity*>(from_entity,to_entity));
         }
     }
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandGeomCopy::updateGroups()
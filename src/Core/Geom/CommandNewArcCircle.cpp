@@ -29,15 +29,14 @@ CommandNewArcCircle::~CommandNewArcCircle()
 void CommandNewArcCircle::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandNewArcCircle::execute pour la commande " << getName ( )
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandNewArcCircle::execute pour la commande " << getName ( )
             << " de nom unique " << getUniqueName ( )
             << std::ios_base::fixed << TkUtil::setprecision (8)
             << ". center " << *m_center<<", start "
             << *m_start<< ", end "<<*m_end
             <<", direction"<<(short)m_direction
             <<", normal "<<m_normal
-            <<".";
+            <<".");
 
 
     // sauvegarde des relations (connections topologiques) avant modification
@@ -66,8 +65,6 @@ internalExecute()
     comments << "Création de l'arc de cercle "<<c->getName();
     setScriptComments(comments);
     setName(comments);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandNewArcCircle::
@@ -27,14 +27,13 @@ CommandNewArcEllipse::~CommandNewArcEllipse()
 void CommandNewArcEllipse::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandArcEllipse::execute pour la commande " << getName ( )
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandArcEllipse::execute pour la commande " << getName ( )
                     << " de nom unique " << getUniqueName ( )
                     << std::ios_base::fixed << TkUtil::setprecision (8)
                     << ". center " << *m_center<<", start "
                     << *m_start<< ", end "<<*m_end
                     <<", direction"<<(short)m_direction
-                    <<".";
+                    <<".");
 
     // sauvegarde des relations (connections topologiques) avant modification
     m_memento_service.saveMemento(m_start);
@@ -62,8 +61,6 @@ internalExecute()
     comments << "Création de l'arc d'ellipse "<<c->getName();
     setScriptComments(comments);
     setName(comments);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandNewArcEllipse::
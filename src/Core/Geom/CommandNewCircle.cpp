@@ -24,12 +24,11 @@ CommandNewCircle::~CommandNewCircle()
 void CommandNewCircle::
 internalExecute()
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "CommandNewCircle::execute pour la commande " << getName ( )
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandNewCircle::execute pour la commande " << getName ( )
             << " de nom unique " << getUniqueName ( )
             << std::ios_base::fixed << TkUtil::setprecision (8)
             << ". p1 " << *m_p1<<", p2 "
-            << *m_p2<< ", p3 "<<*m_p3<<".";
+            << *m_p2<< ", p3 "<<*m_p3<<".");
 
     // sauvegarde des relations (connections topologiques) avant modification
     m_memento_service.saveMemento(m_p1);
@@ -50,8 +49,6 @@ internalExecute()
     comments << "Création du cercle "<<c->getName();
     setScriptComments(comments);
     setName(comments);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandNewCircle::
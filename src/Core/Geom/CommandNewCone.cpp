@@ -43,15 +43,14 @@ CommandNewCone::
 void CommandNewCone::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandNewCone::execute. Cone R1 = "
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandNewCone::execute. Cone R1 = "
 //            << std::ios_base::fixed << TkUtil::setprecision (8)
     << Utils::Math::MgxNumeric::userRepresentation (m_dr1)
     << ", R2 " << Utils::Math::MgxNumeric::userRepresentation (m_dr2)
     << ", V (" << Utils::Math::MgxNumeric::userRepresentation (m_dv.getX ( ))
     << ", " << Utils::Math::MgxNumeric::userRepresentation (m_dv.getY ( ))
     << ", " << Utils::Math::MgxNumeric::userRepresentation (m_dv.getZ ( ))
-    << ").";
+    << ").");
 	Volume* vol = EntityFactory(getContext()).newCone(
 	               new PropertyCone(m_dr1, m_dr2, m_dv.abs(), m_dv, m_angle));
 	m_createdEntities.push_back(vol);
@@ -68,8 +67,6 @@ internalExecute()
     comments << "Création du cône "<<vol->getName();
     setScriptComments(comments);
     setName(comments);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandNewCone::
@@ -24,9 +24,8 @@ CommandNewCurveByBREPImport::
 void CommandNewCurveByBREPImport::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-	message << "CommandNewCurveByBREPImport::execute pour la commande " << getName ( )
-		    << " de nom unique " << getUniqueName ( ) << ".";
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandNewCurveByBREPImport::execute pour la commande " << getName ( )
+		    << " de nom unique " << getUniqueName ( ) << ".");
 
     Curve *c;
     if (m_edgeShapes.size() == 1) {
@@ -44,8 +43,6 @@ internalExecute()
     comments << "Création de la courbe "<<c->getName();
     setScriptComments(comments);
     setName(comments);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 } // end namespace Geom
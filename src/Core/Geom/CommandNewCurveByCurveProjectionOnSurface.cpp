@@ -27,10 +27,9 @@ CommandNewCurveByCurveProjectionOnSurface::~CommandNewCurveByCurveProjectionOnSu
 void CommandNewCurveByCurveProjectionOnSurface::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandNewCurveByCurveProjectionOnSurface::execute pour la commande " << getName ( )
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandNewCurveByCurveProjectionOnSurface::execute pour la commande " << getName ( )
             << " de nom unique " << getUniqueName ( )
-            << m_curve->getName()<<", "<<m_surface->getName()<<".";
+            << m_curve->getName()<<", "<<m_surface->getName()<<".");
 
     Curve* c = EntityFactory(getContext()).newCurveByCurveProjectionOnSurface(m_curve, m_surface);
     m_createdEntities.push_back(c);
@@ -48,8 +47,6 @@ internalExecute()
     		<<m_curve->getName()<<" sur "<<m_surface->getName();
     setScriptComments(comments);
     setName(comments);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 } // end namespace Geom
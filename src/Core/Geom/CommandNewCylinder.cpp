@@ -45,8 +45,7 @@ CommandNewCylinder::
 void CommandNewCylinder::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-	message << "CommandNewCylinder::execute. Cylindre R = "
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandNewCylinder::execute. Cylindre R = "
 //            << std::ios_base::fixed << TkUtil::setprecision (8)
 		    << Utils::Math::MgxNumeric::userRepresentation (m_dr)
 	        << ", V (" << Utils::Math::MgxNumeric::userRepresentation (m_dv.getX ( ))
@@ -54,7 +53,7 @@ internalExecute()
 		    << ", " << Utils::Math::MgxNumeric::userRepresentation (m_dv.getZ ( ))
 	        << "), P (" << Utils::Math::MgxNumeric::userRepresentation (m_centre.getX ( ))
 	        << ", " << Utils::Math::MgxNumeric::userRepresentation (m_centre.getY ( ))
-	        << ", " << Utils::Math::MgxNumeric::userRepresentation (m_centre.getZ ( )) << ").";
+	        << ", " << Utils::Math::MgxNumeric::userRepresentation (m_centre.getZ ( )) << ").");
 	Volume* vol = EntityFactory(getContext()).newCylinder(
 	               new PropertyCylinder(m_dr,m_dv.abs(),m_centre,m_dv, m_angle));
 	m_createdEntities.push_back(vol);
@@ -71,8 +70,6 @@ internalExecute()
     comments << "Création du cylindre "<<vol->getName();
     setScriptComments(comments);
     setName(comments);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandNewCylinder::
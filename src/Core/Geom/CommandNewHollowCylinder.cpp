@@ -47,8 +47,7 @@ CommandNewHollowCylinder::
 void CommandNewHollowCylinder::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandNewHollowCylinder::execute. HollowCylindre R = "
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandNewHollowCylinder::execute. HollowCylindre R = "
 //            << std::ios_base::fixed << TkUtil::setprecision (8)
             << Utils::Math::MgxNumeric::userRepresentation (m_dr_int)
             <<", "<< Utils::Math::MgxNumeric::userRepresentation (m_dr_ext)
@@ -57,7 +56,7 @@ internalExecute()
             << ", " << Utils::Math::MgxNumeric::userRepresentation (m_dv.getZ ( ))
             << "), P (" << Utils::Math::MgxNumeric::userRepresentation (m_centre.getX ( ))
             << ", " << Utils::Math::MgxNumeric::userRepresentation (m_centre.getY ( ))
-            << ", " << Utils::Math::MgxNumeric::userRepresentation (m_centre.getZ ( )) << ").";
+            << ", " << Utils::Math::MgxNumeric::userRepresentation (m_centre.getZ ( )) << ").");
     Volume* vol = EntityFactory(getContext()).newHollowCylinder(
                    new PropertyHollowCylinder(m_dr_int, m_dr_ext,m_dv.abs(),m_centre,m_dv, m_angle));
     m_createdEntities.push_back(vol);
@@ -74,8 +73,6 @@ internalExecute()
     comments << "Création du cylindre creux "<<vol->getName();
     setScriptComments(comments);
     setName(comments);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandNewHollowCylinder::
@@ -49,8 +49,7 @@ CommandNewHollowSphere::~CommandNewHollowSphere()
 void CommandNewHollowSphere::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandNewHollowSphere::execute. HollowSphere S = "
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandNewHollowSphere::execute. HollowSphere S = "
 //            << std::ios_base::fixed << TkUtil::setprecision (8)
             <<"C (" << Utils::Math::MgxNumeric::userRepresentation (m_center.getX ( ))
             << Utils::Math::MgxNumeric::userRepresentation (m_center.getY ( )) << ", "
@@ -58,7 +57,7 @@ internalExecute()
             <<Utils::Math::MgxNumeric::userRepresentation (m_dr_int)<< "), R ext "
             <<Utils::Math::MgxNumeric::userRepresentation (m_dr_ext)
             <<" Type "<<Utils::Portion::getName(m_type)
-	        <<", angle "<<Utils::Math::MgxNumeric::userRepresentation (m_angle);
+	        <<", angle "<<Utils::Math::MgxNumeric::userRepresentation (m_angle));
     Volume* vol = EntityFactory(getContext()).newHollowSphere(
                    new PropertyHollowSphere(m_center, m_dr_int, m_dr_ext,m_type,m_angle));
 
@@ -76,8 +75,6 @@ internalExecute()
     comments << "Création de la sphère creuse "<<vol->getName();
     setScriptComments(comments);
     setName(comments);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandNewHollowSphere::
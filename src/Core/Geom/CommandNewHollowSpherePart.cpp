@@ -31,13 +31,12 @@ CommandNewHollowSpherePart::~CommandNewHollowSpherePart()
 void CommandNewHollowSpherePart::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandNewHollowSpherePart::execute. HollowSpherePart S = "
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandNewHollowSpherePart::execute. HollowSpherePart S = "
 //            << std::ios_base::fixed << TkUtil::setprecision (8)
             <<" R int "<<Utils::Math::MgxNumeric::userRepresentation (m_dr_int)
     		<<", R ext "<<Utils::Math::MgxNumeric::userRepresentation (m_dr_ext)
 	        <<", angle Y "<<Utils::Math::MgxNumeric::userRepresentation (m_angleY)
-            <<", angle Z "<<Utils::Math::MgxNumeric::userRepresentation (m_angleZ);
+            <<", angle Z "<<Utils::Math::MgxNumeric::userRepresentation (m_angleZ));
     Volume* vol = EntityFactory(getContext()).newHollowSpherePart(
                    new PropertyHollowSpherePart(m_dr_int, m_dr_ext, m_angleY, m_angleZ));
 
@@ -55,8 +54,6 @@ internalExecute()
     comments << "Création de l'aiguille creuse "<<vol->getName();
     setScriptComments(comments);
     setName(comments);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandNewHollowSpherePart::
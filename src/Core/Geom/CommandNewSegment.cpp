@@ -56,8 +56,7 @@ internalExecute()
 	if (m_v2 == 0)
 		throw TkUtil::Exception(TkUtil::UTF8String ("Erreur interne, v2 n'a pas été correctement initialisé", TkUtil::Charset::UTF_8));
 
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-	message << "CommandNewSegment::execute pour la commande " << getName ( )
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandNewSegment::execute pour la commande " << getName ( )
 		    << " de nom unique " << getUniqueName ( )
 //		    << std::ios_base::fixed << TkUtil::setprecision (8)
 		    << ". P1 (" << Utils::Math::MgxNumeric::userRepresentation (m_v1->getX ( )) << ", "
@@ -65,7 +64,7 @@ internalExecute()
 	        << Utils::Math::MgxNumeric::userRepresentation (m_v1->getZ ( )) << "), P2 ("
 		    << Utils::Math::MgxNumeric::userRepresentation (m_v2->getX ( )) << ", "
 	        << Utils::Math::MgxNumeric::userRepresentation (m_v2->getY ( )) << ", "
-		    << Utils::Math::MgxNumeric::userRepresentation (m_v2->getZ ( )) << ").";
+		    << Utils::Math::MgxNumeric::userRepresentation (m_v2->getZ ( )) << ").");
 
     // sauvegarde des relations (connections topologiques) avant modification
     m_memento_service.saveMemento(m_v1);
@@ -91,8 +90,6 @@ internalExecute()
     comments << "Création du segment "<<c->getName();
     setScriptComments(comments);
     setName(comments);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandNewSegment::
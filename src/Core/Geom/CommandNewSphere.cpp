@@ -29,15 +29,14 @@ CommandNewSphere::~CommandNewSphere()
 void CommandNewSphere::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandNewSphere::execute. Sphere S = "
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandNewSphere::execute. Sphere S = "
 //            << std::ios_base::fixed << TkUtil::setprecision (8)
             <<"C (" << Utils::Math::MgxNumeric::userRepresentation (m_center.getX ( ))
             << Utils::Math::MgxNumeric::userRepresentation (m_center.getY ( )) << ", "
 	        << Utils::Math::MgxNumeric::userRepresentation (m_center.getZ ( )) << "), R "
             <<Utils::Math::MgxNumeric::userRepresentation (m_dr)
             <<" Type "<<Utils::Portion::getName(m_type)
-	        <<", angle "<<Utils::Math::MgxNumeric::userRepresentation (m_angle);
+	        <<", angle "<<Utils::Math::MgxNumeric::userRepresentation (m_angle));
     Volume* vol = EntityFactory(getContext()).newSphere(
                    new PropertySphere(m_center, m_dr, m_type,m_angle));
 
@@ -55,8 +54,6 @@ internalExecute()
     comments << "Création du volume "<<vol->getName();
     setScriptComments(comments);
     setName(comments);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandNewSphere::
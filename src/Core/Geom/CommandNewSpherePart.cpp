@@ -27,12 +27,11 @@ CommandNewSpherePart::~CommandNewSpherePart()
 void CommandNewSpherePart::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandNewSpherePart::execute. Sphere S = "
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandNewSpherePart::execute. Sphere S = "
 //            << std::ios_base::fixed << TkUtil::setprecision (8)
             <<Utils::Math::MgxNumeric::userRepresentation (m_dr)
 	        <<", angle Y "<<Utils::Math::MgxNumeric::userRepresentation (m_angleY)
-            <<", angle Z "<<Utils::Math::MgxNumeric::userRepresentation (m_angleZ);
+            <<", angle Z "<<Utils::Math::MgxNumeric::userRepresentation (m_angleZ));
     Volume* vol = EntityFactory(getContext()).newSpherePart(
                    new PropertySpherePart(m_dr,m_angleY,m_angleZ));
 
@@ -50,8 +49,6 @@ internalExecute()
     comments << "Création du volume "<<vol->getName();
     setScriptComments(comments);
     setName(comments);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandNewSpherePart::
@@ -44,9 +44,8 @@ internalExecute()
 		}
 	}
 
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandNewSurface::execute pour la commande " << getName ( )
-                << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandNewSurface::execute pour la commande " << getName ( )
+                << " de nom unique " << getUniqueName ( ));
 /*                << std::ios_base::fixed << TkUtil::setprecision (8)
                 << ". P1 (" << m_v1.getX ( ) << ", "
                 << m_v1.getY ( ) << ", " << m_v1.getZ ( ) << "), P2 ("
@@ -79,8 +78,6 @@ internalExecute()
     comments << "Création de la surface "<<s->getName();
     setScriptComments(comments);
     setName(comments);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 } // end namespace Geom
@@ -22,9 +22,8 @@ CommandNewSurfaceByBREPImport::
 void CommandNewSurfaceByBREPImport::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-	message << "CommandNewSurfaceByBREPImport::execute pour la commande " << getName ( )
-		    << " de nom unique " << getUniqueName ( ) << ".";
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandNewSurfaceByBREPImport::execute pour la commande " << getName ( )
+		    << " de nom unique " << getUniqueName ( ) << ".");
 
     Surface *s;
     if (m_faceShapes.size() == 1) {
@@ -42,8 +41,6 @@ internalExecute()
     comments << "Création de la surface "<<s->getName();
     setScriptComments(comments);
     setName(comments);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 } // end namespace Geom
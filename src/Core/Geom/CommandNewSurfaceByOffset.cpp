@@ -34,10 +34,9 @@ CommandNewSurfaceByOffset::~CommandNewSurfaceByOffset()
 void CommandNewSurfaceByOffset::internalExecute()
 {
 
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-	message << "CommandNewSurfaceByOffset::execute pour la commande " << getName ( )
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandNewSurfaceByOffset::execute pour la commande " << getName ( )
                     		   << " de nom unique " << getUniqueName ( )
-							   << std::ios_base::fixed << TkUtil::setprecision (8);
+							   << std::ios_base::fixed << TkUtil::setprecision (8));
 
 	Surface* surf = EntityFactory(getContext()).newSurfaceByCopyWithOffset(m_entity, m_offset);
 	m_createdEntities.push_back(surf);
@@ -47,8 +46,6 @@ void CommandNewSurfaceByOffset::internalExecute()
 
     m_group_helper.addToGroup(m_group_name, surf);
 
-	log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
-
 }
 /*----------------------------------------------------------------------------*/
 } // end namespace Geom
@@ -27,14 +27,13 @@ internalExecute()
     double dx = m_p.getX();
     double dy = m_p.getY();
     double dz = m_p.getZ();
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-	message << "CommandNewVertex::execute pour la commande " << getName ( )
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandNewVertex::execute pour la commande " << getName ( )
 		    << " de nom unique " << getUniqueName ( )
 //		    << std::ios_base::fixed << TkUtil::setprecision (8)
 		    << ". P ("
 	        << Utils::Math::MgxNumeric::userRepresentation (dx) << ", "
 		    << Utils::Math::MgxNumeric::userRepresentation (dy) << ", "
-		    << Utils::Math::MgxNumeric::userRepresentation (dz) << ").";
+		    << Utils::Math::MgxNumeric::userRepresentation (dz) << ").");
 
     Vertex* v= EntityFactory(getContext()).newVertex(m_p);
     m_createdEntities.push_back(v);
@@ -50,8 +49,6 @@ internalExecute()
     comments << "Création du sommet "<<v->getName();
     setScriptComments(comments);
     setName(comments);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandNewVertex::
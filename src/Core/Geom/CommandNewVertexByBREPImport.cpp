@@ -27,14 +27,13 @@ internalExecute()
     double dx = point.X();
     double dy = point.Y();
     double dz = point.Z();
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-	message << "CommandNewVertexByBREPImport::execute pour la commande " << getName ( )
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandNewVertexByBREPImport::execute pour la commande " << getName ( )
 		    << " de nom unique " << getUniqueName ( )
 //		    << std::ios_base::fixed << TkUtil::setprecision (8)
 		    << ". P ("
 	        << Utils::Math::MgxNumeric::userRepresentation (dx) << ", "
 		    << Utils::Math::MgxNumeric::userRepresentation (dy) << ", "
-		    << Utils::Math::MgxNumeric::userRepresentation (dz) << ").";
+		    << Utils::Math::MgxNumeric::userRepresentation (dz) << ").");
 
     Vertex* v= EntityFactory(getContext()).newOCCVertex(m_vertexShape);
     m_createdEntities.push_back(v);
@@ -47,8 +46,6 @@ internalExecute()
     comments << "Création du sommet "<<v->getName();
     setScriptComments(comments);
     setName(comments);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 } // end namespace Geom
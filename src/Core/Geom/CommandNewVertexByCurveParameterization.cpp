@@ -30,10 +30,9 @@ CommandNewVertexByCurveParameterization::
 void CommandNewVertexByCurveParameterization::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandNewVertexByCurveParameterization::execute pour la commande " << getName ( )
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandNewVertexByCurveParameterization::execute pour la commande " << getName ( )
             << " de nom unique " << getUniqueName ( )
-            << ". (" << m_c->getName() <<", "<<m_param<< ").";
+            << ". (" << m_c->getName() <<", "<<m_param<< ").");
 
 
     Utils::Math::Point p;
@@ -54,8 +53,6 @@ internalExecute()
     comments << "Création du sommet "<<v->getName()<<" sur la courbe "<<m_c->getName();
     setScriptComments(comments);
     setName(comments);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandNewVertexByCurveParameterization::
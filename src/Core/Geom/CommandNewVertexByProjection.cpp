@@ -35,10 +35,9 @@ CommandNewVertexByProjection::
 void CommandNewVertexByProjection::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandNewVertexByProjection::execute pour la commande " << getName ( )
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandNewVertexByProjection::execute pour la commande " << getName ( )
             << " de nom unique " << getUniqueName ( )
-            << ". (" << m_v->getName()<< ", " << (m_c?m_c->getName():m_s->getName()) << ").";
+            << ". (" << m_v->getName()<< ", " << (m_c?m_c->getName():m_s->getName()) << ").");
 
 
     Utils::Math::Point p(m_v->getX(),m_v->getY(),m_v->getZ());
@@ -67,8 +66,6 @@ internalExecute()
     	comments << " par projection sur "<<m_s->getName();
     setScriptComments(comments);
     setName(comments);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandNewVertexByProjection::
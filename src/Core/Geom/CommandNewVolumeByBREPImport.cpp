@@ -23,9 +23,8 @@ CommandNewVolumeByBREPImport::
 void CommandNewVolumeByBREPImport::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-	message << "CommandNewVolumeByBREPImport::execute pour la commande " << getName ( )
-		    << " de nom unique " << getUniqueName ( ) << ".";
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandNewVolumeByBREPImport::execute pour la commande " << getName ( )
+		    << " de nom unique " << getUniqueName ( ) << ".");
 
     Volume* v;
     if (m_shape.ShapeType() == TopAbs_SOLID) {
@@ -43,8 +42,6 @@ internalExecute()
     comments << "Création du volume "<<v->getName();
     setScriptComments(comments);
     setName(comments);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 } // end namespace Geom
@@ -57,6 +57,7 @@ void Curve::applyAndReturn(std::function<TopoDS_Shape(const TopoDS_Shape&)> cons
 	for (int i=0 ; i<m_occ_edges.size() ; ++i) {
 		m_occ_edges[i] = TopoDS::Edge(lambda(m_occ_edges[i]));
 	}
+	forceComputeBoundingBox();
 }
 /*----------------------------------------------------------------------------*/
 GeomEntity* Curve::clone(Internal::Context& c)
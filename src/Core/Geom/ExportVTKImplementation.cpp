@@ -68,7 +68,7 @@ void ExportVTKImplementation::perform(Internal::InfoCommand* icmd)
 			CHECK_NULL_PTR_ERROR(surf_tmp);
 			auto surf = mesh.newGroup<gmds::Face>(surf_tmp->getName());
 
-			std::vector<gmds::TCellID>& elems = coface->faces();
+			const Topo::MeshCellIds& elems = coface->faces();
 			std::vector<gmds::Face> face_elems;
 			face_elems.resize(elems.size());
 			for(unsigned int iGMDSFace=0; iGMDSFace<elems.size(); iGMDSFace++) {
@@ -1,5 +1,6 @@
 /*----------------------------------------------------------------------------*/
 #include "Geom/GeomCommonImplementation.h"
+#include "Utils/Profiler.h"
 #include "Geom/Volume.h"
 /*----------------------------------------------------------------------------*/
 #include <TkUtil/Exception.h>
@@ -33,6 +34,7 @@ void GeomCommonImplementation::prePerform()
 /*----------------------------------------------------------------------------*/
 void GeomCommonImplementation::perform(std::vector<GeomEntity*>& res)
 {
+    MGX_PROFILE_SCOPE ("OCC common")
 	commonVolumes(res);
 }
 /*----------------------------------------------------------------------------*/
@@ -1,5 +1,6 @@
 /*----------------------------------------------------------------------------*/
 #include "Geom/GeomCutImplementation.h"
+#include "Utils/Profiler.h"
 #include "Geom/Volume.h"
 /*----------------------------------------------------------------------------*/
 #include <TkUtil/Exception.h>
@@ -37,6 +38,7 @@ void GeomCutImplementation::prePerform()
 /*----------------------------------------------------------------------------*/
 void GeomCutImplementation::perform(std::vector<GeomEntity*>& res)
 {
+    MGX_PROFILE_SCOPE ("OCC cut")
 	cutVolumes(res);
 }
 /*----------------------------------------------------------------------------*/
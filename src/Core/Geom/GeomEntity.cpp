@@ -27,7 +27,8 @@ namespace Geom {
 /*----------------------------------------------------------------------------*/
 GeomEntity::GeomEntity(Internal::Context& ctx, Utils::Property* prop, Utils::DisplayProperties* disp, GeomProperty* gprop)
 : Internal::InternalEntity (ctx, prop, disp),
-  m_geomProp(gprop), m_computedAreaIsUpToDate(false), m_computedArea(0)
+  m_geomProp(gprop), m_computedAreaIsUpToDate(false), m_computedArea(0),
+  m_computedBoundingBoxIsUpToDate(false)
 {
 }
 /*----------------------------------------------------------------------------*/
@@ -115,6 +116,16 @@ double GeomEntity::getArea() const
 	return m_computedArea;
 }
 /*----------------------------------------------------------------------------*/
+void GeomEntity::getCachedBoundingBox(Utils::Math::Point& pmin, Utils::Math::Point& pmax) const
+{
+	if (!m_computedBoundingBoxIsUpToDate){
+		computeBoundingBox(m_computedBoundingBoxMin, m_computedBoundingBoxMax);
+		m_computedBoundingBoxIsUpToDate = true;
+	}
+	pmin = m_computedBoundingBoxMin;
+	pmax = m_computedBoundingBoxMax;
+}
+/*----------------------------------------------------------------------------*/
 void GeomEntity::setDestroyed(bool b)
 {
     if (isDestroyed() == b)
@@ -1,5 +1,6 @@
 /*----------------------------------------------------------------------------*/
 #include "Geom/GeomFuseImplementation.h"
+#include "Utils/Profiler.h"
 #include "Geom/Vertex.h"
 #include "Geom/Curve.h"
 #include "Geom/Surface.h"
@@ -41,6 +42,7 @@ void GeomFuseImplementation::prePerform()
 /*----------------------------------------------------------------------------*/
 void GeomFuseImplementation::perform(std::vector<GeomEntity*>& res)
 {
+    MGX_PROFILE_SCOPE ("OCC fuse")
     if(m_init_entities[0]->getDim()==3){
     	fuseVolumes(res);
     }
@@ -10,6 +10,7 @@
 #include "Group/GroupManager.h"
 #include "Group/GroupEntity.h"
 #include "Internal/InfoCommand.h"
+#include "Internal/ThreadedJobs.h"
 /*----------------------------------------------------------------------------*/
 #include <TkUtil/TraceLog.h>
 #include <TkUtil/UTF8String.h>
@@ -30,6 +31,24 @@ namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
 namespace Geom {
 /*----------------------------------------------------------------------------*/
+/// nombre minimum de solides par tâche pour le test des volumes fermés
+static const size_t IMPORT_MIN_SOLIDS_PER_TASK = 8;
+/*----------------------------------------------------------------------------*/
+/** \return true si le solide est fermé (volume non nul) */
+static bool isClosedSolid(const TopoDS_Solid& aSolid)
+{
+	//on test les volumes fermés et ouverts
+	Standard_Boolean onlyClosed = Standard_True;
+	Standard_Boolean isUseSpan = Standard_True;
+	Standard_Real aDefaultTol = 1.e-7;
+	Standard_Boolean CGFlag = Standard_False;
+	Standard_Boolean IFlag = Standard_False;
+	GProp_GProps pb;
+	BRepGProp::VolumePropertiesGK (aSolid, pb, aDefaultTol, onlyClosed,
+			isUseSpan, CGFlag, IFlag);
+	return pb.Mass() != 0;
+}
+/*----------------------------------------------------------------------------*/
 GeomImport::
 GeomImport(Internal::Context& c, Internal::InfoCommand* icmd,
         const std::string& n, const bool onlySolidsAndFaces)
@@ -59,6 +78,18 @@ void GeomImport::perform(std::vector<GeomEntity*>& res)
     //Recuperation de la liste des shapes traduites depuis le fichier
     readFile();
 
+    // 1ère phase : analyse des solides (test des volumes fermés), en parallèle
+    // car indépendante du modèle. La seconde phase (création des entités,
+    // des noms et des groupes) reste séquentielle pour conserver la numérotation.
+    std::vector<TopoDS_Solid> solids;
+    for(unsigned int i=0; i<m_importedShapes.size();i++)
+        for (TopExp_Explorer ex(m_importedShapes[i], TopAbs_SOLID); ex.More(); ex.Next())
+            solids.push_back(TopoDS::Solid(ex.Current()));
+    std::vector<char> closed(solids.size(), 1);
+    if (m_testVolumicProperties)
+        computeClosedSolids(solids, closed);
+    size_t id_analysed = 0;
+
     // nombre de solides non fermés
     uint nb_solide_non_ferme = 0;
 
@@ -76,24 +107,8 @@ void GeomImport::perform(std::vector<GeomEntity*>& res)
         ex.Init(current_shape, TopAbs_SOLID);
         for (; ex.More(); ex.Next())
         {
-            TopoDS_Solid aSolid = TopoDS::Solid(ex.Current());
-            //on test les volumes fermés et ouverts
-            Standard_Boolean onlyClosed = Standard_True;
-            Standard_Boolean isUseSpan = Standard_True;
-            Standard_Real aDefaultTol = 1.e-7;
-            Standard_Boolean CGFlag = Standard_False;
-            Standard_Boolean IFlag = Standard_False;
-            GProp_GProps pb;
-            if (m_testVolumicProperties)
-            	Standard_Real local_eps =BRepGProp::VolumePropertiesGK (aSolid,
-            			pb,
-						aDefaultTol,
-						onlyClosed,
-						isUseSpan,
-						CGFlag,
-						IFlag);
-
-            if(m_testVolumicProperties && pb.Mass()==0){
+            TopoDS_Solid aSolid = solids[id_analysed];
+            if(!closed[id_analysed++]){
                 //ce n'est pas un volume fermé
             	nb_solide_non_ferme++;
                 TopExp_Explorer ex2;
@@ -124,7 +139,7 @@ void GeomImport::perform(std::vector<GeomEntity*>& res)
                         add(aVertex,name);
                     }
                 }
-            } // if(pb.Mass()==0)
+            } // if(!closed)
             else {
 				TkUtil::UTF8String	name (TkUtil::Charset::UTF_8);
                 name << m_shortfilename << "-solid-" << TkUtil::setw (2) << id_solid++;
@@ -200,6 +215,18 @@ void GeomImport::perform(std::vector<GeomEntity*>& res)
     }
 }
 /*----------------------------------------------------------------------------*/
+void GeomImport::
+computeClosedSolids(const std::vector<TopoDS_Solid>& solids, std::vector<char>& closed)
+{
+	// tranches plus petites que nbSolids/nbThreads pour équilibrer la charge,
+	// le coût du calcul variant beaucoup d'un solide à l'autre
+	Internal::runThreadedRanges(solids.size(), IMPORT_MIN_SOLIDS_PER_TASK, 4,
+		[&solids, &closed](size_t first, size_t last) {
+			for (size_t i=first; i<last; i++)
+				closed[i] = isClosedSolid(solids[i]) ? 1 : 0;
+		});
+}
+/*----------------------------------------------------------------------------*/
 void GeomImport::add(TopoDS_Shape& AShape, const std::string& AName)
 {
 #ifdef _DEBUG2
@@ -1,5 +1,6 @@
 /*----------------------------------------------------------------------------*/
 #include "Geom/GeomManager.h"
+#include "Utils/Common.h"
 #include "Geom/GeomEntity.h"
 #include "Geom/Volume.h"
 #include "Geom/Surface.h"
@@ -231,15 +232,18 @@ Internal::M3DCommandResult* GeomManager::
 copy(std::vector<GeomEntity*>& entities, bool withTopo, std::string groupName)
 {
 	CHECK_ENTITIES_LIST(entities)
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::copy (";
-    for(unsigned int i=0;i<entities.size();i++){
-        if(i!=0)
-            message<<", ";
-        message << entities[i]->getName();
-    }
-    message<<", "<<groupName<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+	if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+	{
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+	    message << "GeomManager::copy (";
+	    for(unsigned int i=0;i<entities.size();i++){
+	        if(i!=0)
+	            message<<", ";
+	        message << entities[i]->getName();
+	    }
+	    message<<", "<<groupName<<")";
+	    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+	}
 
     Internal::CommandInternal* command = 0;
 
@@ -303,9 +307,7 @@ newVertex(std::string vertexName,std::string curveName, std::string groupName){
 Internal::M3DCommandResult* GeomManager::
 newVertex(const Vertex* ref,  Curve* curve, std::string groupName)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newVertex("<<ref->getName()<<", "<<curve->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::newVertex("<<ref->getName()<<", "<<curve->getName()<<")");
 
     //creation de la commande de création
     CommandNewVertexByProjection *command =
@@ -332,9 +334,7 @@ newVertex(const Vertex* ref,  Curve* curve, std::string groupName)
 Internal::M3DCommandResult* GeomManager::
 newVertex(const Vertex* ref,  Surface* surface, std::string groupName)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newVertex("<<ref->getName()<<", "<<surface->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::newVertex("<<ref->getName()<<", "<<surface->getName()<<")");
 
     //creation de la commande de création
     CommandNewVertexByProjection *command =
@@ -368,9 +368,7 @@ newVertex(std::string curveName, const double& param, std::string groupName)
 Internal::M3DCommandResult* GeomManager::
 newVertex(Curve* curve, const double& param, std::string groupName)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newVertex("<<curve->getName()<<", "<<param<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::newVertex("<<curve->getName()<<", "<<param<<")");
 
     //creation de la commande de création
     CommandNewVertexByCurveParameterization *command =
@@ -405,9 +403,7 @@ newVertex(std::string vertex1Name, std::string vertex2Name, const double& param,
 Internal::M3DCommandResult* GeomManager::
 newVertex(const Vertex* ref1, const Vertex* ref2, const double& param, std::string groupName)
 {
-    TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newVertex("<<ref1->getName()<<", "<<ref2->getName()<<", "<<param<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::newVertex("<<ref1->getName()<<", "<<ref2->getName()<<", "<<param<<")");
 
     Point p1 = ref1->getPoint();
     Point p2 = ref2->getPoint();
@@ -451,9 +447,7 @@ newVertex(const double& x, const double& y, const double& z, std::string groupNa
 Internal::M3DCommandResult* GeomManager::
 newVertex(const Point& p, std::string groupName)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newVertex ("<<p<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::newVertex ("<<p<<")");
 
     //creation de la commande de création
     CommandNewVertex *command = new CommandNewVertex(getContext(),p, groupName);
@@ -478,9 +472,7 @@ newVertex(const Point& p, std::string groupName)
 Internal::M3DCommandResult* GeomManager::
 newVertexFromTopo(std::string vertexName, bool asso, std::string groupName)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-	message << "GeomManager::newVertexFromTopo(" << vertexName << ", " << (true == asso ? "True" : "False") << ", " << groupName << ")";
-	log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::newVertexFromTopo(" << vertexName << ", " << (true == asso ? "True" : "False") << ", " << groupName << ")");
 	Topo::Vertex*	vertex	= getContext ().getTopoManager ( ).getVertex (vertexName, true);
 	CHECK_NULL_PTR_ERROR (vertex)
 	Internal::CommandComposite* commandCompo = new Internal::CommandComposite(getContext(), "Création d'un sommet géométrique à partir d'un sommet topologique.");
@@ -519,9 +511,7 @@ newSegment(std::string n1,std::string n2, std::string groupName)
 Internal::M3DCommandResult* GeomManager::
 newSegment( Geom::Vertex* v1,  Geom::Vertex* v2, std::string groupName)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newSegment ("<<v1->getCoord()<<","<<v2->getCoord()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::newSegment ("<<v1->getCoord()<<","<<v2->getCoord()<<")");
 
     //creation de la commande de création
     CommandNewSegment*command = new CommandNewSegment(getContext(),v1,v2, groupName);
@@ -558,9 +548,7 @@ Internal::M3DCommandResult* GeomManager::
 newPlanarSurface(const std::vector<Geom::Curve* >& curves, std::string groupName )
 {
 	CHECK_ENTITIES_LIST(curves)
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newPlanarSurface from curves";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::newPlanarSurface from curves");
 
     //creation de la commande de création
     CommandNewSurface* command = new CommandNewSurface(getContext(),curves, groupName);
@@ -588,12 +576,15 @@ newSurfaceByOffset(std::string name, const double& offset, std::string groupName
 Internal::M3DCommandResult* GeomManager::
 newSurfaceByOffset(Surface* base, const double& offset, std::string groupName)
 {
-	TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-	message << "GeomManager::newSurfaceByOffset("<<base->getName()<<", "<<offset;
-	if (!groupName.empty())
-		message<<", "<<groupName;
-	message<<")";
-	log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+	if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+	{
+		TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+		message << "GeomManager::newSurfaceByOffset("<<base->getName()<<", "<<offset;
+		if (!groupName.empty())
+			message<<", "<<groupName;
+		message<<")";
+		log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+	}
 
 	Internal::CommandInternal* command = new CommandNewSurfaceByOffset(getContext(), base, offset, groupName);
 
@@ -616,9 +607,7 @@ newSurfaceByOffset(Surface* base, const double& offset, std::string groupName)
 Mgx3D::Internal::M3DCommandResult* GeomManager::
 newVerticesCurvesAndPlanarSurface(std::vector<Point>& points, std::string groupName)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newVerticesCurvesAndPlanarSurface from points";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::newVerticesCurvesAndPlanarSurface from points");
 
     Internal::CommandComposite* commandCompo =
     		new Internal::CommandComposite(getContext(), "Création d'une surface avec vecteur de points");
@@ -785,9 +774,7 @@ GeomManager::newCurveByCurveProjectionOnSurface(const std::string& curveName, co
 Internal::M3DCommandResult*
 GeomManager::newCurveByCurveProjectionOnSurface(Geom::Curve* curve, Geom::Surface* surface, std::string groupName)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newCurveByCurveProjectionOnSurface("<<curve->getName()<<", "<<surface->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::newCurveByCurveProjectionOnSurface("<<curve->getName()<<", "<<surface->getName()<<")");
 
     CommandNewCurveByCurveProjectionOnSurface *command =
             new CommandNewCurveByCurveProjectionOnSurface(getContext(), curve, surface, groupName);
@@ -824,15 +811,18 @@ Internal::M3DCommandResult* GeomManager::
 destroy(std::vector<Geom::GeomEntity*>& entities, bool propagagetDown)
 {
 	CHECK_ENTITIES_LIST(entities)
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::destroy(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<",";
-    if(propagagetDown)
-        message <<", true)";
-    else
-        message <<", false)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+	if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+	{
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+	    message <<"GeomManager::destroy(";
+	    for (uint i=0; i<entities.size(); i++)
+	        message <<entities[i]->getName()<<",";
+	    if(propagagetDown)
+	        message <<", true)";
+	    else
+	        message <<", false)";
+	    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+	}
 
     Internal::CommandInternal* command = 0;
 
@@ -893,15 +883,18 @@ Internal::M3DCommandResult* GeomManager::
 destroyWithTopo(std::vector<Geom::GeomEntity*>& entities, bool propagagetDown)
 {
 	CHECK_ENTITIES_LIST(entities)
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::destroyWithTopo(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<",";
-    if(propagagetDown)
-        message <<", true)";
-    else
-        message <<", false)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::destroyWithTopo(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<",";
+        if(propagagetDown)
+            message <<", true)";
+        else
+            message <<", false)";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandInternal* command = 0;
 
@@ -973,12 +966,15 @@ scale(std::vector<Geom::GeomEntity*>& entities, const double factor, const Point
     	throw TkUtil::Exception(TkUtil::UTF8String ("Aucune entité sélectionnée pour l'homothétie", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::scale(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<",";
-    message <<factor<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::scale(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<",";
+        message <<factor<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandInternal* command = 0;
     Geom::CommandEditGeom *commandGeom = 0;
@@ -1023,9 +1019,7 @@ scale(std::vector<Geom::GeomEntity*>& entities, const double factor, const Point
 Internal::M3DCommandResult* GeomManager::
 scaleAll(const double factor, const Point& pcentre)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::scaleAll("<<factor<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::scaleAll("<<factor<<")");
 
     Internal::CommandComposite* commandCompo =
     		new Internal::CommandComposite(getContext(), "Homothétie de tout");
@@ -1094,15 +1088,18 @@ scale(std::vector<Geom::GeomEntity*>& entities,
     	throw TkUtil::Exception(TkUtil::UTF8String ("Aucune entité sélectionnée pour l'homothétie", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::scale(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<",";
-    message <<factorX<<", "<<factorY<<", "<<factorZ;
-    if (!(pcentre == Point(0,0,0)))
-        message <<", "<<pcentre.getScriptCommand();
-    message <<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::scale(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<",";
+        message <<factorX<<", "<<factorY<<", "<<factorZ;
+        if (!(pcentre == Point(0,0,0)))
+            message <<", "<<pcentre.getScriptCommand();
+        message <<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandInternal* command = 0;
     Geom::CommandEditGeom *commandGeom = 0;
@@ -1156,12 +1153,15 @@ scaleAll(const double factorX,
 		const double factorZ,
 		const Point& pcentre)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::scaleAll("<<factorX<<", "<<factorY<<", "<<factorZ;
-    if (!(pcentre == Point(0,0,0)))
-        message <<", "<<pcentre.getScriptCommand();
-    message <<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::scaleAll("<<factorX<<", "<<factorY<<", "<<factorZ;
+        if (!(pcentre == Point(0,0,0)))
+            message <<", "<<pcentre.getScriptCommand();
+        message <<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandComposite* commandCompo =
     		new Internal::CommandComposite(getContext(), "Homothétie de tout");
@@ -1218,12 +1218,15 @@ copyAndScale(std::vector<Geom::GeomEntity*>& entities, const double factor, cons
     	throw TkUtil::Exception(TkUtil::UTF8String ("Aucune entité sélectionnée pour l'homothétie avec copie", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::copyAndScale(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<",";
-    message <<factor<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::copyAndScale(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<",";
+        message <<factor<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandComposite* command = 0;
 
@@ -1283,9 +1286,7 @@ copyAndScale(std::vector<Geom::GeomEntity*>& entities, const double factor, cons
 Internal::M3DCommandResult* GeomManager::
 copyAndScaleAll(const double factor, const Point& pcentre, std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::copyAndScaleAll("<<factor<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::copyAndScaleAll("<<factor<<")");
 
     Internal::CommandComposite* command =
 			new Internal::CommandComposite(getContext(), "Homothétie d'une copie de tout");
@@ -1370,15 +1371,18 @@ copyAndScale(std::vector<Geom::GeomEntity*>& entities,
     	throw TkUtil::Exception(TkUtil::UTF8String ("Aucune entité sélectionnée pour l'homothétie", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::copyAndScale(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<",";
-    message <<factorX<<", "<<factorY<<", "<<factorZ;
-    if (!(pcentre == Point(0,0,0)))
-        message <<", "<<pcentre.getScriptCommand();
-    message <<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::copyAndScale(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<",";
+        message <<factorX<<", "<<factorY<<", "<<factorZ;
+        if (!(pcentre == Point(0,0,0)))
+            message <<", "<<pcentre.getScriptCommand();
+        message <<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandComposite* command = 0;
 
@@ -1447,12 +1451,15 @@ copyAndScaleAll(const double factorX,
         const Point& pcentre,
 		std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::copyAndScaleAll("<<factorX<<", "<<factorY<<", "<<factorZ;
-    if (!(pcentre == Point(0,0,0)))
-        message <<", "<<pcentre.getScriptCommand();
-    message <<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::copyAndScaleAll("<<factorX<<", "<<factorY<<", "<<factorZ;
+        if (!(pcentre == Point(0,0,0)))
+            message <<", "<<pcentre.getScriptCommand();
+        message <<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandComposite* command =
 			new Internal::CommandComposite(getContext(), "Homothétie d'une copie de tout");
@@ -1512,12 +1519,15 @@ mirror(std::vector<Geom::GeomEntity*>& entities, Utils::Math::Plane* plane)
     	throw TkUtil::Exception(TkUtil::UTF8String ("Aucune entité sélectionnée pour la symétrie", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::mirror(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<",";
-    message <<*plane<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::mirror(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<",";
+        message <<*plane<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandInternal* command = 0;
     Geom::CommandEditGeom *commandGeom = 0;
@@ -1576,12 +1586,15 @@ copyAndMirror(std::vector<Geom::GeomEntity*>& entities, Utils::Math::Plane* plan
     	throw TkUtil::Exception(TkUtil::UTF8String ("Aucune entité sélectionnée pour la symétrie", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::copyAndMirror(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<",";
-    message <<*plane<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::copyAndMirror(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<",";
+        message <<*plane<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandComposite* command = 0;
 
@@ -1641,12 +1654,15 @@ copyAndMirror(std::vector<Geom::GeomEntity*>& entities, Utils::Math::Plane* plan
 Internal::M3DCommandResult* GeomManager::
 newBox(const Utils::Math::Point& pmin, const Utils::Math::Point& pmax, std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newBox ("<<pmin<<", "<<pmax;
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newBox ("<<pmin<<", "<<pmax;
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     //creation de la commande de création
     CommandNewBox *command = new CommandNewBox(getContext(),pmin,pmax, groupName);
@@ -1672,12 +1688,15 @@ Internal::M3DCommandResult* GeomManager::
 newCylinder(const Utils::Math::Point& pcentre, const double& dr,
             const Utils::Math::Vector& dv, const double& da, std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newCylinder("<<pcentre<<", "<<dr<<", "<<dv<<", "<<da;
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newCylinder("<<pcentre<<", "<<dr<<", "<<dv<<", "<<da;
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandNewCylinder *command = new CommandNewCylinder(getContext(), pcentre, dr, dv,da, groupName);
 
@@ -1704,12 +1723,15 @@ Internal::M3DCommandResult* GeomManager::
 newCylinder(const Utils::Math::Point& pcentre, const double& dr,
             const Utils::Math::Vector& dv, const Utils::Portion::Type& dt, std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newCylinder("<<pcentre<<", "<<dr<<", "<<dv<<", "<<Utils::Portion::getName(dt);
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newCylinder("<<pcentre<<", "<<dr<<", "<<dv<<", "<<Utils::Portion::getName(dt);
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandNewCylinder *command = new CommandNewCylinder(getContext(), pcentre, dr, dv,dt, groupName);
 
@@ -1741,16 +1763,19 @@ newHollowCylinder(
         const double& da,
         std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newHollowCylinder("<<pcentre<<", "
-            <<dr_int<<", "
-            <<dr_ext<<", "
-            <<dv<<", "<<da;
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newHollowCylinder("<<pcentre<<", "
+                <<dr_int<<", "
+                <<dr_ext<<", "
+                <<dv<<", "<<da;
 
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandNewHollowCylinder *command =
             new CommandNewHollowCylinder(getContext(), pcentre, dr_int, dr_ext,
@@ -1785,15 +1810,18 @@ newHollowCylinder(
         const Utils::Portion::Type& dt,
         std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newHollowCylinder("<<pcentre<<", "
-            <<dr_int<<", "
-            <<dr_ext<<", "
-            <<dv<<", "<<Utils::Portion::getName(dt);
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newHollowCylinder("<<pcentre<<", "
+                <<dr_int<<", "
+                <<dr_ext<<", "
+                <<dv<<", "<<Utils::Portion::getName(dt);
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandNewHollowCylinder *command =
             new CommandNewHollowCylinder(getContext(), pcentre, dr_int, dr_ext,
@@ -1824,12 +1852,15 @@ Internal::M3DCommandResult* GeomManager::
 newSphere(const Utils::Math::Point& pcentre, const double& dr,
             const double& da, std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newSphere("<<pcentre<<", "<<dr<<", "<<da;
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newSphere("<<pcentre<<", "<<dr<<", "<<da;
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Utils::Portion::Type dt(Utils::Portion::ANGLE_DEF);
     CommandNewSphere *command = new CommandNewSphere(getContext(), pcentre, dr, da, groupName);
@@ -1911,12 +1942,15 @@ newHollowSphere(
         const double& da,
         std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newHollowSphere("<<pcentre<<", "<<dr_int<<", "<<dr_ext<<", "<<da;
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newHollowSphere("<<pcentre<<", "<<dr_int<<", "<<dr_ext<<", "<<da;
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandNewHollowSphere *command =
             new CommandNewHollowSphere(getContext(), pcentre, dr_int, dr_ext,da, groupName);
@@ -1948,15 +1982,18 @@ newHollowSphere(
         const Utils::Portion::Type& dt,
         std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newHollowSphere("<<pcentre<<", "
-            <<dr_int<<", "
-            <<dr_ext<<", "
-            <<Utils::Portion::getName(dt);
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newHollowSphere("<<pcentre<<", "
+                <<dr_int<<", "
+                <<dr_ext<<", "
+                <<Utils::Portion::getName(dt);
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandNewHollowSphere *command =
             new CommandNewHollowSphere(getContext(), pcentre, dr_int,dr_ext, dt, groupName);
@@ -1983,12 +2020,15 @@ Mgx3D::Internal::M3DCommandResult*
 GeomManager::newCone(const double& dr1, const double& dr2,
    		const Vector& dv, const double& da, std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newCone("<<dr1<<", "<<dr2<<", "<<dv<<", "<<da;
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newCone("<<dr1<<", "<<dr2<<", "<<dv<<", "<<da;
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandNewCone *command = new CommandNewCone(getContext(), dr1, dr2, dv, da, groupName);
 
@@ -2015,12 +2055,15 @@ Mgx3D::Internal::M3DCommandResult*
 GeomManager::newCone(const double& dr1, const double& dr2,
    		const Vector& dv, const  Utils::Portion::Type& dt, std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newCone("<<dr1<<", "<<dr2<<", "<<dv<<", "<<Utils::Portion::getName(dt);
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newCone("<<dr1<<", "<<dr2<<", "<<dv<<", "<<Utils::Portion::getName(dt);
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandNewCone *command = new CommandNewCone(getContext(), dr1, dr2, dv, dt, groupName);
 
@@ -2087,10 +2130,13 @@ newArcCircle(const double& angleDep,
 Internal::M3DCommandResult* GeomManager::
 newArcCircle(Vertex* pc, Vertex* pd, Vertex* pe, const bool direct, std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newArcCircle("<<*pc<<", "<<*pd<<", "<<*pe
-            <<", "<<(short)direct<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newArcCircle("<<*pc<<", "<<*pd<<", "<<*pe
+                <<", "<<(short)direct<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
     Vector normal(0,0,1);
 
     CommandNewArcCircle *command =
@@ -2117,10 +2163,13 @@ newArcCircle(Vertex* pc, Vertex* pd, Vertex* pe, const bool direct, std::string
 Internal::M3DCommandResult* GeomManager::
 newArcCircle(Vertex* pc, Vertex* pd, Vertex* pe, const bool direct, const Vector& normal, std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newArcCircle("<<*pc<<", "<<*pd<<", "<<*pe
-            <<", "<<(short)direct<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newArcCircle("<<*pc<<", "<<*pd<<", "<<*pe
+                <<", "<<(short)direct<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandNewArcCircle *command =
             new CommandNewArcCircle(getContext(), pc,pd,pe,direct, normal, groupName, false);
@@ -2147,10 +2196,13 @@ newArcCircle(Vertex* pc, Vertex* pd, Vertex* pe, const bool direct, const Vector
     Internal::M3DCommandResult* GeomManager::
     newArcCircle(Vertex* pc, Vertex* pd, Vertex* pe, std::string groupName)
     {
-        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-        message << "GeomManager::newArcCircle("<<*pc<<", "<<*pd<<", "<<*pe
-                <<")";
-        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+        if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+        {
+            TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+            message << "GeomManager::newArcCircle("<<*pc<<", "<<*pd<<", "<<*pe
+                    <<")";
+            log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+        }
         Vector normal(0,0,0);
         CommandNewArcCircle *command =
                 new CommandNewArcCircle(getContext(), pc,pd,pe,false, normal, groupName, true);
@@ -2217,9 +2269,7 @@ newCircle(std::string p1,std::string p2, std::string p3, std::string groupName)
 Internal::M3DCommandResult* GeomManager::
 newCircle(Vertex* p1, Vertex* p2, Vertex* p3, std::string groupName )
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newCircle("<<*p1<<", "<<*p2<<", "<<*p3<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::newCircle("<<*p1<<", "<<*p2<<", "<<*p3<<")");
 
     CommandNewCircle *command =
             new CommandNewCircle(getContext(), p1,p2,p3, groupName);
@@ -2254,9 +2304,7 @@ newEllipse(std::string p1,std::string p2, std::string center, std::string groupN
 Internal::M3DCommandResult* GeomManager::
 newEllipse(Vertex* p1, Vertex* p2, Vertex* center, std::string groupName )
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newEllipse("<<*p1<<", "<<*p2<<", "<<*center<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::newEllipse("<<*p1<<", "<<*p2<<", "<<*center<<")");
 
     CommandNewEllipse *command =
             new CommandNewEllipse(getContext(),p1,p2,center,groupName);
@@ -2290,10 +2338,13 @@ newArcEllipse(std::string pc,std::string pd, std::string pe, const bool direct,
 Internal::M3DCommandResult* GeomManager::
 newArcEllipse(  Vertex* pc, Vertex* pd, Vertex* pe, const bool direct, std::string groupName )
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newArcEllipse("<<*pc<<", "<<*pd<<", "<<*pe
-            <<", "<<(short)direct<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newArcEllipse("<<*pc<<", "<<*pd<<", "<<*pe
+                <<", "<<(short)direct<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandNewArcEllipse *command =
             new CommandNewArcEllipse(getContext(),pc,pd,pe,direct, groupName);
@@ -2337,13 +2388,16 @@ newBSpline(Vertex* vtx1,
 		int deg_max,
 		std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newBSpline("
-    		<<vtx1->getName()<<","
-			<< vp.size()<<" Points, "
-			<<vtx2->getName()<<")";
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::newBSpline("
+        		<<vtx1->getName()<<","
+    			<< vp.size()<<" Points, "
+    			<<vtx2->getName()<<")";
 
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandNewBSpline *command =
             new CommandNewBSpline(getContext(), vtx1, vp, vtx2, deg_min, deg_max, groupName);
@@ -2380,12 +2434,15 @@ translate(std::vector<GeomEntity*>& entities, const Vector& dp)
     	throw TkUtil::Exception(TkUtil::UTF8String ("Aucune entité sélectionnée pour la translation", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::translate(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<",";
-    message <<dp<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::translate(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<",";
+        message <<dp<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandInternal* command = 0;
     Geom::CommandEditGeom *commandGeom = 0;
@@ -2426,9 +2483,7 @@ translate(std::vector<GeomEntity*>& entities, const Vector& dp)
 Internal::M3DCommandResult* GeomManager::
 translateAll(const Vector& dp)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::translateAll("<<dp<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::translateAll("<<dp<<")");
 
     Internal::CommandComposite* commandCompo =
     		new Internal::CommandComposite(getContext(), "Translation de tout");
@@ -2471,12 +2526,15 @@ copyAndTranslate(std::vector<GeomEntity*>& entities, const Vector& dp, bool with
     	throw TkUtil::Exception(TkUtil::UTF8String ("Aucune entité sélectionnée pour la translation avec copie", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::copyAndTranslate(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<",";
-    message <<dp<<", \""<<groupName<<"\")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::copyAndTranslate(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<",";
+        message <<dp<<", \""<<groupName<<"\")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandComposite* command = 0;
 
@@ -2534,9 +2592,7 @@ copyAndTranslate(std::vector<GeomEntity*>& entities, const Vector& dp, bool with
 Internal::M3DCommandResult* GeomManager::
 copyAndTranslateAll(const Vector& dp, std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::copyAndTranslateAll("<<dp<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::copyAndTranslateAll("<<dp<<")");
 
     Internal::CommandComposite*   command =
 			new Internal::CommandComposite(getContext(), "Translation d'une copie de tout");
@@ -2589,12 +2645,15 @@ Internal::M3DCommandResult* GeomManager::
 joinCurves(std::vector<GeomEntity*>& entities)
 {
 	CHECK_ENTITIES_LIST(entities)
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::joinCurves(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<",";
-    message <<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::joinCurves(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<",";
+        message <<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandInternal* command = 0;
 
@@ -2653,12 +2712,15 @@ Internal::M3DCommandResult* GeomManager::
 joinSurfaces(std::vector<GeomEntity*>& entities)
 {
 	CHECK_ENTITIES_LIST(entities)
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::joinSurfaces(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<",";
-    message <<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::joinSurfaces(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<",";
+        message <<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandInternal* command = 0;
 
@@ -2722,11 +2784,14 @@ rotate( std::vector<GeomEntity*>& entities, const Utils::Math::Rotation& rot)
     	throw TkUtil::Exception(TkUtil::UTF8String ("Aucune entité sélectionnée pour la rotation", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::rotate(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<", "<<rot<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::rotate(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<", "<<rot<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandInternal* command = 0;
 
@@ -2772,9 +2837,7 @@ rotate( std::vector<GeomEntity*>& entities, const Utils::Math::Rotation& rot)
 Internal::M3DCommandResult* GeomManager::
 rotateAll(const Utils::Math::Rotation& rot)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::rotateAll("<<rot<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::rotateAll("<<rot<<")");
 
     Internal::CommandComposite* commandCompo =
     		new Internal::CommandComposite(getContext(), "Rotation de tout");
@@ -2823,11 +2886,14 @@ copyAndRotate( std::vector<GeomEntity*>& entities,
     	throw TkUtil::Exception(TkUtil::UTF8String ("Aucune entité sélectionnée pour la rotation avec copie", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::copyAndRotate(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<", "<<rot<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::copyAndRotate(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<", "<<rot<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandComposite* command = 0;
 
@@ -2889,9 +2955,7 @@ Internal::M3DCommandResult* GeomManager::
 copyAndRotateAll(const Utils::Math::Rotation& rot,
 		std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::copyAndRotateAll("<<rot<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::copyAndRotateAll("<<rot<<")");
 
     Internal::CommandComposite* command =
 			new Internal::CommandComposite(getContext(), "Rotation d'une copie de tout");
@@ -2947,11 +3011,14 @@ makeRevol( std::vector<GeomEntity*>& entities,
         const bool keep)
 {
 	CHECK_ENTITIES_LIST(entities)
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::makeRevol(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<", "<<rot<<(keep?"True":"False")<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::makeRevol(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<", "<<rot<<(keep?"True":"False")<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandExtrudeRevolution *command =
             new CommandExtrudeRevolution(getContext(), entities,rot,keep);
@@ -2983,11 +3050,14 @@ makeExtrude( std::vector<GeomEntity*>& entities,
 		const Vector& dp, const bool keep)
 {
 	CHECK_ENTITIES_LIST(entities)
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::makeExtrude(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<", "<<dp<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::makeExtrude(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<", "<<dp<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     CommandExtrudeDirection *command =
             new CommandExtrudeDirection(getContext(), entities, dp, keep);
@@ -3018,11 +3088,14 @@ Internal::M3DCommandResult* GeomManager::
 makeBlocksByExtrude(std::vector<GeomEntity*>& entities, const Utils::Math::Vector& dv, const bool keep)
 {
 	CHECK_ENTITIES_LIST(entities)
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"GeomManager::makeBlocksByExtrude(";
-    for (uint i=0; i<entities.size(); i++)
-        message <<entities[i]->getName()<<", "<<dv<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message <<"GeomManager::makeBlocksByExtrude(";
+        for (uint i=0; i<entities.size(); i++)
+            message <<entities[i]->getName()<<", "<<dv<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandInternal* command = 0;
 
@@ -3084,15 +3157,18 @@ Internal::M3DCommandResult* GeomManager::
 fuse(std::vector<GeomEntity*>& entities)
 {
 	CHECK_ENTITIES_LIST (entities)
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::fuse (";
-    for(unsigned int i=0;i<entities.size();i++){
-        if(i!=0)
-            message<<", ";
-        message << entities[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::fuse (";
+        for(unsigned int i=0;i<entities.size();i++){
+            if(i!=0)
+                message<<", ";
+            message << entities[i]->getName();
+        }
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
     Internal::CommandInternal* command = 0;
     Geom::CommandEditGeom *commandGeom = 0;
@@ -3144,15 +3220,18 @@ Internal::M3DCommandResult* GeomManager::
 common(std::vector<Geom::GeomEntity*>& entities)
 {
 	CHECK_ENTITIES_LIST(entities)
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::common (";
-    for(unsigned int i=0;i<entities.size();i++){
-        if(i!=0)
-            message<<", ";
-        message << entities[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::common (";
+        for(unsigned int i=0;i<entities.size();i++){
+            if(i!=0)
+                message<<", ";
+            message << entities[i]->getName();
+        }
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
     Internal::CommandInternal* command = 0;
     Geom::CommandEditGeom *commandGeom = 0;
@@ -3292,9 +3371,7 @@ common2DOnCopy(Geom::GeomEntity* entity1, Geom::GeomEntity* entity2, std::string
 /*----------------------------------------------------------------------------*/
 Internal::M3DCommandResult* GeomManager::importBREP(std::string n, const bool testVolumicProperties)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::importBREP ("<<n<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::importBREP ("<<n<<")");
 
     //creation de la commande de création
     CommandImportBREP *command = new CommandImportBREP(getContext(), n, testVolumicProperties);
@@ -3317,9 +3394,7 @@ Internal::M3DCommandResult* GeomManager::importBREP(std::string n, const bool te
 /*----------------------------------------------------------------------------*/
 Internal::M3DCommandResult* GeomManager::importSTEP(std::string n, const bool testVolumicProperties)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::importSTEP ("<<n<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::importSTEP ("<<n<<")");
 
     //creation de la commande de création
     CommandImportSTEP *command = new CommandImportSTEP(getContext(), n, testVolumicProperties);
@@ -3342,9 +3417,7 @@ Internal::M3DCommandResult* GeomManager::importSTEP(std::string n, const bool te
 /*----------------------------------------------------------------------------*/
 Internal::M3DCommandResult* GeomManager::importSTL(std::string n)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::importSTL ("<<n<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::importSTL ("<<n<<")");
 
     //creation de la commande de création
     CommandImportSTL *command = new CommandImportSTL(getContext(),n);
@@ -3365,9 +3438,7 @@ Internal::M3DCommandResult* GeomManager::importSTL(std::string n)
 /*----------------------------------------------------------------------------*/
 Internal::M3DCommandResult* GeomManager::importIGES(std::string n)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::importIGES ("<<n<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::importIGES ("<<n<<")");
 
     //creation de la commande de création
     CommandImportIGES *command = new CommandImportIGES(getContext(), n);
@@ -3387,9 +3458,7 @@ Internal::M3DCommandResult* GeomManager::importIGES(std::string n)
 /*----------------------------------------------------------------------------*/
 Internal::M3DCommandResult* GeomManager::importCATIA(std::string n, const bool testVolumicProperties)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::importCATIA ("<<n<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::importCATIA ("<<n<<")");
 
     //creation de la commande de création
     CommandImportCATIA *command = new CommandImportCATIA(getContext(), n, testVolumicProperties);
@@ -3414,9 +3483,7 @@ Internal::M3DCommandResult* GeomManager::importMDL(std::string n, const bool all
 		std::string prefixName, int deg_min, int deg_max)
 {
 #ifdef USE_MDLPARSER    
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::importMDL ("<<n<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::importMDL ("<<n<<")");
 
     // création de l'importateur de modélisation/topo MDL
     Internal::ImportMDLImplementation* impl =
@@ -3490,9 +3557,7 @@ Internal::M3DCommandResult* GeomManager::importMDL(std::string n, const bool all
 Internal::M3DCommandResult* GeomManager::importMDL(std::string n, std::string groupe)
 {
 #ifdef USE_MDLPARSER    
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::importMDL ("<<n<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::importMDL ("<<n<<")");
 
     // création de l'importateur de modélisation/topo MDL
     Internal::ImportMDLImplementation* impl = new Internal::ImportMDLImplementation(getContext(), n, groupe);
@@ -3557,9 +3622,7 @@ Internal::M3DCommandResult* GeomManager::importMDL(std::string n, std::string gr
 Internal::M3DCommandResult* GeomManager::importMDL(std::string n, std::vector<std::string>& zones)
 {
 #ifdef USE_MDLPARSER    
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::importMDL ("<<n<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::importMDL ("<<n<<")");
 
     // création de l'importateur de modélisation/topo MDL
     Internal::ImportMDLImplementation* impl = new Internal::ImportMDLImplementation(getContext(), n, zones);
@@ -4049,15 +4112,18 @@ Internal::M3DCommandResult* GeomManager::
 cut(Geom::GeomEntity* tokeep, std::vector<Geom::GeomEntity*>& tocut)
 {
 	CHECK_ENTITIES_LIST(tocut)
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::cut (";
-    for(unsigned int i=0;i<tocut.size();i++){
-        if(i!=0)
-            message<<", ";
-        message << tocut[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::cut (";
+        for(unsigned int i=0;i<tocut.size();i++){
+            if(i!=0)
+                message<<", ";
+            message << tocut[i]->getName();
+        }
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
     Internal::CommandInternal* command = 0;
     Geom::CommandEditGeom *commandGeom = 0;
@@ -4119,22 +4185,25 @@ cut(std::vector<Geom::GeomEntity*>& tokeep,
 {
 	CHECK_ENTITIES_LIST(tokeep)
 	CHECK_ENTITIES_LIST(tocut)
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::cut ([";
-    for(unsigned int i=0;i<tokeep.size();i++){
-        if(i!=0)
-            message<<", ";
-        message << tokeep[i]->getName();
-    }
-    message<<"], [";
-    for(unsigned int i=0;i<tocut.size();i++){
-        if(i!=0)
-            message<<", ";
-        message << tocut[i]->getName();
-    }
-    message<<"])";
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::cut ([";
+        for(unsigned int i=0;i<tokeep.size();i++){
+            if(i!=0)
+                message<<", ";
+            message << tokeep[i]->getName();
+        }
+        message<<"], [";
+        for(unsigned int i=0;i<tocut.size();i++){
+            if(i!=0)
+                message<<", ";
+            message << tocut[i]->getName();
+        }
+        message<<"])";
 
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    }
 
     Internal::CommandInternal* command = 0;
     Geom::CommandEditGeom *commandGeom = 0;
@@ -4194,15 +4263,18 @@ glue(std::vector<std::string>& entities)
 Internal::M3DCommandResult* GeomManager::glue( std::vector<Geom::GeomEntity*>& entities)
 {
 	CHECK_ENTITIES_LIST(entities)
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::glue (";
-    for(unsigned int i=0;i<entities.size();i++){
-        if(i!=0)
-            message<<", ";
-        message << entities[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::glue (";
+        for(unsigned int i=0;i<entities.size();i++){
+            if(i!=0)
+                message<<", ";
+            message << entities[i]->getName();
+        }
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
     Internal::CommandInternal* command = 0;
 
@@ -4254,15 +4326,18 @@ Internal::M3DCommandResult* GeomManager::section( std::vector<Geom::GeomEntity*>
     GeomEntity* tool)
 {
 	CHECK_ENTITIES_LIST(entities)
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::section ([";
-    for(unsigned int i=0;i<entities.size();i++){
-        if(i!=0)
-            message<<", ";
-        message << entities[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::section ([";
+        for(unsigned int i=0;i<entities.size();i++){
+            if(i!=0)
+                message<<", ";
+            message << entities[i]->getName();
+        }
+        message<<"], "<<tool->getName()<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message<<"], "<<tool->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
     Internal::CommandInternal* command = 0;
 
@@ -4373,15 +4448,18 @@ Internal::M3DCommandResult* GeomManager::
 sectionByPlane( std::vector<Geom::GeomEntity*>& entities,
                 Utils::Math::Plane* tool, std::string planeGroupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::sectionByPlane ([";
-    for(unsigned int i=0;i<entities.size();i++){
-        if(i!=0)
-            message<<", ";
-        message << entities[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::sectionByPlane ([";
+        for(unsigned int i=0;i<entities.size();i++){
+            if(i!=0)
+                message<<", ";
+            message << entities[i]->getName();
+        }
+        message<<"], "<<tool->getScriptCommand()<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message<<"], "<<tool->getScriptCommand()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
     if (entities.empty()){
     	throw TkUtil::Exception(TkUtil::UTF8String ("Aucune entité sélectionnée pour sectionByPlane", TkUtil::Charset::UTF_8));
@@ -4780,15 +4858,18 @@ std::string GeomManager::getLastVertex() const
 Internal::M3DCommandResult* GeomManager::addToGroup(std::vector<std::string>& ve, int dim, const std::string& groupName)
 {
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::addToGroup ([";
-    for (uint i=0; i<ve.size(); i++){
-        if (i)
-            message <<", ";
-        message << ve[i];
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::addToGroup ([";
+        for (uint i=0; i<ve.size(); i++){
+            if (i)
+                message <<", ";
+            message << ve[i];
+        }
+        message << "], "<<(short)dim<<", "<<groupName<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message << "], "<<(short)dim<<", "<<groupName<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
     std::vector<GeomEntity*> entities = getEntitiesFromNames(ve, dim);
     Mesh::CommandAddRemoveGroupName* command = new Mesh::CommandAddRemoveGroupName(getContext(), entities, dim, groupName, Mesh::CommandAddRemoveGroupName::add);
@@ -4816,15 +4897,18 @@ Internal::M3DCommandResult* GeomManager::addToGroup(std::vector<std::string>& ve
 Internal::M3DCommandResult* GeomManager::removeFromGroup(std::vector<std::string>& ve, int dim, const std::string& groupName)
 {
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::removeFromGroup ([";
-    for (uint i=0; i<ve.size(); i++){
-        if (i)
-            message <<", ";
-        message << ve[i];
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::removeFromGroup ([";
+        for (uint i=0; i<ve.size(); i++){
+            if (i)
+                message <<", ";
+            message << ve[i];
+        }
+        message << "], "<<(short)dim<<", "<<groupName<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message << "], "<<(short)dim<<", "<<groupName<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
     std::vector<GeomEntity*> entities = getEntitiesFromNames(ve, dim);
     Mesh::CommandAddRemoveGroupName* command = new Mesh::CommandAddRemoveGroupName(getContext(), entities, dim, groupName, Mesh::CommandAddRemoveGroupName::remove);
@@ -4852,15 +4936,18 @@ Internal::M3DCommandResult* GeomManager::removeFromGroup(std::vector<std::string
 Internal::M3DCommandResult* GeomManager::setGroup(std::vector<std::string>& ve, int dim, const std::string& groupName)
 {
 
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::setGroup ([";
-    for (uint i=0; i<ve.size(); i++){
-        if (i)
-            message <<", ";
-        message << ve[i];
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
+        message << "GeomManager::setGroup ([";
+        for (uint i=0; i<ve.size(); i++){
+            if (i)
+                message <<", ";
+            message << ve[i];
+        }
+        message << "], "<<(short)dim<<", "<<groupName<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message << "], "<<(short)dim<<", "<<groupName<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
     std::vector<GeomEntity*> entities = getEntitiesFromNames(ve, dim);
     Mesh::CommandAddRemoveGroupName* command = new Mesh::CommandAddRemoveGroupName(getContext(), entities, dim, groupName, Mesh::CommandAddRemoveGroupName::set);
@@ -4964,9 +5051,7 @@ newVertexFromBrep(std::string brepFileName)
     }
     TopoDS_Vertex vertex = vertices[0];
 
-    TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newVertexFromBrep ("<<brepFileName<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::newVertexFromBrep ("<<brepFileName<<")");
 
     //creation de la commande de création
     CommandNewVertexByBREPImport *command = new CommandNewVertexByBREPImport(getContext(), vertex);
@@ -4999,9 +5084,7 @@ newCurveFromBrep(std::string brepFileName, std::string extremaFirstPoint, std::s
     Vertex* firstVertex = GeomManager::getVertex (extremaFirstPoint);
     Vertex* lastVertex = GeomManager::getVertex (extremaLastPoint);
 
-    TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newCurveFromBrep ("<<brepFileName<<", "<<extremaFirstPoint<<", "<<extremaLastPoint<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::newCurveFromBrep ("<<brepFileName<<", "<<extremaFirstPoint<<", "<<extremaLastPoint<<")");
 
     //creation de la commande de création
     CommandNewCurveByBREPImport *command = new CommandNewCurveByBREPImport(getContext(), edges,
@@ -5031,9 +5114,7 @@ newSurfaceFromBrep(std::string brepFileName)
         throw TkUtil::Exception(message);
     }
 
-    TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newSurfaceFromBrep ("<<brepFileName<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::newSurfaceFromBrep ("<<brepFileName<<")");
 
     //creation de la commande de création
     CommandNewSurfaceByBREPImport *command = new CommandNewSurfaceByBREPImport(getContext(), faces);
@@ -5064,9 +5145,7 @@ newVolumeFromBrep(std::string brepFileName)
         throw TkUtil::Exception(message);
     }
 
-    TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "GeomManager::newVolume  FromBrep ("<<brepFileName<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "GeomManager::newVolume  FromBrep ("<<brepFileName<<")");
 
     CommandNewVolumeByBREPImport *command;
     //creation de la commande de création
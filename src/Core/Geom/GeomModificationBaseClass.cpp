@@ -2204,6 +2204,7 @@ void GeomModificationBaseClass::createNewAdjVolumes(
                 newOCCVolume = V;
                 // il faut mettre à jour la OCC shape en cas de non conformité d'une face (issue#208)
                 newVolume->m_occ_shape = V;
+                newVolume->forceComputeBoundingBox();
                 m_toKeepVolumes.push_back(current);
 #ifdef _DEBUG2
                 std::cout<<"=*= VOLUME ADJ CONSERVE "<<newVolume->getName()<<std::endl;
@@ -0,0 +1,198 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file GeomNearestEntitySearch.cpp
+ *
+ *  \date 19 oct. 2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Geom/GeomNearestEntitySearch.h"
+#include "Geom/GeomEntity.h"
+#include "Geom/GeomProjectImplementation.h"
+#include "Internal/ThreadedJobs.h"
+/*----------------------------------------------------------------------------*/
+#include <TkUtil/Exception.h>
+#include <TkUtil/MemoryError.h>
+#include <TkUtil/UTF8String.h>
+/*----------------------------------------------------------------------------*/
+#include <algorithm>
+#include <cfloat>
+#include <climits>
+#include <functional>
+#include <queue>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Geom {
+/*----------------------------------------------------------------------------*/
+/// nombre maximum d'entités dans une feuille de la hiérarchie
+static const uint NEAREST_MAX_ENTITIES_PER_LEAF = 4;
+/// nombre minimum de points par tâche pour la recherche en parallèle
+static const size_t NEAREST_MIN_POINTS_PER_TASK = 16;
+/*----------------------------------------------------------------------------*/
+double GeomNearestEntitySearch::Box::distance2(const Utils::Math::Point& pt) const
+{
+	double dist2 = 0.0;
+	for (uint j=0; j<3; j++){
+		double c = pt.getCoord(j);
+		double d = 0.0;
+		if (c < m_min[j])
+			d = m_min[j] - c;
+		else if (c > m_max[j])
+			d = c - m_max[j];
+		dist2 += d*d;
+	}
+	return dist2;
+}
+/*----------------------------------------------------------------------------*/
+GeomNearestEntitySearch::GeomNearestEntitySearch(const std::vector<GeomEntity*>& entities)
+: m_entities(entities)
+{
+	m_boxes.resize(m_entities.size());
+	m_order.resize(m_entities.size());
+	for (uint i=0; i<m_entities.size(); i++){
+		GeomEntity* ge = m_entities[i];
+		CHECK_NULL_PTR_ERROR(ge);
+		if (ge->getDim() == 3)
+			throw TkUtil::Exception (TkUtil::UTF8String ("Projection impossible sur un volume", TkUtil::Charset::UTF_8));
+
+		Utils::Math::Point pmin, pmax;
+		ge->getCachedBoundingBox(pmin, pmax);
+		for (uint j=0; j<3; j++){
+			m_boxes[i].m_min[j] = pmin.getCoord(j);
+			m_boxes[i].m_max[j] = pmax.getCoord(j);
+		}
+		m_order[i] = i;
+	}
+
+	if (!m_entities.empty()){
+		m_nodes.reserve(2*m_entities.size()/NEAREST_MAX_ENTITIES_PER_LEAF + 1);
+		build(0, m_entities.size());
+	}
+}
+/*----------------------------------------------------------------------------*/
+GeomNearestEntitySearch::~GeomNearestEntitySearch()
+{
+}
+/*----------------------------------------------------------------------------*/
+int GeomNearestEntitySearch::build(uint first, uint last)
+{
+	int ind = m_nodes.size();
+	m_nodes.push_back(Node());
+
+	Box box = m_boxes[m_order[first]];
+	double cmin[3], cmax[3];
+	for (uint j=0; j<3; j++)
+		cmin[j] = cmax[j] = (box.m_min[j]+box.m_max[j])*0.5;
+	for (uint k=first+1; k<last; k++){
+		const Box& bk = m_boxes[m_order[k]];
+		for (uint j=0; j<3; j++){
+			box.m_min[j] = std::min(box.m_min[j], bk.m_min[j]);
+			box.m_max[j] = std::max(box.m_max[j], bk.m_max[j]);
+			double c = (bk.m_min[j]+bk.m_max[j])*0.5;
+			cmin[j] = std::min(cmin[j], c);
+			cmax[j] = std::max(cmax[j], c);
+		}
+	}
+
+	int left = -1, right = -1;
+	if (last - first > NEAREST_MAX_ENTITIES_PER_LEAF){
+		// découpage suivant la médiane des centres dans la plus grande direction
+		uint axis = 0;
+		for (uint j=1; j<3; j++)
+			if (cmax[j]-cmin[j] > cmax[axis]-cmin[axis])
+				axis = j;
+		uint mid = (first + last) / 2;
+		std::nth_element(m_order.begin()+first, m_order.begin()+mid, m_order.begin()+last,
+				[this, axis](uint i1, uint i2){
+			return m_boxes[i1].m_min[axis]+m_boxes[i1].m_max[axis]
+				 < m_boxes[i2].m_min[axis]+m_boxes[i2].m_max[axis];
+		});
+		left = build(first, mid);
+		right = build(mid, last);
+	}
+
+	// m_nodes a pu être réalloué par les appels récursifs
+	Node& node = m_nodes[ind];
+	node.m_box = box;
+	node.m_first = first;
+	node.m_last = last;
+	node.m_left = left;
+	node.m_right = right;
+
+	return ind;
+}
+/*----------------------------------------------------------------------------*/
+GeomEntity* GeomNearestEntitySearch::findNearest(const Utils::Math::Point& pt,
+		Utils::Math::Point& projected) const
+{
+	if (m_nodes.empty())
+		return 0;
+
+	uint best = UINT_MAX;
+	double best_dist2 = DBL_MAX;
+
+	// parcours des noeuds suivant la distance à leur boite
+	typedef std::pair<double, int> QueueItem;
+	std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<QueueItem> > queue;
+	queue.push(QueueItem(m_nodes[0].m_box.distance2(pt), 0));
+
+	while (!queue.empty()){
+		QueueItem item = queue.top();
+		queue.pop();
+		// les noeuds restants sont tous plus loin
+		if (item.first > best_dist2)
+			break;
+
+		const Node& node = m_nodes[item.second];
+		if (node.m_left == -1){
+			for (uint k=node.m_first; k<node.m_last; k++){
+				uint ind = m_order[k];
+				double lower = m_boxes[ind].distance2(pt);
+				// à distance égale, on retient la première entité de la liste
+				if (lower > best_dist2 || (lower == best_dist2 && ind > best))
+					continue;
+
+				Geom::GeomProjectVisitor gpv(pt);
+				m_entities[ind]->accept(gpv);
+				const Utils::Math::Point& pt2 = gpv.getProjectedPoint();
+				double dist2 = pt.length2(pt2);
+				if (dist2 < best_dist2 || (dist2 == best_dist2 && ind < best)){
+					best_dist2 = dist2;
+					best = ind;
+					projected = pt2;
+				}
+			}
+		}
+		else {
+			for (int child : {node.m_left, node.m_right}){
+				double lower = m_nodes[child].m_box.distance2(pt);
+				if (lower <= best_dist2)
+					queue.push(QueueItem(lower, child));
+			}
+		}
+	} // end while (!queue.empty())
+
+	return best == UINT_MAX ? 0 : m_entities[best];
+}
+/*----------------------------------------------------------------------------*/
+void GeomNearestEntitySearch::findNearest(const std::vector<Utils::Math::Point>& points,
+		std::vector<GeomEntity*>& nearest,
+		std::vector<Utils::Math::Point>& projected) const
+{
+	const size_t nbPoints = points.size();
+	nearest.assign(nbPoints, 0);
+	projected.resize(nbPoints);
+
+	// tranches plus petites que nbPoints/nbThreads pour équilibrer la charge,
+	// le nombre de projections variant d'un point à l'autre
+	Internal::runThreadedRanges(nbPoints, NEAREST_MIN_POINTS_PER_TASK, 4,
+		[this, &points, &nearest, &projected](size_t first, size_t last) {
+			for (size_t i=first; i<last; i++)
+				nearest[i] = findNearest(points[i], projected[i]);
+		});
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Geom
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
@@ -5,6 +5,7 @@
 #include "Geom/Curve.h"
 #include "Geom/Vertex.h"
 #include "Geom/Surface.h"
+#include "Utils/Profiler.h"
 /*----------------------------------------------------------------------------*/
 #include <BRep_Tool.hxx>
 #include <BRepBuilderAPI_MakeVertex.hxx>
@@ -28,12 +29,14 @@ project(const Vertex* v, const Point& P) const
 std::pair<Point, uint> GeomProjectImplementation::
 project(const Curve* c, const Point& P) const
 {
+	MGX_PROFILE_COUNT ("projections sur courbes", 1.)
 	return _project(c->getOCCEdges(), P);
 }
 /*----------------------------------------------------------------------------*/
 std::pair<Point, uint> GeomProjectImplementation::
 project(const Surface* s, const Point& P) const
 {
+	MGX_PROFILE_COUNT ("projections sur surfaces", 1.)
 	return _project(s->getOCCFaces(), P);
 }
 /*----------------------------------------------------------------------------*/
@@ -1,5 +1,6 @@
 /*----------------------------------------------------------------------------*/
 #include "Geom/GeomSectionByPlaneImplementation.h"
+#include "Utils/Profiler.h"
 #include "Geom/Vertex.h"
 #include "Geom/Curve.h"
 #include "Geom/Surface.h"
@@ -61,6 +62,7 @@ void GeomSectionByPlaneImplementation::prePerform()
 /*----------------------------------------------------------------------------*/
 void GeomSectionByPlaneImplementation::perform(std::vector<GeomEntity*>& res)
 {
+    MGX_PROFILE_SCOPE ("OCC section by plane")
 	splitEntities(res);
 }
 /*----------------------------------------------------------------------------*/
@@ -1,5 +1,6 @@
 /*----------------------------------------------------------------------------*/
 #include "Geom/GeomSectionImplementation.h"
+#include "Utils/Profiler.h"
 #include "Geom/Vertex.h"
 #include "Geom/Surface.h"
 #include "Geom/Volume.h"
@@ -52,6 +53,7 @@ void GeomSectionImplementation::prePerform()
 /*----------------------------------------------------------------------------*/
 void GeomSectionImplementation::perform(std::vector<GeomEntity*>& res)
 {
+    MGX_PROFILE_SCOPE ("OCC section")
     /* m_ref_entities[i] contient toutes les shapes et sous-shapes
      * passées en argument de l'opération en cours de traitement.
      *
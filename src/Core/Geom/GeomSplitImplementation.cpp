@@ -12,6 +12,10 @@
 #include <TopoDS_Vertex.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopTools_IndexedMapOfShape.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+#include <TopTools_DataMapOfShapeInteger.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+#include <NCollection_DataMap.hxx>
 #include <TopExp.hxx>
 #include <BRepCheck_Analyzer.hxx>
 #include <GProp_GProps.hxx>
@@ -20,6 +24,62 @@
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
 namespace Geom {
+/*----------------------------------------------------------------------------*/
+/// Table d'identité (IsSame) entre une shape OCC et ses indices dans un vecteur
+typedef NCollection_DataMap<TopoDS_Shape, std::vector<int>, TopTools_ShapeMapHasher> ShapeIndices;
+/*----------------------------------------------------------------------------*/
+/** Crée les sommets de la shape et les relie aux courbes déjà créées.
+ *  curvesIndex donne pour chaque arête OCC les indices (dans curves) des
+ *  courbes créées à partir de cette arête, chacune n'étant reliée qu'une fois
+ *  à un même sommet.
+ */
+static void createAndLinkVertices(const TopoDS_Shape& shape,
+		const ShapeIndices& curvesIndex, const std::vector<Curve*>& curves,
+		EntityFactory& factory, std::vector<Vertex* >& vert)
+{
+	TopTools_IndexedDataMapOfShapeListOfShape map;
+	TopExp::MapShapesAndAncestors(shape, TopAbs_VERTEX, TopAbs_EDGE, map);
+	// on a ainsi tous les sommets dans map et pour chaque sommet, on
+	// connait les aretes auxquelles il appartient.
+
+	// les sommets sont créés dans l'ordre du parcours de la shape
+	TopTools_IndexedMapOfShape map_vertices;
+	TopExp::MapShapes(shape, TopAbs_VERTEX, map_vertices);
+
+	for(int i = 1; i <= map_vertices.Extent(); i++)
+	{
+		TopoDS_Vertex V = TopoDS::Vertex(map_vertices(i));
+		// creation du sommet
+		Vertex* v = factory.newOCCVertex(V);
+		vert.push_back(v);
+
+		/* on récupère les arêtes contenant ce sommet. Mais attention, ce nb
+		* d'arêtes est trop important car des doublons existent.
+		*/
+		const TopTools_ListOfShape& listEdges = map.FindFromKey(V);
+
+		// nombre de courbes déjà reliées au sommet pour chaque arête OCC, ce
+		// qui évite de récupérer 2 fois le même sommet
+		TopTools_DataMapOfShapeInteger still_done;
+
+		for(TopTools_ListIteratorOfListOfShape it_edges(listEdges); it_edges.More(); it_edges.Next()){
+			const TopoDS_Shape& edge = it_edges.Value();
+			const std::vector<int>* indices = curvesIndex.Seek(edge);
+			if (0 == indices)
+				continue;	// arête sans courbe (de taille nulle par exemple)
+			int* nb = still_done.ChangeSeek(edge);
+			if (0 == nb)
+				nb = still_done.Bound(edge, 0);
+			if (*nb >= (int)indices->size())
+				continue;
+			Curve* c = curves[(*indices)[(*nb)++]];
+			// on crée le lien C->V
+			c->add(v);
+			// on crée le lien V->C
+			v->add(c);
+		}
+	}
+}
 /*----------------------------------------------------------------------------*/        
 GeomSplitImplementation::GeomSplitImplementation(Internal::Context& context)
 : m_context(context)
@@ -76,11 +136,29 @@ void GeomSplitImplementation::split(Curve* curve, std::vector<Vertex* >&  vert)
 		TopoDS_Vertex Vdep;
 		TopoDS_Vertex Vfin;
 
-		for (uint i=0; i<vtx.size()-1; i++){
+		// les sommets partagés (même shape OCC) par plusieurs arêtes ne sont
+		// pas des extrémités
+		TopTools_DataMapOfShapeInteger nbOccurrences;
+		for (uint i=0; i<vtx.size(); i++){
+			int* nb = nbOccurrences.ChangeSeek(vtx[i]);
+			if (0 == nb)
+				nbOccurrences.Bind(vtx[i], 1);
+			else
+				(*nb)++;
+		}
+		for (uint i=0; i<vtx.size(); i++)
+			if (nbOccurrences.Find(vtx[i]) > 1)
+				vtx[i].Nullify();
+
+		// test géométrique uniquement entre les sommets restants, distincts
+		// mais éventuellement confondus
+		for (uint i=0; i+1<vtx.size(); i++){
 			TopoDS_Vertex V1 = vtx[i];
+			if (V1.IsNull())
+				continue;
 			for (uint j=i+1; j<vtx.size(); j++){
 				TopoDS_Vertex V2 = vtx[j];
-				if ((!V1.IsNull()) && (!V2.IsNull()) && OCCHelper::areEquals(V1,V2)){
+				if ((!V2.IsNull()) && OCCHelper::areEquals(V1,V2)){
 					 vtx[i].Nullify();
 					 vtx[j].Nullify();
 				}
@@ -134,8 +212,8 @@ void GeomSplitImplementation::split(Surface* surf,
 		*/
 		TopExp_Explorer e;
 
-		/* on crée les faces */
-		std::vector<TopoDS_Shape> OCCCurves;
+		/* on crée les courbes */
+		ShapeIndices              OCCCurves;
 		std::vector<Curve *>      Mgx3DCurves;
 
 		for(e.Init(rep, TopAbs_EDGE); e.More(); e.Next())
@@ -147,7 +225,10 @@ void GeomSplitImplementation::split(Surface* surf,
 			curv.push_back(c);
 
 			// correspondance entre shapes OCC et géométries Mgx3D
-			OCCCurves.push_back(E);
+			std::vector<int>* indices = OCCCurves.ChangeSeek(E);
+			if (0 == indices)
+				indices = OCCCurves.Bound(E, std::vector<int>());
+			indices->push_back(Mgx3DCurves.size());
 			Mgx3DCurves.push_back(c);
 			// on crée le lien V->F
 			surf->add(c);
@@ -158,56 +239,7 @@ void GeomSplitImplementation::split(Surface* surf,
 
 		// maintenant que les aretes sont créées, on crée les
 		// sommets
-		TopTools_IndexedDataMapOfShapeListOfShape map;
-		TopExp::MapShapesAndAncestors(rep, TopAbs_VERTEX, TopAbs_EDGE, map);
-		// on a ainsi tous les sommets dans map et pour chaque sommet, on
-		// connait les aretes auxquelles il appartient.
-
-		/* on crée les labels contenants les sommets et pour chaque sommet,
-		* on fait pointer une ref à partir des labels ayant les aretes
-		* correspondantes */
-		TopTools_IndexedMapOfShape map_vertices;
-		TopExp::MapShapes(rep,TopAbs_VERTEX, map_vertices);
-		TopTools_ListOfShape listEdges;
-
-		for(int i = 1; i <= map_vertices.Extent(); i++)
-		{
-			TopoDS_Vertex V = TopoDS::Vertex(map_vertices(i));
-			// creation du sommet
-			Vertex* v = factory.newOCCVertex(V);
-			vert.push_back(v);
-
-			/* on récupère les arêtes contenant ce sommet. Mais attention, ce nb
-			* d'arêtes est trop important car des doublons existent.
-			*/
-			listEdges = map.FindFromKey(V);
-
-			TopTools_ListIteratorOfListOfShape it_edges;
-
-			// ce vecteur nous sert à ne pas récupérer 2 fois le même sommet
-			std::vector<bool> still_done;
-			still_done.resize(Mgx3DCurves.size(),0);
-
-			for(it_edges.Initialize(listEdges);it_edges.More();it_edges.Next()){
-				TopoDS_Shape shape =  it_edges.Value();
-				Curve *c= 0;
-				bool not_find_shape = true;
-				for(int i =0; i<OCCCurves.size() && not_find_shape; i++){
-					if(shape.IsSame(OCCCurves[i]) && !still_done[i]){
-						not_find_shape = false;
-						c = Mgx3DCurves[i];
-						still_done[i] = true;
-					}
-				}
-				// si on a trouvé la shape et qu'elle n'avait pas déjà été traitée
-				if(!not_find_shape){
-					// on crée le lien C->V
-					c->add(v);
-					// on crée le lien V->C
-					v->add(c);
-				}
-			}
-		}
+		createAndLinkVertices(rep, OCCCurves, Mgx3DCurves, factory, vert);
 	}
 }
 /*----------------------------------------------------------------------------*/
@@ -226,9 +258,9 @@ void GeomSplitImplementation::split(Volume* vol,
     //        throw TkUtil::Exception("Wrong OCC shape type!!!");
 
     /* on crée les faces */
-    std::vector<TopoDS_Shape> OCCFaces;
+    TopTools_DataMapOfShapeInteger OCCFaces;
     std::vector<Surface*>     Mgx3DSurfaces;
-    std::vector<TopoDS_Shape> OCCCurves;
+    ShapeIndices              OCCCurves;
     std::vector<Curve *>      Mgx3DCurves;
 
     TopoDS_Shape occ_shape = vol->getOCCShape();
@@ -241,7 +273,8 @@ void GeomSplitImplementation::split(Volume* vol,
         surf.push_back(s);
 
         // correspondance entre shapes OCC et géométries Mgx3D
-        OCCFaces.push_back(F);
+        if (!OCCFaces.IsBound(F))
+            OCCFaces.Bind(F, Mgx3DSurfaces.size());
         Mgx3DSurfaces.push_back(s);
         // on crée le lien V->F
         vol->add(s);
@@ -278,7 +311,7 @@ void GeomSplitImplementation::split(Volume* vol,
         curv.push_back(c);
 
         // correspondance entre shapes OCC et géométries Mgx3D
-        OCCCurves.push_back(E);
+        OCCCurves.Bind(E, std::vector<int>(1, Mgx3DCurves.size()));
         Mgx3DCurves.push_back(c);
 
         /* on récupère les faces contenant cette arête et déjà crées donc
@@ -286,75 +319,21 @@ void GeomSplitImplementation::split(Volume* vol,
         listFaces = map.FindFromKey(E);
         TopTools_ListIteratorOfListOfShape it_faces;
         for(it_faces.Initialize(listFaces);it_faces.More();it_faces.Next()){
-            TopoDS_Shape shape =  it_faces.Value();
-
-        Surface *s= 0;
-        bool not_find_shape = true;
-        for(int i =0; i<OCCFaces.size() && not_find_shape; i++)
-            if(shape.IsSame(OCCFaces[i])){
-                not_find_shape = false;
-                s = Mgx3DSurfaces[i];
-            }
-
-        // on crée le lien S->C
-        s->add(c);
-        // on crée le lien C->S
-        c->add(s);
+            const int* index = OCCFaces.Seek(it_faces.Value());
+            if (0 == index)
+                continue;
+            Surface *s = Mgx3DSurfaces[*index];
+
+            // on crée le lien S->C
+            s->add(c);
+            // on crée le lien C->S
+            c->add(s);
         }
     }
 
     // maintenant que les faces et les aretes sont créées, on crée les
     // sommets
-    TopExp::MapShapesAndAncestors(occ_shape, TopAbs_VERTEX, TopAbs_EDGE, map);
-    // on a ainsi tous les sommets dans map et pour chaque sommet, on
-    // connait les aretes auxquelles il appartient.
-
-    /* on crée les labels contenants les sommets et pour chaque sommet,
-    * on fait pointer une ref à partir des labels ayant les aretes
-    * correspondantes */
-    TopTools_IndexedMapOfShape map_vertices;
-    TopExp::MapShapes(occ_shape,TopAbs_VERTEX, map_vertices);
-    TopTools_ListOfShape listEdges;
-
-    for(int i = 1; i <= map_vertices.Extent(); i++)
-    {
-        TopoDS_Vertex V = TopoDS::Vertex(map_vertices(i));
-        // creation du sommet
-        Vertex* v = factory.newOCCVertex(V);
-        vert.push_back(v);
-
-        /* on récupère les arêtes contenant ce sommet. Mais attention, ce nb
-        * d'arêtes est trop important car des doublons existent.
-        */
-        listEdges = map.FindFromKey(V);
-
-        TopTools_ListIteratorOfListOfShape it_edges;
-
-        // ce vecteur nous sert à ne pas récupérer 2 fois le même sommet
-        std::vector<bool> still_done;
-        still_done.resize(Mgx3DCurves.size(),0);
-
-        for(it_edges.Initialize(listEdges);it_edges.More();it_edges.Next()){
-        TopoDS_Shape shape =  it_edges.Value();
-        Curve *c= 0;
-        bool not_find_shape = true;
-        for(int i =0; i<OCCCurves.size() && not_find_shape; i++){
-            if(shape.IsSame(OCCCurves[i]) && !still_done[i]){
-                not_find_shape = false;
-                c = Mgx3DCurves[i];
-                still_done[i] = true;
-            }
-        }
-        // si on a trouvé la shape et qu'elle n'avait pas déjà été traitée
-        if(!not_find_shape){
-            // on crée le lien C->V
-            c->add(v);
-            // on crée le lien V->C
-            v->add(c);
-        }
-
-        }
-    }
+    createAndLinkVertices(occ_shape, OCCCurves, Mgx3DCurves, factory, vert);
 }
 /*----------------------------------------------------------------------------*/
 } // end namespace Geom
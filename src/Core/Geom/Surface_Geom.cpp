@@ -55,6 +55,7 @@ void Surface::applyAndReturn(std::function<TopoDS_Shape(const TopoDS_Shape&)> co
 	for (int i=0 ; i<m_occ_faces.size() ; ++i) {
 		m_occ_faces[i] = TopoDS::Face(lambda(m_occ_faces[i]));
 	}
+	forceComputeBoundingBox();
 }
 /*----------------------------------------------------------------------------*/
 GeomEntity* Surface::clone(Internal::Context& c)
@@ -35,6 +35,7 @@ void Vertex::apply(std::function<void(const TopoDS_Shape&)> const& lambda) const
 void Vertex::applyAndReturn(std::function<TopoDS_Shape(const TopoDS_Shape&)> const& lambda)
 {
     m_occ_vertex = TopoDS::Vertex(lambda(m_occ_vertex));
+    forceComputeBoundingBox();
 }
 /*----------------------------------------------------------------------------*/
 GeomEntity* Vertex::clone(Internal::Context& c)
@@ -35,6 +35,7 @@ void Volume::apply(std::function<void(const TopoDS_Shape&)> const& lambda) const
 void Volume::applyAndReturn(std::function<TopoDS_Shape(const TopoDS_Shape&)> const& lambda)
 {
     m_occ_shape = lambda(m_occ_shape);
+    forceComputeBoundingBox();
 }
 /*----------------------------------------------------------------------------*/
 GeomEntity* Volume::clone(Internal::Context& c)
@@ -690,10 +690,10 @@ void GroupManager::updateDisplayProperties(Internal::InfoCommand* icmd)
     addMarkAllGroups(m_visibilityMask, filtre_geom, filtre_topo, filtre_rep, 1);
 
     // on parcours les entités nouvelles/modifiées
-    for (uint i=0; i<icmd->getNbGeomInfoEntity(); i++) {
-        Geom::GeomEntity* ge = 0;
-        Internal::InfoCommand::type t;
-        icmd->getGeomInfoEntity(i, ge, t);
+    const std::vector<Internal::InfoCommand::GeomEntityInfo>& geom_entities_info = icmd->getGeomInfoEntities();
+    for (uint i=0; i<geom_entities_info.size(); i++) {
+        Geom::GeomEntity* ge = geom_entities_info[i].m_geom_entity;
+        Internal::InfoCommand::type t = geom_entities_info[i].m_type;
 
         // on passe les entités non représentables et celles détruites
         if (ge->getDisplayProperties ( ).isDisplayable()
@@ -701,12 +701,11 @@ void GroupManager::updateDisplayProperties(Internal::InfoCommand* icmd)
             ge->getDisplayProperties ( ).setDisplayed(filtre_geom[ge] == 1);
     } // end for i<icmd->getNbGeomInfoEntity()
 
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>& topo_entities_info = icmd->getTopoInfoEntity();
+    std::vector<Internal::InfoCommand::TopoEntityInfo>& topo_entities_info = icmd->getTopoInfoEntity();
 
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
-            iter_tei != topo_entities_info.end(); ++iter_tei){
-        Topo::TopoEntity* te = (*iter_tei).first;
-        Internal::InfoCommand::type t = iter_tei->second;
+    for (uint i_tei=0; i_tei<topo_entities_info.size(); i_tei++){
+        Topo::TopoEntity* te = topo_entities_info[i_tei].m_topo_entity;
+        Internal::InfoCommand::type t = topo_entities_info[i_tei].m_type;
 
         // on passe les entités non représentables et celles détruites
         if (te->getDisplayProperties ( ).isDisplayable()
@@ -723,7 +722,7 @@ void GroupManager::updateDisplayProperties(Internal::InfoCommand* icmd)
         			// visible ou non, on le met dans la propriété pour
         			// passer le paramètre à la vue
         			te->getDisplayProperties ( ).setDisplayed(new_displayed);
-        			iter_tei->second = Internal::InfoCommand::VISIBILYCHANGED;
+        			topo_entities_info[i_tei].m_type = Internal::InfoCommand::VISIBILYCHANGED;
         		}
         	}
         	else {
@@ -734,7 +733,7 @@ void GroupManager::updateDisplayProperties(Internal::InfoCommand* icmd)
 #endif
         	}
         }
-    } // end for iter_tei
+    } // end for i_tei
 
     for (uint i=0; i<icmd->getNbSysCoordInfoEntity(); i++) {
     	CoordinateSystem::SysCoord* rep = 0;
@@ -41,12 +41,9 @@ CommandComposite::~CommandComposite()
 void CommandComposite::
 internalExecute()
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message << "CommandComposite::execute pour la commande " << getName ( )
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandComposite::execute pour la commande " << getName ( )
             << " de nom unique " << getUniqueName ( )
-            << ", composée de "<<m_commands.size() << " commandes";
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
+            << ", composée de "<<m_commands.size() << " commandes");
 
     // exécution successive des différentes commandes
     for (std::vector<CommandInternal*>::iterator iter = m_commands.begin();
@@ -63,19 +60,18 @@ internalExecute()
         iter != m_commands.end(); ++iter) {
        Internal::InfoCommand& icmd_iter = (*iter)->getInfoCommand();
 
-        for (uint i=0; i<icmd_iter.getNbGeomInfoEntity(); i++) {
-            Geom::GeomEntity* ge = 0;
-            Internal::InfoCommand::type t;
-            icmd_iter.getGeomInfoEntity(i, ge, t);
+        const std::vector<Internal::InfoCommand::GeomEntityInfo>& geom_entities_info = icmd_iter.getGeomInfoEntities();
+        for (uint i=0; i<geom_entities_info.size(); i++) {
+            Geom::GeomEntity* ge = geom_entities_info[i].m_geom_entity;
+            Internal::InfoCommand::type t = geom_entities_info[i].m_type;
 
             icmd.addGeomInfoEntity(ge, t);
         }
 
-        std::map<Topo::TopoEntity*, Internal::InfoCommand::type>&  topo_entities_info = icmd_iter.getTopoInfoEntity();
-        for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
-                iter_tei != topo_entities_info.end(); ++iter_tei){
-            Topo::TopoEntity* te = iter_tei->first;
-            Internal::InfoCommand::type t = iter_tei->second;
+        std::vector<Internal::InfoCommand::TopoEntityInfo>&  topo_entities_info = icmd_iter.getTopoInfoEntity();
+        for (uint i_tei=0; i_tei<topo_entities_info.size(); i_tei++){
+            Topo::TopoEntity* te = topo_entities_info[i_tei].m_topo_entity;
+            Internal::InfoCommand::type t = topo_entities_info[i_tei].m_type;
 
             icmd.addTopoInfoEntity(te, t);
         }
@@ -2,7 +2,9 @@
 #include "Internal/Context.h"
 #include "Internal/CommandInternal.h"
 #include "Utils/Common.h"
+#include "Utils/Profiler.h"
 #include "Group/GroupManager.h"
+#include "Topo/TopoPreviewTask.h"
 /*----------------------------------------------------------------------------*/
 #include <TkUtil/InformationLog.h>
 #include <TkUtil/TraceLog.h>
@@ -86,6 +88,9 @@ TkUtil::LogOutputStream* CommandInternal::getLogStream ( )
 /*----------------------------------------------------------------------------*/
 Utils::Command::status CommandInternal::execute()
 {
+    MGX_PROFILE_SCOPE ("execute", typeid (*this))
+    // les aperçus calculés en tâche de fond ne doivent pas lire la topologie modifiée
+    Topo::TopoPreviewTask::TopologyModification    topologyModification;
     startingOrcompletionLog (true); // log de début de commande
 
     // suppression du contenu pour le cas d'un redo par exemple
@@ -106,35 +111,46 @@ Utils::Command::status CommandInternal::execute()
     	m_warning_to_pop_up.clear();
 
     	// opérations particulières
-    	preExecute();
+    	{
+    	    MGX_PROFILE_SCOPE ("preExecute", typeid (*this))
+    	    preExecute();
+    	}
 
         // ce qui est propre à la commande
-        internalExecute();
+        {
+            MGX_PROFILE_SCOPE ("internalExecute", typeid (*this))
+            internalExecute();
+        }
 
         if (Command::CANCELED != getStatus ( )){
             // met à jour l'état de la visibilité des entités
-            if (getContext().isGraphical())
+            if (getContext().isGraphical()){
+                MGX_PROFILE_SCOPE ("updateDisplayProperties", typeid (*this))
                 getContext().getGroupManager().updateDisplayProperties(&getInfoCommand());
+            }
 
             // recherche les groupes vides, les détruits et ajoute l'info dans InfoCommand
             // et réciproquement pour les groupes détruits mais non vides
-            getContext().getGroupManager().updateDeletedGroups(&getInfoCommand());
+            {
+                MGX_PROFILE_SCOPE ("updateDeletedGroups", typeid (*this))
+                getContext().getGroupManager().updateDeletedGroups(&getInfoCommand());
+            }
 
 			// Avant de changer le status, ce qui va informer tous les
 			// observateurs, y compris la visu 3D, qui peut être tentée de faire
 			// des affichages assez long, on informe (l'utilisateur) que la
 			// commande est finie avec succès.
-			TkUtil::UTF8String	forwardAnnonce (TkUtil::Charset::UTF_8);
-			forwardAnnonce << "La commande " << getName ( )
-			               << " s'est terminée avec succès. Modification de "
-			               << "son status et actualisation de l'IHM dont la "
-			               << "visu (potentiellement un peu long) en cours.";
-			//log (TkUtil::InformationLog (forwardAnnonce));
 			// [EB] on limite l'affichage de l'info au cas où les traces pour les commandes sont activées
 			// car la fenêtre est poluée par trop de messages
-			log (TkUtil::TraceLog (forwardAnnonce, TkUtil::Log::TRACE_1));
-
-            // change le status et fait les callbacks
+			MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1,
+			           "La commande " << getName ( )
+			           << " s'est terminée avec succès. Modification de "
+			           << "son status et actualisation de l'IHM dont la "
+			           << "visu (potentiellement un peu long) en cours.");
+
+            // change le status et fait les callbacks (dont l'actualisation
+            // de la visu)
+            MGX_PROFILE_SCOPE ("notifyObservers", typeid (*this))
             setStatus (Command::DONE);
         }
         else
@@ -200,7 +216,10 @@ Utils::Command::status CommandInternal::execute()
 //  std::cout << "Erreur : " << errorString << std::endl; [EB: supprimé de catch(TkUtil::Exception)]
 
     // fait le ménage si nécessaire
-    postExecute(hasError);
+    {
+        MGX_PROFILE_SCOPE ("postExecute", typeid (*this))
+        postExecute(hasError);
+    }
 
     if (hasError){
         // retour en arrière pour les noms
@@ -218,12 +237,6 @@ Utils::Command::status CommandInternal::undo ( )
 {
     TkUtil::AutoMutex	autoMutex (getCommandMutex ( ));
 
-    TkUtil::UTF8String   message1 (TkUtil::Charset::UTF_8), message2 (TkUtil::Charset::UTF_8);
-    message1 << "Annulation de la commande " << getName ( ) << " de nom unique "
-             << getUniqueName ( );
-    message2    = message1;
-    message1 << " en cours.";
-
     if (DONE != getStatus ( ))
     {
         TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
@@ -233,13 +246,18 @@ Utils::Command::status CommandInternal::undo ( )
         throw TkUtil::Exception (message);
     }   // if (DONE != getStatus ( ))
     else
-        log (TkUtil::TraceLog(message1, TkUtil::Log::TRACE_3));
+        MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "Annulation de la commande " << getName ( ) << " de nom unique "
+                   << getUniqueName ( ) << " en cours.");
 
 
     getTimer ( ).reset ( );
 
     // ce qui est propre à la commande
-    internalUndo();
+    {
+        Topo::TopoPreviewTask::TopologyModification    topologyModification;
+        MGX_PROFILE_SCOPE ("internalUndo", typeid (*this))
+        internalUndo();
+    }
 
     // met à jour l'état de la visibilité des entités
     if (getContext().isGraphical())
@@ -248,28 +266,28 @@ Utils::Command::status CommandInternal::undo ( )
     // change le status et fait les callbacks
     setStatus (Command::INITED);
 
-    message2 << " effectué.";
-    log (TkUtil::TraceLog(message2, TkUtil::Log::TRACE_3));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "Annulation de la commande " << getName ( ) << " de nom unique "
+               << getUniqueName ( ) << " effectué.");
 
     return getStatus ( );
 }   // Command::undo
 /*----------------------------------------------------------------------------*/
 Utils::Command::status CommandInternal::redo ( )
 {
-    TkUtil::UTF8String   message1 (TkUtil::Charset::UTF_8), message2 (TkUtil::Charset::UTF_8);
-    message1 << "Rejeu de la commande " << getName ( ) << " de nom unique "
-            << getUniqueName ( );
-    message2    = message1;
-    message1 << " en cours.";
 	getTimer ( ).start ( );
 
     if (Utils::Command::INITED != getStatus ( ))
         throw TkUtil::Exception (TkUtil::UTF8String ("Command::redo impossible, status différent du status initial.", TkUtil::Charset::UTF_8));
     else
-        log (TkUtil::TraceLog(message1, TkUtil::Log::TRACE_3));
+        MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "Rejeu de la commande " << getName ( ) << " de nom unique "
+                   << getUniqueName ( ) << " en cours.");
 
     // ce qui est propre à la commande
-    internalRedo();
+    {
+        Topo::TopoPreviewTask::TopologyModification    topologyModification;
+        MGX_PROFILE_SCOPE ("internalRedo", typeid (*this))
+        internalRedo();
+    }
 
     if (Command::CANCELED != getStatus ( )){
 
@@ -281,8 +299,8 @@ Utils::Command::status CommandInternal::redo ( )
         setStatus (Command::DONE);
     }
 
-    message2 << " effectué.";
-    log (TkUtil::TraceLog(message2, TkUtil::Log::TRACE_3));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_3, "Rejeu de la commande " << getName ( ) << " de nom unique "
+               << getUniqueName ( ) << " effectué.");
 
     return getStatus ( );
 } // Command::redo
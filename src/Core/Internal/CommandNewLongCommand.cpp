@@ -24,8 +24,8 @@ namespace Mgx3D {
 namespace Internal {
 /*----------------------------------------------------------------------------*/
 CommandNewLongCommand::CommandNewLongCommand(
-										Internal::Context& c, std::string name)
-: Internal::CommandInternal (c, name)
+						Internal::Context& c, std::string name, unsigned long resources)
+: Internal::CommandInternal (c, name), m_resources (resources)
 {
 
 }
@@ -38,16 +38,13 @@ CommandNewLongCommand::~CommandNewLongCommand()
 void CommandNewLongCommand::
 internalExecute ( )
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandNewLongCommand::execute pour la commande " << getName ( )
-                            << " de nom unique " << getUniqueName ( );
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandNewLongCommand::execute pour la commande " << getName ( )
+                            << " de nom unique " << getUniqueName ( ));
 
     // exécution
 	for (uint i = 0; i<100; i++)
 	{
-		double a=0.0;
+		volatile double a=0.0;	// boucle non supprimée par l'optimiseur
 		for (int j=0; j<2*10000000; j++)
 			a+=1.0;
 //		std::cout<<"Longue Commande, "<<i<<" / 100"<<std::endl;
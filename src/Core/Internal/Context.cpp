@@ -12,6 +12,8 @@
 #include "Utils/TypeDedicatedNameManager.h"
 #include "Utils/Common.h"
 #include "Utils/CommandManager.h"
+#include "Utils/UndoRedoManager.h"
+#include "Utils/Profiler.h"
 #include "Utils/DefaultGraphicalRepresentationFactory.h"
 #include "Utils/GraphicalEntityRepresentation.h"
 #include "Utils/Property.h"
@@ -1442,6 +1444,45 @@ void Context::redo()
     getCommandManager().redo();
 }
 /*----------------------------------------------------------------------------*/
+void Context::setUndoMemoryBudget(double megabytes, bool spill,
+		const std::string& directory)
+{
+	getCommandManager().getUndoManager().setUndoMemoryBudget(
+			(size_t)(megabytes * 1024 * 1024),
+			spill ? Utils::UndoRedoManager::SPILL : Utils::UndoRedoManager::DROP,
+			directory);
+}
+/*----------------------------------------------------------------------------*/
+unsigned long Context::getUndoMemorySize()
+{
+	return getCommandManager().getUndoManager().getUndoMemorySize();
+}
+/*----------------------------------------------------------------------------*/
+void Context::setProfiling(bool enable)
+{
+	Utils::Profiler::instance().setEnabled(enable);
+}
+/*----------------------------------------------------------------------------*/
+bool Context::isProfiling() const
+{
+	return Utils::Profiler::isEnabled();
+}
+/*----------------------------------------------------------------------------*/
+void Context::resetProfiling()
+{
+	Utils::Profiler::instance().reset();
+}
+/*----------------------------------------------------------------------------*/
+void Context::saveProfilingTrace(const std::string& fileName) const
+{
+	Utils::Profiler::instance().writeChromeTrace(fileName);
+}
+/*----------------------------------------------------------------------------*/
+std::string Context::getProfilingSummary() const
+{
+	return Utils::Profiler::instance().getSummary();
+}
+/*----------------------------------------------------------------------------*/
 std::vector<std::string> Context::getSelectedEntities ( ) const
 {
    return getSelectionManager().getEntitiesNames();
@@ -17,6 +17,7 @@
 #include "Topo/TopoHelper.h"
 #include "Group/GroupManager.h"
 #include "Group/GroupEntity.h"
+#include "Utils/Common.h"
 /*----------------------------------------------------------------------------*/
 #include <TkUtil/Exception.h>
 #include <TkUtil/TraceLog.h>
@@ -66,16 +67,7 @@ void ImportMDL2Commandes::perform()
 void ImportMDL2Commandes::performGeom()
 {
 
-    for(uint i=0; i<m_mdl_info->nb_commands; ++i){
-        T_MdlCommand& current_command = m_mdl_info->commands[i];
-        switch (current_command.type){
-        // quoi qu'en dise Coverity, la suite est correcte
-        case MdlPoint:   m_vCmdPt.push_back(&current_command); break;
-        case MdlArea:    m_vCmdArea.push_back(&current_command); break;
-        case MdlLineSup: m_vCmdSup.push_back(&current_command);
-        default:         m_cor_name_mdlCmd[current_command.name.str()] = &current_command;
-        }
-    }
+    indexCommands();
 
     // boucle sur tous les points,
      // les points sont demandés donc créés
@@ -195,10 +187,8 @@ void ImportMDL2Commandes::performTopo()
             if (mcdv == 0){
                 if (mcd.type==MdlCutPreCut){
                     cor_model1d_MdlCutData[std::string(mcd.name.str())] = &mcd;
-					TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-                    message << "Dans la zone "<<current_command.name.str()<<" le contour " << mcd.name.str()
-                            <<" est en pré-Découpé, mais n'a pas de voisin ! (On continue avec un découpage uniforme)";
-                    m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+                    MGX_TRACE (m_context.getLogStream ( ), TkUtil::Log::TRACE_4, "Dans la zone "<<current_command.name.str()<<" le contour " << mcd.name.str()
+                            <<" est en pré-Découpé, mais n'a pas de voisin ! (On continue avec un découpage uniforme)");
                 }
             }
             else { // cas avec un voisin connu
@@ -229,10 +219,8 @@ void ImportMDL2Commandes::performTopo()
                         // nonConforme = true;
                     }
                     else if (ratio > 1) {
-						TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-                        message << "Dans la zone "<<current_command.name.str()<<" le contour " << mcd.name.str()
-                                <<" est détecté comme étant semi-conforme";
-                        m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+                        MGX_TRACE (m_context.getLogStream ( ), TkUtil::Log::TRACE_4, "Dans la zone "<<current_command.name.str()<<" le contour " << mcd.name.str()
+                                <<" est détecté comme étant semi-conforme");
                     }
                     // sinon c'est conforme
 
@@ -421,9 +409,7 @@ Geom::Vertex* ImportMDL2Commandes::getVertex(uint ptId)
         throw TkUtil::Exception(messErr);
     }
 
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "getVertex("<<(short)ptId << ") retourne le Vertex "<<vtx->getName()<< " : "<<*vtx;
-    m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE (m_context.getLogStream ( ), TkUtil::Log::TRACE_3, "getVertex("<<(short)ptId << ") retourne le Vertex "<<vtx->getName()<< " : "<<*vtx);
 
     return vtx;
 }
@@ -552,9 +538,7 @@ Topo::Vertex* ImportMDL2Commandes::getTopoVertex(uint ptId)
         throw TkUtil::Exception(messErr);
     }
 
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "getTopoVertex("<<(short)ptId << ") retourne le Topo::Vertex "<<vtx->getName()<< " : "<<*vtx;
-    m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (m_context.getLogStream ( ), TkUtil::Log::TRACE_4, "getTopoVertex("<<(short)ptId << ") retourne le Topo::Vertex "<<vtx->getName()<< " : "<<*vtx);
 
     return vtx;
 }
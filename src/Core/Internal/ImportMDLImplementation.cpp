@@ -17,6 +17,7 @@
 #include "Topo/TopoHelper.h"
 #include "Group/GroupManager.h"
 #include "Group/GroupEntity.h"
+#include "Utils/Common.h"
 /*----------------------------------------------------------------------------*/
 #include <TkUtil/Exception.h>
 #include <TkUtil/TraceLog.h>
@@ -87,24 +88,11 @@ void ImportMDLImplementation::performGeom(Internal::InfoCommand* icmd)
     }
 
 
-    for(uint i=0; i<m_mdl_info->nb_commands; ++i){
-        T_MdlCommand& current_command = m_mdl_info->commands[i];
-        switch (current_command.type){
-        // quoi qu'en dise Coverity, la suite est correcte
-        case MdlPoint:   m_vCmdPt.push_back(&current_command); break;
-        case MdlArea:    m_vCmdArea.push_back(&current_command); break;
-        case MdlLineSup: m_vCmdSup.push_back(&current_command);
-        default:         m_cor_name_mdlCmd[current_command.name.str()] = &current_command;
-        }
-    }
-
+    indexCommands();
 
     if (m_importAll){
-        // boucle sur tous les points,
-        // les points sont demandés donc créés
-        for (uint ptId = 0; ptId<m_vCmdPt.size(); ptId++){
-            Geom::Vertex* v = getVertex(ptId);
-        }
+        // tous les points sont demandés donc créés
+        createVertices();
     }
 
 
@@ -225,6 +213,14 @@ void ImportMDLImplementation::performGeom(Internal::InfoCommand* icmd)
     } // end for iter = m_vCmdArea.begin()
 
     //Ajout des groupes 0D
+    // les sommets créés, repérés par leurs coordonnées
+    std::map<std::pair<double, double>, std::vector<Geom::Vertex*> > cor_xy_vertices;
+    for(auto ge : m_newGeomEntities){
+        if(ge->getDim() == 0){
+            Geom::Vertex* v = dynamic_cast<Geom::Vertex*>(ge);
+            cor_xy_vertices[std::make_pair(v->getX(), v->getY())].push_back(v);
+        }
+    }
     for (uint ptId = 0; ptId<m_vCmdPt.size(); ptId++){
         T_MdlCommand& current_command = *m_vCmdPt[ptId];
 
@@ -232,28 +228,25 @@ void ImportMDLImplementation::performGeom(Internal::InfoCommand* icmd)
             double x = current_command.u.point.cd.x1;
             double y = current_command.u.point.cd.x2;
 
-            for(auto ge : m_newGeomEntities){
-                if(ge->getDim() == 0){
-                    Geom::Vertex* v = dynamic_cast<Geom::Vertex*>(ge);
-
-                    if(v->getX() == x && v->getY() == y){
-                        uint id_grp=0;
-                        std::istringstream isgroups(TkUtil::UTF8String(current_command.u.point.groups_name).trim());
-                        std::string name;
-                        while (!isgroups.eof()){
-                            isgroups>>name;
-                            if (!name.empty()){
-                                id_grp++;
-                                if (!m_prefixName.empty())
-                                    name = m_prefixName + name;
-                                Group::Group0D* group = gm.getNewGroup<Group::Group0D>(name, icmd);
-                                if (id_grp == 1)
-                                    group->setLevel(2);
-                                else
-                                    group->setLevel(3);
-                                gm.addGroupFor(v, group);
-                                group->add(v);
-                            }
+            auto iter_xy = cor_xy_vertices.find(std::make_pair(x, y));
+            if (iter_xy != cor_xy_vertices.end()){
+                for(auto v : iter_xy->second){
+                    uint id_grp=0;
+                    std::istringstream isgroups(TkUtil::UTF8String(current_command.u.point.groups_name).trim());
+                    std::string name;
+                    while (!isgroups.eof()){
+                        isgroups>>name;
+                        if (!name.empty()){
+                            id_grp++;
+                            if (!m_prefixName.empty())
+                                name = m_prefixName + name;
+                            Group::Group0D* group = gm.getNewGroup<Group::Group0D>(name, icmd);
+                            if (id_grp == 1)
+                                group->setLevel(2);
+                            else
+                                group->setLevel(3);
+                            gm.addGroupFor(v, group);
+                            group->add(v);
                         }
                     }
                 }
@@ -332,10 +325,8 @@ void ImportMDLImplementation::performTopo(Internal::InfoCommand* icmd)
             if (mcdv == 0){
                 if (mcd.type==MdlCutPreCut){
                     cor_model1d_MdlCutData[std::string(mcd.name.str())] = &mcd;
-					TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-                    message << "Dans la zone "<<current_command.name.str()<<" le contour " << mcd.name.str()
-                            <<" est en pré-Découpé, mais n'a pas de voisin ! (On continue avec un découpage uniforme)";
-                    m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+                    MGX_TRACE (m_context.getLogStream ( ), TkUtil::Log::TRACE_4, "Dans la zone "<<current_command.name.str()<<" le contour " << mcd.name.str()
+                            <<" est en pré-Découpé, mais n'a pas de voisin ! (On continue avec un découpage uniforme)");
                 }
             }
             else { // cas avec un voisin connu
@@ -366,10 +357,8 @@ void ImportMDLImplementation::performTopo(Internal::InfoCommand* icmd)
                         // nonConforme = true;
                     }
                     else if (ratio > 1) {
-						TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-                        message << "Dans la zone "<<current_command.name.str()<<" le contour " << mcd.name.str()
-                                <<" est détecté comme étant semi-conforme";
-                        m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+                        MGX_TRACE (m_context.getLogStream ( ), TkUtil::Log::TRACE_4, "Dans la zone "<<current_command.name.str()<<" le contour " << mcd.name.str()
+                                <<" est détecté comme étant semi-conforme");
                     }
                     // sinon c'est conforme
 
@@ -377,16 +366,17 @@ void ImportMDLImplementation::performTopo(Internal::InfoCommand* icmd)
 
                 if (nonConforme){
                     cor_model1d_MdlCutData[std::string(mcd.name.str())] = 0;
-					TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-                    message << "Dans la zone "<<current_command.name.str()<<" le contour " << mcd.name.str()
-                            <<" est détecté comme étant non-conforme";
-                    m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+                    MGX_TRACE (m_context.getLogStream ( ), TkUtil::Log::TRACE_4, "Dans la zone "<<current_command.name.str()<<" le contour " << mcd.name.str()
+                            <<" est détecté comme étant non-conforme");
                 }
 
             } // end cas avec un voisin connu
         } // end for j<nb_cut_data
     } // end for iter = m_vCmdArea.begin()
 
+    // création en une fois des sommets aux extrémités des contours
+    createTopoVertices();
+
     // boucle sur les zones pour la création des Edges et des CoFaces
 #ifdef _DEBUG_MDL
     std::cout<<"# deuxième boucle sur les zones, création des Edges et des CoFaces"<<std::endl;
@@ -589,9 +579,28 @@ MAJInterpolated(std::vector<Topo::CoEdge*>& coedges, Topo::CoFace* coface)
 	}
 }
 /*----------------------------------------------------------------------------*/
+void ImportMDLImplementation::createVertices()
+{
+    Group::GroupManager& gm = m_context.getGroupManager();
+    Group::Group0D* group = gm.getNewGroup<Group::Group0D>("", m_icmd);
+    Geom::EntityFactory factory(m_context);
+
+    m_newGeomEntities.reserve(m_newGeomEntities.size() + m_vCmdPt.size());
+    for (uint ptId = 0; ptId<m_vCmdPt.size(); ptId++){
+        if (m_cor_ptId_vertex[ptId])
+            continue;
+        const T_MdlCommand& command_pt = *m_vCmdPt[ptId];
+        Geom::Vertex* vtx = factory.newVertex(Utils::Math::Point(command_pt.u.point.cd.x1,command_pt.u.point.cd.x2, 0.0)*m_scale_factor);
+        m_newGeomEntities.push_back(vtx);
+        m_cor_ptId_vertex[ptId] = vtx;
+        gm.addGroupFor(vtx, group);
+        group->add(vtx);
+    }
+}
+/*----------------------------------------------------------------------------*/
 Geom::Vertex* ImportMDLImplementation::getVertex(uint ptId)
 {
-    Geom::Vertex* vtx = m_cor_ptId_vertex[ptId];
+    Geom::Vertex* vtx = m_cor_ptId_vertex.at(ptId);
     Group::GroupManager& gm = m_context.getGroupManager();
 
     if (!vtx){
@@ -610,9 +619,7 @@ Geom::Vertex* ImportMDLImplementation::getVertex(uint ptId)
         throw TkUtil::Exception(messErr);
     }
 
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "getVertex("<<(short)ptId << ") retourne le Vertex "<<vtx->getName()<< " : "<<*vtx;
-    m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
+    MGX_TRACE (m_context.getLogStream ( ), TkUtil::Log::TRACE_3, "getVertex("<<(short)ptId << ") retourne le Vertex "<<vtx->getName()<< " : "<<*vtx);
 
     return vtx;
 }
@@ -713,29 +720,26 @@ Geom::Curve* ImportMDLImplementation::getCurve(const std::string name)
                 vtx2->add(crv);
             }
             else if (current_command.type == MdlLineSup) {
-                // on recherche le support dans la liste des support, pour en déduire son indice
-                uint indSup = 0;
-                for (; indSup<m_vCmdSup.size() && std::string(m_vCmdSup[indSup]->name.str()) != name; indSup++)
-                {}
-                if (indSup == m_vCmdSup.size()){
+                // on recherche le support dans l'index des supports, pour en déduire son indice
+                std::map<std::string, uint>::const_iterator iter_sup = m_cor_name_supId.find(name);
+                if (iter_sup == m_cor_name_supId.end()){
 					TkUtil::UTF8String	messErr (TkUtil::Charset::UTF_8);
                     messErr << "Erreur Interne avec ImportMDLImplementation::getCurve, on n'arrive pas retrouver le support "
                             <<name<<" dans la liste des supports";
                     throw TkUtil::Exception(messErr);
                 }
+                const uint indSup = iter_sup->second;
                 const T_MdlCommand& command_support = *(m_vCmdSup[indSup]);
 
-                // on recherche les points qui pointent sur ce support, pour éviter de les créer une seconde fois
+                // on reprend les points qui pointent sur ce support, pour éviter de les créer une seconde fois
                 std::vector<Utils::Math::Point> vertices;
                 std::vector<bool> vertices_built;
                 vertices.resize(command_support.u.linesup.nb);
                 vertices_built.resize(command_support.u.linesup.nb,false);
-                for (uint ptId = 0; ptId<m_vCmdPt.size(); ptId++){
+                for (uint ptId : m_sup_ptIds[indSup]){
                     const T_MdlCommand& command_point = *(m_vCmdPt[ptId]);
-                    if (command_point.u.point.is_from_line && command_point.u.point.line_id == indSup){
-                        vertices[command_point.u.point.pos-1] = getVertex(ptId)->getPoint();
-                        vertices_built[command_point.u.point.pos-1] = true;
-                    }
+                    vertices[command_point.u.point.pos-1] = getVertex(ptId)->getPoint();
+                    vertices_built[command_point.u.point.pos-1] = true;
                 }
 
                 // remplissage du reste du vecteur avec de nouveaux sommets
@@ -806,7 +810,7 @@ Geom::Curve* ImportMDLImplementation::getCurve(const std::string name)
 /*----------------------------------------------------------------------------*/
 Topo::Vertex* ImportMDLImplementation::getTopoVertex(uint ptId)
 {
-    Topo::Vertex* vtx = m_cor_ptId_topoVertex[ptId];
+    Topo::Vertex* vtx = m_cor_ptId_topoVertex.at(ptId);
 
     if (!vtx){
         Geom::Vertex* gtx = getVertex(ptId);
@@ -817,13 +821,42 @@ Topo::Vertex* ImportMDLImplementation::getTopoVertex(uint ptId)
         vtx->setGeomAssociation(gtx);
     }
 
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "getTopoVertex("<<(short)ptId << ") retourne le Topo::Vertex "<<vtx->getName()<< " : "<<*vtx;
-    m_context.getLogDispatcher().log(TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (m_context.getLogStream ( ), TkUtil::Log::TRACE_4, "getTopoVertex("<<(short)ptId << ") retourne le Topo::Vertex "<<vtx->getName()<< " : "<<*vtx);
 
     return vtx;
 }
 /*----------------------------------------------------------------------------*/
+void ImportMDLImplementation::createTopoVertices()
+{
+    // les sommets sont créés dans l'ordre où les zones les référencent
+    std::vector<uint> ptIds;
+    std::vector<bool> isUsed(m_vCmdPt.size(), false);
+    for (std::vector<const T_MdlCommand*>::const_iterator iter = m_vCmdArea.begin(); iter!=m_vCmdArea.end(); ++iter){
+        const T_MdlCommand& current_command = **iter;
+        for( uint j=0; j<current_command.u.area.nb_cut_data; j++ ){
+            std::map<std::string, T_MdlCommand*>::const_iterator iter_cmd =
+                    m_cor_name_mdlCmd.find(current_command.u.area.data[j].name.str());
+            if (iter_cmd == m_cor_name_mdlCmd.end() || iter_cmd->second == 0)
+                continue;
+            const uint pts[2] = {(uint)iter_cmd->second->model1d.pt1, (uint)iter_cmd->second->model1d.pt2};
+            for (uint ptId : pts)
+                if (ptId < isUsed.size() && !isUsed[ptId] && !m_cor_ptId_topoVertex[ptId]){
+                    isUsed[ptId] = true;
+                    ptIds.push_back(ptId);
+                }
+        }
+    }
+
+    m_newTopoEntities.reserve(m_newTopoEntities.size() + ptIds.size());
+    for (uint ptId : ptIds){
+        Geom::Vertex* gtx = getVertex(ptId);
+        Topo::Vertex* vtx = new Topo::Vertex(m_context, gtx->getCoord());
+        m_newTopoEntities.push_back(vtx);
+        m_cor_ptId_topoVertex[ptId] = vtx;
+        vtx->setGeomAssociation(gtx);
+    }
+}
+/*----------------------------------------------------------------------------*/
 Topo::CoEdge* ImportMDLImplementation::
 getCoEdge(T_MdlCutData *mcd, bool isConforme)
 {
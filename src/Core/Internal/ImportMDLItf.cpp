@@ -82,6 +82,32 @@ void ImportMDLItf::readMDL()
 
 }
 /*----------------------------------------------------------------------------*/
+void ImportMDLItf::indexCommands()
+{
+    for(uint i=0; i<m_mdl_info->nb_commands; ++i){
+        T_MdlCommand& current_command = m_mdl_info->commands[i];
+        switch (current_command.type){
+        // quoi qu'en dise Coverity, la suite est correcte
+        case MdlPoint:   m_vCmdPt.push_back(&current_command); break;
+        case MdlArea:    m_vCmdArea.push_back(&current_command); break;
+        case MdlLineSup: m_cor_name_supId[current_command.name.str()] = m_vCmdSup.size();
+                         m_vCmdSup.push_back(&current_command);
+        default:         m_cor_name_mdlCmd[current_command.name.str()] = &current_command;
+        }
+    }
+
+    // les points posés sur un support, rangés par support
+    m_sup_ptIds.resize(m_vCmdSup.size());
+    for (uint ptId = 0; ptId<m_vCmdPt.size(); ptId++){
+        const T_MdlCommand& command_point = *(m_vCmdPt[ptId]);
+        if (command_point.u.point.is_from_line && (size_t)command_point.u.point.line_id < m_vCmdSup.size())
+            m_sup_ptIds[command_point.u.point.line_id].push_back(ptId);
+    }
+
+    m_cor_ptId_vertex.assign(m_vCmdPt.size(), 0);
+    m_cor_ptId_topoVertex.assign(m_vCmdPt.size(), 0);
+}
+/*----------------------------------------------------------------------------*/
 Utils::Unit::lengthUnit ImportMDLItf::getLengthUnit()
 {
 	readMDL();
@@ -9,6 +9,8 @@
 #include "Geom/Volume.h"
 #include "Topo/TopoEntity.h"
 #include "Topo/CoEdge.h"
+#include "Topo/TopoManager.h"
+#include "Topo/ChordIndex.h"
 #include "Mesh/MeshEntity.h"
 #include "Group/GroupEntity.h"
 #include "SysCoord/SysCoord.h"
@@ -17,9 +19,30 @@
 #include <TkUtil/Exception.h>
 #include <TkUtil/MemoryError.h>
 /*----------------------------------------------------------------------------*/
+#include <algorithm>
+#include <thread>
+#include <unordered_set>
+/*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
 namespace Internal {
+/*----------------------------------------------------------------------------*/
+/* Estampille d'une entité topologique (cf TopoEntity::getInfoCommandStamp) :
+ * l'estampille de l'InfoCommand décalée de 9 bits, un bit à 1 lorsque l'entité
+ * est reportée dans m_topo_entities_info (le type y est alors stocké) et,
+ * dans le cas contraire, le type de modification sur les 8 bits de poids faible.
+ */
+static const unsigned long long STAMP_MERGED = 1ull<<8;
+static const unsigned long long STAMP_TYPE_MASK = STAMP_MERGED-1;
+
+static inline unsigned long long stampSerial(unsigned long long stamp)
+{
+    return stamp>>9;
+}
+static inline unsigned long long makeStamp(unsigned long long serial, bool merged, InfoCommand::type t)
+{
+    return (serial<<9) | (merged ? STAMP_MERGED : 0) | (unsigned long long)t;
+}
 
 /*----------------------------------------------------------------------------*/
 std::string InfoCommand::type2String(const InfoCommand::type &t)
@@ -42,7 +65,8 @@ std::string InfoCommand::type2String(const InfoCommand::type &t)
 }
 /*----------------------------------------------------------------------------*/
 InfoCommand::InfoCommand()
-	: m_context_type (InfoCommand::UNITIALIZED), m_mutex ( )
+	: m_context_type (InfoCommand::UNITIALIZED), m_mutex ( ),
+	  m_serial (newSerial ( )), m_topo_buffers ( ), m_topo_buffers_used (false)
 {
 #ifdef _DEBUG2
     std::cout<<"InfoCommand::InfoCommand()"<<std::endl;
@@ -55,11 +79,11 @@ InfoCommand::~InfoCommand()
 #ifdef _DEBUG_MEMORY
     if (!m_topo_entities_info.empty()){
         std::cout<<"InfoCommand::~InfoCommand() libère les TopoEntity :"<<std::endl;
-        for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = m_topo_entities_info.begin();
+        for (std::vector<TopoEntityInfo>::iterator iter_tei = m_topo_entities_info.begin();
                 iter_tei != m_topo_entities_info.end(); ++iter_tei){
-            Topo::TopoEntity* te = iter_tei->first;
+            Topo::TopoEntity* te = iter_tei->m_topo_entity;
             std::cout<<te->getName()<<", unique id "<<te->getUniqueId()
-                    <<" , type "<<type2String(iter_tei->second)
+                    <<" , type "<<type2String(iter_tei->m_type)
                     <<std::endl;
         }
     }
@@ -69,7 +93,8 @@ InfoCommand::~InfoCommand()
 }
 /*----------------------------------------------------------------------------*/
 InfoCommand::InfoCommand(const InfoCommand&)
-	: m_context_type (InfoCommand::UNITIALIZED), m_mutex ( )
+	: m_context_type (InfoCommand::UNITIALIZED), m_mutex ( ),
+	  m_serial (0), m_topo_buffers ( ), m_topo_buffers_used (false)
 {
     MGX_FORBIDDEN("InfoCommand::InfoCommand is not allowed.");
 }
@@ -108,8 +133,11 @@ void InfoCommand::addGeomInfoEntity(Geom::GeomEntity* entity, type t)
 #endif
     GeomEntityInfo gei = {entity,t};
     // CP Issue#103 workaround : ensure unicity
-    if (m_geom_entities_info.end ( ) != std::find (m_geom_entities_info.begin ( ), m_geom_entities_info.end ( ), gei))
+    // (types déjà vus pour l'entité, sans recherche dans m_geom_entities_info)
+    uint& types = m_geom_entities_types[entity];
+    if (types & (1u<<t))
 	return;
+    types |= (1u<<t);
 
     m_geom_entities_info.push_back(gei);
 }
@@ -136,32 +164,179 @@ void InfoCommand::addStructuredMeshInfoEntity(Structured::StructuredMeshEntity*
     m_structured_mesh_entities_info.push_back(smei);
 }
 /*----------------------------------------------------------------------------*/
+unsigned long long InfoCommand::newSerial()
+{
+    static std::atomic<unsigned long long> serial(0);
+    return ++serial;
+}
+/*----------------------------------------------------------------------------*/
+InfoCommand::TopoBuffer& InfoCommand::getThreadTopoBuffer()
+{
+    // dernier tampon utilisé par le thread, les estampilles n'étant jamais
+    // réutilisées il ne peut s'agir du tampon d'une InfoCommand détruite
+    static thread_local unsigned long long cache_serial = 0;
+    static thread_local TopoBuffer* cache_buffer = 0;
+
+    if (cache_serial != m_serial){
+        TkUtil::AutoMutex	autoMutex (&m_mutex);
+        std::thread::id id = std::this_thread::get_id();
+        std::list<TopoBuffer>::iterator iter = m_topo_buffers.begin();
+        while (iter != m_topo_buffers.end() && iter->m_thread_id != id)
+            ++iter;
+        if (iter == m_topo_buffers.end()){
+            m_topo_buffers.emplace_back();
+            iter = --m_topo_buffers.end();
+            iter->m_thread_id = id;
+        }
+        cache_buffer = &*iter;
+        cache_serial = m_serial;
+    }
+    return *cache_buffer;
+}
+/*----------------------------------------------------------------------------*/
 bool InfoCommand::addTopoInfoEntity(Topo::TopoEntity* entity, type t)
 {
-	TkUtil::AutoMutex	autoMutex (&m_mutex);
-    type old_t = m_topo_entities_info[entity];
+    // les cordes dépendent de la connectivité et de la discrétisation : toute
+    // modification invalide l'index, même si l'entité est déjà recensée (l'index
+    // a pu être reconstruit depuis au cours de la commande)
+    if (t != VISIBILYCHANGED && t >= OTHERMODIFIED)
+    	entity->getContext().getTopoManager().getChordIndex().topologyModified();
+
+    std::atomic<unsigned long long>& stamp = entity->getInfoCommandStamp();
+    unsigned long long old_stamp = stamp.load();
+    type old_t = UNITIALIZED;
+    type new_t = UNITIALIZED;
+    bool isNew = false;
+
+    while (true){
+        if (stampSerial(old_stamp) == m_serial && (old_stamp & STAMP_MERGED)){
+            // entité déjà reportée dans la liste, le type y est stocké
+            TkUtil::AutoMutex	autoMutex (&m_mutex);
+            type& merged_t = m_topo_entities_info[entity->getInfoCommandIndex()].m_type;
+            old_t = merged_t;
+            if (old_t >= t)
+                return false;
+            // on ne doit rien faire (pas d'affichage) d'une entité temporaire (le temps de faire la commande)
+            new_t = (old_t == CREATED && t == DELETED ? NONE : t);
+            merged_t = new_t;
+            break;
+        }
+
+        isNew = (stampSerial(old_stamp) != m_serial);
+        old_t = (isNew ? UNITIALIZED : (type)(old_stamp & STAMP_TYPE_MASK));
+        // les types de modifs sont ordonnées volontairement
+        if (old_t >= t)
+            return false;
+        new_t = (old_t == CREATED && t == DELETED ? NONE : t);
+        if (stamp.compare_exchange_weak(old_stamp, makeStamp(m_serial, false, new_t)))
+            break;
+    } // end while
+
 #ifdef _DEBUG2
     std::cout <<"InfoCommand::addTopoInfoEntity("<<entity->getName()
-            <<" t = "<<type2String(old_t)<<" => "<<type2String(t)<<")"<<std::endl;
+            <<" t = "<<type2String(old_t)<<" => "<<type2String(new_t)<<")"<<std::endl;
 #endif
-    // les types de modifs sont ordonnées volontairement
-    if (old_t < t){
-        // on ne doit rien faire (pas d'affichage) d'une entité temporaire (le temps de faire la commande)
-        if (old_t == CREATED && t == DELETED)
-            m_topo_entities_info[entity] = NONE;
-        else
-            m_topo_entities_info[entity] = t;
-
-        if (entity->getType() == Utils::Entity::TopoCoEdge && t == DISPMODIFIED){
-        	Topo::CoEdge* coedge = dynamic_cast<Topo::CoEdge*>(entity);
-        	CHECK_NULL_PTR_ERROR(coedge);
-        	coedge->getMeshingProperty()->updateModificationTime();
+
+    if (isNew){
+        TopoBuffer& buffer = getThreadTopoBuffer();
+        std::lock_guard<std::mutex> lock(buffer.m_mutex);
+        m_topo_buffers_used = true;
+        buffer.m_entities.push_back(entity);
+    }
+
+    if (entity->getType() == Utils::Entity::TopoCoEdge && t == DISPMODIFIED){
+    	Topo::CoEdge* coedge = dynamic_cast<Topo::CoEdge*>(entity);
+    	CHECK_NULL_PTR_ERROR(coedge);
+    	coedge->getMeshingProperty()->updateModificationTime();
+    }
+
+    return true;
+}
+/*----------------------------------------------------------------------------*/
+void InfoCommand::mergeTopoBuffers()
+{
+    if (!m_topo_buffers_used)
+        return;
+    m_topo_buffers_used = false;
+
+    for (std::list<TopoBuffer>::iterator iter = m_topo_buffers.begin();
+            iter != m_topo_buffers.end(); ++iter){
+        std::lock_guard<std::mutex> lock(iter->m_mutex);
+        for (Topo::TopoEntity* te : iter->m_entities){
+            std::atomic<unsigned long long>& stamp = te->getInfoCommandStamp();
+            unsigned long long old_stamp = stamp.load();
+            // le type est transféré de l'entité vers la liste, sauf si l'entité
+            // a été estampillée depuis par une autre InfoCommand (commandes
+            // concurrentes modifiant la même entité, ce qu'exclut le CommandManager)
+            bool merged = false;
+            while (!merged && stampSerial(old_stamp) == m_serial && !(old_stamp & STAMP_MERGED)){
+                te->getInfoCommandIndex() = m_topo_entities_info.size();
+                merged = stamp.compare_exchange_weak(old_stamp, makeStamp(m_serial, true, UNITIALIZED));
+            }
+            if (merged){
+                TopoEntityInfo tei = {te, (type)(old_stamp & STAMP_TYPE_MASK)};
+                m_topo_entities_info.push_back(tei);
+            }
         }
+        iter->m_entities.clear();
+    }
+}
+/*----------------------------------------------------------------------------*/
+std::vector<InfoCommand::TopoEntityInfo>& InfoCommand::getTopoInfoEntity()
+{
+	TkUtil::AutoMutex	autoMutex (&m_mutex);
+	mergeTopoBuffers();
+	return m_topo_entities_info;
+}
+/*----------------------------------------------------------------------------*/
+const std::vector<InfoCommand::TopoEntityInfo>& InfoCommand::getTopoInfoEntity() const
+{
+	return const_cast<InfoCommand*>(this)->getTopoInfoEntity();
+}
+/*----------------------------------------------------------------------------*/
+InfoCommand::type InfoCommand::getTopoInfoEntityType(Topo::TopoEntity* entity)
+{
+    unsigned long long stamp = entity->getInfoCommandStamp().load();
+    if (stampSerial(stamp) == m_serial){
+        if (!(stamp & STAMP_MERGED))
+            return (type)(stamp & STAMP_TYPE_MASK);
+        TkUtil::AutoMutex	autoMutex (&m_mutex);
+        return m_topo_entities_info[entity->getInfoCommandIndex()].m_type;
+    }
 
-        return true;
+    // les estampilles étant croissantes, une entité estampillée par une
+    // InfoCommand plus ancienne n'est pas concernée
+    if (stampSerial(stamp) < m_serial)
+        return UNITIALIZED;
+
+    // entité estampillée depuis par une InfoCommand plus récente (cas d'une
+    // commande ancienne), recherche dans la liste
+    TkUtil::AutoMutex	autoMutex (&m_mutex);
+    mergeTopoBuffers();
+    for (std::vector<TopoEntityInfo>::iterator iter = m_topo_entities_info.begin();
+            iter != m_topo_entities_info.end(); ++iter)
+        if (iter->m_topo_entity == entity)
+            return iter->m_type;
+    return UNITIALIZED;
+}
+/*----------------------------------------------------------------------------*/
+void InfoCommand::removeTopoInfoEntities(const std::vector<Topo::TopoEntity*>& entities)
+{
+    TkUtil::AutoMutex	autoMutex (&m_mutex);
+    mergeTopoBuffers();
+
+    std::unordered_set<Topo::TopoEntity*> filtre(entities.begin(), entities.end());
+    uint nb = 0;
+    for (uint i=0; i<m_topo_entities_info.size(); i++){
+        Topo::TopoEntity* te = m_topo_entities_info[i].m_topo_entity;
+        if (filtre.find(te) != filtre.end())
+            continue;
+        // l'indice porté par l'entité n'est valide que pour cette InfoCommand
+        if (stampSerial(te->getInfoCommandStamp().load()) == m_serial)
+            te->getInfoCommandIndex() = nb;
+        m_topo_entities_info[nb++] = m_topo_entities_info[i];
     }
-    else
-        return false;
+    m_topo_entities_info.resize(nb);
 }
 /*----------------------------------------------------------------------------*/
 bool InfoCommand::addMeshInfoEntity(Mesh::MeshEntity* entity, type t)
@@ -180,21 +355,14 @@ bool InfoCommand::addMeshInfoEntity(Mesh::MeshEntity* entity, type t)
     // ce qui arrive avec les sous-volumes d'un même matériau
     if (t == DISPMODIFIED){
         // recherche si l'entité y est déjà
-        std::vector <MeshEntityInfo>::iterator iter_found;
-        bool found = false;
-        for (std::vector <MeshEntityInfo>::iterator iter = m_mesh_entities_info.begin();
-                iter != m_mesh_entities_info.end() && !found;
-                ++iter)
-            if (entity == iter->m_mesh_entity){
-                found = true;
-                iter_found = iter;
-            }
-        if (found){
+        std::unordered_map<Mesh::MeshEntity*, uint>::iterator iter_found = m_mesh_entities_index.find(entity);
+        if (iter_found != m_mesh_entities_index.end()){
+            MeshEntityInfo& mei = m_mesh_entities_info[iter_found->second];
 #ifdef _DEBUG2
-            std::cout<<" déjà présente et de type "<<type2String(iter_found->m_type)<<std::endl;
+            std::cout<<" déjà présente et de type "<<type2String(mei.m_type)<<std::endl;
 #endif
-            if (t > iter_found->m_type){
-            	iter_found->m_type = t;
+            if (t > mei.m_type){
+            	mei.m_type = t;
             	return true;
             }
             else
@@ -203,6 +371,7 @@ bool InfoCommand::addMeshInfoEntity(Mesh::MeshEntity* entity, type t)
     }
 
     MeshEntityInfo mei = {me,t};
+    m_mesh_entities_index.insert(std::make_pair(me, (uint)m_mesh_entities_info.size()));
     m_mesh_entities_info.push_back(mei);
 
 #ifdef _DEBUG2
@@ -255,18 +424,10 @@ void InfoCommand::getSysCoordInfoEntity(uint ind, CoordinateSystem::SysCoord* &e
 std::vector<InfoCommand::TopoEntityInfo> InfoCommand::getSortedTopoInfoEntity()
 {
 	TkUtil::AutoMutex	autoMutex (&m_mutex);
-	std::list<TopoEntityInfo> l_tie;
+	mergeTopoBuffers();
 
-	for (std::map<Topo::TopoEntity*, InfoCommand::type>::iterator iter_tei = m_topo_entities_info.begin();
-			iter_tei != m_topo_entities_info.end(); ++iter_tei){
-		TopoEntityInfo tei = {iter_tei->first, iter_tei->second};
-		l_tie.push_back(tei);
-	}
-
-	l_tie.sort(InfoCommand::compareTopoEntityInfo);
-
-	std::vector<TopoEntityInfo> res;
-	res.insert(res.end(), l_tie.begin(), l_tie.end());
+	std::vector<TopoEntityInfo> res(m_topo_entities_info);
+	std::sort(res.begin(), res.end(), InfoCommand::compareTopoEntityInfo);
 	return res;
 }
 /*----------------------------------------------------------------------------*/
@@ -316,10 +477,20 @@ void InfoCommand::permCreatedDeleted()
         }
     } // end for ( ... iter ...)
 
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = m_topo_entities_info.begin();
+    // même permutation pour les types déjà vus
+    for (std::unordered_map<Geom::GeomEntity*, uint>::iterator iter = m_geom_entities_types.begin();
+            iter != m_geom_entities_types.end(); ++iter){
+        uint created = (iter->second>>CREATED) & 1u;
+        uint deleted = (iter->second>>DELETED) & 1u;
+        iter->second &= ~((1u<<CREATED) | (1u<<DELETED));
+        iter->second |= (created<<DELETED) | (deleted<<CREATED);
+    }
+
+    mergeTopoBuffers();
+    for (std::vector<TopoEntityInfo>::iterator iter_tei = m_topo_entities_info.begin();
             iter_tei != m_topo_entities_info.end(); ++iter_tei){
-        Topo::TopoEntity* te = iter_tei->first;
-        Internal::InfoCommand::type& t = iter_tei->second;
+        Topo::TopoEntity* te = iter_tei->m_topo_entity;
+        Internal::InfoCommand::type& t = iter_tei->m_type;
 #ifdef _DEBUG2
         std::cout <<"InfoCommand::permCreatedDeleted pour Topo "<<te->getName()
                   <<" avec t = "<<type2String(t)<<std::endl;
@@ -468,8 +639,14 @@ void InfoCommand::clear()
 	//std::cout<<"InfoCommand::clear()..."<<std::endl;
 	TkUtil::AutoMutex	autoMutex (&m_mutex);
     m_geom_entities_info.clear();
+    m_geom_entities_types.clear();
+    // nouvelle estampille, ce qui rend caduques celles des entités et les tampons des threads
+    m_serial = newSerial();
+    m_topo_buffers.clear();
+    m_topo_buffers_used = false;
     m_topo_entities_info.clear();
     m_mesh_entities_info.clear();
+    m_mesh_entities_index.clear();
     m_group_entities_info.clear();
     m_sys_coord_entities_info.clear();
 }
@@ -487,13 +664,13 @@ TkUtil::UTF8String & operator << (TkUtil::UTF8String & o, const InfoCommand & ic
           <<"\n";
 
     o<< "InfoCommand TopoEntities: "<<"\n";
-    const std::map<Topo::TopoEntity*, InfoCommand::type> topoIE = ic.getTopoInfoEntity();
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::const_iterator iter = topoIE.begin();
+    const std::vector<InfoCommand::TopoEntityInfo>& topoIE = ic.getTopoInfoEntity();
+    for (std::vector<InfoCommand::TopoEntityInfo>::const_iterator iter = topoIE.begin();
             iter != topoIE.end(); ++iter)
-        o << "  "<<iter->first->getName()<<" : "
-          <<InfoCommand::type2String(iter->second)
-          <<" (uid "<<(long)iter->first->getUniqueId()<<")"
-          <<(iter->first->isDestroyed()?" [marquée à DETRUITE]":"")
+        o << "  "<<iter->m_topo_entity->getName()<<" : "
+          <<InfoCommand::type2String(iter->m_type)
+          <<" (uid "<<(long)iter->m_topo_entity->getUniqueId()<<")"
+          <<(iter->m_topo_entity->isDestroyed()?" [marquée à DETRUITE]":"")
           <<"\n";
 
     o<< "InfoCommand MeshEntities: "<<"\n";
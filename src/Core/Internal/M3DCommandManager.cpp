@@ -8,6 +8,7 @@
  */
 /*----------------------------------------------------------------------------*/
 #include "Internal/Context.h"
+#include "Utils/Common.h"
 #include "Internal/M3DCommandManager.h"
 #include "Internal/M3DCommandResult.h"
 #include "Internal/CommandNewLongCommand.h"
@@ -26,17 +27,18 @@ M3DCommandManager::M3DCommandManager(const std::string& name, Internal::Context*
 {
 }
 /*----------------------------------------------------------------------------*/
-M3DCommandResult* M3DCommandManager::newLongCommand()
+M3DCommandResult* M3DCommandManager::newLongCommand(unsigned long resources)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "M3DCommandManager::newLongCommand ()";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "M3DCommandManager::newLongCommand (" << resources << ")");
 
-    CommandNewLongCommand *command = new CommandNewLongCommand(getContext(), "Création d'une longue commande");
+    CommandNewLongCommand *command = new CommandNewLongCommand(getContext(), "Création d'une longue commande", resources);
 
     // trace dans le script
     TkUtil::UTF8String cmd (TkUtil::Charset::UTF_8);
-    cmd << getContextAlias() << "." << "getM3DCommandManager(). newLongCommand()";
+    cmd << getContextAlias() << "." << "getM3DCommandManager(). newLongCommand(";
+    if (Utils::Command::ALL_RESOURCES != resources)
+        cmd << resources;
+    cmd << ")";
     command->setScriptCommand(cmd);
 
     getCommandManager().addCommand(command, Utils::Command::DO);
@@ -47,9 +49,7 @@ M3DCommandResult* M3DCommandManager::newLongCommand()
 /*----------------------------------------------------------------------------*/
 M3DCommandResult* M3DCommandManager::newOpenCascadeLongCommand()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "M3DCommandManager::openCascadeLongCommand ()";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "M3DCommandManager::openCascadeLongCommand ()");
 
     OpenCascadeLongCommand *command = new OpenCascadeLongCommand(getContext(), "Création d'une longue commande Open Cascade");
 
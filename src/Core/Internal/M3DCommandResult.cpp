@@ -375,12 +375,11 @@ std::vector<Topo::Block*> M3DCommandResult::getBlocksObj ( )
 
 	InfoCommand& ifc = getInfoCommand();
 
-	std::map<Topo::TopoEntity*, InfoCommand::type> tei = ifc.getTopoInfoEntity();
+	std::vector<InfoCommand::TopoEntityInfo> tei = ifc.getTopoInfoEntity();
 
-	for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::const_iterator iter = tei.begin();
-			iter != tei.end(); ++iter) {
-		if (iter->first->getDim() == 3 && iter->second == InfoCommand::CREATED){
-			Topo::Block* ob = dynamic_cast<Topo::Block*>(iter->first);
+	for (uint i_tei=0; i_tei<tei.size(); i_tei++) {
+		if (tei[i_tei].m_topo_entity->getDim() == 3 && tei[i_tei].m_type == InfoCommand::CREATED){
+			Topo::Block* ob = dynamic_cast<Topo::Block*>(tei[i_tei].m_topo_entity);
 			if (0 == ob)
 				throw TkUtil::Exception(TkUtil::UTF8String ("Erreur interne, echec pour dynamic_cast dans getTopoBlocks", TkUtil::Charset::UTF_8));
 			l_te.push_back(ob);
@@ -440,12 +439,11 @@ std::vector<Topo::CoFace*> M3DCommandResult::getFacesObj ( )
 	//std::cout<<"M3DCommandResult::getFaces () avec getInfoCommand() :"<<std::endl;
 	//std::cout<<ifc<<std::endl;
 
-	std::map<Topo::TopoEntity*, InfoCommand::type> tei = ifc.getTopoInfoEntity();
+	std::vector<InfoCommand::TopoEntityInfo> tei = ifc.getTopoInfoEntity();
 
-	for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::const_iterator iter = tei.begin();
-			iter != tei.end(); ++iter) {
-		if (iter->first->getDim() == 2 && iter->second == InfoCommand::CREATED){
-			Topo::CoFace* ob = dynamic_cast<Topo::CoFace*>(iter->first);
+	for (uint i_tei=0; i_tei<tei.size(); i_tei++) {
+		if (tei[i_tei].m_topo_entity->getDim() == 2 && tei[i_tei].m_type == InfoCommand::CREATED){
+			Topo::CoFace* ob = dynamic_cast<Topo::CoFace*>(tei[i_tei].m_topo_entity);
 			// on passe les Faces et on ne retourne que les CoFaces
 			if (0 != ob)
 				l_te.push_back(ob);
@@ -502,12 +500,11 @@ std::vector<Topo::CoEdge*> M3DCommandResult::getEdgesObj ( )
 
 	InfoCommand& ifc = getInfoCommand();
 
-	std::map<Topo::TopoEntity*, InfoCommand::type> tei = ifc.getTopoInfoEntity();
+	std::vector<InfoCommand::TopoEntityInfo> tei = ifc.getTopoInfoEntity();
 
-	for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::const_iterator iter = tei.begin();
-			iter != tei.end(); ++iter) {
-		if (iter->first->getDim() == 1 && iter->second == InfoCommand::CREATED){
-			Topo::CoEdge* ob = dynamic_cast<Topo::CoEdge*>(iter->first);
+	for (uint i_tei=0; i_tei<tei.size(); i_tei++) {
+		if (tei[i_tei].m_topo_entity->getDim() == 1 && tei[i_tei].m_type == InfoCommand::CREATED){
+			Topo::CoEdge* ob = dynamic_cast<Topo::CoEdge*>(tei[i_tei].m_topo_entity);
 			// on passe les Edges et on ne retourne que les CoEdges
 			if (0 != ob)
 				l_te.push_back(ob);
@@ -564,12 +561,11 @@ std::vector<Topo::Vertex*> M3DCommandResult::getTopoVerticesObj ( )
 
 	InfoCommand& ifc = getInfoCommand();
 
-	std::map<Topo::TopoEntity*, InfoCommand::type> tei = ifc.getTopoInfoEntity();
+	std::vector<InfoCommand::TopoEntityInfo> tei = ifc.getTopoInfoEntity();
 
-	for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::const_iterator iter = tei.begin();
-			iter != tei.end(); ++iter) {
-		if (iter->first->getDim() == 0 && iter->second == InfoCommand::CREATED){
-			Topo::Vertex* ob = dynamic_cast<Topo::Vertex*>(iter->first);
+	for (uint i_tei=0; i_tei<tei.size(); i_tei++) {
+		if (tei[i_tei].m_topo_entity->getDim() == 0 && tei[i_tei].m_type == InfoCommand::CREATED){
+			Topo::Vertex* ob = dynamic_cast<Topo::Vertex*>(tei[i_tei].m_topo_entity);
 			if (0 == ob)
 				throw TkUtil::Exception(TkUtil::UTF8String ("Erreur interne, echec pour dynamic_cast dans getTopoVerticesObj", TkUtil::Charset::UTF_8));
 			l_te.push_back(ob);
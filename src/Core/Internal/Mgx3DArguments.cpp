@@ -58,6 +58,8 @@ vector<string> mgx3dAllowedArgs ( )
 	// Arguments Magix3D batch :
 	args.push_back ("-coordTranslate");
 	args.push_back ("--coordTranslate");
+	args.push_back ("-profile");
+	args.push_back ("--profile");
 
 	return args;
 }	// mgx3dAllowedArgs
@@ -37,11 +37,8 @@ OpenCascadeLongCommand::~OpenCascadeLongCommand ( )
 void OpenCascadeLongCommand::
 internalExecute ( )
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-	message << "OpenCascadeLongCommand::execute pour la commande "
-	        << getName ( ) << " de nom unique " << getUniqueName ( );
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "OpenCascadeLongCommand::execute pour la commande "
+	        << getName ( ) << " de nom unique " << getUniqueName ( ));
 
 	uint	i = 0;
 	while (true)
@@ -82,6 +82,7 @@ _logDate ("date", false, UTF8String ("Faut-il faire figurer la date dans les tra
 _logTime ("time", false, UTF8String ("Faut-il faire figurer l'heure dans les traces (true/false) ?", Charset::UTF_8)),
 _logThreadID ("threadID", false, UTF8String ("Faut-il faire figurer l'identifiant du thread dans les traces (true/false) ?", Charset::UTF_8)),
 _useDisplayList ("useDisplayList", true, UTF8String ("True si les display lists Open GL sont utilisées, false dans le cas contraire.", Charset::UTF_8)),
+_batchedWireRepresentations ("batchedWireRepresentations", false, UTF8String ("True si les représentations filaires des entités géométriques et topologiques non sélectionnées sont regroupées par type d'entité dans un unique acteur VTK (affichage plus rapide de nombreuses entités), false si chaque entité a ses propres acteurs.", Charset::UTF_8)),
 _xyzCancelRoll ("xyzCancelRoll", false, UTF8String ("Une opération de positionnement de la vue dans un plan xOy, xOz, yOz (touches z, y ou x) doit elle être suivie d'une annulation du roulis (true) ou non (false) ?", Charset::UTF_8)),
 _updateRefreshRate ("updateRefreshRate", 1000, UTF8String ("Fréquence de rafraîchissement de la fenêtre graphique lors d'opérations ajouts/suppressions/modifications d'entités (1 rafraîchissement sur n opérations).", Charset::UTF_8)),
 _stillFrameRate ("stillFrameRate", 0.0001, UTF8String ("Nombre d'images/seconde souhaité hors interactions.", Charset::UTF_8)),	// Défaut VTK 5.10
@@ -178,6 +179,7 @@ _logDate ("date", false, "Faut-il faire figurer la date dans les traces (true/fa
 _logTime ("time", false, "Faut-il faire figurer l'heure dans les traces (true/false) ?"),
 _logThreadID ("threadID", false, "Faut-il faire figurer l'identifiant du thread dans les traces (true/false) ?"),
 _useDisplayList ("useDisplayList", true, "True si les display lists Open GL sont utilisées, false dans le cas contraire."),
+_batchedWireRepresentations ("batchedWireRepresentations", false, "True si les représentations filaires des entités géométriques et topologiques non sélectionnées sont regroupées par type d'entité dans un unique acteur VTK (affichage plus rapide de nombreuses entités), false si chaque entité a ses propres acteurs."),
 _xyzCancelRoll ("xyzCancelRoll", false, "Une opération de positionnement de la vue dans un plan xOy, xOz, yOz (touches z, y ou x) doit elle être suivie d'une annulation du roulis (true) ou non (false) ?"),
 _updateRefreshRate ("updateRefreshRate", 100, "Fréquence de rafraîchissement de la fenêtre graphique lors d'opérations ajouts/suppressions/modifications d'entités (1 rafraîchissement sur n opérations)."),
 _stillFrameRate ("stillFrameRate", 0.0001, "Nombre d'images/seconde souhaité hors interactions."),	// Défaut VTK 5.10
@@ -150,8 +150,147 @@ const SelectionManager::DIM	SelectionManager::NOT_D2		=
 const SelectionManager::DIM	SelectionManager::NOT_D3		=
 					(SelectionManager::DIM)~SelectionManager::D3;
 
+// Au delà de ce nombre d'entités les messages de sélection n'en donnent que le nombre :
+static const size_t	maxLoggedEntities	= 20;
+
+static UTF8String entitiesMessage (const string& prefix, const vector<Utils::Entity*>& entities)
+{
+	UTF8String	message (Charset::UTF_8);
+	message << prefix;
+	if (entities.size ( ) > maxLoggedEntities)
+	{
+		message << entities.size ( ) << " entités";
+		return message;
+	}	// if (entities.size ( ) > maxLoggedEntities)
+
+	message << (1 == entities.size ( ) ? "de l'entité " : "des entités ");
+	for (vector<Utils::Entity*>::const_iterator it = entities.begin ( ); entities.end ( ) != it; it++)
+	{
+		if (entities.begin ( ) != it)
+			message << ", ";
+		message << (*it)->getName ( );
+	}	// for (vector<Utils::Entity*>::const_iterator it = entities.begin ( ); ...
+
+	return message;
+}	// entitiesMessage
+
+
+// =========================================================================
+//                    SelectionManager::OrderedEntities
+// =========================================================================
+
+SelectionManager::OrderedEntities::OrderedEntities ( )
+	: _list ( ), _index ( )
+{
+}	// OrderedEntities::OrderedEntities
+
+
+SelectionManager::OrderedEntities::OrderedEntities (const SelectionManager::OrderedEntities& oe)
+	: _list ( ), _index ( )
+{
+	*this	= oe;
+}	// OrderedEntities::OrderedEntities
+
+
+SelectionManager::OrderedEntities& SelectionManager::OrderedEntities::operator = (const SelectionManager::OrderedEntities& oe)
+{
+	if (&oe != this)
+	{	// Les itérateurs de l'index doivent porter sur notre liste :
+		clear ( );
+		for (list<Utils::Entity*>::const_iterator it = oe._list.begin ( ); oe._list.end ( ) != it; it++)
+			insert (*it);
+	}	// if (&oe != this)
+
+	return *this;
+}	// OrderedEntities::operator =
+
+
+bool SelectionManager::OrderedEntities::contains (const Utils::Entity* entity) const
+{
+	return _index.end ( ) != _index.find (entity);
+}	// OrderedEntities::contains
+
+
+bool SelectionManager::OrderedEntities::insert (Utils::Entity* entity)
+{
+	if (true == contains (entity))
+		return false;
+
+	_index [entity]	= _list.insert (_list.end ( ), entity);
+	return true;
+}	// OrderedEntities::insert
+
+
+bool SelectionManager::OrderedEntities::erase (const Utils::Entity* entity)
+{
+	unordered_map<const Utils::Entity*, list<Utils::Entity*>::iterator>::iterator	it	= _index.find (entity);
+	if (_index.end ( ) == it)
+		return false;
+
+	_list.erase (it->second);
+	_index.erase (it);
+	return true;
+}	// OrderedEntities::erase
+
+
+void SelectionManager::OrderedEntities::clear ( )
+{
+	_list.clear ( );
+	_index.clear ( );
+}	// OrderedEntities::clear
+
+
+vector<Utils::Entity*> SelectionManager::OrderedEntities::toVector ( ) const
+{
+	return vector<Utils::Entity*> (_list.begin ( ), _list.end ( ));
+}	// OrderedEntities::toVector
+
+
+// =========================================================================
+//                    SelectionManager::NotificationLocker
+// =========================================================================
+
+SelectionManager::NotificationLocker::NotificationLocker (SelectionManager& selectionManager)
+	: _selectionManager (selectionManager)
+{
+	_selectionManager.lockNotifications (true);
+}	// NotificationLocker::NotificationLocker
+
+
+SelectionManager::NotificationLocker::NotificationLocker (const SelectionManager::NotificationLocker& nl)
+	: _selectionManager (nl._selectionManager)
+{
+    MGX_FORBIDDEN("NotificationLocker::NotificationLocker is not allowed.");
+}	// NotificationLocker::NotificationLocker
+
+
+SelectionManager::NotificationLocker& SelectionManager::NotificationLocker::operator = (const SelectionManager::NotificationLocker&)
+{
+    MGX_FORBIDDEN("NotificationLocker::operator = is not allowed.");
+	return *this;
+}	// NotificationLocker::operator =
+
+
+SelectionManager::NotificationLocker::~NotificationLocker ( )
+{
+	try
+	{
+		_selectionManager.lockNotifications (false);
+	}
+	catch (...)
+	{
+	}
+}	// NotificationLocker::~NotificationLocker
+
+
+// =========================================================================
+//                          SelectionManager
+// =========================================================================
+
 SelectionManager::SelectionManager (const string& name, TkUtil::LogOutputStream* los)
-	: _name (name), _entities ( ), _observers ( ), _mutex (0),
+	: _name (name), _entities ( ), _entitiesByType ( ), _notificationsLock (0),
+	  _pendingAdded ( ), _pendingRemoved ( ), _pendingClear (false),
+	  _observers ( ), _mutex (0),
 	  _undoStack ( ), _currentAction ((size_t)-1), m_logOutputStream(los)
 {
 	_mutex	= new Mutex ( );
@@ -159,7 +298,9 @@ SelectionManager::SelectionManager (const string& name, TkUtil::LogOutputStream*
 
 
 SelectionManager::SelectionManager (const SelectionManager&)
-	: _name ("Invalid name"), _entities ( ), _observers ( ), _mutex (0),
+	: _name ("Invalid name"), _entities ( ), _entitiesByType ( ), _notificationsLock (0),
+	  _pendingAdded ( ), _pendingRemoved ( ), _pendingClear (false),
+	  _observers ( ), _mutex (0),
 	  _undoStack ( ), _currentAction ((size_t)-1), m_logOutputStream (0)
 {
     MGX_FORBIDDEN("SelectionManager::SelectionManager (const SelectionManager&) forbidden.");
@@ -199,7 +340,7 @@ void SelectionManager::getBounds (double bounds [6])
 
 	AutoMutex	autoMutex (getMutex ( ));
 
-	for (vector<Utils::Entity*>::iterator	it = _entities.begin ( ); _entities.end ( ) != it; it++)
+	for (list<Utils::Entity*>::const_iterator	it = _entities.items ( ).begin ( ); _entities.items ( ).end ( ) != it; it++)
 	{
 		double	entityBounds [6];
 		(*it)->getBounds (entityBounds);
@@ -220,7 +361,9 @@ bool SelectionManager::isSelectionEmpty ( ) const
 
 vector<Utils::Entity*> SelectionManager::getEntities ( ) const
 {
-	return _entities;
+	AutoMutex	autoMutex (getMutex ( ));
+
+	return _entities.toVector ( );
 }	// SelectionManager::getMeshes
 
 vector<unsigned long> SelectionManager::getEntitiesIds ( ) const
@@ -237,32 +380,40 @@ vector<unsigned long> SelectionManager::getEntitiesIds ( ) const
 
 std::vector<std::string> SelectionManager::getEntitiesNames ( ) const
 {
+    AutoMutex	autoMutex (getMutex ( ));
+
     std::vector<std::string> entites;
-    for (vector<Mgx3D::Utils::Entity*>::const_iterator  it = _entities.begin ( ); _entities.end ( ) != it; it++)
+    entites.reserve (_entities.size ( ));
+    for (list<Mgx3D::Utils::Entity*>::const_iterator  it = _entities.items ( ).begin ( ); _entities.items ( ).end ( ) != it; it++)
         entites.push_back((*it)->getName());
 
-        return entites;
+    return entites;
 }
 
 std::vector<Mgx3D::Utils::Entity*> SelectionManager::getEntities (Utils::Entity::objectType type) const
 {
-    std::vector<Mgx3D::Utils::Entity*> entites_filtrees;
+    AutoMutex	autoMutex (getMutex ( ));
 
-    for (vector<Mgx3D::Utils::Entity*>::const_iterator  it = _entities.begin( ); _entities.end ( ) != it; it++)
-        if ((*it)->getType() == type)
-            entites_filtrees.push_back(*it);
+    map<Utils::Entity::objectType, OrderedEntities>::const_iterator	itt	= _entitiesByType.find (type);
+    if (_entitiesByType.end ( ) == itt)
+        return std::vector<Mgx3D::Utils::Entity*> ( );
 
-    return entites_filtrees;
+    return itt->second.toVector ( );
 }
 
 
 std::vector<std::string> SelectionManager::getEntitiesNames (Utils::Entity::objectType type) const
 {
+    AutoMutex	autoMutex (getMutex ( ));
+
     std::vector<std::string> entites_filtrees;
+    map<Utils::Entity::objectType, OrderedEntities>::const_iterator	itt	= _entitiesByType.find (type);
+    if (_entitiesByType.end ( ) == itt)
+        return entites_filtrees;
 
-    for (vector<Mgx3D::Utils::Entity*>::const_iterator  it = _entities.begin( ); _entities.end ( ) != it; it++)
-        if ((*it)->getType() == type)
-            entites_filtrees.push_back((*it)->getName());
+    entites_filtrees.reserve (itt->second.size ( ));
+    for (list<Mgx3D::Utils::Entity*>::const_iterator  it = itt->second.items ( ).begin( ); itt->second.items ( ).end ( ) != it; it++)
+        entites_filtrees.push_back((*it)->getName());
 
     return entites_filtrees;
 }
@@ -270,9 +421,11 @@ std::vector<std::string> SelectionManager::getEntitiesNames (Utils::Entity::obje
 
 std::vector<std::string> SelectionManager::getEntitiesNames (Utils::FilterEntity::objectType mask) const
 {
+	AutoMutex	autoMutex (getMutex ( ));
+
 	std::vector<std::string> entites_filtrees;
 
-	for (vector<Mgx3D::Utils::Entity*>::const_iterator  it = _entities.begin( ); _entities.end ( ) != it; it++)
+	for (list<Mgx3D::Utils::Entity*>::const_iterator  it = _entities.items ( ).begin( ); _entities.items ( ).end ( ) != it; it++)
 		if (0 != ((*it)->getFilteredType() & mask))
 			entites_filtrees.push_back((*it)->getName());
 
@@ -294,19 +447,9 @@ void SelectionManager::removeFromSelection (const vector<Utils::Entity*>& entiti
 
 bool SelectionManager::isSelected (const Utils::Entity& entity) const
 {
-    // TODO [EB]: {Optimisation} partie pouvant être couteuse il me semble
-    // [CP] : OPTIMISATION
-    if (0 != entity.getDisplayProperties ( ).getGraphicalRepresentation ( ))
-		return entity.getDisplayProperties ( ).getGraphicalRepresentation ( )->isSelected ( );
-
-	// A priori on ne devrait pas passer ci-dessous :
 	AutoMutex	autoMutex (getMutex ( ));
 
-	for (vector<Utils::Entity*>::const_iterator it = _entities.begin ( ); _entities.end ( ) != it; it++)
-		if (*it == &entity)
-			return true;
-
-	return false;
+	return _entities.contains (&entity);
 }	// SelectionManager::isSelected
 
 
@@ -316,6 +459,37 @@ void SelectionManager::clearSelection ( )
 }	// SelectionManager::clearSelection
 
 
+void SelectionManager::lockNotifications (bool lock)
+{
+	AutoMutex	autoMutex (getMutex ( ));
+
+	if (true == lock)
+	{
+		_notificationsLock++;
+		return;
+	}	// if (true == lock)
+
+	if (0 == _notificationsLock)
+	{
+		INTERNAL_ERROR (exc, "Rétablissement des notifications de sélection.", "Notifications non suspendues.")
+		throw (exc);
+	}	// if (0 == _notificationsLock)
+
+	if (0 != --_notificationsLock)
+		return;
+
+	// Les observateurs peuvent à leur tour modifier la sélection => on vide
+	// le bilan avant de les informer.
+	const vector<Utils::Entity*>	removed	= _pendingRemoved.toVector ( );
+	const vector<Utils::Entity*>	added	= _pendingAdded.toVector ( );
+	const bool						clear	= _pendingClear && _entities.empty ( );
+	_pendingRemoved.clear ( );
+	_pendingAdded.clear ( );
+	_pendingClear	= false;
+	notifyObservers (removed, added, clear);
+}	// SelectionManager::lockNotifications
+
+
 void SelectionManager::undo ( )
 {
 	if (false == isUndoable ( ))
@@ -394,49 +568,28 @@ void SelectionManager::addToSelection (const vector<Utils::Entity*>& entities, b
 	if (0 == entities.size ( ))
 		return;
 
-	bool		hasAlreadySelected	= false, first = true;
-	UTF8String	alreadySelected (Charset::UTF_8);
-	UTF8String   message (Charset::UTF_8);
-	message << (1 == entities.size ( ) ? "Sélection de l'entité " : "Sélection des entités ");
-
+	// Certaines entités peuvent être présentes 2 fois (acteurs VTK filaire + isofilaire par ex) ou déjà sélectionnées :
+	// seules les entités effectivement ajoutées sont empilées et notifiées.
+	vector<Utils::Entity*>	added;
+	added.reserve (entities.size ( ));
 	for (vector<Utils::Entity*>::const_iterator it = entities.begin ( ); entities.end ( ) != it; it++)
 	{
 		CHECK_NULL_PTR_ERROR (*it)
 
-		// On filtre, certaines entités peuvent être présentes 2 fois (acteurs VTK filaire + isofilaire par ex) :
-		vector<Utils::Entity*>::const_iterator itnext	= it;	itnext++;
-		vector<Utils::Entity*>::const_iterator itfound	= find (itnext, entities.end ( ), *it);
-		if (entities.end ( ) != itfound)
-			continue;	// La dernière occurence sera ajoutée
-
-		if (true == isSelected (**it))
-		{
-			hasAlreadySelected	= true;
-			if (0 != alreadySelected.length ( ))
-				alreadySelected << ", ";
-			alreadySelected << (*it)->getName ( );
-
-			continue;
-		}	// if (true == isSelected (**it)
-
-		_entities.push_back (*it);
-		if (false == first)
-			message << ", ";
-		message << (*it)->getName ( );
-		first	= false;
+		if (true == insertEntity (*it))
+			added.push_back (*it);
 	}	// for (vector<Entity*>::const_iterator it = entities.begin ( ); ...
 
+	if (0 == added.size ( ))
+		return;
+
 	if (true == undoable)
-		pushAction (SelectionManager::ADD, entities);
+		pushAction (SelectionManager::ADD, added);
 
 	if (0 != m_logOutputStream)
-		m_logOutputStream->log (TraceLog (message, Log::INFORMATION));
+		m_logOutputStream->log (TraceLog (entitiesMessage ("Sélection ", added), Log::INFORMATION));
 
-	for (vector<SelectionManagerObserver*>::iterator it = _observers.begin ( ); _observers.end ( ) != it; it++)
-	{
-		(*it)->selectionModified ( );
-		(*it)->entitiesAddedToSelection (entities);
-	}	// for (vector<SelectionManagerObserver*>::iterator it = ...
+	notifyObservers (vector<Utils::Entity*> ( ), added, false);
 }	// SelectionManager::addToSelection
 
 
@@ -447,53 +600,26 @@ void SelectionManager::removeFromSelection (const vector<Utils::Entity*>& entiti
 	if (0 == entities.size ( ))
 		return;
 
-	bool		hasAlreadyRemoved	= false, first = true;
-	UTF8String	alreadyRemoved (Charset::UTF_8);
-	UTF8String   message (Charset::UTF_8);
-	message << (1 == entities.size ( ) ? "Désélection de l'entité " : "Désélection des entités ");
-
-	for (vector<Utils::Entity*>::const_iterator it1 = entities.begin ( ); entities.end ( ) != it1; it1++)
+	vector<Utils::Entity*>	removed;
+	removed.reserve (entities.size ( ));
+	for (vector<Utils::Entity*>::const_iterator it = entities.begin ( ); entities.end ( ) != it; it++)
 	{
-		CHECK_NULL_PTR_ERROR (*it1)
-
-		bool	removed	= false;
-		for (vector<Utils::Entity*>::iterator it2 = _entities.begin ( ); _entities.end ( ) != it2; it2++)
-		{
-			if (*it1 == *it2)
-			{
-				removed	= true;
-				_entities.erase (it2);
-				break;
-			}	//if (*it1 == *it2)
-		}	// for (vector<Entity*>::iterator it2 = _entities.begin ( );
+		CHECK_NULL_PTR_ERROR (*it)
 
-		if (false == removed)
-		{
-			hasAlreadyRemoved	= true;
-			if (0 != alreadyRemoved.length ( ))
-				alreadyRemoved << ", ";
-			alreadyRemoved << (*it1)->getName ( );
+		if (true == eraseEntity (*it))
+			removed.push_back (*it);
+	}	// for (vector<Entity*>::const_iterator it = entities.begin ( ); ...
 
-			continue;
-		}	// if (false == removed)
+	if (0 == removed.size ( ))
+		return;
 
-		if (false == first)
-			message << ", ";
-		message << (*it1)->getName ( );
-		first	= false;
-	}	// for (vector<Entity*>::const_iterator it1 = entities.begin ( ); ...
-	
 	if (true == undoable)
-		pushAction (SelectionManager::REMOVE, entities);
+		pushAction (SelectionManager::REMOVE, removed);
 
 	if (0 != m_logOutputStream)
-		m_logOutputStream->log (TraceLog (message, Log::INFORMATION));
+		m_logOutputStream->log (TraceLog (entitiesMessage ("Désélection ", removed), Log::INFORMATION));
 
-	for (vector<SelectionManagerObserver*>::iterator it = _observers.begin ( ); _observers.end ( ) != it; it++)
-	{
-		(*it)->selectionModified ( );
-		(*it)->entitiesRemovedFromSelection (entities, false);
-	}	// for (vector<SelectionManagerObserver*>::iterator it = ...
+	notifyObservers (removed, vector<Utils::Entity*> ( ), false);
 }	// SelectionManager::removeFromSelection
 
 
@@ -505,16 +631,13 @@ void SelectionManager::clearSelection (bool undoable)
 	// effet, ceux-ci peuvent etre tentés d'effectuer des requêtes auprès de ce gestionnaire de sélection, notamment un removeFromSelection. C'est
 	// par exemple le cas d'un observateur Qt où il est difficile de savoir si l'évènement de désenregistrement provient de ce gestionnaire ou d'un 
 	// évenement au niveau de l'IHM.
-	const vector<Utils::Entity*>	unselected	= _entities;
-	if (0 != _entities.size ( ))
+	const vector<Utils::Entity*>	unselected	= _entities.toVector ( );
+	if (0 != unselected.size ( ))
 	{
 		_entities.clear ( );
-		for (vector<SelectionManagerObserver*>::iterator	its	= _observers.begin ( ); _observers.end ( ) != its; its++)
-		{
-			(*its)->selectionModified ( );
-			(*its)->entitiesRemovedFromSelection (unselected, true);
-		}	// for (vector<SelectionManagerObserver*>::iterator its = ...
-	}	// if (0 != _entities.size ( ))
+		_entitiesByType.clear ( );
+		notifyObservers (unselected, vector<Utils::Entity*> ( ), true);
+	}	// if (0 != unselected.size ( ))
 	
 	if (true == undoable)
 		pushAction (SelectionManager::CLEAR, unselected);	// Le clear n'est jamais qu'un remove ;)
@@ -524,6 +647,61 @@ void SelectionManager::clearSelection (bool undoable)
 }	// SelectionManager::clearSelection
 
 
+bool SelectionManager::insertEntity (Utils::Entity* entity)
+{
+	if (false == _entities.insert (entity))
+		return false;
+
+	_entitiesByType [entity->getType ( )].insert (entity);
+	return true;
+}	// SelectionManager::insertEntity
+
+
+bool SelectionManager::eraseEntity (const Utils::Entity* entity)
+{
+	if (false == _entities.erase (entity))
+		return false;
+
+	map<Utils::Entity::objectType, OrderedEntities>::iterator	itt	= _entitiesByType.find (entity->getType ( ));
+	if (_entitiesByType.end ( ) != itt)
+	{
+		itt->second.erase (entity);
+		if (true == itt->second.empty ( ))
+			_entitiesByType.erase (itt);
+	}	// if (_entitiesByType.end ( ) != itt)
+
+	return true;
+}	// SelectionManager::eraseEntity
+
+
+void SelectionManager::notifyObservers (const vector<Utils::Entity*>& removed, const vector<Utils::Entity*>& added, bool clear)
+{
+	if (0 != _notificationsLock)
+	{	// Bilan : une entité enlevée puis ajoutée (ou l'inverse) ne change rien pour les observateurs.
+		for (vector<Utils::Entity*>::const_iterator it = removed.begin ( ); removed.end ( ) != it; it++)
+			if (false == _pendingAdded.erase (*it))
+				_pendingRemoved.insert (*it);
+		for (vector<Utils::Entity*>::const_iterator it = added.begin ( ); added.end ( ) != it; it++)
+			if (false == _pendingRemoved.erase (*it))
+				_pendingAdded.insert (*it);
+		_pendingClear	= _pendingClear || clear;
+		return;
+	}	// if (0 != _notificationsLock)
+
+	if ((0 == removed.size ( )) && (0 == added.size ( )))
+		return;
+
+	for (vector<SelectionManagerObserver*>::iterator it = _observers.begin ( ); _observers.end ( ) != it; it++)
+	{
+		(*it)->selectionModified ( );
+		if (0 != removed.size ( ))
+			(*it)->entitiesRemovedFromSelection (removed, clear);
+		if (0 != added.size ( ))
+			(*it)->entitiesAddedToSelection (added);
+	}	// for (vector<SelectionManagerObserver*>::iterator it = ...
+}	// SelectionManager::notifyObservers
+
+
 void SelectionManager::pushAction (STACK_ACTION action, const std::vector<Mgx3D::Utils::Entity*>& entities)
 {
 	switch (action)
@@ -0,0 +1,120 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file ThreadedJobs.cpp
+ *
+ *  \date 19 oct. 2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Internal/ThreadedJobs.h"
+#include "Internal/Resources.h"
+/*----------------------------------------------------------------------------*/
+#include <TkUtil/Exception.h>
+#include <TkUtil/UTF8String.h>
+/*----------------------------------------------------------------------------*/
+#include <Standard_Failure.hxx>
+/*----------------------------------------------------------------------------*/
+#include <algorithm>
+#include <atomic>
+#include <system_error>
+#include <thread>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Internal {
+/*----------------------------------------------------------------------------*/
+/// exécute job et retourne son éventuel message d'erreur
+static TkUtil::UTF8String runJob (const std::function<void()>& job)
+{
+	try
+	{
+		job ( );
+	}
+	catch (const TkUtil::Exception& exc)
+	{
+		return exc.getFullMessage ( );
+	}
+	catch (const Standard_Failure& exc)
+	{
+		return TkUtil::UTF8String (exc.GetMessageString ( ), TkUtil::Charset::UTF_8);
+	}
+	catch (const std::exception& exc)
+	{
+		return TkUtil::UTF8String (exc.what ( ), TkUtil::Charset::UTF_8);
+	}
+	catch (...)
+	{
+		return TkUtil::UTF8String ("Erreur non documentée.", TkUtil::Charset::UTF_8);
+	}
+	return TkUtil::UTF8String (TkUtil::Charset::UTF_8);
+}	// runJob
+/*----------------------------------------------------------------------------*/
+void runThreadedJobs (const std::vector<std::function<void()> >& jobs)
+{
+	const size_t nbThreads = std::min<size_t> (jobs.size ( ), std::thread::hardware_concurrency ( ));
+	if (nbThreads > 1
+	    && true == Resources::instance ( )._allowThreadedCommandTasks.getValue ( )) {
+		// les threads, dont l'appelant, prennent le prochain travail non
+		// commencé : seuls les travaux de cet appel sont attendus
+		std::vector<TkUtil::UTF8String> messages (jobs.size ( ), TkUtil::UTF8String (TkUtil::Charset::UTF_8));
+		std::atomic<size_t> next (0);
+		auto worker = [&jobs, &messages, &next] ( ) {
+			for (size_t j = next++; j < jobs.size ( ); j = next++)
+				messages [j] = runJob (jobs [j]);
+		};
+		std::vector<std::thread> threads;
+		threads.reserve (nbThreads - 1);
+		try
+		{
+			for (size_t t = 1; t < nbThreads; t++)
+				threads.emplace_back (worker);
+		}
+		catch (const std::system_error&)
+		{	// plus de thread disponible : les threads créés et l'appelant suffisent
+		}
+		worker ( );
+		for (std::thread& thread : threads)
+			thread.join ( );
+
+		TkUtil::UTF8String	errors (TkUtil::Charset::UTF_8);
+		for (const TkUtil::UTF8String& message : messages) {
+			if (false == message.empty ( )) {
+				if (false == errors.empty ( ))
+					errors << "\n";
+				errors << message;
+			}
+		}
+		if (false == errors.empty ( ))
+			throw TkUtil::Exception (errors);
+	}
+	else {
+		for (const std::function<void()>& job : jobs)
+			job ( );
+	}
+}
+/*----------------------------------------------------------------------------*/
+void runThreadedRanges (size_t nb, size_t minItemsPerJob, size_t jobsPerThread,
+		const std::function<void(size_t, size_t)>& job)
+{
+	if (0 == nb)
+		return;
+
+	const size_t nbThreads = std::max<size_t> (1, std::thread::hardware_concurrency ( ));
+	const size_t nbJobs = nbThreads * std::max<size_t> (1, jobsPerThread);
+	const size_t chunk = std::max<size_t> (std::max<size_t> (1, minItemsPerJob), (nb + nbJobs - 1) / nbJobs);
+	if (chunk >= nb) {
+		job (0, nb);
+		return;
+	}
+
+	std::vector<std::function<void()> > jobs;
+	for (size_t first = 0; first < nb; first += chunk) {
+		const size_t last = std::min (first + chunk, nb);
+		jobs.push_back ([&job, first, last] ( ) { job (first, last); });
+	}
+	runThreadedJobs (jobs);
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Internal
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
@@ -12,6 +12,7 @@
 #include "Smoothing/SurfacicSmoothing.h"
 #include "Smoothing/VolumicSmoothing.h"
 #include "Utils/Command.h"
+#include "Utils/Profiler.h"
 #include "Group/GroupEntity.h"
 #include "Group/GroupManager.h"
 #include "Topo/TopoHelper.h"
@@ -433,16 +434,19 @@ void CommandCreateMesh::permInternalsStats()
 /*----------------------------------------------------------------------------*/
 void CommandCreateMesh::mesh(std::vector<Topo::Block* >& blocs)
 {
+    MGX_PROFILE_SCOPE ("mesh blocks", typeid (*this))
     getContext().getMeshManager().getMesh()->mesh(this, blocs);
 }
 /*----------------------------------------------------------------------------*/
 void CommandCreateMesh::mesh(Topo::Block* & bloc)
 {
+    MGX_PROFILE_SCOPE ("mesh block", typeid (*this))
     getContext().getMeshManager().getMesh()->mesh(this, bloc);
 }
 /*----------------------------------------------------------------------------*/
 void CommandCreateMesh::preMesh(const std::vector<Topo::Block*>& blocks)
 {
+	MGX_PROFILE_SCOPE ("preMesh blocks", typeid (*this))
 	if (true == threadingEnabled ( ) && true == Internal::Resources::instance ( )._allowThreadedBlockPreMeshTasks.getValue( ))
 	{
 #ifdef _DEBUG_THREAD
@@ -496,16 +500,45 @@ void CommandCreateMesh::threadedPreMesh(Topo::Block* bloc)
 /*----------------------------------------------------------------------------*/
 void CommandCreateMesh::mesh(std::vector<Topo::CoFace* >& faces)
 {
+    MGX_PROFILE_SCOPE ("mesh faces", typeid (*this))
     getContext().getMeshManager().getMesh()->mesh(this, faces);
 }
 /*----------------------------------------------------------------------------*/
 void CommandCreateMesh::mesh(Topo::CoFace*  face)
 {
+    MGX_PROFILE_SCOPE ("mesh face", typeid (*this))
     getContext().getMeshManager().getMesh()->mesh(this, face);
 }
 /*----------------------------------------------------------------------------*/
+void CommandCreateMesh::meshDelaunayGMSH(const std::vector<Topo::CoFace*>& faces)
+{
+    std::vector<Topo::CoFace*> gmsh_faces;
+    for (Topo::CoFace* face : faces)
+        if (!face->isMeshed() && face->getMeshLaw() == Topo::CoFaceMeshingProperty::delaunayGMSH)
+            gmsh_faces.push_back(face);
+    if (gmsh_faces.empty())
+        return;
+
+    MGX_PROFILE_SCOPE ("mesh faces GMSH", typeid (*this))
+    getContext().getMeshManager().getMesh()->mesh(this, gmsh_faces);
+}
+/*----------------------------------------------------------------------------*/
+void CommandCreateMesh::meshDelaunayTetgen(const std::vector<Topo::Block*>& blocs)
+{
+    std::vector<Topo::Block*> tetgen_blocks;
+    for (Topo::Block* bloc : blocs)
+        if (!bloc->isMeshed() && bloc->getMeshLaw() == Topo::BlockMeshingProperty::delaunayTetgen)
+            tetgen_blocks.push_back(bloc);
+    if (tetgen_blocks.empty())
+        return;
+
+    MGX_PROFILE_SCOPE ("mesh blocks Tetgen", typeid (*this))
+    getContext().getMeshManager().getMesh()->mesh(this, tetgen_blocks);
+}
+/*----------------------------------------------------------------------------*/
 void CommandCreateMesh::preMesh(const std::vector<Topo::CoFace*>& faces)
 {
+	MGX_PROFILE_SCOPE ("preMesh faces", typeid (*this))
     double nbTot = (double)faces.size();
     double nbFaits = 0;
 
@@ -868,10 +901,9 @@ saveInternalsStats()
 {
     Internal::InfoCommand& icmd = getInfoCommand();
 
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>&  topo_entities_info = icmd.getTopoInfoEntity();
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
-            iter_tei != topo_entities_info.end(); ++iter_tei){
-        Topo::TopoEntity* te = iter_tei->first;
+    std::vector<Internal::InfoCommand::TopoEntityInfo>&  topo_entities_info = icmd.getTopoInfoEntity();
+    for (uint i_tei=0; i_tei<topo_entities_info.size(); i_tei++){
+        Topo::TopoEntity* te = topo_entities_info[i_tei].m_topo_entity;
         te->saveInternals(this);
     }
 
@@ -1083,6 +1115,9 @@ meshAndModify(std::list<Topo::CoFace*>& list_cofaces)
 		// utilisation du multithreading si possible
 		preMesh(cofaces_to_be_meshed);
 
+		// les faces triangulées par GMSH le sont en une fois
+		meshDelaunayGMSH(cofaces_to_be_meshed);
+
 		for (uint i=0; i<cofaces_to_be_meshed.size(); i++)
 			mesh(cofaces_to_be_meshed[i]);
 
@@ -1111,12 +1146,13 @@ meshAndModify(std::list<Topo::CoFace*>& list_cofaces)
 				std::vector<std::string> names;
 				names.push_back("SepaDelta");
 				msurf->setNodesValuesNames(names);
-				std::map<int,double> value;//(gmdsNodes.size());
+				std::map<int,double> value;
 
-				std::map<gmds::Node,double> deltas = sepa->getDeltas();
+				// les deltas sont rangés dans l'ordre de gmdsNodes
+				const std::vector<double>& deltas = sepa->getDeltas();
 
 				for(unsigned int iNode=0; iNode<gmdsNodes.size(); iNode++) {
-					value[gmdsNodes[iNode].id()] = deltas[gmdsNodes[iNode]];
+					value.emplace_hint(value.end(), gmdsNodes[iNode].id(), deltas[iNode]);
 				}
 
 				msurf->setNodesValue("SepaDelta",value);
@@ -1183,7 +1219,7 @@ meshAndModify(std::list<Topo::CoFace*>& list_cofaces)
                         {
                             bool isInverted = isCoFaceInverted[coface];
                             std::vector<gmds::TCellID> &l_nds = coface->nodes();
-                            std::vector<gmds::TCellID> &l_poly = coface->faces();
+                            const Topo::MeshCellIds &l_poly = coface->faces();
 
                             for (unsigned int poly : l_poly)
                             {
@@ -1327,7 +1363,7 @@ modify(std::vector<Topo::Block*>& list_blocks)
 
 					for (Topo::Block* block : blocks){
 						std::vector<gmds::TCellID>& l_nds = block->nodes();
-						std::vector<gmds::TCellID>& l_poly = block->regions();
+						const Topo::MeshCellIds& l_poly = block->regions();
 
 						for(unsigned int i_poly=0;i_poly<l_poly.size();i_poly++){
 							polygedres.push_back(gmds_mesh.get<gmds::Region>(l_poly[i_poly]));
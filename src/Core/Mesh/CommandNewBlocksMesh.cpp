@@ -71,9 +71,8 @@ internalExecute()
 {
 	setStepNum (11);		// L'exécution se fait en 11 étapes ...
 	size_t	step	= 0;	// Etape courrante de la commande
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandNewBlocksMesh::execute pour la commande " << getName ( )
-                     << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandNewBlocksMesh::execute pour la commande " << getName ( )
+                     << " de nom unique " << getUniqueName ( ));
 
 #ifdef _DEBUG2
 	std::cout<<"CommandNewBlocksMesh::internalExecute()"<<std::endl;
@@ -199,6 +198,8 @@ internalExecute()
 #endif
     setStepProgression (1.);
 	setStep (++step, "Maillage des faces", 0.);
+	// les faces triangulées par GMSH le sont en une fois
+	meshDelaunayGMSH (faces);
     double nbTotFa = (double)faces.size();
     double nbFaitsFa = 0;
     for (uint i=0; i<faces.size(); i++){
@@ -236,6 +237,8 @@ internalExecute()
 #endif
     setStepProgression (1.);
     setStep (++step, "Maillage des blocs", 0.);
+    // les blocs tétraédrisés par Tetgen le sont en une fois
+    meshDelaunayTetgen (m_blocks);
     double nbTotBl = (double)m_blocks.size();
     double nbFaitsBl = 0.0;
 #ifdef _DEBUG2
@@ -274,8 +277,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 unsigned long CommandNewBlocksMesh::getEstimatedDuration (PLAY_TYPE playType)
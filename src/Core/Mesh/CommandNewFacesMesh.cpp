@@ -71,9 +71,8 @@ internalExecute()
 {
 	setStepNum (7);			// L'exécution se fait en 5 étapes ...
 	size_t	step	= 1;	// Etape courrante de la commande
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandNewFacesMesh::execute pour la commande " << getName ( )
-                     << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandNewFacesMesh::execute pour la commande " << getName ( )
+                     << " de nom unique " << getUniqueName ( ));
 
 	setStepProgression (1.);
 	setStep (step, "Recensement des faces", 0.);
@@ -144,6 +143,8 @@ internalExecute()
 
 	setStepProgression (1.);
 	setStep (++step, "Maillage des faces", 0.);
+	// les faces triangulées par GMSH le sont en une fois
+	meshDelaunayGMSH (m_faces);
     double nb_faces = (double)m_faces.size();
     double nbFaits = 0.0;
     for (std::vector<Topo::CoFace* >::iterator iter = m_faces.begin();
@@ -159,8 +160,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 } // end namespace Mesh
@@ -33,9 +33,8 @@ CommandRotateMesh::
 void CommandRotateMesh::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandRotateMesh::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandRotateMesh::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     // création de l'opérateur de rotation via OCC
     gp_Trsf transf;
@@ -51,16 +50,13 @@ internalExecute()
 
     // applique la transformation
     transform(&transf);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandRotateMesh::internalUndo()
 {
 	// on fait la commande inverse
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-	message << "CommandRotateMesh::execute pour la commande " << getName ( )
-	            		<< " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandRotateMesh::execute pour la commande " << getName ( )
+	            		<< " de nom unique " << getUniqueName ( ));
 
 	// création de l'opérateur de rotation via OCC
 	gp_Trsf transf;
@@ -76,8 +72,6 @@ void CommandRotateMesh::internalUndo()
 
 	// applique la transformation
 	transform(&transf);
-
-	log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 } // end namespace Mesh
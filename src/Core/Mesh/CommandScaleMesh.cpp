@@ -71,9 +71,8 @@ CommandScaleMesh::
 void CommandScaleMesh::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandScaleMesh::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandScaleMesh::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     if (m_isHomogene){
         // création de l'opérateur d'homothétie via OCC
@@ -96,15 +95,13 @@ internalExecute()
         // applique la transformation
         transform(&transf);
     }
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandScaleMesh::
 internalUndo()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandScaleMesh::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandScaleMesh::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     if (m_isHomogene){
     	// création de l'opérateur d'homothétie via OCC
@@ -127,8 +124,6 @@ internalUndo()
         // applique la transformation
         transform(&transf);
     }
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 } // end namespace Mesh
@@ -37,9 +37,8 @@ CommandTranslateMesh::
 void CommandTranslateMesh::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandTranslateMesh::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandTranslateMesh::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     // création de l'opérateur de rotation via OCC
     gp_Trsf transf;
@@ -48,16 +47,13 @@ internalExecute()
 
     // applique la transformation
     transform(&transf);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandTranslateMesh::
 internalUndo()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandTranslateMesh::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandTranslateMesh::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     // création de l'opérateur de rotation via OCC
     gp_Trsf transf;
@@ -66,8 +62,6 @@ internalUndo()
 
     // applique la transformation
     transform(&transf);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 } // end namespace Mesh
@@ -8,15 +8,16 @@ namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
 namespace Mesh {
 /*----------------------------------------------------------------------------*/
-CommandWriteVTK::CommandWriteVTK(Internal::Context& c, std::string& nom)
+CommandWriteVTK::CommandWriteVTK(Internal::Context& c, std::string& nom, bool compressed)
 : Internal::CommandInternal (c, "Sauvegarde du maillage (vtk)")
 , m_file_name(nom)
+, m_compressed(compressed)
 {
 }
 /*----------------------------------------------------------------------------*/
 void CommandWriteVTK::internalExecute()
 {
-	getContext().getMeshManager().getMesh()->writeVTK(m_file_name);
+	getContext().getMeshManager().getMesh()->writeVTK(m_file_name, m_compressed);
 }
 /*----------------------------------------------------------------------------*/
 void CommandWriteVTK::internalUndo()
@@ -157,7 +157,7 @@ void Line::getGMDSEdges(std::vector<gmds::Edge >& AEdges) const
     gmds::Mesh& gmdsMesh = meshImpl->getGMDSMesh();
 
      for(Topo::CoEdge* coedge : getCoEdges()) {
-        std::vector<gmds::TCellID> edges  = coedge->edges();
+        const Topo::MeshCellIds& edges  = coedge->edges();
 
         for(unsigned int iEdge=0; iEdge<edges.size(); iEdge++) {
         	AEdges.push_back(gmdsMesh.get<gmds::Edge>(edges[iEdge]));
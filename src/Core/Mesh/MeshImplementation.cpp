@@ -4,6 +4,8 @@
 #include "Mesh/MeshImplementation.h"
 #include "Mesh/CommandCreateMesh.h"
 #include "Mesh/CommandModifyMesh.h"
+#include "Mesh/VTUReader.h"
+#include "Mesh/VTUWriter.h"
 
 #include "Smoothing/MesquiteMeshImplAdapter.h"
 #include "Smoothing/MesquiteDomainImplAdapter.h"
@@ -351,6 +353,12 @@ void MeshImplementation::writeMli(std::string nom)
 /*----------------------------------------------------------------------------*/
 void MeshImplementation::readVTK(std::string nom, uint id)
 {
+	if (nom.substr(nom.find_last_of('.')+1) == "vtu") {
+		VTUReader reader(getGMDSMesh(id));
+		reader.read(nom);
+		return;
+	}
+
 	try{
 		gmds::IGMeshIOService ioService(&getGMDSMesh(id));
 		gmds::VTKReader vtkReader(&ioService);
@@ -365,8 +373,17 @@ void MeshImplementation::readVTK(std::string nom, uint id)
 	}
 }
 /*----------------------------------------------------------------------------*/
-void MeshImplementation::writeVTK(std::string nom)
+void MeshImplementation::writeVTK(std::string nom, bool compressed)
 {
+	if (nom.substr(nom.find_last_of('.')+1) == "vtu") {
+		// les groupes sont écrits directement, sans passer par ceux de gmds
+		VTUWriter writer(&getContext(), getGMDSMesh(), compressed);
+		writer.write(nom);
+		return;
+	}
+	if (compressed)
+		throw TkUtil::Exception (TkUtil::UTF8String ("MeshImplementation::writeVTK : la compression n'est possible qu'au format vtu", TkUtil::Charset::UTF_8));
+
     // on ajoute les groupes de mailles de gmds
 	bool isCreateGMDSGroupsOK = createGMDSGroups();
 	if(!isCreateGMDSGroupsOK) {
@@ -978,6 +995,25 @@ void MeshImplementation::mesh(Mesh::CommandCreateMesh* command,
     std::cout <<"MeshImplementation::mesh pour "<<blocs.size()<<" blocs"<<std::endl;
 #endif
 
+    // les blocs maillés par Tetgen le sont ensemble
+    std::vector<Topo::Block* > tetgen_blocks;
+    for (Topo::Block* bl : blocs)
+        if (!bl->isMeshed() && bl->getMeshLaw() == Topo::BlockMeshingProperty::delaunayTetgen)
+            tetgen_blocks.push_back(bl);
+    if (!tetgen_blocks.empty()){
+        if (getContext().getMeshDim() == Internal::Context::MESH2D)
+        	throw TkUtil::Exception (TkUtil::UTF8String ("Il n'est pas possible de mailler des blocs alors que le maillage n'est pas 3D en sortie", TkUtil::Charset::UTF_8));
+        for (Topo::Block* bl : tetgen_blocks){
+            std::vector<Topo::Face*> faces = bl->getFaces();
+            for (uint i=0; i<faces.size(); i++)
+                mesh(command, faces[i]);
+            bl->saveBlockMeshingData(&command->getInfoCommand());
+        }
+        meshDelaunayTetgen(command, tetgen_blocks);
+        for (Topo::Block* bl : tetgen_blocks)
+            bl->getMeshingData()->setMeshed(true);
+    }
+
     for (std::vector<Topo::Block* >::iterator iter = blocs.begin();
             iter != blocs.end(); ++iter)
         mesh(command, *iter);
@@ -1004,6 +1040,19 @@ void MeshImplementation::mesh(Mesh::CommandCreateMesh* command,
     std::cout <<"MeshImplementation::mesh pour "<<faces.size()<<" faces communes"<<std::endl;
 #endif
 
+    // les faces maillées par GMSH le sont ensemble
+    std::vector<Topo::CoFace* > gmsh_faces;
+    for (Topo::CoFace* fa : faces)
+        if (!fa->isMeshed() && fa->getMeshLaw() == Topo::CoFaceMeshingProperty::delaunayGMSH)
+            gmsh_faces.push_back(fa);
+    if (!gmsh_faces.empty()){
+        for (Topo::CoFace* fa : gmsh_faces)
+            fa->saveCoFaceMeshingData(&command->getInfoCommand());
+        meshDelaunayGMSH(command, gmsh_faces);
+        for (Topo::CoFace* fa : gmsh_faces)
+            fa->getMeshingData()->setMeshed(true);
+    }
+
     for (std::vector<Topo::CoFace* >::iterator iter = faces.begin();
             iter != faces.end(); ++iter)
         mesh(command, *iter);
@@ -15,6 +15,13 @@
 #include <TkUtil/TraceLog.h>
 #include <TkUtil/MemoryError.h>
 /*----------------------------------------------------------------------------*/
+#include <algorithm>
+#include <cfloat>
+#include <cstdlib>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+/*----------------------------------------------------------------------------*/
 //#define _DEBUG_MESH
 
 /// GMSH
@@ -28,261 +35,421 @@ namespace Mgx3D {
 namespace Mesh {
 /*----------------------------------------------------------------------------*/
 void MeshImplementation::meshDelaunayGMSH(Mesh::CommandCreateMesh* command, Topo::CoFace* fa)
+{
+    std::vector<Topo::CoFace*> cofaces(1, fa);
+    meshDelaunayGMSH(command, cofaces);
+}
+/*----------------------------------------------------------------------------*/
+void MeshImplementation::meshDelaunayGMSH(Mesh::CommandCreateMesh* command, std::vector<Topo::CoFace*>& cofaces)
 {
 #ifndef USE_GMSH
 	std::cerr<<"meshDelaunayGMSH not available"<<std::endl;
 	return;
 #else
 #ifdef _DEBUG_MESH
-    std::cout <<"Maillage de la face commune "<<fa->getName()<<" avec la méthode de Delaunay (version GMSH)"<<std::endl;
+    std::cout <<"Maillage de "<<cofaces.size()<<" faces communes avec la méthode de Delaunay (version GMSH)"<<std::endl;
 #endif
 
+    // regroupement des faces en lots maillés par un même modèle GMSH :
+    // les tailles sont des options globales de GMSH et une surface ne peut
+    // être importée qu'une fois par modèle
+    struct Batch {
+        double m_min;
+        double m_max;
+        std::set<Geom::Surface*> m_surfaces;
+        std::vector<Topo::CoFace*> m_cofaces;
+    };
+    std::vector<Batch> batches;
+
+    for (Topo::CoFace* fa : cofaces){
+        Topo::FaceMeshingPropertyDelaunayGMSH* prop =
+                dynamic_cast<Topo::FaceMeshingPropertyDelaunayGMSH*>(fa->getCoFaceMeshingProperty());
+        CHECK_NULL_PTR_ERROR(prop);
+
+        //Geometrie de la coface
+        Geom::GeomEntity* geo_entity = fa->getGeomAssociation();
+        if(geo_entity==0 || geo_entity->getDim() != 2){
+            TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+            message << "La face  "<< fa->getName()
+                    << " ne peut pas être maillée en triangles : absence de géométrie associée";
+            throw TkUtil::Exception (message);
+        }
+        Geom::Surface* surf = dynamic_cast<Geom::Surface*>(geo_entity);
+        CHECK_NULL_PTR_ERROR(surf);
+
+        Batch* batch = 0;
+        for (Batch& b : batches)
+            if (b.m_min == prop->getMin() && b.m_max == prop->getMax()
+                    && b.m_surfaces.find(surf) == b.m_surfaces.end()){
+                batch = &b;
+                break;
+            }
+        if (batch == 0){
+            batches.push_back(Batch());
+            batch = &batches.back();
+            batch->m_min = prop->getMin();
+            batch->m_max = prop->getMax();
+        }
+        batch->m_surfaces.insert(surf);
+        batch->m_cofaces.push_back(fa);
+    } // end for fa : cofaces
+
     // init des options GMSH
     gmsh::initialize();
     gmsh::logger::start();
+    gmsh::option::setNumber("Mesh.Algorithm", 6); // algo Frontal-Delaunay
+    // la discrétisation des courbes est imposée, GMSH ne maille que ce qui est vide
+    gmsh::option::setNumber("Mesh.MeshOnlyEmpty", 1);
+
+    try {
+        for (Batch& batch : batches){
+            // récupération des paramètre utilisateur
+            gmsh::option::setNumber("Mesh.MeshSizeMin", batch.m_min);
+            gmsh::option::setNumber("Mesh.MeshSizeMax", batch.m_max);
+            meshDelaunayGMSHBatch(command, batch.m_cofaces);
+        }
+    }
+    catch (...){
+        gmsh::logger::stop();
+        gmsh::finalize();
+        throw;
+    }
 
-    Topo::FaceMeshingPropertyDelaunayGMSH* prop =
-            dynamic_cast<Topo::FaceMeshingPropertyDelaunayGMSH*>(fa->getCoFaceMeshingProperty());
-    CHECK_NULL_PTR_ERROR(prop);
+    for (Topo::CoFace* fa : cofaces){
+        std::vector<std::string> group_names;
+        fa->getGroupsName(group_names);
 
-    // récupération des paramètre utilisateur
-    gmsh::option::setNumber("Mesh.MeshSizeMin", prop->getMin());
-    gmsh::option::setNumber("Mesh.MeshSizeMax", prop->getMax());
-    gmsh::option::setNumber("Mesh.Algorithm", 6); // algo Frontal-Delaunay
+#ifdef _DEBUG_GROUP_BY_TOPO_ENTITY
+        // on ajoute un groupe pour distinguer les faces en mode debug
+        group_names.push_back(fa->getName());
+#endif
 
-    // Initialize robust predicates
-    //robustPredicates::exactinit();
+        // ajout des polygones aux surfaces
+        for (size_t i=0; i<group_names.size(); i++){
+            std::string& nom = group_names[i];
 
-    //Geometrie de la coface
-    Geom::GeomEntity* geo_entity = fa->getGeomAssociation();
-    if(geo_entity==0 || geo_entity->getDim() != 2){
-		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-        message << "La face  "<< fa->getName()
-                << " ne peut pas être maillée en triangles : absence de géométrie associée";
-        throw TkUtil::Exception (message);
-    }
+            try {
+                getContext().getMeshManager().getSurface(nom);
+                command->addModifiedSurface(nom);
+            } catch (...) {
+                command->addNewSurface(nom);
+            }
 
-    Geom::Surface* f = dynamic_cast<Geom::Surface*>(geo_entity);
-    for (auto face_shape : f->getOCCFaces()) {
+            // la surface de maillage que l'on vient de créer/modifier
+            Mesh::Surface* sf = getContext().getMeshManager().getSurface(nom);
+            sf->saveMeshSurfaceTopoProperty(&command->getInfoCommand());
+            sf->add(fa);
+        } // end for i<group_names.size()
+    } // end for fa : cofaces
 
 #ifdef _DEBUG_MESH
-        std::cout <<"=== new gmsh model"<<std::endl;
-#endif
-        // construction du modèle GMSH à partir de cette shape OCC
-        gmsh::model::add(std::string("GModel_")+fa->getName());
-    
-#ifdef _DEBUG_MESH
-        std::cout <<"=== importOCCShape"<<std::endl;
+    // Inspect the log:
+    std::vector<std::string> log;
+    gmsh::logger::get(log);
+    std::cout << "Logger has recorded " << log.size() << " lines" << std::endl;
 #endif
-        gmsh::vectorpair gmsh_out_dim_tags;
-        gmsh::model::occ::importShapesNativePointer(&face_shape, gmsh_out_dim_tags);
 
+    gmsh::logger::stop();
+    gmsh::finalize();
+#endif // USE_GMSH
+} // end meshDelaunayGMSH
+/*----------------------------------------------------------------------------*/
+#ifdef USE_GMSH
+void MeshImplementation::meshDelaunayGMSHBatch(Mesh::CommandCreateMesh* command, std::vector<Topo::CoFace*>& cofaces)
+{
+    gmds::Mesh& gmds_mesh = getGMDSMesh();
+
+    // construction du modèle GMSH à partir des shapes OCC de toutes les faces du lot
+    gmsh::model::add("GModel_Delaunay");
+
+    std::vector<std::vector<int> > gmsh_surface_tags(cofaces.size());
+    for (uint i=0; i<cofaces.size(); i++){
+        Geom::Surface* f = dynamic_cast<Geom::Surface*>(cofaces[i]->getGeomAssociation());
+        for (auto face_shape : f->getOCCFaces()) {
+            gmsh::vectorpair gmsh_out_dim_tags;
+            gmsh::model::occ::importShapesNativePointer(&face_shape, gmsh_out_dim_tags);
+            for (auto gmsh_dim_tag : gmsh_out_dim_tags)
+                if (gmsh_dim_tag.first == 2)
+                    gmsh_surface_tags[i].push_back(gmsh_dim_tag.second);
+        }
+    }
+    gmsh::model::occ::synchronize();
+
+    // correspondance dense entre les numéros de noeuds GMSH (que l'on choisit
+    // pour les noeuds du bord) et les noeuds GMDS
+    std::vector<gmds::TCellID> gmshNodeTag_to_gmdsCellId(1, gmds::NullID);
+    std::unordered_map<gmds::TCellID, std::size_t> gmdsCellId_to_gmshNodeTag;
+    // noeud de chaque point GMSH
+    std::unordered_map<int, std::size_t> gmshPointTag_to_gmshNodeTag;
+    // courbes dont la discrétisation est déjà imposée
+    std::set<int> gmsh_curves_done;
+    // noeuds GMDS créés pour les sommets de la géométrie, avec la face qui les a créés
+    std::unordered_map<gmds::TCellID, uint> gmds_point_nodes;
+
+    const double precision = Utils::Math::MgxNumeric::mgxGeomDoubleEpsilon;
+
+    for (uint i=0; i<cofaces.size(); i++){
+        Topo::CoFace* fa = cofaces[i];
 #ifdef _DEBUG_MESH
         std::cout <<"=== traitement des arêtes de la face "<<fa->getName()<<std::endl;
 #endif
-        // on recupere le maillage des aretes
-        std::vector<Topo::Edge* > edges = fa->getEdges();
+        // les noeuds GMDS du bord de la face, issus du maillage des arêtes
+        std::vector<gmds::TCellID> gmds_node_ids;
+        std::vector<Utils::Math::Point> gmds_node_points;
+        {
+            std::unordered_set<gmds::TCellID> filtre_nodes;
+            for (Topo::Edge* edge : fa->getEdges()){
+                std::vector<Topo::Vertex* > vertices = edge->getVertices();
+                if(vertices.size()!=2){
+                    TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+                    message << "La face  "<< fa->getName()
+                            << " ne peut pas être maillée en triangles :\n"
+                            <<" une arete est incidente à "
+                            <<vertices.size()<<" sommets";
+                    throw TkUtil::Exception (message);
+                }
 
-        // Set qui contient tous les noeuds gmds
-        std::set<gmds::TCellID> gmds_node_ids;
+                std::vector<gmds::Node> gmds_edge_nodes;
+                edge->getNodes(vertices[0], vertices[1], gmds_edge_nodes);
+                for (gmds::Node& gmds_node : gmds_edge_nodes)
+                    if (filtre_nodes.insert(gmds_node.id()).second){
+                        gmds_node_ids.push_back(gmds_node.id());
+                        gmds_node_points.push_back(getCoordNode(gmds_node));
+                    }
+            }
+        }
 
-        gmsh::vectorpair gmsh_point_dim_tags;
+        // noeud GMSH d'un point, de préférence un noeud GMDS du bord
+        auto pointNode = [&](int gmsh_point_tag) -> std::size_t {
+            auto iter = gmshPointTag_to_gmshNodeTag.find(gmsh_point_tag);
+            if (iter != gmshPointTag_to_gmshNodeTag.end())
+                return iter->second;
+
+            std::vector<double> coord;
+            gmsh::model::getValue(0, gmsh_point_tag, std::vector<double>(), coord);
+            Utils::Math::Point pt(coord[0], coord[1], coord[2]);
+
+            gmds::TCellID gmds_node_id = gmds::NullID;
+            for (uint k=0; k<gmds_node_ids.size(); k++)
+                if (gmds_node_points[k].length(pt) < precision){
+                    gmds_node_id = gmds_node_ids[k];
+                    break;
+                }
 
-        for(unsigned int i=0;i<edges.size();i++){
-            Topo::Edge* edge = edges[i];
-#ifdef _DEBUG_MESH
-            std::cout <<"--Traitement de l'arête "<<edge->getName()<<std::endl;
-#endif
-            std::vector<Topo::Vertex* > vertices = edge->getVertices();
-
-            if(vertices.size()!=2){
-                TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-                message << "La face  "<< fa->getName()
-                        << " ne peut pas être maillée en triangles :\n"
-                        <<" une arete est incidente à "
-                        <<vertices.size()<<" sommets";
-                throw TkUtil::Exception (message);
+            std::size_t gmsh_node_tag = 0;
+            if (gmds_node_id != gmds::NullID){
+                auto iter2 = gmdsCellId_to_gmshNodeTag.find(gmds_node_id);
+                if (iter2 != gmdsCellId_to_gmshNodeTag.end())
+                    gmsh_node_tag = iter2->second;
             }
- 
-            std::vector<gmds::Node> gmds_edge_nodes;
-            edge->getNodes(vertices[0], vertices[1], gmds_edge_nodes);
-
-            // On stocke la liste des noeuds gmds rencontrés dans l'algorithme
-            // afin de ne pas les recréer lors de la récupération des triangles
-            if (gmds_edge_nodes.size() > 0)
-            {
-                    gmds_node_ids.insert(gmds_edge_nodes[0].id());
-                    gmds_node_ids.insert(gmds_edge_nodes[gmds_edge_nodes.size() - 1].id());
+            else {
+                // sommet de la géométrie sans noeud du bord, comme GMSH le ferait
+                // (rattaché aux faces dont il est un sommet des triangles)
+                gmds_node_id = gmds_mesh.newNode(coord[0], coord[1], coord[2]).id();
+                gmds_point_nodes[gmds_node_id] = i;
+                command->addCreatedNode(gmds_node_id);
             }
-
-            // Création des noeuds internes de l'arête dans gmsh selon la discrétisation choisie
-            for (uint j=1; j<gmds_edge_nodes.size()-1; j++)
-            {
-                gmds::Node gmds_node = gmds_edge_nodes[j];
-                gmds_node_ids.insert(gmds_node.id());
-                Utils::Math::Point pt = getCoordNode(gmds_node);
-                int gmsh_point_tag = gmsh::model::occ::addPoint(pt.getX(), pt.getY(), pt.getZ());
-                gmsh_point_dim_tags.push_back({0, gmsh_point_tag});
+            if (gmsh_node_tag == 0){
+                gmsh_node_tag = gmshNodeTag_to_gmdsCellId.size();
+                gmshNodeTag_to_gmdsCellId.push_back(gmds_node_id);
+                gmdsCellId_to_gmshNodeTag[gmds_node_id] = gmsh_node_tag;
+                gmsh::model::mesh::addNodes(0, gmsh_point_tag, {gmsh_node_tag}, coord);
             }
-        } // end for(unsigned int i=0;i<edges.size();i++)
-
-        // La fragmentation permet d'ajouter les points de contraintes sur les arêtes tels que définis par la discrétisation 
-        // et récupérés via GMDS
-        gmsh::vectorpair gmsh_entities_dim_tags;
-        gmsh::model::occ::getEntities(gmsh_entities_dim_tags);
-        gmsh_out_dim_tags.clear();
-        std::vector<gmsh::vectorpair> gmsh_out_dim_tags_map;
-        gmsh::model::occ::fragment(gmsh_point_dim_tags, gmsh_entities_dim_tags, gmsh_out_dim_tags, gmsh_out_dim_tags_map);
-
-        gmsh::model::occ::synchronize();
-
-        // On précise à GMSH qu'on veut seulement deux noeuds de maillage sur chaque Line de bord (pour éviter qu'il en ajoute)
-        // L'opération fragment a changé les tags des entités
-        gmsh_entities_dim_tags.clear();
-        gmsh::model::occ::getEntities(gmsh_entities_dim_tags, 1);
-        for (auto gmsh_dim_tag : gmsh_entities_dim_tags)
-        {
-            int gmsh_line_tag = gmsh_dim_tag.second;
-            gmsh::model::mesh::setTransfiniteCurve(gmsh_line_tag, 2);
-        }
-
-        // génération du maillage
-        gmsh::model::mesh::generate(2);
-        std::string error;
-        gmsh::logger::getLastError(error);
-        if (!error.empty()){
-            TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-            message << "GMSH sort en erreur (lastError : "
-                    << error 
-                    << ") pour la face commune topologique "
-                    << fa->getName();
-            throw TkUtil::Exception (message);
-        }
-
-        // récupération du maillage pour le passer de gmsh à gmds
-
-        // Récupérer les éléments de la dimension 2 (triangles, quadrangles, etc.)
-        std::vector<int> gmsh_elt_types;                      // Types des éléments
-        std::vector<std::vector<std::size_t>> gmsh_elt_tags;  // Tags des éléments
-        std::vector<std::vector<std::size_t>> gmsh_elt_node_tags; // Connectivité des éléments (les indices des nœuds)
-        gmsh::model::mesh::getElements(gmsh_elt_types, gmsh_elt_tags, gmsh_elt_node_tags, 2);
-
-        gmds::Mesh& gmds_mesh = getGMDSMesh();
-        // correspondance entre noeuds internes GMSH et GMDS pour éviter les doublons
-        std::map<std::size_t, gmds::TCellID> gmshNodeTag_to_gmdsCellId;
-
-        for (std::size_t i = 0; i < gmsh_elt_types.size(); ++i) {
-            if (gmsh_elt_types[i] == 2) {  // Le type 2 correspond aux triangles linéaires
-#ifdef _DEBUG_MESH
-                std::cout << "Triangles found, number of elements: " << gmsh_elt_tags[i].size() << std::endl;
-#endif
-
-                std::vector<gmds::TCellID>& gmds_fa_node_ids = fa->nodes();
-                std::vector<gmds::TCellID>& gmds_fa_face_ids = fa->faces();
-                for (std::size_t j = 0; j < gmsh_elt_node_tags[i].size(); j += 3) {
-                    for (std::size_t k = 0; k < 3; ++k) {
-                        gmds::TCellID gmds_node_id = -1;
-
-                        std::size_t gmsh_node_tag = gmsh_elt_node_tags[i][j+k];
-                        if (gmshNodeTag_to_gmdsCellId.find(gmsh_node_tag) == gmshNodeTag_to_gmdsCellId.end())
-                        {
-                            // Coordonnées du noeud GMSH
-                            std::vector<double> gmsh_node_coord;
-                            std::vector<double> gmsh_node_parametric_coord;
-                            int dim, tag;
-                            gmsh::model::mesh::getNode(gmsh_node_tag, gmsh_node_coord, gmsh_node_parametric_coord, dim, tag);
-                            Utils::Math::Point gmsh_point(gmsh_node_coord[0], gmsh_node_coord[1], gmsh_node_coord[2]);
-
-                            const double precision = Utils::Math::MgxNumeric::mgxGeomDoubleEpsilon;
-                            
-                            // Recherche du noeud GMDS correspondant
-                            bool gmds_node_found = false;
-                            for (auto gmds_node_id : gmds_node_ids)
-                            {
-                                gmds::Node gmds_node = gmds_mesh.get<gmds::Node>(gmds_node_id);
-                                Utils::Math::Point gmds_point(gmds_node.X(), gmds_node.Y(), gmds_node.Z());
-                                double dist = gmds_point.length(gmsh_point);
-                                if (dist < precision)
-                                {
-                                    gmds_node_found = true;
-                                    gmshNodeTag_to_gmdsCellId[gmsh_node_tag] = gmds_node_id;
-                                    break;
-                                }
-                            }
-
-                            // Le noeud GMDS n'existait pas, il faut le créer
-                            if (!gmds_node_found)
-                            {
-                                gmds_node_id = gmds_mesh.newNode(gmsh_node_coord[0], gmsh_node_coord[1], gmsh_node_coord[2]).id();
-                                gmshNodeTag_to_gmdsCellId[gmsh_node_tag] = gmds_node_id;
-                                gmds_fa_node_ids.push_back(gmds_node_id);
-                                command->addCreatedNode(gmds_node_id);
-                            }
+            gmshPointTag_to_gmshNodeTag[gmsh_point_tag] = gmsh_node_tag;
+            return gmsh_node_tag;
+        };
+
+        for (int gmsh_surface_tag : gmsh_surface_tags[i]){
+            gmsh::vectorpair gmsh_curves_dim_tags;
+            gmsh::model::getBoundary({{2, gmsh_surface_tag}}, gmsh_curves_dim_tags, false, false, false);
+
+            for (auto gmsh_curve_dim_tag : gmsh_curves_dim_tags){
+                int gmsh_curve_tag = std::abs(gmsh_curve_dim_tag.second);
+                if (!gmsh_curves_done.insert(gmsh_curve_tag).second)
+                    continue;
+
+                // extrémités de la courbe suivant son paramétrage
+                std::vector<double> param_min, param_max;
+                gmsh::model::getParametrizationBounds(1, gmsh_curve_tag, param_min, param_max);
+                gmsh::vectorpair gmsh_points_dim_tags;
+                gmsh::model::getBoundary({{1, gmsh_curve_tag}}, gmsh_points_dim_tags, false, false, false);
+                if (gmsh_points_dim_tags.empty())
+                    continue;
+
+                std::size_t extremities[2];
+                for (uint e=0; e<2; e++){
+                    std::vector<double> coord;
+                    gmsh::model::getValue(1, gmsh_curve_tag, {e==0 ? param_min[0] : param_max[0]}, coord);
+                    Utils::Math::Point pt(coord[0], coord[1], coord[2]);
+                    int nearest_point_tag = std::abs(gmsh_points_dim_tags[0].second);
+                    double dist_min = DBL_MAX;
+                    for (auto gmsh_point_dim_tag : gmsh_points_dim_tags){
+                        std::vector<double> coord_pt;
+                        gmsh::model::getValue(0, std::abs(gmsh_point_dim_tag.second), std::vector<double>(), coord_pt);
+                        double dist = pt.length(Utils::Math::Point(coord_pt[0], coord_pt[1], coord_pt[2]));
+                        if (dist < dist_min){
+                            dist_min = dist;
+                            nearest_point_tag = std::abs(gmsh_point_dim_tag.second);
                         }
                     }
+                    extremities[e] = pointNode(nearest_point_tag);
+                }
 
-                    // Création des triangles GMDS
-                    gmds::TCellID n1 = gmshNodeTag_to_gmdsCellId[gmsh_elt_node_tags[i][j]];
-                    gmds::TCellID n2 = gmshNodeTag_to_gmdsCellId[gmsh_elt_node_tags[i][j+1]];
-                    gmds::TCellID n3 = gmshNodeTag_to_gmdsCellId[gmsh_elt_node_tags[i][j+2]];
-                    gmds::Face gmds_triangle = gmds_mesh.newTriangle(n1, n2, n3);
-                    gmds_fa_face_ids.push_back(gmds_triangle.id());
-                    command->addCreatedFace(gmds_triangle.id());
-
-#ifdef _DEBUG_MESH
-                    std::cout<<" triangle: "<<std::endl;
-                    gmds::Node node1 = gmds_mesh.get<gmds::Node>(n1);
-                    gmds::Node node2 = gmds_mesh.get<gmds::Node>(n2);
-                    gmds::Node node3 = gmds_mesh.get<gmds::Node>(n3);
-                    std::cout<<"  node 1 : "<<node1.X()<<", "<<node1.Y()<<", "<<node1.Z()<<std::endl;
-                    std::cout<<"  node 2 : "<<node2.X()<<", "<<node2.Y()<<", "<<node2.Z()<<std::endl;
-                    std::cout<<"  node 3 : "<<node3.X()<<", "<<node3.Y()<<", "<<node3.Z()<<std::endl;
-#endif
+                // noeuds GMDS du bord qui sont sur cette courbe (hors extrémités)
+                double xmin, ymin, zmin, xmax, ymax, zmax;
+                gmsh::model::getBoundingBox(1, gmsh_curve_tag, xmin, ymin, zmin, xmax, ymax, zmax);
+                double tol = std::max(precision, 1e-6*Utils::Math::Point(xmin, ymin, zmin).length(Utils::Math::Point(xmax, ymax, zmax)));
+
+                std::vector<uint> candidates;
+                std::vector<double> candidates_coord;
+                for (uint k=0; k<gmds_node_ids.size(); k++){
+                    const Utils::Math::Point& pt = gmds_node_points[k];
+                    if (gmdsCellId_to_gmshNodeTag.find(gmds_node_ids[k]) != gmdsCellId_to_gmshNodeTag.end())
+                        continue;
+                    if (pt.getX() < xmin-tol || pt.getX() > xmax+tol
+                            || pt.getY() < ymin-tol || pt.getY() > ymax+tol
+                            || pt.getZ() < zmin-tol || pt.getZ() > zmax+tol)
+                        continue;
+                    candidates.push_back(k);
+                    candidates_coord.push_back(pt.getX());
+                    candidates_coord.push_back(pt.getY());
+                    candidates_coord.push_back(pt.getZ());
+                }
 
+                std::vector<std::pair<double, uint> > inner_nodes;
+                if (!candidates.empty()){
+                    std::vector<double> closest_coord, closest_param;
+                    gmsh::model::getClosestPoint(1, gmsh_curve_tag, candidates_coord, closest_coord, closest_param);
+                    for (uint k=0; k<candidates.size(); k++){
+                        Utils::Math::Point closest(closest_coord[3*k], closest_coord[3*k+1], closest_coord[3*k+2]);
+                        if (gmds_node_points[candidates[k]].length(closest) < tol)
+                            inner_nodes.push_back(std::make_pair(closest_param[k], candidates[k]));
+                    }
                 }
-            }
-        }
-        // nettoyage mémoire de ce qui a servi à GMSH
-        gmsh::model::remove();
+                std::sort(inner_nodes.begin(), inner_nodes.end());
+
+                std::vector<std::size_t> inner_tags;
+                std::vector<double> inner_coord;
+                std::vector<double> inner_param;
+                for (auto& inner : inner_nodes){
+                    gmds::TCellID gmds_node_id = gmds_node_ids[inner.second];
+                    const Utils::Math::Point& pt = gmds_node_points[inner.second];
+                    std::size_t gmsh_node_tag = gmshNodeTag_to_gmdsCellId.size();
+                    gmshNodeTag_to_gmdsCellId.push_back(gmds_node_id);
+                    gmdsCellId_to_gmshNodeTag[gmds_node_id] = gmsh_node_tag;
+                    inner_tags.push_back(gmsh_node_tag);
+                    inner_coord.push_back(pt.getX());
+                    inner_coord.push_back(pt.getY());
+                    inner_coord.push_back(pt.getZ());
+                    inner_param.push_back(inner.first);
+                }
+                if (!inner_tags.empty())
+                    gmsh::model::mesh::addNodes(1, gmsh_curve_tag, inner_tags, inner_coord, inner_param);
+
+                // courbe dégénérée (pôle), laissée à GMSH
+                if (inner_tags.empty() && extremities[0] == extremities[1])
+                    continue;
+
+                // segments le long de la courbe
+                std::vector<std::size_t> segments;
+                std::size_t previous = extremities[0];
+                for (std::size_t tag : inner_tags){
+                    segments.push_back(previous);
+                    segments.push_back(tag);
+                    previous = tag;
+                }
+                segments.push_back(previous);
+                segments.push_back(extremities[1]);
+                gmsh::model::mesh::addElementsByType(gmsh_curve_tag, 1, {}, segments);
+            } // end for gmsh_curve_dim_tag
+        } // end for gmsh_surface_tag
+    } // end for i<cofaces.size()
+
+    // génération du maillage
+    gmsh::model::mesh::generate(2);
+    std::string error;
+    gmsh::logger::getLastError(error);
+    if (!error.empty()){
+        TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+        message << "GMSH sort en erreur (lastError : "
+                << error
+                << ") pour la face commune topologique";
+        for (Topo::CoFace* fa : cofaces)
+            message << " " << fa->getName();
+        throw TkUtil::Exception (message);
     }
 
-    std::vector<std::string> group_names;
-    fa->getGroupsName(group_names);
+    // récupération du maillage pour le passer de gmsh à gmds
+    std::size_t max_node_tag = 0;
+    gmsh::model::mesh::getMaxNodeTag(max_node_tag);
+    gmshNodeTag_to_gmdsCellId.resize(max_node_tag+1, gmds::NullID);
+
+    // noeuds des sommets de la géométrie rattachés à au moins une face
+    std::unordered_set<gmds::TCellID> gmds_point_nodes_used;
+
+    for (uint i=0; i<cofaces.size(); i++){
+        Topo::CoFace* fa = cofaces[i];
+        std::vector<gmds::TCellID>& gmds_fa_node_ids = fa->nodes();
+        Topo::MeshCellIds& gmds_fa_face_ids = fa->faces();
+        std::unordered_set<gmds::TCellID> gmds_fa_point_nodes;
+
+        for (int gmsh_surface_tag : gmsh_surface_tags[i]){
+            // les noeuds internes à la surface
+            std::vector<std::size_t> gmsh_node_tags;
+            std::vector<double> gmsh_node_coord;
+            std::vector<double> gmsh_node_parametric_coord;
+            gmsh::model::mesh::getNodes(gmsh_node_tags, gmsh_node_coord, gmsh_node_parametric_coord,
+                    2, gmsh_surface_tag, false, false);
+            for (std::size_t j=0; j<gmsh_node_tags.size(); j++){
+                gmds::TCellID gmds_node_id = gmds_mesh.newNode(gmsh_node_coord[3*j],
+                        gmsh_node_coord[3*j+1], gmsh_node_coord[3*j+2]).id();
+                gmshNodeTag_to_gmdsCellId[gmsh_node_tags[j]] = gmds_node_id;
+                gmds_fa_node_ids.push_back(gmds_node_id);
+                command->addCreatedNode(gmds_node_id);
+            }
 
-#ifdef _DEBUG_GROUP_BY_TOPO_ENTITY
-    // on ajoute un groupe pour distinguer les faces en mode debug
-    group_names.push_back(fa->getName());
+            // Le type 2 correspond aux triangles linéaires
+            std::vector<std::size_t> gmsh_elt_tags;
+            std::vector<std::size_t> gmsh_elt_node_tags;
+            gmsh::model::mesh::getElementsByType(2, gmsh_elt_tags, gmsh_elt_node_tags, gmsh_surface_tag);
+#ifdef _DEBUG_MESH
+            std::cout << "Triangles found, number of elements: " << gmsh_elt_tags.size() << std::endl;
 #endif
+            for (std::size_t j = 0; j < gmsh_elt_node_tags.size(); j += 3) {
+                gmds::TCellID n[3];
+                for (std::size_t k = 0; k < 3; ++k){
+                    n[k] = gmshNodeTag_to_gmdsCellId[gmsh_elt_node_tags[j+k]];
+                    if (n[k] == gmds::NullID){
+                        TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+                        message << "Erreur interne, un noeud du maillage GMSH n'a pas de correspondant GMDS pour la face commune "
+                                << fa->getName();
+                        throw TkUtil::Exception (message);
+                    }
+                    // un sommet de la géométrie peut être partagé par plusieurs faces
+                    if (gmds_point_nodes.find(n[k]) != gmds_point_nodes.end()
+                            && gmds_fa_point_nodes.insert(n[k]).second){
+                        gmds_fa_node_ids.push_back(n[k]);
+                        gmds_point_nodes_used.insert(n[k]);
+                    }
+                }
 
-    // ajout des polygones aux surfaces
-    for (size_t i=0; i<group_names.size(); i++){
-        std::string& nom = group_names[i];
-
-        try {
-            getContext().getMeshManager().getSurface(nom);
-            command->addModifiedSurface(nom);
-        } catch (...) {
-            command->addNewSurface(nom);
-        }
+                // Création des triangles GMDS
+                gmds::Face gmds_triangle = gmds_mesh.newTriangle(n[0], n[1], n[2]);
+                gmds_fa_face_ids.push_back(gmds_triangle.id());
+                command->addCreatedFace(gmds_triangle.id());
+            }
+        } // end for gmsh_surface_tag
+    } // end for i<cofaces.size()
 
-        // la surface de maillage que l'on vient de créer/modifier
-        Mesh::Surface* sf = getContext().getMeshManager().getSurface(nom);
-        sf->saveMeshSurfaceTopoProperty(&command->getInfoCommand());
-        sf->add(fa);
-    } // end for i<group_names.size()
+    // un sommet qui n'est dans aucun triangle (pôle) reste à la face qui l'a créé
+    for (auto& point_node : gmds_point_nodes)
+        if (gmds_point_nodes_used.find(point_node.first) == gmds_point_nodes_used.end())
+            cofaces[point_node.second]->nodes().push_back(point_node.first);
 
-#ifdef _DEBUG_MESH
-    // Inspect the log:
-    std::vector<std::string> log;
-    gmsh::logger::get(log);
-    std::cout << "Logger has recorded " << log.size() << " lines" << std::endl;
-#endif
-
-    gmsh::logger::stop();
-    gmsh::finalize();
+    // nettoyage mémoire de ce qui a servi à GMSH
+    gmsh::model::remove();
+} // end meshDelaunayGMSHBatch
 #endif // USE_GMSH
-} // end meshDelaunayGMSH
-
 /*----------------------------------------------------------------------------*/
 } // end namespace Mesh
 /*----------------------------------------------------------------------------*/
@@ -1002,7 +1002,7 @@ void MeshImplementation::_addRegionsInVolumes(Mesh::CommandCreateMesh* command,
     const uint nbNoeudsK = nbBrasK + 1;
 
     std::vector<gmds::TCellID>& nodes = bl->nodes();
-    std::vector<gmds::TCellID>& elem = bl->regions();
+    Topo::MeshCellIds& elem = bl->regions();
 
 #define nodeIJ(ii,jj,kk) nodes[ii+(jj)*nbNoeudsI+(kk)*nbNoeudsI*nbNoeudsJ]
 
@@ -1404,7 +1404,7 @@ void MeshImplementation::_addFacesInSurfaces(Mesh::CommandCreateMesh* command, T
     const uint nbNoeudsJ = nbBrasJ + 1;
 
     std::vector<gmds::TCellID>& nodes = fa->nodes();
-    std::vector<gmds::TCellID>& elem = fa->faces();
+    Topo::MeshCellIds& elem = fa->faces();
 
     gmds::Mesh& gmds_mesh = getGMDSMesh();
 
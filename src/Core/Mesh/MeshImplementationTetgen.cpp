@@ -7,6 +7,8 @@
 #include <TkUtil/UTF8String.h>
 #include <TkUtil/MemoryError.h>
 /*----------------------------------------------------------------------------*/
+#include <memory>
+/*----------------------------------------------------------------------------*/
 #ifdef USE_TRITON
 #include "Triton2/TetgenInterface/TetgenFacade.h"
 #include "Topo/BlockMeshingPropertyDelaunayTetgen.h"
@@ -17,307 +19,377 @@ namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
 namespace Mesh {
 /*----------------------------------------------------------------------------*/
+#ifdef USE_TRITON
+/**
+ * Bord d'un bloc transmis à sa propre instance de Tetgen, avec les pyramides
+ * créées sur ses faces structurées.
+ */
+struct TetgenBlockInput
+{
+	TetgenBlockInput (Topo::Block* bl, const std::string& params)
+		: m_block (bl), m_params (params), m_nodes ( ), m_pyramids ( ), m_tetgen ( )
+	{ }
+
+	Topo::Block*				m_block;
+	std::string					m_params;
+	/// les noeuds du bord, dans l'ordre transmis à Tetgen
+	std::vector<gmds::Node>		m_nodes;
+	/// les pyramides créées sur les faces structurées
+	std::vector<gmds::Region>	m_pyramids;
+	triton::TetgenFacade		m_tetgen;
+};	// struct TetgenBlockInput
+/*----------------------------------------------------------------------------*/
+/// le message d'erreur correspondant à un code d'erreur levé par Tetgen
+static TkUtil::UTF8String tetgenErrorMessage (int errorCode, Topo::Block* bl)
+{
+	TkUtil::UTF8String	error (TkUtil::Charset::UTF_8);
+	error << "Erreur interne, dans Tetgen: ";
+	if (errorCode == 1){
+		error << "mémoire insuffisante";
+	}
+	else if (errorCode == 2){
+		error << "bug connu de Tetgen";
+	}
+	else if (errorCode == 3){
+		error << "A self-intersection was detected. Program stopped. Input error";
+	}
+	else if (errorCode == 4){
+		error << "A very small input feature size was detected. Program stopped. Try to set smaller tolerance (-T option). Possible input error";
+	}
+	else if (errorCode == 5){
+		error << "Two very close input facets were detected. Program stopped.Try -Y option to avoid adding Steiner points in boundary. Possible input error";
+	}
+	else if (errorCode == 10){
+		error << "An input error was detected Program stopped.";
+	}
+	else {
+		error << "non documenté";
+	}
+	error << ", pour le bloc topologique "<<bl->getName();
+	return error;
+}
+/*----------------------------------------------------------------------------*/
+/**
+ * Marque de noeuds GMDS réservée pendant la durée de vie de l'instance. Les
+ * noeuds restés marqués (exception levée en cours de parcours) sont démarqués
+ * avant que la marque ne soit libérée.
+ */
+class GMDSNodeMark
+{
+	public :
+
+	GMDSNodeMark (gmds::Mesh& mesh)
+		: _mesh (mesh), _mark (mesh.newMark<gmds::Node> ( ))
+	{ }
+	~GMDSNodeMark ( )
+	{
+		_mesh.unmarkAll<gmds::Node> (_mark);
+		_mesh.freeMark<gmds::Node> (_mark);
+	}
+
+	int getMark ( ) const
+	{ return _mark; }
+
+
+	private :
+
+	GMDSNodeMark (const GMDSNodeMark&);
+	GMDSNodeMark& operator = (const GMDSNodeMark&);
+
+	gmds::Mesh&		_mesh;
+	const int		_mark;
+};	// class GMDSNodeMark
+#endif	// USE_TRITON
+/*----------------------------------------------------------------------------*/
 void MeshImplementation::
 meshDelaunayTetgen(Mesh::CommandCreateMesh* command, Topo::Block* bl)
+{
+    std::vector<Topo::Block*> blocks;
+    blocks.push_back(bl);
+    meshDelaunayTetgen(command, blocks);
+} // end meshDelaunayTetgen(Block*)
+/*----------------------------------------------------------------------------*/
+void MeshImplementation::
+meshDelaunayTetgen(Mesh::CommandCreateMesh* command, std::vector<Topo::Block*>& blocks)
 {
 #ifdef USE_TRITON
+    //============================================================================
+    // RECUPERATION DU BORD DE CHACUN DES BLOCS, LES PYRAMIDES SONT CREEES DANS
+    // LE MAILLAGE GMDS
+    //============================================================================
+    std::vector<std::unique_ptr<TetgenBlockInput> > inputs;
+    GMDSNodeMark mark (getGMDSMesh());
+    const int node_mark = mark.getMark();
+
+    for (Topo::Block* bl : blocks){
 #ifdef _DEBUG_MESH
-    std::cout <<"Maillage du bloc "<<bl->getName()<<" avec la méthode de Delaunay (version Tetgen)"<<std::endl;
+        std::cout <<"Maillage du bloc "<<bl->getName()<<" avec la méthode de Delaunay (version Tetgen)"<<std::endl;
 #endif
 
-    // TODO [FL] TEMPORAIRE POUR LES PYRAMIDES
-    std::vector<Topo::Vertex* > topo_vertices = bl->getVertices();
-    double x=0, y=0, z=0;
-    for(unsigned int i=0;i<topo_vertices.size();i++){
-        Topo::Vertex*  vi = topo_vertices[i];
-        x+=vi->getX();
-        y+=vi->getY();
-        z+=vi->getZ();
-    }
-    x/=topo_vertices.size();
-    y/=topo_vertices.size();
-    z/=topo_vertices.size();
-    gmds::math::Point block_center(x,y,z);
-    // on recupere les faces topologiques
-    std::vector<Topo::Face* > faces = bl->getFaces();
-    std::vector<std::vector<gmds::Face> > mesh_faces;
-    std::vector<gmds::Face> mesh_faces_in1Surf;
-    std::vector<gmds::Node> mesh_nodes;
-    int node_mark = getGMDSMesh().newMark<gmds::Node>();
+        // TODO [FL] TEMPORAIRE POUR LES PYRAMIDES
+        std::vector<Topo::Vertex* > topo_vertices = bl->getVertices();
+        double x=0, y=0, z=0;
+        for(unsigned int i=0;i<topo_vertices.size();i++){
+            Topo::Vertex*  vi = topo_vertices[i];
+            x+=vi->getX();
+            y+=vi->getY();
+            z+=vi->getZ();
+        }
+        x/=topo_vertices.size();
+        y/=topo_vertices.size();
+        z/=topo_vertices.size();
+        gmds::math::Point block_center(x,y,z);
+        // on recupere les faces topologiques
+        std::vector<Topo::Face* > faces = bl->getFaces();
+        std::vector<std::vector<gmds::Face> > mesh_faces;
 
-    std::vector<gmds::Region> pyramids;
+        Topo::BlockMeshingPropertyDelaunayTetgen* meshingProp =
+        		dynamic_cast<Topo::BlockMeshingPropertyDelaunayTetgen*>(bl->getBlockMeshingProperty());
+        CHECK_NULL_PTR_ERROR(meshingProp);
 
-    Topo::BlockMeshingPropertyDelaunayTetgen* meshingProp =
-    		dynamic_cast<Topo::BlockMeshingPropertyDelaunayTetgen*>(bl->getBlockMeshingProperty());
-    CHECK_NULL_PTR_ERROR(meshingProp);
+        inputs.emplace_back(new TetgenBlockInput(bl, meshingProp->serializeParameters().ascii()));
+        TetgenBlockInput& input = *inputs.back();
+        std::vector<gmds::Node>& mesh_nodes = input.m_nodes;
+        std::vector<gmds::Region>& pyramids = input.m_pyramids;
 
-    double ratio_hauteur_pyramides = meshingProp->getRatioPyramidSize();
+        double ratio_hauteur_pyramides = meshingProp->getRatioPyramidSize();
 
-   for(unsigned int i=0;i<faces.size();i++){
-        std::vector<Topo::CoFace* > cofaces = faces[i]->getCoFaces();
-        for(unsigned int k=0;k<cofaces.size();k++){
+        for(unsigned int i=0;i<faces.size();i++){
+            std::vector<Topo::CoFace* > cofaces = faces[i]->getCoFaces();
+            for(unsigned int k=0;k<cofaces.size();k++){
 
-            std::vector<gmds::Face> local_mesh_faces;
+                std::vector<gmds::Face> local_mesh_faces;
 
-            // pour chaque face topologique, on regarde si la face est maille en triangles
-            // Si oui, on ne fait rien, sinon, on ajoute des pyramides. Dans les
-            // 2 cas, on remplit une structure pour le maillage via netgen
+                // pour chaque face topologique, on regarde si la face est maille en triangles
+                // Si oui, on ne fait rien, sinon, on ajoute des pyramides. Dans les
+                // 2 cas, on remplit une structure pour le maillage via netgen
 
-            std::vector<gmds::TCellID> face_elem = cofaces[k]->faces();
+                const Topo::MeshCellIds& face_elem = cofaces[k]->faces();
 #ifdef _DEBUG_MESH
-            std::cout<<"NB FACES FOR COFACE "<<k<<" -> "<<face_elem.size()<<std::endl;
+                std::cout<<"NB FACES FOR COFACE "<<k<<" -> "<<face_elem.size()<<std::endl;
 #endif
-            if (cofaces[k]->isStructured()){
+                if (cofaces[k]->isStructured()){
 #ifdef _DEBUG_MESH
-            	std::cout<<"--> Surface de contact entre maillages hex. et tet."<<std::endl;
+                	std::cout<<"--> Surface de contact entre maillages hex. et tet."<<std::endl;
 #endif
-            	// on cree 1 pyramide dans le maillage
-            	bool withPyramides = true;
-            	for(unsigned int j=0;j<face_elem.size();j++){
-            		gmds::Face q = getGMDSMesh().get<gmds::Face>(face_elem[j]);
-            		if (q.type() == gmds::GMDS_QUAD){
-            			// q est un QUAD
-            			std::vector<gmds::Node> nodes = q.getAll<gmds::Node>();
-
-            			gmds::Node n1 = nodes[0];
-            			gmds::Node n2 = nodes[1];
-            			gmds::Node n3 = nodes[3];
-            			gmds::Node n4 = nodes[2];
-
-            			if(!withPyramides){
-            				gmds::Face t1 = getGMDSMesh().newTriangle(n1,n2,n3);
-            				gmds::Face t2 = getGMDSMesh().newTriangle(n2,n3,n4);
-            				local_mesh_faces.push_back(t1);
-            				local_mesh_faces.push_back(t2);
-            				mesh_faces_in1Surf.push_back(t1);
-            				mesh_faces_in1Surf.push_back(t2);
-            			}
-            			else {
-            				gmds::math::Vector3d v1({n2.X()-n1.X(),
-            						n2.Y()-n1.Y(),
-            						n2.Z()-n1.Z()});
-
-            				gmds::math::Vector3d v3({n3.X()-n1.X(),
-            						n3.Y()-n1.Y(),
-            						n3.Z()-n1.Z()});
-
-            				gmds::math::Vector3d nq = ratio_hauteur_pyramides*(v1.cross(v3));
-            				gmds::math::Vector3d ref({block_center.X()-n1.X(),
-            						block_center.Y()-n1.Y(),
-            						block_center.Z()-n1.Z()});
-
-            				gmds::Node p0, p1, p2,  p3, p4;
-            				if(nq.dot(ref)>0.0){
-            					// on suit le sens direct de la maille
-            					p0=nodes[0];
-            					p1=nodes[1];
-            					p2=nodes[2];
-            					p3=nodes[3];
-            					gmds::math::Vector3d center = vec(q.center());
-            					p4 = getGMDSMesh().newNode(
-            							center.X()+nq[0],
-            							center.Y()+nq[1],
-            							center.Z()+nq[2]);
-            				}
-            				else{
-            					//on inverse
-            					p0=nodes[0];
-            					p1=nodes[3];
-            					p2=nodes[2];
-            					p3=nodes[1];
-            					gmds::math::Vector3d center = vec(q.center());
-            					p4 = getGMDSMesh().newNode(center.X()-nq[0],
-            							center.Y()-nq[1],
-            							center.Z()-nq[2]);
-            				}
-
-            				pyramids.push_back(getGMDSMesh().newPyramid(p0,p1,p2,p3,p4));
-
-            				gmds::Face t1 = getGMDSMesh().newTriangle(p0,p1,p4);
-            				gmds::Face t2 = getGMDSMesh().newTriangle(p1,p2,p4);
-            				gmds::Face t3 = getGMDSMesh().newTriangle(p2,p3,p4);
-            				gmds::Face t4 = getGMDSMesh().newTriangle(p3,p0,p4);
-            				local_mesh_faces.push_back(t1);
-            				local_mesh_faces.push_back(t2);
-            				local_mesh_faces.push_back(t3);
-            				local_mesh_faces.push_back(t4);
-
-            				mesh_faces_in1Surf.push_back(t1);
-            				mesh_faces_in1Surf.push_back(t2);
-            				mesh_faces_in1Surf.push_back(t3);
-            				mesh_faces_in1Surf.push_back(t4);
-            				mesh_nodes.push_back(p4);
-            				getGMDSMesh().mark(p4,node_mark);
-            			}
-            		} // end if (q.getType() == gmds::GMDS_QUAD)
-            		else {
-            			local_mesh_faces.push_back(q);
-            			mesh_faces_in1Surf.push_back(q);
-            		}
-                } // for j
-            } // if ... transfini
-            else{
-                for(unsigned int j=0;j<face_elem.size();j++){
-                    local_mesh_faces.push_back(getGMDSMesh().get<gmds::Face>(face_elem[j]));
-                    mesh_faces_in1Surf.push_back(getGMDSMesh().get<gmds::Face>(face_elem[j]));
+                	// on cree 1 pyramide dans le maillage
+                	bool withPyramides = true;
+                	for(unsigned int j=0;j<face_elem.size();j++){
+                		gmds::Face q = getGMDSMesh().get<gmds::Face>(face_elem[j]);
+                		if (q.type() == gmds::GMDS_QUAD){
+                			// q est un QUAD
+                			std::vector<gmds::Node> nodes = q.getAll<gmds::Node>();
+
+                			gmds::Node n1 = nodes[0];
+                			gmds::Node n2 = nodes[1];
+                			gmds::Node n3 = nodes[3];
+                			gmds::Node n4 = nodes[2];
+
+                			if(!withPyramides){
+                				gmds::Face t1 = getGMDSMesh().newTriangle(n1,n2,n3);
+                				gmds::Face t2 = getGMDSMesh().newTriangle(n2,n3,n4);
+                				local_mesh_faces.push_back(t1);
+                				local_mesh_faces.push_back(t2);
+                			}
+                			else {
+                				gmds::math::Vector3d v1({n2.X()-n1.X(),
+                						n2.Y()-n1.Y(),
+                						n2.Z()-n1.Z()});
+
+                				gmds::math::Vector3d v3({n3.X()-n1.X(),
+                						n3.Y()-n1.Y(),
+                						n3.Z()-n1.Z()});
+
+                				gmds::math::Vector3d nq = ratio_hauteur_pyramides*(v1.cross(v3));
+                				gmds::math::Vector3d ref({block_center.X()-n1.X(),
+                						block_center.Y()-n1.Y(),
+                						block_center.Z()-n1.Z()});
+
+                				gmds::Node p0, p1, p2,  p3, p4;
+                				if(nq.dot(ref)>0.0){
+                					// on suit le sens direct de la maille
+                					p0=nodes[0];
+                					p1=nodes[1];
+                					p2=nodes[2];
+                					p3=nodes[3];
+                					gmds::math::Vector3d center = vec(q.center());
+                					p4 = getGMDSMesh().newNode(
+                							center.X()+nq[0],
+                							center.Y()+nq[1],
+                							center.Z()+nq[2]);
+                				}
+                				else{
+                					//on inverse
+                					p0=nodes[0];
+                					p1=nodes[3];
+                					p2=nodes[2];
+                					p3=nodes[1];
+                					gmds::math::Vector3d center = vec(q.center());
+                					p4 = getGMDSMesh().newNode(center.X()-nq[0],
+                							center.Y()-nq[1],
+                							center.Z()-nq[2]);
+                				}
+
+                				pyramids.push_back(getGMDSMesh().newPyramid(p0,p1,p2,p3,p4));
+
+                				gmds::Face t1 = getGMDSMesh().newTriangle(p0,p1,p4);
+                				gmds::Face t2 = getGMDSMesh().newTriangle(p1,p2,p4);
+                				gmds::Face t3 = getGMDSMesh().newTriangle(p2,p3,p4);
+                				gmds::Face t4 = getGMDSMesh().newTriangle(p3,p0,p4);
+                				local_mesh_faces.push_back(t1);
+                				local_mesh_faces.push_back(t2);
+                				local_mesh_faces.push_back(t3);
+                				local_mesh_faces.push_back(t4);
+
+                				mesh_nodes.push_back(p4);
+                				getGMDSMesh().mark(p4,node_mark);
+                			}
+                		} // end if (q.getType() == gmds::GMDS_QUAD)
+                		else {
+                			local_mesh_faces.push_back(q);
+                		}
+                    } // for j
+                } // if ... transfini
+                else{
+                    local_mesh_faces.reserve(face_elem.size());
+                    for(unsigned int j=0;j<face_elem.size();j++)
+                        local_mesh_faces.push_back(getGMDSMesh().get<gmds::Face>(face_elem[j]));
                 }
-            }
 #ifdef _DEBUG_MESH
-            std::cout<<"NB LOC FACES -> "<<local_mesh_faces.size()<<std::endl;
+                std::cout<<"NB LOC FACES -> "<<local_mesh_faces.size()<<std::endl;
 #endif
 
-            mesh_faces.push_back(local_mesh_faces);
-            // on recupere toutes les faces
-            // on recupere les noeuds qui n'ont pas deja ete recuperes
-            for(unsigned int j=0;j<local_mesh_faces.size();j++){
-                std::vector<gmds::Node> local_nodes =local_mesh_faces[j].getAll<gmds::Node>();
-                for(unsigned int k=0;k<local_nodes.size();k++){
-                    gmds::Node n =local_nodes[k];
-                    if(getGMDSMesh().isMarked(n,node_mark))
-                        continue;
-
-                    mesh_nodes.push_back(n);
-                    getGMDSMesh().mark(n,node_mark);
+                // on recupere les noeuds qui n'ont pas deja ete recuperes
+                for(unsigned int j=0;j<local_mesh_faces.size();j++){
+                    std::vector<gmds::Node> local_nodes =local_mesh_faces[j].getAll<gmds::Node>();
+                    for(unsigned int k=0;k<local_nodes.size();k++){
+                        gmds::Node n =local_nodes[k];
+                        if(getGMDSMesh().isMarked(n,node_mark))
+                            continue;
+
+                        mesh_nodes.push_back(n);
+                        getGMDSMesh().mark(n,node_mark);
+                    }
                 }
-            }
-        } // end for k<cofaces.size()
-    } // end for i<faces.size()
-
-    //============================================================================
-    // LE MAILLAGE DES FACES AU BORD A ETE RECUPERE, ON MAILLE MAINTENANT LE
-    // VOLUME
-    //============================================================================
-    for(unsigned int i=0;i<mesh_nodes.size();i++){
-        getGMDSMesh().unmark(mesh_nodes[i],node_mark);
-    }
-    getGMDSMesh().freeMark<gmds::Node>(node_mark);
+                mesh_faces.push_back(local_mesh_faces);
+            } // end for k<cofaces.size()
+        } // end for i<faces.size()
 
-
-    std::vector<gmds::Region> newRegions;
-    std::vector<gmds::Node> newNodes;
+        for(unsigned int i=0;i<mesh_nodes.size();i++){
+            getGMDSMesh().unmark(mesh_nodes[i],node_mark);
+        }
 
 #ifdef _DEBUG_MESH
-    std::cout<<"BEFORE TETGEN- Nb Nodes, nb faces (outer), nb regions :"<<getGMDSMesh().getNbNodes()
-            <<" "<<mesh_faces_in1Surf.size()
-            <<" "<<getGMDSMesh().getNbRegions()<<std::endl;
+        std::cout<<"BEFORE TETGEN- Nb Nodes, nb regions :"<<getGMDSMesh().getNbNodes()
+                <<" "<<getGMDSMesh().getNbRegions()<<std::endl;
 #endif
-    triton::TetgenFacade tetgen_caller;
+        // chaque bloc a sa propre instance de Tetgen, numérotation compacte des
+        // noeuds du bord et une facette par surface plane
+        input.m_tetgen.buildTetgenInput(mesh_nodes, mesh_faces);
+    } // end for bl : blocks
 
-    std::string meshParams = meshingProp->serializeParameters().ascii();
-    try
-    {
-        tetgen_caller.generateTetMesh(mesh_nodes,mesh_faces,newNodes,newRegions,getGMDSMesh(),meshParams);
-    }
-    catch (int errorCode) // we should call terminatetetgen
-    {
-		TkUtil::UTF8String	error (TkUtil::Charset::UTF_8);
-        error << "Erreur interne, dans Tetgen: ";
-        if (errorCode == 1){
-            error << "mémoire insuffisante";
-        }
-        else if (errorCode == 2){
-            error << "bug connu de Tetgen";
-        }
-        else if (errorCode == 3){
-            error << "A self-intersection was detected. Program stopped. Input error";
-        }
-        else if (errorCode == 4){
-        	error << "A very small input feature size was detected. Program stopped. Try to set smaller tolerance (-T option). Possible input error";
-        }
-        else if (errorCode == 5){
-        	error << "Two very close input facets were detected. Program stopped.Try -Y option to avoid adding Steiner points in boundary. Possible input error";
-        }
-        else if (errorCode == 10){
-        	error << "An input error was detected Program stopped.";
+    //============================================================================
+    // LE MAILLAGE DES FACES AU BORD A ETE RECUPERE, ON MAILLE MAINTENANT LES
+    // VOLUMES, UN BLOC APRES L'AUTRE : tetrahedralize n'est pas réentrant
+    // (cf TetgenFacade)
+    //============================================================================
+    for (std::unique_ptr<TetgenBlockInput>& input : inputs) {
+        try
+        {
+            input->m_tetgen.runTetgen(input->m_params);
         }
-        else {
-            error << "non documenté";
+        catch (int errorCode) // we should call terminatetetgen
+        {
+            throw TkUtil::Exception (tetgenErrorMessage(errorCode, input->m_block));
         }
-        error << ", pour le bloc topologique "<<bl->getName();
-
-        throw TkUtil::Exception (error);
     }
 
+    //============================================================================
+    // INSERTION DES TETRAEDRES DANS LE MAILLAGE GMDS, BLOC PAR BLOC
+    //============================================================================
+    for (std::unique_ptr<TetgenBlockInput>& input : inputs) {
+        Topo::Block* bl = input->m_block;
 
-//    triton::NetgenParams params;
-//    params.fineness = 0.8;
-//    params.grading = 0.1;
-//    params.closeedgefact=1.0;
-//
-//    triton::NetgenFacade<TMask> tetgen_caller;
-//    tetgen_caller.generateTetMesh(mesh_nodes, mesh_faces_in1Surf,
-//            newNodes,newRegions,getGMDSMesh() ,params);
+        std::vector<gmds::Region> newRegions;
+        std::vector<gmds::Node> newNodes;
+        input->m_tetgen.fillGMDSOutput(getGMDSMesh(), input->m_nodes, newNodes, newRegions);
+        std::vector<gmds::Region>& pyramids = input->m_pyramids;
 
 #ifdef _DEBUG_MESH
-    std::cout<<"newNodes = "<<newNodes.size()<<", newRegions = "<<newRegions.size()<<std::endl;
-    std::cout<<"AFTER TETGEN- Nb Nodes, nb elems :"<<getGMDSMesh().getNbNodes()<<" "<<getGMDSMesh().getNbRegions()<<std::endl;
+        std::cout<<"newNodes = "<<newNodes.size()<<", newRegions = "<<newRegions.size()<<std::endl;
+        std::cout<<"AFTER TETGEN- Nb Nodes, nb elems :"<<getGMDSMesh().getNbNodes()<<" "<<getGMDSMesh().getNbRegions()<<std::endl;
 #endif
 
-    std::vector<gmds::TCellID>& nodes = bl->nodes();
-    std::vector<gmds::TCellID>& elem = bl->regions();
+        std::vector<gmds::TCellID>& nodes = bl->nodes();
+        Topo::MeshCellIds& elem = bl->regions();
+        nodes.reserve(nodes.size()+newNodes.size());
+        elem.reserve(elem.size()+newRegions.size()+pyramids.size());
 
-    for(unsigned int i=0;i<newNodes.size();i++){
-        gmds::Node  n = newNodes[i];
-        nodes.push_back(n.id());
-        command->addCreatedNode(n.id());
-    }
-    for(unsigned int i=0;i<newRegions.size();i++){
-        gmds::Region r = newRegions[i];
-        elem.push_back(r.id());
-        command->addCreatedRegion(r.id());
-    }
+        for(unsigned int i=0;i<newNodes.size();i++){
+            gmds::Node  n = newNodes[i];
+            nodes.push_back(n.id());
+            command->addCreatedNode(n.id());
+        }
+        for(unsigned int i=0;i<newRegions.size();i++){
+            gmds::Region r = newRegions[i];
+            elem.push_back(r.id());
+            command->addCreatedRegion(r.id());
+        }
 
-    for(unsigned int i=0;i<pyramids.size();i++){
-        gmds::Region r = pyramids[i];
-        elem.push_back(r.id());
-        command->addCreatedRegion(r.id());
-    }
+        for(unsigned int i=0;i<pyramids.size();i++){
+            gmds::Region r = pyramids[i];
+            elem.push_back(r.id());
+            command->addCreatedRegion(r.id());
+        }
 
+        // la sortie de Tetgen n'est plus utile
+        input.reset();
 
-    // ajout des polyedres aux volumes
+        // ajout des polyedres aux volumes
 
-    std::vector<std::string> groupsName;
-    bl->getGroupsName(groupsName);
+        std::vector<std::string> groupsName;
+        bl->getGroupsName(groupsName);
 
 
 #ifdef _DEBUG_GROUP_BY_TOPO_ENTITY
-    // on ajoute un groupe pour distinguer les blocs en mode debug
-    if (groupsName.empty()){
-        groupsName.push_back(bl->getName());
-		TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
-        message1 <<"Le bloc "<<bl->getName()<<" n'a pas de groupe pour les mailles";
-        getContext().getLogStream()->log (TkUtil::TraceLog (message1, TkUtil::Log::ERROR));
-    }
+        // on ajoute un groupe pour distinguer les blocs en mode debug
+        if (groupsName.empty()){
+            groupsName.push_back(bl->getName());
+    		TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
+            message1 <<"Le bloc "<<bl->getName()<<" n'a pas de groupe pour les mailles";
+            getContext().getLogStream()->log (TkUtil::TraceLog (message1, TkUtil::Log::ERROR));
+        }
 #endif
 
-    for (size_t i=0; i<groupsName.size(); i++){
+        for (size_t i=0; i<groupsName.size(); i++){
 
-        std::string& nom = groupsName[i];
+            std::string& nom = groupsName[i];
 
-        bool isNewVolume = false;
-        try {
-            getContext().getMeshManager().getVolume(nom);
-            command->addModifiedVolume(nom);
-        } catch (...) {
-            command->addNewVolume(nom);
-            isNewVolume = true;
-        }
-        // le volume de maillage que l'on vient de créer/modifier
-        Mesh::Volume* vol = getContext().getMeshManager().getVolume(nom);
-        vol->add(bl);
+            bool isNewVolume = false;
+            try {
+                getContext().getMeshManager().getVolume(nom);
+                command->addModifiedVolume(nom);
+            } catch (...) {
+                command->addNewVolume(nom);
+                isNewVolume = true;
+            }
+            // le volume de maillage que l'on vient de créer/modifier
+            Mesh::Volume* vol = getContext().getMeshManager().getVolume(nom);
+            vol->add(bl);
 
-        if (isNewVolume)
-            getContext().newGraphicalRepresentation (*vol);
+            if (isNewVolume)
+                getContext().newGraphicalRepresentation (*vol);
 #ifdef _DEBUG_MESH
-        std::cout<<"AJOUT DU BLOC"<<std::endl;
+            std::cout<<"AJOUT DU BLOC"<<std::endl;
 #endif
-    } // end for i<groupsName.size()
+        } // end for i<groupsName.size()
+    } // end for input : inputs
 
 #else
     throw TkUtil::Exception (TkUtil::UTF8String ("meshDelaunayTetgen non actif, USE_TRITON à activer", TkUtil::Charset::UTF_8));
 #endif
 
-} // end meshDelaunayTetgen(Block*)
+} // end meshDelaunayTetgen(std::vector<Block*>&)
 /*----------------------------------------------------------------------------*/
 //void MeshImplementation::_addFacesInSurfacesForDelaunay(Mesh::CommandCreateMesh* command, Topo::CoFace* fa)
 //{
@@ -1,5 +1,6 @@
 /*----------------------------------------------------------------------------*/
 #include "Internal/Context.h"
+#include "Utils/Common.h"
 #include "Internal/M3DCommandResult.h"
 #include "Utils/CommandManager.h"
 #include "Mesh/MeshManager.h"
@@ -14,10 +15,14 @@
 #include "Mesh/CommandWriteCGNS.h"
 #include "Mesh/CommandModifyMesh.h"
 #include "Mesh/CommandExportBlocksForCGNS.h"
+#include "Mesh/Surface.h"
+#include "Mesh/Volume.h"
 #include "Mesh/SubVolume.h"
 #include "Mesh/CommandCreateSubVolumeBetweenSheets.h"
 #include "Topo/Block.h"
 /*----------------------------------------------------------------------------*/
+#include <unordered_map>
+/*----------------------------------------------------------------------------*/
 #include <TkUtil/Exception.h>
 #include <TkUtil/MemoryError.h>
 #include <TkUtil/TraceLog.h>
@@ -189,9 +194,7 @@ Mgx3D::Internal::M3DCommandResult* MeshManager::newBlocksMesh(std::vector<std::s
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* MeshManager::newBlocksMesh(std::vector<Mgx3D::Topo::Block*>& blocks)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message <<"MeshManager::newBlocksMesh( liste de "<<blocks.size()<<" blocs )";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_5));
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_5, "MeshManager::newBlocksMesh( liste de "<<blocks.size()<<" blocs )");
 
     Mesh::CommandNewBlocksMesh* command = new Mesh::CommandNewBlocksMesh(getContext(), blocks, 0);
 
@@ -222,9 +225,7 @@ Mgx3D::Internal::M3DCommandResult* MeshManager::newFacesMesh(std::vector<std::st
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* MeshManager::newFacesMesh(std::vector<Mgx3D::Topo::CoFace*>& faces)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message <<"MeshManager::newFacesMesh( liste de "<<faces.size()<<" faces )";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_5));
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_5, "MeshManager::newFacesMesh( liste de "<<faces.size()<<" faces )");
 
     Mesh::CommandNewFacesMesh* command = new Mesh::CommandNewFacesMesh(getContext(), faces, 0);
 
@@ -247,9 +248,7 @@ Mgx3D::Internal::M3DCommandResult* MeshManager::newFacesMesh(std::vector<Mgx3D::
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* MeshManager::newAllBlocksMesh()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message <<"MeshManager::newAllBlocksMesh()";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_5));
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_5, "MeshManager::newAllBlocksMesh()");
 
     Mesh::CommandNewBlocksMesh* command = new Mesh::CommandNewBlocksMesh(getContext(),0);
 
@@ -266,9 +265,7 @@ Mgx3D::Internal::M3DCommandResult* MeshManager::newAllBlocksMesh()
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* MeshManager::newAllFacesMesh()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message <<"MeshManager::newAllFacesMesh()";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_5));
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_5, "MeshManager::newAllFacesMesh()");
 
     Mesh::CommandNewFacesMesh* command = new Mesh::CommandNewFacesMesh(getContext(),0);
 
@@ -300,9 +297,7 @@ Mgx3D::Internal::M3DCommandResult*
 MeshManager::newSubVolumeBetweenSheets(std::vector<Mgx3D::Topo::Block*>& blocks, Topo::CoEdge* coedge,
 		int pos1, int pos2, std::string groupName)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"MeshManager::newSubVolumeBetweenSheets( liste de "<<blocks.size()<<" blocs )";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_5));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_5, "MeshManager::newSubVolumeBetweenSheets( liste de "<<blocks.size()<<" blocs )");
 
     Mesh::CommandCreateSubVolumeBetweenSheets* command =
     		new Mesh::CommandCreateSubVolumeBetweenSheets(getContext(), blocks, coedge, pos1, pos2, groupName);
@@ -353,14 +348,17 @@ void MeshManager::writeMli(std::string nom)
     getCommandManager().addCommand(command, Utils::Command::DO);
 }
 /*----------------------------------------------------------------------------*/
-void MeshManager::writeVTK(std::string nom)
+void MeshManager::writeVTK(std::string nom, bool compressed)
 {
     // création de la commande d'écriture du maillage
-    CommandWriteVTK* command = new CommandWriteVTK(getContext(), nom);
+    CommandWriteVTK* command = new CommandWriteVTK(getContext(), nom, compressed);
 
     // trace dans le script
     TkUtil::UTF8String cmd (TkUtil::Charset::UTF_8);
-    cmd << getContextAlias() << "." << "getMeshManager().writeVTK(\"" << nom << "\")";
+    cmd << getContextAlias() << "." << "getMeshManager().writeVTK(\"" << nom << "\"";
+    if (compressed)
+        cmd << ", True";
+    cmd << ")";
     command->setScriptCommand(cmd);
 
     getCommandManager().addCommand(command, Utils::Command::DO);
@@ -402,7 +400,10 @@ bool MeshManager::compareWithMesh(std::string nom)
     uint id = mesh->createNewGMDSMesh();
     gmds::Mesh& gmdsMesh2 = mesh->getGMDSMesh(id);
 
-    mesh->readMli(nom, id);
+    if (nom.substr(nom.find_last_of('.')+1) == "vtu")
+        mesh->readVTK(nom, id);
+    else
+        mesh->readMli(nom, id);
 
     // on ajoute les groupes de mailles de gmds
     mesh->createGMDSGroups();
@@ -499,11 +500,75 @@ int MeshManager::getNbRegions()
     return getMesh()->getNbRegions();
 }
 /*----------------------------------------------------------------------------*/
+void MeshManager::getNodesAndCells(const std::string& name, int dim,
+        std::vector<double>& coords, std::vector<long>& cells,
+        std::vector<long>* gmdsIds) const
+{
+    coords.clear();
+    cells.clear();
+    if (gmdsIds)
+        gmdsIds->clear();
+
+    // les ids GMDS des noeuds de chacune des mailles, dans l'ordre des mailles
+    std::vector<gmds::TCellID> cellNodes;
+    std::vector<size_t> cellSizes;
+    if (dim == 2){
+        std::vector<gmds::Face> faces;
+        getSurface(name, true)->getGMDSFaces(faces);
+        cellSizes.reserve(faces.size());
+        cellNodes.reserve(4*faces.size());
+        for (const gmds::Face& f : faces){
+            std::vector<gmds::TCellID> ids = f.getIDs<gmds::Node>();
+            cellSizes.push_back(ids.size());
+            cellNodes.insert(cellNodes.end(), ids.begin(), ids.end());
+        }
+    }
+    else if (dim == 3){
+        std::vector<gmds::Region> regions;
+        getVolume(name, true)->getGMDSRegions(regions);
+        cellSizes.reserve(regions.size());
+        cellNodes.reserve(8*regions.size());
+        for (const gmds::Region& r : regions){
+            std::vector<gmds::TCellID> ids = r.getIDs<gmds::Node>();
+            cellSizes.push_back(ids.size());
+            cellNodes.insert(cellNodes.end(), ids.begin(), ids.end());
+        }
+    }
+    else {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "MeshManager::getNodesAndCells, dimension " << (long)dim
+                << " non prévue (2 pour une surface, 3 pour un volume)";
+        throw TkUtil::Exception(message);
+    }
+
+    const gmds::Mesh& gmdsMesh = getMesh()->getGMDSMesh();
+
+    // renumérotation locale des noeuds, dans l'ordre de première apparition
+    std::unordered_map<gmds::TCellID, long> node2id;
+    node2id.reserve(cellNodes.size()/4+1);
+    cells.reserve(cellSizes.size()+cellNodes.size());
+    size_t pos = 0;
+    for (size_t nb : cellSizes){
+        cells.push_back((long)nb);
+        for (size_t j=0; j<nb; j++, pos++){
+            gmds::TCellID id = cellNodes[pos];
+            auto res = node2id.emplace(id, (long)node2id.size());
+            if (res.second){
+                gmds::Node nd = gmdsMesh.get<gmds::Node>(id);
+                coords.push_back(nd.X());
+                coords.push_back(nd.Y());
+                coords.push_back(nd.Z());
+                if (gmdsIds)
+                    gmdsIds->push_back((long)id);
+            }
+            cells.push_back(res.first->second);
+        }
+    }
+}
+/*----------------------------------------------------------------------------*/
 CommandMeshExplorer* MeshManager::newExplorer(CommandMeshExplorer* oldExplo, int inc, std::string narete, bool asCommand)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"MeshManager::newExplorer()";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_5));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_5, "MeshManager::newExplorer()");
 
     Mesh::CommandMeshExplorer* command =
             new Mesh::CommandMeshExplorer(
@@ -523,9 +588,7 @@ CommandMeshExplorer* MeshManager::newExplorer(CommandMeshExplorer* oldExplo, int
 /*----------------------------------------------------------------------------*/
 CommandMeshExplorer* MeshManager::endExplorer(CommandMeshExplorer* oldExplo, bool asCommand)
 {
-    TkUtil::UTF8String   message (TkUtil::Charset::UTF_8);
-    message <<"MeshManager::endExplorer()";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_5));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_5, "MeshManager::endExplorer()");
 
     Mesh::CommandMeshExplorer* command =
             new Mesh::CommandMeshExplorer(
@@ -6,6 +6,7 @@
 #include "Mesh/MeshModificationBySepa.h"
 #include "Mesh/MeshImplementation.h"
 #include "Mesh/MeshManager.h"
+#include "Internal/ThreadedJobs.h"
 #include "Utils/SerializedRepresentation.h"
 #include "Utils/MgxNumeric.h"
 /*----------------------------------------------------------------------------*/
@@ -21,6 +22,56 @@
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
 namespace Mesh {
+/*----------------------------------------------------------------------------*/
+/// nombre minimum de noeuds par tâche pour justifier une exécution en parallèle
+static const size_t	SEPA_MIN_NODES_PER_TASK	= 10000;
+
+#ifdef USE_SEPA3D
+/*----------------------------------------------------------------------------*/
+/** Construit et initialise une séparatrice (en micromètres).
+ *  Sepa3D n'étant pas garanti thread-safe, chaque tâche dispose de sa propre instance.
+ */
+static sepa3d::Separatrice* createSeparatrice(const Utils::Math::Point& ACenter,
+		const std::vector<std::string>& AFilenames, double AConvertFactor)
+{
+	if(AFilenames.size() == 0) {
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+		message <<"MeshModificationBySepa::applyModification Pas de fichier pour sepa.";
+		throw TkUtil::Exception(message);
+	}
+
+	std::unique_ptr<sepa3d::Separatrice> sepa (new sepa3d::Separatrice());
+	gmds::math::Point center(ACenter.getX()*AConvertFactor,ACenter.getY()*AConvertFactor,ACenter.getZ()*AConvertFactor);
+	sepa->setCenter(center);
+	for(size_t iFile=0; iFile<AFilenames.size(); iFile++) {
+		sepa->readControlFile(AFilenames[iFile]);
+	}
+	sepa->buildMesh();
+
+	return sepa.release();
+}
+
+/*----------------------------------------------------------------------------*/
+/** Perturbation des noeuds [first, last[ d'un tableau de noeuds, les deltas
+ *  étant rangés aux mêmes indices dans un tableau dense.
+ */
+static void applySepaPerturbation(sepa3d::Separatrice& ASepa,
+		std::vector<gmds::Node>& ANodes, std::vector<double>& ADeltas,
+		size_t AFirst, size_t ALast, double AToMicron, double AFromMicron)
+{
+	for (size_t i=AFirst; i<ALast; i++) {
+		gmds::Node& node = ANodes[i];
+		gmds::math::Point point = node.point()*AToMicron;
+
+		ADeltas[i] = ASepa.getRadialPerturbation(point);
+
+		gmds::math::Point newPoint = (ASepa.applyPerturbation(point)) * AFromMicron;
+		node.setPoint(newPoint);
+	}
+}
+
+#endif	// USE_SEPA3D
+
 /*----------------------------------------------------------------------------*/
 MeshModificationBySepa::
 MeshModificationBySepa()
@@ -158,45 +209,23 @@ applyModification(std::vector<gmds::Node >& AGmdsNodes, std::vector<gmds::Face>&
 	double convertFactorFromMicron = Utils::Unit::computeFactor(Utils::Unit::micron,lu);
 
 	m_faces = AGmdsFaces;
+	m_deltas.assign(AGmdsNodes.size(), 0.0);
 
 #ifdef USE_SEPA3D
-	sepa3d::Separatrice* sepa = new sepa3d::Separatrice();
-	gmds::math::Point center(m_center.getX()*convertFactorToMicron,m_center.getY()*convertFactorToMicron,m_center.getZ()*convertFactorToMicron);
-	sepa->setCenter(center);
-
-	if(m_sepafiles.size() == 0) {
-		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-		message <<"MeshModificationBySepa::applyModification Pas de fichier pour sepa.";
-		throw TkUtil::Exception(message);
-	}
-
-	for(int iFile=0; iFile<m_sepafiles.size(); iFile++) {
-		sepa->readControlFile(m_sepafiles[iFile]);
-	}
-	sepa->buildMesh();
-
-	for (std::vector<gmds::Node >::iterator iter = AGmdsNodes.begin();
-			iter != AGmdsNodes.end(); ++iter) {
-		gmds::Node node = *iter;
-
-		double delta = sepa->getRadialPerturbation(node.point()*convertFactorToMicron);
-		m_deltas[node] = delta;
-
-		gmds::math::Point point = node.point()*convertFactorToMicron;
-		gmds::math::Point newPoint = (sepa->applyPerturbation(point)) * convertFactorFromMicron;
-		node.setPoint(newPoint);
-	}
-
-//#ifdef _DEBUG2
-//	std::cout<<"nodeCount = "<<nodeCount<<std::endl;
-//#endif
+	// chaque tranche contiguë de noeuds est traitée avec sa propre séparatrice,
+	// les deltas étant écrits à des indices disjoints
+	Internal::runThreadedRanges(AGmdsNodes.size(), SEPA_MIN_NODES_PER_TASK, 1,
+		[this, &AGmdsNodes, convertFactorToMicron, convertFactorFromMicron](size_t first, size_t last) {
+			std::unique_ptr<sepa3d::Separatrice> sepa (createSeparatrice(m_center, m_sepafiles, convertFactorToMicron));
+			applySepaPerturbation(*sepa, AGmdsNodes, m_deltas, first, last, convertFactorToMicron, convertFactorFromMicron);
+		});
 #else
 	throw TkUtil::Exception (TkUtil::UTF8String ("Package Sepa3D non inclu", TkUtil::Charset::UTF_8));
 #endif
 }
 /*----------------------------------------------------------------------------*/
-std::map<gmds::Node,double>&
-MeshModificationBySepa::getDeltas()
+const std::vector<double>&
+MeshModificationBySepa::getDeltas() const
 {
 	return m_deltas;
 }
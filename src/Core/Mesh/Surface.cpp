@@ -257,7 +257,7 @@ void Surface::getGMDSFaces(std::vector<gmds::Face >& AFaces) const
     gmds::Mesh&  gmdsMesh = meshImpl->getGMDSMesh();
 
     for(Topo::CoFace* coface : getCoFaces()) {
-        std::vector<gmds::TCellID> faces  = coface->faces();
+        const Topo::MeshCellIds& faces  = coface->faces();
 
         for(unsigned int iFace=0; iFace<faces.size(); iFace++) {
             AFaces.push_back(gmdsMesh.get<gmds::Face>(faces[iFace]));
@@ -0,0 +1,457 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file VTUReader.cpp
+ *
+ *  \date 19 oct. 2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Mesh/VTUReader.h"
+/*----------------------------------------------------------------------------*/
+#include <TkUtil/Exception.h>
+#include <TkUtil/UTF8String.h>
+/*----------------------------------------------------------------------------*/
+#ifdef USE_ZLIB
+#include <zlib.h>
+#endif
+/*----------------------------------------------------------------------------*/
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+/// description d'un tableau lue dans l'en-tête XML
+struct VTUArrayDesc {
+	/// FieldData, PointData, CellData, Points ou Cells
+	std::string m_section;
+	std::map<std::string, std::string> m_attributes;
+};
+/*----------------------------------------------------------------------------*/
+static TkUtil::Exception readError(const std::string& nom, const std::string& what)
+{
+	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+	message << "Pb lors de la lecture VTU du fichier " << nom << " : " << what;
+	return TkUtil::Exception (message);
+}
+/*----------------------------------------------------------------------------*/
+/// nombre entier positif lu dans un attribut
+static uint64_t parseCount(const std::string& nom, const std::string& value, const std::string& attribute)
+{
+	const size_t first = value.find_first_not_of('0');
+	if (value.empty() || value.find_first_not_of("0123456789") != std::string::npos
+			|| (first != std::string::npos && value.size() - first > 19))
+		throw readError(nom, "valeur incorrecte pour l'attribut " + attribute);
+	return strtoull(value.c_str(), 0, 10);
+}
+/*----------------------------------------------------------------------------*/
+static const char* byteOrder()
+{
+	const uint16_t one = 1;
+	return (*reinterpret_cast<const unsigned char*>(&one) == 1) ? "LittleEndian" : "BigEndian";
+}
+/*----------------------------------------------------------------------------*/
+static std::string xmlUnescape(const std::string& str)
+{
+	static const char* entities[][2] = {{"&lt;", "<"}, {"&gt;", ">"}, {"&quot;", "\""}, {"&apos;", "'"}, {"&amp;", "&"}};
+	std::string unescaped;
+	for (size_t i=0; i<str.size(); ){
+		bool found = false;
+		if (str[i] == '&')
+			for (auto& entity : entities)
+				if (0 == str.compare(i, strlen(entity[0]), entity[0])){
+					unescaped += entity[1];
+					i += strlen(entity[0]);
+					found = true;
+					break;
+				}
+		if (!found)
+			unescaped += str[i++];
+	}
+	return unescaped;
+}
+/*----------------------------------------------------------------------------*/
+/// attributs de la balise tag (sans les chevrons)
+static std::map<std::string, std::string> parseAttributes(const std::string& tag)
+{
+	std::map<std::string, std::string> attributes;
+	size_t pos = tag.find_first_of(" \t\r\n");
+	while (pos != std::string::npos){
+		size_t eq = tag.find('=', pos);
+		if (eq == std::string::npos)
+			break;
+		size_t quote = tag.find_first_of("\"'", eq);
+		if (quote == std::string::npos)
+			break;
+		size_t end = tag.find(tag[quote], quote+1);
+		if (end == std::string::npos)
+			break;
+		size_t first = tag.find_first_not_of(" \t\r\n", pos);
+		size_t last = tag.find_last_not_of(" \t\r\n", eq-1);
+		attributes[tag.substr(first, last-first+1)] = xmlUnescape(tag.substr(quote+1, end-quote-1));
+		pos = end+1;
+	}
+	return attributes;
+}
+/*----------------------------------------------------------------------------*/
+/// taille en octets d'une valeur de type type
+static size_t typeSize(const std::string& type)
+{
+	if (type == "Int8" || type == "UInt8") return 1;
+	if (type == "Int16" || type == "UInt16") return 2;
+	if (type == "Int32" || type == "UInt32" || type == "Float32") return 4;
+	if (type == "Int64" || type == "UInt64" || type == "Float64") return 8;
+	return 0;
+}
+/*----------------------------------------------------------------------------*/
+/// valeur d'indice i d'un tableau de type type
+static double valueAt(const std::vector<char>& data, const std::string& type, size_t i)
+{
+	const char* ptr = data.data() + i*typeSize(type);
+	if (type == "Int8") return *reinterpret_cast<const int8_t*>(ptr);
+	if (type == "UInt8") return *reinterpret_cast<const uint8_t*>(ptr);
+	if (type == "Int16") return *reinterpret_cast<const int16_t*>(ptr);
+	if (type == "UInt16") return *reinterpret_cast<const uint16_t*>(ptr);
+	if (type == "Int32") return *reinterpret_cast<const int32_t*>(ptr);
+	if (type == "UInt32") return *reinterpret_cast<const uint32_t*>(ptr);
+	if (type == "Int64") return *reinterpret_cast<const int64_t*>(ptr);
+	if (type == "UInt64") return *reinterpret_cast<const uint64_t*>(ptr);
+	if (type == "Float32") return *reinterpret_cast<const float*>(ptr);
+	return *reinterpret_cast<const double*>(ptr);
+}
+/*----------------------------------------------------------------------------*/
+/// conversion d'un tableau d'entiers
+static std::vector<int64_t> toIntegers(const std::vector<char>& data, const std::string& type)
+{
+	const size_t nb = data.size()/typeSize(type);
+	std::vector<int64_t> values(nb);
+	if (type == "Int64" || type == "UInt64")
+		memcpy(values.data(), data.data(), nb*sizeof(int64_t));
+	else if (type == "UInt8")
+		for (size_t i=0; i<nb; i++)
+			values[i] = reinterpret_cast<const uint8_t*>(data.data())[i];
+	else
+		for (size_t i=0; i<nb; i++)
+			values[i] = (int64_t)valueAt(data, type, i);
+	return values;
+}
+/*----------------------------------------------------------------------------*/
+/// conversion d'un tableau de réels
+static std::vector<double> toReals(const std::vector<char>& data, const std::string& type)
+{
+	const size_t nb = data.size()/typeSize(type);
+	std::vector<double> values(nb);
+	if (type == "Float64")
+		memcpy(values.data(), data.data(), nb*sizeof(double));
+	else
+		for (size_t i=0; i<nb; i++)
+			values[i] = valueAt(data, type, i);
+	return values;
+}
+/*----------------------------------------------------------------------------*/
+VTUReader::VTUReader(gmds::Mesh& mesh)
+: m_gmds_mesh(mesh)
+{
+}
+/*----------------------------------------------------------------------------*/
+void VTUReader::read(const std::string& nom)
+{
+	std::ifstream file(nom.c_str(), std::ios::in | std::ios::binary);
+	if (!file)
+		throw readError(nom, "ouverture impossible, cela peut venir d'un chemin incorrect ou d'un problème de permissions");
+
+	// l'en-tête XML, jusqu'au début des données ajoutées
+	std::string header;
+	size_t appended = std::string::npos, dataStart = std::string::npos;
+	char buffer[65536];
+	while (dataStart == std::string::npos && file){
+		file.read(buffer, sizeof(buffer));
+		header.append(buffer, file.gcount());
+		if (appended == std::string::npos)
+			appended = header.find("<AppendedData");
+		if (appended != std::string::npos){
+			size_t end = header.find('>', appended);
+			if (end != std::string::npos)
+				dataStart = header.find('_', end);
+		}
+	}
+	if (dataStart == std::string::npos)
+		throw readError(nom, "seuls les fichiers dont les tableaux sont ajoutés en binaire (AppendedData) sont lus");
+	if (header.find("encoding=\"base64\"", appended) < dataStart)
+		throw readError(nom, "l'encodage base64 des données ajoutées n'est pas supporté");
+	dataStart += 1;
+	header.resize(appended);
+
+	// les balises de l'en-tête
+	std::map<std::string, std::string> fileAttributes, pieceAttributes;
+	std::vector<VTUArrayDesc> arrays;
+	std::string section;
+	for (size_t pos = header.find('<'); pos != std::string::npos; pos = header.find('<', pos+1)){
+		size_t end = header.find('>', pos);
+		if (end == std::string::npos)
+			break;
+		std::string tag = header.substr(pos+1, end-pos-1);
+		std::string name = tag.substr(0, tag.find_first_of(" \t\r\n/", 1));
+		if (name == "VTKFile")
+			fileAttributes = parseAttributes(tag);
+		else if (name == "Piece")
+			pieceAttributes = parseAttributes(tag);
+		else if (name == "FieldData" || name == "PointData" || name == "CellData" || name == "Points" || name == "Cells")
+			section = (tag[tag.size()-1] == '/' ? "" : name);
+		else if (name == "/FieldData" || name == "/PointData" || name == "/CellData" || name == "/Points" || name == "/Cells")
+			section.clear();
+		else if (name == "DataArray"){
+			VTUArrayDesc desc;
+			desc.m_section = section;
+			desc.m_attributes = parseAttributes(tag);
+			arrays.push_back(desc);
+		}
+	}
+
+	if (fileAttributes["type"] != "UnstructuredGrid")
+		throw readError(nom, "ce n'est pas un maillage non structuré (UnstructuredGrid)");
+	if (fileAttributes["byte_order"] != byteOrder())
+		throw readError(nom, "l'ordre des octets diffère de celui de la machine");
+	const std::string headerType = fileAttributes.count("header_type") ? fileAttributes["header_type"] : "UInt32";
+	if (headerType != "UInt32" && headerType != "UInt64")
+		throw readError(nom, "type d'en-tête de tableau non supporté");
+	const std::string compressor = fileAttributes["compressor"];
+	if (!compressor.empty() && compressor != "vtkZLibDataCompressor")
+		throw readError(nom, "seule la compression zlib est supportée");
+#ifndef USE_ZLIB
+	if (!compressor.empty())
+		throw readError(nom, "fichier compressé alors que Magix3D n'a pas été compilé avec zlib");
+#endif
+	const uint64_t nbPoints = parseCount(nom, pieceAttributes["NumberOfPoints"], "NumberOfPoints");
+	const uint64_t nbCells = parseCount(nom, pieceAttributes["NumberOfCells"], "NumberOfCells");
+
+	// taille du fichier, toutes les tailles lues étant bornées par ce qu'il reste à lire
+	file.clear();
+	file.seekg(0, std::ios::end);
+	const uint64_t fileSize = file.tellg();
+	if (fileSize < dataStart)
+		throw readError(nom, "fichier tronqué");
+	const size_t headerSize = (headerType == "UInt64" ? sizeof(uint64_t) : sizeof(uint32_t));
+
+	// lecture d'un entier de l'en-tête d'un tableau
+	auto readHeaderValue = [&file, &headerType]() -> uint64_t {
+		if (headerType == "UInt64"){
+			uint64_t value = 0;
+			file.read(reinterpret_cast<char*>(&value), sizeof(value));
+			return value;
+		}
+		uint32_t value = 0;
+		file.read(reinterpret_cast<char*>(&value), sizeof(value));
+		return value;
+	};
+
+	// lecture des données d'un tableau de nbValues valeurs, les tailles annoncées
+	// étant vérifiées avant toute allocation
+	auto readData = [&](VTUArrayDesc& desc, uint64_t nbValues) -> std::vector<char> {
+		if (desc.m_attributes["format"] != "appended")
+			throw readError(nom, "seuls les tableaux au format appended sont lus");
+		const size_t valueSize = typeSize(desc.m_attributes["type"]);
+		if (0 == valueSize)
+			throw readError(nom, "type de tableau non supporté");
+		if (nbValues > UINT64_MAX / valueSize)
+			throw readError(nom, "taille de tableau trop grande");
+		const uint64_t size = nbValues * valueSize;
+		const uint64_t offset = parseCount(nom, desc.m_attributes["offset"], "offset");
+		if (offset > fileSize - dataStart)
+			throw readError(nom, "position de tableau hors du fichier");
+		uint64_t remaining = fileSize - dataStart - offset;
+		file.clear();
+		file.seekg(dataStart + offset);
+		std::vector<char> data;
+		if (compressor.empty()){
+			if (remaining < headerSize || readHeaderValue() != size || size > remaining - headerSize)
+				throw readError(nom, "taille de tableau incohérente");
+			data.resize(size);
+			file.read(data.data(), data.size());
+		}
+		else {
+#ifdef USE_ZLIB
+			if (remaining < 3*headerSize)
+				throw readError(nom, "fichier tronqué");
+			const uint64_t nbBlocks = readHeaderValue();
+			const uint64_t blockSize = readHeaderValue();
+			const uint64_t lastBlockSize = readHeaderValue();
+			remaining -= 3*headerSize;
+			if (nbBlocks > remaining / headerSize || 0 == blockSize || lastBlockSize > blockSize)
+				throw readError(nom, "en-tête de tableau compressé incohérent");
+			const uint64_t blocksSize = (nbBlocks == 0 ? 0 : (nbBlocks-1 > (UINT64_MAX - blockSize) / blockSize ? UINT64_MAX :
+					(nbBlocks-1)*blockSize + (lastBlockSize ? lastBlockSize : blockSize)));
+			if (blocksSize != size)
+				throw readError(nom, "taille de tableau incohérente");
+			remaining -= nbBlocks*headerSize;
+			std::vector<uint64_t> compressedSizes(nbBlocks);
+			for (uint64_t b=0; b<nbBlocks; b++){
+				compressedSizes[b] = readHeaderValue();
+				const uint64_t uncompressedSize = (b+1 == nbBlocks && lastBlockSize ? lastBlockSize : blockSize);
+				// zlib ne compresse pas au-delà d'un rapport de 1032
+				if (compressedSizes[b] > remaining || uncompressedSize / 1032 > compressedSizes[b])
+					throw readError(nom, "taille de bloc compressé incohérente");
+				remaining -= compressedSizes[b];
+			}
+			data.resize(size);
+			std::vector<char> compressed;
+			for (uint64_t b=0; b<nbBlocks; b++){
+				compressed.resize(compressedSizes[b]);
+				file.read(compressed.data(), compressed.size());
+				const uLongf expected = (b+1 == nbBlocks && lastBlockSize ? lastBlockSize : blockSize);
+				uLongf uncompressedSize = expected;
+				if (Z_OK != uncompress(reinterpret_cast<Bytef*>(data.data() + b*blockSize), &uncompressedSize,
+						reinterpret_cast<const Bytef*>(compressed.data()), compressed.size())
+						|| uncompressedSize != expected)
+					throw readError(nom, "erreur de décompression zlib");
+			}
+#endif
+		}
+		if (!file)
+			throw readError(nom, "fichier tronqué");
+		return data;
+	};
+
+	auto findArray = [&](const std::string& sectionName, const std::string& arrayName) -> VTUArrayDesc& {
+		for (VTUArrayDesc& desc : arrays)
+			if (desc.m_section == sectionName && (arrayName.empty() || desc.m_attributes["Name"] == arrayName))
+				return desc;
+		throw readError(nom, std::string("tableau ") + sectionName + " " + arrayName + " absent");
+	};
+
+	// les noeuds
+	std::vector<gmds::Node> nodes;
+	{
+		VTUArrayDesc& desc = findArray("Points", "");
+		if (nbPoints > UINT64_MAX / 3)
+			throw readError(nom, "nombre de noeuds trop grand");
+		std::vector<double> coords = toReals(readData(desc, 3*nbPoints), desc.m_attributes["type"]);
+		nodes.resize(nbPoints);
+		for (size_t i=0; i<nbPoints; i++)
+			nodes[i] = m_gmds_mesh.newNode(coords[3*i], coords[3*i+1], coords[3*i+2]);
+	}
+
+	// les mailles
+	std::vector<gmds::TCellID> cell_ids;
+	std::vector<uint8_t> cell_dims;
+	{
+		VTUArrayDesc& descConnectivity = findArray("Cells", "connectivity");
+		VTUArrayDesc& descOffsets = findArray("Cells", "offsets");
+		VTUArrayDesc& descTypes = findArray("Cells", "types");
+		std::vector<int64_t> offsets = toIntegers(readData(descOffsets, nbCells), descOffsets.m_attributes["type"]);
+		std::vector<int64_t> types = toIntegers(readData(descTypes, nbCells), descTypes.m_attributes["type"]);
+		for (size_t c=0; c<nbCells; c++)
+			if (offsets[c] < (c == 0 ? 0 : offsets[c-1]))
+				throw readError(nom, "connectivité incohérente");
+		std::vector<int64_t> connectivity = toIntegers(
+				readData(descConnectivity, nbCells == 0 ? 0 : offsets.back()), descConnectivity.m_attributes["type"]);
+
+		cell_ids.resize(nbCells);
+		cell_dims.resize(nbCells);
+		std::vector<gmds::Node> cell_nodes;
+		for (size_t c=0; c<nbCells; c++){
+			const int64_t first = (c == 0 ? 0 : offsets[c-1]);
+			cell_nodes.clear();
+			for (int64_t k=first; k<offsets[c]; k++){
+				if (connectivity[k] < 0 || connectivity[k] >= (int64_t)nbPoints)
+					throw readError(nom, "indice de noeud hors limites");
+				cell_nodes.push_back(nodes[connectivity[k]]);
+			}
+			const size_t nb = cell_nodes.size();
+			const int64_t type = types[c];
+			if (type == 3 && nb == 2){
+				cell_ids[c] = m_gmds_mesh.newEdge(cell_nodes[0], cell_nodes[1]).id();
+				cell_dims[c] = 1;
+			}
+			else if (type == 5 && nb == 3){
+				cell_ids[c] = m_gmds_mesh.newTriangle(cell_nodes[0], cell_nodes[1], cell_nodes[2]).id();
+				cell_dims[c] = 2;
+			}
+			else if (type == 9 && nb == 4){
+				cell_ids[c] = m_gmds_mesh.newQuad(cell_nodes[0], cell_nodes[1], cell_nodes[2], cell_nodes[3]).id();
+				cell_dims[c] = 2;
+			}
+			else if (type == 7 && nb >= 3){
+				cell_ids[c] = m_gmds_mesh.newPolygon(cell_nodes).id();
+				cell_dims[c] = 2;
+			}
+			else if (type == 10 && nb == 4){
+				cell_ids[c] = m_gmds_mesh.newTet(cell_nodes[0], cell_nodes[1], cell_nodes[2], cell_nodes[3]).id();
+				cell_dims[c] = 3;
+			}
+			else if (type == 12 && nb == 8){
+				cell_ids[c] = m_gmds_mesh.newHex(cell_nodes[0], cell_nodes[1], cell_nodes[2], cell_nodes[3],
+						cell_nodes[4], cell_nodes[5], cell_nodes[6], cell_nodes[7]).id();
+				cell_dims[c] = 3;
+			}
+			else if (type == 13 && nb == 6){
+				cell_ids[c] = m_gmds_mesh.newPrism3(cell_nodes[0], cell_nodes[1], cell_nodes[2],
+						cell_nodes[3], cell_nodes[4], cell_nodes[5]).id();
+				cell_dims[c] = 3;
+			}
+			else if (type == 14 && nb == 5){
+				cell_ids[c] = m_gmds_mesh.newPyramid(cell_nodes[0], cell_nodes[1], cell_nodes[2],
+						cell_nodes[3], cell_nodes[4]).id();
+				cell_dims[c] = 3;
+			}
+			else
+				throw readError(nom, "type de maille non supporté");
+		}
+	}
+
+	// les groupes de maillage, donnés par des intervalles [début, fin[ d'indices
+	// de noeuds (nuages) ou de mailles
+	for (VTUArrayDesc& desc : arrays){
+		const std::string group = desc.m_attributes["Mgx3DGroup"];
+		if (desc.m_section != "FieldData" || group.empty())
+			continue;
+		const std::string name = desc.m_attributes["Name"];
+		if (desc.m_attributes["NumberOfComponents"] != "2")
+			throw readError(nom, "le groupe " + name + " n'est pas un tableau d'intervalles");
+		const uint64_t nbRanges = parseCount(nom, desc.m_attributes["NumberOfTuples"], "NumberOfTuples");
+		if (nbRanges > UINT64_MAX / 2)
+			throw readError(nom, "taille incohérente pour le groupe " + name);
+		std::vector<int64_t> ranges = toIntegers(readData(desc, 2*nbRanges), desc.m_attributes["type"]);
+		const int64_t nb = (group == "Cloud" ? nbPoints : nbCells);
+		for (size_t r=0; r<ranges.size(); r+=2)
+			if (ranges[r] < 0 || ranges[r] > ranges[r+1] || ranges[r+1] > nb)
+				throw readError(nom, "intervalle hors limites pour le groupe " + name);
+
+		if (group == "Cloud"){
+			auto cl = m_gmds_mesh.newGroup<gmds::Node>(name);
+			for (size_t r=0; r<ranges.size(); r+=2)
+				for (int64_t i=ranges[r]; i<ranges[r+1]; i++)
+					cl->add(nodes[i]);
+		}
+		else if (group == "Line"){
+			auto ln = m_gmds_mesh.newGroup<gmds::Edge>(name);
+			for (size_t r=0; r<ranges.size(); r+=2)
+				for (int64_t c=ranges[r]; c<ranges[r+1]; c++)
+					if (cell_dims[c] == 1)
+						ln->add(m_gmds_mesh.get<gmds::Edge>(cell_ids[c]));
+		}
+		else if (group == "Surface"){
+			auto su = m_gmds_mesh.newGroup<gmds::Face>(name);
+			for (size_t r=0; r<ranges.size(); r+=2)
+				for (int64_t c=ranges[r]; c<ranges[r+1]; c++)
+					if (cell_dims[c] == 2)
+						su->add(m_gmds_mesh.get<gmds::Face>(cell_ids[c]));
+		}
+		else if (group == "Volume"){
+			auto vo = m_gmds_mesh.newGroup<gmds::Region>(name);
+			for (size_t r=0; r<ranges.size(); r+=2)
+				for (int64_t c=ranges[r]; c<ranges[r+1]; c++)
+					if (cell_dims[c] == 3)
+						vo->add(m_gmds_mesh.get<gmds::Region>(cell_ids[c]));
+		}
+	}
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
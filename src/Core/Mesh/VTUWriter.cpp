@@ -0,0 +1,516 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file VTUWriter.cpp
+ *
+ *  \date 19 oct. 2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Internal/Context.h"
+#include "Internal/ThreadedJobs.h"
+#include "Mesh/VTUWriter.h"
+#include "Mesh/MeshManager.h"
+#include "Mesh/Cloud.h"
+#include "Mesh/Line.h"
+#include "Mesh/Surface.h"
+#include "Mesh/Volume.h"
+/*----------------------------------------------------------------------------*/
+#include <TkUtil/Exception.h>
+#include <TkUtil/MemoryError.h>
+#include <TkUtil/UTF8String.h>
+/*----------------------------------------------------------------------------*/
+#ifdef USE_ZLIB
+#include <zlib.h>
+#endif
+/*----------------------------------------------------------------------------*/
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <set>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+/// nombre minimum d'entités par tâche pour l'assemblage en parallèle
+static const size_t VTU_MIN_ITEMS_PER_TASK = 4096;
+/// taille (en octets) des blocs compressés indépendamment
+static const uint64_t VTU_COMPRESSION_BLOCK_SIZE = 1 << 20;
+/// nombre de blocs calculés (et compressés) puis écrits ensemble
+static const uint64_t VTU_BLOCKS_PER_SLAB = 16;
+/// nombre de chiffres des positions des tableaux, complétées une fois les données écrites
+static const int VTU_OFFSET_WIDTH = 20;
+/// types de cellules VTK
+enum VTUCellType { VTU_LINE = 3, VTU_TRIANGLE = 5, VTU_POLYGON = 7, VTU_QUAD = 9,
+	VTU_TETRA = 10, VTU_HEXAHEDRON = 12, VTU_WEDGE = 13, VTU_PYRAMID = 14 };
+/*----------------------------------------------------------------------------*/
+/// taille d'un tableau indexé par les identifiants GMDS ids
+static size_t indexSize(const std::vector<gmds::TCellID>& ids)
+{
+	size_t size = 0;
+	for (gmds::TCellID id : ids)
+		size = std::max<size_t>(size, id+1);
+	return size;
+}
+/*----------------------------------------------------------------------------*/
+static const char* byteOrder()
+{
+	const uint16_t one = 1;
+	return (*reinterpret_cast<const unsigned char*>(&one) == 1) ? "LittleEndian" : "BigEndian";
+}
+/*----------------------------------------------------------------------------*/
+static std::string xmlEscape(const std::string& str)
+{
+	std::string escaped;
+	for (char c : str) {
+		switch (c) {
+		case '&': escaped += "&amp;"; break;
+		case '<': escaped += "&lt;"; break;
+		case '>': escaped += "&gt;"; break;
+		case '"': escaped += "&quot;"; break;
+		default: escaped += c;
+		}
+	}
+	return escaped;
+}
+/*----------------------------------------------------------------------------*/
+/// un tableau des données ajoutées, dont les valeurs sont calculées par tranches
+struct VTUDataArray {
+	std::string m_name;
+	std::string m_type;
+	uint m_nb_components;
+	/// type du groupe de maillage (attribut Mgx3DGroup), vide pour les autres tableaux
+	std::string m_group;
+	/// taille d'une valeur, en octets
+	size_t m_value_size;
+	/// nombre de valeurs (nombre de n-uplets x nombre de composantes)
+	uint64_t m_nb_values;
+	/// calcul des valeurs [first, last[, rangées à partir de l'adresse transmise
+	std::function<void(size_t, size_t, char*)> m_fill;
+	/// position dans le fichier de la valeur de l'attribut offset
+	std::streampos m_offset_pos;
+	/// position dans les données ajoutées
+	uint64_t m_offset;
+};
+/*----------------------------------------------------------------------------*/
+/// compression d'un bloc de données
+static void compressBlock(const char* data, uint64_t size, std::vector<unsigned char>& block)
+{
+#ifdef USE_ZLIB
+	uLongf compressedSize = compressBound(size);
+	block.resize(compressedSize);
+	if (Z_OK != compress2(block.data(), &compressedSize,
+			reinterpret_cast<const Bytef*>(data), size, Z_DEFAULT_COMPRESSION))
+		throw TkUtil::Exception (TkUtil::UTF8String ("Erreur de compression zlib pour l'export VTU", TkUtil::Charset::UTF_8));
+	block.resize(compressedSize);
+#endif
+}
+/*----------------------------------------------------------------------------*/
+/** Écriture des données d'un tableau à la suite du fichier. Les valeurs sont
+ *  calculées et écrites par tranches de VTU_BLOCKS_PER_SLAB blocs, seule une
+ *  tranche (et sa version compressée) étant en mémoire. En cas de compression,
+ *  l'en-tête (tailles des blocs compressés) est complété une fois les blocs
+ *  écrits.
+ */
+static void writeAppendedArray(std::ofstream& file, const VTUDataArray& array, bool compressed)
+{
+	const uint64_t size = array.m_nb_values*array.m_value_size;
+	const uint64_t slabSize = VTU_BLOCKS_PER_SLAB*VTU_COMPRESSION_BLOCK_SIZE;
+	std::vector<char> slab;
+	auto fillSlab = [&array, &slab](uint64_t first, uint64_t last){
+		slab.resize(last-first);
+		const size_t firstValue = first/array.m_value_size;
+		Internal::runThreadedRanges((last-first)/array.m_value_size, VTU_MIN_ITEMS_PER_TASK, 4,
+			[&array, &slab, firstValue](size_t f, size_t l){
+				array.m_fill(firstValue+f, firstValue+l, slab.data() + f*array.m_value_size);
+			});
+	};
+
+	if (!compressed){
+		file.write(reinterpret_cast<const char*>(&size), sizeof(uint64_t));
+		for (uint64_t first=0; first<size; first+=slabSize){
+			fillSlab(first, std::min(first+slabSize, size));
+			file.write(slab.data(), slab.size());
+		}
+		return;
+	}
+
+	const uint64_t nbBlocks = (size + VTU_COMPRESSION_BLOCK_SIZE - 1) / VTU_COMPRESSION_BLOCK_SIZE;
+	std::vector<uint64_t> header(3+nbBlocks, 0);
+	header[0] = nbBlocks;
+	header[1] = VTU_COMPRESSION_BLOCK_SIZE;
+	header[2] = size % VTU_COMPRESSION_BLOCK_SIZE;
+	const std::streampos headerPos = file.tellp();
+	file.write(reinterpret_cast<const char*>(header.data()), header.size()*sizeof(uint64_t));
+
+	std::vector<std::vector<unsigned char> > blocks(VTU_BLOCKS_PER_SLAB);
+	for (uint64_t first=0; first<size; first+=slabSize){
+		fillSlab(first, std::min(first+slabSize, size));
+		const size_t nb = (slab.size() + VTU_COMPRESSION_BLOCK_SIZE - 1) / VTU_COMPRESSION_BLOCK_SIZE;
+		std::vector<std::function<void()> > jobs;
+		for (size_t b=0; b<nb; b++)
+			jobs.push_back([&slab, &blocks, b](){
+				const uint64_t offset = b*VTU_COMPRESSION_BLOCK_SIZE;
+				compressBlock(slab.data() + offset, std::min(VTU_COMPRESSION_BLOCK_SIZE, slab.size() - offset), blocks[b]);
+			});
+		Internal::runThreadedJobs(jobs);
+		const uint64_t firstBlock = first/VTU_COMPRESSION_BLOCK_SIZE;
+		for (size_t b=0; b<nb; b++){
+			header[3+firstBlock+b] = blocks[b].size();
+			file.write(reinterpret_cast<const char*>(blocks[b].data()), blocks[b].size());
+		}
+	}
+
+	const std::streampos end = file.tellp();
+	file.seekp(headerPos);
+	file.write(reinterpret_cast<const char*>(header.data()), header.size()*sizeof(uint64_t));
+	file.seekp(end);
+}
+/*----------------------------------------------------------------------------*/
+/// intervalles [début, fin[ couverts par des indices, rangés à la suite
+static std::vector<int64_t> toRanges(std::vector<int64_t>& indices)
+{
+	std::sort(indices.begin(), indices.end());
+	std::vector<int64_t> ranges;
+	for (size_t i=0; i<indices.size(); i++){
+		if (ranges.empty() || ranges.back() != indices[i]){
+			ranges.push_back(indices[i]);
+			ranges.push_back(indices[i]+1);
+		}
+		else
+			ranges.back() += 1;
+	}
+	return ranges;
+}
+/*----------------------------------------------------------------------------*/
+VTUWriter::VTUWriter(Internal::Context* context, gmds::Mesh& mesh, bool compressed)
+: m_context(context)
+, m_gmds_mesh(mesh)
+, m_compressed(compressed)
+{
+	CHECK_NULL_PTR_ERROR(m_context);
+}
+/*----------------------------------------------------------------------------*/
+void VTUWriter::write(const std::string& nom)
+{
+#ifndef USE_ZLIB
+	if (m_compressed)
+		throw TkUtil::Exception (TkUtil::UTF8String ("Export VTU compressé impossible, Magix3D n'a pas été compilé avec zlib", TkUtil::Charset::UTF_8));
+#endif
+
+	// les entités écrites, dans l'ordre de GMDS
+	std::vector<gmds::TCellID> node_ids, edge_ids, face_ids, region_ids;
+	node_ids.reserve(m_gmds_mesh.getNbNodes());
+	for (auto id : m_gmds_mesh.nodes())
+		node_ids.push_back(id);
+	edge_ids.reserve(m_gmds_mesh.getNbEdges());
+	for (auto id : m_gmds_mesh.edges())
+		edge_ids.push_back(id);
+	face_ids.reserve(m_gmds_mesh.getNbFaces());
+	for (auto id : m_gmds_mesh.faces())
+		face_ids.push_back(id);
+	region_ids.reserve(m_gmds_mesh.getNbRegions());
+	for (auto id : m_gmds_mesh.regions())
+		region_ids.push_back(id);
+
+	const size_t nbNodes = node_ids.size();
+	const size_t nbEdges = edge_ids.size();
+	const size_t nbFaces = face_ids.size();
+	const size_t nbCells = nbEdges + nbFaces + region_ids.size();
+
+	// numérotation compacte : indice dans le fichier pour chaque identifiant GMDS
+	std::vector<int64_t> node_index(indexSize(node_ids), -1);
+	std::vector<int64_t> edge_index(indexSize(edge_ids), -1);
+	std::vector<int64_t> face_index(indexSize(face_ids), -1);
+	std::vector<int64_t> region_index(indexSize(region_ids), -1);
+	Internal::runThreadedRanges(nbNodes, VTU_MIN_ITEMS_PER_TASK, 4, [&](size_t first, size_t last){
+		for (size_t i=first; i<last; i++)
+			node_index[node_ids[i]] = i;
+	});
+
+	// type VTK et noeuds d'une maille : bras, puis polygones, puis polyèdres
+	auto cellType = [&](size_t c) -> uint8_t {
+		if (c < nbEdges)
+			return VTU_LINE;
+		if (c < nbEdges+nbFaces){
+			const uint nb = m_gmds_mesh.get<gmds::Face>(face_ids[c-nbEdges]).nbNodes();
+			return (nb == 3 ? VTU_TRIANGLE : (nb == 4 ? VTU_QUAD : VTU_POLYGON));
+		}
+		switch (m_gmds_mesh.get<gmds::Region>(region_ids[c-nbEdges-nbFaces]).type()){
+		case gmds::GMDS_TETRA: return VTU_TETRA;
+		case gmds::GMDS_HEX: return VTU_HEXAHEDRON;
+		case gmds::GMDS_PRISM3: return VTU_WEDGE;
+		case gmds::GMDS_PYRAMID: return VTU_PYRAMID;
+		default:
+			throw TkUtil::Exception (TkUtil::UTF8String ("Export VTU : type de polyèdre non prévu", TkUtil::Charset::UTF_8));
+		}
+	};
+	auto cellNodes = [&](size_t c) -> std::vector<gmds::TCellID> {
+		if (c < nbEdges)
+			return m_gmds_mesh.get<gmds::Edge>(edge_ids[c]).getIDs<gmds::Node>();
+		if (c < nbEdges+nbFaces)
+			return m_gmds_mesh.get<gmds::Face>(face_ids[c-nbEdges]).getIDs<gmds::Node>();
+		return m_gmds_mesh.get<gmds::Region>(region_ids[c-nbEdges-nbFaces]).getIDs<gmds::Node>();
+	};
+
+	// nombres de noeuds des mailles (et vérification de leur type), puis
+	// positions de fin de chaque maille dans la connectivité (offsets VTK)
+	std::vector<int64_t> offsets(nbCells);
+	Internal::runThreadedRanges(nbCells, VTU_MIN_ITEMS_PER_TASK, 4, [&](size_t first, size_t last){
+		for (size_t c=first; c<last; c++){
+			if (c < nbEdges){
+				edge_index[edge_ids[c]] = c;
+				offsets[c] = 2;
+			}
+			else if (c < nbEdges+nbFaces){
+				gmds::TCellID id = face_ids[c-nbEdges];
+				face_index[id] = c;
+				offsets[c] = m_gmds_mesh.get<gmds::Face>(id).nbNodes();
+			}
+			else {
+				gmds::TCellID id = region_ids[c-nbEdges-nbFaces];
+				region_index[id] = c;
+				cellType(c);
+				offsets[c] = m_gmds_mesh.get<gmds::Region>(id).nbNodes();
+			}
+		}
+	});
+	int64_t total = 0;
+	for (size_t c=0; c<nbCells; c++){
+		total += offsets[c];
+		offsets[c] = total;
+	}
+
+	// les groupes de maillage, sous forme d'intervalles d'indices de noeuds
+	// (nuages) ou de mailles (lignes, surfaces et volumes), un groupe par tâche
+	Mesh::MeshManager& mm = m_context->getMeshManager();
+	std::vector<Mesh::Cloud*> clouds = mm.getCloudsObj();
+	std::vector<Mesh::Line*> lines = mm.getLinesObj();
+	std::vector<Mesh::Surface*> surfaces = mm.getSurfacesObj();
+	std::vector<Mesh::Volume*> volumes = mm.getVolumesObj();
+	std::vector<std::string> group_names, group_types;
+	std::vector<std::vector<int64_t> > group_ranges(clouds.size()+lines.size()+surfaces.size()+volumes.size());
+	std::vector<std::function<void()> > jobs;
+	for (Mesh::Cloud* cl : clouds){
+		const size_t g = group_names.size();
+		jobs.push_back([&, g, cl](){
+			std::vector<gmds::Node> nodes;
+			cl->getGMDSNodes(nodes);
+			std::vector<int64_t> indices;
+			indices.reserve(nodes.size());
+			for (gmds::Node& nd : nodes)
+				indices.push_back(node_index[nd.id()]);
+			group_ranges[g] = toRanges(indices);
+		});
+		group_names.push_back(cl->getName());
+		group_types.push_back("Cloud");
+	}
+	for (Mesh::Line* ln : lines){
+		const size_t g = group_names.size();
+		jobs.push_back([&, g, ln](){
+			std::vector<gmds::Edge> edges;
+			ln->getGMDSEdges(edges);
+			std::vector<int64_t> indices;
+			indices.reserve(edges.size());
+			for (gmds::Edge& ed : edges)
+				indices.push_back(edge_index[ed.id()]);
+			group_ranges[g] = toRanges(indices);
+		});
+		group_names.push_back(ln->getName());
+		group_types.push_back("Line");
+	}
+	for (Mesh::Surface* su : surfaces){
+		const size_t g = group_names.size();
+		jobs.push_back([&, g, su](){
+			std::vector<gmds::Face> faces;
+			su->getGMDSFaces(faces);
+			std::vector<int64_t> indices;
+			indices.reserve(faces.size());
+			for (gmds::Face& fa : faces)
+				indices.push_back(face_index[fa.id()]);
+			group_ranges[g] = toRanges(indices);
+		});
+		group_names.push_back(su->getName());
+		group_types.push_back("Surface");
+	}
+	for (Mesh::Volume* vo : volumes){
+		const size_t g = group_names.size();
+		jobs.push_back([&, g, vo](){
+			std::vector<gmds::Region> regions;
+			vo->getGMDSRegions(regions);
+			std::vector<int64_t> indices;
+			indices.reserve(regions.size());
+			for (gmds::Region& rg : regions)
+				indices.push_back(region_index[rg.id()]);
+			group_ranges[g] = toRanges(indices);
+		});
+		group_names.push_back(vo->getName());
+		group_types.push_back("Volume");
+	}
+	Internal::runThreadedJobs(jobs);
+
+	// les tableaux, dans l'ordre des sections FieldData, PointData, CellData,
+	// Points et Cells
+	std::vector<VTUDataArray> arrays;
+	auto addArray = [&arrays](const std::string& name, const std::string& type, uint nbComponents,
+			const std::string& group, size_t valueSize, uint64_t nbValues,
+			const std::function<void(size_t, size_t, char*)>& fill){
+		VTUDataArray array;
+		array.m_name = name;
+		array.m_type = type;
+		array.m_nb_components = nbComponents;
+		array.m_group = group;
+		array.m_value_size = valueSize;
+		array.m_nb_values = nbValues;
+		array.m_fill = fill;
+		array.m_offset = 0;
+		arrays.push_back(array);
+	};
+	for (size_t i=0; i<group_ranges.size(); i++){
+		const std::vector<int64_t>& ranges = group_ranges[i];
+		addArray(group_names[i], "Int64", 2, group_types[i], sizeof(int64_t), ranges.size(),
+			[&ranges](size_t first, size_t last, char* dest){
+				memcpy(dest, ranges.data()+first, (last-first)*sizeof(int64_t));
+			});
+	}
+	// les mêmes groupes, en tableaux d'entiers (1 pour les noeuds ou mailles
+	// du groupe, 0 sinon) des sections PointData (nuages) et CellData, un
+	// tableau par groupe, une maille pouvant appartenir à plusieurs groupes
+	std::set<std::string> cell_names;
+	size_t nbPointGroups = 0;
+	for (int pointData=1; pointData>=0; pointData--){
+		for (size_t i=0; i<group_ranges.size(); i++){
+			if ((group_types[i] == "Cloud") != (pointData == 1))
+				continue;
+			std::string name = group_names[i];
+			if (!pointData && !cell_names.insert(name).second)
+				name += "_" + group_types[i];
+			const std::vector<int64_t>& ranges = group_ranges[i];
+			addArray(name, "UInt8", 1, "", sizeof(uint8_t), pointData ? nbNodes : nbCells,
+				[&ranges](size_t first, size_t last, char* dest){
+					// les bornes des intervalles jusqu'à v, en nombre impair si v est dans un intervalle
+					size_t k = std::upper_bound(ranges.begin(), ranges.end(), (int64_t)first) - ranges.begin();
+					for (size_t v=first; v<last; v++){
+						while (k < ranges.size() && ranges[k] <= (int64_t)v)
+							k++;
+						dest[v-first] = k%2;
+					}
+				});
+			if (pointData)
+				nbPointGroups++;
+		}
+	}
+	addArray("Points", "Float64", 3, "", sizeof(double), 3*(uint64_t)nbNodes,
+		[&](size_t first, size_t last, char* dest){
+			double* values = reinterpret_cast<double*>(dest);
+			for (size_t v=first; v<last; v++){
+				gmds::Node nd = m_gmds_mesh.get<gmds::Node>(node_ids[v/3]);
+				values[v-first] = (v%3 == 0 ? nd.X() : (v%3 == 1 ? nd.Y() : nd.Z()));
+			}
+		});
+	addArray("connectivity", "Int64", 1, "", sizeof(int64_t), total,
+		[&](size_t first, size_t last, char* dest){
+			int64_t* values = reinterpret_cast<int64_t*>(dest);
+			// la maille contenant la valeur first, puis les suivantes
+			size_t c = std::upper_bound(offsets.begin(), offsets.end(), (int64_t)first) - offsets.begin();
+			std::vector<gmds::TCellID> ids = cellNodes(c);
+			int64_t start = (c == 0 ? 0 : offsets[c-1]);
+			for (size_t v=first; v<last; v++){
+				while ((int64_t)v >= offsets[c]){
+					start = offsets[c];
+					ids = cellNodes(++c);
+				}
+				values[v-first] = node_index[ids[v-start]];
+			}
+		});
+	addArray("offsets", "Int64", 1, "", sizeof(int64_t), nbCells,
+		[&offsets](size_t first, size_t last, char* dest){
+			memcpy(dest, offsets.data()+first, (last-first)*sizeof(int64_t));
+		});
+	addArray("types", "UInt8", 1, "", sizeof(uint8_t), nbCells,
+		[&](size_t first, size_t last, char* dest){
+			for (size_t c=first; c<last; c++)
+				dest[c-first] = cellType(c);
+		});
+
+	std::ofstream file(nom.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!file){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+		message << "Pb lors de l'export VTU, impossible d'ouvrir le fichier " << nom
+				<< "\nCela peut venir d'un chemin incorrect ou d'un problème de permissions.";
+		throw TkUtil::Exception (message);
+	}
+
+	// l'en-tête XML, les positions des tableaux dans les données ajoutées
+	// n'étant connues qu'une fois ces derniers écrits
+	file << "<?xml version=\"1.0\"?>\n"
+		 << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"" << byteOrder()
+		 << "\" header_type=\"UInt64\"";
+	if (m_compressed)
+		file << " compressor=\"vtkZLibDataCompressor\"";
+	file << ">\n"
+		 << "  <UnstructuredGrid>\n";
+	auto writeSection = [&file, &arrays](const char* section, const char* indent, size_t first, size_t last){
+		file << indent << "<" << section << ">\n";
+		for (size_t i=first; i<last; i++){
+			VTUDataArray& array = arrays[i];
+			file << indent << "  <DataArray type=\"" << array.m_type << "\" Name=\"" << xmlEscape(array.m_name) << "\"";
+			if (array.m_nb_components != 1)
+				file << " NumberOfComponents=\"" << array.m_nb_components << "\"";
+			if (!array.m_group.empty())
+				file << " NumberOfTuples=\"" << array.m_nb_values/array.m_nb_components
+					 << "\" Mgx3DGroup=\"" << array.m_group << "\"";
+			file << " format=\"appended\" offset=\"";
+			array.m_offset_pos = file.tellp();
+			file << std::string(VTU_OFFSET_WIDTH, '0') << "\"/>\n";
+		}
+		file << indent << "</" << section << ">\n";
+	};
+	const size_t nbGroups = group_ranges.size();
+	const size_t pointsArray = 2*nbGroups;
+	if (0 != nbGroups)
+		writeSection("FieldData", "    ", 0, nbGroups);
+	file << "    <Piece NumberOfPoints=\"" << nbNodes << "\" NumberOfCells=\"" << nbCells << "\">\n";
+	if (0 != nbPointGroups)
+		writeSection("PointData", "      ", nbGroups, nbGroups+nbPointGroups);
+	if (nbGroups != nbPointGroups)
+		writeSection("CellData", "      ", nbGroups+nbPointGroups, pointsArray);
+	writeSection("Points", "      ", pointsArray, pointsArray+1);
+	writeSection("Cells", "      ", pointsArray+1, arrays.size());
+	file << "    </Piece>\n"
+		 << "  </UnstructuredGrid>\n"
+		 << "  <AppendedData encoding=\"raw\">\n"
+		 << "   _";
+
+	// les données, tableau par tableau
+	const std::streampos dataStart = file.tellp();
+	for (VTUDataArray& array : arrays){
+		array.m_offset = file.tellp() - dataStart;
+		writeAppendedArray(file, array, m_compressed);
+	}
+
+	file << "\n  </AppendedData>\n"
+		 << "</VTKFile>\n";
+
+	// report des positions des tableaux dans l'en-tête
+	for (const VTUDataArray& array : arrays){
+		file.seekp(array.m_offset_pos);
+		file << std::setw(VTU_OFFSET_WIDTH) << std::setfill('0') << array.m_offset;
+	}
+
+	file.close();
+	if (file.fail()){
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+		message << "Pb lors de l'export VTU dans le fichier " << nom
+				<< "\nCela peut venir d'un problème de permissions ou de quota.";
+		throw TkUtil::Exception (message);
+	}
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
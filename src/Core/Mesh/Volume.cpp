@@ -260,8 +260,8 @@ void Volume::getRepresentation(Utils::DisplayRepresentation& dr, bool checkDestr
 	                {
 	                    Topo::CoFace*	face	= iter->first;
 	                    // les polygones de la Topo::CoFace :
-	                    std::vector<gmds::TCellID>& loc_polygones	= face->faces();
-	                    for (std::vector<gmds::TCellID>::const_iterator
+	                    const Topo::MeshCellIds& loc_polygones	= face->faces();
+	                    for (Topo::MeshCellIds::const_iterator
 	                            iter_p = loc_polygones.begin();
 	                            iter_p != loc_polygones.end(); ++iter_p)
 	                    {
@@ -349,7 +349,7 @@ void Volume::getGMDSRegions(std::vector<gmds::Region >& ARegions) const
     CHECK_NULL_PTR_ERROR(meshImpl);
     gmds::Mesh&  gmdsMesh    = meshImpl->getGMDSMesh ( );
     for(Topo::Block* block : getBlocks()) {
-        std::vector<gmds::TCellID> regions  = block->regions();
+        const Topo::MeshCellIds& regions  = block->regions();
 
         for(unsigned int iRegion=0; iRegion<regions.size(); iRegion++) {
             ARegions.push_back(gmdsMesh.get<gmds::Region>(regions[iRegion]));
@@ -5,10 +5,25 @@
 #include "Geom/Curve.h"
 #include "Geom/Surface.h"
 #include "Geom/Volume.h"
+#include "Geom/GeomManager.h"
 #include "Topo/TopoManager.h"
 #include "Internal/Context.h"
 #include "Group/GroupManager.h"
+#include <TkUtil/Exception.h>
+#include <TkUtil/UTF8String.h>
+#include <BinTools.hxx>
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepTools_ReShape.hxx>
+#include <Geom_BSplineCurve.hxx>
+#include <Geom_BSplineSurface.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Iterator.hxx>
+#include <cstdio>
+#include <unordered_set>
 
 namespace Mgx3D::Services
 {
@@ -72,10 +87,14 @@ namespace Mgx3D::Services
     void MementoService::saveMemento(Geom::GeomEntity *e, const Memento &mem)
     {
         m_mementos.insert({e, mem});
+        m_memory_size = 0;
     }
 
     void MementoService::permMementos()
     {
+        if (isSpilled())
+            restore();
+        m_memory_size = 0;
         for (auto it = m_mementos.begin(); it != m_mementos.end(); it++)
         {
             Geom::GeomEntity *e = it->first;
@@ -131,6 +150,7 @@ namespace Mgx3D::Services
                 gm.setGroupsFor(e, m_mem.groups);
                 e->setGeomProperty(m_mem.property);
                 e->forceComputeArea();
+                e->forceComputeBoundingBox();
             }
 
             Memento m_mem;
@@ -139,4 +159,184 @@ namespace Mgx3D::Services
         set_memento_visitor.m_mem = mem;
         e->accept(set_memento_visitor);
     }
+
+    MementoService::~MementoService()
+    {
+        if (isSpilled())
+            std::remove(m_spill_file.c_str());
+    }
+
+    size_t MementoService::getMemorySize() const
+    {
+        if (0 != m_memory_size)
+            return m_memory_size;
+
+        size_t size = sizeof(MementoService);
+        std::unordered_set<const TopoDS_TShape *> tshapes;
+        for (const auto &[e, mem] : m_mementos)
+        {
+            size += sizeof(Memento) + sizeof(void *) * (mem.topo_entities.size() + mem.groups.size() + mem.volumes.size() + mem.surfaces.size() + mem.curves.size() + mem.vertices.size()) + sizeof(TopoDS_Shape) * mem.occ_shapes.size();
+
+            for (const TopoDS_Shape &sh : mem.occ_shapes)
+            {
+                if (sh.IsNull() || !tshapes.insert(sh.TShape().get()).second)
+                    continue;
+                size += 256;
+
+                // faces : surface support et triangulation éventuelle
+                for (TopExp_Explorer exp(sh, TopAbs_FACE); exp.More(); exp.Next())
+                {
+                    const TopoDS_Face &face = TopoDS::Face(exp.Current());
+                    if (!tshapes.insert(face.TShape().get()).second)
+                        continue;
+                    size += 256;
+                    TopLoc_Location loc;
+                    Handle(Geom_BSplineSurface) bs = Handle(Geom_BSplineSurface)::DownCast(BRep_Tool::Surface(face, loc));
+                    if (!bs.IsNull())
+                        size += (sizeof(gp_Pnt) + sizeof(double)) * bs->NbUPoles() * bs->NbVPoles();
+                    Handle(Poly_Triangulation) tri = BRep_Tool::Triangulation(face, loc);
+                    if (!tri.IsNull())
+                        size += sizeof(gp_Pnt) * tri->NbNodes() + sizeof(Poly_Triangle) * tri->NbTriangles();
+                }
+                // arêtes : courbe support
+                for (TopExp_Explorer exp(sh, TopAbs_EDGE); exp.More(); exp.Next())
+                {
+                    const TopoDS_Edge &edge = TopoDS::Edge(exp.Current());
+                    if (!tshapes.insert(edge.TShape().get()).second)
+                        continue;
+                    size += 128;
+                    double first, last;
+                    Handle(Geom_BSplineCurve) bc = Handle(Geom_BSplineCurve)::DownCast(BRep_Tool::Curve(edge, first, last));
+                    if (!bc.IsNull())
+                        size += (sizeof(gp_Pnt) + sizeof(double)) * bc->NbPoles();
+                }
+                for (TopExp_Explorer exp(sh, TopAbs_VERTEX); exp.More(); exp.Next())
+                    if (tshapes.insert(exp.Current().TShape().get()).second)
+                        size += 64;
+            }
+        }
+
+        m_memory_size = size;
+        return size;
+    }
+
+    /** ajoute aux formes des entités géométriques celles de la forme et de
+     * ses sous-formes */
+    static void addTShapes(const TopoDS_Shape &sh, std::unordered_set<const TopoDS_TShape *> &tshapes)
+    {
+        if (sh.IsNull() || !tshapes.insert(sh.TShape().get()).second)
+            return;
+        for (TopAbs_ShapeEnum type : {TopAbs_FACE, TopAbs_EDGE, TopAbs_VERTEX})
+            for (TopExp_Explorer exp(sh, type); exp.More(); exp.Next())
+                tshapes.insert(exp.Current().TShape().get());
+    }
+
+    bool MementoService::spill(const std::string &fileName)
+    {
+        if (isSpilled() || m_mementos.empty())
+            return false;
+
+        // les formes des entités géométriques, qui restent en mémoire
+        const Geom::GeomManager &gm = m_mementos.begin()->first->getContext().getGeomManager();
+        std::unordered_set<const TopoDS_TShape *> live;
+        for (Geom::Vertex *v : gm.getVerticesObj())
+            addTShapes(v->getOCCVertex(), live);
+        for (Geom::Curve *c : gm.getCurvesObj())
+            for (const TopoDS_Edge &edge : c->getOCCEdges())
+                addTShapes(edge, live);
+        for (Geom::Surface *sf : gm.getSurfacesObj())
+            for (const TopoDS_Face &face : sf->getOCCFaces())
+                addTShapes(face, live);
+        for (Geom::Volume *v : gm.getVolumesObj())
+            addTShapes(v->getOCCShape(), live);
+
+        // une seule forme composée, afin que les sous-formes partagées ne soient
+        // écrites qu'une fois
+        BRep_Builder builder;
+        TopoDS_Compound compound;
+        builder.MakeCompound(compound);
+        std::vector<size_t> counts;
+        TopTools_IndexedMapOfShape shared;
+        for (const auto &[e, mem] : m_mementos)
+        {
+            for (const TopoDS_Shape &sh : mem.occ_shapes)
+            {
+                if (sh.IsNull())
+                    return false;
+                builder.Add(compound, sh);
+                if (live.count(sh.TShape().get()))
+                    shared.Add(sh.Oriented(TopAbs_FORWARD));
+                for (TopAbs_ShapeEnum type : {TopAbs_FACE, TopAbs_EDGE, TopAbs_VERTEX})
+                    for (TopExp_Explorer exp(sh, type); exp.More(); exp.Next())
+                        if (live.count(exp.Current().TShape().get()))
+                            shared.Add(exp.Current().Oriented(TopAbs_FORWARD));
+            }
+            counts.push_back(mem.occ_shapes.size());
+        }
+        // les sous-formes partagées, à la suite : le fichier conserve le lien
+        // entre leur copie et les mémentos
+        for (int i = 1; i <= shared.Extent(); i++)
+            builder.Add(compound, shared(i));
+
+        if (!BinTools::Write(compound, fileName.c_str()))
+        {
+            std::remove(fileName.c_str());
+            return false;
+        }
+
+        for (auto &[e, mem] : m_mementos)
+            std::vector<TopoDS_Shape>().swap(mem.occ_shapes);
+        m_spill_counts = counts;
+        m_spill_shared = shared;
+        m_spill_file = fileName;
+        m_memory_size = 0;
+        return true;
+    }
+
+    void MementoService::restore()
+    {
+        if (!isSpilled())
+            return;
+
+        TopoDS_Shape compound;
+        if (!BinTools::Read(compound, m_spill_file.c_str()))
+        {
+            TkUtil::UTF8String message(TkUtil::Charset::UTF_8);
+            message << "Impossible de relire le fichier d'annulation " << m_spill_file;
+            throw TkUtil::Exception(message);
+        }
+
+        TopoDS_Iterator it(compound, Standard_True, Standard_True);
+        size_t i = 0;
+        for (auto &[e, mem] : m_mementos)
+        {
+            const size_t nb = m_spill_counts[i++];
+            mem.occ_shapes.reserve(nb);
+            for (size_t j = 0; j < nb && it.More(); j++, it.Next())
+                mem.occ_shapes.push_back(it.Value());
+            if (mem.occ_shapes.size() != nb)
+                throw TkUtil::Exception(TkUtil::UTF8String("Fichier d'annulation incomplet " + m_spill_file, TkUtil::Charset::UTF_8));
+        }
+
+        // les copies relues des sous-formes partagées sont remplacées par ces
+        // dernières (même TShape et même position)
+        Handle(BRepTools_ReShape) reshape = new BRepTools_ReShape();
+        reshape->ModeConsiderLocation() = Standard_True;
+        for (int k = 1; k <= m_spill_shared.Extent(); k++, it.Next())
+        {
+            if (!it.More())
+                throw TkUtil::Exception(TkUtil::UTF8String("Fichier d'annulation incomplet " + m_spill_file, TkUtil::Charset::UTF_8));
+            reshape->Replace(it.Value(), m_spill_shared(k));
+        }
+        if (m_spill_shared.Extent() > 0)
+            for (auto &[e, mem] : m_mementos)
+                for (TopoDS_Shape &sh : mem.occ_shapes)
+                    sh = reshape->Apply(sh);
+
+        std::remove(m_spill_file.c_str());
+        m_spill_file.clear();
+        m_spill_counts.clear();
+        m_spill_shared.Clear();
+        m_memory_size = 0;
+    }
 }
@@ -55,7 +55,7 @@ MesquiteDomainImplAdapter(
 	for(unsigned int iCoFace=0; iCoFace<coFaces.size(); iCoFace++) {
 
 		if(coFaces[iCoFace]->isMeshed()) {
-			std::vector<gmds::TCellID>& faces = coFaces[iCoFace]->faces();
+			const Topo::MeshCellIds& faces = coFaces[iCoFace]->faces();
 			Geom::GeomEntity* surf = coFaces[iCoFace]->getGeomAssociation();
 
 			// a CoFace is not necessarily associated to a geometry
@@ -90,9 +90,7 @@ Block(Internal::Context& ctx,
 , m_mesh_data(new BlockMeshingData())
 , m_save_mesh_data(0)
 {
-	TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
-    message1 << "Block::Block(), dans le cas quelconque avec "<<faces.size()<<" faces";
-    log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "Block::Block(), dans le cas quelconque avec "<<faces.size()<<" faces");
 
     if (isStructured){
         m_mesh_property = new BlockMeshingPropertyTransfinite();
@@ -147,9 +145,7 @@ Block(Internal::Context& ctx, int ni, int nj, int nk)
 , m_mesh_data(new BlockMeshingData())
 , m_save_mesh_data(0)
 {
-	TkUtil::UTF8String	message1 (TkUtil::Charset::UTF_8);
-    message1 << "Block::Block(), dans le cas structuré\n";
-    log (TkUtil::TraceLog (message1, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "Block::Block(), dans le cas structuré\n");
 
     m_mesh_property = new BlockMeshingPropertyTransfinite();
 
@@ -1036,10 +1032,10 @@ getDescription (bool alsoComputed) const
 
     if (isMeshed()){
         topoProprietes.addProperty (
-                Utils::SerializedRepresentation::Property ("Nombre de noeuds", (long)m_mesh_data->nodes().size()));
+                Utils::SerializedRepresentation::Property ("Nombre de noeuds", (long)getMeshingData()->nodes().size()));
 
         topoProprietes.addProperty (
-                Utils::SerializedRepresentation::Property ("Nombre de polyèdres", (long)m_mesh_data->regions().size()));
+                Utils::SerializedRepresentation::Property ("Nombre de polyèdres", (long)getMeshingData()->regions().size()));
     }
 
 
@@ -1838,6 +1834,23 @@ void Block::extendSplit(CoEdge* arete,
     std::cout<<"On découpe le bloc "<<getName()<<std::endl;
 #endif
 
+    CoEdge* coedge = 0;
+    double ratio = 0.0;
+    getExtendSplitCoEdge(arete, coedge, ratio);
+
+#ifdef _DEBUG_TIMER
+    TkUtil::Timer timer(true);
+#endif
+    split(coedge, ratio, newBlocs, icmd);
+#ifdef _DEBUG_TIMER
+    timer.stop();
+    std::cout<<"split en "<<timer.strDuration()<<std::endl;
+#endif
+
+}
+/*----------------------------------------------------------------------------*/
+void Block::getExtendSplitCoEdge(CoEdge* arete, CoEdge* &coedge, double& ratio)
+{
 #ifdef _DEBUG_TIMER
    TkUtil::Timer timer(true);
 #endif
@@ -1889,8 +1902,7 @@ void Block::extendSplit(CoEdge* arete,
     if (0 == coface)
            throw TkUtil::Exception (TkUtil::UTF8String ("Erreur interne, on ne trouve pas de CoFace dans le bloc depuis l'arête", TkUtil::Charset::UTF_8));
 
-    CoEdge* coedge = 0;
-    std::vector<CoEdge* > coedges;
+    coedge = 0;
     uint marque_arete = dir + 1;
     for (Topo::CoEdge* ce : coface->getCoEdges())
         if (filtre_coedge[ce] != marque_arete)
@@ -1899,25 +1911,16 @@ void Block::extendSplit(CoEdge* arete,
     if (0 == coedge)
            throw TkUtil::Exception (TkUtil::UTF8String ("Erreur interne, on ne trouve pas d'arête dans une autre direction et dans une même coface", TkUtil::Charset::UTF_8));
 
-#ifdef _DEBUG_TIMER
-    timer.reset();
-    timer.start();
-#endif
     const std::vector<Vertex*>& ce_vertices = coedge->getVertices();
     const std::vector<Vertex*>& ar_vertices = arete->getVertices();
     if (ce_vertices[0] == ar_vertices[0]
     		|| ce_vertices[0] == ar_vertices[1])
-    	split(coedge, 0.0, newBlocs, icmd);
+    	ratio = 0.0;
     else if (ce_vertices[1] == ar_vertices[0]
     		|| ce_vertices[1] == ar_vertices[1])
-    	split(coedge, 1.0, newBlocs, icmd);
+    	ratio = 1.0;
     else
     	throw TkUtil::Exception (TkUtil::UTF8String ("On ne trouve pas de sommet commun entre l'arête sélectionnée et l'arête transverse", TkUtil::Charset::UTF_8));
-#ifdef _DEBUG_TIMER
-    timer.stop();
-    std::cout<<"split en "<<timer.strDuration()<<std::endl;
-#endif
-
 }
 /*----------------------------------------------------------------------------*/
 void Block::
@@ -2619,7 +2622,7 @@ free(Internal::InfoCommand* icmd)
 
     // on retire la relation avec la géométrie
     if (icmd && getGeomAssociation()
-             && icmd->getTopoInfoEntity()[this] != Internal::InfoCommand::NONE){
+             && icmd->getTopoInfoEntityType(this) != Internal::InfoCommand::NONE){
         saveTopoProperty();
         setGeomAssociation(0);
     }
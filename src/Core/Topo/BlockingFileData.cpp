@@ -0,0 +1,688 @@
+/*----------------------------------------------------------------------------*/
+#include "Topo/BlockingFileData.h"
+/*----------------------------------------------------------------------------*/
+#include <TkUtil/Exception.h>
+#include <TkUtil/UTF8String.h>
+/*----------------------------------------------------------------------------*/
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Topo {
+/*----------------------------------------------------------------------------*/
+namespace {
+/*----------------------------------------------------------------------------*/
+/// mots clés des sections ASCII des associations géométriques
+const char* ASSOC_KEYWORDS[4] = {"GEOM_Nodes", "GEOM_Edges", "GEOM_Faces", "GEOM_Blocks"};
+/// messages d'erreur en l'absence de ces sections
+const char* ASSOC_ERRORS[4] = {
+        "Erreur lecteur BLK : Pas d'associations géométriques trouvées pour les sommets.",
+        "Erreur lecteur BLK : Pas d'associations géométriques trouvées pour les aretes.",
+        "Erreur lecteur BLK : Pas d'associations géométriques trouvées pour les faces.",
+        "Erreur lecteur BLK : Pas d'associations géométriques trouvées pour les blocs."};
+/// étiquettes des sections binaires des associations géométriques
+const char* ASSOC_TAGS[4] = {"GNOD", "GEDG", "GFAC", "GBLK"};
+/// signature des fichiers binaires
+const char BINARY_MAGIC[8] = {'M', 'G', 'X', 'B', 'L', 'O', 'C', 'K'};
+/*----------------------------------------------------------------------------*/
+/**
+ * Découpage en mots d'un fichier ASCII chargé en mémoire, sans allocation
+ * par mot.
+ */
+class AsciiTokenizer
+{
+public:
+    AsciiTokenizer(std::istream& str)
+    : m_buffer(std::istreambuf_iterator<char>(str), std::istreambuf_iterator<char>()),
+      m_pos(0)
+    {
+        m_buffer.push_back('\0');
+    }
+
+    /** place le curseur après le premier mot contenant keyword, en partant du
+     *  début du fichier */
+    bool moveOntoFirst(const char* keyword)
+    {
+        m_pos = 0;
+        const char* begin;
+        size_t length;
+        const size_t kwLength = strlen(keyword);
+        while (nextToken(begin, length)) {
+            if (length >= kwLength && std::search(begin, begin+length, keyword, keyword+kwLength) != begin+length)
+                return true;
+        }
+        return false;
+    }
+
+    /** lecture d'un nombre d'entités */
+    int nextCount()
+    {
+        const int value = nextInt();
+        if (value < 0)
+            error();
+        return value;
+    }
+
+    int nextInt()
+    {
+        skipSpaces();
+        char* end = 0;
+        const long value = strtol(&m_buffer[m_pos], &end, 10);
+        if (end == &m_buffer[m_pos])
+            error();
+        m_pos = end - &m_buffer[0];
+        return (int)value;
+    }
+
+    double nextDouble()
+    {
+        skipSpaces();
+        char* end = 0;
+        const double value = strtod(&m_buffer[m_pos], &end);
+        if (end == &m_buffer[m_pos])
+            error();
+        m_pos = end - &m_buffer[0];
+        return value;
+    }
+
+    /** lecture d'une liste d'entiers entre crochets, ajoutés à values */
+    void nextList(std::vector<int>& values)
+    {
+        expect('[');
+        while (true) {
+            skipSpaces();
+            if (m_buffer[m_pos] == ']') {
+                m_pos++;
+                return;
+            }
+            values.push_back(nextInt());
+        }
+    }
+
+private:
+    void skipSpaces()
+    {
+        while (m_buffer[m_pos] != '\0' && isspace((unsigned char)m_buffer[m_pos]))
+            m_pos++;
+    }
+
+    void expect(char c)
+    {
+        skipSpaces();
+        if (m_buffer[m_pos] != c)
+            error();
+        m_pos++;
+    }
+
+    bool nextToken(const char*& begin, size_t& length)
+    {
+        skipSpaces();
+        if (m_buffer[m_pos] == '\0')
+            return false;
+        begin = &m_buffer[m_pos];
+        while (m_buffer[m_pos] != '\0' && !isspace((unsigned char)m_buffer[m_pos]))
+            m_pos++;
+        length = &m_buffer[m_pos] - begin;
+        return true;
+    }
+
+    void error()
+    {
+        throw TkUtil::Exception(TkUtil::UTF8String("BLK read error: unexpected token", TkUtil::Charset::UTF_8));
+    }
+
+    std::vector<char> m_buffer;
+    size_t m_pos;
+};
+/*----------------------------------------------------------------------------*/
+bool isLittleEndian()
+{
+    const uint16_t one = 1;
+    return *reinterpret_cast<const unsigned char*>(&one) == 1;
+}
+/*----------------------------------------------------------------------------*/
+/// inversion de l'ordre des octets de n valeurs de taille size
+void swapBytes(char* data, size_t size, size_t n)
+{
+    for (size_t i = 0; i < n; i++, data += size)
+        std::reverse(data, data+size);
+}
+/*----------------------------------------------------------------------------*/
+/// écriture en bloc, en little-endian
+template <typename T>
+void writeRaw(std::ostream& str, const T* values, size_t n)
+{
+    if (n == 0)
+        return;
+    if (isLittleEndian())
+        str.write(reinterpret_cast<const char*>(values), n*sizeof(T));
+    else {
+        std::vector<T> copy(values, values+n);
+        swapBytes(reinterpret_cast<char*>(copy.data()), sizeof(T), n);
+        str.write(reinterpret_cast<const char*>(copy.data()), n*sizeof(T));
+    }
+}
+/*----------------------------------------------------------------------------*/
+/// lecture en bloc, depuis du little-endian
+template <typename T>
+void readRaw(std::istream& str, T* values, size_t n)
+{
+    if (n == 0)
+        return;
+    if (!str.read(reinterpret_cast<char*>(values), n*sizeof(T)))
+        throw TkUtil::Exception(TkUtil::UTF8String("BLK read error: truncated binary file", TkUtil::Charset::UTF_8));
+    if (!isLittleEndian())
+        swapBytes(reinterpret_cast<char*>(values), sizeof(T), n);
+}
+/*----------------------------------------------------------------------------*/
+/// taille en octets d'un tableau écrit par writeArray
+template <typename T>
+uint64_t arraySize(const std::vector<T>& values)
+{
+    return sizeof(uint64_t) + values.size()*sizeof(T);
+}
+/*----------------------------------------------------------------------------*/
+/// écriture d'un tableau précédé de son nombre d'éléments (sur 64 bits)
+template <typename T>
+void writeArray(std::ostream& str, const std::vector<T>& values)
+{
+    const uint64_t n = values.size();
+    writeRaw(str, &n, 1);
+    writeRaw(str, values.data(), values.size());
+}
+/*----------------------------------------------------------------------------*/
+/// début de section binaire : étiquette et taille en octets du contenu
+void writeSectionHeader(std::ostream& str, const char* tag, uint64_t size)
+{
+    str.write(tag, 4);
+    writeRaw(str, &size, 1);
+}
+/*----------------------------------------------------------------------------*/
+/// erreur de lecture d'un fichier de blocs corrompu
+void corruptedError(const char* what)
+{
+    TkUtil::UTF8String mess(TkUtil::Charset::UTF_8);
+    mess << "BLK read error: corrupted file (" << what << ")";
+    throw TkUtil::Exception(mess);
+}
+/*----------------------------------------------------------------------------*/
+/// lecture d'un tableau écrit par writeArray, contenu dans la section finissant en end
+template <typename T>
+void readArray(std::istream& str, std::vector<T>& values, std::streampos end)
+{
+    uint64_t n = 0;
+    readRaw(str, &n, 1);
+    const std::streamoff available = end - str.tellg();
+    if (available < 0 || n > (uint64_t)available / sizeof(T))
+        corruptedError("array larger than its section");
+    values.resize(n);
+    readRaw(str, values.data(), n);
+}
+/*----------------------------------------------------------------------------*/
+/// vérifie que les indices sont ceux de nb entités
+void checkIndices(const std::vector<int>& indices, size_t nb, const char* what)
+{
+    for (int ind : indices)
+        if (ind < 0 || (size_t)ind >= nb)
+            corruptedError(what);
+}
+/*----------------------------------------------------------------------------*/
+/// vérifie un tableau de décalages de nb listes stockées à plat dans total valeurs
+void checkOffsets(const std::vector<int>& offsets, size_t nb, size_t total, const char* what)
+{
+    if (offsets.size() != nb+1 || offsets[0] != 0 || (size_t)offsets.back() != total)
+        corruptedError(what);
+    for (size_t i = 1; i < offsets.size(); i++)
+        if (offsets[i] < offsets[i-1])
+            corruptedError(what);
+}
+/*----------------------------------------------------------------------------*/
+std::string extension(const std::string& fileName)
+{
+    const size_t pos = fileName.rfind('.');
+    return pos == std::string::npos ? std::string() : fileName.substr(pos+1);
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace
+/*----------------------------------------------------------------------------*/
+bool BlockingFileData::isBinaryFileName(const std::string& fileName)
+{
+    return extension(fileName) == "mgxb";
+}
+/*----------------------------------------------------------------------------*/
+bool BlockingFileData::isBlockingFileName(const std::string& fileName)
+{
+    const std::string ext = extension(fileName);
+    return ext == "mgxt" || ext == "mgxb";
+}
+/*----------------------------------------------------------------------------*/
+void BlockingFileData::read(const std::string& fileName, bool withGeom)
+{
+    const bool binary = isBinaryFileName(fileName);
+    std::ifstream str(fileName.c_str(), binary ? std::ios::in | std::ios::binary : std::ios::in);
+    if (!str) {
+        std::string mess = "Impossible to read file " + fileName;
+        throw TkUtil::Exception(mess);
+    }
+    if (binary)
+        readBinary(str, withGeom);
+    else
+        readASCII(str, withGeom);
+}
+/*----------------------------------------------------------------------------*/
+void BlockingFileData::write(const std::string& fileName, bool withGeom) const
+{
+    const bool binary = isBinaryFileName(fileName);
+    std::ofstream str(fileName.c_str(), binary ? std::ios::out | std::ios::binary : std::ios::out);
+    if (!str){
+        std::string s ="Impossible to create a Blocking File: "+fileName;
+        throw TkUtil::Exception (TkUtil::UTF8String (s));
+    }
+    if (binary)
+        writeBinary(str, withGeom);
+    else
+        writeASCII(str, withGeom);
+}
+/*----------------------------------------------------------------------------*/
+void BlockingFileData::check(bool withGeom) const
+{
+    if (m_points.size() % 3 != 0 || m_edges.size() % 2 != 0 || m_block_nodes.size() % 8 != 0)
+        corruptedError("array sizes");
+    const size_t nb_nodes = getNbVertices();
+    const size_t nb_edges = getNbCoEdges();
+    const size_t nb_blocks = getNbBlocks();
+    checkIndices(m_edges, nb_nodes, "edge vertex");
+
+    if (!m_face_offsets.empty() && (m_face_offsets.size()-1) % 4 != 0)
+        corruptedError("face sides");
+    const size_t nb_faces = getNbCoFaces();
+    if (nb_faces != 0 || !m_face_edges.empty())
+        checkOffsets(m_face_offsets, 4*nb_faces, m_face_edges.size(), "face sides");
+    checkIndices(m_face_edges, nb_edges, "face edge");
+
+    if (m_discr_types.size() != nb_edges || m_discr_nbs.size() != nb_edges || m_discr_subtypes.size() != nb_edges)
+        corruptedError("discretizations");
+    checkOffsets(m_discr_param_offsets, nb_edges, m_discr_params.size(), "discretization parameters");
+    checkOffsets(m_discr_ref_offsets, nb_edges, m_discr_refs.size(), "discretization references");
+    for (size_t i = 0; i < nb_edges; i++) {
+        const int nb_params = m_discr_param_offsets[i+1] - m_discr_param_offsets[i];
+        const int nb_refs = m_discr_ref_offsets[i+1] - m_discr_ref_offsets[i];
+        // nombre de paramètres attendu suivant le type (cf readASCII)
+        int expected = 0;
+        size_t nb_referenced = nb_edges;
+        switch (m_discr_types[i]) {
+        case 0: case 7: break;
+        case 1: case 4: case 8: expected = 1; break;
+        case 3: case 9: expected = 2; break;
+        case 2: expected = 4; break;
+        case 5:
+            if (m_discr_subtypes[i] == 1) {
+                if (nb_refs != 1)
+                    corruptedError("interpolation face");
+                nb_referenced = nb_faces;
+            }
+            else if (m_discr_subtypes[i] != 0)
+                corruptedError("interpolation type");
+            break;
+        case 6:
+            if (m_discr_subtypes[i] < 0 || m_discr_subtypes[i] > nb_refs)
+                corruptedError("global interpolation");
+            break;
+        default: {
+            std::string mess = "BLK read error: type of discretization not supported";
+            throw TkUtil::Exception(mess);
+        }
+        }
+        if (nb_params != expected || (m_discr_types[i] != 5 && m_discr_types[i] != 6 && nb_refs != 0))
+            corruptedError("discretization parameters");
+        for (int r = m_discr_ref_offsets[i]; r < m_discr_ref_offsets[i+1]; r++)
+            if (m_discr_refs[r] < 0 || (size_t)m_discr_refs[r] >= nb_referenced)
+                corruptedError("interpolation reference");
+    }
+
+    checkIndices(m_block_nodes, nb_nodes, "block vertex");
+    if (nb_blocks != 0 || !m_block_faces.empty() || m_block_offsets.size() > 1)
+        checkOffsets(m_block_offsets, 6*nb_blocks, m_block_faces.size(), "block sides");
+    checkIndices(m_block_faces, nb_faces, "block face");
+
+    if (withGeom) {
+        const size_t nb_entities[4] = {nb_nodes, nb_edges, nb_faces, nb_blocks};
+        for (int d = 0; d < 4; d++) {
+            if (m_assoc[d].size() % 3 != 0)
+                corruptedError("geometric associations");
+            for (size_t i = 0; i < m_assoc[d].size(); i += 3)
+                if (m_assoc[d][i] < 0 || (size_t)m_assoc[d][i] >= nb_entities[d])
+                    corruptedError("geometric association");
+        }
+    }
+}
+/*----------------------------------------------------------------------------*/
+void BlockingFileData::closeDiscr()
+{
+    m_discr_param_offsets.push_back(m_discr_params.size());
+    m_discr_ref_offsets.push_back(m_discr_refs.size());
+}
+/*----------------------------------------------------------------------------*/
+void BlockingFileData::readASCII(std::istream& s, bool withGeom)
+{
+    AsciiTokenizer str(s);
+
+    if (!str.moveOntoFirst("POINTS")) {
+        std::string mess = "BLK read error: no POINTS keyword found";
+        throw TkUtil::Exception(mess);
+    }
+    const int nb_nodes = str.nextCount();
+    m_points.resize(3*nb_nodes);
+    for (int i = 0; i < 3*nb_nodes; i++)
+        m_points[i] = str.nextDouble();
+
+    if (!str.moveOntoFirst("EDGES")) {
+        std::string mess = "BLK read error: no EDGES keyword found";
+        throw TkUtil::Exception(mess);
+    }
+    const int nb_edges = str.nextCount();
+    m_edges.resize(2*nb_edges);
+    for (int i = 0; i < 2*nb_edges; i++)
+        m_edges[i] = str.nextInt();
+
+    if (!str.moveOntoFirst("FACES")) {
+        std::string mess = "BLK read error: no FACES keyword found";
+        throw TkUtil::Exception(mess);
+    }
+    const int nb_faces = str.nextCount();
+    m_face_offsets.assign(1, 0);
+    m_face_offsets.reserve(4*nb_faces+1);
+    m_face_edges.clear();
+    for (int i = 0; i < 4*nb_faces; i++) {
+        str.nextList(m_face_edges);
+        m_face_offsets.push_back(m_face_edges.size());
+    }
+
+    if (!str.moveOntoFirst("Discr")) {
+        std::string mess = "BLK read error: no Discr keyword found";
+        throw TkUtil::Exception(mess);
+    }
+    const int nb_discr = str.nextCount();
+    if (nb_edges != nb_discr) {
+        std::string mess = "BLK read error: number of discretization info different from number of edges";
+        throw TkUtil::Exception(mess);
+    }
+    m_discr_types.resize(nb_discr);
+    m_discr_nbs.resize(nb_discr);
+    m_discr_subtypes.assign(nb_discr, 0);
+    m_discr_param_offsets.assign(1, 0);
+    m_discr_ref_offsets.assign(1, 0);
+    m_discr_params.clear();
+    m_discr_refs.clear();
+    for (int i = 0; i < nb_discr; i++) {
+        const int disc_type = str.nextInt();
+        m_discr_types[i] = disc_type;
+        m_discr_nbs[i] = str.nextInt();
+        int nb_params = 0;
+        switch (disc_type) {
+        case 0: case 7: nb_params = 0; break;
+        case 1: case 4: case 8: nb_params = 1; break;
+        case 3: case 9: nb_params = 2; break;
+        case 2: nb_params = 4; break;
+        case 5:
+            m_discr_subtypes[i] = str.nextInt();
+            str.nextList(m_discr_refs);
+            break;
+        case 6:
+            str.nextList(m_discr_refs);
+            m_discr_subtypes[i] = m_discr_refs.size() - m_discr_ref_offsets.back();
+            str.nextList(m_discr_refs);
+            break;
+        default: {
+            std::string mess = "BLK read error: type of discretization not supported";
+            throw TkUtil::Exception(mess);
+        }
+        }
+        for (int p = 0; p < nb_params; p++)
+            m_discr_params.push_back(str.nextDouble());
+        closeDiscr();
+    }
+
+    if (!str.moveOntoFirst("BLOCKS")) {
+        std::string mess = "BLK read error: no BLOCKS keyword found";
+        throw TkUtil::Exception(mess);
+    }
+    const int nb_blocks = str.nextCount();
+    m_block_nodes.resize(8*nb_blocks);
+    m_block_offsets.assign(1, 0);
+    m_block_offsets.reserve(6*nb_blocks+1);
+    m_block_faces.clear();
+    for (int i = 0; i < nb_blocks; i++) {
+        for (int j = 0; j < 8; j++)
+            m_block_nodes[8*i+j] = str.nextInt();
+        for (int f_i = 0; f_i < 6; f_i++) {
+            str.nextList(m_block_faces);
+            m_block_offsets.push_back(m_block_faces.size());
+        }
+    }
+
+    if (withGeom) {
+        for (int d = 0; d < 4; d++) {
+            if (!str.moveOntoFirst(ASSOC_KEYWORDS[d]))
+                throw TkUtil::Exception(TkUtil::UTF8String(ASSOC_ERRORS[d], TkUtil::Charset::UTF_8));
+            const int nb_assoc = str.nextCount();
+            m_assoc[d].resize(3*nb_assoc);
+            for (int i = 0; i < 3*nb_assoc; i++)
+                m_assoc[d][i] = str.nextInt();
+        }
+    }
+    check(withGeom);
+}
+/*----------------------------------------------------------------------------*/
+void BlockingFileData::writeASCII(std::ostream& str, bool withGeom) const
+{
+    str << "# Mgx DataFile Version 1.0\n";
+    str << "Generated by Mgx Writer 2.6.3\n\n";
+    str << "ASCII\n";
+
+    const size_t nb_nodes = getNbVertices();
+    str  << "POINTS " << nb_nodes << "\n";
+    for (size_t i = 0; i < nb_nodes; i++)
+        str << m_points[3*i] <<  " " << m_points[3*i+1] << " " << m_points[3*i+2] << "\n";
+    str  <<"\n\n";
+
+    const size_t nb_edges = getNbCoEdges();
+    str  << "EDGES " << nb_edges << "\n";
+    for (size_t i = 0; i < nb_edges; i++)
+        str << m_edges[2*i] <<  " " << m_edges[2*i+1] << "\n";
+    str  << "Discr " << nb_edges << "\n";
+    for (size_t i = 0; i < nb_edges; i++) {
+        str << m_discr_types[i] <<  " " << m_discr_nbs[i];
+        const int* refs = m_discr_refs.data() + m_discr_ref_offsets[i];
+        const int nb_refs = m_discr_ref_offsets[i+1] - m_discr_ref_offsets[i];
+        if (m_discr_types[i] == 5) {
+            str << " " << m_discr_subtypes[i] << " [ ";
+            for (int r = 0; r < nb_refs; r++)
+                str << refs[r] << " ";
+            str << "] ";
+        }
+        else if (m_discr_types[i] == 6) {
+            str << " [ ";
+            for (int r = 0; r < nb_refs; r++) {
+                if (r == m_discr_subtypes[i])
+                    str << "] [ ";
+                str << refs[r] << " ";
+            }
+            if (nb_refs == m_discr_subtypes[i])
+                str << "] [ ";
+            str << "] ";
+        }
+        for (int p = m_discr_param_offsets[i]; p < m_discr_param_offsets[i+1]; p++)
+            str << " " << m_discr_params[p];
+        str << "\n";
+    }
+    str  <<"\n\n";
+
+    const size_t nb_faces = getNbCoFaces();
+    str  << "FACES " << nb_faces << "\n";
+    for (size_t i = 0; i < nb_faces; i++) {
+        for (int j = 0; j < 4; j++) {
+            str << (j == 0 ? "[ " : "] [ ");
+            for (int e = m_face_offsets[4*i+j]; e < m_face_offsets[4*i+j+1]; e++)
+                str << m_face_edges[e] << " ";
+        }
+        str << "]\n";
+    }
+    str << "\n";
+
+    const size_t nb_blocks = getNbBlocks();
+    str  << "BLOCKS " << nb_blocks << "\n";
+    for (size_t i = 0; i < nb_blocks; i++) {
+        for (int j = 0; j < 8; j++)
+            str << m_block_nodes[8*i+j] << " ";
+        for (int j = 0; j < 6; j++) {
+            str << (j == 0 ? "[ " : "] [ ");
+            for (int f = m_block_offsets[6*i+j]; f < m_block_offsets[6*i+j+1]; f++)
+                str << m_block_faces[f] << " ";
+        }
+        str << "]\n";
+    }
+    str  << "\n";
+
+    if (withGeom) {
+        for (int d = 0; d < 4; d++) {
+            const size_t nb_assoc = m_assoc[d].size()/3;
+            str  << ASSOC_KEYWORDS[d] << " " << nb_assoc << "\n";
+            for (size_t i = 0; i < nb_assoc; i++)
+                str << m_assoc[d][3*i] << " " << m_assoc[d][3*i+1] << " " << m_assoc[d][3*i+2] << "\n";
+            if (d != 3)
+                str  << "\n";
+        }
+    }
+}
+/*----------------------------------------------------------------------------*/
+void BlockingFileData::readBinary(std::istream& str, bool withGeom)
+{
+    char magic[sizeof(BINARY_MAGIC)];
+    uint32_t version = 0;
+    if (!str.read(magic, sizeof(magic)) || memcmp(magic, BINARY_MAGIC, sizeof(magic)) != 0)
+        throw TkUtil::Exception(TkUtil::UTF8String("BLK read error: not a Mgx binary blocking file", TkUtil::Charset::UTF_8));
+    readRaw(str, &version, 1);
+    if (version > BINARY_VERSION) {
+        TkUtil::UTF8String mess(TkUtil::Charset::UTF_8);
+        mess << "BLK read error: binary format version " << (unsigned long)version << " not supported";
+        throw TkUtil::Exception(mess);
+    }
+
+    // taille du fichier, pour vérifier celle des sections
+    const std::streampos start = str.tellg();
+    str.seekg(0, std::ios::end);
+    const std::streampos file_end = str.tellg();
+    str.seekg(start);
+
+    bool found[5] = {false, false, false, false, false};
+    bool found_assoc[4] = {false, false, false, false};
+    char tag[4];
+    while (str.read(tag, 4)) {
+        uint64_t size = 0;
+        readRaw(str, &size, 1);
+        if (size > (uint64_t)(file_end - str.tellg()))
+            throw TkUtil::Exception(TkUtil::UTF8String("BLK read error: truncated binary file", TkUtil::Charset::UTF_8));
+        const std::streampos end = str.tellg() + (std::streamoff)size;
+        const std::string t(tag, 4);
+        if (t == "PNTS") {
+            readArray(str, m_points, end);
+            found[0] = true;
+        }
+        else if (t == "EDGS") {
+            readArray(str, m_edges, end);
+            found[1] = true;
+        }
+        else if (t == "DISC") {
+            readArray(str, m_discr_types, end);
+            readArray(str, m_discr_nbs, end);
+            readArray(str, m_discr_subtypes, end);
+            readArray(str, m_discr_param_offsets, end);
+            readArray(str, m_discr_params, end);
+            readArray(str, m_discr_ref_offsets, end);
+            readArray(str, m_discr_refs, end);
+            found[2] = true;
+        }
+        else if (t == "FACE") {
+            readArray(str, m_face_offsets, end);
+            readArray(str, m_face_edges, end);
+            found[3] = true;
+        }
+        else if (t == "BLCK") {
+            readArray(str, m_block_nodes, end);
+            readArray(str, m_block_offsets, end);
+            readArray(str, m_block_faces, end);
+            found[4] = true;
+        }
+        else {
+            for (int d = 0; d < 4; d++)
+                if (t == ASSOC_TAGS[d]) {
+                    readArray(str, m_assoc[d], end);
+                    found_assoc[d] = true;
+                }
+        }
+        // section inconnue (version ultérieure) ou partiellement lue
+        str.seekg(end);
+    }
+
+    const char* keywords[5] = {"POINTS", "EDGES", "Discr", "FACES", "BLOCKS"};
+    for (int i = 0; i < 5; i++)
+        if (!found[i]) {
+            std::string mess = std::string("BLK read error: no ") + keywords[i] + " section found";
+            throw TkUtil::Exception(mess);
+        }
+    if (m_discr_types.size() != getNbCoEdges()) {
+        std::string mess = "BLK read error: number of discretization info different from number of edges";
+        throw TkUtil::Exception(mess);
+    }
+    if (withGeom)
+        for (int d = 0; d < 4; d++)
+            if (!found_assoc[d])
+                throw TkUtil::Exception(TkUtil::UTF8String(ASSOC_ERRORS[d], TkUtil::Charset::UTF_8));
+    check(withGeom);
+}
+/*----------------------------------------------------------------------------*/
+void BlockingFileData::writeBinary(std::ostream& str, bool withGeom) const
+{
+    str.write(BINARY_MAGIC, sizeof(BINARY_MAGIC));
+    const uint32_t version = BINARY_VERSION;
+    writeRaw(str, &version, 1);
+
+    writeSectionHeader(str, "PNTS", arraySize(m_points));
+    writeArray(str, m_points);
+    writeSectionHeader(str, "EDGS", arraySize(m_edges));
+    writeArray(str, m_edges);
+    writeSectionHeader(str, "DISC", arraySize(m_discr_types) + arraySize(m_discr_nbs)
+            + arraySize(m_discr_subtypes) + arraySize(m_discr_param_offsets)
+            + arraySize(m_discr_params) + arraySize(m_discr_ref_offsets) + arraySize(m_discr_refs));
+    writeArray(str, m_discr_types);
+    writeArray(str, m_discr_nbs);
+    writeArray(str, m_discr_subtypes);
+    writeArray(str, m_discr_param_offsets);
+    writeArray(str, m_discr_params);
+    writeArray(str, m_discr_ref_offsets);
+    writeArray(str, m_discr_refs);
+    writeSectionHeader(str, "FACE", arraySize(m_face_offsets) + arraySize(m_face_edges));
+    writeArray(str, m_face_offsets);
+    writeArray(str, m_face_edges);
+    writeSectionHeader(str, "BLCK", arraySize(m_block_nodes) + arraySize(m_block_offsets) + arraySize(m_block_faces));
+    writeArray(str, m_block_nodes);
+    writeArray(str, m_block_offsets);
+    writeArray(str, m_block_faces);
+    if (withGeom)
+        for (int d = 0; d < 4; d++) {
+            writeSectionHeader(str, ASSOC_TAGS[d], arraySize(m_assoc[d]));
+            writeArray(str, m_assoc[d]);
+        }
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Topo
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
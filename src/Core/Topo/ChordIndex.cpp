@@ -0,0 +1,194 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file ChordIndex.cpp
+ *
+ *  \date 19 oct. 2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Topo/ChordIndex.h"
+#include "Topo/Block.h"
+#include "Topo/CoFace.h"
+#include "Topo/CoEdge.h"
+/*----------------------------------------------------------------------------*/
+#include <TkUtil/Exception.h>
+#include <TkUtil/MemoryError.h>
+/*----------------------------------------------------------------------------*/
+#include <unordered_set>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Topo {
+/*----------------------------------------------------------------------------*/
+ChordIndex::ChordIndex()
+: m_revision(0)
+, m_indexRevision(0)
+{
+}
+/*----------------------------------------------------------------------------*/
+ChordIndex::~ChordIndex()
+{
+}
+/*----------------------------------------------------------------------------*/
+void ChordIndex::getChord(CoEdge* coedge, std::vector<CoEdge*>& coedges,
+		std::vector<bool>& inverted)
+{
+	CHECK_NULL_PTR_ERROR(coedge);
+	std::lock_guard<std::mutex> lock(m_mutex);
+	checkRevision();
+
+	uint ind = chordIndex(coedge);
+	const Chord& chord = m_chords[ind];
+	// le sens est donné par rapport à l'arête demandée
+	uint pos = m_coedge_chord[coedge].second;
+	bool ref = chord.m_inverted[pos];
+
+	coedges.clear();
+	inverted.clear();
+	coedges.reserve(chord.m_coedges.size());
+	inverted.reserve(chord.m_coedges.size());
+	coedges.push_back(coedge);
+	inverted.push_back(false);
+	for (uint i=0; i<chord.m_coedges.size(); i++)
+		if (i != pos){
+			coedges.push_back(chord.m_coedges[i]);
+			inverted.push_back(chord.m_inverted[i] != ref);
+		}
+}
+/*----------------------------------------------------------------------------*/
+void ChordIndex::getSheet(CoEdge* coedge, std::vector<Block*>& blocks)
+{
+	CHECK_NULL_PTR_ERROR(coedge);
+	std::lock_guard<std::mutex> lock(m_mutex);
+	checkRevision();
+
+	Chord& chord = m_chords[chordIndex(coedge)];
+	if (!chord.m_sheetComputed){
+		std::unordered_set<Block*> filtre_blocs;
+		for (CoEdge* ce : chord.m_coedges)
+			for (Block* bl : ce->getBlocks())
+				if (filtre_blocs.insert(bl).second)
+					chord.m_blocks.push_back(bl);
+		chord.m_sheetComputed = true;
+	}
+	blocks = chord.m_blocks;
+}
+/*----------------------------------------------------------------------------*/
+void ChordIndex::getColumn(CoFace* coface, std::vector<CoFace*>& cofaces,
+		std::vector<Block*>& blocks)
+{
+	CHECK_NULL_PTR_ERROR(coface);
+	std::lock_guard<std::mutex> lock(m_mutex);
+	checkRevision();
+
+	const Column& column = m_columns[columnIndex(coface)];
+	cofaces = column.m_cofaces;
+	blocks = column.m_blocks;
+}
+/*----------------------------------------------------------------------------*/
+void ChordIndex::checkRevision()
+{
+	unsigned long revision = m_revision;
+	if (revision != m_indexRevision){
+		m_coedge_chord.clear();
+		m_chords.clear();
+		m_coface_column.clear();
+		m_columns.clear();
+		m_indexRevision = revision;
+	}
+}
+/*----------------------------------------------------------------------------*/
+uint ChordIndex::chordIndex(CoEdge* coedge)
+{
+	auto iter = m_coedge_chord.find(coedge);
+	if (iter != m_coedge_chord.end())
+		return iter->second.first;
+
+	uint ind = m_chords.size();
+	m_chords.push_back(Chord());
+	Chord& chord = m_chords.back();
+	chord.m_sheetComputed = false;
+
+	// parcours en largeur des arêtes opposées, chaque arête n'est vue qu'une fois
+	chord.m_coedges.push_back(coedge);
+	chord.m_inverted.push_back(false);
+	m_coedge_chord[coedge] = std::make_pair(ind, 0u);
+
+	for (uint k=0; k<chord.m_coedges.size(); k++){
+		CoEdge* coedge_dep = chord.m_coedges[k];
+		bool inverted_dep = chord.m_inverted[k];
+
+		for (CoFace* coface : coedge_dep->getCoFaces()){
+			bool inverse_sens;
+			CoEdge* coedge_vois = coface->getOppositeCoEdge(coedge_dep, inverse_sens);
+
+			if (coedge_vois && m_coedge_chord.find(coedge_vois) == m_coedge_chord.end()){
+				m_coedge_chord[coedge_vois] = std::make_pair(ind, (uint)chord.m_coedges.size());
+				chord.m_coedges.push_back(coedge_vois);
+				chord.m_inverted.push_back(inverted_dep ? inverse_sens : !inverse_sens);
+			}
+		} // end for coface
+	} // end for k
+
+	return ind;
+}
+/*----------------------------------------------------------------------------*/
+uint ChordIndex::columnIndex(CoFace* coface)
+{
+	auto iter = m_coface_column.find(coface);
+	if (iter != m_coface_column.end())
+		return iter->second;
+
+	uint ind = m_columns.size();
+	m_columns.push_back(Column());
+	Column& column = m_columns.back();
+
+	column.m_cofaces.push_back(coface);
+	m_coface_column[coface] = ind;
+
+	std::unordered_set<Block*> filtre_blocs;
+	for (uint k=0; k<column.m_cofaces.size(); k++){
+		CoFace* coface_dep = column.m_cofaces[k];
+
+		for (Block* block : coface_dep->getBlocks()){
+			if (filtre_blocs.insert(block).second)
+				column.m_blocks.push_back(block);
+
+			CoFace* coface_vois = getOppositeCoFace(block, coface_dep);
+			if (coface_vois && m_coface_column.find(coface_vois) == m_coface_column.end()){
+				m_coface_column[coface_vois] = ind;
+				column.m_cofaces.push_back(coface_vois);
+			}
+		} // end for block
+	} // end for k
+
+	return ind;
+}
+/*----------------------------------------------------------------------------*/
+CoFace* ChordIndex::getOppositeCoFace(Block* block, CoFace* coface)
+{
+	std::vector<CoFace*> block_cofaces = block->getCoFaces();
+	if (block_cofaces.size() != 6)
+		return 0;
+
+	// la face opposée est celle qui n'a aucune arête en commun
+	std::vector<CoEdge*> coedges = coface->getCoEdges();
+	std::unordered_set<CoEdge*> filtre_coedges(coedges.begin(), coedges.end());
+	for (CoFace* cf : block_cofaces){
+		if (cf == coface)
+			continue;
+		bool common = false;
+		for (CoEdge* ce : cf->getCoEdges())
+			if (filtre_coedges.find(ce) != filtre_coedges.end()){
+				common = true;
+				break;
+			}
+		if (!common)
+			return cf;
+	}
+	return 0;
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Topo
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
@@ -285,7 +285,7 @@ free(Internal::InfoCommand* icmd)
 
     // on retire la relation avec la géométrie
     if (icmd && getGeomAssociation()
-             && icmd->getTopoInfoEntity()[this] != Internal::InfoCommand::NONE){
+             && icmd->getTopoInfoEntityType(this) != Internal::InfoCommand::NONE){
         saveTopoProperty();
         setGeomAssociation(0);
     }
@@ -1054,7 +1054,9 @@ void CoEdge::getPoints(std::vector<Utils::Math::Point> &points) const
 	}
 	else if (isPreMeshed()){
 
-		std::vector<Utils::Math::Point>& ref_points = m_mesh_data->points();
+		// lecture seule, sans dupliquer des points éventuellement partagés avec une sauvegarde
+		const CoEdgeMeshingData* mesh_data = m_mesh_data;
+		const std::vector<Utils::Math::Point>& ref_points = mesh_data->points();
 		if (ref_points.begin() != points.begin())
 			for (uint i=0; i<ref_points.size(); i++)
 				points.push_back(ref_points[i]);
@@ -2096,7 +2098,7 @@ getDescription (bool alsoComputed) const
 
     if (isMeshed()){
         topoProprietes.addProperty (
-                Utils::SerializedRepresentation::Property ("Nombre de noeuds", (long)m_mesh_data->nodes().size()));
+                Utils::SerializedRepresentation::Property ("Nombre de noeuds", (long)getMeshingData()->nodes().size()));
     }
 
 
@@ -2248,7 +2250,7 @@ saveCoEdgeTopoProperty(Internal::InfoCommand* icmd)
     if (icmd) {
 #ifdef _DEBUG2
         std::cout<<"CoEdge::saveCoEdgeTopoProperty pour "<<getName()<<", valeur initiale: "
-        		<<Internal::InfoCommand::type2String(icmd->getTopoInfoEntity()[this])<<std::endl;
+        		<<Internal::InfoCommand::type2String(icmd->getTopoInfoEntityType(this))<<std::endl;
 #endif
         bool change = icmd->addTopoInfoEntity(this,Internal::InfoCommand::DISPMODIFIED);
 #ifdef _DEBUG2
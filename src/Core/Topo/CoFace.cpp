@@ -640,7 +640,7 @@ free(Internal::InfoCommand* icmd)
 
     // on retire la relation avec la géométrie
     if (icmd && getGeomAssociation()
-             && icmd->getTopoInfoEntity()[this] != Internal::InfoCommand::NONE){
+             && icmd->getTopoInfoEntityType(this) != Internal::InfoCommand::NONE){
         saveTopoProperty();
         setGeomAssociation(0);
     }
@@ -2304,10 +2304,10 @@ getDescription (bool alsoComputed) const
 
     if (isMeshed()){
         topoProprietes.addProperty (
-                Utils::SerializedRepresentation::Property ("Nombre de noeuds", (long)m_mesh_data->nodes().size()));
+                Utils::SerializedRepresentation::Property ("Nombre de noeuds", (long)getMeshingData()->nodes().size()));
 
         topoProprietes.addProperty (
-                Utils::SerializedRepresentation::Property ("Nombre de polygones", (long)m_mesh_data->faces().size()));
+                Utils::SerializedRepresentation::Property ("Nombre de polygones", (long)getMeshingData()->faces().size()));
     }
 
 
@@ -35,13 +35,10 @@ TopoManager& CommandChangeDefaultNbMeshingEdges::getTopoManager()
 void CommandChangeDefaultNbMeshingEdges::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandChangeDefaultNbMeshingEdges::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandChangeDefaultNbMeshingEdges::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     getTopoManager().m_defaultNbMeshingEdges = m_new_nb_meshing_edges;
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandChangeDefaultNbMeshingEdges::
@@ -34,9 +34,8 @@ CommandChangeVertexSameLocation::
 void CommandChangeVertexSameLocation::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandChangeVertexSameLocation::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandChangeVertexSameLocation::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     m_vertex->saveVertexGeomProperty(&getInfoCommand(), true);
     m_vertex->setCoord(m_target->getCoord());
@@ -53,8 +52,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandChangeVertexSameLocation::getPreviewRepresentation(Utils::DisplayRepresentation& dr)
@@ -60,6 +60,37 @@ CommandChangeVerticesLocation(Internal::Context& c,
 }
 /*----------------------------------------------------------------------------*/
 CommandChangeVerticesLocation::
+CommandChangeVerticesLocation(Internal::Context& c,
+        std::vector<Vertex*> & vertices,
+        std::vector<Utils::Math::Point> & points)
+:CommandEditTopo(c, "Modification de la position de sommets topologiques")
+, m_vertices(vertices.begin(), vertices.end())
+, m_typeCoord(cartesian)
+, m_changeX(true)
+, m_xPos(0.0)
+, m_changeY(true)
+, m_yPos(0.0)
+, m_changeZ(true)
+, m_zPos(0.0)
+, m_rep(0)
+, m_points(points.begin(), points.end())
+{
+	if (m_points.size() != m_vertices.size())
+		throw TkUtil::Exception ("Erreur interne, CommandChangeVerticesLocation avec un nombre de positions différent du nombre de sommets");
+
+	TkUtil::UTF8String	comments (TkUtil::Charset::UTF_8);
+	comments << "Modification de la position des sommets topologiques";
+	for (uint i=0; i<vertices.size() && i<5; i++)
+		comments << " " << vertices[i]->getName();
+	if (vertices.size()>5)
+		comments << " ... ";
+	comments << " (" << (long)vertices.size() << " positions)";
+
+	setScriptComments(comments);
+    setName(comments);
+}
+/*----------------------------------------------------------------------------*/
+CommandChangeVerticesLocation::
 ~CommandChangeVerticesLocation()
 {
 }
@@ -67,18 +98,16 @@ CommandChangeVerticesLocation::
 void CommandChangeVerticesLocation::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandChangeVerticesLocation::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandChangeVerticesLocation::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     // liste des blocs modifiés
     std::vector<Topo::Block*> blocks;
     // liste des cofaces modifiées
     std::vector<Topo::CoFace*> cofaces;
 
-    for (std::vector<Vertex*>::iterator iter = m_vertices.begin();
-            iter != m_vertices.end(); ++iter){
-        Vertex* vtx = *iter;
+    for (size_t i=0; i<m_vertices.size(); i++){
+        Vertex* vtx = m_vertices[i];
         vtx->saveVertexGeomProperty(&getInfoCommand(), true);
 
         Utils::Math::Point newPt;
@@ -89,7 +118,11 @@ internalExecute()
         if (m_rep)
         	oldPt = m_rep->toLocal(oldPt);
 
-        if (m_typeCoord == cartesian) {
+        if (!m_points.empty()) {
+        	// déplacement en bloc, une position par sommet
+        	newPt = m_points[i];
+        }
+        else if (m_typeCoord == cartesian) {
             newPt.setX(m_changeX?m_xPos:oldPt.getX());
             newPt.setY(m_changeY?m_yPos:oldPt.getY());
             newPt.setZ(m_changeZ?m_zPos:oldPt.getZ());
@@ -133,8 +166,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandChangeVerticesLocation::getPreviewRepresentation(Utils::DisplayRepresentation& dr)
@@ -72,8 +72,7 @@ internalExecute()
 	// la liste des entités géométriques détruites
 	findTopoEntities();
 
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandDestroyTopo::execute pour la commande " << getName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandDestroyTopo::execute pour la commande " << getName ( ));
 
     for (std::vector<Topo::TopoEntity*>::iterator iter = m_topo_entities.begin();
     		iter != m_topo_entities.end(); ++iter)
@@ -121,8 +120,6 @@ internalExecute()
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
 
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
-
 
     // vérification des liaisons pour les arêtes avec méthode interpolée
     checkInterpolates();
@@ -390,15 +387,14 @@ void CommandDestroyTopo::checkInterpolates()
 	std::map<std::string, uint> deletedCoEdges;
 	std::map<std::string, uint> deletedCoFaces;
 	Internal::InfoCommand& ifc = getInfoCommand();
-	std::map<Topo::TopoEntity*, Internal::InfoCommand::type> tei = ifc.getTopoInfoEntity();
-
-	for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::const_iterator iter = tei.begin();
-			iter != tei.end(); ++iter){
-		//std::cout<<" observation pour "<<iter->first->getName()<<" de type "<<Internal::InfoCommand::type2String(iter->second)<<std::endl;
-		if (iter->first->getType() ==  Utils::Entity::TopoCoEdge && iter->second == Internal::InfoCommand::DELETED)
-			deletedCoEdges[iter->first->getName()] = 1;
-		else if (iter->first->getType() ==  Utils::Entity::TopoCoFace && iter->second == Internal::InfoCommand::DELETED)
-			deletedCoFaces[iter->first->getName()] = 1;
+	std::vector<Internal::InfoCommand::TopoEntityInfo> tei = ifc.getTopoInfoEntity();
+
+	for (uint i_tei=0; i_tei<tei.size(); i_tei++){
+		//std::cout<<" observation pour "<<tei[i_tei].m_topo_entity->getName()<<" de type "<<Internal::InfoCommand::type2String(tei[i_tei].m_type)<<std::endl;
+		if (tei[i_tei].m_topo_entity->getType() ==  Utils::Entity::TopoCoEdge && tei[i_tei].m_type == Internal::InfoCommand::DELETED)
+			deletedCoEdges[tei[i_tei].m_topo_entity->getName()] = 1;
+		else if (tei[i_tei].m_topo_entity->getType() ==  Utils::Entity::TopoCoFace && tei[i_tei].m_type == Internal::InfoCommand::DELETED)
+			deletedCoFaces[tei[i_tei].m_topo_entity->getName()] = 1;
 	}
 	// parcours des arêtes existantes dans le manager
 	auto coedges = getContext().getTopoManager().getCoEdgesObj();
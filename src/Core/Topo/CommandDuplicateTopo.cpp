@@ -78,9 +78,8 @@ CommandDuplicateTopo::
 void CommandDuplicateTopo::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandDuplicateTopo::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandDuplicateTopo::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
 #ifdef _DEBUG_DUPTOPO
     std::cout<<"CommandDuplicateTopo::internalExecute() ..."<<std::endl;
@@ -107,8 +106,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandDuplicateTopo::
@@ -3,6 +3,8 @@
 #include "Internal/InfoCommand.h"
 #include "Topo/CommandEditTopo.h"
 #include "Topo/TopoManager.h"
+#include "Topo/ChordIndex.h"
+#include "Topo/TopoPreviewTask.h"
 #include "Topo/TopoEntity.h"
 #include "Topo/Vertex.h"
 #include "Topo/Edge.h"
@@ -72,6 +74,7 @@ internalUndo()
     // les entités détruites sont dites créées et inversement
     getInfoCommand().permCreatedDeleted();
 
+    getTopoManager().getChordIndex().topologyModified();
 }
 /*----------------------------------------------------------------------------*/
 void CommandEditTopo::
@@ -85,6 +88,7 @@ internalRedo()
     // permute toutes les propriétés internes avec leur sauvegarde
     permInternalsStats();
 
+    getTopoManager().getChordIndex().topologyModified();
 }
 /*----------------------------------------------------------------------------*/
 void CommandEditTopo::
@@ -95,10 +99,9 @@ saveInternalsStats()
 #endif
     Internal::InfoCommand& icmd = getInfoCommand();
 
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>&  topo_entities_info = icmd.getTopoInfoEntity();
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
-            iter_tei != topo_entities_info.end(); ++iter_tei){
-        Topo::TopoEntity* te = iter_tei->first;
+    std::vector<Internal::InfoCommand::TopoEntityInfo>&  topo_entities_info = icmd.getTopoInfoEntity();
+    for (uint i_tei=0; i_tei<topo_entities_info.size(); i_tei++){
+        Topo::TopoEntity* te = topo_entities_info[i_tei].m_topo_entity;
         te->saveInternals(this);
 #ifdef _DEBUG_CANCEL
         std::cout<<"saveInternals pour "<<te->getName()<<std::endl;
@@ -184,12 +187,11 @@ void CommandEditTopo::deleteCreated()
     // elles avaient été créées avec la commande
     Internal::InfoCommand& icmd = getInfoCommand();
 
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>&  topo_entities_info = icmd.getTopoInfoEntity();
+    std::vector<Internal::InfoCommand::TopoEntityInfo>&  topo_entities_info = icmd.getTopoInfoEntity();
 
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
-            iter_tei != topo_entities_info.end(); ++iter_tei){
-        Topo::TopoEntity* te = iter_tei->first;
-        Internal::InfoCommand::type t = iter_tei->second;
+    for (uint i_tei=0; i_tei<topo_entities_info.size(); i_tei++){
+        Topo::TopoEntity* te = topo_entities_info[i_tei].m_topo_entity;
+        Internal::InfoCommand::type t = topo_entities_info[i_tei].m_type;
         //te->setDestroyed(true);
         //std::cout<<"te : "<<te->getName()<<", t = "<<Internal::InfoCommand::type2String(t)<<std::endl;
         if (t == Internal::InfoCommand::DELETED){
@@ -242,12 +244,11 @@ deleteMarkedDeleted()
     // elles avaient été créées avec la commande
     Internal::InfoCommand& icmd = getInfoCommand();
 
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>&  topo_entities_info = icmd.getTopoInfoEntity();
+    std::vector<Internal::InfoCommand::TopoEntityInfo>&  topo_entities_info = icmd.getTopoInfoEntity();
 
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
-            iter_tei != topo_entities_info.end(); ++iter_tei){
-        Topo::TopoEntity* te = iter_tei->first;
-        Internal::InfoCommand::type t = iter_tei->second;
+    for (uint i_tei=0; i_tei<topo_entities_info.size(); i_tei++){
+        Topo::TopoEntity* te = topo_entities_info[i_tei].m_topo_entity;
+        Internal::InfoCommand::type t = topo_entities_info[i_tei].m_type;
         //std::cout<<"te : "<<te->getName()<<", t = "<<Internal::InfoCommand::type2String(t)<<std::endl;
         if (t == Internal::InfoCommand::DELETED){
             delete te;
@@ -258,16 +259,15 @@ deleteMarkedDeleted()
 void CommandEditTopo::
 cleanTemporaryEntities()
 {
-    // on utilise un vecteur pour stocker les entités à supprimer de la map
+    // on utilise un vecteur pour stocker les entités à supprimer de la liste
     // sinon le parcours est modifié (on rate des éléments)
     std::vector<Topo::TopoEntity*> toDelete;
 
     Internal::InfoCommand& icmd = getInfoCommand();
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>& topo_entities_info = icmd.getTopoInfoEntity();
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
-            iter_tei != topo_entities_info.end(); ++iter_tei){
-        Topo::TopoEntity* te = iter_tei->first;
-        Internal::InfoCommand::type& t = iter_tei->second;
+    std::vector<Internal::InfoCommand::TopoEntityInfo>& topo_entities_info = icmd.getTopoInfoEntity();
+    for (uint i_tei=0; i_tei<topo_entities_info.size(); i_tei++){
+        Topo::TopoEntity* te = topo_entities_info[i_tei].m_topo_entity;
+        Internal::InfoCommand::type t = topo_entities_info[i_tei].m_type;
 
         if (te->isDestroyed() && t == Internal::InfoCommand::NONE){
             //std::cout<<"cleanTemporaryEntities() pour entité "<<te->getName()<<" (uid "<< te->getUniqueId()<<")"<<std::endl;
@@ -276,8 +276,7 @@ cleanTemporaryEntities()
         }
     }
 
-    for (uint i=0; i<toDelete.size(); i++)
-        topo_entities_info.erase(toDelete[i]);
+    icmd.removeTopoInfoEntities(toDelete);
 }
 /*----------------------------------------------------------------------------*/
 void CommandEditTopo::
@@ -382,11 +381,10 @@ registerToManagerCreatedEntities()
     std::cout<<getInfoCommand()<<std::endl;
 #endif
 
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>& tie = getInfoCommand().getTopoInfoEntity();
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter = tie.begin();
-            iter != tie.end(); ++iter){
-        Topo::TopoEntity* te = iter->first;
-        Internal::InfoCommand::type t = iter->second;
+    std::vector<Internal::InfoCommand::TopoEntityInfo>& tie = getInfoCommand().getTopoInfoEntity();
+    for (uint i_tei=0; i_tei<tie.size(); i_tei++){
+        Topo::TopoEntity* te = tie[i_tei].m_topo_entity;
+        Internal::InfoCommand::type t = tie[i_tei].m_type;
 
         // on ne s'intéresse qu'au entités de type "utilisateur"
         // on ne prend pas les Face et Edge, mais seulement les Block, CoFace, CoEdge et Vertex
@@ -453,6 +451,7 @@ previewBegin()
 
     // effectue la commande
     try {
+    	Topo::TopoPreviewTask::TopologyModification    topologyModification;
     	internalExecute();
         if (Command::CANCELED == getStatus ( ))
         	hasError    = true;
@@ -480,11 +479,10 @@ previewBegin()
 #ifdef _DEBUG_PREVIEW
     std::cout<<"==== arêtes créées en sortie de previewBegin ===="<<std::endl;
     Internal::InfoCommand& icmd = getInfoCommand();
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>&  topo_entities_info = icmd.getTopoInfoEntity();
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
-    		iter_tei != topo_entities_info.end(); ++iter_tei){
-    	Topo::TopoEntity* te = iter_tei->first;
-    	Internal::InfoCommand::type t = iter_tei->second;
+    std::vector<Internal::InfoCommand::TopoEntityInfo>&  topo_entities_info = icmd.getTopoInfoEntity();
+    for (uint i_tei=0; i_tei<topo_entities_info.size(); i_tei++){
+    	Topo::TopoEntity* te = topo_entities_info[i_tei].m_topo_entity;
+    	Internal::InfoCommand::type t = topo_entities_info[i_tei].m_type;
     	if (t == Internal::InfoCommand::CREATED && te->getType() == Utils::Entity::TopoCoEdge){
     		std::cout << " arête "<<te->getName()<<std::endl;
     	}
@@ -497,12 +495,23 @@ void CommandEditTopo::
 previewEnd()
 {
     // annulation de la commande
-    CommandEditTopo::internalUndo();
+    {
+    	Topo::TopoPreviewTask::TopologyModification    topologyModification;
+    	CommandEditTopo::internalUndo();
+    }
 
     // remet les id comme au départ de la commande
     getContext().getNameManager().setInternalStats(m_name_manager_before);
 }
 /*----------------------------------------------------------------------------*/
+bool CommandEditTopo::
+computePreview(Utils::DisplayRepresentation& dr, const std::atomic<bool>& cancel)
+{
+	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+	message << "La commande "<<getName()<<" ne sait pas calculer son aperçu sans être exécutée";
+	throw TkUtil::Exception(message);
+}
+/*----------------------------------------------------------------------------*/
 void CommandEditTopo::
 getPreviewRepresentationTopoModif(Utils::DisplayRepresentation& dr)
 {
@@ -523,12 +532,11 @@ getPreviewRepresentationTopoModif(Utils::DisplayRepresentation& dr)
     points.clear();
     indices.clear();
 
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>&  topo_entities_info = icmd.getTopoInfoEntity();
+    std::vector<Internal::InfoCommand::TopoEntityInfo>&  topo_entities_info = icmd.getTopoInfoEntity();
 
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
-    		iter_tei != topo_entities_info.end(); ++iter_tei){
-    	Topo::TopoEntity* te = iter_tei->first;
-    	Internal::InfoCommand::type t = iter_tei->second;
+    for (uint i_tei=0; i_tei<topo_entities_info.size(); i_tei++){
+    	Topo::TopoEntity* te = topo_entities_info[i_tei].m_topo_entity;
+    	Internal::InfoCommand::type t = topo_entities_info[i_tei].m_type;
     	if (t == Internal::InfoCommand::CREATED && te->getType() == Utils::Entity::TopoCoEdge){
     		CoEdge* coedge = dynamic_cast<CoEdge*>(te);
     		CHECK_NULL_PTR_ERROR(coedge);
@@ -555,7 +563,7 @@ getPreviewRepresentationTopoModif(Utils::DisplayRepresentation& dr)
     			}
     		}
     	}
-    } // end for iter_tei
+    } // end for i_tei
 
     previewEnd();
 }
@@ -576,12 +584,11 @@ getPreviewRepresentationNewCoedges(Utils::DisplayRepresentation& dr)
     points.clear();
     indices.clear();
 
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>&  topo_entities_info = icmd.getTopoInfoEntity();
+    std::vector<Internal::InfoCommand::TopoEntityInfo>&  topo_entities_info = icmd.getTopoInfoEntity();
 
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
-    		iter_tei != topo_entities_info.end(); ++iter_tei){
-    	Topo::TopoEntity* te = iter_tei->first;
-    	Internal::InfoCommand::type t = iter_tei->second;
+    for (uint i_tei=0; i_tei<topo_entities_info.size(); i_tei++){
+    	Topo::TopoEntity* te = topo_entities_info[i_tei].m_topo_entity;
+    	Internal::InfoCommand::type t = topo_entities_info[i_tei].m_type;
     	if (t == Internal::InfoCommand::CREATED && te->getType() == Utils::Entity::TopoCoEdge){
     		CoEdge* coedge = dynamic_cast<CoEdge*>(te);
     		CHECK_NULL_PTR_ERROR(coedge);
@@ -594,7 +601,7 @@ getPreviewRepresentationNewCoedges(Utils::DisplayRepresentation& dr)
     			points.push_back(vertices[i]->getCoord());
     		}
     	}
-    } // end for iter_tei
+    } // end for i_tei
 
     previewEnd();
 }
@@ -615,12 +622,11 @@ getPreviewRepresentationCoedgeDisplayModified(Utils::DisplayRepresentation& dr)
     points.clear();
     indices.clear();
 
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>&  topo_entities_info = icmd.getTopoInfoEntity();
+    std::vector<Internal::InfoCommand::TopoEntityInfo>&  topo_entities_info = icmd.getTopoInfoEntity();
 
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
-    		iter_tei != topo_entities_info.end(); ++iter_tei){
-    	Topo::TopoEntity* te = iter_tei->first;
-    	Internal::InfoCommand::type t = iter_tei->second;
+    for (uint i_tei=0; i_tei<topo_entities_info.size(); i_tei++){
+    	Topo::TopoEntity* te = topo_entities_info[i_tei].m_topo_entity;
+    	Internal::InfoCommand::type t = topo_entities_info[i_tei].m_type;
     	if (t == Internal::InfoCommand::DISPMODIFIED && te->getType() == Utils::Entity::TopoCoEdge){
     		CoEdge* coedge = dynamic_cast<CoEdge*>(te);
     		CHECK_NULL_PTR_ERROR(coedge);
@@ -633,7 +639,7 @@ getPreviewRepresentationCoedgeDisplayModified(Utils::DisplayRepresentation& dr)
     			points.push_back(vertices[i]->getCoord());
     		}
     	}
-    } // end for iter_tei
+    } // end for i_tei
 
     previewEnd();
 }
@@ -654,25 +660,24 @@ getPreviewRepresentationDeletedTopo(Utils::DisplayRepresentation& dr)
     points.clear();
     indices.clear();
 
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>&  topo_entities_info = icmd.getTopoInfoEntity();
+    std::vector<Internal::InfoCommand::TopoEntityInfo>&  topo_entities_info = icmd.getTopoInfoEntity();
 
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
-    		iter_tei != topo_entities_info.end(); ++iter_tei){
-    	Topo::TopoEntity* te = iter_tei->first;
-    	Internal::InfoCommand::type t = iter_tei->second;
+    for (uint i_tei=0; i_tei<topo_entities_info.size(); i_tei++){
+    	Topo::TopoEntity* te = topo_entities_info[i_tei].m_topo_entity;
+    	Internal::InfoCommand::type t = topo_entities_info[i_tei].m_type;
     	if (t == Internal::InfoCommand::DELETED){
     		te->getRepresentation(dr, true);
     	}
-    } // end for iter_tei
+    } // end for i_tei
 
     previewEnd();
 }
 /*----------------------------------------------------------------------------*/
 void CommandEditTopo::
 duplicate(std::vector<CoFace*>& cofaces_dep,
-        std::map<Vertex*, uint>& filtre_vertex,
-        std::map<CoEdge*, uint>& filtre_coedge,
-        std::map<CoFace*, uint>& filtre_coface,
+        TopoFilter<Vertex>& filtre_vertex,
+        TopoFilter<CoEdge>& filtre_coedge,
+        TopoFilter<CoFace>& filtre_coface,
         std::vector<CoFace*>& cofaces_arr)
 {
 #ifdef _DEBUG_REVOL
@@ -930,8 +935,8 @@ void CommandEditTopo::
 updateGeomAssociation(std::vector<CoFace*>& cofaces,
             std::map<Geom::Vertex*,Geom::Curve*>& V2C,
             std::map<Geom::Curve*,Geom::Surface*>& C2S,
-            std::map<Vertex*, uint>& filtre_vertex,
-            std::map<CoEdge*, uint>& filtre_coedge)
+            TopoFilter<Vertex>& filtre_vertex,
+            TopoFilter<CoEdge>& filtre_coedge)
 {
 //    std::cout<<"updateGeomAssociation(V2C, C2S)..."<<std::endl;
 
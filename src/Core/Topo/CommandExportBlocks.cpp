@@ -20,19 +20,13 @@ void CommandExportBlocks::
 internalExecute()
 {
 
-    std::string ext;
-    int i = m_filename.rfind('.', m_filename.length());
-    if (i != std::string::npos) {
-        ext = m_filename.substr(i+1, m_filename.length() - i);
-    }
-
-    if(ext != "mgxt"){
+    if(!BlockingFileData::isBlockingFileName(m_filename)){
         TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-        message<<"Erreur dans l'extension du fichier, merci d'utiliser \".mgxt\"";
+        message<<"Erreur dans l'extension du fichier, merci d'utiliser \".mgxt\" ou \".mgxb\"";
         throw TkUtil::Exception (message);
 
     }
-    // écriture du STEP
+    // écriture du fichier de blocs
     m_impl.perform(&getInfoCommand());
 }
 /*----------------------------------------------------------------------------*/
@@ -2,6 +2,7 @@
 #include "Topo/CommandExtendSplitBlock.h"
 #include "Topo/Block.h"
 #include "Topo/Vertex.h"
+#include "Topo/TopoHelper.h"
 #include "Utils/Common.h"
 /*----------------------------------------------------------------------------*/
 #include <TkUtil/TraceLog.h>
@@ -28,9 +29,8 @@ CommandExtendSplitBlock::
 void CommandExtendSplitBlock::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandExtendSplitBlock::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandExtendSplitBlock::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     if (!m_bloc->isStructured())
         throw TkUtil::Exception (TkUtil::UTF8String ("Le bloc doit être structuré pour être découpé avec cette méthode", TkUtil::Charset::UTF_8));
@@ -49,8 +49,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandExtendSplitBlock::
@@ -63,7 +61,23 @@ countNbCoEdgesByVertices(std::map<Topo::Vertex*, uint> &nb_coedges_by_vertex)
 /*----------------------------------------------------------------------------*/
 void CommandExtendSplitBlock::getPreviewRepresentation(Utils::DisplayRepresentation& dr)
 {
-	return getPreviewRepresentationTopoModif(dr);
+	std::atomic<bool> cancel(false);
+	computePreview(dr, cancel);
+}
+/*----------------------------------------------------------------------------*/
+bool CommandExtendSplitBlock::computePreview(Utils::DisplayRepresentation& dr,
+		const std::atomic<bool>& cancel)
+{
+    if (!m_bloc->isStructured())
+        throw TkUtil::Exception (TkUtil::UTF8String ("Le bloc doit être structuré pour être découpé avec cette méthode", TkUtil::Charset::UTF_8));
+
+    // même coupe que Block::extendSplit
+    CoEdge* coedge = 0;
+    double ratio = 0.0;
+    m_bloc->getExtendSplitCoEdge(m_arete, coedge, ratio);
+
+	return TopoHelper::computeSplitPreview(m_bloc->getCoFaces(), coedge, ratio, true,
+			dr.getPoints(), dr.getCurveDiscretization(), cancel);
 }
 /*----------------------------------------------------------------------------*/
 } // end namespace Topo
@@ -32,9 +32,8 @@ CommandExtendSplitFace::
 void CommandExtendSplitFace::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandExtendSplitFace::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandExtendSplitFace::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     // vérification que le sommet n'est pas à une extrémité de la coface, sinon cela ne ferait rien
     for (Topo::Vertex* v : m_coface->getVertices())
@@ -71,8 +70,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandExtendSplitFace::
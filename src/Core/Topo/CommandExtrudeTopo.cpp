@@ -65,9 +65,8 @@ init()
 void CommandExtrudeTopo::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandExtrudeTopo::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandExtrudeTopo::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 #ifdef _DEBUG2
     m_commandGeom->printInfoAssociations();
 #endif
@@ -143,8 +142,6 @@ internalExecute()
 
 //    std::cout<<"Dans CommandExtrudeTopo: "<<std::endl;
 //    std::cout<< getInfoCommand() <<std::endl;
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 
 /*----------------------------------------------------------------------------*/
@@ -41,9 +41,8 @@ CommandFuse2Blocks::
 void CommandFuse2Blocks::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandFuse2Blocks::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandFuse2Blocks::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     // il faut rechercher dans un premier temps les Faces concernées dans chacun des blocs
     Face* faceA = getNearestFace(m_bl_A, m_bl_B->getBarycentre());
@@ -181,8 +180,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandFuse2Blocks::
@@ -35,9 +35,8 @@ CommandFuse2EdgeList::
 void CommandFuse2EdgeList::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandGlue2EdgeList::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandGlue2EdgeList::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     // filtre sur les sommets topologiques de ces arêtes à coller
     // à 1 pour les sommets uniquement dans coedges1
@@ -205,8 +204,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandFuse2EdgeList::
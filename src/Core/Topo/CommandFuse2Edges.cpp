@@ -26,9 +26,8 @@ CommandFuse2Edges::
 void CommandFuse2Edges::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandGlue2Edges::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandGlue2Edges::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     // marque les coedges et cofaces à conserver de préférence
     // lors des collages automatiques autours
@@ -64,8 +63,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandFuse2Edges::
@@ -42,9 +42,8 @@ CommandFuse2Faces::
 void CommandFuse2Faces::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandGlue2Faces::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandGlue2Faces::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     // fusion avec recherche des sommets les plus proche possible
     m_face_A->fuse(m_face_B, &getInfoCommand());
@@ -57,8 +56,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandFuse2Faces::
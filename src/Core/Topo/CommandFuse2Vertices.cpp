@@ -41,9 +41,8 @@ CommandFuse2Vertices::
 void CommandFuse2Vertices::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandFuse2Vertices::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandFuse2Vertices::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     // marque les coedges et cofaces à conserver de préférence
     // lors des collages automatiques autours
@@ -70,8 +69,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandFuse2Vertices::
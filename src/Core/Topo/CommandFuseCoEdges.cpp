@@ -51,9 +51,8 @@ CommandFuseCoEdges::
 void CommandFuseCoEdges::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandFuseCoEdges::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandFuseCoEdges::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     // il doit y avoir au moins 2 arêtes, sinon aucun intéret
     if (m_coedges.size()<2)
@@ -140,8 +139,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandFuseCoEdges::getPreviewRepresentation(Utils::DisplayRepresentation& dr)
@@ -44,9 +44,8 @@ CommandGlue2Topo::
 void CommandGlue2Topo::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandGlue2Topo::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandGlue2Topo::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
 	Topo::TopoManager& tm = getContext().getTopoManager();
     // les cofaces au bord associées au premier volume
@@ -234,8 +233,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandGlue2Topo::
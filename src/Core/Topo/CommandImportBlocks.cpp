@@ -35,18 +35,18 @@ namespace Mgx3D {
                 m_warning_to_pop_up = "L'association géométrique pour les entités "+m_impl->getWarning()+"n'a pas pu etre effectuée.";
 
             for(auto te : getInfoCommand().getTopoInfoEntity()) {
-                if (te.first->getType() == Utils::Entity::TopoVertex) {
-                    getTopoManager().add((Vertex *) te.first);
-                } else if (te.first->getType() == Utils::Entity::TopoCoEdge) {
-                    getTopoManager().add((CoEdge *) te.first);
-                }else if (te.first->getType() == Utils::Entity::TopoEdge) {
-                    getTopoManager().add((Edge *) te.first);
-                }else if (te.first->getType() == Utils::Entity::TopoCoFace) {
-                    getTopoManager().add((CoFace *) te.first);
-                }else if (te.first->getType() == Utils::Entity::TopoFace) {
-                    getTopoManager().add((Face *) te.first);
-                } else if (te.first->getType() == Utils::Entity::TopoBlock) {
-                    getTopoManager().add((Block *) te.first);
+                if (te.m_topo_entity->getType() == Utils::Entity::TopoVertex) {
+                    getTopoManager().add((Vertex *) te.m_topo_entity);
+                } else if (te.m_topo_entity->getType() == Utils::Entity::TopoCoEdge) {
+                    getTopoManager().add((CoEdge *) te.m_topo_entity);
+                }else if (te.m_topo_entity->getType() == Utils::Entity::TopoEdge) {
+                    getTopoManager().add((Edge *) te.m_topo_entity);
+                }else if (te.m_topo_entity->getType() == Utils::Entity::TopoCoFace) {
+                    getTopoManager().add((CoFace *) te.m_topo_entity);
+                }else if (te.m_topo_entity->getType() == Utils::Entity::TopoFace) {
+                    getTopoManager().add((Face *) te.m_topo_entity);
+                } else if (te.m_topo_entity->getType() == Utils::Entity::TopoBlock) {
+                    getTopoManager().add((Block *) te.m_topo_entity);
                 }
             }
         }
@@ -52,9 +52,8 @@ CommandInsertHole::
 void CommandInsertHole::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandInsertHole::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandInsertHole::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
 #ifdef _DEBUG_INSERTHOLE
     std::cout<<"CommandInsertHole::internalExecute() ..."<<std::endl;
@@ -78,8 +77,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandInsertHole::
@@ -72,18 +72,17 @@ CommandMakeBlocksByRevol::
 void CommandMakeBlocksByRevol::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandMakeBlocksByRevol::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandMakeBlocksByRevol::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 #ifdef _DEBUG2
     m_commandGeom->printInfoAssociations();
 #endif
 
     // remplit les filtres en démarrant le parcours depuis l'arête sur l'o-grid
     // pour identifier la position / o-grid
-    std::map<Vertex*, uint> filtre_vertex;
-    std::map<CoEdge*, uint> filtre_coedge;
-    std::map<CoFace*, uint> filtre_coface;
+    TopoFilter<Vertex> filtre_vertex;
+    TopoFilter<CoEdge> filtre_coedge;
+    TopoFilter<CoFace> filtre_coface;
     if (m_coedges.empty())
     	computeFiltersWithAllFaces(filtre_vertex, filtre_coedge, filtre_coface);
     else
@@ -120,24 +119,24 @@ internalExecute()
 //#ifdef _DEBUG_REVOL
 //    // affichage du contenu des différents filtres
 //    std::cout<<"filtre_vertex : "<<std::endl;
-//    for (std::map<Vertex*, uint>::iterator iter = filtre_vertex.begin();
+//    for (TopoFilter<Vertex>::iterator iter = filtre_vertex.begin();
 //                iter != filtre_vertex.end(); ++iter)
 //    	std::cout<<" "<<(*iter).first->getName()<<" "<<(*iter).second<<std::endl;
 //    std::cout<<"filtre_coedge : "<<std::endl;
-//    for (std::map<CoEdge*, uint>::iterator iter = filtre_coedge.begin();
+//    for (TopoFilter<CoEdge>::iterator iter = filtre_coedge.begin();
 //                iter != filtre_coedge.end(); ++iter)
 //    	std::cout<<" "<<(*iter).first->getName()<<" "<<(*iter).second<<std::endl;
 //    std::cout<<"filtre_coface : "<<std::endl;
-//    for (std::map<CoFace*, uint>::iterator iter = filtre_coface.begin();
+//    for (TopoFilter<CoFace>::iterator iter = filtre_coface.begin();
 //                iter != filtre_coface.end(); ++iter)
 //    	std::cout<<" "<<(*iter).first->getName()<<" "<<(*iter).second<<std::endl;
 //#endif
 
     // calcul le nombre de bras pour l'o-grid (m_ni)
     // et les ni locaux pour les vertex sur l'ogrid et les cofaces de part et d'autre de cet ogrid
-    std::map<Vertex*, uint> ni_vtx;
-    std::map<CoEdge*, uint> ni_coedge;
-    std::map<CoFace*, uint> ni_coface;
+    TopoFilter<Vertex> ni_vtx;
+    TopoFilter<CoEdge> ni_coedge;
+    TopoFilter<CoFace> ni_coface;
     computeNi(filtre_vertex, filtre_coedge, ni_vtx, ni_coedge, ni_coface);
 
     // Modification et construction de la topologie 2D avec révolution
@@ -452,14 +451,12 @@ internalExecute()
 
 //    std::cout<<"Dans CommandMakeBlocksByRevol: "<<std::endl;
 //    std::cout<< getInfoCommand() <<std::endl;
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandMakeBlocksByRevol::
-computeFiltersWithAllFaces(std::map<Vertex*, uint>& filtre_vertex,
-            std::map<CoEdge*, uint>& filtre_coedge,
-            std::map<CoFace*, uint>& filtre_coface)
+computeFiltersWithAllFaces(TopoFilter<Vertex>& filtre_vertex,
+            TopoFilter<CoEdge>& filtre_coedge,
+            TopoFilter<CoFace>& filtre_coface)
 {
 	for (CoFace* coface : getContext().getTopoManager().getCoFacesObj()){
 		filtre_coface[coface] = 3;
@@ -472,9 +469,9 @@ computeFiltersWithAllFaces(std::map<Vertex*, uint>& filtre_vertex,
 }
 /*----------------------------------------------------------------------------*/
 void CommandMakeBlocksByRevol::
-computeOgridFilters(std::map<Vertex*, uint>& filtre_vertex,
-        std::map<CoEdge*, uint>& filtre_coedge,
-        std::map<CoFace*, uint>& filtre_coface)
+computeOgridFilters(TopoFilter<Vertex>& filtre_vertex,
+        TopoFilter<CoEdge>& filtre_coedge,
+        TopoFilter<CoFace>& filtre_coface)
 {
 #ifdef _DEBUG_REVOL
     std::cout<<"CommandMakeBlocksByRevol::computeOgridFilters..."<<std::endl;
@@ -787,18 +784,18 @@ computeOgridFilters(std::map<Vertex*, uint>& filtre_vertex,
 }
 /*----------------------------------------------------------------------------*/
 void CommandMakeBlocksByRevol::
-computeAxisFilters(std::map<Vertex*, uint>& filtre_vertex,
-        std::map<CoEdge*, uint>& filtre_coedge,
-        std::map<CoFace*, uint>& filtre_coface)
+computeAxisFilters(TopoFilter<Vertex>& filtre_vertex,
+        TopoFilter<CoEdge>& filtre_coedge,
+        TopoFilter<CoFace>& filtre_coface)
 {
     // on marque en premier les sommets
-    for (std::map<Vertex*, uint>::iterator iter = filtre_vertex.begin();
+    for (TopoFilter<Vertex>::iterator iter = filtre_vertex.begin();
             iter != filtre_vertex.end(); ++iter)
         if ((*iter).second && isOnAxis((*iter).first))
                 (*iter).second += 10;
 
     // on marque ensuite les CoEdges
-    for (std::map<CoEdge*, uint>::iterator iter = filtre_coedge.begin();
+    for (TopoFilter<CoEdge>::iterator iter = filtre_coedge.begin();
             iter != filtre_coedge.end(); ++iter)
         if ((*iter).second) {
             auto coedge_vertices = (*iter).first->getVertices();
@@ -817,7 +814,7 @@ computeAxisFilters(std::map<Vertex*, uint>& filtre_vertex,
         }
 
     // on marque ensuite les CoFace (+10 si elle touche l'axe)
-    for (std::map<CoFace*, uint>::iterator iter = filtre_coface.begin();
+    for (TopoFilter<CoFace>::iterator iter = filtre_coface.begin();
             iter != filtre_coface.end(); ++iter)
         if ((*iter).second) {
             CoFace* coface = (*iter).first;
@@ -831,9 +828,9 @@ computeAxisFilters(std::map<Vertex*, uint>& filtre_vertex,
 }
 /*----------------------------------------------------------------------------*/
 void CommandMakeBlocksByRevol::
-detectVerticesUnderOgrid(std::map<Vertex*, uint>& filtre_vertex)
+detectVerticesUnderOgrid(TopoFilter<Vertex>& filtre_vertex)
 {
-    for (std::map<Vertex*, uint>::iterator iter = filtre_vertex.begin();
+    for (TopoFilter<Vertex>::iterator iter = filtre_vertex.begin();
             iter != filtre_vertex.end(); ++iter)
         if (filtre_vertex[(*iter).first] == 2){
             // on a trouvé un sommet entre l'axe et l'ogrid
@@ -866,11 +863,11 @@ detectVerticesUnderOgrid(std::map<Vertex*, uint>& filtre_vertex)
 }
 /*----------------------------------------------------------------------------*/
 void CommandMakeBlocksByRevol::
-computeNi(std::map<Vertex*, uint>& filtre_vertex,
-        std::map<CoEdge*, uint>& filtre_coedge,
-        std::map<Vertex*, uint>& ni_vtx,
-        std::map<CoEdge*, uint>& ni_coedge,
-        std::map<CoFace*, uint>& ni_coface)
+computeNi(TopoFilter<Vertex>& filtre_vertex,
+        TopoFilter<CoEdge>& filtre_coedge,
+        TopoFilter<Vertex>& ni_vtx,
+        TopoFilter<CoEdge>& ni_coedge,
+        TopoFilter<CoFace>& ni_coface)
 {
 #ifdef _DEBUG_REVOL
     std::cout<<"computeNi"<<std::endl;
@@ -879,7 +876,7 @@ computeNi(std::map<Vertex*, uint>& filtre_vertex,
     CoEdge* coedge_ref = 0;
 
     // on parcours les arêtes, on se base sur celles marquées à 12 (liées à l'axe et à l'ogrid ou à un point entre les 2)
-    for (std::map<CoEdge*, uint>::iterator iter = filtre_coedge.begin();
+    for (TopoFilter<CoEdge>::iterator iter = filtre_coedge.begin();
             iter != filtre_coedge.end(); ++iter)
         if ((*iter).second == 12) {
             CoEdge* coedge = (*iter).first;
@@ -963,7 +960,7 @@ computeNi(std::map<Vertex*, uint>& filtre_vertex,
 
 
     // copie le ni d'une coface sous l'ogrid vers celle au dessus
-    for (std::map<CoEdge*, uint>::iterator iter = filtre_coedge.begin();
+    for (TopoFilter<CoEdge>::iterator iter = filtre_coedge.begin();
             iter != filtre_coedge.end(); ++iter)
         if ((*iter).second == 1) {
             CoEdge* coedge = (*iter).first;
@@ -988,7 +985,7 @@ computeNi(std::map<Vertex*, uint>& filtre_vertex,
 
 
     // Calcul les ni pour les sommets au dessus de l'ogrid
-    for (std::map<Vertex*, uint>::iterator iter = filtre_vertex.begin();
+    for (TopoFilter<Vertex>::iterator iter = filtre_vertex.begin();
                iter != filtre_vertex.end(); ++iter){
     	Vertex* vtx = (*iter).first;
            if ((*iter).second == 3 && ni_vtx[vtx] == 0) {
@@ -1012,7 +1009,7 @@ computeNi(std::map<Vertex*, uint>& filtre_vertex,
     } // end for iter = filtre_vertex.begin()
 
     // boucle sur coedges pour calculer un ni par coedge
-    for (std::map<CoEdge*, uint>::iterator iter = filtre_coedge.begin();
+    for (TopoFilter<CoEdge>::iterator iter = filtre_coedge.begin();
             iter != filtre_coedge.end(); ++iter){
     	// on prend le ni le plus grand entre ceux des cofaces autours
     	uint ni = 0;
@@ -1038,9 +1035,9 @@ computeNi(std::map<Vertex*, uint>& filtre_vertex,
 
 }
 /*----------------------------------------------------------------------------*/
-void CommandMakeBlocksByRevol::copyNi(std::map<Vertex*, uint>& ni_vtx,
-        std::map<CoEdge*, uint>& ni_coedge,
-        std::map<CoFace*, uint>& ni_coface,
+void CommandMakeBlocksByRevol::copyNi(TopoFilter<Vertex>& ni_vtx,
+        TopoFilter<CoEdge>& ni_coedge,
+        TopoFilter<CoFace>& ni_coface,
 		std::vector<CoFace*>& cofaces_dep,
 		std::vector<CoFace*>& cofaces_arr)
 {
@@ -1083,9 +1080,9 @@ void CommandMakeBlocksByRevol::copyNi(std::map<Vertex*, uint>& ni_vtx,
 /*----------------------------------------------------------------------------*/
 void CommandMakeBlocksByRevol::
 marqueCoFaceCoEdgeVertices(CoEdge* coedge, const uint marque,
-        std::map<Vertex*, uint>& filtre_vertex,
-        std::map<CoEdge*, uint>& filtre_coedge,
-        std::map<CoFace*, uint>& filtre_coface)
+        TopoFilter<Vertex>& filtre_vertex,
+        TopoFilter<CoEdge>& filtre_coedge,
+        TopoFilter<CoFace>& filtre_coface)
 {
 	//std::cout<<"marqueCoFaceCoEdgeVertices ..."<<std::endl;
     for (CoFace* cf : coedge->getCoFaces())
@@ -1171,9 +1168,9 @@ rotate(uint angle,
         std::vector<CoFace*>& cofaces)
 {
     // on marque les sommets pour ne les toucher qu'une fois
-    std::map<Vertex*, uint> filtre_vu;
+    TopoFilter<Vertex> filtre_vu;
     // on marque les arêtes pour ne les toucher qu'une fois
-    std::map<CoEdge*, uint> filtre_ce;
+    TopoFilter<CoEdge> filtre_ce;
 
     // la matrice de rotation avec un angle en radians
     m_rotMatrix = Utils::Math::Matrix33(angle*M_PI/180.0, m_axis);
@@ -1276,11 +1273,11 @@ scale(double ratio,
 /*----------------------------------------------------------------------------*/
 void CommandMakeBlocksByRevol::
 getMarquedOnOgrid(std::vector<CoFace*>& cofaces,
-        std::map<Vertex*, uint>& filtre_vertex,
+        TopoFilter<Vertex>& filtre_vertex,
         std::vector<Vertex*>& vertices_ogrid)
 {
     // filtre sur les sommets pour ne les prendre qu'une fois
-    std::map<Vertex*, uint> filtre_vu;
+    TopoFilter<Vertex> filtre_vu;
 
     for (std::vector<CoFace*>::const_iterator iter1 = cofaces.begin();
             iter1 != cofaces.end(); ++iter1){
@@ -1313,9 +1310,9 @@ getMarquedOnOgrid(std::vector<CoFace*>& cofaces,
 /*----------------------------------------------------------------------------*/
 void CommandMakeBlocksByRevol::
 freeUnused(std::vector<CoFace*>& cofaces,
-        std::map<Vertex*, uint>& filtre_vertex,
-        std::map<CoEdge*, uint>& filtre_coedge,
-        std::map<CoFace*, uint>& filtre_coface,
+        TopoFilter<Vertex>& filtre_vertex,
+        TopoFilter<CoEdge>& filtre_coedge,
+        TopoFilter<CoFace>& filtre_coface,
         bool memorizeFreezedCofaces)
 {
     // les CoFace sous l'o-grid n'ont plus de raison d'être, on les supprime
@@ -1389,8 +1386,8 @@ freeUnused(std::vector<CoFace*>& cofaces,
 /*----------------------------------------------------------------------------*/
 void CommandMakeBlocksByRevol::
 updateInterpolate(std::vector<CoFace*>& cofaces,
-    		std::map<CoEdge*, uint>& filtre_coedge,
-			std::map<CoFace*, uint>& filtre_coface)
+    		TopoFilter<CoEdge>& filtre_coedge,
+			TopoFilter<CoFace>& filtre_coface)
 {
 #ifdef _DEBUG_INTERPOLATE
 	std::cout<<"updateInterpolate en cours"<<std::endl;
@@ -1452,19 +1449,19 @@ updateInterpolate(std::vector<CoFace*>& cofaces,
 void CommandMakeBlocksByRevol::
 constructRevolCoEdges(std::vector<CoFace*>& cofaces_0,
         std::vector<CoFace*>& cofaces_1,
-        std::map<Vertex*, uint>& filtre_vertex,
-        std::map<CoEdge*, uint>& filtre_coedge,
+        TopoFilter<Vertex>& filtre_vertex,
+        TopoFilter<CoEdge>& filtre_coedge,
         uint nbDemiOgrid,
         bool sensNormal,
         std::map<Vertex*, std::vector<CoEdge* > >& vtx2coedges,
-        std::map<Vertex*, uint>& ni_vtx,
+        TopoFilter<Vertex>& ni_vtx,
 		bool preserveSurfaceAssociation)
 {
 #ifdef _DEBUG_REVOL
     std::cout<<"constructRevolCoEdges avec "<<cofaces_0.size()<<" et "<<cofaces_1.size()<<" CoFace"<<std::endl;
 #endif
     // filtre sur les sommets pour ne les prendre qu'une fois
-    std::map<Vertex*, uint> filtre_vu;
+    TopoFilter<Vertex> filtre_vu;
 
 
     // construction des arêtes communes avec ni bras entre les sommets des 2 topo 2D
@@ -1736,18 +1733,18 @@ constructRevolCoEdges(std::vector<CoFace*>& cofaces_0,
 void CommandMakeBlocksByRevol::
 constructRevolFaces(std::vector<CoFace*>& cofaces_0,
         std::vector<CoFace*>& cofaces_1,
-        std::map<Vertex*, uint>& filtre_vertex,
-        std::map<CoEdge*, uint>& filtre_coedge,
+        TopoFilter<Vertex>& filtre_vertex,
+        TopoFilter<CoEdge>& filtre_coedge,
         std::map<Vertex*, std::vector<CoEdge* > >& vtx2coedges,
         std::map<CoEdge*, std::vector<CoFace* > >& coedge2cofaces,
-        std::map<CoEdge*, uint>& ni_coedge,
+        TopoFilter<CoEdge>& ni_coedge,
         uint facteur_ni)
 {
 #ifdef _DEBUG_REVOL
     std::cout<<"constructRevolFaces avec "<<cofaces_0.size()<<" et "<<cofaces_1.size()<<" CoFace"<<std::endl;
 #endif
     // filtre sur les arêtes pour ne les prendre qu'une fois
-    std::map<CoEdge*, uint> filtre_vu;
+    TopoFilter<CoEdge> filtre_vu;
 
     std::vector<CoFace*>::iterator iter1_0 = cofaces_0.begin();
     std::vector<CoFace*>::iterator iter1_1 = cofaces_1.begin();
@@ -1953,13 +1950,13 @@ constructRevolFaces(std::vector<CoFace*>& cofaces_0,
 void CommandMakeBlocksByRevol::
 constructRevolFacesInnerOgrid(std::vector<CoFace*>& cofaces_0,
         std::vector<CoFace*>& cofaces_1,
-        std::map<Vertex*, uint>& filtre_vertex,
-        std::map<CoEdge*, uint>& filtre_coedge,
+        TopoFilter<Vertex>& filtre_vertex,
+        TopoFilter<CoEdge>& filtre_coedge,
         std::map<Vertex*, std::vector<CoEdge* > >& vtx2coedges,
         std::map<CoEdge*, std::vector<CoFace* > >& coedge2cofaces)
 {
     // filtre sur les arêtes pour ne les prendre qu'une fois
-    std::map<CoEdge*, uint> filtre_vu;
+    TopoFilter<CoEdge> filtre_vu;
 
     std::vector<CoFace*>::iterator iter1_0 = cofaces_0.begin();
     std::vector<CoFace*>::iterator iter1_1 = cofaces_1.begin();
@@ -2514,13 +2511,13 @@ constructRevolFacesInnerOgrid(std::vector<CoFace*>& cofaces_0,
 void CommandMakeBlocksByRevol::
 constructRevolBlocks(std::vector<CoFace*>& cofaces_0,
         std::vector<CoFace*>& cofaces_1,
-        std::map<Vertex*, uint>& filtre_vertex,
-        std::map<CoEdge*, uint>& filtre_coedge,
-        std::map<CoFace*, uint>& filtre_coface,
+        TopoFilter<Vertex>& filtre_vertex,
+        TopoFilter<CoEdge>& filtre_coedge,
+        TopoFilter<CoFace>& filtre_coface,
         std::map<Vertex*, std::vector<CoEdge* > >& vtx2coedges,
         std::map<CoEdge*, std::vector<CoFace* > >& coedge2cofaces,
-        std::map<Vertex*, uint>& ni_vtx,
-        std::map<CoFace*, uint>& ni_coface,
+        TopoFilter<Vertex>& ni_vtx,
+        TopoFilter<CoFace>& ni_coface,
         uint facteur_ni)
 {
 #ifdef _DEBUG_REVOL
@@ -2726,13 +2723,13 @@ void CommandMakeBlocksByRevol::
 constructRevolBlocksInnerOgrid_4(std::vector<CoFace*>& cofaces_0,
         std::vector<CoFace*>& cofaces_45,
         std::vector<CoFace*>& cofaces_90,
-        std::map<Vertex*, uint>& filtre_vertex,
-        std::map<CoEdge*, uint>& filtre_coedge,
-        std::map<CoFace*, uint>& filtre_coface,
+        TopoFilter<Vertex>& filtre_vertex,
+        TopoFilter<CoEdge>& filtre_coedge,
+        TopoFilter<CoFace>& filtre_coface,
         std::map<Vertex*, std::vector<CoEdge* > >& vtx2coedges,
         std::map<CoEdge*, std::vector<CoFace* > >& coedge2cofaces,
-        std::map<Vertex*, uint>& ni_vtx,
-        std::map<CoFace*, uint>& ni_coface)
+        TopoFilter<Vertex>& ni_vtx,
+        TopoFilter<CoFace>& ni_coface)
 {
 #ifdef _DEBUG_REVOL
     std::cout<<"\nconstructRevolBlocksInnerOgrid_4\n";
@@ -3295,13 +3292,13 @@ constructRevolBlocksInnerOgrid_2(std::vector<CoFace*>& cofaces_0,
         std::vector<CoFace*>& cofaces_45,
         std::vector<CoFace*>& cofaces_135,
         std::vector<CoFace*>& cofaces_180,
-        std::map<Vertex*, uint>& filtre_vertex,
-        std::map<CoEdge*, uint>& filtre_coedge,
-        std::map<CoFace*, uint>& filtre_coface,
+        TopoFilter<Vertex>& filtre_vertex,
+        TopoFilter<CoEdge>& filtre_coedge,
+        TopoFilter<CoFace>& filtre_coface,
         std::map<Vertex*, std::vector<CoEdge* > >& vtx2coedges,
         std::map<CoEdge*, std::vector<CoFace* > >& coedge2cofaces,
-        std::map<Vertex*, uint>& ni_vtx,
-        std::map<CoFace*, uint>& ni_coface)
+        TopoFilter<Vertex>& ni_vtx,
+        TopoFilter<CoFace>& ni_coface)
 {
 #ifdef _DEBUG_REVOL
     std::cout<<"\nconstructRevolBlocksInnerOgrid_2\n";
@@ -3955,13 +3952,13 @@ constructRevolBlocksInnerOgrid_1(std::vector<CoFace*>& cofaces_45,
         std::vector<CoFace*>& cofaces_135,
         std::vector<CoFace*>& cofaces_225,
         std::vector<CoFace*>& cofaces_315,
-        std::map<Vertex*, uint>& filtre_vertex,
-        std::map<CoEdge*, uint>& filtre_coedge,
-        std::map<CoFace*, uint>& filtre_coface,
+        TopoFilter<Vertex>& filtre_vertex,
+        TopoFilter<CoEdge>& filtre_coedge,
+        TopoFilter<CoFace>& filtre_coface,
         std::map<Vertex*, std::vector<CoEdge* > >& vtx2coedges,
         std::map<CoEdge*, std::vector<CoFace* > >& coedge2cofaces,
-        std::map<Vertex*, uint>& ni_vtx,
-        std::map<CoFace*, uint>& ni_coface)
+        TopoFilter<Vertex>& ni_vtx,
+        TopoFilter<CoFace>& ni_coface)
 {
 #ifdef _DEBUG_REVOL
     std::cout<<"\nconstructRevolBlocksInnerOgrid_1\n";
@@ -4460,8 +4457,8 @@ updateGeomAssociationToSurf(Geom::GeomEntity* ge, Vertex* vertex)
 /*----------------------------------------------------------------------------*/
 void CommandMakeBlocksByRevol::
 updateGeomAssociationOGrid(std::vector<Vertex*>& vertices,
-        std::map<Vertex*, uint>& filtre_vertex,
-        std::map<CoEdge*, uint>& filtre_coedge)
+        TopoFilter<Vertex>& filtre_vertex,
+        TopoFilter<CoEdge>& filtre_coedge)
 {
 //    std::cout<<"updateGeomAssociationOGrid ...\n";
     for (std::vector<Vertex* >::iterator iter4 = vertices.begin();
@@ -73,9 +73,8 @@ CommandMirrorTopo::
 void CommandMirrorTopo::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandMirrorTopo::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandMirrorTopo::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     // création de l'opérateur d'homothétie via OCC
     gp_Trsf transf;
@@ -89,8 +88,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandMirrorTopo::getPreviewRepresentation(Utils::DisplayRepresentation& dr)
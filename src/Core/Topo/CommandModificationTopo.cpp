@@ -42,9 +42,8 @@ CommandModificationTopo::
 void CommandModificationTopo::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandModificationTopo::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandModificationTopo::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
 
     // On ne traite pas ici les entités déplacées.
@@ -84,8 +83,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandModificationTopo::MAJVertices()
@@ -250,7 +247,7 @@ void CommandModificationTopo::MAJCoEdges()
                 			// Pour chacun des sommets des arêtes, on fait la fusion avec le sommet proche de l'autre groupe
                 			std::vector<Topo::Vertex*> all_vertices2 = getAllVertices(newEntities[0]);
 
-                			std::map<Vertex*, uint> filtre_vertices;
+                			TopoFilter<Vertex> filtre_vertices;
 
                 			for (uint i=0; i<all_vertices.size(); i++){
                 				Topo::Vertex* vtx0 = all_vertices[i];
@@ -843,14 +840,13 @@ MAJInternalsCoFaces()
     std::cout<<"CommandModificationTopo::MAJInternalsCoFaces()"<<std::endl;
 #endif
     // on parcours les cofaces modifiées à la recherche de celles non structurées, associées à rien et entre 2 blocs
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>& tei = getInfoCommand().getTopoInfoEntity();
+    std::vector<Internal::InfoCommand::TopoEntityInfo>& tei = getInfoCommand().getTopoInfoEntity();
     std::list<Topo::Block*> l_blocks;
-    std::map<Topo::CoFace*, uint> filtre_cofaces;
+    TopoFilter<CoFace> filtre_cofaces;
     std::vector<Topo::CoFace*> v_cofaces_to_delete;
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::const_iterator iter = tei.begin();
-         iter != tei.end(); ++iter) {
-        if (iter->first->getDim() == 2 && iter->second == Internal::InfoCommand::DISPMODIFIED){
-            Topo::CoFace* ob = dynamic_cast<Topo::CoFace*>(iter->first);
+    for (uint i_tei=0; i_tei<tei.size(); i_tei++) {
+        if (tei[i_tei].m_topo_entity->getDim() == 2 && tei[i_tei].m_type == Internal::InfoCommand::DISPMODIFIED){
+            Topo::CoFace* ob = dynamic_cast<Topo::CoFace*>(tei[i_tei].m_topo_entity);
             if (ob && !ob->isStructured() && ob->getGeomAssociation() == 0){
                 std::vector<Block*> blocks = ob->getBlocks();
                 if (blocks.size() ==2 && blocks[0]->getGeomAssociation() == blocks[1]->getGeomAssociation()) {
@@ -918,7 +914,7 @@ MAJInternalsCoFaces()
 
     // constitution de la liste des sommets
     std::vector<Topo::Vertex*> v_vertices;
-    std::map<Topo::Vertex*, uint> filtre_vertices;
+    TopoFilter<Vertex> filtre_vertices;
     for (uint i=0; i<v_faces.size(); i++){
         v_faces[i]->saveFaceTopoProperty(&getInfoCommand());
         for (Vertex* vtx : v_faces[i]->getVertices())
@@ -1089,7 +1085,7 @@ getCoEdges(Geom::GeomEntity* ge, Geom::GeomEntity* ge_init)
         	// on marque les filtre de la surface considérée
         	std::map<Geom::Curve*, uint> filtre_curve;
         	// on marque les coedges qui sont intéressantes
-        	std::map<Topo::CoEdge*, uint> filtre_coedge;
+        	TopoFilter<CoEdge> filtre_coedge;
 
         	for (std::vector<Geom::Curve*>::iterator iter = curves.begin();
         			iter != curves.end(); ++iter)
@@ -1221,8 +1217,8 @@ fuseInternalCoEdgesAndVertices(Geom::GeomEntity* ge, std::vector<Geom::GeomEntit
     // on marque à 1 ce qui est interne, à 2 ce qui est sur le bord
     // comme la surface est détruite, on n'a plus la relation vers les courbes
     // on considère que c'est interne à partir du moment où la projection se fait sur la surface
-    std::map<CoEdge*, uint> filtre_coedges;
-    std::map<Vertex*, uint> filtre_vertices;
+    TopoFilter<CoEdge> filtre_coedges;
+    TopoFilter<Vertex> filtre_vertices;
     const std::vector<Topo::TopoEntity* >& topos = tm.getRefTopos(ge);
 
 #ifdef _DEBUG_MAJTOPO2
@@ -1279,11 +1275,11 @@ fuseInternalCoEdgesAndVertices(Geom::GeomEntity* ge, std::vector<Geom::GeomEntit
     std::vector<Topo::CoEdge*>  internalCoedges;
     std::vector<Topo::Vertex*>  internalVertices;
     uint nbBorderVertices = 0;
-    for (std::map<CoEdge*, uint>::iterator iter = filtre_coedges.begin();
+    for (TopoFilter<CoEdge>::iterator iter = filtre_coedges.begin();
             iter != filtre_coedges.end(); ++iter)
         if ((*iter).second == 1)
             internalCoedges.push_back((*iter).first);
-    for (std::map<Vertex*, uint>::iterator iter = filtre_vertices.begin();
+    for (TopoFilter<Vertex>::iterator iter = filtre_vertices.begin();
             iter != filtre_vertices.end(); ++iter)
         if ((*iter).second == 1)
             internalVertices.push_back((*iter).first);
@@ -1314,7 +1310,7 @@ fuseInternalCoEdgesAndVertices(Geom::GeomEntity* ge, std::vector<Geom::GeomEntit
     	std::cout<<"Fusion des sommets au plus proche entre les 2 surfaces, "<<internalVertices.size()
     			 <<" à coller avec "<<all_vertices2.size()<<" sommets"<<std::endl;
 #endif
-   	std::map<Vertex*, uint> filtre_vertices;
+   	TopoFilter<Vertex> filtre_vertices;
     	double tol = ge->getArea()*Utils::Math::MgxNumeric::mgxTopoDoubleEpsilon;
     	for (uint i=0; i<internalVertices.size(); i++){
     		Topo::Vertex* vtx0 = internalVertices[i];
@@ -1496,7 +1492,7 @@ getSameCoEdges(Topo::CoEdge* coedge)
     if (0 == coedge)
         return coedges_trouvees;
 
-    std::map<Vertex*, uint> filtre_vertices;
+    TopoFilter<Vertex> filtre_vertices;
 
     std::vector<Vertex*> vertices = coedge->getVertices();
     for (uint i=0; i<vertices.size(); i++)
@@ -1541,7 +1537,7 @@ getSameCoFaces(Topo::CoFace* coface)
     std::cout<<"getSameCoFaces avec coface = "<<coface->getName()<<std::endl;
 #endif
 
-    std::map<CoEdge*, uint> filtre_coedges;
+    TopoFilter<CoEdge> filtre_coedges;
 
     std::vector<CoEdge* > coedges = coface->getCoEdges();
 
@@ -1809,12 +1805,12 @@ getInnerCoFaces(std::vector<Topo::CoFace*>& cofaces, std::vector<CoEdge*>& coedg
     // 1 <-> au bord
     // 2 <-> connectée à une coface sélectionnée
     // 3 <-> connectée à deux cofaces sélectionnées
-    std::map<CoEdge*, uint> filtre_coedges;
+    TopoFilter<CoEdge> filtre_coedges;
 
     // les faces sont marquées à:
     // 1 <-> acceptables
     // 2 <-> sélectionnées dans sous-ensemble
-    std::map<CoFace*, uint> filtre_cofaces;
+    TopoFilter<CoFace> filtre_cofaces;
 
     // on marque les arêtes au bord
     for (uint i=0; i<coedges.size(); i++)
@@ -1944,12 +1940,12 @@ std::vector<Topo::Block*> CommandModificationTopo::getInnerBlocks(std::vector<To
     // 1 <-> au bord
     // 2 <-> connectée à un bloc sélectionné
     // 3 <-> connectée à deux blocs sélectionnés
-    std::map<CoFace*, uint> filtre_cofaces;
+    TopoFilter<CoFace> filtre_cofaces;
 
     // les blocs sont marqués à:
     // 1 <-> acceptables
     // 2 <-> sélectionnées dans sous-ensemble
-    std::map<Block*, uint> filtre_blocks;
+    TopoFilter<Block> filtre_blocks;
 
     // on marque les faces au bord
     for (uint i=0; i<cofaces.size(); i++)
@@ -2207,7 +2203,7 @@ void CommandModificationTopo::associateInnerCoFaces(std::vector<Geom::GeomEntity
 #endif
 
     std::map<Geom::Surface*, uint> filtre_surface;
-    std::map<Topo::CoFace*, uint> filtre_cofaces;
+    TopoFilter<CoFace> filtre_cofaces;
 
     for (uint k=0; k<geoms.size(); k++){
     	auto surfaces = dynamic_cast<Geom::Volume*>(geoms[k])->getSurfaces();
@@ -2224,7 +2220,7 @@ void CommandModificationTopo::associateInnerCoFaces(std::vector<Geom::GeomEntity
     }
 
     std::vector<Topo::CoFace*> inner_cofaces;
-    for (std::map<Topo::CoFace*, uint>::iterator iter = filtre_cofaces.begin();
+    for (TopoFilter<CoFace>::iterator iter = filtre_cofaces.begin();
     		iter != filtre_cofaces.end(); ++iter)
     	if (iter->second >= 2)
     		inner_cofaces.push_back(iter->first);
@@ -2262,7 +2258,7 @@ void CommandModificationTopo::associateInnerCoEdges(std::vector<Topo::CoFace*>&
     std::cout<<" ge :"<<ge->getName()<<std::endl;
 #endif
 
-    std::map<Topo::CoEdge*, uint> filtre_coedges;
+    TopoFilter<CoEdge> filtre_coedges;
 
     for (uint k=0; k<cofaces.size(); k++){
     	std::vector<Topo::CoEdge*> coedges = cofaces[k]->getCoEdges();
@@ -2270,7 +2266,7 @@ void CommandModificationTopo::associateInnerCoEdges(std::vector<Topo::CoFace*>&
     		filtre_coedges[coedges[j]] += 1;
     }
 
-    for (std::map<Topo::CoEdge*, uint>::iterator iter = filtre_coedges.begin();
+    for (TopoFilter<CoEdge>::iterator iter = filtre_coedges.begin();
     		iter != filtre_coedges.end(); ++iter)
     	if (iter->second >= 2){
     		Topo::CoEdge* coedge = iter->first;
@@ -58,9 +58,8 @@ CommandProjectEdgesOnCurves::
 void CommandProjectEdgesOnCurves::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-	message << "CommandProjectEdgesOnCurves::execute pour la commande " << getName ( )
-		    << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandProjectEdgesOnCurves::execute pour la commande " << getName ( )
+		    << " de nom unique " << getUniqueName ( ));
 
 	// modification de la projection, avec gestion du undo/redo
 	for (std::vector<CoEdge*>::iterator iter = m_coedges.begin();
@@ -98,8 +97,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandProjectEdgesOnCurves::project(CoEdge* coedge, Geom::GeomEntity* ge)
@@ -52,9 +52,8 @@ CommandProjectFacesOnSurfaces::
 void CommandProjectFacesOnSurfaces::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-	message << "CommandProjectFacesOnSurfaces::execute pour la commande " << getName ( )
-		    << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandProjectFacesOnSurfaces::execute pour la commande " << getName ( )
+		    << " de nom unique " << getUniqueName ( ));
 
 	// modification de la projection, avec gestion du undo/redo
 	for (std::vector<CoFace*>::iterator iter = m_cofaces.begin();
@@ -69,8 +68,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandProjectFacesOnSurfaces::project(CoFace* coface, Geom::Surface* surface)
@@ -3,7 +3,7 @@
 #include "Geom/GeomEntity.h"
 #include "Geom/EntityFactory.h"
 #include "Geom/IncidentGeomEntitiesVisitor.h"
-#include "Geom/GeomProjectImplementation.h"
+#include "Geom/GeomNearestEntitySearch.h"
 
 #include "Topo/TopoManager.h"
 #include "Topo/Vertex.h"
@@ -62,43 +62,32 @@ CommandProjectVerticesOnNearestGeomEntities::
 void CommandProjectVerticesOnNearestGeomEntities::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-	message << "CommandProjectVerticesOnNearestGeomEntities::execute pour la commande " << getName ( )
-		    << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandProjectVerticesOnNearestGeomEntities::execute pour la commande " << getName ( )
+		    << " de nom unique " << getUniqueName ( ));
 
-	// modification de la projection, avec gestion du undo/redo
-	for (std::vector<Vertex*>::iterator iter = m_vertices.begin();
-	        iter != m_vertices.end(); ++iter){
-		Vertex* vtx = *iter;
-		Geom::GeomEntity* ge_min = 0;
-		double dist_min = DBL_MAX;
-
-		for (std::vector<Geom::GeomEntity*>::iterator iter2 = m_geom_entities.begin();
-				iter2 != m_geom_entities.end(); ++iter2){
-			Geom::GeomEntity* ge = *iter2;
-			Utils::Math::Point pt1 = vtx->getCoord();
-			Geom::GeomProjectVisitor gpv(pt1);
-			ge->accept(gpv);
-			Utils::Math::Point pt2 = gpv.getProjectedPoint();
-			double dist = pt1.length2(pt2);
-
-			if (dist<dist_min){
-				dist_min = dist;
-				ge_min = ge;
-			}
-		}
+	// recherche des entités les plus proches (sans modification, en parallèle)
+	std::vector<Utils::Math::Point> points;
+	points.reserve(m_vertices.size());
+	for (Vertex* vtx : m_vertices)
+		points.push_back(vtx->getCoord());
+
+	Geom::GeomNearestEntitySearch search(m_geom_entities);
+	std::vector<Geom::GeomEntity*> nearest;
+	std::vector<Utils::Math::Point> projected;
+	search.findNearest(points, nearest, projected);
 
-		CHECK_NULL_PTR_ERROR(ge_min);
-		project(vtx, ge_min);
+	// modification de la projection, avec gestion du undo/redo
+	for (uint i=0; i<m_vertices.size(); i++){
+		CHECK_NULL_PTR_ERROR(nearest[i]);
+		project(m_vertices[i], nearest[i], projected[i]);
 	}
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 ///*----------------------------------------------------------------------------*/
-void CommandProjectVerticesOnNearestGeomEntities::project(Vertex* vtx, Geom::GeomEntity* ge)
+void CommandProjectVerticesOnNearestGeomEntities::project(Vertex* vtx, Geom::GeomEntity* ge,
+		const Utils::Math::Point& posGeom)
 {
 	vtx->saveTopoProperty();
 	vtx->setGeomAssociation(ge);
@@ -106,9 +95,6 @@ void CommandProjectVerticesOnNearestGeomEntities::project(Vertex* vtx, Geom::Geo
 	// déplace le sommet topologique si la projection implique un déplacement
 	if (m_move_vertices){
 		Utils::Math::Point posTopo = vtx->getCoord();
-		Geom::GeomProjectVisitor gpv(posTopo);
-		ge->accept(gpv);
-		Utils::Math::Point posGeom = gpv.getProjectedPoint();
 		if (!posTopo.isEpsilonEqual(posGeom, Utils::Math::MgxNumeric::mgxTopoDoubleEpsilon)){
 			vtx->saveVertexGeomProperty(&getInfoCommand(), true);
 			vtx->setCoord(posGeom);
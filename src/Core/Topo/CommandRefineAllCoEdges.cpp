@@ -30,9 +30,8 @@ CommandRefineAllCoEdges::
 void CommandRefineAllCoEdges::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandRefineAllCoEdges::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandRefineAllCoEdges::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     for (CoEdge* coedge : getContext().getTopoManager().getCoEdgesObj()){
     	CoEdgeMeshingProperty* mp = coedge->getMeshingProperty();
@@ -53,8 +52,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandRefineAllCoEdges::getPreviewRepresentation(Utils::DisplayRepresentation& dr)
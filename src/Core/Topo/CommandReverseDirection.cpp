@@ -35,9 +35,8 @@ CommandReverseDirection::
 void CommandReverseDirection::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandReverseDirection::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandReverseDirection::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     for (std::vector<CoEdge*>::iterator iter = m_coedges.begin(); iter!=m_coedges.end(); ++iter){
     	// sauvegarde pour permettre le undo
@@ -50,8 +49,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandReverseDirection::getPreviewRepresentation(Utils::DisplayRepresentation& dr)
@@ -64,9 +64,8 @@ CommandRotateTopo::
 void CommandRotateTopo::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandRotateTopo::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandRotateTopo::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     // création de l'opérateur de rotation via OCC
     gp_Trsf transf;
@@ -85,8 +84,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandRotateTopo::getPreviewRepresentation(Utils::DisplayRepresentation& dr)
@@ -185,9 +185,8 @@ CommandScaleTopo::
 void CommandScaleTopo::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandScaleTopo::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandScaleTopo::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     if (m_isHomogene){
     	// création de l'opérateur d'homothétie via OCC
@@ -213,8 +212,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandScaleTopo::getPreviewRepresentation(Utils::DisplayRepresentation& dr)
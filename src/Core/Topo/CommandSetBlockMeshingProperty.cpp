@@ -51,9 +51,8 @@ CommandSetBlockMeshingProperty::
 void CommandSetBlockMeshingProperty::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandSetBlockMeshingProperty::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandSetBlockMeshingProperty::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     for (std::vector<Block*>::iterator iter = m_blocks.begin(); iter!=m_blocks.end(); ++iter){
 
@@ -219,8 +218,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 
 /*----------------------------------------------------------------------------*/
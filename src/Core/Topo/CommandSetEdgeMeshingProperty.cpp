@@ -46,9 +46,8 @@ CommandSetEdgeMeshingProperty::
 void CommandSetEdgeMeshingProperty::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandSetEdgeMeshingProperty::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandSetEdgeMeshingProperty::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     // remplace la propriété (fait une copie) et met l'ancienne dans la sauvegarde interne
     for (std::vector<CoEdge*>::iterator iter = m_coedges.begin(); iter!=m_coedges.end(); ++iter){
@@ -59,8 +58,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandSetEdgeMeshingProperty::getPreviewRepresentation(Utils::DisplayRepresentation& dr)
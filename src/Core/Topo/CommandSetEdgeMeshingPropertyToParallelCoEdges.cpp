@@ -2,13 +2,14 @@
 #include "Topo/CommandSetEdgeMeshingPropertyToParallelCoEdges.h"
 #include "Topo/CoFace.h"
 #include "Topo/CoEdge.h"
+#include "Topo/TopoManager.h"
+#include "Topo/ChordIndex.h"
 #include "Utils/Common.h"
 /*----------------------------------------------------------------------------*/
 #include <TkUtil/TraceLog.h>
 #include <TkUtil/UTF8String.h>
 /*----------------------------------------------------------------------------*/
-#include <set>
-#include <map>
+#include <vector>
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
@@ -31,57 +32,19 @@ CommandSetEdgeMeshingPropertyToParallelCoEdges::
 void CommandSetEdgeMeshingPropertyToParallelCoEdges::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandSetEdgeMeshingPropertyToParallelCoEdges::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandSetEdgeMeshingPropertyToParallelCoEdges::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
-    // stockage des arêtes en cours de traitement
-    std::vector<CoEdge*> coedges_in;
-
-    // stockage des arêtes parallèles et du sens / discrétisation à cloner
-    std::map<CoEdge*, bool> parallel_coedges;
-
-    // filtre sur les coedges pour éviter de boucler indéfiniement
-     std::set<CoEdge*> filtre_coedge;
-
-    // on initialise avec celle passée en paramètre
-     if (m_coedge){
-    	 coedges_in.push_back(m_coedge);
-    	 parallel_coedges[m_coedge] = false;
-    	 filtre_coedge.insert(m_coedge);
-     }
-
-     // boucle tant que l'on a des arêtes non traitées
-     while (!coedges_in.empty()){
-
-    	 CoEdge* coedge_dep = coedges_in.back();
-    	 coedges_in.pop_back();
-
-    	 // boucle sur les cofaces autour
-    	 std::vector<CoFace*> cofaces = coedge_dep->getCoFaces();
-    	 for (uint i=0; i<cofaces.size(); i++){
-    		 CoFace* coface = cofaces[i];
-
-    		 bool inverse_sens;
-    		 CoEdge* coedge_vois = coface->getOppositeCoEdge(coedge_dep, inverse_sens);
-
-    		 if (coedge_vois && filtre_coedge.find(coedge_vois)==filtre_coedge.end()){
-    			 coedges_in.push_back(coedge_vois);
-    			 if (parallel_coedges[coedge_dep])
-    				 parallel_coedges[coedge_vois] = inverse_sens;
-    			 else
-    				 parallel_coedges[coedge_vois] = !inverse_sens;
-    			 // pour ne pas la reprendre
-    			 filtre_coedge.insert(coedge_vois);
-    		 }
-    	 } // end for i
-     } // end while
+    // les arêtes parallèles (la corde) et le sens / discrétisation à cloner
+    std::vector<CoEdge*> parallel_coedges;
+    std::vector<bool> inverted;
+    if (m_coedge)
+        getTopoManager().getChordIndex().getChord(m_coedge, parallel_coedges, inverted);
 
      // remplace la propriété (fait une copie) et met l'ancienne dans la sauvegarde interne
-     for (std::map<CoEdge*, bool>::iterator iter = parallel_coedges.begin();
-    		 iter != parallel_coedges.end(); ++iter){
-    	 CoEdge* coedge = (*iter).first;
-    	 bool inverse_sens = (*iter).second;
+     for (uint i=0; i<parallel_coedges.size(); i++){
+    	 CoEdge* coedge = parallel_coedges[i];
+    	 bool inverse_sens = inverted[i];
 
     	 if (inverse_sens)
     		 m_prop->setDirect(!m_prop->getDirect());
@@ -97,8 +60,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandSetEdgeMeshingPropertyToParallelCoEdges::getPreviewRepresentation(Utils::DisplayRepresentation& dr)
@@ -46,9 +46,8 @@ CommandSetFaceMeshingProperty::
 void CommandSetFaceMeshingProperty::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandSetFaceMeshingProperty::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandSetFaceMeshingProperty::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     for (std::vector<CoFace*>::iterator iter = m_cofaces.begin(); iter!=m_cofaces.end(); ++iter){
 
@@ -63,8 +62,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandSetFaceMeshingProperty::getPreviewRepresentation(Utils::DisplayRepresentation& dr)
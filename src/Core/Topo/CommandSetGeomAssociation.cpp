@@ -97,9 +97,8 @@ CommandSetGeomAssociation::
 void CommandSetGeomAssociation::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-	message << "CommandSetGeomAssociation::execute pour la commande " << getName ( )
-		    << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandSetGeomAssociation::execute pour la commande " << getName ( )
+		    << " de nom unique " << getUniqueName ( ));
 
 	// récupération si nécessaire et validation du type de géométrie
 	validGeomEntity();
@@ -123,8 +122,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandSetGeomAssociation::validGeomEntity()
@@ -43,9 +43,8 @@ CommandSetNbMeshingEdges::
 void CommandSetNbMeshingEdges::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandSetNbMeshingEdges::execute pour la commande " << getName ( )
-                    << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandSetNbMeshingEdges::execute pour la commande " << getName ( )
+                    << " de nom unique " << getUniqueName ( ));
 
     SetNbMeshingEdgesImplementation implementation(&getInfoCommand());
 
@@ -57,8 +56,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandSetNbMeshingEdges::getPreviewRepresentation(Utils::DisplayRepresentation& dr)
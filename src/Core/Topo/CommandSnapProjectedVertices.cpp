@@ -54,9 +54,8 @@ CommandSnapProjectedVertices::
 void CommandSnapProjectedVertices::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandSnapProjectedVertices::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandSnapProjectedVertices::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     for (std::vector<Vertex*>::iterator iter = m_vertices.begin();
             iter != m_vertices.end(); ++iter){
@@ -81,8 +80,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandSnapProjectedVertices::getPreviewRepresentation(Utils::DisplayRepresentation& dr)
@@ -227,9 +227,8 @@ CommandSnapVertices::
 void CommandSnapVertices::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandSnapVertices::execute pour la commande " << getName ( )
-                    << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandSnapVertices::execute pour la commande " << getName ( )
+                    << " de nom unique " << getUniqueName ( ));
 
 
     // liste des blocs modifiés par le déplacement des sommets
@@ -616,8 +615,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 bool CommandSnapVertices::needDeleteSom2Association(Vertex* som1, Vertex* som2)
@@ -62,9 +62,8 @@ CommandSplitBlock::
 void CommandSplitBlock::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandSplitBlock::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandSplitBlock::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     // cas où la commande doit être détuite, il faut en créer une autre ...
     if (m_isPreview)
@@ -87,8 +86,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandSplitBlock::
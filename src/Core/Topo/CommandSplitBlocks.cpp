@@ -146,19 +146,27 @@ internalExecute()
     uint nb_blocs_dep = m_blocs.size();
     uint nb_blocs_split = 0;
 
-    std::set<CoEdge*> filtre_coedges;
-    std::set<Block*> filtre_blocs;
+    // indice de chacun des blocs à découper
+    std::unordered_map<Block*, uint> indices_blocs;
+    for (uint i=0; i<m_blocs.size(); i++)
+    	indices_blocs[m_blocs[i]] = i;
+
+    std::unordered_set<CoEdge*> filtre_coedges;
+    std::vector<bool> filtre_blocs(m_blocs.size(), false);
+    BlockQueue candidats;
 
     filtre_coedges.insert(m_arete);
+    addBlocksWithCoEdge(m_arete, indices_blocs, candidats);
     //std::cout<<"  filtre_coedges.insert("<<m_arete->getName()<<")\n";
 
     try {
     	do {
     		CoEdge* arete = 0;
-    		Block* bloc = 0;
+    		uint ind_bloc = 0;
 
     		// recherche d'un bloc suivant avec une arête
-    		findBlockUnmarkedWithCoEdgeMarked(filtre_blocs, filtre_coedges, bloc, arete);
+    		findBlockUnmarkedWithCoEdgeMarked(candidats, filtre_blocs, filtre_coedges, ind_bloc, arete);
+    		Block* bloc = m_blocs[ind_bloc];
 
     		// Les blocs créés
     		std::vector<Block* > newBlocks;
@@ -169,7 +177,7 @@ internalExecute()
     			bloc->split(m_arete, m_ratio, newBlocks, &getInfoCommand());
 
     		nb_blocs_split+=1;
-    		filtre_blocs.insert(bloc);
+    		filtre_blocs[ind_bloc] = true;
 
     		// marquer les aretes entre les 2 séries de blocs
     		if (newBlocks.size() != 2){
@@ -182,7 +190,8 @@ internalExecute()
 
     		for (std::vector<CoEdge*>::iterator iter=newCoedges.begin(); iter!=newCoedges.end(); ++iter){
     			//std::cout<<"  filtre_coedges.insert("<<(*iter)->getName()<<")\n";
-    			filtre_coedges.insert(*iter);
+    			if (filtre_coedges.insert(*iter).second)
+    				addBlocksWithCoEdge(*iter, indices_blocs, candidats);
     		}
 
     	} while (nb_blocs_dep != nb_blocs_split);
@@ -204,24 +213,35 @@ internalExecute()
 }
 /*----------------------------------------------------------------------------*/
 void CommandSplitBlocks::
-findBlockUnmarkedWithCoEdgeMarked(std::set<Block*>& filtre_blocs,
-		std::set<CoEdge*>& filtre_coedges, Block* &bloc, CoEdge* &arete)
+addBlocksWithCoEdge(CoEdge* coedge, const std::unordered_map<Block*, uint>& indices_blocs,
+		BlockQueue& candidats)
+{
+	for (Block* bl : coedge->getBlocks()){
+		std::unordered_map<Block*, uint>::const_iterator iter = indices_blocs.find(bl);
+		if (iter != indices_blocs.end())
+			candidats.push(iter->second);
+	}
+}
+/*----------------------------------------------------------------------------*/
+void CommandSplitBlocks::
+findBlockUnmarkedWithCoEdgeMarked(BlockQueue& candidats, const std::vector<bool>& filtre_blocs,
+		const std::unordered_set<CoEdge*>& filtre_coedges, uint& ind_bloc, CoEdge* &arete)
 {
 	//std::cout<<"findBlockUnmarkedWithCoEdgeMarked ..."<<std::endl;
-	for (std::vector<Block*>::iterator iter1 = m_blocs.begin(); iter1 != m_blocs.end(); ++iter1){
+	while (!candidats.empty()){
+		uint ind = candidats.top();
+		candidats.pop();
 		// le bloc est-il marqué ?
-		//std::cout<<" bloc "<<(*iter1)->getName()<<std::endl;
-		if (filtre_blocs.find(*iter1) == filtre_blocs.end()){
-			Block* bl = *iter1;
-			//std::cout<<"   pas encore vu, on recherche une arête ..."<<std::endl;
-			// possède-t-il une arête marquée ?
-			std::vector<CoEdge* > coedges = bl->getCoEdges();
-			for (std::vector<CoEdge*>::iterator iter2 = coedges.begin(); iter2 != coedges.end(); ++iter2){
-				if (filtre_coedges.find(*iter2) != filtre_coedges.end()){
-					arete = *iter2;
-					bloc = bl;
-					return;
-				}
+		if (filtre_blocs[ind])
+			continue;
+		Block* bl = m_blocs[ind];
+		// possède-t-il (toujours) une arête marquée ?
+		std::vector<CoEdge* > coedges = bl->getCoEdges();
+		for (std::vector<CoEdge*>::iterator iter2 = coedges.begin(); iter2 != coedges.end(); ++iter2){
+			if (filtre_coedges.find(*iter2) != filtre_coedges.end()){
+				arete = *iter2;
+				ind_bloc = ind;
+				return;
 			}
 		}
 	}
@@ -239,7 +259,19 @@ countNbCoEdgesByVertices(std::map<Topo::Vertex*, uint> &nb_coedges_by_vertex)
 /*----------------------------------------------------------------------------*/
 void CommandSplitBlocks::getPreviewRepresentation(Utils::DisplayRepresentation& dr)
 {
-	return getPreviewRepresentationTopoModif(dr);
+	std::atomic<bool> cancel(false);
+	computePreview(dr, cancel);
+}
+/*----------------------------------------------------------------------------*/
+bool CommandSplitBlocks::computePreview(Utils::DisplayRepresentation& dr,
+		const std::atomic<bool>& cancel)
+{
+	// la coupe se propage de proche en proche dans les faces communes des blocs à découper
+	std::vector<CoFace*> cofaces;
+	TopoHelper::getCoFaces(m_blocs, cofaces);
+
+	return TopoHelper::computeSplitPreview(cofaces, m_arete, m_ratio, true,
+			dr.getPoints(), dr.getCurveDiscretization(), cancel);
 }
 /*----------------------------------------------------------------------------*/
 } // end namespace Topo
@@ -85,22 +85,21 @@ CommandSplitBlocksWithOgrid::
 void CommandSplitBlocksWithOgrid::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandSplitBlocksWithOgrid::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandSplitBlocksWithOgrid::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
 #ifdef _DEBUG_SPLIT_OGRID
     std::cout<<"CommandSplitBlocksWithOgrid::internalExecute"<<std::endl;
 #endif
 
     // Filtres:  à 1 pour ce qui est sur le bord et à 2 ce qui est à l'intérieur
-    std::map<Vertex*, uint> filtre_vertex;
-    std::map<CoEdge*, uint> filtre_coedge;
-    std::map<CoFace*, uint> filtre_coface;
-    std::map<Block*,  uint> filtre_bloc;
+    TopoFilter<Vertex> filtre_vertex;
+    TopoFilter<CoEdge> filtre_coedge;
+    TopoFilter<CoFace> filtre_coface;
+    TopoFilter<Block> filtre_bloc;
     // Filtre pour les Faces à 1 si toutes ses cofaces sont à conserver comme un ensemble,
     // à 2 si les cofaces sont à prendre séparément
-    std::map<Face*,  uint> filtre_face;
+    TopoFilter<Face> filtre_face;
 
     // Renseigne les filtres
     computeFilters(filtre_vertex, filtre_coedge, filtre_coface, filtre_face, filtre_bloc);
@@ -165,16 +164,14 @@ internalExecute()
 
 //    std::cout<<"Dans CommandSplitBlocksWithOgrid: "<<std::endl;
 //    std::cout<< getInfoCommand() <<std::endl;
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandSplitBlocksWithOgrid::
-computeFilters(std::map<Vertex*, uint> & filtre_vertex,
-            std::map<CoEdge*, uint> & filtre_coedge,
-            std::map<CoFace*, uint> & filtre_coface,
-            std::map<Face*,  uint> & filtre_face,
-            std::map<Block*,  uint> & filtre_bloc)
+computeFilters(TopoFilter<Vertex> & filtre_vertex,
+            TopoFilter<CoEdge> & filtre_coedge,
+            TopoFilter<CoFace> & filtre_coface,
+            TopoFilter<Face> & filtre_face,
+            TopoFilter<Block> & filtre_bloc)
 {
     // premier passage pour compter le nombre de blocs (sélectionnés) en relation avec faces communes
     // et on marque à 2 tous les sommets, arêtes et blocs
@@ -436,7 +433,7 @@ computeFilters(std::map<Vertex*, uint> & filtre_vertex,
     } // end if (!m_create_internal_vertices)
 
     // on ne touchera pas aux arêtes entièrement à l'intérieur (celles avec les 2 sommets internes)
-    for (std::map<CoEdge*, uint>::iterator iter_ce=filtre_coedge.begin();
+    for (TopoFilter<CoEdge>::iterator iter_ce=filtre_coedge.begin();
     		iter_ce!=filtre_coedge.end(); ++iter_ce)
     	if (iter_ce->second == 2
     			&& filtre_vertex[iter_ce->first->getVertices()[0]] == 2
@@ -447,37 +444,37 @@ computeFilters(std::map<Vertex*, uint> & filtre_vertex,
 #ifdef _DEBUG_SPLIT_OGRID
     std::cout<<"## computeFilters => "<<std::endl;
     std::cout<<"filtre_vertex : "<<std::endl;
-    for (std::map<Vertex*, uint>::iterator iter=filtre_vertex.begin();
+    for (TopoFilter<Vertex>::iterator iter=filtre_vertex.begin();
     		iter!=filtre_vertex.end(); ++iter){
     	std::cout<<"  "<<iter->first->getName()<<" : "<<iter->second<<std::endl;
     } // end for iter
     std::cout<<"filtre_coedge : "<<std::endl;
-    for (std::map<CoEdge*, uint>::iterator iter=filtre_coedge.begin();
+    for (TopoFilter<CoEdge>::iterator iter=filtre_coedge.begin();
     		iter!=filtre_coedge.end(); ++iter){
     	std::cout<<"  "<<iter->first->getName()<<" : "<<iter->second<<std::endl;
     } // end for iter
     std::cout<<"filtre_coface : "<<std::endl;
-    for (std::map<CoFace*, uint>::iterator iter=filtre_coface.begin();
+    for (TopoFilter<CoFace>::iterator iter=filtre_coface.begin();
     		iter!=filtre_coface.end(); ++iter){
     	std::cout<<"  "<<iter->first->getName()<<" : "<<iter->second<<std::endl;
     } // end for iter
     std::cout<<"filtre_face : "<<std::endl;
-    for (std::map<Face*, uint>::iterator iter=filtre_face.begin();
+    for (TopoFilter<Face>::iterator iter=filtre_face.begin();
     		iter!=filtre_face.end(); ++iter){
     	std::cout<<"  "<<iter->first->getName()<<" : "<<iter->second<<std::endl;
     } // end for iter
     std::cout<<"filtre_bloc : "<<std::endl;
-    for (std::map<Block*, uint>::iterator iter=filtre_bloc.begin();
+    for (TopoFilter<Block>::iterator iter=filtre_bloc.begin();
     		iter!=filtre_bloc.end(); ++iter){
     	std::cout<<"  "<<iter->first->getName()<<" : "<<iter->second<<std::endl;
     } // end for iter
 #endif
 }
 /*----------------------------------------------------------------------------*/
-void CommandSplitBlocksWithOgrid::saveTopoProperty(std::map<Vertex*, uint> & filtre_vertex,
-        std::map<CoEdge*, uint> & filtre_coedge,
-        std::map<CoFace*, uint> & filtre_coface,
-        std::map<Block*,  uint> & filtre_bloc)
+void CommandSplitBlocksWithOgrid::saveTopoProperty(TopoFilter<Vertex> & filtre_vertex,
+        TopoFilter<CoEdge> & filtre_coedge,
+        TopoFilter<CoFace> & filtre_coface,
+        TopoFilter<Block> & filtre_bloc)
 {
     for (std::vector<Block* >::iterator iter1 = m_blocs.begin();
              iter1 != m_blocs.end(); ++iter1){
@@ -546,9 +543,9 @@ void CommandSplitBlocksWithOgrid::saveTopoProperty(std::map<Vertex*, uint> & fil
 }
 /*----------------------------------------------------------------------------*/
 void CommandSplitBlocksWithOgrid::
-createVertices(std::map<Vertex*, uint> & filtre_vertex,
-        std::map<CoEdge*, uint> & filtre_coedge,
-        std::map<CoFace*, uint> & filtre_coface,
+createVertices(TopoFilter<Vertex> & filtre_vertex,
+        TopoFilter<CoEdge> & filtre_coedge,
+        TopoFilter<CoFace> & filtre_coface,
         std::map<Vertex*, Vertex*> & corr_vertex)
 {
 #ifdef _DEBUG_SPLIT_OGRID
@@ -642,7 +639,7 @@ createVertices(std::map<Vertex*, uint> & filtre_vertex,
                     // et en utilisant seulement des arêtes marquées à 2
                     // (arêtes internes à la sélection, entre bord et sélection)
                     Vertex* vtx_opp;
-                    std::map<CoEdge*, uint> filtre_vu;
+                    TopoFilter<CoEdge> filtre_vu;
                     Vertex* vtx_prec = sommet;
 
                     // les coedges utilisées
@@ -736,7 +733,7 @@ createVertices(std::map<Vertex*, uint> & filtre_vertex,
 
                     // recherche du bloc commun aux deux cofaces
                     Block* bloc_commun = 0;
-                    std::map<Block*, uint> filtre_vu;
+                    TopoFilter<Block> filtre_vu;
 
                     for (Block* bl : cofaces_int[0]->getBlocks())
                         filtre_vu[bl] = 1;
@@ -770,7 +767,7 @@ createVertices(std::map<Vertex*, uint> & filtre_vertex,
 }
 /*----------------------------------------------------------------------------*/
 void CommandSplitBlocksWithOgrid::
-createCoEdges(std::map<Vertex*, uint> & filtre_vertex,
+createCoEdges(TopoFilter<Vertex> & filtre_vertex,
         std::map<Vertex*, Vertex*> & corr_vertex,
         std::map<Vertex*, CoEdge*> & corr_vtx_coedge)
 {
@@ -810,13 +807,13 @@ createCoEdges(std::map<Vertex*, uint> & filtre_vertex,
 }
 /*----------------------------------------------------------------------------*/
 void CommandSplitBlocksWithOgrid::
-createCoEdgeAndFace(std::map<Vertex*, uint> & filtre_vertex,
+createCoEdgeAndFace(TopoFilter<Vertex> & filtre_vertex,
         std::map<Vertex*, Vertex*>  & corr_vertex,
         std::map<Vertex*, CoEdge*> & corr_vtx_coedge,
-        std::map<CoEdge*, uint> & filtre_coedge,
-        std::map<CoFace*, uint> & filtre_coface,
-        std::map<Face*,  uint> & filtre_face,
-        std::map<Block*,  uint> & filtre_bloc,
+        TopoFilter<CoEdge> & filtre_coedge,
+        TopoFilter<CoFace> & filtre_coface,
+        TopoFilter<Face> & filtre_face,
+        TopoFilter<Block> & filtre_bloc,
         std::map<std::pair<Vertex*, Vertex*>, CoEdge*> & corr_2vtx_coedge,
         std::map<std::pair<Vertex*, Vertex*>, CoFace*> & corr_2vtx_coface)
 {
@@ -920,7 +917,7 @@ getSelectedVertices(Vertex* vtx0,
         Vertex*vtx1,
         std::vector<CoEdge* > & iCoedges,
         std::vector<CoEdge* > & jCoedges,
-        std::map<Vertex*, uint> & filtre_vertex)
+        TopoFilter<Vertex> & filtre_vertex)
 {
     // recherche des arêtes entre les 2 sommets
     std::vector<CoEdge* > coedges_between;
@@ -935,7 +932,7 @@ getSelectedVertices(Vertex* vtx0,
     // interne au bord, on ne prend que les sommets marqués
 
     Vertex* vtx_opp;
-    std::map<CoEdge*, uint> filtre_vu;
+    TopoFilter<CoEdge> filtre_vu;
     Vertex* vtx_prec = vtx0;
     // on se déplace suivant coedges_between, pour cela on marque à 1 ces arêtes puis à 2 lorsqu'on les a utlisé
     for (uint i=0; i<coedges_between.size(); i++)
@@ -982,8 +979,8 @@ createCoEdgeAndFace(Vertex* vtx0,
         std::vector<CoEdge* > & jCoedges,
         std::map<Vertex*, Vertex*>  & corr_vertex,
         std::map<Vertex*, CoEdge*> & corr_vtx_coedge,
-        std::map<Vertex*, uint> & filtre_vertex,
-        std::map<CoEdge*, uint> & filtre_coedge,
+        TopoFilter<Vertex> & filtre_vertex,
+        TopoFilter<CoEdge> & filtre_coedge,
         std::vector<std::string> & groupsName,
         std::map<std::pair<Vertex*, Vertex*>, CoEdge*> & corr_2vtx_coedge,
         std::map<std::pair<Vertex*, Vertex*>, CoFace*> & corr_2vtx_coface)
@@ -1129,12 +1126,12 @@ createCoEdgeAndFace(Vertex* vtx0,
 }
 /*----------------------------------------------------------------------------*/
 void CommandSplitBlocksWithOgrid::
-createCoFace(std::map<Vertex*, uint> & filtre_vertex,
+createCoFace(TopoFilter<Vertex> & filtre_vertex,
            std::map<Vertex*, Vertex*>  & corr_vertex,
            std::map<std::pair<Vertex*, Vertex*>, CoEdge*> & corr_2vtx_coedge,
-           std::map<CoFace*, uint> & filtre_coface,
-           std::map<Face*,  uint> & filtre_face,
-           std::map<Block*,  uint> & filtre_bloc,
+           TopoFilter<CoFace> & filtre_coface,
+           TopoFilter<Face> & filtre_face,
+           TopoFilter<Block> & filtre_bloc,
            std::map<CoFace*, CoFace*> & corr_coface)
 {
 #ifdef _DEBUG_SPLIT_OGRID
@@ -1312,7 +1309,7 @@ createEdge(Vertex* vtx0,
         std::vector<CoEdge* > & iCoedges,
         std::vector<CoEdge* > & jCoedges,
         std::map<Vertex*, Vertex*>  & corr_vertex,
-        std::map<Vertex*, uint> & filtre_vertex,
+        TopoFilter<Vertex> & filtre_vertex,
         std::map<std::pair<Vertex*, Vertex*>, CoEdge*> & corr_2vtx_coedge)
 {
 #ifdef _DEBUG_SPLIT_OGRID
@@ -1361,7 +1358,7 @@ createFace(Vertex* vtx0,
         std::vector<CoEdge* > & iCoedges,
         std::vector<CoEdge* > & jCoedges,
         std::map<Vertex*, Vertex*>  & corr_vertex,
-        std::map<Vertex*, uint> & filtre_vertex,
+        TopoFilter<Vertex> & filtre_vertex,
         std::map<std::pair<Vertex*, Vertex*>, CoFace*> & corr_2vtx_coface)
 {
 #ifdef _DEBUG_SPLIT_OGRID
@@ -1424,13 +1421,13 @@ createFace(Vertex* vtx0,
 }
 /*----------------------------------------------------------------------------*/
 void CommandSplitBlocksWithOgrid::
-createBlock(std::map<Vertex*, uint> & filtre_vertex,
+createBlock(TopoFilter<Vertex> & filtre_vertex,
         std::map<Vertex*, Vertex*>  & corr_vertex,
         std::map<std::pair<Vertex*, Vertex*>, CoFace*> & corr_2vtx_coface,
-        std::map<CoFace*, uint> & filtre_coface,
+        TopoFilter<CoFace> & filtre_coface,
         std::map<CoFace*, CoFace*> & corr_coface,
-        std::map<Face*,  uint> & filtre_face,
-        std::map<Block*,  uint> & filtre_bloc)
+        TopoFilter<Face> & filtre_face,
+        TopoFilter<Block> & filtre_bloc)
 {
 #ifdef _DEBUG_SPLIT_OGRID
     std::cout<<"createBlock ..."<<std::endl;
@@ -1740,10 +1737,10 @@ createFace(Face* face,
 }
 /*----------------------------------------------------------------------------*/
 void CommandSplitBlocksWithOgrid::
-freeUnused(std::map<Vertex*, uint> & filtre_vertex,
-        std::map<CoEdge*, uint> & filtre_coedge,
-		std::map<CoFace*, uint> & filtre_coface,
-		std::map<Block*,  uint> & filtre_bloc,
+freeUnused(TopoFilter<Vertex> & filtre_vertex,
+        TopoFilter<CoEdge> & filtre_coedge,
+		TopoFilter<CoFace> & filtre_coface,
+		TopoFilter<Block> & filtre_bloc,
 		std::map<Vertex*, CoEdge*> & corr_vtx_coedge,
 		std::map<std::pair<Vertex*, Vertex*>, CoEdge*> & corr_2vtx_coedge,
 		std::map<std::pair<Vertex*, Vertex*>, CoFace*> & corr_2vtx_coface,
@@ -1758,7 +1755,7 @@ freeUnused(std::map<Vertex*, uint> & filtre_vertex,
 
 	// filtre sur les edges pour stocker d'une part celles mises à jour (marque à 2)
 	// celles à mettre à jour par la suite (marque à 1)
-	std::map<Edge*,  uint>  filtre_edge;
+	TopoFilter<Edge>  filtre_edge;
 
 	// supression des blocs, des faces et cofaces internes (reprise des projections pour ces dernières)
 	for (std::vector<Block* >::iterator iter1 = m_blocs.begin();
@@ -2106,7 +2103,7 @@ freeUnused(std::map<Vertex*, uint> & filtre_vertex,
 }
 /*----------------------------------------------------------------------------*/
 void CommandSplitBlocksWithOgrid::
-updateNeighBorFilter(Edge* edge, std::map<Edge*,  uint> & filtre_edge)
+updateNeighBorFilter(Edge* edge, TopoFilter<Edge> & filtre_edge)
 {
 	for (CoEdge* coedge : edge->getCoEdges())
 		for (Edge* edge : coedge->getEdges())
@@ -2133,11 +2130,10 @@ void CommandSplitBlocksWithOgrid::updateNbMeshingEdges()
 	SetNbMeshingEdgesImplementation implementation(&getInfoCommand());
 
     Internal::InfoCommand& icmd = getInfoCommand();
-    std::map<Topo::TopoEntity*, Internal::InfoCommand::type>& topo_entities_info = icmd.getTopoInfoEntity();
-    for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator iter_tei = topo_entities_info.begin();
-            iter_tei != topo_entities_info.end(); ++iter_tei){
-        Topo::TopoEntity* te = iter_tei->first;
-        Internal::InfoCommand::type& t = iter_tei->second;
+    std::vector<Internal::InfoCommand::TopoEntityInfo>& topo_entities_info = icmd.getTopoInfoEntity();
+    for (uint i_tei=0; i_tei<topo_entities_info.size(); i_tei++){
+        Topo::TopoEntity* te = topo_entities_info[i_tei].m_topo_entity;
+        Internal::InfoCommand::type t = topo_entities_info[i_tei].m_type;
 
         if (t == Internal::InfoCommand::CREATED){
         	if (te->getType() == Utils::Entity::TopoCoEdge)
@@ -54,9 +54,8 @@ CommandSplitEdge::
 void CommandSplitEdge::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandSplitEdge::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandSplitEdge::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     if (m_arete->getNbMeshingEdges() == 1)
         throw TkUtil::Exception (TkUtil::UTF8String ("On ne peut couper une arête avec un seul bras pour le maillage", TkUtil::Charset::UTF_8));
@@ -78,8 +77,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandSplitEdge::getPreviewRepresentation(Utils::DisplayRepresentation& dr)
@@ -254,9 +254,8 @@ CommandSplitFaces::
 void CommandSplitFaces::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandSplitFaces::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandSplitFaces::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     if (m_ratio_dec<0.0 || m_ratio_dec>1.0){
 		TkUtil::UTF8String	messErr (TkUtil::Charset::UTF_8);
@@ -350,7 +349,7 @@ internalExecute()
     		std::vector<CoFace*> cofaces;
 
     		for (CoFace* cf : edge->getCoFaces())
-    			if (getInfoCommand().getTopoInfoEntity()[cf] == Internal::InfoCommand::CREATED)
+    			if (getInfoCommand().getTopoInfoEntityType(cf) == Internal::InfoCommand::CREATED)
     				cofaces.push_back(cf);
 
     		// cas avec découpage au bord (sans coupe en fait)
@@ -421,8 +420,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 bool CommandSplitFaces::
@@ -458,7 +455,21 @@ countNbCoEdgesByVertices(std::map<Topo::Vertex*, uint> &nb_coedges_by_vertex)
 /*----------------------------------------------------------------------------*/
 void CommandSplitFaces::getPreviewRepresentation(Utils::DisplayRepresentation& dr)
 {
-	return getPreviewRepresentationTopoModif(dr);
+	std::atomic<bool> cancel(false);
+	computePreview(dr, cancel);
+}
+/*----------------------------------------------------------------------------*/
+bool CommandSplitFaces::computePreview(Utils::DisplayRepresentation& dr,
+		const std::atomic<bool>& cancel)
+{
+    if (m_ratio_dec<0.0 || m_ratio_dec>1.0){
+		TkUtil::UTF8String	messErr (TkUtil::Charset::UTF_8);
+    	messErr<<"Le ratio pour le découpage doit être dans l'interval [0 1] et non "<<m_ratio_dec;
+    	throw TkUtil::Exception(messErr);
+    }
+
+	return TopoHelper::computeSplitPreview(m_cofaces, m_arete, m_ratio_dec, m_project_on_meshing_edges,
+			dr.getPoints(), dr.getCurveDiscretization(), cancel);
 }
 /*----------------------------------------------------------------------------*/
 } // end namespace Topo
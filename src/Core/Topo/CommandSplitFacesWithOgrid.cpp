@@ -80,21 +80,20 @@ CommandSplitFacesWithOgrid::
 void CommandSplitFacesWithOgrid::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandSplitFacesWithOgrid::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandSplitFacesWithOgrid::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
 #ifdef _DEBUG_SPLIT_OGRID
     std::cout<<"CommandSplitFacesWithOgrid::internalExecute"<<std::endl;
 #endif
 
     // Filtres:  à 1 pour ce qui est sur le bord et à 2 ce qui est à l'intérieur
-    std::map<Vertex*, uint> filtre_vertex;
-    std::map<CoEdge*, uint> filtre_coedge;
-    std::map<CoFace*, uint> filtre_coface;
+    TopoFilter<Vertex> filtre_vertex;
+    TopoFilter<CoEdge> filtre_coedge;
+    TopoFilter<CoFace> filtre_coface;
     // Filtre pour les Edges à 1 si toutes ses coedges sont à conserver comme un ensemble,
     // à 2 si les coedges sont à prendre séparément
-    std::map<Edge*,  uint> filtre_edge;
+    TopoFilter<Edge> filtre_edge;
 
     // Renseigne les filtres
     computeFilters(filtre_vertex, filtre_coedge, filtre_edge, filtre_coface);
@@ -151,15 +150,13 @@ internalExecute()
 
 //    std::cout<<"Dans CommandSplitFacesWithOgrid: "<<std::endl;
 //    std::cout<< getInfoCommand() <<std::endl;
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandSplitFacesWithOgrid::
-computeFilters(std::map<Vertex*, uint> & filtre_vertex,
-            std::map<CoEdge*, uint> & filtre_coedge,
-            std::map<Edge*,  uint> & filtre_edge,
-            std::map<CoFace*, uint> & filtre_coface)
+computeFilters(TopoFilter<Vertex> & filtre_vertex,
+            TopoFilter<CoEdge> & filtre_coedge,
+            TopoFilter<Edge> & filtre_edge,
+            TopoFilter<CoFace> & filtre_coface)
 {
     // premier passage pour compter le nombre de faces (sélectionnées) en relation avec arêtes communes
     // et on marque à 2 tous les sommets, arêtes
@@ -357,7 +354,7 @@ computeFilters(std::map<Vertex*, uint> & filtre_vertex,
     }
 
     // on ne touchera pas aux arêtes entièrement à l'intérieur (celles avec les 2 sommets internes)
-    for (std::map<CoEdge*, uint>::iterator iter_ce=filtre_coedge.begin();
+    for (TopoFilter<CoEdge>::iterator iter_ce=filtre_coedge.begin();
     		iter_ce!=filtre_coedge.end(); ++iter_ce)
     	if (iter_ce->second == 2
     			&& filtre_vertex[iter_ce->first->getVertices()[0]] == 2
@@ -368,31 +365,31 @@ computeFilters(std::map<Vertex*, uint> & filtre_vertex,
 #ifdef _DEBUG_SPLIT_OGRID
     std::cout<<"## computeFilters => "<<std::endl;
     std::cout<<"filtre_vertex : "<<std::endl;
-    for (std::map<Vertex*, uint>::iterator iter=filtre_vertex.begin();
+    for (TopoFilter<Vertex>::iterator iter=filtre_vertex.begin();
     		iter!=filtre_vertex.end(); ++iter){
     	std::cout<<"  "<<iter->first->getName()<<" : "<<iter->second<<std::endl;
     } // end for iter
     std::cout<<"filtre_coedge : "<<std::endl;
-    for (std::map<CoEdge*, uint>::iterator iter=filtre_coedge.begin();
+    for (TopoFilter<CoEdge>::iterator iter=filtre_coedge.begin();
     		iter!=filtre_coedge.end(); ++iter){
     	std::cout<<"  "<<iter->first->getName()<<" : "<<iter->second<<std::endl;
     } // end for iter
     std::cout<<"filtre_edge : "<<std::endl;
-    for (std::map<Edge*, uint>::iterator iter=filtre_edge.begin();
+    for (TopoFilter<Edge>::iterator iter=filtre_edge.begin();
     		iter!=filtre_edge.end(); ++iter){
     	std::cout<<"  "<<iter->first->getName()<<" : "<<iter->second<<std::endl;
     } // end for iter
     std::cout<<"filtre_coface : "<<std::endl;
-    for (std::map<CoFace*, uint>::iterator iter=filtre_coface.begin();
+    for (TopoFilter<CoFace>::iterator iter=filtre_coface.begin();
     		iter!=filtre_coface.end(); ++iter){
     	std::cout<<"  "<<iter->first->getName()<<" : "<<iter->second<<std::endl;
     } // end for iter
 #endif
 }
 /*----------------------------------------------------------------------------*/
-void CommandSplitFacesWithOgrid::saveTopoProperty(std::map<Vertex*, uint> & filtre_vertex,
-        std::map<CoEdge*, uint> & filtre_coedge,
-        std::map<CoFace*, uint> & filtre_coface)
+void CommandSplitFacesWithOgrid::saveTopoProperty(TopoFilter<Vertex> & filtre_vertex,
+        TopoFilter<CoEdge> & filtre_coedge,
+        TopoFilter<CoFace> & filtre_coface)
 {
     for (CoFace* coface : m_cofaces){
     	// seules les faces communes internes ne sont pas touchées
@@ -413,8 +410,8 @@ void CommandSplitFacesWithOgrid::saveTopoProperty(std::map<Vertex*, uint> & filt
 }
 /*----------------------------------------------------------------------------*/
 void CommandSplitFacesWithOgrid::
-createVertices(std::map<Vertex*, uint> & filtre_vertex,
-        std::map<CoEdge*, uint> & filtre_coedge,
+createVertices(TopoFilter<Vertex> & filtre_vertex,
+        TopoFilter<CoEdge> & filtre_coedge,
         std::map<Vertex*, Vertex*> & corr_vertex)
 {
 #ifdef _DEBUG_SPLIT_OGRID
@@ -512,7 +509,7 @@ createVertices(std::map<Vertex*, uint> & filtre_vertex,
 //                    // et en utilisant seulement des arêtes marquées à 2
 //                    // (arêtes internes à la sélection, entre bord et sélection)
 //                    Vertex* vtx_opp;
-//                    std::map<CoEdge*, uint> filtre_vu;
+//                    TopoFilter<CoEdge> filtre_vu;
 //                    Vertex* vtx_prec = sommet;
 //
 //                    // les coedges utilisées
@@ -590,7 +587,7 @@ createVertices(std::map<Vertex*, uint> & filtre_vertex,
 //
 //                    // recherche du bloc commun aux deux cofaces
 //                    CoFace* coface_commune = 0;
-//                    std::map<CoFace*, uint> filtre_vu;
+//                    TopoFilter<CoFace> filtre_vu;
 //
 //                    std::vector<CoFace* > cofaces;
 //                    coedges_int[0]->getCoFaces(cofaces);
@@ -631,7 +628,7 @@ createVertices(std::map<Vertex*, uint> & filtre_vertex,
 }
 /*----------------------------------------------------------------------------*/
 void CommandSplitFacesWithOgrid::
-createCoEdges(std::map<Vertex*, uint> & filtre_vertex,
+createCoEdges(TopoFilter<Vertex> & filtre_vertex,
         std::map<Vertex*, Vertex*> & corr_vertex,
         std::map<Vertex*, CoEdge*> & corr_vtx_coedge)
 {
@@ -670,12 +667,12 @@ createCoEdges(std::map<Vertex*, uint> & filtre_vertex,
 }
 /*----------------------------------------------------------------------------*/
 void CommandSplitFacesWithOgrid::
-createCoEdgeAndFace(std::map<Vertex*, uint> & filtre_vertex,
+createCoEdgeAndFace(TopoFilter<Vertex> & filtre_vertex,
         std::map<Vertex*, Vertex*>  & corr_vertex,
         std::map<Vertex*, CoEdge*> & corr_vtx_coedge,
-        std::map<CoEdge*, uint> & filtre_coedge,
-        std::map<CoFace*, uint> & filtre_coface,
-        std::map<Edge*,  uint> & filtre_edge,
+        TopoFilter<CoEdge> & filtre_coedge,
+        TopoFilter<CoFace> & filtre_coface,
+        TopoFilter<Edge> & filtre_edge,
         std::map<std::pair<Vertex*, Vertex*>, CoEdge*> & corr_2vtx_coedge,
         std::map<std::pair<Vertex*, Vertex*>, CoFace*> & corr_2vtx_coface)
 {
@@ -728,7 +725,7 @@ std::vector<Vertex*> CommandSplitFacesWithOgrid::
 getSelectedVertices(Vertex* vtx0,
         Vertex*vtx1,
         std::vector<CoEdge* > & coedges,
-        std::map<Vertex*, uint> & filtre_vertex)
+        TopoFilter<Vertex> & filtre_vertex)
 {
     // recherche des arêtes entre les 2 sommets
     std::vector<CoEdge* > coedges_between;
@@ -742,7 +739,7 @@ getSelectedVertices(Vertex* vtx0,
     // interne au bord, on ne prend que les sommets marqués
 
     Vertex* vtx_opp;
-    std::map<CoEdge*, uint> filtre_vu;
+    TopoFilter<CoEdge> filtre_vu;
     Vertex* vtx_prec = vtx0;
     // on se déplace suivant coedges_between, pour cela on marque à 1 ces arêtes puis à 2 lorsqu'on les a utlisé
     for (uint i=0; i<coedges_between.size(); i++)
@@ -788,8 +785,8 @@ createCoEdgeAndFace(Vertex* vtx0,
 		Edge* edge,
         std::map<Vertex*, Vertex*>  & corr_vertex,
         std::map<Vertex*, CoEdge*> & corr_vtx_coedge,
-        std::map<Vertex*, uint> & filtre_vertex,
-        std::map<CoEdge*, uint> & filtre_coedge,
+        TopoFilter<Vertex> & filtre_vertex,
+        TopoFilter<CoEdge> & filtre_coedge,
         std::vector<std::string> & groupsName,
         std::map<std::pair<Vertex*, Vertex*>, CoEdge*> & corr_2vtx_coedge,
         std::map<std::pair<Vertex*, Vertex*>, CoFace*> & corr_2vtx_coface)
@@ -923,7 +920,7 @@ Edge* CommandSplitFacesWithOgrid::
 createEdge(Vertex* vtx0,
         Vertex* vtx1,
         std::map<Vertex*, Vertex*>  & corr_vertex,
-        std::map<Vertex*, uint> & filtre_vertex,
+        TopoFilter<Vertex> & filtre_vertex,
         std::map<std::pair<Vertex*, Vertex*>, CoEdge*> & corr_2vtx_coedge)
 {
 #ifdef _DEBUG_SPLIT_OGRID
@@ -951,10 +948,10 @@ createEdge(Vertex* vtx0,
 }
 /*----------------------------------------------------------------------------*/
 void CommandSplitFacesWithOgrid::
-createCoFace(std::map<Vertex*, uint> & filtre_vertex,
+createCoFace(TopoFilter<Vertex> & filtre_vertex,
            std::map<Vertex*, Vertex*>  & corr_vertex,
            std::map<std::pair<Vertex*, Vertex*>, CoEdge*> & corr_2vtx_coedge,
-           std::map<CoFace*, uint> & filtre_coface,
+           TopoFilter<CoFace> & filtre_coface,
            std::map<CoFace*, CoFace*> & corr_coface)
 {
 #ifdef _DEBUG_SPLIT_OGRID
@@ -1000,9 +997,9 @@ createCoFace(std::map<Vertex*, uint> & filtre_vertex,
 }
 /*----------------------------------------------------------------------------*/
 void CommandSplitFacesWithOgrid::
-freeUnused(std::map<Vertex*, uint> & filtre_vertex,
-        std::map<CoEdge*, uint> & filtre_coedge,
-        std::map<CoFace*, uint> & filtre_coface,
+freeUnused(TopoFilter<Vertex> & filtre_vertex,
+        TopoFilter<CoEdge> & filtre_coedge,
+        TopoFilter<CoFace> & filtre_coface,
         std::map<Vertex*, CoEdge*> & corr_vtx_coedge,
         std::map<std::pair<Vertex*, Vertex*>, CoFace*> & corr_2vtx_coface,
         std::map<CoFace*, CoFace*> & corr_coface)
@@ -67,9 +67,8 @@ CommandTranslateTopo::
 void CommandTranslateTopo::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandTranslateTopo::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandTranslateTopo::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     // création de l'opérateur de translation via OCC
     gp_Trsf transf;
@@ -81,8 +80,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandTranslateTopo::getPreviewRepresentation(Utils::DisplayRepresentation& dr)
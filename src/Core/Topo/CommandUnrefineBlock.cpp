@@ -32,9 +32,8 @@ CommandUnrefineBlock::
 void CommandUnrefineBlock::
 internalExecute()
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "CommandUnrefineBlock::execute pour la commande " << getName ( )
-            << " de nom unique " << getUniqueName ( );
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_1, "CommandUnrefineBlock::execute pour la commande " << getName ( )
+            << " de nom unique " << getUniqueName ( ));
 
     if (!m_bloc->isStructured())
         throw TkUtil::Exception (TkUtil::UTF8String ("Le bloc doit être structuré pour être déraffiné avec cette méthode", TkUtil::Charset::UTF_8));
@@ -44,8 +43,6 @@ internalExecute()
 
     // on parcours les entités modifiées pour sauvegarder leur état d'avant la commande
     saveInternalsStats();
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_1));
 }
 /*----------------------------------------------------------------------------*/
 void CommandUnrefineBlock::getPreviewRepresentation(Utils::DisplayRepresentation& dr)
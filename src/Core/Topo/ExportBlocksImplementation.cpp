@@ -12,6 +12,9 @@
 #include "Topo/EdgeMeshingPropertyBeta.h"
 #include "Topo/EdgeMeshingPropertyBiexponential.h"
 
+#include <algorithm>
+#include <cstdlib>
+
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
@@ -22,380 +25,215 @@ ExportBlocksImplementation(Internal::Context& c, const std::string& n, const boo
 : m_context(c), m_filename(n), with_geom(with_geom)
 {}
 /*----------------------------------------------------------------------------*/
-/*----------------------------------------------------------------------------*/
 void ExportBlocksImplementation::perform(Internal::InfoCommand* icmd)
 {
-
-    std::ofstream str(m_filename, std::ios::out);
-    if (!str){
-        std::string s ="Impossible to create a Blocking File: "+m_filename;
-        throw TkUtil::Exception (TkUtil::UTF8String (s));
-    }
-
-    str << "# Mgx DataFile Version 1.0\n";
-    str << "Generated by Mgx Writer 2.6.3\n\n";
-    str << "ASCII\n";
-    
     Mgx3D::Topo::TopoManager& tm = m_context.getTopoManager();
 
     std::vector<Topo::Vertex*> vertices = tm.getVerticesObj();
-    writeNodes(str, vertices);
-
     std::vector<CoEdge*> edges = tm.getCoEdgesObj();
-    writeEdges(str, edges);
-
     std::vector<CoFace*> faces = tm.getCoFacesObj();
-    writeFaces(str, faces);
-
     std::vector<Block*> blocks = tm.getBlocksObj();
-    writeBlocks(str, blocks);
 
+    BlockingFileData data;
+    fillNodes(data, vertices);
+    fillEdges(data, edges);
+    // les faces sont numérotées avant l'écriture des discrétisations, qui
+    // peuvent y faire référence
+    fillFaces(data, faces);
+    fillDiscr(data, edges);
+    fillBlocks(data, blocks);
 
     if(with_geom){
-        writeAssociationNodes(str, vertices);
-        writeAssociationEdges(str, edges);
-        writeAssociationFaces(str, faces);
-        writeAssociationBlocks(str, blocks);
-
+        fillAssociation(data.m_assoc[0], vertices);
+        fillAssociation(data.m_assoc[1], edges);
+        fillAssociation(data.m_assoc[2], faces);
+        fillAssociation(data.m_assoc[3], blocks);
     }
 
-    str.close();
+    data.write(m_filename, with_geom);
 }
 /*----------------------------------------------------------------------------*/
-void ExportBlocksImplementation::writeNodes(std::ofstream &str, std::vector<Topo::Vertex*> vertices) {
-        str  << "POINTS " << vertices.size() << "\n";
-
-        auto blk_node_id = 0;
-        for(auto v : vertices){
-            Utils::Math::Point p = v->getCoord();
-            str << p.getX() <<  " " << p.getY() << " " << p.getZ() << "\n";
-            m_node_ids_mapping[v->getName()] = blk_node_id++;
-        }
-        str  <<"\n\n";
+void ExportBlocksImplementation::fillNodes(BlockingFileData& data, const std::vector<Topo::Vertex*>& vertices) {
+    data.m_points.reserve(3*vertices.size());
+    auto blk_node_id = 0;
+    for(auto v : vertices){
+        const Utils::Math::Point& p = v->getCoord();
+        data.m_points.push_back(p.getX());
+        data.m_points.push_back(p.getY());
+        data.m_points.push_back(p.getZ());
+        m_node_ids_mapping[v] = blk_node_id++;
+    }
 }
 /*----------------------------------------------------------------------------*/
-void ExportBlocksImplementation::writeEdges(std::ofstream &str, std::vector<Topo::CoEdge*> edges) {
-        str  << "EDGES " << edges.size() << "\n";
-
-        auto blk_edge_id = 0;
-        for(auto e : edges){
-            int n0 = m_node_ids_mapping[e->getVertices()[0]->getName()];
-            int n1 = m_node_ids_mapping[e->getVertices()[1]->getName()];
-            str << n0 <<  " " << n1 << "\n";
-            m_edge_ids_mapping[e->getName()] = blk_edge_id++;
-        }
-        str  << "Discr " << edges.size() << "\n";
-        for(auto e : edges){
-
-            CoEdgeMeshingProperty* prop = e->getMeshingProperty();
-            switch (prop->getMeshLaw()) {
-                case CoEdgeMeshingProperty::uniforme:
-                    str << 0 <<  " " << prop->getNbEdges() << "\n";
-                    break;
-                case CoEdgeMeshingProperty::geometrique:
-                    str << 1 <<  " " << prop->getNbEdges() << " ";
-                    str << dynamic_cast<EdgeMeshingPropertyGeometric*>(prop)->getRatio() << "\n";
-                    break;
-                case CoEdgeMeshingProperty::bigeometrique:
-                    str << 2 <<  " " << prop->getNbEdges() << " ";
-                    str << dynamic_cast<EdgeMeshingPropertyBigeometric*>(prop)->getRatio1() << " ";
-                    str << dynamic_cast<EdgeMeshingPropertyBigeometric*>(prop)->getLength1() << " ";
-                    str << dynamic_cast<EdgeMeshingPropertyBigeometric*>(prop)->getRatio2() << " ";
-                    str << dynamic_cast<EdgeMeshingPropertyBigeometric*>(prop)->getLength2() << "\n";
-                    break;
-                case CoEdgeMeshingProperty::hyperbolique:
-                    str << 3 <<  " " << prop->getNbEdges() << " ";
-                    str << dynamic_cast<EdgeMeshingPropertyHyperbolic*>(prop)->getLength1() << " ";
-                    str << dynamic_cast<EdgeMeshingPropertyHyperbolic*>(prop)->getLength2() << "\n";
-                    break;
-                case CoEdgeMeshingProperty::specific_size:
-                    str << 4 <<  " " << prop->getNbEdges() << " ";
-                    str << dynamic_cast<EdgeMeshingPropertySpecificSize*>(prop)->getEdgeSize() << "\n";
-                    break;
-                case CoEdgeMeshingProperty::interpolate:
-                    str << 5 <<  " " << prop->getNbEdges();
-                    if(!dynamic_cast<EdgeMeshingPropertyInterpolate*>(prop)->getCoEdges().empty()){
-                        str << " 0 [ ";
-                        for(auto e_name : dynamic_cast<EdgeMeshingPropertyInterpolate*>(prop)->getCoEdges()){
-                            str << m_edge_ids_mapping[e_name] << " ";
-                        }
-                    }else{
-                        str << " 1 [ " << m_face_ids_mapping[dynamic_cast<EdgeMeshingPropertyInterpolate*>(prop)->getCoFace()] << " ";
-                    }
-                    str << "] " << "\n";
-                    break;
-                case CoEdgeMeshingProperty::globalinterpolate:
-
-                    str << 6 <<  " " << prop->getNbEdges() << " [ ";
-                    for(auto e_name : dynamic_cast<EdgeMeshingPropertyGlobalInterpolate*>(prop)->getFirstCoEdges()){
-                        str << m_edge_ids_mapping[e_name] << " ";
-                    }
-                    str << "] [ ";
-                    for(auto e_name : dynamic_cast<EdgeMeshingPropertyGlobalInterpolate*>(prop)->getSecondCoEdges()){
-                        str << m_edge_ids_mapping[e_name] << " ";
-                    }
-                    str << "] " << "\n";
-                    break;
-                case CoEdgeMeshingProperty::tabulated:
-                    str << 7 <<  " " << prop->getNbEdges() << "\n";
-                    break;
-                case CoEdgeMeshingProperty::beta_resserrement:
-                    str << 8 <<  " " << prop->getNbEdges() << " ";
-                    str << dynamic_cast<EdgeMeshingPropertyBeta*>(prop)->getBeta() << "\n";
-                    break;
-                case CoEdgeMeshingProperty::biexponential:
-                    str << 9 <<  " " << prop->getNbEdges() << " ";
-                    if (dynamic_cast<EdgeMeshingPropertyBiexponential*>(prop)->getDirect())
-                    {
-                        str << dynamic_cast<EdgeMeshingPropertyBiexponential*>(prop)->getLength1() << " ";
-                        str << dynamic_cast<EdgeMeshingPropertyBiexponential*>(prop)->getLength2() << "\n";
-                    }
-                    else
-                    {
-                        str << dynamic_cast<EdgeMeshingPropertyBiexponential*>(prop)->getLength2() << " ";
-                        str << dynamic_cast<EdgeMeshingPropertyBiexponential*>(prop)->getLength1() << "\n";
-                    }
-                    break;
-                default:
-                    std::string s ="Arete avec une méthode de discrétisation inconnue";
-                    throw TkUtil::Exception(TkUtil::UTF8String (s));
-            }
-        }
-        str  <<"\n\n";
+void ExportBlocksImplementation::fillEdges(BlockingFileData& data, const std::vector<Topo::CoEdge*>& edges) {
+    data.m_edges.reserve(2*edges.size());
+    auto blk_edge_id = 0;
+    for(auto e : edges){
+        data.m_edges.push_back(m_node_ids_mapping.at(e->getVertices()[0]));
+        data.m_edges.push_back(m_node_ids_mapping.at(e->getVertices()[1]));
+        m_edge_names_mapping[e->getName()] = blk_edge_id;
+        m_edge_ids_mapping[e] = blk_edge_id++;
+    }
 }
 /*----------------------------------------------------------------------------*/
-void ExportBlocksImplementation::writeFaces(std::ofstream &str, std::vector<Topo::CoFace*> faces) {
-        str  << "FACES " << faces.size() << "\n";
-        auto blk_face_id = 0;
-        for(auto f : faces){
-
-
-            m_face_ids_mapping[f->getName()] = blk_face_id++;
-            const std::vector<Edge*> f_edges = f->getEdges();
-            Edge* e0 = f_edges[0];
-            Edge* e1 = f_edges[1];
-            Edge* e2 = f_edges[2];
-            Edge* e3 = f_edges[3];
-
-            str << "[ ";
-
-            if(f->getVertices()[0]->getName() == e0->getVertices()[0]->getName()) {
-                for (int i = 0; i < e0->getCoEdges().size(); i++)
-                    str << m_edge_ids_mapping[e0->getCoEdges()[i]->getName()]<<" ";
-            }else if(f->getVertices()[0]->getName() == e0->getVertices()[1]->getName()){
-                for (int i = e0->getCoEdges().size()-1; i >= 0 ; i--)
-                    str << m_edge_ids_mapping[e0->getCoEdges()[i]->getName()]<<" ";
+void ExportBlocksImplementation::fillDiscr(BlockingFileData& data, const std::vector<Topo::CoEdge*>& edges) {
+    data.m_discr_types.reserve(edges.size());
+    data.m_discr_nbs.reserve(edges.size());
+    data.m_discr_subtypes.reserve(edges.size());
+    data.m_discr_param_offsets.assign(1, 0);
+    data.m_discr_ref_offsets.assign(1, 0);
+
+    for(auto e : edges){
+
+        CoEdgeMeshingProperty* prop = e->getMeshingProperty();
+        std::vector<double>& params = data.m_discr_params;
+        std::vector<int>& refs = data.m_discr_refs;
+        int type = 0, subtype = 0;
+        switch (prop->getMeshLaw()) {
+            case CoEdgeMeshingProperty::uniforme:
+                type = 0;
+                break;
+            case CoEdgeMeshingProperty::geometrique:
+                type = 1;
+                params.push_back(dynamic_cast<EdgeMeshingPropertyGeometric*>(prop)->getRatio());
+                break;
+            case CoEdgeMeshingProperty::bigeometrique:
+            {
+                type = 2;
+                EdgeMeshingPropertyBigeometric* p = dynamic_cast<EdgeMeshingPropertyBigeometric*>(prop);
+                params.push_back(p->getRatio1());
+                params.push_back(p->getLength1());
+                params.push_back(p->getRatio2());
+                params.push_back(p->getLength2());
             }
-            str << "] [ ";
-
-            if(f->getVertices()[1]->getName() == e1->getVertices()[0]->getName()) {
-                for (int i = 0; i < e1->getCoEdges().size(); i++)
-                    str << m_edge_ids_mapping[e1->getCoEdges()[i]->getName()]<<" ";
-            }else if(f->getVertices()[1]->getName() == e1->getVertices()[1]->getName()){
-                for (int i = e1->getCoEdges().size()-1; i >= 0 ; i--)
-                    str << m_edge_ids_mapping[e1->getCoEdges()[i]->getName()]<<" ";
+                break;
+            case CoEdgeMeshingProperty::hyperbolique:
+                type = 3;
+                params.push_back(dynamic_cast<EdgeMeshingPropertyHyperbolic*>(prop)->getLength1());
+                params.push_back(dynamic_cast<EdgeMeshingPropertyHyperbolic*>(prop)->getLength2());
+                break;
+            case CoEdgeMeshingProperty::specific_size:
+                type = 4;
+                params.push_back(dynamic_cast<EdgeMeshingPropertySpecificSize*>(prop)->getEdgeSize());
+                break;
+            case CoEdgeMeshingProperty::interpolate:
+            {
+                type = 5;
+                EdgeMeshingPropertyInterpolate* p = dynamic_cast<EdgeMeshingPropertyInterpolate*>(prop);
+                if(!p->getCoEdges().empty()){
+                    for(const auto& e_name : p->getCoEdges())
+                        refs.push_back(m_edge_names_mapping.at(e_name));
+                }else{
+                    subtype = 1;
+                    refs.push_back(m_face_names_mapping.at(p->getCoFace()));
+                }
             }
-            str << "] [ ";
-
-            if(f->getVertices()[2]->getName() == e2->getVertices()[0]->getName()) {
-                for (int i = 0; i < e2->getCoEdges().size(); i++)
-                    str << m_edge_ids_mapping[e2->getCoEdges()[i]->getName()]<<" ";
-            }else if(f->getVertices()[2]->getName() == e2->getVertices()[1]->getName()){
-                for (int i = e2->getCoEdges().size()-1; i >= 0 ; i--)
-                    str << m_edge_ids_mapping[e2->getCoEdges()[i]->getName()]<<" ";
+                break;
+            case CoEdgeMeshingProperty::globalinterpolate:
+            {
+                type = 6;
+                EdgeMeshingPropertyGlobalInterpolate* p = dynamic_cast<EdgeMeshingPropertyGlobalInterpolate*>(prop);
+                subtype = p->getFirstCoEdges().size();
+                for(const auto& e_name : p->getFirstCoEdges())
+                    refs.push_back(m_edge_names_mapping.at(e_name));
+                for(const auto& e_name : p->getSecondCoEdges())
+                    refs.push_back(m_edge_names_mapping.at(e_name));
             }
-            str << "] [ ";
-
-            if(f->getVertices()[3]->getName() == e3->getVertices()[0]->getName()) {
-                for (int i = 0; i < e3->getCoEdges().size(); i++)
-                    str << m_edge_ids_mapping[e3->getCoEdges()[i]->getName()]<<" ";
-            }else if(f->getVertices()[3]->getName() == e3->getVertices()[1]->getName()){
-                for (int i = e3->getCoEdges().size()-1; i >= 0 ; i--)
-                    str << m_edge_ids_mapping[e3->getCoEdges()[i]->getName()]<<" ";
+                break;
+            case CoEdgeMeshingProperty::tabulated:
+                type = 7;
+                break;
+            case CoEdgeMeshingProperty::beta_resserrement:
+                type = 8;
+                params.push_back(dynamic_cast<EdgeMeshingPropertyBeta*>(prop)->getBeta());
+                break;
+            case CoEdgeMeshingProperty::biexponential:
+            {
+                type = 9;
+                EdgeMeshingPropertyBiexponential* p = dynamic_cast<EdgeMeshingPropertyBiexponential*>(prop);
+                if (p->getDirect())
+                {
+                    params.push_back(p->getLength1());
+                    params.push_back(p->getLength2());
+                }
+                else
+                {
+                    params.push_back(p->getLength2());
+                    params.push_back(p->getLength1());
+                }
             }
-            str << "]\n";
-        }
-        str << "\n";
-}
-/*----------------------------------------------------------------------------*/
-void ExportBlocksImplementation::writeBlocks(std::ofstream &str, std::vector<Topo::Block*> blocks) {
-        str  << "BLOCKS " << blocks.size() << "\n";
-        auto blk_block_id = 0;
-        for(auto b : blocks){
-            const std::vector<Vertex*>& vertices = b->getVertices();
-            int v0 = m_node_ids_mapping[vertices[0]->getName()];
-            int v1 = m_node_ids_mapping[vertices[1]->getName()];
-            int v2 = m_node_ids_mapping[vertices[2]->getName()];
-            int v3 = m_node_ids_mapping[vertices[3]->getName()];
-            int v4 = m_node_ids_mapping[vertices[4]->getName()];
-            int v5 = m_node_ids_mapping[vertices[5]->getName()];
-            int v6 = m_node_ids_mapping[vertices[6]->getName()];
-            int v7 = m_node_ids_mapping[vertices[7]->getName()];
-
-            const std::vector<Face*>& faces = b->getFaces();
-            Face* f0 = faces[0];
-            Face* f1 = faces[1];
-            Face* f2 = faces[2];
-            Face* f3 = faces[3];
-            Face* f4 = faces[4];
-            Face* f5 = faces[5];
-
-            str << v0 << " " << v1 << " " << v2 << " " << v3 << " " << v4 << " ";
-            str << v5 << " " << v6 << " " << v7 << " [ ";
-            for (int i = 0; i < f0->getCoFaces().size(); i++)
-                str << m_face_ids_mapping[f0->getCoFaces()[i]->getName()]<<" ";
-            str << "] [ ";
-            for (int i = 0; i < f1->getCoFaces().size(); i++)
-                str << m_face_ids_mapping[f1->getCoFaces()[i]->getName()]<<" ";
-            str << "] [ ";
-            for (int i = 0; i < f2->getCoFaces().size(); i++)
-                str << m_face_ids_mapping[f2->getCoFaces()[i]->getName()]<<" ";
-            str << "] [ ";
-            for (int i = 0; i < f3->getCoFaces().size(); i++)
-                str << m_face_ids_mapping[f3->getCoFaces()[i]->getName()]<<" ";
-            str << "] [ ";
-            for (int i = 0; i < f4->getCoFaces().size(); i++)
-                str << m_face_ids_mapping[f4->getCoFaces()[i]->getName()]<<" ";
-            str << "] [ ";
-            for (int i = 0; i < f5->getCoFaces().size(); i++)
-                str << m_face_ids_mapping[f5->getCoFaces()[i]->getName()]<<" ";
-            str << "]\n";
-
-            m_block_ids_mapping[b->getName()] = blk_block_id++;
-        }
-        str  << "\n";
-}
-/*----------------------------------------------------------------------------*/
-void ExportBlocksImplementation::writeAssociationNodes(std::ofstream &str,const std::vector<Topo::Vertex*>& vs){
-
-    int nb_infos = 0;
-    std::vector<std::string> infos;
-
-    for (auto te : vs) {
-        Geom::GeomEntity* ge = te->getGeomAssociation();
-        if(ge != nullptr){
-            std::string id = ge->getName();
-            int dim = ge->getDim();
-            if(dim == 2){
-                id.erase(0, 4);
-            }else if(dim == 0) {
-                id.erase(0, 2);
-            }else{
-                id.erase(0, 3);
-            }
-
-            while(id[0] == '0')
-                id.erase(0,1);
-
-            if(id.empty()){
-                id = "0";
-            }
-
-            nb_infos++;
-            infos.push_back(std::to_string(m_node_ids_mapping[te->getName()]) +" "+std::to_string(dim)+" "+id +"\n");
+                break;
+            default:
+                std::string s ="Arete avec une méthode de discrétisation inconnue";
+                throw TkUtil::Exception(TkUtil::UTF8String (s));
         }
+        data.m_discr_types.push_back(type);
+        data.m_discr_nbs.push_back(prop->getNbEdges());
+        data.m_discr_subtypes.push_back(subtype);
+        data.m_discr_param_offsets.push_back(params.size());
+        data.m_discr_ref_offsets.push_back(refs.size());
     }
-    str  << "GEOM_Nodes "<< nb_infos<<"\n";
-    for (const auto& info : infos) {
-        str << info;
-    }
-    str  << "\n";
 }
 /*----------------------------------------------------------------------------*/
-void ExportBlocksImplementation::writeAssociationEdges(std::ofstream &str,const std::vector<Topo::CoEdge*>& es){
-
-    int nb_infos = 0;
-    std::vector<std::string> infos;
-
-    for (auto te : es) {
-        Geom::GeomEntity* ge = te->getGeomAssociation();
-        if(ge != nullptr){
-            std::string id = ge->getName();
-            int dim = ge->getDim();
-            if(dim == 2){
-                id.erase(0, 4);
-            }else{
-                id.erase(0, 3);
+void ExportBlocksImplementation::fillFaces(BlockingFileData& data, const std::vector<Topo::CoFace*>& faces) {
+    data.m_face_offsets.assign(1, 0);
+    data.m_face_offsets.reserve(4*faces.size()+1);
+    auto blk_face_id = 0;
+    for(auto f : faces){
+        m_face_names_mapping[f->getName()] = blk_face_id;
+        m_face_ids_mapping[f] = blk_face_id++;
+
+        const std::vector<Edge*>& f_edges = f->getEdges();
+        const std::vector<Vertex*>& f_vertices = f->getVertices();
+        for (int j = 0; j < 4; j++) {
+            // les arêtes communes sont écrites en partant du sommet j de la face
+            Edge* ej = f_edges[j];
+            const std::vector<CoEdge*>& coedges = ej->getCoEdges();
+            if(f_vertices[j] == ej->getVertices()[0]) {
+                for (size_t i = 0; i < coedges.size(); i++)
+                    data.m_face_edges.push_back(m_edge_ids_mapping.at(coedges[i]));
+            }else if(f_vertices[j] == ej->getVertices()[1]){
+                for (size_t i = coedges.size(); i-- > 0; )
+                    data.m_face_edges.push_back(m_edge_ids_mapping.at(coedges[i]));
             }
-
-            while(id[0] == '0')
-                id.erase(0,1);
-
-            if(id.empty()){
-                id = "0";
-            }
-
-            nb_infos++;
-            infos.push_back(std::to_string(m_edge_ids_mapping[te->getName()]) +" "+std::to_string(dim)+" "+id +"\n");
+            data.m_face_offsets.push_back(data.m_face_edges.size());
         }
     }
-    str  << "GEOM_Edges "<< nb_infos<<"\n";
-    for (const auto& info : infos) {
-        str << info;
-    }
-    str  << "\n";
 }
 /*----------------------------------------------------------------------------*/
-void ExportBlocksImplementation::writeAssociationFaces(std::ofstream &str,const std::vector<Topo::CoFace*>& fs){
-
-    int nb_infos = 0;
-    std::vector<std::string> infos;
-
-    for (auto te : fs) {
-        Geom::GeomEntity* ge = te->getGeomAssociation();
-        if(ge != nullptr){
-            std::string id = ge->getName();
-            int dim = ge->getDim();
-            if(dim == 2){
-                id.erase(0, 4);
-            }else{
-                id.erase(0, 3);
-            }
-
-            while(id[0] == '0')
-                id.erase(0,1);
-
-            if(id.empty()){
-                id = "0";
-            }
-
-            nb_infos++;
-            infos.push_back(std::to_string(m_face_ids_mapping[te->getName()]) +" "+std::to_string(dim)+" "+id +"\n");
+void ExportBlocksImplementation::fillBlocks(BlockingFileData& data, const std::vector<Topo::Block*>& blocks) {
+    data.m_block_nodes.reserve(8*blocks.size());
+    data.m_block_offsets.assign(1, 0);
+    data.m_block_offsets.reserve(6*blocks.size()+1);
+    for(auto b : blocks){
+        const std::vector<Vertex*>& vertices = b->getVertices();
+        for (int j = 0; j < 8; j++)
+            data.m_block_nodes.push_back(m_node_ids_mapping.at(vertices[j]));
+
+        const std::vector<Face*>& faces = b->getFaces();
+        for (int j = 0; j < 6; j++) {
+            for (auto cf : faces[j]->getCoFaces())
+                data.m_block_faces.push_back(m_face_ids_mapping.at(cf));
+            data.m_block_offsets.push_back(data.m_block_faces.size());
         }
     }
-    str  << "GEOM_Faces "<< nb_infos<<"\n";
-    for (const auto& info : infos) {
-        str << info;
-    }
-    str  << "\n";
 }
 /*----------------------------------------------------------------------------*/
-void ExportBlocksImplementation::writeAssociationBlocks(std::ofstream &str,const std::vector<Topo::Block*>& bs){
+template <typename T>
+void ExportBlocksImplementation::fillAssociation(std::vector<int>& assoc, const std::vector<T*>& entities){
+    // longueur des préfixes des noms des entités géométriques (Pt, Crb, Surf, Vol)
+    static const size_t prefix_length[4] = {2, 3, 4, 3};
 
-    int nb_infos = 0;
-    std::vector<std::string> infos;
-
-    for (auto te : bs) {
-        Geom::GeomEntity* ge = te->getGeomAssociation();
+    for (size_t i = 0; i < entities.size(); i++) {
+        Geom::GeomEntity* ge = entities[i]->getGeomAssociation();
         if(ge != nullptr){
-            std::string id = ge->getName();
-            id.erase(0, 3);
-
-            while(id[0] == '0')
-                id.erase(0,1);
-
-            if(id.empty()){
-                id = "0";
-            }
-
-            nb_infos++;
-            infos.push_back(std::to_string(m_block_ids_mapping[te->getName()]) +" 3 "+id +"\n");
+            const int dim = ge->getDim();
+            const std::string& name = ge->getName();
+            assoc.push_back(i);
+            assoc.push_back(dim);
+            assoc.push_back(std::atoi(name.c_str() + std::min(prefix_length[dim], name.size())));
         }
     }
-    str  << "GEOM_Blocks "<< nb_infos<<"\n";
-    for (const auto& info : infos) {
-        str << info;
-    }
 }
 /*----------------------------------------------------------------------------*/
 } // end namespace Geom
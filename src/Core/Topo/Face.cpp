@@ -1079,7 +1079,7 @@ free(Internal::InfoCommand* icmd)
 
     // on retire la relation avec la géométrie
     if (icmd && getGeomAssociation()
-             && icmd->getTopoInfoEntity()[this] != Internal::InfoCommand::NONE){
+             && icmd->getTopoInfoEntityType(this) != Internal::InfoCommand::NONE){
         saveTopoProperty();
         setGeomAssociation(0);
     }
@@ -20,6 +20,9 @@ TopoEntity::TopoEntity(Internal::Context& ctx,
 : Internal::InternalEntity (ctx, prop, disp)
 , m_topo_property(new TopoProperty())
 , m_save_topo_property(0)
+, m_marks()
+, m_info_command_stamp(0)
+, m_info_command_index(0)
 {
 #ifdef _DEBUG_MEMORY
     std::cout<<"TopoEntity::TopoEntity() de nom "<<getName()<<std::endl;
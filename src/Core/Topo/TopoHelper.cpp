@@ -1,6 +1,9 @@
 /*----------------------------------------------------------------------------*/
+#include <cmath>
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 /*----------------------------------------------------------------------------*/
 #include "Internal/Context.h"
@@ -10,6 +13,8 @@
 #include "Topo/CoFace.h"
 #include "Topo/Vertex.h"
 #include "Topo/TopoHelper.h"
+#include "Topo/TopoManager.h"
+#include "Topo/ChordIndex.h"
 #include "Topo/EdgeMeshingPropertyUniform.h"
 #include "Topo/EdgeMeshingPropertyTabulated.h"
 #include "Geom/Volume.h"
@@ -2352,12 +2357,172 @@ void TopoHelper::splitFaces3D(std::vector<CoFace* > cofaces,
 
 }
 /*----------------------------------------------------------------------------*/
-void TopoHelper::getMarqued(std::map<CoEdge*, uint> filtre, const uint marque, std::vector<CoEdge*>& out)
+/// position du sommet de la coupe sur un côté de face commune (cf computeSplitPreview)
+static Utils::Math::Point getSplitPreviewPoint(CoEdge* coedge, uint ind,
+        Vertex* vtx1, Vertex* vtx2, uint ind_cote, uint nb_cote,
+        double ratio_dec, bool project_on_meshing_edges,
+        std::unordered_map<CoEdge*, std::vector<Utils::Math::Point> >& coedge_points)
+{
+    const std::vector<Vertex*>& vertices = coedge->getVertices();
+    if (ind == 0)
+        return vertices[0]->getCoord();
+    if (ind == coedge->getNbMeshingEdges())
+        return vertices[1]->getCoord();
+
+    if (!project_on_meshing_edges){
+        // comme pour CommandSplitFaces, le sommet est placé suivant le ratio
+        // depuis l'extrémité du côté la plus proche en nombre de bras
+        double ratio_nodes = (double)ind_cote/(double)nb_cote;
+        double ratio = (std::abs(ratio_nodes-ratio_dec) <= std::abs(ratio_nodes-(1.0-ratio_dec))
+                ? ratio_dec : 1.0-ratio_dec);
+        Geom::Curve* curve = dynamic_cast<Geom::Curve*>(coedge->getGeomAssociation());
+        if (curve){
+            std::vector<Utils::Math::Point> points;
+            curve->getParametricsPoints(vtx1->getCoord(), vtx2->getCoord(), 1, &ratio, points);
+            return points[0];
+        }
+        return vtx1->getCoord() + (vtx2->getCoord() - vtx1->getCoord()) * ratio;
+    }
+
+    // utilisation des points placés suivant la projection et la discrétisation, comme CoEdge::split
+    std::unordered_map<CoEdge*, std::vector<Utils::Math::Point> >::iterator iter = coedge_points.find(coedge);
+    if (iter == coedge_points.end()){
+        iter = coedge_points.insert(std::make_pair(coedge, std::vector<Utils::Math::Point>())).first;
+        try {
+            coedge->getPoints(iter->second);
+        }
+        catch (TkUtil::Exception& exc){
+            // cas d'une arête en dehors de la surface
+            iter->second.clear();
+        }
+    }
+    if (ind < iter->second.size())
+        return iter->second[ind];
+
+    double ratio = ((double)ind) / ((double)coedge->getNbMeshingEdges());
+    return vertices[0]->getCoord() + (vertices[1]->getCoord() - vertices[0]->getCoord()) * ratio;
+}
+/*----------------------------------------------------------------------------*/
+bool TopoHelper::computeSplitPreview(const std::vector<CoFace* >& cofaces,
+        CoEdge* arete, double ratio_dec, bool project_on_meshing_edges,
+        std::vector<Utils::Math::Point>& points,
+        std::vector<size_t>& indices,
+        const std::atomic<bool>& cancel)
+{
+    CHECK_NULL_PTR_ERROR(arete);
+    points.clear();
+    indices.clear();
+
+    // les CoFaces autorisées et celles déjà coupées
+    std::unordered_set<CoFace*> filtre_cofaces(cofaces.begin(), cofaces.end());
+    std::unordered_set<CoFace*> cofaces_vues;
+
+    // les points de la discrétisation des arêtes déjà utilisées
+    std::unordered_map<CoEdge*, std::vector<Utils::Math::Point> > coedge_points;
+
+    // les arêtes coupées avec l'indice du noeud de la coupe depuis leur premier sommet
+    std::vector<std::pair<CoEdge*, uint> > coupes;
+    std::set<std::pair<CoEdge*, uint> > filtre_coupes;
+
+    // même nombre de bras que splitFaces2D
+    coupes.push_back(std::make_pair(arete, (uint)((double)arete->getNbMeshingEdges()*ratio_dec+0.5)));
+    filtre_coupes.insert(coupes.back());
+
+    for (uint k=0; k<coupes.size(); k++){
+        if (cancel)
+            return false;
+
+        CoEdge* coedge_dep = coupes[k].first;
+        uint ind_dep = coupes[k].second;
+
+        for (CoFace* coface : coedge_dep->getCoFaces()){
+            if (filtre_cofaces.find(coface) == filtre_cofaces.end()
+                    || !coface->isStructured()
+                    || !cofaces_vues.insert(coface).second)
+                continue;
+
+            const std::vector<Edge* >& edges = coface->getEdges();
+            Edge* edge_dep = coface->getEdgeContaining(coedge_dep);
+            if (0 == edge_dep)
+                continue;
+            uint cote_dep = Utils::getIndexOf(edge_dep, edges);
+
+            // on ne traverse pas une face depuis son côté dégénéré
+            if (edges.size() < 3 || (edges.size() == 3 && cote_dep == 1))
+                continue;
+            uint cote_opp = (cote_dep+2)%4;
+            Edge* edge_opp = edges[cote_opp];
+
+            // sommets de la face avec le dernier dupliqué pour le cas dégénéré
+            std::vector<Vertex*> vertices = coface->getVertices();
+            if (vertices.size() == 3)
+                vertices.push_back(vertices[0]);
+
+            // indice du noeud de la coupe sur le côté de départ
+            Vertex* vtx1_dep = vertices[cote_dep];
+            Vertex* vtx2_dep = vertices[(cote_dep+1)%4];
+            std::vector<CoEdge*> coedges_dep;
+            getCoEdgesBetweenVertices(vtx1_dep, vtx2_dep, edge_dep->getCoEdges(), coedges_dep);
+
+            uint ind_cote = 0;
+            Vertex* vtxI = vtx1_dep;
+            uint i = 0;
+            for (; i<coedges_dep.size() && coedges_dep[i] != coedge_dep; i++){
+                ind_cote += coedges_dep[i]->getNbMeshingEdges();
+                vtxI = coedges_dep[i]->getOppositeVertex(vtxI);
+            }
+            if (i == coedges_dep.size())
+                continue;
+            ind_cote += (coedge_dep->getVertices()[0] == vtxI ?
+                    ind_dep : coedge_dep->getNbMeshingEdges() - ind_dep);
+
+            // recherche du noeud de même indice sur le côté opposé
+            Vertex* vtx1_opp = vertices[(cote_dep+3)%4];
+            Vertex* vtx2_opp = vertices[(cote_dep+2)%4];
+            std::vector<CoEdge*> coedges_opp;
+            getCoEdgesBetweenVertices(vtx1_opp, vtx2_opp, edge_opp->getCoEdges(), coedges_opp);
+
+            CoEdge* coedge_opp = 0;
+            uint ind_opp = 0;
+            uint ind_deb = 0;
+            vtxI = vtx1_opp;
+            for (CoEdge* coedge : coedges_opp){
+                uint nb = coedge->getNbMeshingEdges();
+                if (ind_cote >= ind_deb && ind_cote <= ind_deb+nb){
+                    uint ind = (coedge->getVertices()[0] == vtxI ?
+                            ind_cote-ind_deb : ind_deb+nb-ind_cote);
+                    if (0 == coedge_opp){
+                        coedge_opp = coedge;
+                        ind_opp = ind;
+                    }
+                    // la coupe se poursuit au delà de toutes les arêtes qui contiennent le noeud
+                    if (filtre_coupes.insert(std::make_pair(coedge, ind)).second)
+                        coupes.push_back(std::make_pair(coedge, ind));
+                }
+                ind_deb += nb;
+                vtxI = coedge->getOppositeVertex(vtxI);
+            }
+            if (0 == coedge_opp)
+                continue;
+
+            indices.push_back(points.size());
+            points.push_back(getSplitPreviewPoint(coedge_dep, ind_dep, vtx1_dep, vtx2_dep,
+                    ind_cote, edge_dep->getNbMeshingEdges(), ratio_dec, project_on_meshing_edges, coedge_points));
+            indices.push_back(points.size());
+            points.push_back(getSplitPreviewPoint(coedge_opp, ind_opp, vtx1_opp, vtx2_opp,
+                    ind_cote, edge_opp->getNbMeshingEdges(), ratio_dec, project_on_meshing_edges, coedge_points));
+        } // end for coface
+    } // end for k
+
+    return true;
+}
+/*----------------------------------------------------------------------------*/
+void TopoHelper::getMarqued(TopoFilter<CoEdge>& filtre, const uint marque, std::vector<CoEdge*>& out)
 {
     out.clear();
 
     std::list<CoEdge*> liste;
-    for (std::map<CoEdge*, uint>::iterator iter = filtre.begin(); iter != filtre.end(); ++iter)
+    for (TopoFilter<CoEdge>::iterator iter = filtre.begin(); iter != filtre.end(); ++iter)
         if (marque == (*iter).second)
             liste.push_back((*iter).first);
 
@@ -2366,12 +2531,12 @@ void TopoHelper::getMarqued(std::map<CoEdge*, uint> filtre, const uint marque, s
     out.insert(out.end(), liste.begin(), liste.end());
 }
 /*----------------------------------------------------------------------------*/
-void TopoHelper::getMarqued(std::map<CoFace*, uint> filtre, std::vector<CoFace*>& out)
+void TopoHelper::getMarqued(TopoFilter<CoFace>& filtre, std::vector<CoFace*>& out)
 {
     out.clear();
 
     std::list<CoFace*> liste;
-    for (std::map<CoFace*, uint>::iterator iter = filtre.begin(); iter != filtre.end(); ++iter)
+    for (TopoFilter<CoFace>::iterator iter = filtre.begin(); iter != filtre.end(); ++iter)
         if ((*iter).second)
             liste.push_back((*iter).first);
 
@@ -3130,14 +3295,11 @@ std::vector<TopoEntity*> TopoHelper::getSheet(Topo::TopoEntity* entityStart, dou
     if(entityStart->getDim() == 1) {	//Edge
         CoEdge *convertStartEdge = dynamic_cast<CoEdge *>(entityStart);
 
-		std::map<CoEdge*, bool> parallel_coedges = parallelEdges(convertStartEdge);
+		std::vector<CoEdge*> coedges;
+		std::vector<bool> inverted;
+		convertStartEdge->getContext().getTopoManager().getChordIndex().getChord(convertStartEdge, coedges, inverted);
 
-        for (std::map<CoEdge *, bool>::iterator iter = parallel_coedges.begin();
-             iter != parallel_coedges.end(); ++iter) {
-            CoEdge *coedge = (*iter).first;
-
-			entitiesResult.push_back(coedge);
-        }
+        entitiesResult.insert(entitiesResult.end(), coedges.begin(), coedges.end());
     }
 	else if(entityStart->getDim() == 3){	//Block
 		double x = point[0];
@@ -3153,7 +3315,7 @@ std::vector<TopoEntity*> TopoHelper::getSheet(Topo::TopoEntity* entityStart, dou
 		std::vector<CoEdge*> b_coedges = convertStartBlock->getCoEdges();
 
 		// Naive algorithm, get the nearest edge center
-		CoEdge* startingEdge;
+		CoEdge* startingEdge = 0;
 		double distance = MAXFLOAT;
 		for (auto e : b_coedges) {
 			double centerX = (e->getVertices()[0]->getX()+e->getVertices()[1]->getX())/2;
@@ -3169,22 +3331,11 @@ std::vector<TopoEntity*> TopoHelper::getSheet(Topo::TopoEntity* entityStart, dou
 			}
 		}
 
-		std::map<CoEdge*, bool> parallel_coedges = parallelEdges(startingEdge);
-
-		std::set<Topo::Block *> blocks; //To avoid duplicate blocks in list
-
-		for (std::map<CoEdge *, bool>::iterator iter = parallel_coedges.begin();
-			 iter != parallel_coedges.end(); ++iter) {
-			CoEdge *coedge = (*iter).first;
-
-			std::vector<Topo::Block *> edge_blocks = coedge->getBlocks();
-			for (auto b: edge_blocks) {
-				blocks.insert(b);
-			}
-		}
-
-		for (auto b: blocks) {
-			entitiesResult.push_back(b);
+		if (startingEdge){
+			// les blocs traversés par la corde de l'arête
+			std::vector<Block*> blocks;
+			startingEdge->getContext().getTopoManager().getChordIndex().getSheet(startingEdge, blocks);
+			entitiesResult.insert(entitiesResult.end(), blocks.begin(), blocks.end());
 		}
 	}
 	return entitiesResult;
@@ -3204,7 +3355,7 @@ std::vector<TopoEntity *> TopoHelper::getChord(Topo::TopoEntity * entityStart, d
 
 		std::vector<CoFace*> b_cofaces = convertStartBlock->getCoFaces();
 
-		CoFace* startingFace;
+		CoFace* startingFace = 0;
 		double distance = MAXFLOAT;
 		for (auto f : b_cofaces) {
             Vertex* v0 = f->getVertices()[0];
@@ -3224,62 +3375,12 @@ std::vector<TopoEntity *> TopoHelper::getChord(Topo::TopoEntity * entityStart, d
 			}
 		}
 
-		// filtre sur les coedges pour éviter de boucler indéfiniement
-		std::set<CoFace *> filtre_coface;
-		std::vector<CoFace*> cofaces_in;
-		std::vector<CoFace*> parallel_cofaces;
-
 		if (startingFace) {
-			cofaces_in.push_back(startingFace);
-			parallel_cofaces.push_back(startingFace);
-			filtre_coface.insert(startingFace);
-		}
-		while (!cofaces_in.empty()) {
-			CoFace *coface_dep = cofaces_in.back();
-			cofaces_in.pop_back();
-
-			// boucle sur les cofaces autour
-			std::vector<Block *> blocks = coface_dep->getBlocks();
-			for (uint i = 0; i < blocks.size(); i++) {
-				Block *block = blocks[i];
-
-				std::vector<CoFace*> block_cofaces = block->getCoFaces();
-				CoFace *coface_vois;
-
-				//Ici on veut trouver la face opposee
-				if(block_cofaces.size() == 6){
-
-					std::vector<CoEdge*> cf_coedges = coface_dep->getCoEdges();
-					for(auto f : block_cofaces){
-						int cpt_e = 0;
-						for (auto cfv_e : f->getCoEdges()) {
-							if(std::find(cf_coedges.begin(), cf_coedges.end(), cfv_e) != cf_coedges.end())
-								cpt_e++;
-						}
-						if (cpt_e == 0){
-							coface_vois = f;
-						}
-					}
-
-					if (coface_vois && filtre_coface.find(coface_vois) == filtre_coface.end()) {
-						cofaces_in.push_back(coface_vois);
-						parallel_cofaces.push_back(coface_vois);
-						// pour ne pas la reprendre
-						filtre_coface.insert(coface_vois);
-					}
-				}
-			} // end for i
-		} // end while
-
-		std::set<Block*> blocks;
-		for (auto f : parallel_cofaces) {
-			for (Topo::Block* b : f->getBlocks()) {
-				blocks.insert(b);
-			}
-		}
-
-		for (auto b: blocks) {
-			entitiesResult.push_back(b);
+			// les blocs de la colonne de faces opposées
+			std::vector<CoFace*> cofaces;
+			std::vector<Block*> blocks;
+			startingFace->getContext().getTopoManager().getChordIndex().getColumn(startingFace, cofaces, blocks);
+			entitiesResult.insert(entitiesResult.end(), blocks.begin(), blocks.end());
 		}
 	}
 	return entitiesResult;
@@ -3287,47 +3388,16 @@ std::vector<TopoEntity *> TopoHelper::getChord(Topo::TopoEntity * entityStart, d
 /*----------------------------------------------------------------------------*/
 std::map<CoEdge*, bool> TopoHelper::parallelEdges(Topo::CoEdge* edgeStart)
 {
-	// stockage des arêtes en cours de traitement
-	std::vector<CoEdge *> coedges_in;
-
 	// stockage des arêtes parallèles et du sens / discrétisation à cloner
 	std::map<CoEdge *, bool> parallel_coedges;
 
-	// filtre sur les coedges pour éviter de boucler indéfiniement
-	std::set<CoEdge *> filtre_coedge;
-
-	// on initialise avec celle passée en paramètre
 	if (edgeStart) {
-		coedges_in.push_back(edgeStart);
-		parallel_coedges[edgeStart] = false;
-		filtre_coedge.insert(edgeStart);
+		std::vector<CoEdge*> coedges;
+		std::vector<bool> inverted;
+		edgeStart->getContext().getTopoManager().getChordIndex().getChord(edgeStart, coedges, inverted);
+		for (uint i = 0; i < coedges.size(); i++)
+			parallel_coedges[coedges[i]] = inverted[i];
 	}
-
-	// boucle tant que l'on a des arêtes non traitées
-	while (!coedges_in.empty()) {
-
-		CoEdge *coedge_dep = coedges_in.back();
-		coedges_in.pop_back();
-
-		// boucle sur les cofaces autour
-		std::vector<CoFace *> cofaces = coedge_dep->getCoFaces();
-		for (uint i = 0; i < cofaces.size(); i++) {
-			CoFace *coface = cofaces[i];
-
-			bool inverse_sens;
-			CoEdge *coedge_vois = coface->getOppositeCoEdge(coedge_dep, inverse_sens);
-
-			if (coedge_vois && filtre_coedge.find(coedge_vois) == filtre_coedge.end()) {
-				coedges_in.push_back(coedge_vois);
-				if (parallel_coedges[coedge_dep])
-					parallel_coedges[coedge_vois] = inverse_sens;
-				else
-					parallel_coedges[coedge_vois] = !inverse_sens;
-				// pour ne pas la reprendre
-				filtre_coedge.insert(coedge_vois);
-			}
-		} // end for i
-	} // end while
 	return parallel_coedges;
 }
 /*----------------------------------------------------------------------------*/
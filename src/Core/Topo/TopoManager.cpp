@@ -1,5 +1,6 @@
 /*----------------------------------------------------------------------------*/
 #include "Internal/Context.h"
+#include "Utils/Common.h"
 #include "Internal/CommandComposite.h"
 #include "Internal/ImportMDLImplementation.h"
 #include "Internal/NameManager.h"
@@ -14,6 +15,7 @@
 #include "Utils/MgxException.h"
 #include "Topo/TopoManager.h"
 #include "Topo/TopoHelper.h"
+#include "Topo/ChordIndex.h"
 #include "Topo/CommandNewTopoOnGeometry.h"
 #include "Topo/CommandFuse2Vertices.h"
 #include "Topo/CommandGlue2Blocks.h"
@@ -70,6 +72,7 @@
 #include "Topo/CoEdge.h"
 #include "Topo/Vertex.h"
 #include "Topo/CommandNewTopo.h"
+#include "Topo/TopoPreviewTask.h"
 #include "Geom/GeomManager.h"
 #include "Geom/GeomEntity.h"
 #include "Geom/CommandNewBox.h"
@@ -109,6 +112,7 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <unordered_map>
 #include <algorithm>
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
@@ -118,6 +122,7 @@ namespace Topo {
 TopoManager::TopoManager(const std::string& name, Internal::Context* c)
 : Internal::CommandCreator(name, c)
 , m_defaultNbMeshingEdges(10)
+, m_chord_index(new ChordIndex())
 {
 #ifdef _DEBUG_TIMER
 	_cpuDuration = 0;
@@ -136,6 +141,7 @@ TopoManager::~TopoManager()
 #endif
 
     clear();
+    delete m_chord_index;
 
 #ifdef _DEBUG_TIMER
     std::cout<<"Temps cpu pour recherche des noms dans TopoManager : "
@@ -154,6 +160,7 @@ void TopoManager::clear()
     Utils::deleteAndClear(m_vertices);
     m_geom_associations.clear();
     m_defaultNbMeshingEdges = 10;
+    m_chord_index->topologyModified();
 }
 /*----------------------------------------------------------------------------*/
 std::vector<std::string> TopoManager::getBlocks() const
@@ -298,12 +305,15 @@ Block* TopoManager::getBlock (const std::string& name, const bool exceptionIfNot
 std::string TopoManager::getLastBlock()
 {
 #ifdef _DEBUG
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::getLastBlock ()\n";
-    message << "m_blocks de taille:" << m_blocks.size() << "\n";
-   for (uint i=0; i<m_blocks.size(); i++)
-        message << " bloc "<<m_blocks[i]->getName()<<(m_blocks[i]->isDestroyed()?" détruit":" non détruit")<<"\n";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+	if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+	{
+		TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
+	    message << "TopoManager::getLastBlock ()\n";
+	    message << "m_blocks de taille:" << m_blocks.size() << "\n";
+	   for (uint i=0; i<m_blocks.size(); i++)
+	        message << " bloc "<<m_blocks[i]->getName()<<(m_blocks[i]->isDestroyed()?" détruit":" non détruit")<<"\n";
+	    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+	}
 #endif
 
     std::string nom("");
@@ -522,9 +532,7 @@ TopoManager::newTopoEntity(std::vector<std::string>& ve, int dim, std::string gr
 Mgx3D::Internal::M3DCommandResult*
 TopoManager::newTopoEntity(std::vector<Topo::Vertex*>& vertices, int dim, std::string groupName, bool enableDuplicateCoEdges)
 {
-    TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::newTopoEntity("<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::newTopoEntity("<<")");
 
     Topo::CommandNewTopo* command = new Topo::CommandNewTopo(getContext(), vertices,
                                                              CommandNewTopo::STRUCTURED_BLOCK, dim, groupName,
@@ -574,9 +582,7 @@ Mgx3D::Internal::M3DCommandResult*
 TopoManager::newCoFace(const std::vector<Topo::Edge*>& edges, std::vector<Topo::Vertex* > &vertices,
         bool isStructured, bool hasHole)
 {
-    TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::newTopoEntity("<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::newTopoEntity("<<")");
 
     Topo::CommandNewTopo* command = new Topo::CommandNewTopo(getContext(), edges, vertices, isStructured, hasHole);
 
@@ -619,9 +625,7 @@ TopoManager::newBlock(const std::vector<std::string>& faces, const std::vector<s
 Mgx3D::Internal::M3DCommandResult*
 TopoManager::newBlock(const std::vector<Topo::Face* > &faces, const std::vector<Topo::Vertex* > &vertices, bool isStructured, std::string groupName)
 {
-    TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::newBlock("<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::newBlock("<<")");
 
     Topo::CommandNewTopo* command = new Topo::CommandNewTopo(getContext(), faces, vertices, isStructured, groupName);
     TkUtil::UTF8String	cmd (TkUtil::Charset::UTF_8);
@@ -670,9 +674,7 @@ TopoManager::newFace(const std::vector<std::string>& cofaces, const std::vector<
 Mgx3D::Internal::M3DCommandResult*
 TopoManager::newFace(const std::vector<Topo::CoFace* > &cofaces, const std::vector<Topo::Vertex* > &vertices, bool isStructured)
 {
-    TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::newFace("<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::newFace("<<")");
 
     Topo::CommandNewTopo* command = new Topo::CommandNewTopo(getContext(), cofaces, vertices, isStructured);
     TkUtil::UTF8String	cmd (TkUtil::Charset::UTF_8);
@@ -718,9 +720,7 @@ TopoManager::newEdge(const std::string v1, const std::string v2, const std::vect
 Mgx3D::Internal::M3DCommandResult*
 TopoManager::newEdge(Topo::Vertex* v1, Topo::Vertex* v2, const std::vector<Topo::CoEdge* > &coedges)
 {
-    TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::newEdge("<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::newEdge("<<")");
 
     const std::vector<Topo::Vertex* > &vertices = {v1, v2};
 
@@ -753,9 +753,7 @@ TopoManager::newTopoOnGeometry(std::string ne)
 Mgx3D::Internal::M3DCommandResult*
 TopoManager::newTopoOnGeometry(Geom::GeomEntity* ge)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::newTopoOnGeometry("<<ge->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::newTopoOnGeometry("<<ge->getName()<<")");
 
     Topo::CommandNewTopoOnGeometry* command = new Topo::CommandNewTopoOnGeometry(getContext(), ge,
     		CommandNewTopoOnGeometry::ASSOCIATED_TOPO);
@@ -784,9 +782,7 @@ TopoManager::newStructuredTopoOnGeometry(std::string ne)
 Mgx3D::Internal::M3DCommandResult*
 TopoManager::newStructuredTopoOnGeometry(Geom::GeomEntity* ge)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::newStructuredTopoOnGeometry("<<(ge?ge->getName():"\"\"")<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::newStructuredTopoOnGeometry("<<(ge?ge->getName():"\"\"")<<")");
 
     Topo::CommandNewTopoOnGeometry* command = new Topo::CommandNewTopoOnGeometry(getContext(), ge,
     		CommandNewTopoOnGeometry::STRUCTURED_BLOCK);
@@ -848,9 +844,7 @@ TopoManager::newUnstructuredTopoOnGeometry(std::string ne)
 Mgx3D::Internal::M3DCommandResult*
 TopoManager::newUnstructuredTopoOnGeometry(Geom::GeomEntity* ge)
 {
-	TkUtil::UTF8String	message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::newUnstructuredTopoOnGeometry("<<ge->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+	MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::newUnstructuredTopoOnGeometry("<<ge->getName()<<")");
 
     Topo::CommandNewTopoOnGeometry* command = new Topo::CommandNewTopoOnGeometry(getContext(), ge,
     		CommandNewTopoOnGeometry::UNSTRUCTURED_BLOCK);
@@ -879,9 +873,7 @@ TopoManager::newFreeTopoOnGeometry(std::string ne)
 Mgx3D::Internal::M3DCommandResult*
 TopoManager::newFreeTopoOnGeometry(Geom::GeomEntity* ge)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::newFreeTopoOnGeometry("<<(ge?ge->getName():"\"\"")<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::newFreeTopoOnGeometry("<<(ge?ge->getName():"\"\"")<<")");
 
     Topo::CommandNewTopoOnGeometry* command = new Topo::CommandNewTopoOnGeometry(getContext(), ge,
     		CommandNewTopoOnGeometry::FREE_BLOCK);
@@ -901,9 +893,7 @@ TopoManager::newFreeTopoOnGeometry(Geom::GeomEntity* ge)
 Mgx3D::Internal::M3DCommandResult*
 TopoManager::newFreeTopoInGroup(std::string ng, int dim)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::newFreeTopoInGroup("<<ng<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::newFreeTopoInGroup("<<ng<<")");
 
     Topo::CommandNewTopoOnGeometry* command = new Topo::CommandNewTopoOnGeometry(getContext(), ng, dim);
 
@@ -922,9 +912,7 @@ TopoManager::newFreeTopoInGroup(std::string ng, int dim)
 Mgx3D::Internal::M3DCommandResult*
 TopoManager::newFreeBoundedTopoInGroup(std::string ng, int dim, const std::vector<std::string>& ve)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::newFreeBoundedTopoInGroup("<<ng<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::newFreeBoundedTopoInGroup("<<ng<<")");
 
     Topo::CommandNewTopoOnGeometry* command = new Topo::CommandNewTopoOnGeometry(getContext(), ng, dim);
     std::vector<Utils::Entity*>	entities	= getContext ( ).get (ve, true);
@@ -946,12 +934,15 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::
 newBoxWithTopo(const Utils::Math::Point& pmin, const Utils::Math::Point& pmax,
 		bool meshStructured, std::string groupName)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::newBoxWithTopo ("<<pmin<<", "<<pmax;
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::newBoxWithTopo ("<<pmin<<", "<<pmax;
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     // creation de la commande de création de la géométrie
     Geom::CommandNewBox *commandGeom = new Geom::CommandNewBox(getContext(),pmin,pmax,groupName);
@@ -995,12 +986,15 @@ newBoxWithTopo(const Utils::Math::Point& pmin, const Utils::Math::Point& pmax,
 		const int ni, const int nj, const int nk,
 		std::string groupName)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::newBoxWithTopo ("<<pmin<<", "<<pmax<<", "<<(short)ni<<", "<<(short)nj<<", "<<(short)nk;
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::newBoxWithTopo ("<<pmin<<", "<<pmax<<", "<<(short)ni<<", "<<(short)nj<<", "<<(short)nk;
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     // creation de la commande de création de la géométrie
     Geom::CommandNewBox *commandGeom = new Geom::CommandNewBox(getContext(),pmin,pmax,groupName);
@@ -1043,17 +1037,20 @@ newCylinderWithTopo(const Point& pcentre, const double& dr,
         const int naxe, const int ni, const int nr,
         std::string groupName)
 {
-     TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-     message << "TopoManager::newCylinderWithTopo("<<pcentre<<", "
-	         <<Utils::Math::MgxNumeric::userRepresentation (dr)<<", "<<dv<<", "
-	         <<Utils::Math::MgxNumeric::userRepresentation (da)<<", "
-             <<(meshStructured?"True":"False")<<", "
-	         <<Utils::Math::MgxNumeric::userRepresentation (rat)<<", "
-	         <<(long)naxe<<", "<<(long)ni<<", "<<(long)nr;
-     if (!groupName.empty())
-         message<<", "<<groupName;
-     message<<")";
-     log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+     if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+     {
+         TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+         message << "TopoManager::newCylinderWithTopo("<<pcentre<<", "
+    	         <<Utils::Math::MgxNumeric::userRepresentation (dr)<<", "<<dv<<", "
+    	         <<Utils::Math::MgxNumeric::userRepresentation (da)<<", "
+                 <<(meshStructured?"True":"False")<<", "
+    	         <<Utils::Math::MgxNumeric::userRepresentation (rat)<<", "
+    	         <<(long)naxe<<", "<<(long)ni<<", "<<(long)nr;
+         if (!groupName.empty())
+             message<<", "<<groupName;
+         message<<")";
+         log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+     }
 
      // creation de la commande de création de la géométrie
      Geom::CommandNewCylinder *commandGeom = new Geom::CommandNewCylinder(getContext(),pcentre, dr, dv, da, groupName);
@@ -1112,18 +1109,21 @@ newHollowCylinderWithTopo(const Point& pcentre, const double& dr_int, const doub
         const int naxe, const int ni, const int nr,
         std::string groupName)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-     message << "TopoManager::newHollowCylinderWithTopo("<<pcentre<<", "
-	         <<Utils::Math::MgxNumeric::userRepresentation (dr_int)<<", "
-	         <<Utils::Math::MgxNumeric::userRepresentation (dr_ext)<<", "
-     	 	 <<dv<<", "
-	         <<Utils::Math::MgxNumeric::userRepresentation (da)<<", "
-             <<(meshStructured?"True":"False")<<", "
-	         <<(long)naxe<<", "<<(long)ni<<", "<<(long)nr;
-     if (!groupName.empty())
-         message<<", "<<groupName;
-     message<<")";
-     log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+         message << "TopoManager::newHollowCylinderWithTopo("<<pcentre<<", "
+    	         <<Utils::Math::MgxNumeric::userRepresentation (dr_int)<<", "
+    	         <<Utils::Math::MgxNumeric::userRepresentation (dr_ext)<<", "
+         	 	 <<dv<<", "
+    	         <<Utils::Math::MgxNumeric::userRepresentation (da)<<", "
+                 <<(meshStructured?"True":"False")<<", "
+    	         <<(long)naxe<<", "<<(long)ni<<", "<<(long)nr;
+         if (!groupName.empty())
+             message<<", "<<groupName;
+         message<<")";
+         log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
      // creation de la commande de création de la géométrie
      Geom::CommandNewHollowCylinder *commandGeom =
@@ -1184,19 +1184,22 @@ newConeWithTopo(const double& dr1, const double& dr2,
             const int naxe, const int ni, const int nr,
 			std::string groupName)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-     message << "TopoManager::newConeWithTopo("
-	         <<Utils::Math::MgxNumeric::userRepresentation (dr1)<<", "
-	         <<Utils::Math::MgxNumeric::userRepresentation (dr2)<<", "
-			 <<dv<<", "
-	         <<Utils::Math::MgxNumeric::userRepresentation (da)<<", "
-             <<(meshStructured?"True":"False")<<", "
-	         <<Utils::Math::MgxNumeric::userRepresentation (rat)<<", "
-             <<(long)naxe<<", "<<(long)ni<<", "<<(long)nr;
-     if (!groupName.empty())
-         message<<", "<<groupName;
-     message<<")";
-     log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+         message << "TopoManager::newConeWithTopo("
+    	         <<Utils::Math::MgxNumeric::userRepresentation (dr1)<<", "
+    	         <<Utils::Math::MgxNumeric::userRepresentation (dr2)<<", "
+    			 <<dv<<", "
+    	         <<Utils::Math::MgxNumeric::userRepresentation (da)<<", "
+                 <<(meshStructured?"True":"False")<<", "
+    	         <<Utils::Math::MgxNumeric::userRepresentation (rat)<<", "
+                 <<(long)naxe<<", "<<(long)ni<<", "<<(long)nr;
+         if (!groupName.empty())
+             message<<", "<<groupName;
+         message<<")";
+         log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
      // creation de la commande de création de la géométrie
      Geom::CommandNewCone *commandGeom = new Geom::CommandNewCone(getContext(), dr1, dr2, dv, da, groupName);
@@ -1255,16 +1258,19 @@ newSphereWithTopo(const Point& pcentre,  const double& dr,
                             const int ni, const int nr,
                             std::string groupName)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::newSphereWithTopo("<<pcentre<<", "
-	        <<Utils::Math::MgxNumeric::userRepresentation (dr)<<", "
-            <<Utils::Portion::getName(dt)<<", "
-            <<(meshStructured?"True":"False")<<", "
-	        <<Utils::Math::MgxNumeric::userRepresentation (rat)<<", "<<(long)ni<<", "<<(long)nr;
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::newSphereWithTopo("<<pcentre<<", "
+    	        <<Utils::Math::MgxNumeric::userRepresentation (dr)<<", "
+                <<Utils::Portion::getName(dt)<<", "
+                <<(meshStructured?"True":"False")<<", "
+    	        <<Utils::Math::MgxNumeric::userRepresentation (rat)<<", "<<(long)ni<<", "<<(long)nr;
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     // creation de la commande de création de la géométrie
     double da =  Utils::Portion::getAngleInDegree(dt);
@@ -1321,17 +1327,20 @@ newHollowSphereWithTopo(const Point& pcentre,  const double& dr_int,  const doub
                             const int ni, const int nr,
                             std::string groupName)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::newSphereWithTopo("<<pcentre<<", "
-	        <<Utils::Math::MgxNumeric::userRepresentation (dr_int)<<", "
-	        <<Utils::Math::MgxNumeric::userRepresentation (dr_ext)<<", "
-            <<Utils::Portion::getName(dt)<<", "
-            <<(meshStructured?"True":"False")<<", "
-	        <<(long)ni<<", "<<(long)nr;
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::newSphereWithTopo("<<pcentre<<", "
+    	        <<Utils::Math::MgxNumeric::userRepresentation (dr_int)<<", "
+    	        <<Utils::Math::MgxNumeric::userRepresentation (dr_ext)<<", "
+                <<Utils::Portion::getName(dt)<<", "
+                <<(meshStructured?"True":"False")<<", "
+    	        <<(long)ni<<", "<<(long)nr;
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     // creation de la commande de création de la géométrie
     Geom::CommandNewHollowSphere *commandGeom =
@@ -1391,16 +1400,19 @@ newSpherePartWithTopo(const double& dr,
 		const int nk,
 		std::string groupName)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::newSpherePartWithTopo("
-    		<<Utils::Math::MgxNumeric::userRepresentation (dr)
-    		<<", "<<Utils::Math::MgxNumeric::userRepresentation (angleY)
-    		<<", "<<Utils::Math::MgxNumeric::userRepresentation (angleZ)
-    		<<", "<<(long)ni<<", "<<(long)nj<<", "<<(long)nk;
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::newSpherePartWithTopo("
+        		<<Utils::Math::MgxNumeric::userRepresentation (dr)
+        		<<", "<<Utils::Math::MgxNumeric::userRepresentation (angleY)
+        		<<", "<<Utils::Math::MgxNumeric::userRepresentation (angleZ)
+        		<<", "<<(long)ni<<", "<<(long)nj<<", "<<(long)nk;
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     // creation de la commande de création de la géométrie
     Geom::CommandNewSpherePart *commandGeom = new Geom::CommandNewSpherePart(getContext(),dr, angleY, angleZ, groupName);
@@ -1448,16 +1460,19 @@ newHollowSpherePartWithTopo(const double& dr_int,
 		const int nk,
 		std::string groupName)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::newHollowSpherePartWithTopo("
-    		<<Utils::Math::MgxNumeric::userRepresentation (dr_int)
-    		<<", "<<Utils::Math::MgxNumeric::userRepresentation (angleY)
-    		<<", "<<Utils::Math::MgxNumeric::userRepresentation (angleZ)
-    		<<", "<<(long)ni<<", "<<(long)nj<<", "<<(long)nk;
-    if (!groupName.empty())
-        message<<", "<<groupName;
-    message<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::newHollowSpherePartWithTopo("
+        		<<Utils::Math::MgxNumeric::userRepresentation (dr_int)
+        		<<", "<<Utils::Math::MgxNumeric::userRepresentation (angleY)
+        		<<", "<<Utils::Math::MgxNumeric::userRepresentation (angleZ)
+        		<<", "<<(long)ni<<", "<<(long)nj<<", "<<(long)nk;
+        if (!groupName.empty())
+            message<<", "<<groupName;
+        message<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     // creation de la commande de création de la géométrie
     Geom::CommandNewHollowSpherePart *commandGeom = new Geom::CommandNewHollowSpherePart(getContext(),dr_int, dr_ext, angleY, angleZ, groupName);
@@ -1499,10 +1514,13 @@ newHollowSpherePartWithTopo(const double& dr_int,
 Mgx3D::Internal::M3DCommandResult* TopoManager::
 newIJBoxesWithTopo(int ni, int nj, bool alternateStruture)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::newIJBoxesWithTopo ("<<(int64_t)ni<<", "<<(int64_t)nj<<", "
-            <<(alternateStruture?"True":"False")<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::newIJBoxesWithTopo ("<<(int64_t)ni<<", "<<(int64_t)nj<<", "
+                <<(alternateStruture?"True":"False")<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     // creation de la commande composite
     TkUtil::UTF8String titreCmd(TkUtil::Charset::UTF_8);
@@ -1571,10 +1589,13 @@ newIJBoxesWithTopo(int ni, int nj, bool alternateStruture)
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::newIJKBoxesWithTopo(int ni, int nj, int nk, bool alternateStruture)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::newIJKBoxesWithTopo ("<<(int64_t)ni<<", "<<(int64_t)nj<<", "<<(int64_t)nk<<", "
-            <<(alternateStruture?"True":"False")<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::newIJKBoxesWithTopo ("<<(int64_t)ni<<", "<<(int64_t)nj<<", "<<(int64_t)nk<<", "
+                <<(alternateStruture?"True":"False")<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     // creation de la commande composite
     TkUtil::UTF8String titreCmd(TkUtil::Charset::UTF_8);
@@ -1654,9 +1675,7 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::newTopoOGridOnGeometry(std::stri
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::newTopoOGridOnGeometry(Geom::GeomEntity* ge, const double& rat)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::newTopoOGridOnGeometry("<<ge->getName()<<","<<rat<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::newTopoOGridOnGeometry("<<ge->getName()<<","<<rat<<")");
 
     Topo::CommandNewTopoOGridOnGeometry* command = new Topo::CommandNewTopoOGridOnGeometry(getContext(), ge, rat);
 
@@ -1683,15 +1702,18 @@ void TopoManager::destroy(std::vector<std::string>& topo_entities_names, bool pr
 void TopoManager::destroy(std::vector<Topo::TopoEntity*>& ve, bool propagate)
 {
 	CHECK_ENTITIES_LIST(ve)
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::destroy([";
-    for (uint i=0; i<ve.size(); i++){
-    	if (i)
-    		message <<", ";
-    	message << ve[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::destroy([";
+        for (uint i=0; i<ve.size(); i++){
+        	if (i)
+        		message <<", ";
+        	message << ve[i]->getName();
+        }
+        message <<"],"<<(propagate?"avec propagation":"sans propagation")<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message <<"],"<<(propagate?"avec propagation":"sans propagation")<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Topo::CommandDestroyTopo* command = new Topo::CommandDestroyTopo(getContext(), ve, propagate);
 
@@ -1797,9 +1819,7 @@ Mgx3D::Internal::M3DCommandResult*
 TopoManager::insertHole(std::vector<CoFace*>& cofaces)
 {
 	CHECK_ENTITIES_LIST(cofaces)
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::insertHole("<<cofaces.size()<<" faces)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::insertHole("<<cofaces.size()<<" faces)");
 
     Topo::CommandInsertHole* command = new Topo::CommandInsertHole(getContext(), cofaces);
 
@@ -1821,9 +1841,7 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::fuse2Edges(std::string na, std::
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::fuse2Edges(CoEdge* edge_A, CoEdge* edge_B)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::fuse2Edges("<<edge_A->getName()<<","<<edge_B->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::fuse2Edges("<<edge_A->getName()<<","<<edge_B->getName()<<")");
 
     Topo::CommandFuse2Edges* command = new Topo::CommandFuse2Edges(getContext(), edge_A, edge_B);
 
@@ -1860,21 +1878,24 @@ TopoManager::fuse2EdgeList(std::vector<Topo::CoEdge* > &coedges1, std::vector<To
 {
 	CHECK_ENTITIES_LIST(coedges1)
 	CHECK_ENTITIES_LIST(coedges2)
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::fuse2EdgeList([";
-    for (uint i=0; i<coedges1.size(); i++){
-        if (i)
-            message <<", ";
-        message << coedges1[i]->getName();
-    }
-    message <<"], [";
-    for (uint i=0; i<coedges2.size(); i++){
-        if (i)
-            message <<", ";
-        message << coedges2[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::fuse2EdgeList([";
+        for (uint i=0; i<coedges1.size(); i++){
+            if (i)
+                message <<", ";
+            message << coedges1[i]->getName();
+        }
+        message <<"], [";
+        for (uint i=0; i<coedges2.size(); i++){
+            if (i)
+                message <<", ";
+            message << coedges2[i]->getName();
+        }
+        message <<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message <<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Topo::CommandFuse2EdgeList* command = new Topo::CommandFuse2EdgeList(getContext(),
     		coedges1, coedges2);
@@ -1898,9 +1919,7 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::fuse2Faces(std::string na, std::
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::fuse2Faces(CoFace* face_A, CoFace* face_B)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::fuse2Faces("<<face_A->getName()<<","<<face_B->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::fuse2Faces("<<face_A->getName()<<","<<face_B->getName()<<")");
 
     Topo::CommandFuse2Faces* command = new Topo::CommandFuse2Faces(getContext(), face_A, face_B);
 
@@ -1937,21 +1956,24 @@ TopoManager::fuse2FaceList(std::vector<Topo::CoFace* > &cofaces1, std::vector<To
 {
 	CHECK_ENTITIES_LIST(cofaces1)
 	CHECK_ENTITIES_LIST(cofaces2)
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::fuse2FaceList([";
-    for (uint i=0; i<cofaces1.size(); i++){
-        if (i)
-            message <<", ";
-        message << cofaces1[i]->getName();
-    }
-    message <<"], [";
-    for (uint i=0; i<cofaces2.size(); i++){
-        if (i)
-            message <<", ";
-        message << cofaces2[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::fuse2FaceList([";
+        for (uint i=0; i<cofaces1.size(); i++){
+            if (i)
+                message <<", ";
+            message << cofaces1[i]->getName();
+        }
+        message <<"], [";
+        for (uint i=0; i<cofaces2.size(); i++){
+            if (i)
+                message <<", ";
+            message << cofaces2[i]->getName();
+        }
+        message <<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message <<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Topo::CommandFuse2FaceList* command = new Topo::CommandFuse2FaceList(getContext(),
     		cofaces1, cofaces2);
@@ -1975,9 +1997,7 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::glue2Blocks(std::string na, std:
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::glue2Blocks(Block* bl_A, Block* bl_B)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::glue2Blocks("<<bl_A->getName()<<","<<bl_B->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::glue2Blocks("<<bl_A->getName()<<","<<bl_B->getName()<<")");
 
     Topo::CommandGlue2Blocks* command = new Topo::CommandGlue2Blocks(getContext(), bl_A, bl_B);
 
@@ -2003,9 +2023,7 @@ Internal::M3DCommandResult* TopoManager::glue2Topo(
 Internal::M3DCommandResult* TopoManager::glue2Topo(
 		Geom::Volume* vol1, Geom::Volume* vol2)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::glue2Topo("<<vol1->getName()<<","<<vol2->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::glue2Topo("<<vol1->getName()<<","<<vol2->getName()<<")");
 
     Topo::CommandGlue2Topo* command = new Topo::CommandGlue2Topo(getContext(), vol1, vol2);
 
@@ -2028,9 +2046,7 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::fuse2Vertices(std::string na, st
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::fuse2Vertices(Topo::Vertex* vtx_A, Topo::Vertex* vtx_B)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::fuse2Vertices("<<vtx_A->getName()<<","<<vtx_B->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::fuse2Vertices("<<vtx_A->getName()<<","<<vtx_B->getName()<<")");
 
     Topo::CommandFuse2Vertices* command = new Topo::CommandFuse2Vertices(getContext(), vtx_A, vtx_B);
 
@@ -2057,9 +2073,7 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::splitBlock(Block* bloc, CoEdge*
     warning <<"La fonction splitBlock est obsolete, il est préférable d'utiliser splitBlocks";
     log (TkUtil::TraceLog (warning, TkUtil::Log::WARNING));
 
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::splitBlock("<<bloc->getName()<<","<<arete->getName()<<","<<ratio<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::splitBlock("<<bloc->getName()<<","<<arete->getName()<<","<<ratio<<")");
 
     Topo::CommandSplitBlock* command = new Topo::CommandSplitBlock(getContext(), bloc, arete, ratio);
 
@@ -2081,9 +2095,7 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::splitBlock(Block* bloc, CoEdge*
     warning <<"La fonction splitBlock est obsolete, il est préférable d'utiliser splitBlocks";
     log (TkUtil::TraceLog (warning, TkUtil::Log::WARNING));
 
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::splitBlock("<<bloc->getName()<<","<<arete->getName()<<","<<pt<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::splitBlock("<<bloc->getName()<<","<<arete->getName()<<","<<pt<<")");
 
     Topo::CommandSplitBlock* command = new Topo::CommandSplitBlock(getContext(), bloc, arete, pt);
 
@@ -2222,9 +2234,7 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::extendSplitBlock(std::string nbl
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::extendSplitBlock(Block* bloc, CoEdge* arete)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::extendSplitBlock("<<bloc->getName()<<","<<arete->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::extendSplitBlock("<<bloc->getName()<<","<<arete->getName()<<")");
 
     Topo::CommandExtendSplitBlock* command = new Topo::CommandExtendSplitBlock(getContext(), bloc, arete);
 
@@ -2299,21 +2309,24 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::splitBlocksWithOgrid(std::vector
 {
 	CHECK_ENTITIES_LIST(blocs)
 	CHECK_ENTITIES_LIST(cofaces)
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::splitBlocksWithOgrid([";
-    for (uint i=0; i<blocs.size(); i++){
-        if (i)
-            message <<", ";
-        message << blocs[i]->getName();
-    }
-    message <<"], [";
-    for (uint i=0; i<cofaces.size(); i++){
-        if (i)
-            message <<", ";
-        message << cofaces[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::splitBlocksWithOgrid([";
+        for (uint i=0; i<blocs.size(); i++){
+            if (i)
+                message <<", ";
+            message << blocs[i]->getName();
+        }
+        message <<"], [";
+        for (uint i=0; i<cofaces.size(); i++){
+            if (i)
+                message <<", ";
+            message << cofaces[i]->getName();
+        }
+        message <<"],"<<Utils::Math::MgxNumeric::userRepresentation (ratio_ogrid)<<","<<(short)nb_bras<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message <<"],"<<Utils::Math::MgxNumeric::userRepresentation (ratio_ogrid)<<","<<(short)nb_bras<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Topo::CommandSplitBlocksWithOgrid* command = new Topo::CommandSplitBlocksWithOgrid(getContext(),
             blocs, cofaces, ratio_ogrid, nb_bras, create_internal_vertices, propagate_neighbor_block);
@@ -2361,21 +2374,24 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::splitFacesWithOgrid(std::vector<
 {
 	CHECK_ENTITIES_LIST(cofaces)
 	CHECK_ENTITIES_LIST(coedges)
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::splitFacesWithOgrid([";
-    for (uint i=0; i<coedges.size(); i++){
-        if (i)
-            message <<", ";
-        message << coedges[i]->getName();
-    }
-    message <<"], [";
-    for (uint i=0; i<cofaces.size(); i++){
-        if (i)
-            message <<", ";
-        message << cofaces[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::splitFacesWithOgrid([";
+        for (uint i=0; i<coedges.size(); i++){
+            if (i)
+                message <<", ";
+            message << coedges[i]->getName();
+        }
+        message <<"], [";
+        for (uint i=0; i<cofaces.size(); i++){
+            if (i)
+                message <<", ";
+            message << cofaces[i]->getName();
+        }
+        message <<"],"<<Utils::Math::MgxNumeric::userRepresentation (ratio_ogrid)<<","<<(short)nb_bras<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message <<"],"<<Utils::Math::MgxNumeric::userRepresentation (ratio_ogrid)<<","<<(short)nb_bras<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Topo::CommandSplitFacesWithOgrid* command = new Topo::CommandSplitFacesWithOgrid(getContext(),
             cofaces, coedges, ratio_ogrid, nb_bras);
@@ -2406,15 +2422,18 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::splitFaces(std::vector<std::stri
 Mgx3D::Internal::M3DCommandResult* TopoManager::splitFaces(std::vector<Topo::CoFace*  > &cofaces, CoEdge* arete, const double& ratio_dec, const double& ratio_ogrid, bool project_on_meshing_edges)
 {
 	CHECK_ENTITIES_LIST(cofaces)
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::splitFaces([";
-    for (uint i=0; i<cofaces.size(); i++){
-        if (i)
-            message <<", ";
-        message << cofaces[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::splitFaces([";
+        for (uint i=0; i<cofaces.size(); i++){
+            if (i)
+                message <<", ";
+            message << cofaces[i]->getName();
+        }
+        message <<"],"<<arete->getName()<<","<<Utils::Math::MgxNumeric::userRepresentation (ratio_dec)<<","<<Utils::Math::MgxNumeric::userRepresentation (ratio_ogrid)<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message <<"],"<<arete->getName()<<","<<Utils::Math::MgxNumeric::userRepresentation (ratio_dec)<<","<<Utils::Math::MgxNumeric::userRepresentation (ratio_ogrid)<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Topo::CommandSplitFaces* command = new Topo::CommandSplitFaces(getContext(), cofaces, arete, ratio_dec, ratio_ogrid, project_on_meshing_edges);
 
@@ -2448,15 +2467,18 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::splitFaces(std::vector<std::stri
 Mgx3D::Internal::M3DCommandResult* TopoManager::splitFaces(std::vector<Topo::CoFace*  > &cofaces, CoEdge* arete, const Point& pt, const double& ratio_ogrid, bool project_on_meshing_edges)
 {
 	CHECK_ENTITIES_LIST(cofaces)
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::splitFaces([";
-    for (uint i=0; i<cofaces.size(); i++){
-        if (i)
-            message <<", ";
-        message << cofaces[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::splitFaces([";
+        for (uint i=0; i<cofaces.size(); i++){
+            if (i)
+                message <<", ";
+            message << cofaces[i]->getName();
+        }
+        message <<"],"<<arete->getName()<<","<<pt<<","<<Utils::Math::MgxNumeric::userRepresentation (ratio_ogrid)<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message <<"],"<<arete->getName()<<","<<pt<<","<<Utils::Math::MgxNumeric::userRepresentation (ratio_ogrid)<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Topo::CommandSplitFaces* command = new Topo::CommandSplitFaces(getContext(), cofaces, arete, pt, ratio_ogrid, project_on_meshing_edges);
 
@@ -2488,9 +2510,7 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::splitFace(Topo::CoFace* coface,
     warning <<"La fonction splitFace est obsolete, il est préférable d'utiliser splitFaces";
     log (TkUtil::TraceLog (warning, TkUtil::Log::WARNING));
 
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::splitFace("<<coface->getName()<<", "<< coedge->getName() <<", "<< ratio_dec<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::splitFace("<<coface->getName()<<", "<< coedge->getName() <<", "<< ratio_dec<<")");
 
     std::vector<Topo::CoFace* > cofaces = {coface};
     Topo::CommandSplitFaces* command = new Topo::CommandSplitFaces(getContext(), cofaces, coedge, ratio_dec, 0, project_on_meshing_edges);
@@ -2519,10 +2539,13 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::splitFace(std::string coface_nam
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::splitFace(Topo::CoFace* coface, CoEdge* coedge, const Point& pt, bool project_on_meshing_edges)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
 
-    message <<"TopoManager::splitFace("<<coface->getName()<<", "<< coedge->getName() <<", "<< pt<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+        message <<"TopoManager::splitFace("<<coface->getName()<<", "<< coedge->getName() <<", "<< pt<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     std::vector<Topo::CoFace* > cofaces = {coface};
     Topo::CommandSplitFaces* command = new Topo::CommandSplitFaces(getContext(), cofaces, coedge, pt, 0, project_on_meshing_edges);
@@ -2553,10 +2576,13 @@ TopoManager::extendSplitFace(std::string coface_name, std::string nsommet)
 Mgx3D::Internal::M3DCommandResult*
 TopoManager::extendSplitFace(Topo::CoFace* coface, Vertex* vertex)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
 
-    message <<"TopoManager::extendSplitFace("<<coface->getName()<<", "<< vertex->getName() <<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+        message <<"TopoManager::extendSplitFace("<<coface->getName()<<", "<< vertex->getName() <<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     Topo::CommandExtendSplitFace* command = new Topo::CommandExtendSplitFace(getContext(), coface, vertex);
 
@@ -2581,10 +2607,7 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::splitAllFaces(std::string narete
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::splitAllFaces(CoEdge* coedge, const double& ratio_dec, const double& ratio_ogrid, bool project_on_meshing_edges)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::splitAllFaces(";
-    message <<coedge->getName()<<","<<Utils::Math::MgxNumeric::userRepresentation (ratio_dec)<<","<<Utils::Math::MgxNumeric::userRepresentation (ratio_ogrid)<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::splitAllFaces(" << coedge->getName()<<","<<Utils::Math::MgxNumeric::userRepresentation (ratio_dec)<<","<<Utils::Math::MgxNumeric::userRepresentation (ratio_ogrid)<<")");
 
     Topo::CommandSplitFaces* command = new Topo::CommandSplitFaces(getContext(), coedge, ratio_dec, ratio_ogrid, project_on_meshing_edges);
 
@@ -2613,10 +2636,7 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::splitAllFaces(std::string narete
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::splitAllFaces(CoEdge* coedge, const Point& pt, const double& ratio_ogrid, bool project_on_meshing_edges)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::splitAllFaces(";
-    message <<coedge->getName()<<","<<pt<<","<<Utils::Math::MgxNumeric::userRepresentation (ratio_ogrid)<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::splitAllFaces(" << coedge->getName()<<","<<pt<<","<<Utils::Math::MgxNumeric::userRepresentation (ratio_ogrid)<<")");
 
     Topo::CommandSplitFaces* command = new Topo::CommandSplitFaces(getContext(), coedge, pt, ratio_ogrid);
 
@@ -2644,10 +2664,13 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::splitEdge(std::string coedge_nam
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::splitEdge(CoEdge* coedge, const double& ratio_dec)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
 
-    message <<"TopoManager::splitEdge("<<coedge->getName()<<", "<< Utils::Math::MgxNumeric::userRepresentation (ratio_dec)<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+        message <<"TopoManager::splitEdge("<<coedge->getName()<<", "<< Utils::Math::MgxNumeric::userRepresentation (ratio_dec)<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     Topo::CommandSplitEdge* command = new Topo::CommandSplitEdge(getContext(), coedge, ratio_dec);
 
@@ -2671,10 +2694,13 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::splitEdge(std::string coedge_nam
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::splitEdge(CoEdge* coedge, const Point& pt)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
 
-    message <<"TopoManager::splitEdge("<<coedge->getName()<<", "<< pt<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+        message <<"TopoManager::splitEdge("<<coedge->getName()<<", "<< pt<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     Topo::CommandSplitEdge* command = new Topo::CommandSplitEdge(getContext(), coedge, pt);
 
@@ -2693,11 +2719,14 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::splitEdge(CoEdge* coedge, const
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::snapVertices(std::string nom1, std::string nom2, bool project_on_first)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-     message <<"TopoManager::snapVertices(";
-     message <<nom1<<","<<nom2
-             <<(project_on_first?", avec projection sur le premier":", avec placement au milieu des sommets")<<")";
-     log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+         message <<"TopoManager::snapVertices(";
+         message <<nom1<<","<<nom2
+                 <<(project_on_first?", avec projection sur le premier":", avec placement au milieu des sommets")<<")";
+         log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
      // trace pour le script
      TkUtil::UTF8String cmd (TkUtil::Charset::UTF_8);
@@ -2809,15 +2838,18 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::makeBlocksByRevolWithRatioOgrid(
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::makeBlocksByRevol(std::vector<CoEdge*>& coedges, const  Utils::Portion::Type& dt, const double& ratio_ogrid)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::makeBlocksByRevol([";
-    for (uint i=0; i<coedges.size(); i++){
-    	if (i)
-    		message <<", ";
-    	message << coedges[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::makeBlocksByRevol([";
+        for (uint i=0; i<coedges.size(); i++){
+        	if (i)
+        		message <<", ";
+        	message << coedges[i]->getName();
+        }
+        message <<"],"<<Utils::Portion::getName(dt)<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message <<"],"<<Utils::Portion::getName(dt)<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
 	if (dt != Utils::Portion::DEMI
 			&& dt != Utils::Portion::TIERS
@@ -2948,15 +2980,18 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::makeBlocksByExtrude(std::vector<
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::makeBlocksByExtrude(std::vector<TopoEntity*>& cofaces, const  Utils::Math::Vector& dv)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::makeBlocksByExtrude([";
-    for (uint i=0; i<cofaces.size(); i++){
-        if (i)
-            message <<", ";
-        message << cofaces[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::makeBlocksByExtrude([";
+        for (uint i=0; i<cofaces.size(); i++){
+            if (i)
+                message <<", ";
+            message << cofaces[i]->getName();
+        }
+        message <<"],"<<dv.getScriptCommand()<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message <<"],"<<dv.getScriptCommand()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Topo::CommandExtrudeFace* command = new CommandExtrudeFace(getContext(), cofaces, dv);
 
@@ -2992,10 +3027,13 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::setMeshingProperty(CoEdgeMeshing
 Mgx3D::Internal::M3DCommandResult* TopoManager::setMeshingProperty(CoEdgeMeshingProperty& emp, std::vector<CoEdge*>& coedges)
 {
 	CHECK_ENTITIES_LIST (coedges)
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::setMeshingProperty(EdgeMeshingProperty("<<(long)emp.getNbEdges()<<","<<emp.getMeshLawName()
-                    <<"),"<<coedges.size()<<" arêtes)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::setMeshingProperty(EdgeMeshingProperty("<<(long)emp.getNbEdges()<<","<<emp.getMeshLawName()
+                        <<"),"<<coedges.size()<<" arêtes)";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     Topo::CommandSetEdgeMeshingProperty* command = new Topo::CommandSetEdgeMeshingProperty(getContext(), emp, coedges);
 
@@ -3013,10 +3051,13 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::setMeshingProperty(CoEdgeMeshing
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::setAllMeshingProperty(CoEdgeMeshingProperty& emp)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::setAllMeshingProperty(EdgeMeshingProperty("<<(long)emp.getNbEdges()<<","<<emp.getMeshLawName()
-                    <<"), toutes les arêtes)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::setAllMeshingProperty(EdgeMeshingProperty("<<(long)emp.getNbEdges()<<","<<emp.getMeshLawName()
+                        <<"), toutes les arêtes)";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     std::vector<Topo::CoEdge* > coedges = getCoEdgesObj();
 
@@ -3044,10 +3085,13 @@ TopoManager::setParallelMeshingProperty(CoEdgeMeshingProperty& emp, std::string
 Mgx3D::Internal::M3DCommandResult*
 TopoManager::setParallelMeshingProperty(CoEdgeMeshingProperty& emp, Topo::CoEdge* coedge)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::setMeshingProperty(EdgeMeshingProperty("<<(long)emp.getNbEdges()<<","<<emp.getMeshLawName()
-                    <<"),"<<coedge->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::setMeshingProperty(EdgeMeshingProperty("<<(long)emp.getNbEdges()<<","<<emp.getMeshLawName()
+                        <<"),"<<coedge->getName()<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     Topo::CommandSetEdgeMeshingPropertyToParallelCoEdges* command = new Topo::CommandSetEdgeMeshingPropertyToParallelCoEdges(getContext(), emp, coedge);
 
@@ -3079,9 +3123,7 @@ Mgx3D::Internal::M3DCommandResult*
 TopoManager::reverseDirection(std::vector<CoEdge*>& coedges)
 {
 	CHECK_ENTITIES_LIST(coedges)
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::reverseDirection pour "<<coedges.size()<<" arêtes";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::reverseDirection pour "<<coedges.size()<<" arêtes");
 
     Topo::CommandReverseDirection* command = new Topo::CommandReverseDirection(getContext(), coedges);
 
@@ -3109,10 +3151,13 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::setMeshingProperty(CoFaceMeshing
 Mgx3D::Internal::M3DCommandResult* TopoManager::setMeshingProperty(CoFaceMeshingProperty& emp, std::vector<CoFace*>& cofaces)
 {
 	CHECK_ENTITIES_LIST(cofaces)
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::setMeshingProperty(EdgeMeshingProperty("<<emp.getMeshLawName()
-                    <<"),"<<cofaces.size()<<" faces)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::setMeshingProperty(EdgeMeshingProperty("<<emp.getMeshLawName()
+                        <<"),"<<cofaces.size()<<" faces)";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     Topo::CommandSetFaceMeshingProperty* command = new Topo::CommandSetFaceMeshingProperty(getContext(), emp, cofaces);
 
@@ -3129,10 +3174,13 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::setMeshingProperty(CoFaceMeshing
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::setAllMeshingProperty(CoFaceMeshingProperty& emp)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::setAllMeshingProperty(FaceMeshingProperty("<<emp.getMeshLawName()
-                    <<"), toutes les faces)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::setAllMeshingProperty(FaceMeshingProperty("<<emp.getMeshLawName()
+                        <<"), toutes les faces)";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     std::vector<Topo::CoFace* > cofaces = getCoFacesObj();
 
@@ -3163,10 +3211,13 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::setMeshingProperty(BlockMeshingP
 Mgx3D::Internal::M3DCommandResult* TopoManager::setMeshingProperty(BlockMeshingProperty& emp, std::vector<Block*>& blocks)
 {
 	CHECK_ENTITIES_LIST(blocks)
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::setMeshingProperty(EdgeMeshingProperty("<<emp.getMeshLawName()
-                    <<"),"<<blocks.size()<<" blocs)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::setMeshingProperty(EdgeMeshingProperty("<<emp.getMeshLawName()
+                        <<"),"<<blocks.size()<<" blocs)";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     Topo::CommandSetBlockMeshingProperty* command = new Topo::CommandSetBlockMeshingProperty(getContext(), emp, blocks);
 
@@ -3183,10 +3234,13 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::setMeshingProperty(BlockMeshingP
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::setAllMeshingProperty(BlockMeshingProperty& emp)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::setAllMeshingProperty(FaceMeshingProperty("<<emp.getMeshLawName()
-                    <<"), toutes les faces)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::setAllMeshingProperty(FaceMeshingProperty("<<emp.getMeshLawName()
+                        <<"), toutes les faces)";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     std::vector<Topo::Block* > blocks = getBlocksObj();
 
@@ -3282,10 +3336,13 @@ double TopoManager::getEdgeProjectedLength(const std::string& edge_name) const
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::setEdgeMeshingProperty(CoEdgeMeshingProperty& emp, CoEdge* ed)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::setEdgeMeshingProperty(EdgeMeshingProperty("<<(long)emp.getNbEdges()<<","<<emp.getMeshLawName()
-                    <<"),"<<ed->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::setEdgeMeshingProperty(EdgeMeshingProperty("<<(long)emp.getNbEdges()<<","<<emp.getMeshLawName()
+                        <<"),"<<ed->getName()<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     Topo::CommandSetEdgeMeshingProperty* command = new Topo::CommandSetEdgeMeshingProperty(getContext(), emp, ed);
 
@@ -3309,10 +3366,13 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::setFaceMeshingProperty(CoFaceMes
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::setFaceMeshingProperty(CoFaceMeshingProperty& emp, CoFace* cf)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::setFaceMeshingProperty(FaceMeshingProperty("<<emp.getMeshLawName()
-                    <<"),"<<cf->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::setFaceMeshingProperty(FaceMeshingProperty("<<emp.getMeshLawName()
+                        <<"),"<<cf->getName()<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     Topo::CommandSetFaceMeshingProperty* command = new Topo::CommandSetFaceMeshingProperty(getContext(), emp, cf);
 
@@ -3335,10 +3395,13 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::setBlockMeshingProperty(BlockMes
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::setBlockMeshingProperty(BlockMeshingProperty& emp, Block* bl)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::setBlockMeshingProperty(BlockMeshingProperty("<<emp.getMeshLawName()
-                    <<"),"<<bl->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::setBlockMeshingProperty(BlockMeshingProperty("<<emp.getMeshLawName()
+                        <<"),"<<bl->getName()<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     Topo::CommandSetBlockMeshingProperty* command = new Topo::CommandSetBlockMeshingProperty(getContext(), emp, bl);
 
@@ -3361,9 +3424,7 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::unrefine(std::string nbloc, std:
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::unrefine(Block* bloc, CoEdge* arete, int ratio)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::unrefine("<<bloc->getName()<<","<<arete->getName()<<","<<(short)ratio<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::unrefine("<<bloc->getName()<<","<<arete->getName()<<","<<(short)ratio<<")");
 
     Topo::CommandUnrefineBlock* command = new Topo::CommandUnrefineBlock(getContext(), bloc, arete, ratio);
 
@@ -3381,9 +3442,7 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::unrefine(Block* bloc, CoEdge* ar
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::refine(int ratio)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::refine("<<(short)ratio<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::refine("<<(short)ratio<<")");
 
     Topo::CommandRefineAllCoEdges* command = new Topo::CommandRefineAllCoEdges(getContext(), ratio);
 
@@ -3402,9 +3461,7 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::importMDL(std::string n, const b
 		std::string prefixName,int deg_min, int deg_max)
 {
 #ifdef USE_MDLPARSER
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::importMDL ("<<n<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::importMDL ("<<n<<")");
 
     // création de l'importateur de modélisation/topo MDL
     Internal::ImportMDLImplementation* impl = new Internal::ImportMDLImplementation(getContext(), n, all,
@@ -3595,15 +3652,18 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::
 fuseEdges(std::vector<CoEdge*> &coedges)
 {
 	CHECK_ENTITIES_LIST(coedges)
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::fuseEdges (";
-    for (uint i=0; i<coedges.size(); i++){
-        if (i)
-            message <<", ";
-        message << coedges[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::fuseEdges (";
+        for (uint i=0; i<coedges.size(); i++){
+            if (i)
+                message <<", ";
+            message << coedges[i]->getName();
+        }
+        message << ")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message << ")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     // récupération des courbes sur lesquelles se font les projections
     std::vector<Geom::GeomEntity*> courbes;
@@ -3669,9 +3729,7 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::fuse2Blocks(std::string na, std:
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::fuse2Blocks(Block* bl_A, Block* bl_B)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::fuse2Blocks("<<bl_A->getName()<<","<<bl_B->getName()<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::fuse2Blocks("<<bl_A->getName()<<","<<bl_B->getName()<<")");
 
     Topo::CommandFuse2Blocks* command = new Topo::CommandFuse2Blocks(getContext(), bl_A, bl_B);
 
@@ -3708,15 +3766,18 @@ setGeomAssociation(std::vector<TopoEntity*> & topo_entities,
 		bool move_vertices)
 {
 	CHECK_ENTITIES_LIST(topo_entities)
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::setGeomAssociation ([";
-    for (uint i=0; i<topo_entities.size(); i++){
-        if (i)
-            message <<", ";
-        message << topo_entities[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::setGeomAssociation ([";
+        for (uint i=0; i<topo_entities.size(); i++){
+            if (i)
+                message <<", ";
+            message << topo_entities[i]->getName();
+        }
+        message << "], "<< (geom_entity?geom_entity->getName():"") <<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message << "], "<< (geom_entity?geom_entity->getName():"") <<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     // création de la commande
     Topo::CommandSetGeomAssociation* command =
@@ -3921,16 +3982,19 @@ translate(std::vector<TopoEntity*>& ve, const Vector& dp,
     	throw TkUtil::Exception (TkUtil::UTF8String ("Aucune entité sélectionnée pour la translation", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::translate ([";
-    for (uint i=0; i<ve.size(); i++){
-        if (i)
-            message <<", ";
-        message << ve[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::translate ([";
+        for (uint i=0; i<ve.size(); i++){
+            if (i)
+                message <<", ";
+            message << ve[i]->getName();
+        }
+        message << "], "<< dp ;
+        message <<(withGeom?", avec":", sans")<<" translation de la géométrie)";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message << "], "<< dp ;
-    message <<(withGeom?", avec":", sans")<<" translation de la géométrie)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Internal::CommandInternal* command = 0;
 
@@ -3987,16 +4051,19 @@ rotate(std::vector<TopoEntity*>& ve,
     	throw TkUtil::Exception (TkUtil::UTF8String ("Aucune entité sélectionné pour la rotation", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::rotate ([";
-    for (uint i=0; i<ve.size(); i++){
-        if (i)
-            message <<", ";
-        message << ve[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::rotate ([";
+        for (uint i=0; i<ve.size(); i++){
+            if (i)
+                message <<", ";
+            message << ve[i]->getName();
+        }
+        message << "], "<<  rot;
+        message <<(withGeom?", avec":", sans")<<" rotation de la géométrie)";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message << "], "<<  rot;
-    message <<(withGeom?", avec":", sans")<<" rotation de la géométrie)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Internal::CommandInternal* command = 0;
 
@@ -4066,16 +4133,19 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::scale(std::vector<TopoEntity*>&
     	throw TkUtil::Exception (TkUtil::UTF8String ("Aucune entité sélectionné pour l'homothétie", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::scale ([";
-    for (uint i=0; i<ve.size(); i++){
-        if (i)
-            message <<", ";
-        message << ve[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::scale ([";
+        for (uint i=0; i<ve.size(); i++){
+            if (i)
+                message <<", ";
+            message << ve[i]->getName();
+        }
+        message << "], "<< Utils::Math::MgxNumeric::userRepresentation (facteur) ;
+        message <<(withGeom?", avec":", sans")<<" homothétie de la géométrie)";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message << "], "<< Utils::Math::MgxNumeric::userRepresentation (facteur) ;
-    message <<(withGeom?", avec":", sans")<<" homothétie de la géométrie)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Internal::CommandInternal* command = 0;
 
@@ -4152,18 +4222,21 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::scale(std::vector<TopoEntity*>&
     	throw TkUtil::Exception (TkUtil::UTF8String ("Aucune entité sélectionné pour l'homothétie", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::scale ([";
-    for (uint i=0; i<ve.size(); i++){
-        if (i)
-            message <<", ";
-        message << ve[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::scale ([";
+        for (uint i=0; i<ve.size(); i++){
+            if (i)
+                message <<", ";
+            message << ve[i]->getName();
+        }
+        message << "], "<< factorX<<", "<<factorY<<", "<<factorZ;
+        if (!(pcentre == Point(0,0,0)))
+            message <<", "<<pcentre.getScriptCommand();
+        message <<(withGeom?", avec":", sans")<<" homothétie de la géométrie)";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message << "], "<< factorX<<", "<<factorY<<", "<<factorZ;
-    if (!(pcentre == Point(0,0,0)))
-        message <<", "<<pcentre.getScriptCommand();
-    message <<(withGeom?", avec":", sans")<<" homothétie de la géométrie)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Internal::CommandInternal* command = 0;
 
@@ -4227,16 +4300,19 @@ TopoManager::mirror(std::vector<TopoEntity*>& ve,
     	throw TkUtil::Exception (TkUtil::UTF8String ("Aucune entité sélectionné pour la ymétrie", TkUtil::Charset::UTF_8));
     }
 
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::mirror ([";
-    for (uint i=0; i<ve.size(); i++){
-        if (i)
-            message <<", ";
-        message << ve[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::mirror ([";
+        for (uint i=0; i<ve.size(); i++){
+            if (i)
+                message <<", ";
+            message << ve[i]->getName();
+        }
+        message << "], "<<  *plane;
+        message <<(withGeom?", avec":", sans")<<" symétrie de la géométrie)";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message << "], "<<  *plane;
-    message <<(withGeom?", avec":", sans")<<" symétrie de la géométrie)";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Internal::CommandInternal* command = 0;
 
@@ -4316,22 +4392,25 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::setVertexLocation(std::vector<Ve
 		CoordinateSystem::SysCoord* rep)
 {
 	CHECK_ENTITIES_LIST(vertices)
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::setVertexLocation ([";
-    for (uint i=0; i<vertices.size(); i++){
-        if (i)
-            message <<", ";
-        message << vertices[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::setVertexLocation ([";
+        for (uint i=0; i<vertices.size(); i++){
+            if (i)
+                message <<", ";
+            message << vertices[i]->getName();
+        }
+        message << "]";
+        if (changeX)
+            message << ", modifie x : "<<Utils::Math::MgxNumeric::userRepresentation (xPos);
+        if (changeY)
+            message << ", modifie y : "<<Utils::Math::MgxNumeric::userRepresentation (yPos);
+        if (changeZ)
+            message << ", modifie z : "<<Utils::Math::MgxNumeric::userRepresentation (zPos);
+
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message << "]";
-    if (changeX)
-        message << ", modifie x : "<<Utils::Math::MgxNumeric::userRepresentation (xPos);
-    if (changeY)
-        message << ", modifie y : "<<Utils::Math::MgxNumeric::userRepresentation (yPos);
-    if (changeZ)
-        message << ", modifie z : "<<Utils::Math::MgxNumeric::userRepresentation (zPos);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Topo::CommandChangeVerticesLocation* command =
             new Topo::CommandChangeVerticesLocation(getContext(),
@@ -4358,6 +4437,59 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::setVertexLocation(std::vector<Ve
     return cmdResult;
 }
 /*----------------------------------------------------------------------------*/
+Mgx3D::Internal::M3DCommandResult* TopoManager::setVerticesCoordinates(std::vector<std::string>& vertices_names,
+        std::vector<Point>& points)
+{
+    std::vector<Vertex*> vertices;
+    vertices.reserve(vertices_names.size());
+    for (const std::string& name : vertices_names)
+        vertices.push_back(TopoManager::getVertex (name, true));
+
+    return setVerticesCoordinates(vertices, points);
+}
+/*----------------------------------------------------------------------------*/
+Mgx3D::Internal::M3DCommandResult* TopoManager::setVerticesCoordinates(std::vector<Vertex*>& vertices,
+        std::vector<Point>& points)
+{
+	CHECK_ENTITIES_LIST(vertices)
+    if (vertices.empty()){
+    	TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+    	message <<"setVerticesCoordinates n'a pas de sommet";
+    	throw TkUtil::Exception(message);
+    }
+    if (vertices.size() != points.size()){
+    	TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+    	message <<"setVerticesCoordinates : "<<(long)vertices.size()<<" sommets pour "
+    			<<(long)points.size()<<" positions";
+    	throw TkUtil::Exception(message);
+    }
+
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::setVerticesCoordinates pour "<<(long)vertices.size()<<" sommets");
+
+    Topo::CommandChangeVerticesLocation* command =
+            new Topo::CommandChangeVerticesLocation(getContext(), vertices, points);
+
+    // trace dans le script
+    TkUtil::UTF8String cmd (TkUtil::Charset::UTF_8);
+    cmd << getContextAlias ( ) << ".getTopoManager ( ).setVerticesCoordinates (" << Internal::entitiesToPythonList<Vertex> (vertices);
+    cmd << ", [";
+    for (size_t i=0; i<points.size(); i++){
+    	if (i)
+    		cmd << ", ";
+    	cmd << points[i].getScriptCommand();
+    }
+    cmd << "])";
+    command->setScriptCommand(cmd);
+
+    // on passe au gestionnaire de commandes qui exécute la commande en // ou non
+    // et la stocke dans le gestionnaire de undo-redo si c'est une réussite
+    getCommandManager().addCommand(command, Utils::Command::DO);
+
+    Internal::M3DCommandResult*  cmdResult   =
+                                    new Internal::M3DCommandResult (*command);
+    return cmdResult;
+}
+/*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::setVertexSphericalLocation(std::vector<std::string>& vertices_names,
 		const bool changeRho,
 		const double& rhoPos,
@@ -4398,22 +4530,25 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::setVertexSphericalLocation(std::
 		CoordinateSystem::SysCoord* rep)
 {
 	CHECK_ENTITIES_LIST(vertices)
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::setVertexSphericalLocation ([";
-    for (uint i=0; i<vertices.size(); i++){
-        if (i)
-            message <<", ";
-        message << vertices[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::setVertexSphericalLocation ([";
+        for (uint i=0; i<vertices.size(); i++){
+            if (i)
+                message <<", ";
+            message << vertices[i]->getName();
+        }
+        message << "]";
+        if (changeRho)
+            message << ", modifie Rho : "<<Utils::Math::MgxNumeric::userRepresentation (rhoPos);
+        if (changeTheta)
+            message << ", modifie Theta : "<<Utils::Math::MgxNumeric::userRepresentation (thetaPos);
+        if (changePhi)
+            message << ", modifie Phi : "<<Utils::Math::MgxNumeric::userRepresentation (phiPos);
+
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message << "]";
-    if (changeRho)
-        message << ", modifie Rho : "<<Utils::Math::MgxNumeric::userRepresentation (rhoPos);
-    if (changeTheta)
-        message << ", modifie Theta : "<<Utils::Math::MgxNumeric::userRepresentation (thetaPos);
-    if (changePhi)
-        message << ", modifie Phi : "<<Utils::Math::MgxNumeric::userRepresentation (phiPos);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Topo::CommandChangeVerticesLocation* command =
             new Topo::CommandChangeVerticesLocation(getContext(),
@@ -4480,22 +4615,25 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::setVertexCylindricalLocation(std
 				CoordinateSystem::SysCoord* rep)
 {
 	CHECK_ENTITIES_LIST(vertices)
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::setVertexCylindricalLocation ([";
-    for (uint i=0; i<vertices.size(); i++){
-        if (i)
-            message <<", ";
-        message << vertices[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::setVertexCylindricalLocation ([";
+        for (uint i=0; i<vertices.size(); i++){
+            if (i)
+                message <<", ";
+            message << vertices[i]->getName();
+        }
+        message << "]";
+        if (changeRho)
+            message << ", modifie Rho : "<<Utils::Math::MgxNumeric::userRepresentation (rhoPos);
+        if (changePhi)
+            message << ", modifie Phi : "<<Utils::Math::MgxNumeric::userRepresentation (phiPos);
+        if (changeZ)
+            message << ", modifie z : "<<Utils::Math::MgxNumeric::userRepresentation (zPos);
+
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message << "]";
-    if (changeRho)
-        message << ", modifie Rho : "<<Utils::Math::MgxNumeric::userRepresentation (rhoPos);
-    if (changePhi)
-        message << ", modifie Phi : "<<Utils::Math::MgxNumeric::userRepresentation (phiPos);
-    if (changeZ)
-        message << ", modifie z : "<<Utils::Math::MgxNumeric::userRepresentation (zPos);
-
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Topo::CommandChangeVerticesLocation* command =
             new Topo::CommandChangeVerticesLocation(getContext(),
@@ -4533,10 +4671,13 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::setVertexSameLocation(std::strin
 Mgx3D::Internal::M3DCommandResult* TopoManager::setVertexSameLocation(Vertex* vtx,
 		Vertex* target)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::setVertexSameLocation ("<<vtx->getName()<<", "<<target->getName()<<")";
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::setVertexSameLocation ("<<vtx->getName()<<", "<<target->getName()<<")";
 
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     Topo::CommandChangeVertexSameLocation* command =
             new Topo::CommandChangeVertexSameLocation(getContext(), vtx, target);
@@ -4571,15 +4712,18 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::snapProjectedVertices(std::vecto
 Mgx3D::Internal::M3DCommandResult* TopoManager::snapProjectedVertices(std::vector<Vertex*>& vertices)
 {
 	CHECK_ENTITIES_LIST(vertices)
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::snapProjectedVertices ([";
-    for (uint i=0; i<vertices.size(); i++){
-        if (i)
-            message <<", ";
-        message << vertices[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::snapProjectedVertices ([";
+        for (uint i=0; i<vertices.size(); i++){
+            if (i)
+                message <<", ";
+            message << vertices[i]->getName();
+        }
+        message << "]";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message << "]";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Topo::CommandSnapProjectedVertices* command =
             new Topo::CommandSnapProjectedVertices(getContext(), vertices);
@@ -4600,9 +4744,7 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::snapProjectedVertices(std::vecto
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::snapAllProjectedVertices()
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::snapAllProjectedVertices ()";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::snapAllProjectedVertices ()");
 
     Topo::CommandSnapProjectedVertices* command =
             new Topo::CommandSnapProjectedVertices(getContext());
@@ -4637,15 +4779,18 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::alignVertices(std::vector<std::s
 Mgx3D::Internal::M3DCommandResult* TopoManager::alignVertices(std::vector<Vertex*>& vertices)
 {
 	CHECK_ENTITIES_LIST(vertices)
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::alignVertices ([";
-    for (uint i=0; i<vertices.size(); i++){
-        if (i)
-            message <<", ";
-        message << vertices[i]->getName();
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::alignVertices ([";
+        for (uint i=0; i<vertices.size(); i++){
+            if (i)
+                message <<", ";
+            message << vertices[i]->getName();
+        }
+        message << "]";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
     }
-    message << "]";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
 
     Topo::CommandAlignVertices* command =
             new Topo::CommandAlignVertices(getContext(), vertices);
@@ -4780,6 +4925,64 @@ Utils::Math::Point TopoManager::getCoord(const std::string& name) const
 	return vtx->getCoord();
 }
 /*----------------------------------------------------------------------------*/
+void TopoManager::getVerticesCoordinates(std::vector<double>& coords) const
+{
+	std::vector<Vertex*> vertices = getVerticesObj();
+	coords.resize(3*vertices.size());
+	for (size_t i=0; i<vertices.size(); i++){
+		const Utils::Math::Point& pt = vertices[i]->getCoord();
+		coords[3*i]   = pt.getX();
+		coords[3*i+1] = pt.getY();
+		coords[3*i+2] = pt.getZ();
+	}
+}
+/*----------------------------------------------------------------------------*/
+void TopoManager::getBlocksVerticesIndices(std::vector<long>& indices) const
+{
+	indices.clear();
+
+	std::vector<Vertex*> vertices = getVerticesObj();
+	std::unordered_map<Vertex*, long> vtx2id;
+	vtx2id.reserve(vertices.size());
+	for (size_t i=0; i<vertices.size(); i++)
+		vtx2id[vertices[i]] = (long)i;
+
+	std::vector<Block*> blocks = getBlocksObj();
+	indices.reserve(9*blocks.size());
+	for (Block* bl : blocks){
+		const std::vector<Vertex*>& bl_vertices = bl->getVertices();
+		indices.push_back((long)bl_vertices.size());
+		for (Vertex* vtx : bl_vertices)
+			indices.push_back(vtx2id.at(vtx));
+	}
+}
+/*----------------------------------------------------------------------------*/
+void TopoManager::getSplitBlocksPreview(std::vector<std::string>& blocs_names,
+        std::string narete, const double& ratio, std::vector<double>& coords)
+{
+    std::vector<Topo::Block* > blocs;
+    for (std::vector<std::string>::iterator iter = blocs_names.begin();
+            iter != blocs_names.end(); ++iter)
+        blocs.push_back(getBlock(*iter));
+
+    // même calcul que pour l'aperçu des panneaux, dans un thread dédié
+    TopoPreviewTask task(new Topo::CommandSplitBlocks(getContext(), blocs, getCoEdge(narete), ratio),
+            std::function<void()>());
+    task.wait();
+    if (!task.getError().empty())
+        throw TkUtil::Exception (TkUtil::UTF8String (task.getError(), TkUtil::Charset::UTF_8));
+
+    const std::vector<Utils::Math::Point>& points = task.getRepresentation().getPoints();
+    const std::vector<size_t>& indices = task.getRepresentation().getCurveDiscretization();
+    coords.resize(3*indices.size());
+    for (size_t i=0; i<indices.size(); i++){
+        const Utils::Math::Point& pt = points[indices[i]];
+        coords[3*i]   = pt.getX();
+        coords[3*i+1] = pt.getY();
+        coords[3*i+2] = pt.getZ();
+    }
+}
+/*----------------------------------------------------------------------------*/
 void TopoManager::getTopoEntities(std::vector<std::string> & topo_entities_names,
          std::vector<TopoEntity*> & topo_entities,
          const char* nom_fonction)
@@ -4824,9 +5027,7 @@ int TopoManager::getDefaultNbMeshingEdges()
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::setDefaultNbMeshingEdges(int nb)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::setDefaultNbMeshingEdges("<<(unsigned long)nb<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::setDefaultNbMeshingEdges("<<(unsigned long)nb<<")");
 
     Topo::CommandChangeDefaultNbMeshingEdges* command =
             new Topo::CommandChangeDefaultNbMeshingEdges(getContext(), nb);
@@ -4972,16 +5173,19 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::setNbMeshingEdges(std::string ed
 /*----------------------------------------------------------------------------*/
 Mgx3D::Internal::M3DCommandResult* TopoManager::setNbMeshingEdges(CoEdge* coedge, int nb, std::vector<CoEdge*>& frozed_coedges)
 {
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message <<"TopoManager::setNbMeshingEdges("<<coedge->getName()<<", "<<(unsigned long)nb<<", [";
-    for (uint i=0; i<frozed_coedges.size(); i++){
-        if (i)
-            message <<", ";
-        message << frozed_coedges[i]->getName();
-    }
-    message <<"])";
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_4))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message <<"TopoManager::setNbMeshingEdges("<<coedge->getName()<<", "<<(unsigned long)nb<<", [";
+        for (uint i=0; i<frozed_coedges.size(); i++){
+            if (i)
+                message <<", ";
+            message << frozed_coedges[i]->getName();
+        }
+        message <<"])";
 
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_4));
+    }
 
     Topo::CommandSetNbMeshingEdges* command = new Topo::CommandSetNbMeshingEdges(getContext(), coedge, nb, frozed_coedges);
 
@@ -5006,15 +5210,18 @@ Mgx3D::Internal::M3DCommandResult* TopoManager::setNbMeshingEdges(CoEdge* coedge
 Internal::M3DCommandResult* TopoManager::addToGroup(std::vector<std::string>& ve, int dim, const std::string& groupName)
 {
 
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::addToGroup ([";
-    for (uint i=0; i<ve.size(); i++){
-        if (i)
-            message <<", ";
-        message << ve[i];
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::addToGroup ([";
+        for (uint i=0; i<ve.size(); i++){
+            if (i)
+                message <<", ";
+            message << ve[i];
+        }
+        message << "], "<<(short)dim<<", "<<groupName<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message << "], "<<(short)dim<<", "<<groupName<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
     std::vector<TopoEntity*> entities = getEntitiesFromNames(ve, dim);
     Mesh::CommandAddRemoveGroupName* command = new Mesh::CommandAddRemoveGroupName(getContext(), entities, dim, groupName, Mesh::CommandAddRemoveGroupName::add);
@@ -5042,15 +5249,18 @@ Internal::M3DCommandResult* TopoManager::addToGroup(std::vector<std::string>& ve
 Internal::M3DCommandResult* TopoManager::removeFromGroup(std::vector<std::string>& ve, int dim, const std::string& groupName)
 {
 
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::removeFromGroup ([";
-    for (uint i=0; i<ve.size(); i++){
-        if (i)
-            message <<", ";
-        message << ve[i];
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::removeFromGroup ([";
+        for (uint i=0; i<ve.size(); i++){
+            if (i)
+                message <<", ";
+            message << ve[i];
+        }
+        message << "], "<<(short)dim<<", "<<groupName<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message << "], "<<(short)dim<<", "<<groupName<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
     std::vector<TopoEntity*> entities = getEntitiesFromNames(ve, dim);
     Mesh::CommandAddRemoveGroupName* command = new Mesh::CommandAddRemoveGroupName(getContext(), entities, dim, groupName, Mesh::CommandAddRemoveGroupName::remove);
@@ -5078,15 +5288,18 @@ Internal::M3DCommandResult* TopoManager::removeFromGroup(std::vector<std::string
 Internal::M3DCommandResult* TopoManager::setGroup(std::vector<std::string>& ve, int dim, const std::string& groupName)
 {
 
-    TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
-    message << "TopoManager::setGroup ([";
-    for (uint i=0; i<ve.size(); i++){
-        if (i)
-            message <<", ";
-        message << ve[i];
+    if (MGX_TRACE_ENABLED (getLogStream ( ), TkUtil::Log::TRACE_3))
+    {
+        TkUtil::UTF8String message (TkUtil::Charset::UTF_8);
+        message << "TopoManager::setGroup ([";
+        for (uint i=0; i<ve.size(); i++){
+            if (i)
+                message <<", ";
+            message << ve[i];
+        }
+        message << "], "<<(short)dim<<", "<<groupName<<")";
+        log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
     }
-    message << "], "<<(short)dim<<", "<<groupName<<")";
-    log (TkUtil::TraceLog (message, TkUtil::Log::TRACE_3));
 
     std::vector<TopoEntity*> entities = getEntitiesFromNames(ve, dim);
     Mesh::CommandAddRemoveGroupName* command = new Mesh::CommandAddRemoveGroupName(getContext(), entities, dim, groupName, Mesh::CommandAddRemoveGroupName::set);
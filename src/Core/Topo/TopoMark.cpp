@@ -0,0 +1,51 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file TopoMark.cpp
+ *
+ *  \date 19 oct. 2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Topo/TopoMark.h"
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Topo {
+/*----------------------------------------------------------------------------*/
+TopoMarkManager::TopoMarkManager()
+: m_nbFree(TOPO_NB_MARK_SLOTS)
+, m_generation(0)
+{
+	// les emplacements sont distribués par indice croissant
+	for (uint i=0; i<TOPO_NB_MARK_SLOTS; i++){
+		m_free[i] = TOPO_NB_MARK_SLOTS-1-i;
+		m_slot_generations[i] = 0;
+	}
+}
+/*----------------------------------------------------------------------------*/
+bool TopoMarkManager::acquire(uint& slot, unsigned long long& generation)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (0 == m_nbFree)
+		return false;
+
+	slot = m_free[--m_nbFree];
+	// la génération 0 est celle des entités jamais marquées.
+	// celle de l'emplacement est mise à jour avant la génération courante
+	// pour qu'une entité qui voit la nouvelle génération oublie l'ancienne
+	// marque de l'emplacement (cf TopoMarks::get)
+	generation = m_generation.load() + 1;
+	m_slot_generations[slot] = generation;
+	m_generation = generation;
+	return true;
+}
+/*----------------------------------------------------------------------------*/
+void TopoMarkManager::release(uint slot)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_free[m_nbFree++] = slot;
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Topo
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,147 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file TopoPreviewTask.cpp
+ *
+ *  \date 19 oct. 2026
+ */
+/*----------------------------------------------------------------------------*/
+#include "Topo/TopoPreviewTask.h"
+#include "Topo/CommandEditTopo.h"
+/*----------------------------------------------------------------------------*/
+#include <TkUtil/Exception.h>
+#include <TkUtil/MemoryError.h>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Topo {
+/*----------------------------------------------------------------------------*/
+std::mutex TopoPreviewTask::s_mutex;
+std::condition_variable TopoPreviewTask::s_condition;
+std::set<TopoPreviewTask*> TopoPreviewTask::s_tasks;
+size_t TopoPreviewTask::s_modifications = 0;
+size_t TopoPreviewTask::s_computations = 0;
+/*----------------------------------------------------------------------------*/
+TopoPreviewTask::TopoPreviewTask(CommandEditTopo* command, std::function<void()> completed)
+: m_command(command)
+, m_completed(completed)
+, m_representation(Utils::DisplayRepresentation::WIRE)
+, m_cancel(false)
+, m_stop(false)
+, m_isCompleted(false)
+{
+	CHECK_NULL_PTR_ERROR(m_command);
+	if (!m_command->hasSideEffectFreePreview()){
+		delete m_command;
+		m_command = 0;
+		throw TkUtil::Exception (TkUtil::UTF8String ("TopoPreviewTask : la commande ne sait pas calculer son aperçu sans être exécutée", TkUtil::Charset::UTF_8));
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(s_mutex);
+		s_tasks.insert(this);
+	}
+	try {
+		m_thread = std::thread(&TopoPreviewTask::run, this);
+	}
+	catch (...){
+		// le destructeur ne sera pas appelé
+		{
+			std::lock_guard<std::mutex> lock(s_mutex);
+			s_tasks.erase(this);
+		}
+		delete m_command;
+		m_command = 0;
+		throw;
+	}
+}
+/*----------------------------------------------------------------------------*/
+TopoPreviewTask::~TopoPreviewTask()
+{
+	cancel();
+	{
+		std::lock_guard<std::mutex> lock(s_mutex);
+		s_tasks.erase(this);
+	}
+	delete m_command;
+}
+/*----------------------------------------------------------------------------*/
+void TopoPreviewTask::cancel()
+{
+	{
+		std::lock_guard<std::mutex> lock(s_mutex);
+		m_cancel = true;
+		m_stop = true;
+	}
+	s_condition.notify_all();
+	wait();
+}
+/*----------------------------------------------------------------------------*/
+void TopoPreviewTask::wait()
+{
+	if (m_thread.joinable())
+		m_thread.join();
+}
+/*----------------------------------------------------------------------------*/
+TopoPreviewTask::TopologyModification::TopologyModification()
+{
+	std::unique_lock<std::mutex> lock(s_mutex);
+	s_modifications++;
+	for (TopoPreviewTask* task : s_tasks)
+		task->m_stop = true;
+	s_condition.wait(lock, [](){ return 0 == s_computations; });
+}
+/*----------------------------------------------------------------------------*/
+TopoPreviewTask::TopologyModification::~TopologyModification()
+{
+	{
+		std::lock_guard<std::mutex> lock(s_mutex);
+		s_modifications--;
+	}
+	s_condition.notify_all();
+}
+/*----------------------------------------------------------------------------*/
+void TopoPreviewTask::run()
+{
+	// le calcul attend la fin des modifications de la topologie en cours
+	{
+		std::unique_lock<std::mutex> lock(s_mutex);
+		s_condition.wait(lock, [this](){ return m_cancel || 0 == s_modifications; });
+		if (m_cancel)
+			return;
+		m_stop = false;
+		s_computations++;
+	}
+
+	bool interrupted = false;
+	try {
+		interrupted = !m_command->computePreview(m_representation, m_stop);
+	}
+	catch (const TkUtil::Exception& exc){
+		m_error = exc.getFullMessage();
+	}
+	catch (const std::exception& exc){
+		m_error = exc.what();
+	}
+	catch (...){
+		m_error = "Erreur non documentée lors du calcul de l'aperçu";
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(s_mutex);
+		s_computations--;
+	}
+	s_condition.notify_all();
+
+	if (m_cancel)
+		return;
+	if (interrupted)
+		m_error = "Calcul de l'aperçu interrompu par une modification de la topologie";
+	m_isCompleted = true;
+	if (m_completed)
+		m_completed();
+}
+/*----------------------------------------------------------------------------*/
+} // end namespace Topo
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
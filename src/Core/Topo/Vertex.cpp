@@ -279,7 +279,7 @@ free(Internal::InfoCommand* icmd)
 
     // on retire la relation avec la géométrie
     if (icmd && getGeomAssociation()
-             && icmd->getTopoInfoEntity()[this] != Internal::InfoCommand::NONE){
+             && icmd->getTopoInfoEntityType(this) != Internal::InfoCommand::NONE){
         saveTopoProperty();
         setGeomAssociation(0);
     }
@@ -433,7 +433,7 @@ saveVertexTopoProperty(Internal::InfoCommand* icmd)
     if (icmd) {
 #ifdef _DEBUG2
     	std::cout<<"Vertex::saveVertexTopoProperty pour "<<getName()<<", valeur initiale: "
-    			<<Internal::InfoCommand::type2String(icmd->getTopoInfoEntity()[this])<<std::endl;
+    			<<Internal::InfoCommand::type2String(icmd->getTopoInfoEntityType(this))<<std::endl;
 #endif
         bool change = icmd->addTopoInfoEntity(this,Internal::InfoCommand::OTHERMODIFIED);
         if (m_save_topo_property == 0){
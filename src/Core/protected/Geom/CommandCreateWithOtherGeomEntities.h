@@ -43,6 +43,22 @@ public:
      */
     void internalRedo();
 
+    /*------------------------------------------------------------------------*/
+    /** \brief  mémoire occupée par les mémentos et déchargement sur disque,
+     *          voir Utils::Command. Le rechargement est fait automatiquement
+     *          lors de l'annulation ou du rejeu.
+     */
+    virtual size_t getUndoMemorySize() const
+    {return m_memento_service.getMemorySize();}
+    virtual bool spillUndoData(const std::string& fileName)
+    {return m_memento_service.spill(fileName);}
+    virtual void restoreUndoData()
+    {m_memento_service.restore();}
+    virtual bool isUndoDataSpilled() const
+    {return m_memento_service.isSpilled();}
+    virtual bool isDroppableFromUndoStack() const
+    {return true;}
+
 protected:
     Services::MementoService m_memento_service;
 };
@@ -107,6 +107,17 @@ public:
      */
     virtual void computeBoundingBox(Utils::Math::Point& pmin, Utils::Math::Point& pmax) const = 0;
 
+    /*------------------------------------------------------------------------*/
+    /** \brief  Boite englobante mémorisée avec l'entité (cf computeBoundingBox),
+     *          calculée au premier appel.
+     *
+     *  Le premier appel n'est pas protégé contre les accès concurrents.
+     */
+    void getCachedBoundingBox(Utils::Math::Point& pmin, Utils::Math::Point& pmax) const;
+
+    /// à appeler lorsque la forme OCC de l'entité est modifiée
+    void forceComputeBoundingBox() { m_computedBoundingBoxIsUpToDate = false; }
+
     /*------------------------------------------------------------------------*/
     /** \brief   retourne un point sur l'objet au centre si possible
      * \author Eric Brière de l'Isle
@@ -162,6 +173,13 @@ private:
 
     /// résultat de la commande computeArea, qui peut être longue
     mutable double m_computedArea;
+
+    /// pour savoir si computeBoundingBox doit être appelé
+    mutable bool m_computedBoundingBoxIsUpToDate;
+
+    /// résultat de computeBoundingBox, qui peut être long pour les surfaces
+    mutable Utils::Math::Point m_computedBoundingBoxMin;
+    mutable Utils::Math::Point m_computedBoundingBoxMax;
 };
 /*----------------------------------------------------------------------------*/
 } // end namespace Mgx3D::Geom
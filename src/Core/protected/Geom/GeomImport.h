@@ -7,6 +7,7 @@
 #include "Internal/Context.h"
 /*----------------------------------------------------------------------------*/
 #include <TopoDS_Shape.hxx>
+#include <TopoDS_Solid.hxx>
 /*----------------------------------------------------------------------------*/
 #include <string>
 /*----------------------------------------------------------------------------*/
@@ -89,6 +90,13 @@ protected:
      */
     virtual void store(Vertex* v);
 
+    /*------------------------------------------------------------------------*/
+    /** \brief  Teste si les solides sont fermés (closed[i] mis à 0 sinon).
+     *          Le calcul est réparti sur plusieurs threads si c'est autorisé.
+     */
+    virtual void computeClosedSolids(const std::vector<TopoDS_Solid>& solids,
+    		std::vector<char>& closed);
+
     /*------------------------------------------------------------------------*/
     /** \brief  Réalise l'ouverture du fichier géométrique au format
      *          souhaité
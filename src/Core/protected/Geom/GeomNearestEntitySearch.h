@@ -0,0 +1,121 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file GeomNearestEntitySearch.h
+ *
+ *  \date 19 oct. 2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef GEOMNEARESTENTITYSEARCH_H_
+#define GEOMNEARESTENTITYSEARCH_H_
+/*----------------------------------------------------------------------------*/
+#include "Utils/Common.h"
+#include "Utils/Point.h"
+/*----------------------------------------------------------------------------*/
+#include <vector>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Geom {
+class GeomEntity;
+/*----------------------------------------------------------------------------*/
+/** \class GeomNearestEntitySearch
+ *  \brief Recherche de l'entité géométrique la plus proche d'un point parmi
+ *  un ensemble d'entités (sommets, courbes ou surfaces).
+ *
+ *  Les boites englobantes des entités (cf GeomEntity::getCachedBoundingBox)
+ *  sont rangées dans une hiérarchie de boites. La distance à une boite
+ *  minore la distance à ce qu'elle contient, les entités sont donc
+ *  parcourues de la plus proche à la plus lointaine (suivant les boites) et
+ *  la projection exacte (OCC) n'est faite que tant que ce minorant ne dépasse
+ *  pas la meilleure distance trouvée.
+ *
+ *  Le résultat est le même qu'avec une projection sur chacune des entités :
+ *  en cas d'égalité, c'est la première entité de la liste qui est retenue.
+ *
+ *  Les recherches peuvent être faites en parallèle, la géométrie ne doit pas
+ *  être modifiée pendant la durée de vie de l'objet.
+ */
+/*----------------------------------------------------------------------------*/
+class GeomNearestEntitySearch {
+
+public:
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Construction de la hiérarchie de boites
+     *
+     *  \param entities les entités candidates, il ne peut pas y avoir de volume
+     */
+    GeomNearestEntitySearch(const std::vector<GeomEntity*>& entities);
+
+    ~GeomNearestEntitySearch();
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Recherche de l'entité la plus proche d'un point
+     *
+     *  \param pt le point
+     *  \param projected le projeté de pt sur l'entité trouvée
+     *  \return l'entité la plus proche, 0 s'il n'y a aucune candidate
+     */
+    GeomEntity* findNearest(const Utils::Math::Point& pt, Utils::Math::Point& projected) const;
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Recherche de l'entité la plus proche pour chacun des points,
+     *  en parallèle si les commandes sont autorisées à utiliser plusieurs threads
+     *
+     *  \param points les points
+     *  \param nearest les entités les plus proches, dans l'ordre des points
+     *  \param projected les projetés sur ces entités
+     */
+    void findNearest(const std::vector<Utils::Math::Point>& points,
+            std::vector<GeomEntity*>& nearest,
+            std::vector<Utils::Math::Point>& projected) const;
+
+private:
+
+    GeomNearestEntitySearch(const GeomNearestEntitySearch&)
+    { MGX_FORBIDDEN("GeomNearestEntitySearch::GeomNearestEntitySearch is not allowed."); }
+    GeomNearestEntitySearch& operator = (const GeomNearestEntitySearch&)
+    { MGX_FORBIDDEN("GeomNearestEntitySearch::operator = is not allowed."); return *this; }
+
+    /// boite alignée sur les axes
+    struct Box {
+        double m_min[3];
+        double m_max[3];
+
+        /// carré de la distance d'un point à la boite, nulle à l'intérieur
+        double distance2(const Utils::Math::Point& pt) const;
+    };
+
+    /// noeud de la hiérarchie, une feuille n'a pas de fils
+    struct Node {
+        Box m_box;
+        /// les entités de m_order[m_first] à m_order[m_last-1]
+        uint m_first;
+        uint m_last;
+        /// indices des fils dans m_nodes, -1 pour une feuille
+        int m_left;
+        int m_right;
+    };
+
+    /// construction récursive du noeud pour m_order[first] à m_order[last-1]
+    int build(uint first, uint last);
+
+    /// les entités candidates, dans l'ordre donné
+    std::vector<GeomEntity*> m_entities;
+
+    /// leurs boites englobantes
+    std::vector<Box> m_boxes;
+
+    /// permutation des entités suivant les feuilles de la hiérarchie
+    std::vector<uint> m_order;
+
+    /// la hiérarchie, la racine est le premier noeud
+    std::vector<Node> m_nodes;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Geom
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* GEOMNEARESTENTITYSEARCH_H_ */
+/*----------------------------------------------------------------------------*/
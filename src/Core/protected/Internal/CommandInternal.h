@@ -4,6 +4,7 @@
 /*----------------------------------------------------------------------------*/
 #include "Internal/InfoCommand.h"
 #include "Utils/Command.h"
+#include "Utils/Common.h"
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 namespace Internal {
@@ -26,8 +26,12 @@ public:
     /*------------------------------------------------------------------------*/
     /** \brief  Constructeur
      * \param le nom de la commande
+     * \param les ressources déclarées lues et modifiées (combinaison de
+     *        valeurs <I>Utils::Command::RESOURCE</I>), la commande ne
+     *        modifiant en fait rien
      */
-    CommandNewLongCommand(Internal::Context& c, std::string name);
+    CommandNewLongCommand(Internal::Context& c, std::string name,
+            unsigned long resources = Utils::Command::ALL_RESOURCES);
 
     /*------------------------------------------------------------------------*/
     /**
@@ -51,6 +55,15 @@ public:
     virtual unsigned long getEstimatedDuration (PLAY_TYPE playType = DO)
         { return (unsigned long)20; }
 
+    /*------------------------------------------------------------------------*/
+    /** \brief  ressources accédées : celles transmises au constructeur,
+     *          pour tester l'exécution simultanée de commandes.
+     */
+    virtual unsigned long getReadResources ( ) const
+        { return m_resources; }
+    virtual unsigned long getWrittenResources ( ) const
+        { return m_resources; }
+
     /*------------------------------------------------------------------------*/
     /** \brief  Destructeur, destruction des commandes référencées
      */
@@ -72,6 +85,8 @@ public:
 
 
 private:
+    /// ressources déclarées lues et modifiées
+    unsigned long m_resources;
 };
 /*----------------------------------------------------------------------------*/
 } // end namespace Internal
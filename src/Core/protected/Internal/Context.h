@@ -475,6 +475,51 @@ public:
      */
     void redo();
 
+    /**
+     *  Fixe le budget mémoire (en Mo) des données conservées pour annuler
+     *  les commandes. Au delà, les données des commandes les plus anciennes
+     *  sont écrites sur disque (dans directory, /tmp par défaut) et relues
+     *  lors de leur annulation, ou, si spill vaut false, ces commandes ne
+     *  sont plus annulables. 0 : pas de limite (défaut).
+     */
+    void setUndoMemoryBudget(double megabytes, bool spill = true,
+    		const std::string& directory = "");
+	SET_SWIG_COMPLETABLE_METHOD(setUndoMemoryBudget)
+
+    /**
+     *  Retourne une estimation (en octets) de la mémoire occupée par les
+     *  données d'annulation des commandes
+     */
+    unsigned long getUndoMemorySize();
+
+    /*------------------------------------------------------------------------*/
+    /**
+     *  Active ou désactive le profilage des commandes (durées des étapes
+     *  d'exécution par type de commande et des principaux algorithmes).
+     *  Inactif par défaut.
+     */
+    void setProfiling(bool enable);
+	SET_SWIG_COMPLETABLE_METHOD(setProfiling)
+
+    /// retourne vrai si le profilage des commandes est actif
+    bool isProfiling() const;
+
+    /// oublie les mesures effectuées par le profilage
+    void resetProfiling();
+
+    /**
+     *  Enregistre les mesures du profilage dans un fichier JSON au format
+     *  Trace Event (chrome://tracing, ui.perfetto.dev)
+     */
+    void saveProfilingTrace(const std::string& fileName) const;
+	SET_SWIG_COMPLETABLE_METHOD(saveProfilingTrace)
+
+    /**
+     *  Retourne un tableau récapitulatif des mesures du profilage, par durée
+     *  totale décroissante
+     */
+    std::string getProfilingSummary() const;
+
     /*------------------------------------------------------------------------*/
     /**
      *  Retourne un vecteur avec les identifiants des entités actuellement sélectionnées
@@ -116,12 +116,18 @@ public:
 
 protected:
 
+    /// crée en une fois les Geom::Vertex de tous les sommets du modèle qui ne le sont pas encore
+    void createVertices();
+
     /// retourne le Geom::Vertex suivant l'indice du sommet dans le modèle, le créé si nécessaire
     Geom::Vertex* getVertex(uint ptId);
 
     /// retourne la courbe suivant le nom du contour, la créée si nécessaire
     Geom::Curve* getCurve(const std::string name);
 
+    /// crée en une fois les Topo::Vertex aux extrémités des contours des zones
+    void createTopoVertices();
+
     /// retourne le Topo::Vertex suivant l'indice du sommet dans le modèle, le créé si nécessaire
     Topo::Vertex* getTopoVertex(uint ptId);
 
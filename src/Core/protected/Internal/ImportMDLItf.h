@@ -80,6 +80,11 @@ protected:
     /// démarre la lecture du fichier
     void readMDL();
 
+    /** répartit les commandes du modèle lu par type et construit, en un seul
+     *  parcours, les index des supports (par nom) et des points posés sur
+     *  chacun des supports */
+    void indexCommands();
+
 protected:
     /** contexte d'exécution*/
     Internal::Context& m_context;
@@ -99,8 +104,14 @@ protected:
     /// vecteur de toutes les commandes de zones
     std::vector<const T_MdlCommand*> m_vCmdArea;
 
-    /// lien entre les indices de sommet du modèle et le Geom::Vertex correspondant
-    std::map<uint, Geom::Vertex*> m_cor_ptId_vertex;
+    /// indice dans m_vCmdSup de chacun des supports suivant son nom
+    std::map<std::string, uint> m_cor_name_supId;
+
+    /// pour chaque support, les indices des points qui y sont posés
+    std::vector<std::vector<uint> > m_sup_ptIds;
+
+    /// lien entre les indices de sommet du modèle et le Geom::Vertex correspondant (0 si non créé)
+    std::vector<Geom::Vertex*> m_cor_ptId_vertex;
 
     /// lien entre un nom de contour et la Curve correspondante
     std::map<std::string, Geom::Curve*> m_cor_name_curve;
@@ -114,8 +125,8 @@ protected:
     /// marqueur des Support de ligne utilisé
     std::map<std::string, uint> m_filtre_support;
 
-    /// lien entre les indices de sommet du modèle et le Topo::Vertex correspondant
-    std::map<uint, Topo::Vertex*> m_cor_ptId_topoVertex;
+    /// lien entre les indices de sommet du modèle et le Topo::Vertex correspondant (0 si non créé)
+    std::vector<Topo::Vertex*> m_cor_ptId_topoVertex;
 
     /// lien entre un nom de contour et l'arête commune associée
     std::map<std::string, Topo::CoEdge*> m_cor_name_coedge;
@@ -8,8 +8,13 @@
 #include <TkUtil/Mutex.h>
 /*----------------------------------------------------------------------------*/
 #include <sys/types.h>
-#include <vector>
+#include <atomic>
+#include <list>
 #include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 
@@ -37,6 +42,14 @@ namespace Internal {
    On y trouve les listes d'entités crées, modifiées et détruites.
    On y distingue chacun des grands types (Geom, Topo, Mesh et Group)
 
+   Les entités topologiques, les plus nombreuses, sont enregistrées sans
+   verrou commun : le type de modification est porté par l'entité elle-même
+   (estampille propre à chaque InfoCommand, cf TopoEntity::getInfoCommandStamp)
+   et les nouvelles entités sont ajoutées à un tampon propre à chaque thread.
+   Ces tampons sont reportés dans une liste unique lors du premier accès en
+   lecture (en général à la fin de la commande), accès qui ne doit donc pas
+   être concurrent avec des ajouts.
+
  */
 class InfoCommand {
 public:
@@ -144,11 +157,26 @@ public:
     std::vector<GeomEntityInfo>& getGeomInfoEntities() {return m_geom_entities_info;}
     const std::vector<GeomEntityInfo>& getGeomInfoEntities() const {return m_geom_entities_info;}
 
-    /// accès aux entités topologique concernées par une modification et au type de modification
-    std::map<Topo::TopoEntity*, type>& getTopoInfoEntity() {return m_topo_entities_info;}
-    const std::map<Topo::TopoEntity*, type>& getTopoInfoEntity() const {return m_topo_entities_info;}
+    /** accès aux entités topologique concernées par une modification et au type de modification, dans l'ordre d'ajout
+     *
+     *  \warning les tampons des threads sont reportés dans la liste retournée
+     *  lors de l'appel : celle-ci ne doit pas être parcourue pendant que
+     *  d'autres threads ajoutent des entités (addTopoInfoEntity) à cette
+     *  InfoCommand, un report ultérieur pouvant la réallouer. Un parcours
+     *  par indice ne l'évite pas.
+     */
+    std::vector<TopoEntityInfo>& getTopoInfoEntity();
+    const std::vector<TopoEntityInfo>& getTopoInfoEntity() const;
     std::vector<InfoCommand::TopoEntityInfo> getSortedTopoInfoEntity();
 
+    /// type de modification d'une entité topologique, UNITIALIZED si elle n'est pas concernée
+    type getTopoInfoEntityType(Topo::TopoEntity* entity);
+
+    /** retire des entités topologiques de la liste, ces entités pouvant être
+     *  déjà détruites
+     */
+    void removeTopoInfoEntities(const std::vector<Topo::TopoEntity*>& entities);
+
     /// accès aux entités de maillage concernées par une modification et au type de modification
     void getMeshInfoEntity(uint ind, Mesh::MeshEntity* &entity, type &t);
     std::vector <MeshEntityInfo>&  getMeshInfoEntities() {return m_mesh_entities_info;}
@@ -199,21 +227,52 @@ protected:
 
 private:
 
+    /// tampon d'entités topologiques nouvellement concernées, propre à un thread
+    struct TopoBuffer {
+        std::thread::id m_thread_id;
+        std::mutex m_mutex;
+        std::vector<Topo::TopoEntity*> m_entities;
+    };
+
+    /// nouvelle estampille, unique pour toutes les InfoCommand
+    static unsigned long long newSerial();
+
+    /// le tampon du thread courant pour cette InfoCommand
+    TopoBuffer& getThreadTopoBuffer();
+
+    /// report des tampons dans m_topo_entities_info, m_mutex doit être pris
+    void mergeTopoBuffers();
+
     /// Mutex pour protéger les les accès concurrents.
     TkUtil::Mutex	m_mutex;
 
+    /// estampille de l'InfoCommand pour les entités topologiques
+    unsigned long long m_serial;
+
+    /// tampons des threads ayant ajouté des entités topologiques
+    std::list<TopoBuffer> m_topo_buffers;
+
+    /// vrai si des entités topologiques sont en attente dans les tampons
+    std::atomic<bool> m_topo_buffers_used;
+
     /// Type, lorsque cela concerne le contexte.
     type	m_context_type;
 
     /// ensemble des entités géométriques concernées par la commande et type de modification
     std::vector <GeomEntityInfo> m_geom_entities_info;
 
+    /// types de modification déjà enregistrés pour chaque entité géométrique (un bit par type)
+    std::unordered_map<Geom::GeomEntity*, uint> m_geom_entities_types;
+
     /// ensemble des entités topologiques concernées par la commande et type de modification
-    std::map<Topo::TopoEntity*, type> m_topo_entities_info;
+    std::vector <TopoEntityInfo> m_topo_entities_info;
 
     /// ensemble des entités de maillage concernées par la commande et type de modification
     std::vector <MeshEntityInfo> m_mesh_entities_info;
 
+    /// indice dans m_mesh_entities_info de chaque entité de maillage
+    std::unordered_map<Mesh::MeshEntity*, uint> m_mesh_entities_index;
+
     /// ensemble des entités de type groupe concernées par la commande et type de modification
     std::map<Group::GroupEntity*, type> m_group_entities_info;
 
@@ -45,8 +45,12 @@ public:
     /*------------------------------------------------------------------------*/
     /** \brief création d'une commande longue, pour tester l'interuption
      *
+     *  \param les ressources qu'elle déclare lire et modifier (combinaison
+     *         de valeurs Command::RESOURCE), pour tester l'exécution
+     *         simultanée de commandes indépendantes
      */
-    Mgx3D::Internal::M3DCommandResult* newLongCommand();
+    Mgx3D::Internal::M3DCommandResult* newLongCommand(
+            unsigned long resources = Utils::Command::ALL_RESOURCES);
 
     /*------------------------------------------------------------------------*/
     /** \brief création d'une commande longue non inyterruptible (pour tests).
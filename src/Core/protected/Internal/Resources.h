@@ -324,6 +324,13 @@ class Resources
 	 */
 	Preferences::BoolNamedValue					_useDisplayList;
 
+	/**
+	 * Si <I>true</I> les représentations filaires des entités géométriques et topologiques non sélectionnées sont regroupées, par type
+	 * d'entité, dans un unique acteur <I>VTK</I>. Réduit fortement le nombre d'acteurs, et donc les temps d'affichage, lorsque de très
+	 * nombreuses entités sont affichées.
+	 */
+	Preferences::BoolNamedValue					_batchedWireRepresentations;
+
 	/**
 	 * Si <I>true</I> les évènements claviers de repositionnement dans un plan xOy, xOz, yOz provoquent également une annulation du roulis.
 	 */
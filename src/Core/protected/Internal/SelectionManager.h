@@ -6,7 +6,10 @@
 
 #include <TkUtil/Mutex.h>
 
+#include <list>
+#include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <sys/types.h>
 
@@ -273,6 +276,40 @@ class SelectionManager
 	 * qu'il est oté de la sélection.
 	 */
 	virtual void clearSelection ( );
+
+	/**
+	 * Classe permettant de regrouper les notifications faites aux
+	 * observateurs durant une action utilisateur composée de plusieurs
+	 * modifications de la sélection (ex : <I>clearSelection</I> suivi d'un
+	 * <I>addToSelection</I>). A la destruction de la dernière instance les
+	 * observateurs reçoivent une seule notification portant sur le bilan
+	 * des entités ajoutées et enlevées.
+	 * \see	lockNotifications
+	 */
+	class NotificationLocker
+	{
+		public :
+
+		NotificationLocker (SelectionManager& selectionManager);
+		~NotificationLocker ( );
+
+
+		private :
+
+		NotificationLocker (const NotificationLocker&);
+		NotificationLocker& operator = (const NotificationLocker&);
+
+		SelectionManager&		_selectionManager;
+	};	// class NotificationLocker
+
+	/**
+	 * Suspend (<I>true</I>) ou rétablit (<I>false</I>) la notification des
+	 * modifications de la sélection aux observateurs. Les appels peuvent
+	 * être imbriqués, les modifications cumulées sont notifiées lors du
+	 * dernier rétablissement.
+	 * \see	NotificationLocker
+	 */
+	virtual void lockNotifications (bool lock);
 	
 	/**
 	 * Annule la dernière opération de sélection.
@@ -502,9 +539,60 @@ class SelectionManager
 	virtual void printActionsStack (std::ostream& stream) const;
 	//@}	// Les actions directes sur la sélection
 
+	/**
+	 * Informe les observateurs que les entités reçues en argument ont été
+	 * enlevées puis ajoutées à la sélection, ou cumule ces modifications si
+	 * les notifications sont suspendues.
+	 * \param	Entités enlevées de la sélection
+	 * \param	Entités ajoutées à la sélection
+	 * \param	<I>true</I> s'il s'agit d'un <I>clearSelection</I>
+	 * \see	lockNotifications
+	 */
+	virtual void notifyObservers (const std::vector<Mgx3D::Utils::Entity*>& removed, const std::vector<Mgx3D::Utils::Entity*>& added, bool clear);
+
 
 	private :
 
+	/**
+	 * Ensemble d'entités conservant l'ordre d'insertion, avec test
+	 * d'appartenance, ajout et retrait en temps constant.
+	 */
+	class OrderedEntities
+	{
+		public :
+
+		OrderedEntities ( );
+		OrderedEntities (const OrderedEntities&);
+		OrderedEntities& operator = (const OrderedEntities&);
+
+		bool contains (const Mgx3D::Utils::Entity* entity) const;
+		/** \return	<I>true</I> si l'entité a été ajoutée, <I>false</I> si elle était déjà présente. */
+		bool insert (Mgx3D::Utils::Entity* entity);
+		/** \return	<I>true</I> si l'entité a été enlevée, <I>false</I> si elle était absente. */
+		bool erase (const Mgx3D::Utils::Entity* entity);
+		void clear ( );
+		size_t size ( ) const
+		{ return _list.size ( ); }
+		bool empty ( ) const
+		{ return _list.empty ( ); }
+		const std::list<Mgx3D::Utils::Entity*>& items ( ) const
+		{ return _list; }
+		std::vector<Mgx3D::Utils::Entity*> toVector ( ) const;
+
+
+		private :
+
+		std::list<Mgx3D::Utils::Entity*>		_list;
+		std::unordered_map<const Mgx3D::Utils::Entity*, std::list<Mgx3D::Utils::Entity*>::iterator>	_index;
+	};	// class OrderedEntities
+
+	/**
+	 * Ajoute (resp. enlève) l'entité de la sélection et de la liste de son type.
+	 * \return	<I>true</I> si la sélection est modifiée.
+	 */
+	bool insertEntity (Mgx3D::Utils::Entity* entity);
+	bool eraseEntity (const Mgx3D::Utils::Entity* entity);
+
 	/**
 	 * Constructeur de copie : interdit.
 	 */
@@ -518,8 +606,17 @@ class SelectionManager
 	/** Le nom unique du gestionnaire de sélection. */
 	std::string												_name;
 
-	/** Les entités de la sélection. */
-	std::vector<Mgx3D::Utils::Entity*>						_entities;
+	/** Les entités de la sélection, dans l'ordre de sélection. */
+	OrderedEntities											_entities;
+
+	/** Les entités de la sélection, par type. */
+	std::map<Mgx3D::Utils::Entity::objectType, OrderedEntities>	_entitiesByType;
+
+	/** Niveau d'imbrication de la suspension des notifications, et bilan
+	 * des modifications non encore notifiées. */
+	size_t													_notificationsLock;
+	OrderedEntities											_pendingAdded, _pendingRemoved;
+	bool													_pendingClear;
 
 	/** Les observateurs de la sélection. */
 	std::vector<Mgx3D::Internal::SelectionManagerObserver*>	_observers;
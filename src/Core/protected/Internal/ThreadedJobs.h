@@ -0,0 +1,55 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file ThreadedJobs.h
+ *
+ *  \date 19 oct. 2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef INTERNAL_THREADED_JOBS_H_
+#define INTERNAL_THREADED_JOBS_H_
+/*----------------------------------------------------------------------------*/
+#include <functional>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Internal {
+/*----------------------------------------------------------------------------*/
+/**
+ * Exécute des travaux indépendants les uns des autres.
+ *
+ * Les travaux sont répartis entre le thread appelant et des threads propres
+ * à l'appel s'il y en a plusieurs, si la machine a plusieurs coeurs et si les
+ * commandes sont autorisées à utiliser des tâches parallèles
+ * (Resources::_allowThreadedCommandTasks). Ils sont sinon exécutés les uns
+ * après les autres dans le thread appelant. Seuls les travaux transmis sont
+ * attendus, pas ceux des autres commandes confiés au pool de threads de
+ * TkUtil (ThreadPool::barrier).
+ *
+ * \exception	TkUtil::Exception	regroupant les messages d'erreur de tous
+ *				les travaux en échec, levée une fois tous les travaux terminés.
+ */
+void runThreadedJobs (const std::vector<std::function<void()> >& jobs);
+
+/**
+ * Découpe [0, nb[ en tranches consécutives et exécute job (first, last) pour
+ * chacune d'elles via runThreadedJobs.
+ *
+ * \param	nb				nombre d'éléments à traiter
+ * \param	minItemsPerJob	taille minimale d'une tranche, en deçà de laquelle
+ *							le coût du parallélisme n'est pas rentabilisé
+ * \param	jobsPerThread	nombre de tranches visé par thread (plus d'une pour
+ *							équilibrer la charge lorsque le coût varie d'un
+ *							élément à l'autre)
+ * \param	job				traitement des éléments [first, last[, les
+ *							tranches pouvant être traitées en même temps
+ */
+void runThreadedRanges (size_t nb, size_t minItemsPerJob, size_t jobsPerThread,
+		const std::function<void(size_t, size_t)>& job);
+/*----------------------------------------------------------------------------*/
+} // end namespace Internal
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* INTERNAL_THREADED_JOBS_H_ */
+/*----------------------------------------------------------------------------*/
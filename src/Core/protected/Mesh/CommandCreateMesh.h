@@ -66,6 +66,28 @@ public:
     /** Ce qui est fait après la commande suivant le cas en erreur ou non
      */
     virtual void postExecute(bool hasError);
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  ressources accédées : la géométrie est lue (projections),
+     *          la topologie (données de maillage), le maillage, les groupes
+     *          et les noms sont modifiés.
+     */
+    virtual unsigned long getReadResources ( ) const
+        { return Utils::Command::GEOMETRY | getWrittenResources ( ); }
+    virtual unsigned long getWrittenResources ( ) const
+        { return Utils::Command::TOPOLOGY | Utils::Command::MESH
+               | Utils::Command::GROUPS | Utils::Command::SESSION; }
+
+    /*------------------------------------------------------------------------*/
+    /// Mémoire occupée par les identifiants des entités créées (pour l'annulation)
+    virtual size_t getUndoMemorySize() const
+    {return sizeof(gmds::TCellID)*(m_created_nodes.capacity()+m_created_edges.capacity()
+    		+m_created_faces.capacity()+m_created_regions.capacity());}
+
+    /// Le destructeur détruit les groupes de maillage créés, la commande effectuée doit rester dans la pile
+    virtual bool isDroppableFromUndoStack() const
+    {return false;}
+
     /*------------------------------------------------------------------------*/
     /// Accesseur sur le vecteur des noeuds créés par la commande
     std::vector<gmds::TCellID>& createdNodes() {return m_created_nodes;}
@@ -183,6 +205,8 @@ protected:
     void mesh(std::vector<Topo::Block* >& blocs);
     /// Création du maillage pour un bloc
     void mesh(Topo::Block* & bloc);
+    /// Création en une fois du maillage des blocs tétraédrisés par Tetgen parmi ceux transmis
+    void meshDelaunayTetgen(const std::vector<Topo::Block*>& blocs);
     /// Création des points du maillage pour les blocs transmis en argument.
     void preMesh(const std::vector<Topo::Block*>& blocks);
     /// Création des points du maillage pour un bloc
@@ -192,6 +216,8 @@ protected:
     void mesh(std::vector<Topo::CoFace* >& faces);
     /// Création du maillage pour une face
     void mesh(Topo::CoFace* face);
+    /// Création en une fois du maillage des faces triangulées par GMSH parmi celles transmises
+    void meshDelaunayGMSH(const std::vector<Topo::CoFace*>& faces);
     /// Création des points du maillage pour les faces transmises en argument.
     void preMesh(const std::vector<Topo::CoFace*>& faces);
     /// Création des points du maillage pour une face
@@ -55,6 +55,14 @@ public:
     /** Ce qui est fait de propre à la commande pour rejouer une commande */
     virtual void internalRedo(){}
 
+    /*------------------------------------------------------------------------*/
+    /** \brief  ressources lues : la topologie, le maillage et les groupes, rien n'est modifié.
+     */
+    virtual unsigned long getReadResources ( ) const
+        { return Utils::Command::TOPOLOGY | Utils::Command::MESH | Utils::Command::GROUPS; }
+    virtual unsigned long getWrittenResources ( ) const
+        { return Utils::Command::NO_RESOURCE; }
+
 
 protected:
 
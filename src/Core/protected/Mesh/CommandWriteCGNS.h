@@ -42,6 +42,14 @@ public:
 	 */
 	void internalRedo();
 
+	/*------------------------------------------------------------------------*/
+	/** \brief  ressources lues : le maillage, les groupes et la topologie, rien n'est modifié.
+	 */
+	virtual unsigned long getReadResources ( ) const
+		{ return Utils::Command::TOPOLOGY | Utils::Command::MESH | Utils::Command::GROUPS; }
+	virtual unsigned long getWrittenResources ( ) const
+		{ return Utils::Command::NO_RESOURCE; }
+
 private:
 	/// nom du fichier pour la sauvegarde
 	std::string m_file_name;
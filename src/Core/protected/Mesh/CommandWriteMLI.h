@@ -42,6 +42,14 @@ public:
 	 */
 	void internalRedo();
 
+	/*------------------------------------------------------------------------*/
+	/** \brief  ressources lues : le maillage et les groupes, rien n'est modifié.
+	 */
+	virtual unsigned long getReadResources ( ) const
+		{ return Utils::Command::MESH | Utils::Command::GROUPS; }
+	virtual unsigned long getWrittenResources ( ) const
+		{ return Utils::Command::NO_RESOURCE; }
+
 private:
 	/// nom du fichier pour la sauvegarde
 	std::string m_file_name;
@@ -24,8 +24,9 @@ public:
      *
      *  \param c le contexte
      *  \param nom le fichier dans lequel on effectue la sauvegarde
+     *  \param compressed compression zlib des données (format vtu uniquement)
      */
-	CommandWriteVTK(Internal::Context& c, std::string& nom);
+	CommandWriteVTK(Internal::Context& c, std::string& nom, bool compressed = false);
 
 
 	/*------------------------------------------------------------------------*/
@@ -42,9 +43,20 @@ public:
 	 */
 	void internalRedo();
 
+	/*------------------------------------------------------------------------*/
+	/** \brief  ressources lues : le maillage et les groupes, rien n'est modifié.
+	 */
+	virtual unsigned long getReadResources ( ) const
+		{ return Utils::Command::MESH | Utils::Command::GROUPS; }
+	virtual unsigned long getWrittenResources ( ) const
+		{ return Utils::Command::NO_RESOURCE; }
+
 private:
 	/// nom du fichier pour la sauvegarde
 	std::string m_file_name;
+
+	/// compression des données
+	bool m_compressed;
 };
 /*----------------------------------------------------------------------------*/
 } // end namespace Mesh
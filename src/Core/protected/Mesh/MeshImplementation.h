@@ -134,8 +134,11 @@ public:
     /// Lecture d'un maillage au format vtk (vtk vtp vtu)
     virtual void readVTK(std::string nom, uint id);
 
-    /// Sauvegarde d'un maillage au format vtk (vtk vtp vtu)
-    virtual void writeVTK(std::string nom);
+    /** Sauvegarde d'un maillage au format vtk (vtk vtp vtu). Le format vtu est
+     *  écrit en binaire avec les groupes de maillage (cf VTUWriter), compressé
+     *  par zlib si compressed est vrai
+     */
+    virtual void writeVTK(std::string nom, bool compressed);
 
     /// Lecture d'un maillage au format lima (mli) (dans le gmds mesh d'id)
     virtual void readMli(std::string nom, uint id);
@@ -220,6 +223,12 @@ private:
     /// Création d'un maillage tétraédrique de Delaunay pour un bloc (version Tetgen)
     virtual void meshDelaunayTetgen(Mesh::CommandCreateMesh* command, Topo::Block* b);
 
+    /** Création des maillages tétraédriques de Delaunay de blocs (version Tetgen),
+     *  chaque bloc étant tétraédrisé par sa propre instance de Tetgen. Tetgen
+     *  n'étant pas réentrant, les blocs sont tétraédrisés les uns après les autres.
+     */
+    virtual void meshDelaunayTetgen(Mesh::CommandCreateMesh* command, std::vector<Topo::Block*>& blocks);
+
     /// Création des points d'un maillage transfini pour une face commune
     virtual void preMeshStructured(Topo::CoFace* fa);
 
@@ -229,6 +238,16 @@ private:
     /// Création d'un maillage triangulaire de Delaunay pour une face commune (version GMSH)
     virtual void meshDelaunayGMSH(Mesh::CommandCreateMesh* command, Topo::CoFace* fa);
 
+    /** Création des maillages triangulaires de Delaunay de faces communes (version GMSH),
+     *  regroupées en un minimum de modèles GMSH (un par jeu de tailles)
+     */
+    virtual void meshDelaunayGMSH(Mesh::CommandCreateMesh* command, std::vector<Topo::CoFace*>& cofaces);
+
+    /** Maillage par GMSH d'un lot de faces communes de mêmes tailles et sans surface
+     *  commune, en imposant la discrétisation du bord (sans opération booléenne)
+     */
+    void meshDelaunayGMSHBatch(Mesh::CommandCreateMesh* command, std::vector<Topo::CoFace*>& cofaces);
+
     /** Création des coordonnées internes d'un quadrangle déformé, par méthode transfinie
         @param nbBrasI nombre de bras dans la première direction pour ce contour
         @param nbBrasJ nombrede bras  dans la deuxième direction pour ce contour
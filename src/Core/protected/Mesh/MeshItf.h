@@ -107,8 +107,8 @@ public:
     /// Lecture d'un maillage au format vtk (vtk vtp vtu)
     virtual void readVTK(std::string nom, uint id) =0;
 
-    /// Sauvegarde d'un maillage au format vtk (vtk vtp vtu)
-    virtual void writeVTK(std::string nom) =0;
+    /// Sauvegarde d'un maillage au format vtk (vtk vtp vtu), compressée si possible (vtu)
+    virtual void writeVTK(std::string nom, bool compressed) =0;
 
     /// Lecture d'un maillage au format lima (mli)
     virtual void readMli(std::string nom, uint id) =0;
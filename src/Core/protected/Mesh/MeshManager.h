@@ -91,8 +91,13 @@ public:
 	SET_SWIG_COMPLETABLE_METHOD(writeMli)
 
     /*------------------------------------------------------------------------*/
-    /// Sauvegarde d'un maillage au format vtk (vtk vtp vtu)
-    void writeVTK(std::string nom);
+    /** Sauvegarde d'un maillage au format vtk (vtk vtp vtu)
+     *
+     *  \param nom le fichier, au format vtu le maillage est écrit en binaire
+     *  avec un tableau par groupe de maillage
+     *  \param compressed compression zlib des données (format vtu uniquement)
+     */
+    void writeVTK(std::string nom, bool compressed = false);
 	SET_SWIG_COMPLETABLE_METHOD(writeVTK)
 
     /*------------------------------------------------------------------------*/
@@ -113,7 +118,7 @@ public:
     void smooth();
 
     /*------------------------------------------------------------------------*/
-    /// Compare le maillage actuel avec un maillage sur disque, return true si ok
+    /// Compare le maillage actuel avec un maillage sur disque (mli ou vtu), return true si ok
     bool compareWithMesh(std::string nom);
 	SET_SWIG_COMPLETABLE_METHOD(compareWithMesh)
 
@@ -209,6 +214,25 @@ public:
     std::string getInfos(const std::string& name, int dim) const;
 	SET_SWIG_COMPLETABLE_METHOD(getInfos)
 
+#ifndef SWIG
+    /*------------------------------------------------------------------------*/
+    /** \brief  Accès en bloc aux noeuds et aux mailles d'un groupe de maillage
+     *
+     *  Les noeuds sont numérotés localement (de 0 à n-1) dans l'ordre de leur
+     *  première apparition dans les mailles.
+     *
+     *  \param name le nom de la Surface (dim == 2) ou du Volume (dim == 3)
+     *  \param dim la dimension du groupe
+     *  \param coords en retour, les coordonnées (x0, y0, z0, x1, ...) des noeuds
+     *  \param cells en retour, pour chaque maille son nombre de noeuds suivi des
+     *  indices locaux de ces noeuds (même convention que les cellules VTK)
+     *  \param gmdsIds en retour (si non nul), l'id GMDS de chacun des noeuds
+     */
+    void getNodesAndCells(const std::string& name, int dim,
+            std::vector<double>& coords, std::vector<long>& cells,
+            std::vector<long>* gmdsIds = 0) const;
+#endif
+
 #ifndef SWIG
     std::string getInfos(const Cloud* me) const;
     std::string getInfos(const Surface* me) const;
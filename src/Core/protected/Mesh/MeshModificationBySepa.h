@@ -70,7 +70,10 @@ public:
 	 */
 	virtual void addToDescription (Mgx3D::Utils::SerializedRepresentation* description) const;
 
-	std::map<gmds::Node,double>& getDeltas();
+	/** Les deltas calculés par applyModification, le i-ème correspondant au
+	 *  i-ème noeud transmis (numérotation compacte des noeuds perturbés)
+	 */
+	const std::vector<double>& getDeltas() const;
 
 	/** Script pour la commande de création Python */
 	virtual TkUtil::UTF8String getScriptCommand() const;
@@ -99,8 +102,9 @@ private:
 	// centre de la séparatrice
 	Utils::Math::Point m_center;
 
-	// deltas associated to nodes
-	std::map<gmds::Node,double> m_deltas;
+	// deltas associated to nodes, m_deltas[i] is the delta of the i-th node
+	// given to the last call to applyModification
+	std::vector<double> m_deltas;
 
 	// faces of the separatrice, used only for vtk outputs
 	std::vector<gmds::Face> m_faces;
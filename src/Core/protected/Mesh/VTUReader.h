@@ -0,0 +1,61 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file VTUReader.h
+ *
+ *  \date 19 oct. 2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef MGX3D_MESH_VTUREADER_H_
+#define MGX3D_MESH_VTUREADER_H_
+/*----------------------------------------------------------------------------*/
+#include "Utils/Common.h"
+/*----------------------------------------------------------------------------*/
+#include <gmds/ig/Mesh.h>
+/*----------------------------------------------------------------------------*/
+#include <string>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+/** \class VTUReader
+ *  \brief Lecture d'un maillage au format VTK XML non structuré (vtu) dont
+ *  les tableaux sont en binaire à la suite de l'en-tête XML (AppendedData
+ *  brut, compressé ou non par zlib), tel qu'écrit par VTUWriter.
+ *
+ *  Les noeuds et les mailles sont créés dans l'ordre du fichier. Les
+ *  tableaux de la section FieldData portant l'attribut Mgx3DGroup donnent,
+ *  sous forme d'intervalles d'indices, les groupes GMDS (nuages, lignes,
+ *  surfaces et volumes), les autres sont ignorés.
+ *
+ *  Les tailles annoncées par le fichier (nombres d'entités, positions et
+ *  en-têtes des tableaux) sont vérifiées avant toute allocation.
+ */
+/*----------------------------------------------------------------------------*/
+class VTUReader {
+public:
+    /// constructeur avec le maillage à compléter
+    VTUReader(gmds::Mesh& mesh);
+
+    ~VTUReader() {}
+
+    /// lecture du fichier nom
+    void read(const std::string& nom);
+
+private:
+
+    VTUReader(const VTUReader& r) : m_gmds_mesh(r.m_gmds_mesh)
+    { MGX_FORBIDDEN("VTUReader::VTUReader is not allowed."); }
+    VTUReader& operator = (const VTUReader&)
+    { MGX_FORBIDDEN("VTUReader::operator = is not allowed."); return *this; }
+
+    /// le maillage
+    gmds::Mesh& m_gmds_mesh;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* MGX3D_MESH_VTUREADER_H_ */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,84 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file VTUWriter.h
+ *
+ *  \date 19 oct. 2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef MGX3D_MESH_VTUWRITER_H_
+#define MGX3D_MESH_VTUWRITER_H_
+/*----------------------------------------------------------------------------*/
+#include "Utils/Common.h"
+/*----------------------------------------------------------------------------*/
+#include <gmds/ig/Mesh.h>
+/*----------------------------------------------------------------------------*/
+#include <string>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Internal {
+class Context;
+}
+/*----------------------------------------------------------------------------*/
+namespace Mesh {
+/*----------------------------------------------------------------------------*/
+/** \class VTUWriter
+ *  \brief Sauvegarde du maillage au format VTK XML non structuré (vtu),
+ *  les tableaux étant écrits en binaire à la suite de l'en-tête XML
+ *  (AppendedData brut), éventuellement compressés par blocs avec zlib.
+ *
+ *  Tous les noeuds, bras, polygones et polyèdres sont écrits, dans l'ordre
+ *  de GMDS. Chaque groupe de maillage est un tableau d'entiers (UInt8) de
+ *  la section PointData (nuages) ou CellData (lignes, surfaces et volumes)
+ *  valant 1 pour ses noeuds ou ses mailles et 0 ailleurs, nommé comme lui
+ *  (suffixé par son type si un groupe de mailles d'une autre dimension
+ *  porte le même nom). Les groupes sont aussi des tableaux de la section
+ *  FieldData donnant les intervalles [début, fin[ des indices de leurs
+ *  noeuds ou mailles, l'attribut Mgx3DGroup en donnant le type : seuls ces
+ *  derniers sont relus (cf VTUReader).
+ *
+ *  Les tableaux ne sont pas assemblés en mémoire : leurs valeurs sont
+ *  calculées, compressées et écrites par tranches de quelques blocs, en
+ *  parallèle si les commandes sont autorisées à utiliser plusieurs threads.
+ *  Les positions des tableaux dans les données ajoutées sont reportées dans
+ *  l'en-tête XML une fois ces données écrites.
+ */
+/*----------------------------------------------------------------------------*/
+class VTUWriter {
+public:
+    /** \brief  Constructeur
+     *
+     *  \param context le contexte, pour les groupes de maillage
+     *  \param mesh le maillage à sauvegarder
+     *  \param compressed vrai pour compresser les tableaux avec zlib
+     */
+    VTUWriter(Internal::Context* context, gmds::Mesh& mesh, bool compressed);
+
+    ~VTUWriter() {}
+
+    /// sauvegarde dans le fichier nom
+    void write(const std::string& nom);
+
+private:
+
+    VTUWriter(const VTUWriter& w) : m_context(w.m_context), m_gmds_mesh(w.m_gmds_mesh), m_compressed(w.m_compressed)
+    { MGX_FORBIDDEN("VTUWriter::VTUWriter is not allowed."); }
+    VTUWriter& operator = (const VTUWriter&)
+    { MGX_FORBIDDEN("VTUWriter::operator = is not allowed."); return *this; }
+
+    /// le contexte
+    Internal::Context* m_context;
+
+    /// le maillage
+    gmds::Mesh& m_gmds_mesh;
+
+    /// compression zlib des tableaux
+    bool m_compressed;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Mesh
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* MGX3D_MESH_VTUWRITER_H_ */
+/*----------------------------------------------------------------------------*/
@@ -2,8 +2,10 @@
 #define _MEMENTO_SERVICE_H_
 
 #include <map>
+#include <string>
 #include <vector>
 #include <TopoDS_Shape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include "Group/GroupEntity.h"
 namespace Mgx3D
 {
@@ -72,8 +74,34 @@ namespace Mgx3D::Services
         const Memento createMemento(const Geom::GeomEntity *e) const;
         void saveMemento(Geom::GeomEntity *e, const Memento &mem);
         void saveMemento(Geom::GeomEntity *e) { saveMemento(e, createMemento(e)); }
+        /** permute les mémentos avec l'état courant des entités. Les formes
+         * OCC préalablement déchargées sur disque sont rechargées au besoin */
         void permMementos();
 
+        /** estimation (en octets) de la mémoire occupée par les mémentos.
+         * Les formes OCC partagées entre plusieurs mémentos (une arête commune
+         * à 2 faces par exemple) ne sont comptées qu'une fois. */
+        size_t getMemorySize() const;
+
+        /** écrit les formes OCC des mémentos dans un fichier BRep binaire et
+         * les libère. Les liens de partage entre ces formes sont préservés
+         * par le fichier. Les sous-formes partagées avec les entités
+         * géométriques (une arête commune avec une face voisine non modifiée
+         * par exemple) sont conservées en mémoire et substituées à leur copie
+         * lors du rechargement, afin que les formes rechargées restent
+         * IsSame avec celles des entités.
+         * \return false si rien n'a été déchargé */
+        bool spill(const std::string &fileName);
+
+        /** recharge les formes OCC écrites par spill, et détruit le fichier */
+        void restore();
+
+        /** \return true si les formes OCC sont déchargées sur disque */
+        bool isSpilled() const { return !m_spill_file.empty(); }
+
+        /** détruit l'éventuel fichier de déchargement */
+        ~MementoService();
+
     private:
         void setFromMemento(Geom::GeomEntity *e, const Memento &mem);
 
@@ -81,6 +109,21 @@ namespace Mgx3D::Services
          * stocke leur "état interne" sous forme de mémento. Ce stockage est de la
          * responsabilité de chaque entité */
         std::map<Geom::GeomEntity *, Memento> m_mementos;
+
+        /** fichier où sont déchargées les formes OCC, vide si elles sont en
+         * mémoire */
+        std::string m_spill_file;
+
+        /** nombre de formes OCC de chaque mémento (dans l'ordre de m_mementos)
+         * au moment du déchargement */
+        std::vector<size_t> m_spill_counts;
+
+        /** sous-formes des mémentos déchargés partagées avec les entités
+         * géométriques, écrites à la suite des mémentos */
+        TopTools_IndexedMapOfShape m_spill_shared;
+
+        /** taille calculée par getMemorySize, 0 si à recalculer */
+        mutable size_t m_memory_size = 0;
     };
 }
 
@@ -135,6 +135,11 @@ public:
     		std::vector<Block* > & newBlocs,
             Internal::InfoCommand* icmd);
 
+    /** Recherche pour extendSplit l'arête transverse à l'arête déjà coupée
+     *  et le ratio (0 ou 1) qui place la coupe à leur sommet commun
+     */
+    void getExtendSplitCoEdge(CoEdge* arete, CoEdge* &coedge, double& ratio);
+
     /*------------------------------------------------------------------------*/
     /** Déraffine un bloc suivant une direction
      *
@@ -323,9 +328,11 @@ public:
 
     /** Accesseur sur la liste des noeuds gmds */
     std::vector<gmds::TCellID>& nodes() {return m_mesh_data->nodes();}
+    const std::vector<gmds::TCellID>& nodes() const {return getMeshingData()->nodes();}
 
     /** Accesseur sur la liste des polyêdres gmds */
-    std::vector<gmds::TCellID>& regions() {return m_mesh_data->regions();}
+    MeshCellIds& regions() {return m_mesh_data->regions();}
+    const MeshCellIds& regions() const {return getMeshingData()->regions();}
 
     /*------------------------------------------------------------------------*/
     //    /// retourne l'ensemble des arêtes pour une direction donnée
@@ -400,6 +407,7 @@ public:
 
     /// accesseur sur les propriétés de maillage
     BlockMeshingData* getMeshingData() {return m_mesh_data;}
+    const BlockMeshingData* getMeshingData() const {return m_mesh_data;}
 
     /*------------------------------------------------------------------------*/
     /** Transmet les propriétés sauvegardées
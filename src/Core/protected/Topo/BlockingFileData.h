@@ -0,0 +1,106 @@
+/*----------------------------------------------------------------------------*/
+#ifndef BLOCKINGFILEDATA_H
+#define BLOCKINGFILEDATA_H
+/*----------------------------------------------------------------------------*/
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Topo {
+/*----------------------------------------------------------------------------*/
+/**
+ * \class BlockingFileData
+ * \brief Contenu d'un fichier de blocs (Mgx DataFile) sous forme de tableaux
+ *        d'indices, indépendamment de la topologie.
+ *
+ *        Les entités sont référencées par leur indice dans le fichier (sommets,
+ *        arêtes communes, faces communes, blocs), les listes de longueur
+ *        variable étant stockées à plat avec un tableau de décalages.
+ *
+ *        Deux formats sont supportés, choisis suivant l'extension du fichier :
+ *        - .mgxt : format ASCII historique,
+ *        - .mgxb : format binaire little-endian, découpé en sections
+ *          (étiquette de 4 caractères et taille en octets) lues et écrites en
+ *          bloc. Un lecteur ignore les sections qu'il ne connait pas.
+ */
+class BlockingFileData
+{
+public:
+    /// Version du format binaire
+    static const unsigned int BINARY_VERSION = 1;
+
+    /** \return true si le nom de fichier a l'extension du format binaire (.mgxb) */
+    static bool isBinaryFileName(const std::string& fileName);
+
+    /** \return true si le nom de fichier a une extension de fichier de blocs
+     *          (.mgxt ou .mgxb) */
+    static bool isBlockingFileName(const std::string& fileName);
+
+    /** Lecture du fichier, au format déduit de son extension */
+    void read(const std::string& fileName, bool withGeom);
+
+    /** Ecriture du fichier, au format déduit de son extension */
+    void write(const std::string& fileName, bool withGeom) const;
+
+    void readASCII(std::istream& str, bool withGeom);
+    void writeASCII(std::ostream& str, bool withGeom) const;
+    void readBinary(std::istream& str, bool withGeom);
+    void writeBinary(std::ostream& str, bool withGeom) const;
+
+    /// Nombre d'entités
+    size_t getNbVertices() const {return m_points.size()/3;}
+    size_t getNbCoEdges() const {return m_edges.size()/2;}
+    size_t getNbCoFaces() const {return m_face_offsets.empty() ? 0 : (m_face_offsets.size()-1)/4;}
+    size_t getNbBlocks() const {return m_block_nodes.size()/8;}
+
+    /// coordonnées des sommets (3 par sommet)
+    std::vector<double> m_points;
+
+    /// indices des 2 sommets de chaque arête commune
+    std::vector<int> m_edges;
+
+    /** discrétisation de chaque arête commune : type (cf écriture), nombre de
+     *  bras et sous-type (pour l'interpolation 0 : arêtes, 1 : face ; pour
+     *  l'interpolation globale : nombre d'arêtes de la première liste) */
+    std::vector<int> m_discr_types;
+    std::vector<int> m_discr_nbs;
+    std::vector<int> m_discr_subtypes;
+    /// paramètres réels des discrétisations (décalages : nb arêtes + 1)
+    std::vector<int> m_discr_param_offsets;
+    std::vector<double> m_discr_params;
+    /// entités référencées par les interpolations (décalages : nb arêtes + 1)
+    std::vector<int> m_discr_ref_offsets;
+    std::vector<int> m_discr_refs;
+
+    /// arêtes communes des 4 côtés de chaque face commune (décalages : 4 nb faces + 1)
+    std::vector<int> m_face_offsets;
+    std::vector<int> m_face_edges;
+
+    /// indices des 8 sommets de chaque bloc
+    std::vector<int> m_block_nodes;
+    /// faces communes des 6 faces de chaque bloc (décalages : 6 nb blocs + 1)
+    std::vector<int> m_block_offsets;
+    std::vector<int> m_block_faces;
+
+    /** associations géométriques, par triplets (indice de l'entité,
+     *  dimension de l'entité géométrique, numéro de l'entité géométrique),
+     *  pour les sommets, arêtes, faces et blocs */
+    std::vector<int> m_assoc[4];
+
+private:
+    /** vérifie la cohérence des tableaux lus (tailles, décalages et indices),
+     *  lève une exception si le fichier est corrompu */
+    void check(bool withGeom) const;
+
+    /// ajoute les paramètres et références de la discrétisation courante
+    void closeDiscr();
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Topo
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif //BLOCKINGFILEDATA_H
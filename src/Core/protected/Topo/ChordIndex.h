@@ -0,0 +1,146 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file ChordIndex.h
+ *
+ *  \date 19 oct. 2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef CHORDINDEX_H_
+#define CHORDINDEX_H_
+/*----------------------------------------------------------------------------*/
+#include "Utils/Common.h"
+/*----------------------------------------------------------------------------*/
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Topo {
+class Block;
+class CoFace;
+class CoEdge;
+/*----------------------------------------------------------------------------*/
+/** \class ChordIndex
+ *  \brief Index des cordes et des feuillets de la topologie, tenu par le
+ *  TopoManager.
+ *
+ *  Une corde est une classe d'arêtes communes équivalentes pour la relation
+ *  "arête opposée dans une face commune structurée" (cf CoFace::getOppositeCoEdge).
+ *  Le feuillet associé est l'ensemble des blocs traversés par la corde.
+ *  Une colonne est la suite des faces communes opposées de proche en proche
+ *  dans des blocs à 6 faces communes, avec les blocs qu'elle traverse.
+ *
+ *  Les cordes, feuillets et colonnes sont calculés à la demande, une seule fois
+ *  pour toutes les entités qui les composent. Toute modification de la
+ *  topologie (cf topologyModified) invalide l'index.
+ */
+/*----------------------------------------------------------------------------*/
+class ChordIndex {
+
+public:
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Constructeur
+     */
+    ChordIndex();
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Destructeur
+     */
+    ~ChordIndex();
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Signale une modification de la topologie (connectivité ou
+     *  discrétisation), l'index sera reconstruit à la demande
+     */
+    void topologyModified()
+    { m_revision++; }
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Retourne la corde d'une arête commune
+     *
+     *  \param coedge l'arête de départ (en première position dans la corde)
+     *  \param coedges les arêtes de la corde
+     *  \param inverted pour chacune des arêtes, vrai si elle est orientée
+     *  en sens inverse de l'arête de départ
+     */
+    void getChord(CoEdge* coedge, std::vector<CoEdge*>& coedges,
+            std::vector<bool>& inverted);
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Retourne le feuillet des blocs traversés par la corde d'une arête
+     */
+    void getSheet(CoEdge* coedge, std::vector<Block*>& blocks);
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Retourne la colonne de faces communes et de blocs d'une face commune
+     */
+    void getColumn(CoFace* coface, std::vector<CoFace*>& cofaces,
+            std::vector<Block*>& blocks);
+
+private:
+
+    /// corde et feuillet associé
+    struct Chord {
+        /// les arêtes, celle ayant servi au parcours en premier
+        std::vector<CoEdge*> m_coedges;
+        /// sens de chacune des arêtes par rapport à la première
+        std::vector<bool> m_inverted;
+        /// les blocs traversés, calculés à la demande
+        std::vector<Block*> m_blocks;
+        bool m_sheetComputed;
+    };
+
+    /// colonne de faces communes
+    struct Column {
+        std::vector<CoFace*> m_cofaces;
+        std::vector<Block*> m_blocks;
+    };
+
+    /// vide l'index si la topologie a été modifiée depuis sa construction
+    void checkRevision();
+
+    /// retourne l'indice de la corde d'une arête, la construit si nécessaire
+    uint chordIndex(CoEdge* coedge);
+
+    /// retourne l'indice de la colonne d'une face, la construit si nécessaire
+    uint columnIndex(CoFace* coface);
+
+    /// la face opposée à une face commune dans un bloc à 6 faces communes, 0 sinon
+    static CoFace* getOppositeCoFace(Block* block, CoFace* coface);
+
+    ChordIndex(const ChordIndex&)
+    { MGX_FORBIDDEN("ChordIndex::ChordIndex is not allowed."); }
+    ChordIndex& operator = (const ChordIndex&)
+    { MGX_FORBIDDEN("ChordIndex::operator = is not allowed."); return *this; }
+
+    /// protection des accès concurrents (commandes et sélection)
+    std::mutex m_mutex;
+
+    /// nombre de modifications de la topologie signalées
+    std::atomic<unsigned long> m_revision;
+
+    /// valeur de m_revision lors de la construction de l'index
+    unsigned long m_indexRevision;
+
+    /// pour chaque arête indexée, indice de sa corde et position dans celle-ci
+    std::unordered_map<CoEdge*, std::pair<uint, uint> > m_coedge_chord;
+
+    /// les cordes construites
+    std::vector<Chord> m_chords;
+
+    /// pour chaque face commune indexée, indice de sa colonne
+    std::unordered_map<CoFace*, uint> m_coface_column;
+
+    /// les colonnes construites
+    std::vector<Column> m_columns;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Topo
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* CHORDINDEX_H_ */
+/*----------------------------------------------------------------------------*/
@@ -316,13 +316,15 @@ public:
             std::vector<gmds::Node> &nodes);
 
     /** Accesseur sur la liste des points */
-    const std::vector<Utils::Math::Point>& points() const {return m_mesh_data->points();}
+    const std::vector<Utils::Math::Point>& points() const {return getMeshingData()->points();}
 
     /** Accesseur sur la liste des noeuds gmds */
     std::vector<gmds::TCellID>& nodes() {return m_mesh_data->nodes();}
+    const std::vector<gmds::TCellID>& nodes() const {return getMeshingData()->nodes();}
 
     /** Accesseur sur la liste des bras gmds */
-    std::vector<gmds::TCellID>& edges() {return m_mesh_data->edges();}
+    MeshCellIds& edges() {return m_mesh_data->edges();}
+    const MeshCellIds& edges() const {return getMeshingData()->edges();}
 
     /*------------------------------------------------------------------------*/
     /** Retourne un vecteur avec les positions des noeuds qui seront créés
@@ -12,6 +12,7 @@
 /*----------------------------------------------------------------------------*/
 #include <gmds/utils/CommonTypes.h>
 
+#include "Topo/MeshCellIds.h"
 #include "Utils/Time.h"
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
@@ -41,9 +42,10 @@ public:
         CoEdgeMeshingData* emd = new CoEdgeMeshingData();
         emd->m_is_meshed = m_is_meshed;
         emd->m_is_premeshed = m_is_premeshed;
-        emd->m_nodes.insert(emd->m_nodes.end(), m_nodes.begin(), m_nodes.end());
-        emd->m_edges.insert(emd->m_edges.end(), m_edges.begin(), m_edges.end());
-        emd->m_points.insert(emd->m_points.end(), m_points.begin(), m_points.end());
+        // les listes sont partagées jusqu'à leur prochaine modification
+        emd->m_nodes = m_nodes;
+        emd->m_edges = m_edges;
+        emd->m_points = m_points;
         emd->m_points_time = m_points_time;
         return emd;
     }
@@ -63,10 +65,12 @@ public:
 
     /*------------------------------------------------------------------------*/
     /** Accesseur sur la liste des noeuds gmds */
-    std::vector<gmds::TCellID>& nodes() {return m_nodes;}
+    std::vector<gmds::TCellID>& nodes() {return m_nodes.edit();}
+    const std::vector<gmds::TCellID>& nodes() const {return m_nodes.get();}
 
     /** Accesseur sur la liste des bras gmds */
-    std::vector<gmds::TCellID>& edges() {return m_edges;}
+    MeshCellIds& edges() {return m_edges;}
+    const MeshCellIds& edges() const {return m_edges;}
 
    /*------------------------------------------------------------------------*/
     /// accesseur sur l'heure de mise à jour des points
@@ -78,7 +82,8 @@ public:
 private:
     /*------------------------------------------------------------------------*/
     /** Accesseur sur la liste des points */
-    std::vector<Utils::Math::Point>& points() {return m_points;}
+    std::vector<Utils::Math::Point>& points() {return m_points.edit();}
+    const std::vector<Utils::Math::Point>& points() const {return m_points.get();}
 
     /// Maillage associé créé ou non
     bool m_is_meshed;
@@ -87,13 +92,13 @@ private:
     mutable bool m_is_premeshed;
 
     /// Liste des noeuds (gmds) associés
-    std::vector<gmds::TCellID> m_nodes;
+    SharedVector<gmds::TCellID> m_nodes;
 
     /// Liste des bras (gmds) associés
-    std::vector<gmds::TCellID> m_edges;
+    MeshCellIds m_edges;
 
     /// Les points pour le maillage
-    std::vector<Utils::Math::Point> m_points;
+    SharedVector<Utils::Math::Point> m_points;
 
     /// Heure de la mise à jour des points
     mutable Utils::Time m_points_time;
@@ -368,11 +368,13 @@ public:
      /** Accesseur sur la liste des noeuds gmds */
 
     std::vector<gmds::TCellID>& nodes() { return m_mesh_data->nodes();}
+    const std::vector<gmds::TCellID>& nodes() const { return getMeshingData()->nodes();}
 
 
     /** Accesseur sur la liste des faces gmds */
 
-    std::vector<gmds::TCellID>& faces() {return m_mesh_data->faces();}
+    MeshCellIds& faces() {return m_mesh_data->faces();}
+    const MeshCellIds& faces() const {return getMeshingData()->faces();}
 
 
     /*------------------------------------------------------------------------*/
@@ -497,6 +499,7 @@ public:
     /// accesseur sur les propriétés de maillage
 
     CoFaceMeshingData* getMeshingData() {return m_mesh_data;}
+    const CoFaceMeshingData* getMeshingData() const {return m_mesh_data;}
 
 
     /*------------------------------------------------------------------------*/
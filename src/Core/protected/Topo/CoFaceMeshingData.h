@@ -10,6 +10,7 @@
 #ifndef COFACEMESHINGDATA_H_
 #define COFACEMESHINGDATA_H_
 /*----------------------------------------------------------------------------*/
+#include "Topo/MeshCellIds.h"
 #include <gmds/utils/CommonTypes.h>
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
@@ -34,8 +35,9 @@ public:
         CoFaceMeshingData* emd = new CoFaceMeshingData();
         emd->m_is_meshed = m_is_meshed;
         emd->m_is_premeshed = m_is_premeshed;
-        emd->m_nodes.insert(emd->m_nodes.end(), m_nodes.begin(), m_nodes.end());
-        emd->m_poly.insert(emd->m_poly.end(), m_poly.begin(), m_poly.end());
+        // les listes sont partagées jusqu'à leur prochaine modification
+        emd->m_nodes = m_nodes;
+        emd->m_poly = m_poly;
         emd->m_points =  m_points;
         return emd;
     }
@@ -59,11 +61,13 @@ public:
 
     /*------------------------------------------------------------------------*/
     /** Accesseur sur la liste des noeuds gmds */
-    std::vector<gmds::TCellID>& nodes() {return m_nodes;}
+    std::vector<gmds::TCellID>& nodes() {return m_nodes.edit();}
+    const std::vector<gmds::TCellID>& nodes() const {return m_nodes.get();}
 
     /*------------------------------------------------------------------------*/
     /** Accesseur sur la liste des polygones gmds */
-    std::vector<gmds::TCellID>& faces() {return m_poly;}
+    MeshCellIds& faces() {return m_poly;}
+    const MeshCellIds& faces() const {return m_poly;}
 
 private:
     /// Maillage associé créé ou non
@@ -73,10 +77,10 @@ private:
     bool m_is_premeshed;
 
     /// Liste des noeuds (gmds) associés
-    std::vector<gmds::TCellID> m_nodes;
+    SharedVector<gmds::TCellID> m_nodes;
 
     /// Liste des polygones (gmds) associés
-    std::vector<gmds::TCellID> m_poly;
+    MeshCellIds m_poly;
 
     /// Les points pour le maillage
     Utils::Math::Point* m_points;
@@ -11,6 +11,7 @@
 #define COMMANDCHANGEVERTICESLOCATION_H_
 /*----------------------------------------------------------------------------*/
 #include "Topo/CommandEditTopo.h"
+#include "Utils/Point.h"
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
@@ -51,6 +52,18 @@ public:
 			const coordinateType typeCoord,
 			CoordinateSystem::SysCoord* rep);
 
+    /*------------------------------------------------------------------------*/
+    /** \brief  Constructeur pour un déplacement en bloc, chaque sommet recevant
+     *  sa propre position (en coordonnées cartésiennes dans le repère global)
+     *
+     *  \param c le contexte
+     *  \param vertices les sommets topologiques concernées
+     *  \param points les nouvelles positions, une par sommet
+     */
+    CommandChangeVerticesLocation(Internal::Context& c,
+            std::vector<Vertex*> & vertices,
+            std::vector<Utils::Math::Point> & points);
+
     /*------------------------------------------------------------------------*/
     /** \brief  Destructeur
      */
@@ -93,6 +106,9 @@ private:
 
     /// repère dans lequel on fait les opérations
     CoordinateSystem::SysCoord* m_rep;
+
+    /// les nouvelles positions (une par sommet) dans le cas d'un déplacement en bloc
+    std::vector<Utils::Math::Point> m_points;
 };
 /*----------------------------------------------------------------------------*/
 } // end namespace Topo
@@ -11,7 +11,9 @@
 /*----------------------------------------------------------------------------*/
 #include "Internal/CommandInternal.h"
 #include "Group/GroupHelperForCommand.h"
+#include "Topo/TopoMark.h"
 /*----------------------------------------------------------------------------*/
+#include <atomic>
 #include <vector>
 #include <map>
 /*----------------------------------------------------------------------------*/
@@ -103,6 +105,26 @@ public:
      */
     virtual void previewEnd();
 
+    /*------------------------------------------------------------------------*/
+    /** \brief  vrai si la commande sait calculer son aperçu sans être exécutée
+     *  \see computePreview
+     */
+    virtual bool hasSideEffectFreePreview() const
+    { return false; }
+
+    /** \brief  calcule dans DisplayRepresentation les segments des nouvelles
+     *  arêtes, sans exécuter ni annuler la commande (la topologie n'est pas modifiée)
+     *
+     *  Peut être appelée depuis un autre thread que celui de l'IHM, tant que
+     *  la topologie n'est pas modifiée pendant le calcul.
+     *
+     *  \param cancel interrompt le calcul dès qu'il passe à vrai
+     *  \return faux si le calcul a été interrompu
+     *  \see hasSideEffectFreePreview
+     */
+    virtual bool computePreview(Utils::DisplayRepresentation& dr,
+            const std::atomic<bool>& cancel);
+
 
     /*------------------------------------------------------------------------*/
 
@@ -200,9 +222,9 @@ protected:
     /** Duplique les CoFaces
      */
     virtual void duplicate(std::vector<CoFace*>& cofaces_dep,
-            std::map<Vertex*, uint>& filtre_vertex,
-            std::map<CoEdge*, uint>& filtre_coedge,
-            std::map<CoFace*, uint>& filtre_coface,
+            TopoFilter<Vertex>& filtre_vertex,
+            TopoFilter<CoEdge>& filtre_coedge,
+            TopoFilter<CoFace>& filtre_coface,
             std::vector<CoFace*>& cofaces_arr);
 
     /** Met à jour les noms des arêtes ou coface pour une arête dont la discrétisation est interpolée
@@ -230,8 +252,8 @@ protected:
     virtual void updateGeomAssociation(std::vector<CoFace*>& cofaces,
             std::map<Geom::Vertex*,Geom::Curve*>& V2C,
             std::map<Geom::Curve*,Geom::Surface*>& C2S,
-            std::map<Vertex*, uint>& filtre_vertex,
-            std::map<CoEdge*, uint>& filtre_coedge);
+            TopoFilter<Vertex>& filtre_vertex,
+            TopoFilter<CoEdge>& filtre_coedge);
 
     /*------------------------------------------------------------------------*/
     /// fusionne les coedges si possible autour du sommet
@@ -80,16 +80,16 @@ private:
      * 4 ce qui est en dehors du plan 2D ou d'une de ses copies
      * 6 ce qui est sur l'ogrid avec un lien sur un sommet entre l'axe et l'ogrid
      * */
-    void computeOgridFilters(std::map<Vertex*, uint>& filtre_vertex,
-            std::map<CoEdge*, uint>& filtre_coedge,
-            std::map<CoFace*, uint>& filtre_coface);
+    void computeOgridFilters(TopoFilter<Vertex>& filtre_vertex,
+            TopoFilter<CoEdge>& filtre_coedge,
+            TopoFilter<CoFace>& filtre_coface);
 
     /**  Remplit les filtres en sélectionnant toutes les faces existantes
      *   Marque tout à 3
      */
-    void computeFiltersWithAllFaces(std::map<Vertex*, uint>& filtre_vertex,
-            std::map<CoEdge*, uint>& filtre_coedge,
-            std::map<CoFace*, uint>& filtre_coface);
+    void computeFiltersWithAllFaces(TopoFilter<Vertex>& filtre_vertex,
+            TopoFilter<CoEdge>& filtre_coedge,
+            TopoFilter<CoFace>& filtre_coface);
 
     /** Modifie les filtres en se basant sur les entités marquées
      *
@@ -97,30 +97,30 @@ private:
      * 10 ce qui touche l'axe
      * 20 ce qui est entièrement sur l'axe (pour les arêtes)
      * */
-    void computeAxisFilters(std::map<Vertex*, uint>& filtre_vertex,
-            std::map<CoEdge*, uint>& filtre_coedge,
-            std::map<CoFace*, uint>& filtre_coface);
+    void computeAxisFilters(TopoFilter<Vertex>& filtre_vertex,
+            TopoFilter<CoEdge>& filtre_coedge,
+            TopoFilter<CoFace>& filtre_coface);
 
     /** Détection des sommets entre l'axe et l'ogrid,
      * marque les sommets de l'ogrid à 6 lorsqu'ils sont reliés à un tel sommet
      */
-    void detectVerticesUnderOgrid(std::map<Vertex*, uint>& filtre_vertex);
+    void detectVerticesUnderOgrid(TopoFilter<Vertex>& filtre_vertex);
 
     /** calcul le nombre de bras (ni) entre l'axe et le tracé de l'o-grid.
      * C'est ce nombre de bras que l'on retrouve dans le bloc central de l'o-grid.
      * Calcul égallement les ni locaux pour les sommets sur l'ogrid et
      * pour les cofaces de part et d'autre de cet ogrid
       */
-    void computeNi(std::map<Vertex*, uint>& filtre_vertex,
-            std::map<CoEdge*, uint>& filtre_coedge,
-            std::map<Vertex*, uint>& ni_vtx,
-            std::map<CoEdge*, uint>& ni_coedge,
-            std::map<CoFace*, uint>& ni_coface);
+    void computeNi(TopoFilter<Vertex>& filtre_vertex,
+            TopoFilter<CoEdge>& filtre_coedge,
+            TopoFilter<Vertex>& ni_vtx,
+            TopoFilter<CoEdge>& ni_coedge,
+            TopoFilter<CoFace>& ni_coface);
 
     /** Copie des ni locaux d'une liste de cofaces et d'arêtes en relation avec une autre liste */
-    void copyNi(std::map<Vertex*, uint>& ni_vtx,
-            std::map<CoEdge*, uint>& ni_coedge,
-            std::map<CoFace*, uint>& ni_coface,
+    void copyNi(TopoFilter<Vertex>& ni_vtx,
+            TopoFilter<CoEdge>& ni_coedge,
+            TopoFilter<CoFace>& ni_coface,
     		std::vector<CoFace*>& cofaces_dep,
     		std::vector<CoFace*>& cofaces_arr);
 
@@ -128,14 +128,14 @@ private:
      *  ainsi que pour les CoEdge et Vertex associé
      */
     void marqueCoFaceCoEdgeVertices(CoEdge* coedge, const uint marque,
-            std::map<Vertex*, uint>& filtre_vertex,
-            std::map<CoEdge*, uint>& filtre_coedge,
-            std::map<CoFace*, uint>& filtre_coface);
+            TopoFilter<Vertex>& filtre_vertex,
+            TopoFilter<CoEdge>& filtre_coedge,
+            TopoFilter<CoFace>& filtre_coface);
 
     /** Recherche les arêtes marquées comme étant sur l'ogrid en parcourant les faces
      *  */
     void getMarquedOnOgrid(std::vector<CoFace*>& cofaces,
-            std::map<Vertex*, uint>& filtre_vertex,
+            TopoFilter<Vertex>& filtre_vertex,
             std::vector<Vertex*>& vertices_ogrid);
 
     /** Effectue une rotation de la topologie
@@ -163,9 +163,9 @@ private:
     /** suppression des entités sous l'ogrid,
      * les marques sont mises à 0 pour ces dernières */
     void freeUnused(std::vector<CoFace*>& cofaces,
-            std::map<Vertex*, uint>& filtre_vertex,
-            std::map<CoEdge*, uint>& filtre_coedge,
-            std::map<CoFace*, uint>& filtre_coface,
+            TopoFilter<Vertex>& filtre_vertex,
+            TopoFilter<CoEdge>& filtre_coedge,
+            TopoFilter<CoFace>& filtre_coface,
             bool memorizeFreezedCofaces = false);
 
     /** pour le cas des arêtes détruites (sur l'axe)
@@ -173,8 +173,8 @@ private:
      *  les fait pointer sur l'arête sur l'ogrid
      */
     void updateInterpolate(std::vector<CoFace*>& cofaces,
-    		std::map<CoEdge*, uint>& filtre_coedge,
-			std::map<CoFace*, uint>& filtre_coface);
+    		TopoFilter<CoEdge>& filtre_coedge,
+			TopoFilter<CoFace>& filtre_coface);
 
     /** Construction des arêtes (CoEdge) entre les 2 groupes de faces,
      * \param nbDemiOgrid 1 ou 2 suivant que l'on est sur un quart d'angle de révol ou la demi (ce qui correspond au nb de moitiés du côté de l'ogrid)
@@ -183,12 +183,12 @@ private:
      * */
     void constructRevolCoEdges(std::vector<CoFace*>& cofaces_0,
             std::vector<CoFace*>& cofaces_1,
-            std::map<Vertex*, uint>& filtre_vertex,
-            std::map<CoEdge*, uint>& filtre_coedge,
+            TopoFilter<Vertex>& filtre_vertex,
+            TopoFilter<CoEdge>& filtre_coedge,
             uint nbDemiOgrid,
             bool sensNormal,
             std::map<Vertex*, std::vector<CoEdge* > >& vtx2coedges,
-            std::map<Vertex*, uint>& ni_vtx,
+            TopoFilter<Vertex>& ni_vtx,
 			bool preserveSurfaceAssociation);
 
     /** Construction des  faces (CoFace et Edge) entre les différents couples de topo 2D
@@ -197,11 +197,11 @@ private:
      */
     void constructRevolFaces(std::vector<CoFace*>& cofaces_0,
             std::vector<CoFace*>& cofaces_1,
-            std::map<Vertex*, uint>& filtre_vertex,
-            std::map<CoEdge*, uint>& filtre_coedge,
+            TopoFilter<Vertex>& filtre_vertex,
+            TopoFilter<CoEdge>& filtre_coedge,
             std::map<Vertex*, std::vector<CoEdge* > >& vtx2coedges,
             std::map<CoEdge*, std::vector<CoFace* > >& coedge2cofaces,
-            std::map<CoEdge*, uint>& ni_coedge,
+            TopoFilter<CoEdge>& ni_coedge,
             uint facteur_ni);
 
     /** Construction des faces (CoFace et Edge) situées sous l'ogrid
@@ -209,8 +209,8 @@ private:
      */
     void constructRevolFacesInnerOgrid(std::vector<CoFace*>& cofaces_0,
             std::vector<CoFace*>& cofaces_1,
-            std::map<Vertex*, uint>& filtre_vertex,
-            std::map<CoEdge*, uint>& filtre_coedge,
+            TopoFilter<Vertex>& filtre_vertex,
+            TopoFilter<CoEdge>& filtre_coedge,
             std::map<Vertex*, std::vector<CoEdge* > >& vtx2coedges,
             std::map<CoEdge*, std::vector<CoFace* > >& coedge2cofaces);
 
@@ -219,13 +219,13 @@ private:
      */
     void constructRevolBlocks(std::vector<CoFace*>& cofaces_0,
             std::vector<CoFace*>& cofaces_1,
-            std::map<Vertex*, uint>& filtre_vertex,
-            std::map<CoEdge*, uint>& filtre_coedge,
-            std::map<CoFace*, uint>& filtre_coface,
+            TopoFilter<Vertex>& filtre_vertex,
+            TopoFilter<CoEdge>& filtre_coedge,
+            TopoFilter<CoFace>& filtre_coface,
             std::map<Vertex*, std::vector<CoEdge* > >& vtx2coedges,
             std::map<CoEdge*, std::vector<CoFace* > >& coedge2cofaces,
-            std::map<Vertex*, uint>& ni_vtx,
-            std::map<CoFace*, uint>& ni_coface,
+            TopoFilter<Vertex>& ni_vtx,
+            TopoFilter<CoFace>& ni_coface,
             uint facteur_ni);
 
     /** Construction des blocs situés au centre de l'ogrid, dans le cas d'un quart de révolution
@@ -233,13 +233,13 @@ private:
     void constructRevolBlocksInnerOgrid_4(std::vector<CoFace*>& cofaces_0,
             std::vector<CoFace*>& cofaces_45,
             std::vector<CoFace*>& cofaces_90,
-            std::map<Vertex*, uint>& filtre_vertex,
-            std::map<CoEdge*, uint>& filtre_coedge,
-            std::map<CoFace*, uint>& filtre_coface,
+            TopoFilter<Vertex>& filtre_vertex,
+            TopoFilter<CoEdge>& filtre_coedge,
+            TopoFilter<CoFace>& filtre_coface,
             std::map<Vertex*, std::vector<CoEdge* > >& vtx2coedges,
             std::map<CoEdge*, std::vector<CoFace* > >& coedge2cofaces,
-            std::map<Vertex*, uint>& ni_vtx,
-            std::map<CoFace*, uint>& ni_coface);
+            TopoFilter<Vertex>& ni_vtx,
+            TopoFilter<CoFace>& ni_coface);
 
     /** Construction des blocs situés au centre de l'ogrid, dans le cas d'une révolution d'un demi tour
      */
@@ -247,13 +247,13 @@ private:
             std::vector<CoFace*>& cofaces_45,
             std::vector<CoFace*>& cofaces_135,
             std::vector<CoFace*>& cofaces_180,
-            std::map<Vertex*, uint>& filtre_vertex,
-            std::map<CoEdge*, uint>& filtre_coedge,
-            std::map<CoFace*, uint>& filtre_coface,
+            TopoFilter<Vertex>& filtre_vertex,
+            TopoFilter<CoEdge>& filtre_coedge,
+            TopoFilter<CoFace>& filtre_coface,
             std::map<Vertex*, std::vector<CoEdge* > >& vtx2coedges,
             std::map<CoEdge*, std::vector<CoFace* > >& coedge2cofaces,
-            std::map<Vertex*, uint>& ni_vtx,
-            std::map<CoFace*, uint>& ni_coface);
+            TopoFilter<Vertex>& ni_vtx,
+            TopoFilter<CoFace>& ni_coface);
 
     /** Construction des blocs situés au centre de l'ogrid, dans le cas d'une révolution d'un tour entier
      */
@@ -261,20 +261,20 @@ private:
             std::vector<CoFace*>& cofaces_135,
             std::vector<CoFace*>& cofaces_225,
             std::vector<CoFace*>& cofaces_315,
-            std::map<Vertex*, uint>& filtre_vertex,
-            std::map<CoEdge*, uint>& filtre_coedge,
-            std::map<CoFace*, uint>& filtre_coface,
+            TopoFilter<Vertex>& filtre_vertex,
+            TopoFilter<CoEdge>& filtre_coedge,
+            TopoFilter<CoFace>& filtre_coface,
             std::map<Vertex*, std::vector<CoEdge* > >& vtx2coedges,
             std::map<CoEdge*, std::vector<CoFace* > >& coedge2cofaces,
-            std::map<Vertex*, uint>& ni_vtx,
-            std::map<CoFace*, uint>& ni_coface);
+            TopoFilter<Vertex>& ni_vtx,
+            TopoFilter<CoFace>& ni_coface);
 
     /** Projette les sommets du tracé de l'ogrid sur les surfaces issues de la révol des courbes
      * sur lesquelles sont projettées les arêtes en dehors du tracé et voisines des sommets.
      */
     void updateGeomAssociationOGrid(std::vector<Vertex*>& vertices,
-            std::map<Vertex*, uint>& filtre_vertex,
-            std::map<CoEdge*, uint>& filtre_coedge);
+            TopoFilter<Vertex>& filtre_vertex,
+            TopoFilter<CoEdge>& filtre_coedge);
 
     /** Met à jour l'association vers la nouvelle entité géométrique
      *  qui a subit une révolution (utilisation de V2C ou de C2S)
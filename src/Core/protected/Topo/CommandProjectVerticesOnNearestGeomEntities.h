@@ -63,8 +63,8 @@ public:
 private:
 
     /*------------------------------------------------------------------------*/
-    /** projection pour un sommet */
-    void project(Vertex* vtx, Geom::GeomEntity* ge);
+    /** projection pour un sommet, posGeom est son projeté sur ge */
+    void project(Vertex* vtx, Geom::GeomEntity* ge, const Utils::Math::Point& posGeom);
 
     /** les sommets à projeter */
     std::vector<Vertex*> m_vertices;
@@ -5,8 +5,12 @@
 #include "Topo/CommandEditTopo.h"
 #include "Utils/Point.h"
 /*----------------------------------------------------------------------------*/
+#include <functional>
 #include <map>
+#include <queue>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
@@ -72,18 +76,44 @@ public:
     virtual void countNbCoEdgesByVertices(std::map<Topo::Vertex*, uint> &nb_coedges_by_vertex);
 
     /*------------------------------------------------------------------------*/
-    /** \brief  exécute et annule la commande, retourne dans DisplayRepresentation
-     *  une représentation des entités modifiées
+    /** \brief  retourne dans DisplayRepresentation une représentation de la coupe,
+     *  calculée sans exécuter la commande
      *
      *  La commande doit ensuite être détruite
      */
     virtual void getPreviewRepresentation(Utils::DisplayRepresentation& dr);
 
+    /*------------------------------------------------------------------------*/
+    /// la coupe peut être calculée sans exécuter la commande
+    virtual bool hasSideEffectFreePreview() const
+    { return true; }
+
+    /** \brief  calcule les segments de la coupe, sans modifier la topologie
+     *  \see TopoHelper::computeSplitPreview
+     */
+    virtual bool computePreview(Utils::DisplayRepresentation& dr,
+            const std::atomic<bool>& cancel);
+
 private:
 
+    /// blocs candidats au découpage, repérés par leur indice dans m_blocs (le plus petit en tête)
+    typedef std::priority_queue<uint, std::vector<uint>, std::greater<uint> > BlockQueue;
+
     /*------------------------------------------------------------------------*/
-    void findBlockUnmarkedWithCoEdgeMarked(std::set<Block*>& filtre_blocs,
-    		std::set<CoEdge*>& filtre_coedges, Block* &bloc, CoEdge* &arete);
+    /** Ajoute aux candidats les blocs à découper qui sont reliés à une arête marquée
+     */
+    void addBlocksWithCoEdge(CoEdge* coedge,
+    		const std::unordered_map<Block*, uint>& indices_blocs, BlockQueue& candidats);
+
+    /*------------------------------------------------------------------------*/
+    /** Retourne le premier bloc (dans l'ordre de m_blocs) non découpé qui possède
+     *  une arête marquée, ainsi que la première de ses arêtes marquées.
+     *  Seuls les blocs de la file des candidats sont examinés, ce qui rend
+     *  la propagation linéaire en nombre de blocs.
+     */
+    void findBlockUnmarkedWithCoEdgeMarked(BlockQueue& candidats,
+    		const std::vector<bool>& filtre_blocs,
+    		const std::unordered_set<CoEdge*>& filtre_coedges, uint& ind_bloc, CoEdge* &arete);
 
     /*------------------------------------------------------------------------*/
     /// Vérification de la valeur de m_ratio
@@ -83,41 +83,41 @@ private:
      *
      * Par la suite, les sommets sont marqués à 4 lorsqu'ils sont créés sur une courbe
      */
-    void computeFilters(std::map<Vertex*, uint> & filtre_vertex,
-            std::map<CoEdge*, uint> & filtre_coedge,
-            std::map<CoFace*, uint> & filtre_coface,
-            std::map<Face*,  uint> & filtre_face,
-            std::map<Block*,  uint> & filtre_bloc);
+    void computeFilters(TopoFilter<Vertex> & filtre_vertex,
+            TopoFilter<CoEdge> & filtre_coedge,
+            TopoFilter<CoFace> & filtre_coface,
+            TopoFilter<Face> & filtre_face,
+            TopoFilter<Block> & filtre_bloc);
 
     /** Sauvegarde les relations topologiques pour permettre le undo
      */
-    void saveTopoProperty(std::map<Vertex*, uint> & filtre_vertex,
-            std::map<CoEdge*, uint> & filtre_coedge,
-            std::map<CoFace*, uint> & filtre_coface,
-            std::map<Block*,  uint> & filtre_bloc);
+    void saveTopoProperty(TopoFilter<Vertex> & filtre_vertex,
+            TopoFilter<CoEdge> & filtre_coedge,
+            TopoFilter<CoFace> & filtre_coface,
+            TopoFilter<Block> & filtre_bloc);
 
     /** Création des sommets au centre de l'o-grid
      */
-    void createVertices(std::map<Vertex*, uint> & filtre_vertex,
-            std::map<CoEdge*, uint> & filtre_coedge,
-            std::map<CoFace*, uint> & filtre_coface,
+    void createVertices(TopoFilter<Vertex> & filtre_vertex,
+            TopoFilter<CoEdge> & filtre_coedge,
+            TopoFilter<CoFace> & filtre_coface,
             std::map<Vertex*, Vertex*> & corr_vertex);
 
     /** Création des arêtes communes entre les sommets du bord et ceux au centre de l'o-grid
      */
-    void createCoEdges(std::map<Vertex*, uint> & filtre_vertex,
+    void createCoEdges(TopoFilter<Vertex> & filtre_vertex,
             std::map<Vertex*, Vertex*> & corr_vertex,
             std::map<Vertex*, CoEdge*> & corr_vtx_coedge);
 
     /** Création des arêtes communes et face communes (internes à l'ogrid)
      */
-    void createCoEdgeAndFace(std::map<Vertex*, uint> & filtre_vertex,
+    void createCoEdgeAndFace(TopoFilter<Vertex> & filtre_vertex,
             std::map<Vertex*, Vertex*>  & corr_vertex,
             std::map<Vertex*, CoEdge*> & corr_vtx_coedge,
-            std::map<CoEdge*, uint> & filtre_coedge,
-            std::map<CoFace*, uint> & filtre_coface,
-            std::map<Face*,  uint> & filtre_face,
-            std::map<Block*,  uint> & filtre_bloc,
+            TopoFilter<CoEdge> & filtre_coedge,
+            TopoFilter<CoFace> & filtre_coface,
+            TopoFilter<Face> & filtre_face,
+            TopoFilter<Block> & filtre_bloc,
             std::map<std::pair<Vertex*, Vertex*>, CoEdge*> & corr_2vtx_coedge,
             std::map<std::pair<Vertex*, Vertex*>, CoFace*> & corr_2vtx_coface);
 
@@ -130,8 +130,8 @@ private:
             std::vector<CoEdge* > & jCoedges,
             std::map<Vertex*, Vertex*>  & corr_vertex,
             std::map<Vertex*, CoEdge*> & corr_vtx_coedge,
-            std::map<Vertex*, uint> & filtre_vertex,
-            std::map<CoEdge*, uint> & filtre_coedge,
+            TopoFilter<Vertex> & filtre_vertex,
+            TopoFilter<CoEdge> & filtre_coedge,
             std::vector<std::string> & groupsName,
             std::map<std::pair<Vertex*, Vertex*>, CoEdge*> & corr_2vtx_coedge,
             std::map<std::pair<Vertex*, Vertex*>, CoFace*> & corr_2vtx_coface);
@@ -143,18 +143,18 @@ private:
             std::vector<CoEdge* > & iCoedges,
             std::vector<CoEdge* > & jCoedges,
             std::map<Vertex*, Vertex*>  & corr_vertex,
-            std::map<Vertex*, uint> & filtre_vertex,
+            TopoFilter<Vertex> & filtre_vertex,
             std::map<std::pair<Vertex*, Vertex*>, CoEdge*> & corr_2vtx_coedge);
 
     /** Creation des faces communes au centre
      * et conserve une relation entre face commune issues de la sélection et celles au centre
      */
-    void createCoFace(std::map<Vertex*, uint> & filtre_vertex,
+    void createCoFace(TopoFilter<Vertex> & filtre_vertex,
             std::map<Vertex*, Vertex*>  & corr_vertex,
             std::map<std::pair<Vertex*, Vertex*>, CoEdge*> & corr_2vtx_coedge,
-            std::map<CoFace*, uint> & filtre_coface,
-            std::map<Face*,  uint> & filtre_face,
-            std::map<Block*,  uint> & filtre_bloc,
+            TopoFilter<CoFace> & filtre_coface,
+            TopoFilter<Face> & filtre_face,
+            TopoFilter<Block> & filtre_bloc,
             std::map<CoFace*, CoFace*> & corr_coface);
 
     /** Création d'une face à partir de 2 sommets (cofaces entre bord et o-grid)
@@ -164,7 +164,7 @@ private:
             std::vector<CoEdge* > & iCoedges,
             std::vector<CoEdge* > & jCoedges,
             std::map<Vertex*, Vertex*>  & corr_vertex,
-            std::map<Vertex*, uint> & filtre_vertex,
+            TopoFilter<Vertex> & filtre_vertex,
             std::map<std::pair<Vertex*, Vertex*>, CoFace*> & corr_2vtx_coface);
 
     /** Création d'une face (sur le bloc interne) à partir d'une face du bloc initial
@@ -176,22 +176,22 @@ private:
 
     /** Création des blocs
      * un par coface au bord de la sélection */
-    void createBlock(std::map<Vertex*, uint> & filtre_vertex,
+    void createBlock(TopoFilter<Vertex> & filtre_vertex,
             std::map<Vertex*, Vertex*>  & corr_vertex,
             std::map<std::pair<Vertex*, Vertex*>, CoFace*> & corr_2vtx_coface,
-            std::map<CoFace*, uint> & filtre_coface,
+            TopoFilter<CoFace> & filtre_coface,
             std::map<CoFace*, CoFace*> & corr_coface,
-            std::map<Face*,  uint> & filtre_face,
-            std::map<Block*,  uint> & filtre_bloc);
+            TopoFilter<Face> & filtre_face,
+            TopoFilter<Block> & filtre_bloc);
 
     /** Supression des entités initiales qui ne sont plus utilisées: les faces internes et les blocs,
      * réutilisation des projections pour les faces internes
      * mise à jour des entitées adjacentes
      */
-    void freeUnused(std::map<Vertex*, uint> & filtre_vertex,
-            std::map<CoEdge*, uint> & filtre_coedge,
-            std::map<CoFace*, uint> & filtre_coface,
-            std::map<Block*,  uint> & filtre_bloc,
+    void freeUnused(TopoFilter<Vertex> & filtre_vertex,
+            TopoFilter<CoEdge> & filtre_coedge,
+            TopoFilter<CoFace> & filtre_coface,
+            TopoFilter<Block> & filtre_bloc,
             std::map<Vertex*, CoEdge*> & corr_vtx_coedge,
 			std::map<std::pair<Vertex*, Vertex*>, CoEdge*> & corr_2vtx_coedge,
             std::map<std::pair<Vertex*, Vertex*>, CoFace*> & corr_2vtx_coface,
@@ -205,13 +205,13 @@ private:
             Vertex* vtx1,
             std::vector<CoEdge* > & iCoedges,
             std::vector<CoEdge* > & jCoedges,
-            std::map<Vertex*, uint> & filtre_vertex);
+            TopoFilter<Vertex> & filtre_vertex);
 
     /** marque à 1 (si non traité) les edges qui partagent une arête commune
      * filtre_edge, filtre sur les edges pour stocker d'une part celles mises à jour (marque à 2)
      * celles à mettre à jour par la suite (marque à 1)
      */
-    void updateNeighBorFilter(Edge* edge, std::map<Edge*,  uint> & filtre_edge);
+    void updateNeighBorFilter(Edge* edge, TopoFilter<Edge> & filtre_edge);
 
     /** met à jour les discrétisations des arêtes voisines de celles créées
      *  pour garantir la structuration
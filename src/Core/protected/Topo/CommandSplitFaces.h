@@ -79,13 +79,24 @@ public:
     virtual void countNbCoEdgesByVertices(std::map<Topo::Vertex*, uint> &nb_coedges_by_vertex);
 
     /*------------------------------------------------------------------------*/
-    /** \brief  exécute et annule la commande, retourne dans DisplayRepresentation
-     *  une représentation des entités modifiées
+    /** \brief  retourne dans DisplayRepresentation une représentation de la coupe,
+     *  calculée sans exécuter la commande
      *
      *  La commande doit ensuite être détruite
      */
     virtual void getPreviewRepresentation(Utils::DisplayRepresentation& dr);
 
+    /*------------------------------------------------------------------------*/
+    /// la coupe peut être calculée sans exécuter la commande
+    virtual bool hasSideEffectFreePreview() const
+    { return true; }
+
+    /** \brief  calcule les segments de la coupe, sans modifier la topologie
+     *  \see TopoHelper::computeSplitPreview
+     */
+    virtual bool computePreview(Utils::DisplayRepresentation& dr,
+            const std::atomic<bool>& cancel);
+
 private:
     /// stocke les faces communes structurées parmi celles données en paramètre
     void init(std::vector<Topo::CoFace* > &cofaces);
@@ -79,37 +79,37 @@ private:
      *
      * Par la suite, les sommets sont marqués à 4 lorsqu'ils sont créés sur une courbe
      */
-    void computeFilters(std::map<Vertex*, uint> & filtre_vertex,
-            std::map<CoEdge*, uint> & filtre_coedge,
-            std::map<Edge*,  uint> & filtre_edge,
-            std::map<CoFace*, uint> & filtre_coface);
+    void computeFilters(TopoFilter<Vertex> & filtre_vertex,
+            TopoFilter<CoEdge> & filtre_coedge,
+            TopoFilter<Edge> & filtre_edge,
+            TopoFilter<CoFace> & filtre_coface);
 
     /** Sauvegarde les relations topologiques pour permettre le undo
      */
-    void saveTopoProperty(std::map<Vertex*, uint> & filtre_vertex,
-            std::map<CoEdge*, uint> & filtre_coedge,
-            std::map<CoFace*, uint> & filtre_coface);
+    void saveTopoProperty(TopoFilter<Vertex> & filtre_vertex,
+            TopoFilter<CoEdge> & filtre_coedge,
+            TopoFilter<CoFace> & filtre_coface);
 
     /** Création des sommets au centre de l'o-grid
      */
-    void createVertices(std::map<Vertex*, uint> & filtre_vertex,
-            std::map<CoEdge*, uint> & filtre_coedge,
+    void createVertices(TopoFilter<Vertex> & filtre_vertex,
+            TopoFilter<CoEdge> & filtre_coedge,
             std::map<Vertex*, Vertex*> & corr_vertex);
 
     /** Création des arêtes communes entre les sommets du bord et ceux au centre de l'o-grid
      */
-    void createCoEdges(std::map<Vertex*, uint> & filtre_vertex,
+    void createCoEdges(TopoFilter<Vertex> & filtre_vertex,
             std::map<Vertex*, Vertex*> & corr_vertex,
             std::map<Vertex*, CoEdge*> & corr_vtx_coedge);
 
     /** Création des arêtes communes et face communes (internes à l'ogrid)
      */
-    void createCoEdgeAndFace(std::map<Vertex*, uint> & filtre_vertex,
+    void createCoEdgeAndFace(TopoFilter<Vertex> & filtre_vertex,
             std::map<Vertex*, Vertex*>  & corr_vertex,
             std::map<Vertex*, CoEdge*> & corr_vtx_coedge,
-            std::map<CoEdge*, uint> & filtre_coedge,
-            std::map<CoFace*, uint> & filtre_coface,
-			std::map<Edge*,  uint> & filtre_edge,
+            TopoFilter<CoEdge> & filtre_coedge,
+            TopoFilter<CoFace> & filtre_coface,
+			TopoFilter<Edge> & filtre_edge,
             std::map<std::pair<Vertex*, Vertex*>, CoEdge*> & corr_2vtx_coedge,
             std::map<std::pair<Vertex*, Vertex*>, CoFace*> & corr_2vtx_coface);
 
@@ -121,8 +121,8 @@ private:
 			Edge* edge,
             std::map<Vertex*, Vertex*>  & corr_vertex,
             std::map<Vertex*, CoEdge*> & corr_vtx_coedge,
-            std::map<Vertex*, uint> & filtre_vertex,
-            std::map<CoEdge*, uint> & filtre_coedge,
+            TopoFilter<Vertex> & filtre_vertex,
+            TopoFilter<CoEdge> & filtre_coedge,
             std::vector<std::string> & groupsName,
             std::map<std::pair<Vertex*, Vertex*>, CoEdge*> & corr_2vtx_coedge,
 	        std::map<std::pair<Vertex*, Vertex*>, CoFace*> & corr_2vtx_coface);
@@ -132,25 +132,25 @@ private:
     Edge* createEdge(Vertex* vtx0,
             Vertex* vtx1,
             std::map<Vertex*, Vertex*>  & corr_vertex,
-            std::map<Vertex*, uint> & filtre_vertex,
+            TopoFilter<Vertex> & filtre_vertex,
             std::map<std::pair<Vertex*, Vertex*>, CoEdge*> & corr_2vtx_coedge);
 
 
     /** Creation des faces communes au centre
      */
-    void createCoFace(std::map<Vertex*, uint> & filtre_vertex,
+    void createCoFace(TopoFilter<Vertex> & filtre_vertex,
             std::map<Vertex*, Vertex*>  & corr_vertex,
             std::map<std::pair<Vertex*, Vertex*>, CoEdge*> & corr_2vtx_coedge,
-            std::map<CoFace*, uint> & filtre_coface,
+            TopoFilter<CoFace> & filtre_coface,
             std::map<CoFace*, CoFace*> & corr_coface);
 
 
     /** Supression des entités initiales qui ne sont plus utilisées: les faces internes et les blocs,
      * réutilisation des projections pour les faces internes
      */
-    void freeUnused(std::map<Vertex*, uint> & filtre_vertex,
-            std::map<CoEdge*, uint> & filtre_coedge,
-            std::map<CoFace*, uint> & filtre_coface,
+    void freeUnused(TopoFilter<Vertex> & filtre_vertex,
+            TopoFilter<CoEdge> & filtre_coedge,
+            TopoFilter<CoFace> & filtre_coface,
             std::map<Vertex*, CoEdge*> & corr_vtx_coedge,
             std::map<std::pair<Vertex*, Vertex*>, CoFace*> & corr_2vtx_coface,
             std::map<CoFace*, CoFace*> & corr_coface);
@@ -162,7 +162,7 @@ private:
     std::vector<Vertex*> getSelectedVertices(Vertex* vtx0,
             Vertex* vtx1,
             std::vector<CoEdge* > & coedges,
-            std::map<Vertex*, uint> & filtre_vertex);
+            TopoFilter<Vertex> & filtre_vertex);
 
 private:
     /// les faces structurées à découper
@@ -3,9 +3,10 @@
 #define EXPORTBLOCKSIMPLEMENTATION_H
 /*----------------------------------------------------------------------------*/
 #include "Internal/Context.h"
+#include "Topo/BlockingFileData.h"
 /*----------------------------------------------------------------------------*/
 #include <string>
-#include <fstream>
+#include <unordered_map>
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
@@ -18,7 +19,8 @@ public:
     /** \brief  Constructeur pour l'exportation de tous les blocs
      *
      *  \param c le contexte
-     *  \param n le nom du fichier dans lequel se fait l'exportation
+     *  \param n le nom du fichier dans lequel se fait l'exportation (.mgxt en
+     *           ASCII, .mgxb en binaire)
      *  \param withGeom <I>True</I> si on importe l'association
      */
     ExportBlocksImplementation(Internal::Context& c, const std::string& n, const bool& withGeom);
@@ -35,15 +37,17 @@ public:
 
 private:
 
-    void writeNodes(std::ofstream& str, std::vector<Topo::Vertex*> vertices);
-    void writeEdges(std::ofstream& str, std::vector<Topo::CoEdge*> edges);
-    void writeFaces(std::ofstream& str, std::vector<Topo::CoFace*> faces);
-    void writeBlocks(std::ofstream& str, std::vector<Topo::Block*> blocks);
+    /** remplissage des tableaux du fichier à partir de la topologie, les
+     *  entités étant numérotées dans l'ordre de leurs vecteurs */
+    void fillNodes(BlockingFileData& data, const std::vector<Topo::Vertex*>& vertices);
+    void fillEdges(BlockingFileData& data, const std::vector<Topo::CoEdge*>& edges);
+    void fillDiscr(BlockingFileData& data, const std::vector<Topo::CoEdge*>& edges);
+    void fillFaces(BlockingFileData& data, const std::vector<Topo::CoFace*>& faces);
+    void fillBlocks(BlockingFileData& data, const std::vector<Topo::Block*>& blocks);
 
-    void writeAssociationNodes(std::ofstream &str, const std::vector<Topo::Vertex*>& vs);
-    void writeAssociationEdges(std::ofstream &str, const std::vector<Topo::CoEdge*>& es);
-    void writeAssociationFaces(std::ofstream &str, const std::vector<Topo::CoFace*>& fs);
-    void writeAssociationBlocks(std::ofstream &str, const std::vector<Topo::Block*>& bs);
+    /// association géométrique des entités topologiques, id étant leur indice
+    template <typename T>
+    void fillAssociation(std::vector<int>& assoc, const std::vector<T*>& entities);
 
 
     /// contexte d'exécution
@@ -55,11 +59,14 @@ private:
     /// si oui ou non l'association géometrique est activée
     bool with_geom;
 
-    /// stockage des noms des entités topo vers un id local à écrire
-    std::map<std::string, int> m_node_ids_mapping;
-    std::map<std::string, int> m_edge_ids_mapping;
-    std::map<std::string, int> m_face_ids_mapping;
-    std::map<std::string, int> m_block_ids_mapping;
+    /// indice local (à écrire) des entités topo
+    std::unordered_map<const Topo::Vertex*, int> m_node_ids_mapping;
+    std::unordered_map<const Topo::CoEdge*, int> m_edge_ids_mapping;
+    std::unordered_map<const Topo::CoFace*, int> m_face_ids_mapping;
+
+    /// indice local des arêtes et faces communes suivant leur nom (pour les interpolations)
+    std::unordered_map<std::string, int> m_edge_names_mapping;
+    std::unordered_map<std::string, int> m_face_names_mapping;
 
 };
 }
@@ -3,7 +3,7 @@
 /*----------------------------------------------------------------------------*/
 #include "Internal/Context.h"
 #include "Group/GroupHelperForCommand.h"
-#include <fstream>
+#include "Topo/BlockingFileData.h"
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
@@ -16,7 +16,7 @@ public:
     /** \brief  Constructeur.
      *
      *  \param c le contexte
-     *  \param n le nom du fichier à importer
+     *  \param n le nom du fichier à importer (.mgxt en ASCII, .mgxb en binaire)
      *  \param withGeom <I>True</I> si on importe l'association
      */
     ImportBlocksImplementation(Internal::Context& c, Internal::InfoCommand* icmd,
@@ -33,16 +33,17 @@ public:
 
 
 private:
-    void readNodes(std::ifstream &str, Group::Group0D* group);
-    int readEdges(std::ifstream &str, Group::Group1D* group);
-    void readFaces(std::ifstream &str, Group::Group2D* group);
-    void readBlocks(std::ifstream &str, Group::Group3D* group);
+    /** création des entités à partir du contenu du fichier, les références
+     *  entre entités étant résolues par leurs indices */
+    void createVertices(const BlockingFileData& data);
+    void createEdges(const BlockingFileData& data);
+    void createFaces(const BlockingFileData& data);
+    void createBlocks(const BlockingFileData& data);
 
-    void readDiscr(std::ifstream &str, const int &nbEdges);
+    void setDiscr(const BlockingFileData& data);
 
-    void readAssociation(std::ifstream &str);
+    void setAssociation(const BlockingFileData& data);
 
-    bool moveStreamOntoFirst(std::ifstream& s,const std::string &AString);
     static std::string findGeom(int dim, int id);
 
 private:
@@ -61,7 +62,6 @@ private:
     std::string m_warning;
 
     std::vector<Vertex*> m_vertices;
-    std::vector<std::string> m_vnames;
 
     std::vector<CoEdge*> m_coedges;
     std::vector<std::string> m_enames;
@@ -69,7 +69,6 @@ private:
     std::vector<CoFace*> m_cofaces;
     std::vector<std::string > m_fnames;
 
-    std::vector<std::string > m_bnames;
     std::vector<Block*> m_blocks;
 
 };
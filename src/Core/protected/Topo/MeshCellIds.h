@@ -0,0 +1,166 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file MeshCellIds.h
+ *
+ *  \date 19 oct. 2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef MESHCELLIDS_H_
+#define MESHCELLIDS_H_
+/*----------------------------------------------------------------------------*/
+#include <gmds/utils/CommonTypes.h>
+/*----------------------------------------------------------------------------*/
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Topo {
+/*----------------------------------------------------------------------------*/
+/**
+   @brief Vecteur partagé par les copies (sauvegardes pour le undo) et dupliqué
+   lors du premier accès en écriture
+ */
+template <typename T>
+class SharedVector {
+public:
+    SharedVector()
+    : m_data(std::make_shared<std::vector<T> >())
+    {}
+
+    /** Accès en lecture, sans duplication */
+    const std::vector<T>& get() const {return *m_data;}
+
+    /** Accès en écriture, duplique le vecteur s'il est partagé */
+    std::vector<T>& edit()
+    {
+        if (m_data.use_count() > 1)
+            m_data = std::make_shared<std::vector<T> >(*m_data);
+        return *m_data;
+    }
+
+private:
+    std::shared_ptr<std::vector<T> > m_data;
+};
+/*----------------------------------------------------------------------------*/
+/**
+   @brief Liste des identifiants des mailles (gmds) d'une entité topologique
+
+   Les mailles d'une entité structurée sont créées à la suite, leurs
+   identifiants forment alors un intervalle que l'on conserve sous la forme
+   d'un premier identifiant et d'un nombre. Dès qu'un identifiant ajouté ne
+   suit pas le précédent (maillage non-structuré, identifiants réutilisés),
+   on repasse à une liste explicite, partagée avec les copies.
+ */
+class MeshCellIds {
+public:
+    /// itérateur (en lecture seule) sur les identifiants
+    class const_iterator {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef gmds::TCellID value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const gmds::TCellID* pointer;
+        typedef gmds::TCellID reference;
+
+        const_iterator(const MeshCellIds* ids, size_t i) : m_ids(ids), m_i(i) {}
+        gmds::TCellID operator*() const {return (*m_ids)[m_i];}
+        const_iterator& operator++() {++m_i; return *this;}
+        const_iterator operator++(int) {const_iterator it(*this); ++m_i; return it;}
+        bool operator==(const const_iterator& it) const {return m_i == it.m_i;}
+        bool operator!=(const const_iterator& it) const {return m_i != it.m_i;}
+    private:
+        const MeshCellIds* m_ids;
+        size_t m_i;
+    };
+
+    MeshCellIds()
+    : m_first(gmds::NullID), m_nb(0), m_implicit(true)
+    {}
+
+    /** Nombre de mailles */
+    size_t size() const {return m_implicit ? m_nb : m_ids.get().size();}
+    bool empty() const {return size() == 0;}
+
+    /** Identifiant de la i-ème maille */
+    gmds::TCellID operator[](size_t i) const
+    {return m_implicit ? m_first + i : m_ids.get()[i];}
+
+    const_iterator begin() const {return const_iterator(this, 0);}
+    const_iterator end() const {return const_iterator(this, size());}
+
+    /** Vrai si les identifiants forment un intervalle (stockage implicite) */
+    bool isImplicit() const {return m_implicit;}
+
+    /** Ajoute un identifiant en fin de liste */
+    void push_back(gmds::TCellID id)
+    {
+        if (m_implicit){
+            if (m_nb == 0)
+                m_first = id;
+            if (id == m_first + m_nb){
+                m_nb++;
+                return;
+            }
+            toExplicit();
+        }
+        m_ids.edit().push_back(id);
+    }
+
+    /** Vide la liste, on revient à un stockage implicite */
+    void clear()
+    {
+        m_first = gmds::NullID;
+        m_nb = 0;
+        m_implicit = true;
+        m_ids = SharedVector<gmds::TCellID>();
+    }
+
+    /** Réserve la place pour nb identifiants, sans effet en stockage implicite */
+    void reserve(size_t nb)
+    {
+        if (!m_implicit)
+            m_ids.edit().reserve(nb);
+    }
+
+    /** Copie des identifiants dans un vecteur */
+    std::vector<gmds::TCellID> toVector() const
+    {
+        if (!m_implicit)
+            return m_ids.get();
+        std::vector<gmds::TCellID> ids(m_nb);
+        for (size_t i=0; i<m_nb; i++)
+            ids[i] = m_first + i;
+        return ids;
+    }
+
+private:
+    /// passage à une liste explicite
+    void toExplicit()
+    {
+        std::vector<gmds::TCellID>& ids = m_ids.edit();
+        ids.reserve(2*m_nb);
+        for (size_t i=0; i<m_nb; i++)
+            ids.push_back(m_first + i);
+        m_implicit = false;
+    }
+
+    /// premier identifiant et nombre d'identifiants, en stockage implicite
+    gmds::TCellID m_first;
+    size_t m_nb;
+
+    /// vrai tant que les identifiants se suivent
+    bool m_implicit;
+
+    /// liste explicite des identifiants
+    SharedVector<gmds::TCellID> m_ids;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Topo
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* MESHCELLIDS_H_ */
+/*----------------------------------------------------------------------------*/
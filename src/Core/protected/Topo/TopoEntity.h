@@ -6,6 +6,9 @@
 #include "Topo/TopoProperty.h"
 #include "Topo/TopoInfo.h"
 #include "Topo/TopoEntityVisitor.h"
+#include "Topo/TopoMark.h"
+/*----------------------------------------------------------------------------*/
+#include <atomic>
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
 /*----------------------------------------------------------------------------*/
@@ -173,6 +176,24 @@ public:
      */
     virtual unsigned long getNbInternalMeshingNodes() {return 0;}
 
+#ifndef SWIG
+    /*------------------------------------------------------------------------*/
+    /// les marques des algorithmes en cours (cf TopoFilter)
+    TopoMarks& getMarks() const
+    { return m_marks; }
+
+    /*------------------------------------------------------------------------*/
+    /** Estampille de la dernière InfoCommand ayant enregistré une modification
+     *  de l'entité (cf InfoCommand::addTopoInfoEntity), avec le type de
+     *  modification, ce qui évite une recherche dans un conteneur.
+     */
+    std::atomic<unsigned long long>& getInfoCommandStamp() const
+    { return m_info_command_stamp; }
+
+    /// indice de l'entité dans la liste de cette InfoCommand, une fois reportée
+    uint& getInfoCommandIndex() const
+    { return m_info_command_index; }
+#endif
 
 private:
     /// Conteneur des propriétés topologiques
@@ -180,6 +201,15 @@ private:
 
     /// Sauvegarde de m_topo_property
     TopoProperty* m_save_topo_property;
+
+#ifndef SWIG
+    /// les marques des algorithmes en cours (cf TopoFilter)
+    mutable TopoMarks m_marks;
+
+    /// estampille et indice pour l'InfoCommand en cours
+    mutable std::atomic<unsigned long long> m_info_command_stamp;
+    mutable uint m_info_command_index;
+#endif
 };
 /*----------------------------------------------------------------------------*/
 } // end namespace Topo
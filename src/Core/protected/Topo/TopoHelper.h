@@ -14,12 +14,14 @@
 /*----------------------------------------------------------------------------*/
 
 #include "Utils/Entity.h"
+#include "Topo/TopoMark.h"
 
 #include <sys/types.h>
 #include <map>
 #include <list>
 #include <vector>
 #include <set>
+#include <atomic>
 #include "Utils/Vector.h"
 
 /*----------------------------------------------------------------------------*/
@@ -198,11 +200,34 @@ public:
             std::vector<Edge* > &splitingEdges,
             Internal::InfoCommand* icmd);
 
+    /** calcule les segments de la coupe des faces communes suivant une arête
+     *  et un ratio, sans modifier la topologie (aperçu de splitFaces2D/3D)
+     *
+     *  La coupe est propagée d'un côté à son opposé dans chacune des faces
+     *  communes, les faces dégénérées ne sont traversées que par leurs
+     *  côtés non dégénérés.
+     *
+     *  \param cofaces les cofaces à couper
+     *  \param arete l'arête commune qui sert de départ
+     *  \param ratio_dec le ratio entre le nombre de bras de part et d'autre du point à insérer
+     *  \param project_on_meshing_edges vrai si les sommets sont sur les noeuds de la discrétisation,
+     *  sinon ils sont placés suivant ratio_dec entre les extrémités des côtés
+     *  \param points les extrémités des segments
+     *  \param indices les indices des extrémités, par couple
+     *  \param cancel interrompt le calcul dès qu'il passe à vrai
+     *  \return faux si le calcul a été interrompu
+     */
+    static bool computeSplitPreview(const std::vector<CoFace* >& cofaces,
+            CoEdge* arete, double ratio_dec, bool project_on_meshing_edges,
+            std::vector<Utils::Math::Point>& points,
+            std::vector<size_t>& indices,
+            const std::atomic<bool>& cancel);
+
     /** Constitue la liste des entités marquées à marque */
-    static void getMarqued(std::map<CoEdge*, uint> filtre, const uint marque, std::vector<CoEdge*>& out);
+    static void getMarqued(TopoFilter<CoEdge>& filtre, const uint marque, std::vector<CoEdge*>& out);
 
     /** Constitue la liste des entités marquées à autre chose que 0 */
-    static void getMarqued(std::map<CoFace*, uint> filtre, std::vector<CoFace*>& out);
+    static void getMarqued(TopoFilter<CoFace>& filtre, std::vector<CoFace*>& out);
 
     /** Sauvegarde des relations topologiques pour toutes les entités
      * et celles de niveau inférieur
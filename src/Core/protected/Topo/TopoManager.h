@@ -59,6 +59,7 @@ namespace Topo {
 class CoEdgeMeshingProperty;
 class CoFaceMeshingProperty;
 class BlockMeshingProperty;
+class ChordIndex;
 /*----------------------------------------------------------------------------*/
 /**
  * \class TopoManager
@@ -1886,6 +1887,12 @@ public:
 
 	/** Retourne l'entité suivant le nom en argument */
 	TopoEntity* getEntity(const std::string& name, const bool exceptionIfNotFound=true) const;
+
+    /*------------------------------------------------------------------------*/
+    /** Index des cordes et feuillets, à utiliser pour les parcours d'arêtes
+     *  parallèles plutôt que de les refaire de proche en proche */
+    ChordIndex& getChordIndex() const
+    { return *m_chord_index; }
 #endif
 
     /** Retourne le nom du sommet en fonction d'une position géométrique */
@@ -1944,6 +1951,46 @@ public:
 	Point getCoord(const std::string& name) const;
     SET_SWIG_COMPLETABLE_METHOD(getCoord)
 
+#ifndef SWIG
+    /** \brief Accès en bloc aux coordonnées (x0, y0, z0, x1, ...) de tous les
+     *  sommets, dans l'ordre de getVertices()
+     */
+    void getVerticesCoordinates(std::vector<double>& coords) const;
+
+    /** \brief Accès en bloc aux sommets de tous les blocs, dans l'ordre de
+     *  getBlocks(). Pour chaque bloc on a son nombre de sommets suivi des
+     *  indices de ces sommets dans getVertices()
+     */
+    void getBlocksVerticesIndices(std::vector<long>& indices) const;
+
+    /** \brief Aperçu de splitBlocks, calculé sans modifier la topologie
+     *  (cf TopoPreviewTask) : coordonnées (x0, y0, z0, x1, ...) des extrémités
+     *  des segments de la coupe, rangées par paires. L'IHM passe par
+     *  TopoPreviewTask, cet accès sert à comparer l'aperçu à la coupe
+     *  effectuée depuis les scripts de test (getSplitBlocksPreviewArray).
+     */
+    void getSplitBlocksPreview(std::vector<std::string>& blocs_names,
+            std::string narete, const double& ratio, std::vector<double>& coords);
+#endif
+
+    /*------------------------------------------------------------------------*/
+    /** Opération de déplacement d'un ensemble de sommets en une seule commande,
+     *  chacun des sommets recevant sa propre position
+     *
+     * \param vertices_names les noms des sommets modifiés
+     * \param points les nouvelles positions, une par sommet
+     */
+    Mgx3D::Internal::M3DCommandResult*
+        setVerticesCoordinates(std::vector<std::string>& vertices_names,
+            std::vector<Point>& points);
+    SET_SWIG_COMPLETABLE_METHOD(setVerticesCoordinates)
+
+#ifndef SWIG
+    Mgx3D::Internal::M3DCommandResult*
+        setVerticesCoordinates(std::vector<Vertex*>& vertices,
+            std::vector<Point>& points);
+#endif
+
     /*------------------------------------------------------------------------*/
     /** \brief retourne la liste des arêtes communes à 2 faces communes, ou à 2 blocs
      */
@@ -2025,6 +2072,9 @@ private:
 
     /// Relation Geom --> Topo
     std::map<const Geom::GeomEntity*, std::vector<Topo::TopoEntity*>> m_geom_associations;
+
+    /// Index des cordes et feuillets
+    ChordIndex* m_chord_index;
 };
 /*----------------------------------------------------------------------------*/
 } // end namespace Topo
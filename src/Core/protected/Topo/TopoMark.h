@@ -0,0 +1,293 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file TopoMark.h
+ *
+ *  \date 19 oct. 2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef TOPOMARK_H_
+#define TOPOMARK_H_
+/*----------------------------------------------------------------------------*/
+#include "Utils/Common.h"
+/*----------------------------------------------------------------------------*/
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <vector>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Topo {
+/*----------------------------------------------------------------------------*/
+/// nombre d'emplacements de marques par entité (cf TopoMarks)
+static const uint TOPO_NB_MARK_SLOTS = 4;
+/*----------------------------------------------------------------------------*/
+/** \class TopoMarkManager
+ *  \brief Distribution des emplacements de marques des entités topologiques
+ *  (cf TopoMarks), à la manière des marques de GMDS.
+ *
+ *  Chaque réservation d'un emplacement reçoit une génération jamais encore
+ *  utilisée, ce qui rend caduques toutes les marques laissées dans cet
+ *  emplacement par les utilisations précédentes sans avoir à parcourir les
+ *  entités. Réservation et libération sont en O(1).
+ *
+ *  Il y a un gestionnaire par type d'entité (cf TopoFilter).
+ */
+/*----------------------------------------------------------------------------*/
+class TopoMarkManager {
+
+public:
+
+    TopoMarkManager();
+
+    /** Réserve un emplacement et une nouvelle génération
+     *  \return false si tous les emplacements sont déjà réservés */
+    bool acquire(uint& slot, unsigned long long& generation);
+
+    /// Libère un emplacement réservé
+    void release(uint slot);
+
+    /// dernière génération distribuée
+    unsigned long long getGeneration() const
+    { return m_generation.load(); }
+
+    /// génération de la dernière réservation d'un emplacement
+    unsigned long long getSlotGeneration(uint slot) const
+    { return m_slot_generations[slot].load(); }
+
+private:
+
+    TopoMarkManager(const TopoMarkManager&)
+    { MGX_FORBIDDEN("TopoMarkManager::TopoMarkManager is not allowed."); }
+    TopoMarkManager& operator = (const TopoMarkManager&)
+    { MGX_FORBIDDEN("TopoMarkManager::operator = is not allowed."); return *this; }
+
+    std::mutex m_mutex;
+
+    /// pile des emplacements libres
+    uint m_free[TOPO_NB_MARK_SLOTS];
+    uint m_nbFree;
+
+    /// dernière génération distribuée
+    std::atomic<unsigned long long> m_generation;
+
+    /// génération de la dernière réservation de chaque emplacement
+    std::atomic<unsigned long long> m_slot_generations[TOPO_NB_MARK_SLOTS];
+};
+/*----------------------------------------------------------------------------*/
+/** \class TopoMarks
+ *  \brief Marques portées par une entité topologique (cf TopoFilter).
+ *
+ *  Une seule génération est conservée pour tous les emplacements, avec un
+ *  bit par emplacement renseigné. Lorsque le gestionnaire a distribué une
+ *  nouvelle génération depuis le dernier accès, les emplacements réservés
+ *  à nouveau entre temps sont oubliés, ceux des filtres toujours en cours
+ *  restant valides.
+ *
+ *  Pas de protection contre les accès concurrents : une entité ne doit pas
+ *  être marquée par plusieurs threads à la fois, même dans des emplacements
+ *  différents.
+ */
+/*----------------------------------------------------------------------------*/
+class TopoMarks {
+
+public:
+
+    TopoMarks()
+    : m_generation(0)
+    , m_used(0)
+    {}
+
+    /** Valeur de la marque d'un emplacement réservé auprès de manager,
+     *  remise à 0 si elle date d'une utilisation précédente de l'emplacement.
+     *  \param isNew vrai en retour si la valeur vient d'être initialisée
+     */
+    uint& get(uint slot, const TopoMarkManager& manager, bool& isNew)
+    {
+        const unsigned long long generation = manager.getGeneration();
+        if (m_generation != generation){
+            for (uint s=0; s<TOPO_NB_MARK_SLOTS; s++)
+                if ((m_used & (1u<<s)) && manager.getSlotGeneration(s) > m_generation)
+                    m_used &= ~(1u<<s);
+            m_generation = generation;
+        }
+        isNew = !(m_used & (1u<<slot));
+        if (isNew){
+            m_used |= (1u<<slot);
+            m_values[slot] = 0;
+        }
+        return m_values[slot];
+    }
+
+private:
+
+    /// génération du gestionnaire lors du dernier accès
+    unsigned long long m_generation;
+
+    /// valeurs des emplacements, valides si leur bit de m_used est à 1
+    uint m_values[TOPO_NB_MARK_SLOTS];
+    unsigned char m_used;
+};
+/*----------------------------------------------------------------------------*/
+/** \class TopoFilter
+ *  \brief Filtre (marque à valeur entière) sur des entités topologiques de type T,
+ *  en remplacement des std::map<T*, uint>.
+ *
+ *  S'utilise comme un std::map<T*, uint> : l'accès par [] retourne 0 pour
+ *  une entité non encore vue et l'itération se fait sur les entités vues,
+ *  dans l'ordre des pointeurs. La valeur est stockée dans l'entité elle-même
+ *  (T::getMarks, accès direct, sans allocation), dans l'emplacement de
+ *  marque réservé pour la durée de vie du filtre.
+ *
+ *  Si plus aucun emplacement n'est disponible, le filtre se replie sur un
+ *  std::map.
+ */
+/*----------------------------------------------------------------------------*/
+template <typename T>
+class TopoFilter {
+
+public:
+
+    /// couple entité / valeur, à la manière de std::map::value_type
+    struct value_type {
+        T* first;
+        uint& second;
+    };
+
+    class iterator {
+    public:
+        struct pointer {
+            value_type m_value;
+            value_type* operator -> ()
+            { return &m_value; }
+        };
+
+        iterator(TopoFilter* filter, size_t index)
+        : m_filter(filter), m_index(index)
+        {}
+
+        value_type operator * () const
+        {
+            T* entity = m_filter->m_entities[m_index];
+            return value_type{entity, m_filter->value(entity)};
+        }
+
+        pointer operator -> () const
+        { return pointer{**this}; }
+
+        iterator& operator ++ ()
+        { m_index++; return *this; }
+
+        bool operator == (const iterator& it) const
+        { return m_index == it.m_index; }
+
+        bool operator != (const iterator& it) const
+        { return m_index != it.m_index; }
+
+    private:
+        TopoFilter* m_filter;
+        size_t m_index;
+    };
+
+    TopoFilter()
+    : m_slot(0)
+    , m_generation(0)
+    , m_hasSlot(manager().acquire(m_slot, m_generation))
+    , m_sorted(true)
+    {}
+
+    ~TopoFilter()
+    {
+        if (m_hasSlot)
+            manager().release(m_slot);
+    }
+
+    /// la valeur pour une entité, 0 si elle n'a pas encore été vue
+    uint& operator [] (T* entity)
+    {
+        bool isNew = false;
+        uint& val = (m_hasSlot && entity != 0) ?
+                entity->getMarks().get(m_slot, manager(), isNew) :
+                fallbackValue(entity, isNew);
+        if (isNew){
+            if (!m_entities.empty() && !std::less<T*>()(m_entities.back(), entity))
+                m_sorted = false;
+            m_entities.push_back(entity);
+        }
+        return val;
+    }
+
+    /** Itération sur les entités vues, triées suivant leur adresse.
+     *  Les entités vues pendant l'itération sont parcourues en dernier. */
+    iterator begin()
+    {
+        if (!m_sorted){
+            std::sort(m_entities.begin(), m_entities.end(), std::less<T*>());
+            m_sorted = true;
+        }
+        return iterator(this, 0);
+    }
+
+    iterator end()
+    { return iterator(this, m_entities.size()); }
+
+    size_t size() const
+    { return m_entities.size(); }
+
+    bool empty() const
+    { return m_entities.empty(); }
+
+    /// faux si plus aucun emplacement n'était disponible (repli sur un std::map)
+    bool usesMarks() const
+    { return m_hasSlot; }
+
+private:
+
+    /// valeur d'une entité déjà vue
+    uint& value(T* entity)
+    {
+        bool isNew = false;
+        return (m_hasSlot && entity != 0) ?
+                entity->getMarks().get(m_slot, manager(), isNew) :
+                fallbackValue(entity, isNew);
+    }
+
+    uint& fallbackValue(T* entity, bool& isNew)
+    {
+        auto res = m_fallback.insert(std::make_pair(entity, 0u));
+        isNew = res.second;
+        return res.first->second;
+    }
+
+    static TopoMarkManager& manager()
+    {
+        static TopoMarkManager mgr;
+        return mgr;
+    }
+
+    TopoFilter(const TopoFilter&)
+    { MGX_FORBIDDEN("TopoFilter::TopoFilter is not allowed."); }
+    TopoFilter& operator = (const TopoFilter&)
+    { MGX_FORBIDDEN("TopoFilter::operator = is not allowed."); return *this; }
+
+    /// emplacement et génération de la marque
+    uint m_slot;
+    unsigned long long m_generation;
+    bool m_hasSlot;
+
+    /// les entités vues
+    std::vector<T*> m_entities;
+    bool m_sorted;
+
+    /// cas sans emplacement disponible
+    std::map<T*, uint> m_fallback;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Topo
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* TOPOMARK_H_ */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,145 @@
+/*----------------------------------------------------------------------------*/
+/*
+ * \file TopoPreviewTask.h
+ *
+ *  \date 19 oct. 2026
+ */
+/*----------------------------------------------------------------------------*/
+#ifndef TOPOPREVIEWTASK_H_
+#define TOPOPREVIEWTASK_H_
+/*----------------------------------------------------------------------------*/
+#include "Topo/TopoDisplayRepresentation.h"
+#include "Utils/Common.h"
+/*----------------------------------------------------------------------------*/
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+/*----------------------------------------------------------------------------*/
+namespace Mgx3D {
+/*----------------------------------------------------------------------------*/
+namespace Topo {
+class CommandEditTopo;
+/*----------------------------------------------------------------------------*/
+/** \class TopoPreviewTask
+ *  \brief Calcul de l'aperçu d'une commande de modification de la topologie
+ *  dans un thread dédié (cf CommandEditTopo::computePreview).
+ *
+ *  Le calcul ne modifie pas la topologie, il peut être interrompu à tout
+ *  moment, par exemple lorsque les paramètres de la commande changent.
+ *
+ *  Toute modification de la topologie (exécution, annulation ou rejeu d'une
+ *  commande, aperçu par exécution d'une commande) doit être encadrée par une
+ *  instance de TopologyModification : les calculs en cours sont interrompus
+ *  en erreur et attendus, ceux lancés pendant la modification ne démarrent
+ *  qu'à son issue.
+ */
+/*----------------------------------------------------------------------------*/
+class TopoPreviewTask {
+
+public:
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Lance le calcul de l'aperçu
+     *
+     *  \param command la commande (qui doit savoir calculer son aperçu sans être
+     *  exécutée), détruite avec la tâche
+     *  \param completed appelée depuis le thread de calcul lorsque l'aperçu
+     *  est disponible ou en erreur, mais pas en cas d'interruption
+     */
+    TopoPreviewTask(CommandEditTopo* command, std::function<void()> completed);
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Destructeur, interrompt le calcul s'il est en cours
+     */
+    ~TopoPreviewTask();
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Interrompt le calcul et attend la fin du thread
+     */
+    void cancel();
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Attend la fin du calcul
+     */
+    void wait();
+
+    /*------------------------------------------------------------------------*/
+    /** \brief  Modification de la topologie pendant la durée de vie de
+     *  l'instance, les calculs d'aperçus étant interrompus et attendus par le
+     *  constructeur. Les modifications peuvent être simultanées ou imbriquées.
+     */
+    class TopologyModification {
+    public:
+        TopologyModification();
+        ~TopologyModification();
+    private:
+        TopologyModification(const TopologyModification&)
+        { MGX_FORBIDDEN("TopologyModification::TopologyModification is not allowed."); }
+        TopologyModification& operator = (const TopologyModification&)
+        { MGX_FORBIDDEN("TopologyModification::operator = is not allowed."); return *this; }
+    };
+
+    /// vrai lorsque le calcul est terminé (avec ou sans erreur)
+    bool isCompleted() const
+    { return m_isCompleted; }
+
+    /// l'aperçu, valide une fois le calcul terminé sans erreur
+    const TopoDisplayRepresentation& getRepresentation() const
+    { return m_representation; }
+
+    /// message d'erreur, vide si le calcul s'est bien passé
+    const std::string& getError() const
+    { return m_error; }
+
+private:
+
+    /// le calcul effectué dans le thread
+    void run();
+
+    TopoPreviewTask(const TopoPreviewTask&)
+    { MGX_FORBIDDEN("TopoPreviewTask::TopoPreviewTask is not allowed."); }
+    TopoPreviewTask& operator = (const TopoPreviewTask&)
+    { MGX_FORBIDDEN("TopoPreviewTask::operator = is not allowed."); return *this; }
+
+    /// la commande dont on calcule l'aperçu
+    CommandEditTopo* m_command;
+
+    /// signalement de la fin du calcul
+    std::function<void()> m_completed;
+
+    /// le résultat
+    TopoDisplayRepresentation m_representation;
+    std::string m_error;
+
+    /// demande d'interruption
+    std::atomic<bool> m_cancel;
+
+    /// interruption du calcul, demandée ou due à une modification de la topologie
+    std::atomic<bool> m_stop;
+
+    /// fin du calcul
+    std::atomic<bool> m_isCompleted;
+
+    std::thread m_thread;
+
+    /// protection des données partagées par les tâches et les modifications
+    static std::mutex s_mutex;
+    static std::condition_variable s_condition;
+    /// les tâches existantes
+    static std::set<TopoPreviewTask*> s_tasks;
+    /// nombre de modifications de la topologie en cours
+    static size_t s_modifications;
+    /// nombre de calculs d'aperçus en cours
+    static size_t s_computations;
+};
+/*----------------------------------------------------------------------------*/
+} // end namespace Topo
+/*----------------------------------------------------------------------------*/
+} // end namespace Mgx3D
+/*----------------------------------------------------------------------------*/
+#endif /* TOPOPREVIEWTASK_H_ */
+/*----------------------------------------------------------------------------*/
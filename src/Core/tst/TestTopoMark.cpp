@@ -0,0 +1,185 @@
+/**
+ * \file		TestTopoMark.cpp
+ * \date		19/10/2026
+ *
+ * Vérifie les marques des entités topologiques (TopoFilter, TopoMarks,
+ * TopoMarkManager) : valeurs et itération, filtres imbriqués, réutilisation
+ * d'un emplacement, épuisement des emplacements et libération lors d'une
+ * exception.
+ */
+
+#include "Topo/TopoMark.h"
+
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+
+using namespace std;
+using namespace Mgx3D::Topo;
+
+
+/** Entité minimale, ne porte que les marques comme TopoEntity. */
+struct TestEntity
+{
+	TopoMarks& getMarks ( ) const
+	{ return m_marks; }
+
+	mutable TopoMarks	m_marks;
+};	// struct TestEntity
+
+
+static int	errors	= 0;
+
+#define CHECK(condition)                                                      \
+if (false == (condition))                                                     \
+{                                                                             \
+	cerr << __FILE__ << ':' << __LINE__ << " : " << #condition << endl;       \
+	errors++;                                                                 \
+}
+
+
+/** Marque les entités avec leur rang + 1 et vérifie les valeurs relues et
+ * l'itération suivant l'adresse. */
+static void checkFilter (TopoFilter<TestEntity>& filter, vector<TestEntity>& entities)
+{
+	for (size_t i = entities.size ( ); i > 0; i--)
+		filter [&entities [i - 1]]	= i;
+	CHECK (entities.size ( ) == filter.size ( ))
+	for (size_t i = 0; i < entities.size ( ); i++)
+		CHECK (i + 1 == filter [&entities [i]])
+	CHECK (entities.size ( ) == filter.size ( ))
+
+	size_t	i	= 0;
+	for (TopoFilter<TestEntity>::iterator it = filter.begin ( ); it != filter.end ( ); ++it, i++)
+	{
+		CHECK (&entities [i] == it->first)
+		CHECK (i + 1 == it->second)
+	}
+	CHECK (entities.size ( ) == i)
+}	// checkFilter
+
+
+int main (int, char*[])
+{
+	vector<TestEntity>	entities (10);
+
+	// Valeurs, entités non vues et itération triée :
+	{
+		TopoFilter<TestEntity>	filter;
+		CHECK (true == filter.usesMarks ( ))
+		CHECK (true == filter.empty ( ))
+		checkFilter (filter, entities);
+		filter [&entities [3]]	= 7;
+		CHECK (7 == filter [&entities [3]])
+		CHECK (entities.size ( ) == filter.size ( ))
+	}
+
+	// Un nouveau filtre ne voit pas les marques du précédent, même s'il
+	// réutilise son emplacement :
+	{
+		TopoFilter<TestEntity>	filter;
+		CHECK (true == filter.usesMarks ( ))
+		for (size_t i = 0; i < entities.size ( ); i++)
+			CHECK (0 == filter [&entities [i]])
+	}
+
+	// Filtres imbriqués, chacun avec ses valeurs :
+	{
+		TopoFilter<TestEntity>	outer;
+		outer [&entities [0]]	= 1;
+		outer [&entities [1]]	= 2;
+		{
+			TopoFilter<TestEntity>	inner;
+			CHECK (true == inner.usesMarks ( ))
+			CHECK (0 == inner [&entities [0]])
+			inner [&entities [0]]	= 10;
+			inner [&entities [2]]	= 30;
+			CHECK (2 == inner.size ( ))
+			CHECK (1 == outer [&entities [0]])
+			CHECK (2 == outer [&entities [1]])
+			CHECK (10 == inner [&entities [0]])
+		}
+		// L'emplacement du filtre interne est réutilisé par un autre filtre
+		// sans effacer les marques du filtre externe :
+		TopoFilter<TestEntity>	other;
+		CHECK (0 == other [&entities [0]])
+		CHECK (0 == other [&entities [2]])
+		CHECK (1 == outer [&entities [0]])
+		CHECK (2 == outer [&entities [1]])
+		CHECK (2 == outer.size ( ))
+	}
+
+	// Epuisement des emplacements : les filtres en trop se replient sur un
+	// std::map et restent exacts :
+	{
+		vector<TopoFilter<TestEntity>*>	filters;
+		for (uint i = 0; i < TOPO_NB_MARK_SLOTS + 2; i++)
+			filters.push_back (new TopoFilter<TestEntity> ( ));
+		for (uint i = 0; i < filters.size ( ); i++)
+		{
+			CHECK ((i < TOPO_NB_MARK_SLOTS) == filters [i]->usesMarks ( ))
+			(*filters [i]) [&entities [i % entities.size ( )]]	= i + 1;
+		}
+		for (uint i = 0; i < filters.size ( ); i++)
+		{
+			CHECK (1 == filters [i]->size ( ))
+			CHECK (i + 1 == (*filters [i]) [&entities [i % entities.size ( )]])
+			CHECK (0 == (*filters [i]) [&entities [(i + 1) % entities.size ( )]])
+			checkFilter (*filters [i], entities);
+		}
+		for (size_t i = 0; i < filters.size ( ); i++)
+			delete filters [i];
+	}
+
+	// Gestionnaire seul : réservation, épuisement, libération, générations :
+	{
+		TopoMarkManager		manager;
+		uint				slots [TOPO_NB_MARK_SLOTS];
+		unsigned long long	generation	= 0, previous	= 0;
+		for (uint i = 0; i < TOPO_NB_MARK_SLOTS; i++)
+		{
+			CHECK (true == manager.acquire (slots [i], generation))
+			CHECK (generation > previous)
+			CHECK (generation == manager.getGeneration ( ))
+			CHECK (generation == manager.getSlotGeneration (slots [i]))
+			previous	= generation;
+		}
+		uint	slot	= 0;
+		CHECK (false == manager.acquire (slot, generation))
+		manager.release (slots [1]);
+		CHECK (true == manager.acquire (slot, generation))
+		CHECK (slots [1] == slot)
+		CHECK (generation > previous)
+		for (uint i = 0; i < TOPO_NB_MARK_SLOTS; i++)
+			manager.release (slots [i]);
+	}
+
+	// Libération des emplacements lors d'une exception :
+	try
+	{
+		TopoFilter<TestEntity>	filters [TOPO_NB_MARK_SLOTS];
+		for (uint i = 0; i < TOPO_NB_MARK_SLOTS; i++)
+		{
+			CHECK (true == filters [i].usesMarks ( ))
+			filters [i][&entities [0]]	= 1;
+		}
+		throw runtime_error ("interruption");
+	}
+	catch (const runtime_error&)
+	{
+	}
+	{
+		TopoFilter<TestEntity>	filters [TOPO_NB_MARK_SLOTS];
+		for (uint i = 0; i < TOPO_NB_MARK_SLOTS; i++)
+		{
+			CHECK (true == filters [i].usesMarks ( ))
+			CHECK (0 == filters [i][&entities [0]])
+		}
+	}
+
+	if (0 != errors)
+		cerr << errors << " erreur(s)." << endl;
+
+	return 0 == errors ? 0 : 1;
+}	// main
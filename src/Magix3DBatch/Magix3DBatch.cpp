@@ -10,6 +10,7 @@
 #include "Internal/Mgx3DArguments.h"
 #include "Internal/Resources.h"
 #include "Utils/CommandManager.h"
+#include "Utils/Profiler.h"
 
 #include <TkUtil/ArgumentsMap.h>
 #include <TkUtil/Exception.h>
@@ -39,6 +40,9 @@ using namespace std;
 // Les scripts python Magix 3D à exécuter :
 static vector<string>		scripts;
 
+// L'éventuel fichier recevant les mesures du profilage (format Trace Event) :
+static string				profileFile;
+
 
 //-----------------------------------------------------------------------------
 int parseArgs (int argc, char *argv[])
@@ -66,6 +70,11 @@ int parseArgs (int argc, char *argv[])
 		}	// for (size_t s = argc - 1; s > 0; s--)
 	}	// else if (last.getExtension ( ) != "py")
 	
+	// Profilage des commandes ?
+	for (int a = 1; a < argc - 1; a++)
+		if ((string ("-profile") == argv [a]) || (string ("--profile") == argv [a]))
+			profileFile	= argv [a + 1];
+
 	// Il faut au moins un script :
 	if (0 == scripts.size ( ))
 	{
@@ -96,6 +105,7 @@ int syntax (const string& pgm)
 	     << "OU" << endl
 	     << pgm << " script.py" << endl
 	     << "--script s.py .................. : script à exécuter (usage multiple possible). Peut ne pas être précédé de --script mais doit alors être le dernier argument de ligne de commande." << endl
+	     << "--profile trace.json ........... : profile les commandes, enregistre les mesures dans trace.json (format Trace Event, chrome://tracing ou ui.perfetto.dev) et affiche un récapitulatif en fin d'exécution." << endl
 	     << endl;
 
 	return 1;
@@ -126,6 +136,9 @@ int main (int argc, char *argv[], char* envp[])
 	if (0 != parseArgs (argc, argv))	// Transfert les arguments spécifiques au serveur aux variables intéressées
 		return syntax (argv [0]);
 
+	if (false == profileFile.empty ( ))
+		Profiler::instance ( ).setEnabled (true);
+
 	// Durée à partir de laquelle il est décidé d'exécuter une commande dans un thread :
 	CommandManager::sequentialDuration	= 5;
 	
@@ -158,6 +171,15 @@ cout << "PROCESSING SCRIPT " << *its << " ..." << endl;
 cout << "SCRIPT " << *its << " PROCESSED." << endl;
 	}	// for (vector<string>::const_iterator its = scripts.begin ( ); scripts.end ( ) != its; its++)
 
+	if (false == profileFile.empty ( ))
+	{
+		context->getCommandManager ( ).wait ( );	// Commandes éventuellement en cours dans des threads
+		Profiler::instance ( ).setEnabled (false);
+		Profiler::instance ( ).writeChromeTrace (profileFile);
+		cout << "PROFILING :" << endl << Profiler::instance ( ).getSummary ( )
+		     << "Mesures enregistrées dans le fichier " << profileFile << "." << endl;
+	}	// if (false == profileFile.empty ( ))
+
 	}	// try
 	catch (const Exception& exc)
 	{
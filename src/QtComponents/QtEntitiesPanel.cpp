@@ -10,6 +10,7 @@
 #include "Internal/EntitiesHelper.h"
 #include "Internal/InternalPreferences.h"
 #include "QtComponents/QtEntitiesPanel.h"
+#include "QtComponents/QtExpansionTreeRestorer.h"
 #include "QtComponents/QtMgx3DApplication.h"
 #include <QtUtil/QtErrorManagement.h>
 #include "QtComponents/RenderedEntityRepresentation.h"
@@ -26,6 +27,8 @@
 #include <QThread>
 
 #include <assert.h>
+#include <map>
+#include <set>
 
 
 using namespace std;
@@ -964,7 +967,7 @@ QtEntitiesPanel::QtEntitiesPanel (
 	  _topoVerticesItem (0),
 	  _meshVolumesItem (0), _meshSurfacesItem (0), _meshLinesItem (0),
 	  _meshCloudsItem (0), _sysCoordItem(0), _structuredMeshVolumesItem (0),
-	  _treeViewPopupMenu (0), _treeViewActions ( )
+	  _entitiesItems ( ), _treeViewPopupMenu (0), _treeViewActions ( )
 {
 	createGui ( );
 	createPopupMenu ( );
@@ -983,7 +986,7 @@ QtEntitiesPanel::QtEntitiesPanel (const QtEntitiesPanel& ep)
 	  _topoVerticesItem (0),
 	  _meshVolumesItem (0), _meshSurfacesItem (0), _meshLinesItem (0),
 	  _meshCloudsItem (0), _sysCoordItem(0), _structuredMeshVolumesItem (0),
-	  _treeViewPopupMenu (0), _treeViewActions ( )
+	  _entitiesItems ( ), _treeViewPopupMenu (0), _treeViewActions ( )
 {
 	MGX_FORBIDDEN ("QtEntitiesPanel copy constructor is not allowed.");
 }	// QtEntitiesPanel::QtEntitiesPanel (const QtEntitiesPanel&)
@@ -1085,6 +1088,7 @@ assert (0 && "QtEntitiesPanel::removeCADEntity is deprecated");
 			if (0 != getGraphicalWidget ( ))
 				getGraphicalWidget ( )->getRenderingManager ( ).removeEntity (entity);
 			parent->takeChild (i);
+			_entitiesItems.erase (&entity);
 			delete item;
 			break;
 		}	// if ((0 != item) && (&entity == item->getEntity ( )))
@@ -1101,20 +1105,8 @@ void QtEntitiesPanel::removeCADEntities (
 	     entities.end ( ) != it; it++)
 	{
 		list.push_back (*it);
-		QTreeWidgetItem*	parent	= getCADEntryItem ((*it)->getDim ( ));
-		CHECK_NULL_PTR_ERROR (parent)
-		for (size_t i = 0; i < parent->childCount ( ); i++)
-		{
-			QtCADEntityTreeWidgetItem*	item	=
-				dynamic_cast<QtCADEntityTreeWidgetItem*>(parent->child (i));	
-			if ((0 != item) && (*it == item->getEntity ( )))
-			{
-				parent->takeChild (i);
-				delete item;
-				break;
-			}	// if ((0 != item) && (&entity == item->getEntity ( )))
-		}	// for (size_t i = 0; i < parent->childCount ( ); i++)
 	}	// for (vector<Geom::GeomEntity*>::const_iterator it = entities.begin ( );
+	removeItems (list);
 	if (0 != entities.size ( ))
 		updateEntryItems (DisplayRepresentation::DISPLAY_GEOM);
 
@@ -1192,6 +1184,7 @@ assert (0 && "QtEntitiesPanel::removeTopologicEntity is deprecated");
 			if (0 != getGraphicalWidget ( ))
 				getGraphicalWidget ( )->getRenderingManager ( ).removeEntity (entity);
 			parent->takeChild (i);
+			_entitiesItems.erase (&entity);
 			delete item;
 			break;
 		}	// if ((0 != item) && (&entity == item->getEntity ( )))
@@ -1208,20 +1201,8 @@ void QtEntitiesPanel::removeTopologicEntities (
 	     entities.end ( ) != it; it++)
 	{
 		list.push_back (*it);
-		QTreeWidgetItem*	parent	= getTopologicEntryItem ((*it)->getDim ( ));
-		CHECK_NULL_PTR_ERROR (parent)
-		for (size_t i = 0; i < parent->childCount ( ); i++)
-		{
-			QtTopologicEntityTreeWidgetItem*	item	=
-				dynamic_cast<QtTopologicEntityTreeWidgetItem*>(parent->child (i));	
-			if ((0 != item) && (*it == item->getEntity ( )))
-			{
-				parent->takeChild (i);
-				delete item;
-				break;
-			}	// if ((0 != item) && (&entity == item->getEntity ( )))
-		}	// for (size_t i = 0; i < parent->childCount ( ); i++)
 	}	// for (vector<Topo::TopoEntity*>::const_iterator it = entities.begin ( );
+	removeItems (list);
 	if (0 != entities.size ( ))
 		updateEntryItems (DisplayRepresentation::DISPLAY_TOPO);
 
@@ -1297,6 +1278,7 @@ assert (0 && "QtEntitiesPanel::removeMeshEntity is deprecated");
 			if (0 != getGraphicalWidget ( ))
 				getGraphicalWidget ( )->getRenderingManager ( ).removeEntity (entity);
 			parent->takeChild (i);
+			_entitiesItems.erase (&entity);
 			delete item;
 			break;
 		}	// if ((0 != item) && (&entity == item->getEntity ( )))
@@ -1312,20 +1294,8 @@ void QtEntitiesPanel::removeMeshEntities (const vector<Mesh::MeshEntity*>& entit
 	     entities.end ( ) != it; it++)
 	{
 		list.push_back (*it);
-		QTreeWidgetItem*	parent	= getMeshEntryItem ((*it)->getDim ( ));
-		CHECK_NULL_PTR_ERROR (parent)
-		for (size_t i = 0; i < parent->childCount ( ); i++)
-		{
-			QtMeshEntityTreeWidgetItem*	item	=
-				dynamic_cast<QtMeshEntityTreeWidgetItem*>(parent->child (i));	
-			if ((0 != item) && (*it == item->getEntity ( )))
-			{
-				parent->takeChild (i);
-				delete item;
-				break;
-			}	// if ((0 != item) && (&entity == item->getEntity ( )))
-		}	// for (size_t i = 0; i < parent->childCount ( ); i++)
 	}	// for (vector<Geom::MeshEntity*>::const_iterator it = entities.begin ( );
+	removeItems (list);
 	if (0 != entities.size ( ))
 		updateEntryItems (DisplayRepresentation::DISPLAY_MESH);
 
@@ -1352,21 +1322,14 @@ void QtEntitiesPanel::addSysCoordEntity (Mgx3D::CoordinateSystem::SysCoord& enti
 
 void QtEntitiesPanel::removeSysCoordEntity (Mgx3D::CoordinateSystem::SysCoord& entity)
 {
-	QTreeWidgetItem*	parent	= getSysCoordEntryItem ();
-	CHECK_NULL_PTR_ERROR (parent)
-	for (size_t i = 0; i < parent->childCount ( ); i++)
-	{
-		QtSysCoordEntityTreeWidgetItem*	item	=
-				dynamic_cast<QtSysCoordEntityTreeWidgetItem*>(parent->child (i));
-		if ((0 != item) && (&entity == item->getEntity ( )))
-		{
-			if (0 != getGraphicalWidget ( ))
-				getGraphicalWidget ( )->getRenderingManager ( ).removeEntity (entity);
-			parent->takeChild (i);
-			delete item;
-			break;
-		}	// if ((0 != item) && (&entity == item->getEntity ( )))
-	}	// for (size_t i = 0; i < parent->childCount ( ); i++)
+	if (0 == getItem (entity))
+		return;
+
+	if (0 != getGraphicalWidget ( ))
+		getGraphicalWidget ( )->getRenderingManager ( ).removeEntity (entity);
+	vector<Utils::Entity*>	list;
+	list.push_back (&entity);
+	removeItems (list);
 }	// QtEntitiesPanel::removeSysCoordEntity
 
 
@@ -1433,6 +1396,7 @@ assert (0 && "QtEntitiesPanel::removeStructuredMeshEntity is deprecated");
 			if (0 != getGraphicalWidget ( ))
 				getGraphicalWidget ( )->getRenderingManager ( ).removeEntity (entity);
 			parent->takeChild (i);
+			_entitiesItems.erase (&entity);
 			delete item;
 			break;
 		}	// if ((0 != item) && (&entity == item->getEntity ( )))
@@ -1448,20 +1412,8 @@ void QtEntitiesPanel::removeStructuredMeshEntities (const vector<Structured::Str
 	     entities.end ( ) != it; it++)
 	{
 		list.push_back (*it);
-		QTreeWidgetItem*	parent	= getStructuredMeshEntryItem ((*it)->getDim ( ));
-		CHECK_NULL_PTR_ERROR (parent)
-		for (size_t i = 0; i < parent->childCount ( ); i++)
-		{
-			QtStructuredMeshEntityTreeWidgetItem*	item	=
-				dynamic_cast<QtStructuredMeshEntityTreeWidgetItem*>(parent->child (i));	
-			if ((0 != item) && (*it == item->getEntity ( )))
-			{
-				parent->takeChild (i);
-				delete item;
-				break;
-			}	// if ((0 != item) && (&entity == item->getEntity ( )))
-		}	// for (size_t i = 0; i < parent->childCount ( ); i++)
 	}	// for (vector<Structured::StructuredMeshEntity*>::const_iterator it = entities.begin ( );
+	removeItems (list);
 	if (0 != entities.size ( ))
 		updateEntryItems (DisplayRepresentation::DISPLAY_STRUCTURED_MESH);
 
@@ -1559,6 +1511,7 @@ void QtEntitiesPanel::sessionCleared ( )
 	clearEntityTreeWidgetItemList (*_meshCloudsItem);
 	clearEntityTreeWidgetItemList (*_sysCoordItem);
 	clearEntityTreeWidgetItemList (*_structuredMeshVolumesItem);
+	_entitiesItems.clear ( );
 }	// QtEntitiesPanel::sessionCleared
 
 
@@ -1827,6 +1780,7 @@ void QtEntitiesPanel::selectionChanged (
 
 	// Eviter des calculs sur une sélection qui va être détruite => on commence
 	// par deselectedEntities.
+	SelectionManager::NotificationLocker	notificationLocker (*getSelectionManager ( ));
 	getSelectionManager ( )->removeFromSelection (deselectedEntities);
 	getSelectionManager ( )->addToSelection (selectedEntities);
 }	// QtEntitiesPanel::selectionChanged
@@ -1834,95 +1788,64 @@ void QtEntitiesPanel::selectionChanged (
 
 QtEntityTreeWidgetItem* QtEntitiesPanel::getItem (const Mgx3D::Utils::Entity& entity)
 {
-	QTreeWidgetItem*			parent		= 0;
-	const Geom::GeomEntity*			geomEntity	= dynamic_cast<const Geom::GeomEntity*>(&entity);
-	const Topo::TopoEntity*			topoEntity	= dynamic_cast<const Topo::TopoEntity*>(&entity);
-	const Mesh::MeshEntity*			meshEntity	= dynamic_cast<const Mesh::MeshEntity*>(&entity);
-	const CoordinateSystem::SysCoord*	repEntity	= dynamic_cast<const CoordinateSystem::SysCoord*>(&entity);
-	const Structured::StructuredMeshEntity*	structuredMeshEntity= dynamic_cast<const Structured::StructuredMeshEntity*>(&entity);
-	if (0 != geomEntity)
-	{
-		parent	= _cadItem;
-		for (size_t i = 0; i < parent->childCount ( ); i++)
-		{
-			QTreeWidgetItem*	group	= parent->child (i);
-			assert (0 != group);
-			for (size_t g = 0; g < group->childCount ( ); g++)
-			{
-				QtCADEntityTreeWidgetItem*	item	=
-					dynamic_cast<QtCADEntityTreeWidgetItem*>(group->child (g));	
-				if ((0 != item) && (&entity == item->getEntity ( )))
-					return item;
-			}	// for (size_t g = 0; g < group->childCount ( ); g++)
-		}	// for (size_t i = 0; i < parent->childCount ( ); i++)
-	}	// if (0 != geomEntity)
-	else if (0 != topoEntity)
-	{
-		parent	= _topologyItem;
-		for (size_t i = 0; i < parent->childCount ( ); i++)
-		{
-			QTreeWidgetItem*	group	= parent->child (i);
-			assert (0 != group);
-			for (size_t g = 0; g < group->childCount ( ); g++)
-			{
-				QtTopologicEntityTreeWidgetItem*	item	=
-					dynamic_cast<QtTopologicEntityTreeWidgetItem*>(group->child (g));	
-				if ((0 != item) && (&entity == item->getEntity ( )))
-					return item;
-			}	// for (size_t g = 0; g < group->childCount ( ); g++)
-		}	// for (size_t i = 0; i < parent->childCount ( ); i++)
-	}	// else if (0 != topoEntity)
-	else if (0 != meshEntity)
+	unordered_map<const Entity*, QtEntityTreeWidgetItem*>::const_iterator	it	=
+												_entitiesItems.find (&entity);
+
+	return _entitiesItems.end ( ) == it ? 0 : (*it).second;
+}	// QtEntitiesPanel::getItem
+
+
+void QtEntitiesPanel::removeItems (const vector<Utils::Entity*>& entities)
+{
+	// Regroupement par entrée des items à détruire :
+	map<QTreeWidgetItem*, set<QTreeWidgetItem*> >	removed;
+	for (vector<Utils::Entity*>::const_iterator it = entities.begin ( );
+	     entities.end ( ) != it; it++)
 	{
-		parent	= _meshingItem;
-		for (size_t i = 0; i < parent->childCount ( ); i++)
-		{
-			QTreeWidgetItem*	group	= parent->child (i);
-			assert (0 != group);
-			for (size_t g = 0; g < group->childCount ( ); g++)
-			{
-				QtMeshEntityTreeWidgetItem*	item	=
-					dynamic_cast<QtMeshEntityTreeWidgetItem*>(group->child (g));	
-				if ((0 != item) && (&entity == item->getEntity ( )))
-					return item;
-			}	// for (size_t g = 0; g < group->childCount ( ); g++)
-		}	// for (size_t i = 0; i < parent->childCount ( ); i++)
-	}	// else if (0 != meshEntity)
-	else if (0 != repEntity)
+		unordered_map<const Entity*, QtEntityTreeWidgetItem*>::iterator	iti	=
+													_entitiesItems.find (*it);
+		if (_entitiesItems.end ( ) == iti)
+			continue;
+		QtEntityTreeWidgetItem*	item	= (*iti).second;
+		_entitiesItems.erase (iti);
+		if (0 != item->parent ( ))
+			removed [item->parent ( )].insert (item);
+		else
+			delete item;
+	}	// for (vector<Utils::Entity*>::const_iterator it = entities.begin ( ); ...
+
+	for (map<QTreeWidgetItem*, set<QTreeWidgetItem*> >::iterator itr =
+				removed.begin ( ); removed.end ( ) != itr; itr++)
 	{
-		parent	= _coordinateSystemItem;
-		for (size_t i = 0; i < parent->childCount ( ); i++)
+		QTreeWidgetItem*			parent	= (*itr).first;
+		const set<QTreeWidgetItem*>&	items	= (*itr).second;
+		if (1 == items.size ( ))
 		{
-			QTreeWidgetItem*	group	= parent->child (i);
-			assert (0 != group);
-			for (size_t g = 0; g < group->childCount ( ); g++)
-			{
-				QtSysCoordEntityTreeWidgetItem*	item	=
-					dynamic_cast<QtSysCoordEntityTreeWidgetItem*>(group->child (g));
-				if ((0 != item) && (&entity == item->getEntity ( )))
-					return item;
-			}	// for (size_t g = 0; g < group->childCount ( ); g++)
-		}	// for (size_t i = 0; i < parent->childCount ( ); i++)
-	}	// else if (0 != repEntity)
-	else if (0 != structuredMeshEntity)
-	{
-		parent	= _structuredMeshingItem;
-		for (size_t i = 0; i < parent->childCount ( ); i++)
+			parent->removeChild (*items.begin ( ));
+			delete *items.begin ( );
+			continue;
+		}	// if (1 == items.size ( ))
+
+		// Retrait en une seule opération (un seul signal émis par le modèle) :
+		// la recherche de chaque item parmi les enfants est évitée.
+		QtExpansionTreeRestorer	restorer;
+		for (int i = 0; i < parent->childCount ( ); i++)
+			if (items.end ( ) == items.find (parent->child (i)))
+				restorer.record (*(parent->child (i)));
+		QList<QTreeWidgetItem*>	children	= parent->takeChildren ( );
+		QList<QTreeWidgetItem*>	kept;
+		kept.reserve (children.size ( ) - items.size ( ));
+		for (int i = 0; i < children.size ( ); i++)
 		{
-			QTreeWidgetItem*	group	= parent->child (i);
-			assert (0 != group);
-			for (size_t g = 0; g < group->childCount ( ); g++)
-			{
-				QtStructuredMeshEntityTreeWidgetItem*	item	=
-					dynamic_cast<QtStructuredMeshEntityTreeWidgetItem*>(group->child (g));	
-				if ((0 != item) && (&entity == item->getEntity ( )))
-					return item;
-			}	// for (size_t g = 0; g < group->childCount ( ); g++)
-		}	// for (size_t i = 0; i < parent->childCount ( ); i++)
-	}	// else if (0 != structuredMeshEntity)
-
-	return 0;
-}	// QtEntitiesPanel::getItem
+			if (items.end ( ) == items.find (children.at (i)))
+				kept.append (children.at (i));
+			else
+				delete children.at (i);
+		}	// for (int i = 0; i < children.size ( ); i++)
+		parent->addChildren (kept);
+		restorer.restore ( );
+	}	// for (map<QTreeWidgetItem*, set<QTreeWidgetItem*> >::iterator itr = ...
+}	// QtEntitiesPanel::removeItems
 
 
 QTreeWidgetItem* QtEntitiesPanel::createEntryItem (
@@ -1950,6 +1873,7 @@ QtCADEntityTreeWidgetItem* QtEntitiesPanel::createCADItem (Geom::GeomEntity& ent
 	// setHidden (false) : corrige un bogue où de temps en temps les items ne
 	// sont pas visibles ???
 	item->setHidden (false);
+	_entitiesItems [&entity]	= item;
 
 	return item;
 }	// QtEntitiesPanel::createCADItem
@@ -1989,6 +1913,7 @@ QtTopologicEntityTreeWidgetItem* QtEntitiesPanel::createTopologicItem (Topo::Top
 	// sont pas visibles ??? (mais bien existant : cocher le parent provoque
 	// la visibilité des enfants invisibles).
 	item->setHidden (false);
+	_entitiesItems [&entity]	= item;
 
 	return item;
 }	// QtEntitiesPanel::createTopologicItem
@@ -2027,6 +1952,7 @@ QtMeshEntityTreeWidgetItem* QtEntitiesPanel::createMeshItem (Mesh::MeshEntity& e
 	// setHidden (false) : corrige un bogue où de temps en temps les items ne
 	// sont pas visibles ???
 	item->setHidden (false);
+	_entitiesItems [&entity]	= item;
 
 	return item;
 }	// QtEntitiesPanel::createMeshItem
@@ -2064,6 +1990,7 @@ QtSysCoordEntityTreeWidgetItem* QtEntitiesPanel::createSysCoordItem (Mgx3D::Coor
 	// setHidden (false) : corrige un bogue où de temps en temps les items ne
 	// sont pas visibles ???
 	item->setHidden (false);
+	_entitiesItems [&entity]	= item;
 
 	return item;
 }	// QtEntitiesPanel::createSysCoordItem
@@ -2088,6 +2015,7 @@ QtStructuredMeshEntityTreeWidgetItem* QtEntitiesPanel::createStructuredMeshItem
 	// setHidden (false) : corrige un bogue où de temps en temps les items ne
 	// sont pas visibles ???
 	item->setHidden (false);
+	_entitiesItems [&entity]	= item;
 
 	return item;
 }	// QtEntitiesPanel::createStructuredMeshItem
@@ -193,12 +193,12 @@ void QtExtremaMeshingEdgeLengthOnEdgePanel::commandModifiedCallback (
 
 	bool	reinited	= false;
 
-	std::map<Topo::TopoEntity*, InfoCommand::type> tei = infoCommand.getTopoInfoEntity();
+	std::vector<InfoCommand::TopoEntityInfo> tei = infoCommand.getTopoInfoEntity();
 	const Topo::CoEdge* coedge = getCoEdge();
-	for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::const_iterator iter = tei.begin();
-			(false == reinited) && (iter != tei.end()); ++iter) {
-		Topo::TopoEntity* te = iter->first;
-		InfoCommand::type  t = iter->second;
+	for (uint i_tei=0;
+			(false == reinited) && (i_tei<tei.size()); i_tei++) {
+		Topo::TopoEntity* te = tei[i_tei].m_topo_entity;
+		InfoCommand::type  t = tei[i_tei].m_type;
 		if (te == coedge)
 		{
 			if (InfoCommand::DELETED == t)
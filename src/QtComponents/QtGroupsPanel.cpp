@@ -45,7 +45,9 @@
 #include <QThread>
 #include <QString>
 
+#include <algorithm>
 #include <assert.h>
+#include <set>
 
 
 using namespace std;
@@ -65,6 +67,66 @@ namespace QtComponents
 const int	WIRE_COLUMN	= 1, SOLID_COLUMN	= (WIRE_COLUMN+1);
 
 
+/**
+ * \return		<I>true</I> si le tri des groupes est croissant.
+ */
+static bool ascendingSort ( )
+{
+	return 0 == Resources::instance ( )._sortType.getValue ( ).ascii ( ).compare ("typeAscendingName") ? true : false;
+}	// ascendingSort
+
+
+/**
+ * Relation d'ordre stricte sur les libellés des items.
+ */
+struct TypeNameOrder
+{
+	TypeNameOrder (bool ascending)
+		: _ascending (ascending)
+	{ }
+
+	bool operator ( ) (const QTreeWidgetItem* left, const QTreeWidgetItem* right) const
+	{
+		const int	cmp	= left->text (0).compare (right->text (0));
+
+		return true == _ascending ? cmp < 0 : cmp > 0;
+	}	// operator ( )
+
+	bool	_ascending;
+};	// struct TypeNameOrder
+
+
+/**
+ * Place à son rang le dernier enfant de <I>parent</I>, les autres enfants
+ * étant supposés triés. Coût logarithmique en nombre de comparaisons, un seul
+ * déplacement d'item.
+ */
+static void placeLastChild (QTreeWidgetItem& parent)
+{
+	const int	count	= parent.childCount ( );
+	if (2 > count)
+		return;
+
+	QTreeWidgetItem*		item	= parent.child (count - 1);
+	const TypeNameOrder		order (ascendingSort ( ));
+	int						first	= 0, last	= count - 1;
+	while (first < last)
+	{	// upper bound : les items de même libellé conservent leur ordre d'arrivée
+		const int	middle	= (first + last) / 2;
+		if (true == order (item, parent.child (middle)))
+			last	= middle;
+		else
+			first	= middle + 1;
+	}	// while (first < last)
+
+	if (first != count - 1)
+	{
+		parent.takeChild (count - 1);
+		parent.insertChild (first, item);
+	}	// if (first != count - 1)
+}	// placeLastChild
+
+
 static QAction* createAction (QMenu& parent, const QString& label, const QString& whatsThis, const char* method, QObject* receiver, bool checkable, THREESTATES state)
 {
 	QAction*	action	= new QAction (label, &parent);
@@ -436,7 +498,7 @@ QtGroupsPanel::QtGroupsPanel (QWidget* parent, QtMgx3DMainWindow* mainWindow, co
 	: QtEntitiesItemViewPanel (parent, mainWindow, name, context),
 	  SelectionManagerObserver (&context.getSelectionManager ( )),
 	  _entitiesTypesWidget (0), _entitiesGroupsWidget (0),
-	  _typesItems ( ), _groupsEntriesItems ( ), _levelsEntriesItems ( ),
+	  _typesItems ( ), _groupsEntriesItems ( ), _levelsEntriesItems ( ), _groupsItems ( ),
 	  //_groupsPropagationCheckBox (0),
 	  _typesPopupMenu (0), _groupsPopupMenu (0),
 	  _uncheckedCheckboxes (FilterEntity::NoneEntity),
@@ -456,7 +518,7 @@ QtGroupsPanel::QtGroupsPanel (QWidget* parent, QtMgx3DMainWindow* mainWindow, co
 QtGroupsPanel::QtGroupsPanel (const QtGroupsPanel& gp)
 	: QtEntitiesItemViewPanel (gp), SelectionManagerObserver (0),
 	  _entitiesTypesWidget (0), _entitiesGroupsWidget (0),
-	  _typesItems ( ), _groupsEntriesItems ( ), _levelsEntriesItems ( ),
+	  _typesItems ( ), _groupsEntriesItems ( ), _levelsEntriesItems ( ), _groupsItems ( ),
 	  //_groupsPropagationCheckBox (0),
 	  _wireGeomVolumeButton (0), _solidGeomVolumeButton (0), _wireGeomSurfaceButton (0), _solidGeomSurfaceButton (0),
 	  _wireTopoBlockButton (), _solidTopoBlockButton (0), _wireTopoCoFaceButton (0), _solidTopoCoFaceButton (0), _wireTopoCoEdgeButton (0),
@@ -587,33 +649,60 @@ void QtGroupsPanel::addGroups (const vector<Group::GroupEntity*>& groups)
 		item->setCheckState (0, (**it).isVisible()?Qt::Checked:Qt::Unchecked);
 	}	// for (vector<Group::GroupEntity*>::const_iterator it = groups.begin ( ); ...
 
-	sort ( );
+	// Rem : createGroupItem insère si nécessaire l'item à son rang, il n'y a
+	// pas lieu de retrier l'arborescence.
 }	// QtGroupsPanel::addGroups
 
 
 void QtGroupsPanel::removeGroups (const vector<Group::GroupEntity*>& groups)
 {
-	vector<Utils::Entity*>	list;
-
+	// Regroupement par entrée des items à détruire :
+	map<QTreeWidgetItem*, set<QTreeWidgetItem*> >	removed;
 	for (vector<Group::GroupEntity*>::const_iterator it = groups.begin ( ); groups.end ( ) != it; it++)
 	{
-		list.push_back (*it);
-		QTreeWidgetItem*	parent	= getGroupEntryItem ((*it)->getDim ( ), (*it)->getLevel ( ));
-		CHECK_NULL_PTR_ERROR (parent)
-		for (size_t i = 0; i < parent->childCount ( ); i++)
+		unordered_map<const GroupEntity*, QtGroupTreeWidgetItem*>::iterator	iti	= _groupsItems.find (*it);
+		if (_groupsItems.end ( ) == iti)
+			continue;
+		QtGroupTreeWidgetItem*	item	= (*iti).second;
+		_groupsItems.erase (iti);
+		if (0 != item->parent ( ))
+			removed [item->parent ( )].insert (item);
+		else
+			delete item;
+	}	// for (vector<Group::GroupEntity*>::const_iterator it = groups.begin ( );
+
+	for (map<QTreeWidgetItem*, set<QTreeWidgetItem*> >::iterator itr = removed.begin ( ); removed.end ( ) != itr; itr++)
+	{
+		QTreeWidgetItem*				parent	= (*itr).first;
+		const set<QTreeWidgetItem*>&	items	= (*itr).second;
+		if (1 == items.size ( ))
 		{
-			QtGroupTreeWidgetItem*	item	= dynamic_cast<QtGroupTreeWidgetItem*>(parent->child (i));
-			if ((0 != item) && (*it == item->getGroup ( )))
+			parent->removeChild (*items.begin ( ));
+			delete *items.begin ( );
+		}	// if (1 == items.size ( ))
+		else
+		{	// Retrait en une seule opération, l'ordre des items restant est conservé
+			QtExpansionTreeRestorer	restorer;
+			for (int i = 0; i < parent->childCount ( ); i++)
+				if (items.end ( ) == items.find (parent->child (i)))
+					restorer.record (*(parent->child (i)));
+			QList<QTreeWidgetItem*>	children	= parent->takeChildren ( );
+			QList<QTreeWidgetItem*>	kept;
+			for (int i = 0; i < children.size ( ); i++)
 			{
-				parent->takeChild (i);
-				delete item;
-				break;
-			}	// if ((0 != item) && (&entity == item->getGroup ( )))
-		}	// for (size_t i = 0; i < parent->childCount ( ); i++)
+				if (items.end ( ) == items.find (children.at (i)))
+					kept.append (children.at (i));
+				else
+					delete children.at (i);
+			}	// for (int i = 0; i < children.size ( ); i++)
+			parent->addChildren (kept);
+			restorer.restore ( );
+		}	// else if (1 == items.size ( ))
+
 		QtGroupLevelTreeWidgetItem*	levelItem	= dynamic_cast<QtGroupLevelTreeWidgetItem*>(parent);
 		if ((0 != levelItem) && (Qt::PartiallyChecked == levelItem->checkState (0)))
 			levelItem->updateState ( );
-	}	// for (vector<Group::GroupEntity*>::const_iterator it = groups.begin ( );
+	}	// for (map<QTreeWidgetItem*, set<QTreeWidgetItem*> >::iterator itr = ...
 
 	// sort a priori inutile, ordre conservé.
 }	// QtGroupsPanel::removeGroups
@@ -621,7 +710,9 @@ void QtGroupsPanel::removeGroups (const vector<Group::GroupEntity*>& groups)
 
 void QtGroupsPanel::updateGroup (const Group::GroupEntity& group)
 {
-	getGroupItem(group)->update(true);
+	QtGroupTreeWidgetItem*	item	= getGroupItem (group);
+	if (0 != item)
+		item->update (true);
 }
 
 
@@ -647,6 +738,9 @@ void QtGroupsPanel::sessionCleared ( )
 		for (int i = 0; i < items.size ( ); i++)
 			delete items.at (i);
 	}	// for (vector<QTreeWidgetItem*>::iterator itge = _groupsEntriesItems.begin ( ); itge != _groupsEntriesItems.end ( ); itge++)
+	for (vector<map <unsigned long, QTreeWidgetItem*> >::iterator itl = _levelsEntriesItems.begin ( ); _levelsEntriesItems.end ( ) != itl; itl++)
+		(*itl).clear ( );
+	_groupsItems.clear ( );
 }	// QtGroupsPanel::sessionCleared
 
 
@@ -995,22 +1089,21 @@ void QtGroupsPanel::typeNameSort ( )
 
 void QtGroupsPanel::typeNameSort (QTreeWidgetItem& parent)
 {
-	QTreeWidgetItem*			item	= 0;
+	const TypeNameOrder			order (ascendingSort ( ));
 	vector<QTreeWidgetItem*>	items;
-	QtExpansionTreeRestorer	expansionTreeRestorer (parent);
-
-	while (0 != parent.childCount ( ))
-	{
-		item	= parent.takeChild (0);
-		items.push_back (item);
-	}	// while (0 != parent.childCount ( ))
-	if (0 != Resources::instance ( )._sortType.getValue ( ).ascii ( ).compare ("typeAscendingName"))
-		std::sort (&items.front ( ), &(items [items.size ( )]), TypeNameSortGreater<QTreeWidgetItem*> ( ));
-	else
-		std::sort (&items.front ( ), &(items [items.size ( )]), TypeNameSortLesser<QTreeWidgetItem*> ( ));
+	items.reserve (parent.childCount ( ));
+	for (int i = 0; i < parent.childCount ( ); i++)
+		items.push_back (parent.child (i));
+	if (true == std::is_sorted (items.begin ( ), items.end ( ), order))
+		return;	// Rien à faire, on évite de reconstruire l'arborescence
 
+	QtExpansionTreeRestorer	expansionTreeRestorer (parent);
+	std::stable_sort (items.begin ( ), items.end ( ), order);
+	parent.takeChildren ( );
+	QList<QTreeWidgetItem*>	children;
 	for (vector<QTreeWidgetItem*>::iterator it = items.begin ( ); items.end ( ) != it; it++)
-		parent.addChild (*it);
+		children.append (*it);
+	parent.addChildren (children);
 
 	expansionTreeRestorer.restore ( );
 }	// QtGroupsPanel::typeNameSort
@@ -1454,33 +1547,10 @@ QtGroupTreeWidgetItem* QtGroupsPanel::getGroupItem (const Mgx3D::Group::GroupEnt
 		throw Exception (message);
 	}	// if ((0 > group.getDim ( )) || (4 <= group.getDim ( )))
 
-	if (false == Resources::instance ( )._multiLevelGroupsView.getValue ( ))
-	{
-		QTreeWidgetItem* parent		= _groupsEntriesItems [group.getDim ( )];
-		for (size_t i = 0; i < parent->childCount ( ); i++)
-		{
-			QtGroupTreeWidgetItem*	groupItem	= dynamic_cast<QtGroupTreeWidgetItem*>(parent->child (i));
-			if ((0 != groupItem) && (&group == groupItem->getGroup ( )))
-				return groupItem;
-		}	// for (size_t i = 0; i < parent->childCount ( ); i++)
-	}	// if (false == Resources::instance ( )._multiLevelGroupsView.getValue ( ))
-	else
-	{
-		const map<unsigned long, QTreeWidgetItem*>&	entries	= _levelsEntriesItems [group.getDim ( )];
-		map<unsigned long, QTreeWidgetItem*>::const_iterator	it	= entries.find (group.getLevel ( ));
-		if (entries.end ( ) != it)
-		{
-			QTreeWidgetItem*	parent	= (*it).second;
-			for (size_t i = 0; i < parent->childCount ( ); i++)
-			{
-				QtGroupTreeWidgetItem*	groupItem	= dynamic_cast<QtGroupTreeWidgetItem*>(parent->child (i));
-				if ((0 != groupItem) && (&group == groupItem->getGroup ( )))
-					return groupItem;
-			}	// for (size_t i = 0; i < parent->childCount ( ); i++)
-		}	// if (entries.end ( ) == it)
-	}	// else if (false == QtMgx3DApplication:: ...
-
-	return 0;
+	// Rem : l'item peut changer d'entrée (vue multi-niveaux), pas de groupe.
+	unordered_map<const GroupEntity*, QtGroupTreeWidgetItem*>::const_iterator	it	= _groupsItems.find (&group);
+
+	return _groupsItems.end ( ) == it ? 0 : (*it).second;
 }	// QtGroupsPanel::getGroupItem
 
 
@@ -1505,6 +1575,10 @@ QtGroupTreeWidgetItem* QtGroupsPanel::createGroupItem (Group::GroupEntity& group
 	QtGroupLevelTreeWidgetItem*	levelItem	= dynamic_cast<QtGroupLevelTreeWidgetItem*>(parent);
 	if ((0 != levelItem) && (Qt::Checked == levelItem->checkState (0)))
 		levelItem->updateState ( );
+	_groupsItems [&group]	= item;
+	// Insertion à son rang plutôt que tri de toute l'arborescence :
+	if (true == Resources::instance ( )._automaticSort.getValue ( ))
+		placeLastChild (*parent);
 
 	return item;
 }	// QtGroupsPanel::createGroupItem
@@ -1530,7 +1604,8 @@ QTreeWidgetItem* QtGroupsPanel::getGroupEntryItem (unsigned char dim, unsigned l
 	QtGroupLevelTreeWidgetItem*	entry	= new QtGroupLevelTreeWidgetItem (_groupsEntriesItems[dim], level, getGraphicalWidget ( ));
 	_groupsEntriesItems [dim]->addChild (entry);
 	entries.insert (pair <unsigned long, QTreeWidgetItem*>(level, entry));
-	sort ( );
+	if (true == Resources::instance ( )._automaticSort.getValue ( ))
+		placeLastChild (*_groupsEntriesItems [dim]);
 
 	return entry;
 }	// QtGroupsPanel::getGroupEntryItem
@@ -2862,21 +2937,37 @@ vector<QtGroupTreeWidgetItem*> QtGroupsPanel::getSelectedGroupsItems ( ) const
 {
 	CHECK_NULL_PTR_ERROR (_entitiesGroupsWidget)
 	vector<QtGroupTreeWidgetItem*>	selectedItems;
+	set<QTreeWidgetItem*>			found;	// Un item peut être sélectionné ainsi que son entrée
 	QList<QTreeWidgetItem*>			items	= _entitiesGroupsWidget->selectedItems ( );
 	for (QList<QTreeWidgetItem*>::iterator it = items.begin ( ); items.end ( ) != it; it++)
 	{
 		QtGroupTreeWidgetItem*	groupItem	= dynamic_cast<QtGroupTreeWidgetItem*>(*it);
 		if (0 != groupItem)
-			selectedItems.push_back (groupItem);
+		{
+			if (true == found.insert (groupItem).second)
+				selectedItems.push_back (groupItem);
+		}
 		else
 		{
-			// cas d'un item pour une dimension
-			for (uint i=0; i<(*it)->childCount(); i++)
+			// cas d'un item pour une dimension ou pour un niveau
+			vector<QTreeWidgetItem*>	entries;
+			entries.push_back (*it);
+			while (false == entries.empty ( ))
 			{
-				QtGroupTreeWidgetItem*	groupItem2	= dynamic_cast<QtGroupTreeWidgetItem*>((*it)->child(i));
-				if (0 != groupItem2)
-					selectedItems.push_back (groupItem2);
-			}
+				QTreeWidgetItem*	entry	= entries.back ( );
+				entries.pop_back ( );
+				for (int i = 0; i < entry->childCount ( ); i++)
+				{
+					QtGroupTreeWidgetItem*	groupItem2	= dynamic_cast<QtGroupTreeWidgetItem*>(entry->child (i));
+					if (0 != groupItem2)
+					{
+						if (true == found.insert (groupItem2).second)
+							selectedItems.push_back (groupItem2);
+					}
+					else if (0 != dynamic_cast<QtGroupLevelTreeWidgetItem*>(entry->child (i)))
+						entries.push_back (entry->child (i));
+				}	// for (int i = 0; i < entry->childCount ( ); i++)
+			}	// while (false == entries.empty ( ))
 		}
 	}	// for (QList<QTreeWidgetItem*>::iterator it = items.begin ( ); ...
 
@@ -682,6 +682,7 @@ void QtMgx3DApplication::applyConfiguration (const Section& mainSection)
 		Section&	theatreSection	= guiSection.getSection ("theatre");
 		PreferencesHelper::getUnsignedLong (theatreSection, Resources::instance ( )._updateRefreshRate);
 		PreferencesHelper::getBoolean (theatreSection, Resources::instance ( )._useDisplayList);
+		PreferencesHelper::getBoolean (theatreSection, Resources::instance ( )._batchedWireRepresentations);
 		PreferencesHelper::getBoolean (theatreSection, Resources::instance ( )._xyzCancelRoll);
 		PreferencesHelper::getDouble (theatreSection, Resources::instance ( )._stillFrameRate);
 		PreferencesHelper::getDouble (theatreSection, Resources::instance ( )._desiredFrameRate);
@@ -993,6 +994,7 @@ void QtMgx3DApplication::saveConfiguration (Section& mainSection)
 	// Théâtre :
 	PreferencesHelper::updateUnsignedLong (theatreSection, Resources::instance ( )._updateRefreshRate);
 	PreferencesHelper::updateBoolean (theatreSection, Resources::instance ( )._useDisplayList);
+	PreferencesHelper::updateBoolean (theatreSection, Resources::instance ( )._batchedWireRepresentations);
 	PreferencesHelper::updateBoolean (theatreSection, Resources::instance ( )._xyzCancelRoll);
 	PreferencesHelper::updateDouble (theatreSection, Resources::instance ( )._stillFrameRate);
 	PreferencesHelper::updateDouble (theatreSection, Resources::instance ( )._desiredFrameRate);
@@ -5522,6 +5522,7 @@ void QtMgx3DMainWindow::exitCallback()
 			filters << "STEP (*.stp *.step)";
 			filters << "IGES (*.igs *.iges)";
             filters << "Magix Topo (*.mgxt)";
+            filters << "Magix Topo binaire (*.mgxb)";
 			UTF8String limaFilter(Charset::UTF_8);
 			limaFilter << "Lima++ (";
 			const char **limaExt = Lima::liste_format_lecture();
@@ -5650,7 +5651,8 @@ void QtMgx3DMainWindow::exitCallback()
 										getContext().getMeshManager().readMli(fileName, pre);
 									}    // Lima
                                     else
-                                    if (true == compareExtensions(file.getExtension(), "mgxt"))
+                                    if ((true == compareExtensions(file.getExtension(), "mgxt")) ||
+                                        (true == compareExtensions(file.getExtension(), "mgxb")))
                                     {
                                         QtBlocksOptionsDialog blocksDialog(this, getAppTitle(), fileName);
                                         if (QDialog::Rejected == blocksDialog.exec())
@@ -5747,6 +5749,7 @@ void QtMgx3DMainWindow::exportAllCallback ( )
 	filters << "IGES (*.igs *.iges)";
 	filters << "CGNS (*.cgns)";
     filters << "Magix Topo (*.mgxt)";
+    filters << "Magix Topo binaire (*.mgxb)";
 	dialog.setNameFilters (filters);
 
 	while (0 == fileName.length ( ))
@@ -5876,7 +5879,8 @@ void QtMgx3DMainWindow::exportAllCallback ( )
 		cursor.show();
 		getContext ( ).getMeshManager ( ).exportBlocksForCGNS (dim,fileName);
 	}	// cgns
-    else if (true == compareExtensions (file.getExtension ( ), "mgxt"))
+    else if ((true == compareExtensions (file.getExtension ( ), "mgxt")) ||
+             (true == compareExtensions (file.getExtension ( ), "mgxb")))
     {
         SelectionManager&	selectionManager	=
                 getContext ( ).getSelectionManager ( );
@@ -14,7 +14,9 @@
 #include "QtComponents/RenderedEntityRepresentation.h"
 #include "QtComponents/QtMgx3DScrollArea.h"
 #include "Topo/CoEdge.h"
+#include "Topo/CommandEditTopo.h"
 #include "Topo/TopoDisplayRepresentation.h"
+#include "Topo/TopoPreviewTask.h"
 #include "Utils/Common.h"
 
 #include <TkUtil/InternalError.h>
@@ -55,8 +57,12 @@ QtMgx3DOperationPanel::QtMgx3DOperationPanel (QWidget* parent, QtMgx3DMainWindow
 	  _previewCheckBox (0), _mainWindow (&mainWindow), _validatedFields ( ),
 	  _action (action),
 	  _highlightedEntities ( ), _previewIDs ( ), _interactors ( ),
-	  _helpURL (helpURL), _helpTag (helpTag)
+	  _previewTask (0), _helpURL (helpURL), _helpTag (helpTag)
 {
+	// Le calcul d'aperçu est achevé dans un autre thread, l'affichage se fait
+	// dans celui de l'IHM :
+	connect (this, SIGNAL (topoPreviewCompleted ( )), this,
+	         SLOT (topoPreviewCompletedCallback ( )), Qt::QueuedConnection);
 }	// QtMgx3DOperationPanel::QtMgx3DOperationPanel
 
 
@@ -64,7 +70,7 @@ QtMgx3DOperationPanel::QtMgx3DOperationPanel (const QtMgx3DOperationPanel&)
 	: QWidget (0),
 	  _previewCheckBox (0), _mainWindow (0), _validatedFields ( ), _action (0),
 	  _highlightedEntities ( ), _previewIDs ( ), _interactors ( ),
-	  _helpURL ( ), _helpTag ( )
+	  _previewTask (0), _helpURL ( ), _helpTag ( )
 {
 	MGX_FORBIDDEN ("QtMgx3DOperationPanel copy constructor is not allowed.");
 }	// QtMgx3DOperationPanel::QtMgx3DOperationPanel
@@ -83,6 +89,7 @@ QtMgx3DOperationPanel::~QtMgx3DOperationPanel ( )
 	{
 		highlight (false);
 		preview (false, true);
+		cancelTopoPreview ( );
 	}
 	catch (...)
 	{
@@ -300,6 +307,7 @@ void QtMgx3DOperationPanel::preview (bool show, bool destroyInteractor)
 				 renderingManager.destroyInteractor (*it);
 		}	// if (true == destroyInteractor)
 
+		cancelTopoPreview ( );
 		removePreviewedObjects ( );
 	}	// if (false == show)
 	else
@@ -534,12 +542,11 @@ void QtMgx3DOperationPanel::previewEdges (
 	const bool		bold    = false,    italic  = false;
 	dp.setFontProperties (fontFamily, fontSize, bold, italic, fontColor);
 
-	map<Topo::TopoEntity*, Internal::InfoCommand::type>&  topo_entities_info = infos.getTopoInfoEntity();
-        for (std::map<Topo::TopoEntity*, Internal::InfoCommand::type>::iterator itei = topo_entities_info.begin();
-                itei != topo_entities_info.end(); ++itei)
+	vector<Internal::InfoCommand::TopoEntityInfo>&  topo_entities_info = infos.getTopoInfoEntity();
+        for (uint i_tei=0; i_tei<topo_entities_info.size(); i_tei++)
 	{
-		Topo::TopoEntity*	topo_entity	= itei->first;
-		InfoCommand::type	topo_type	= itei->second;
+		Topo::TopoEntity*	topo_entity	= topo_entities_info[i_tei].m_topo_entity;
+		InfoCommand::type	topo_type	= topo_entities_info[i_tei].m_type;
 //if (Entity::TopoCoEdge==topo_entity->getType( ))
 //	cout << " arête "<<topo_entity->getName()<<" type = "<<Internal::InfoCommand::type2String(topo_type)<<endl;
 
@@ -613,10 +620,81 @@ void QtMgx3DOperationPanel::previewEdges (
 				}	// if (2 == arrow.size ( ))
 			}	// if (0 != (mask & ...
 		}	// if ((Entity::TopoCoEdge==te->getType( )) ...
-	}	// for (vector<InfoCommand::TopoEntityInfo>::iterator itei = tei.begin ( );
+	}	// for (uint i_tei=0; i_tei<topo_entities_info.size(); i_tei++)
 }	// QtMgx3DOperationPanel::previewEdges
 
 
+void QtMgx3DOperationPanel::previewTopoModification (CommandEditTopo* command)
+{
+	CHECK_NULL_PTR_ERROR (command)
+	cancelTopoPreview ( );
+
+	if (true == command->hasSideEffectFreePreview ( ))
+	{
+		// L'émission du signal depuis le thread de calcul est différée dans
+		// celui de l'IHM (connexion Qt::QueuedConnection) :
+		_previewTask	= new TopoPreviewTask (command, [this] ( ) { emit topoPreviewCompleted ( ); });
+		return;
+	}	// if (true == command->hasSideEffectFreePreview ( ))
+
+	std::unique_ptr<CommandEditTopo>	cmd (command);
+	TopoDisplayRepresentation	dr (DisplayRepresentation::WIRE);
+	cmd->getPreviewRepresentation (dr);
+	previewSegments (dr);
+}	// QtMgx3DOperationPanel::previewTopoModification
+
+
+void QtMgx3DOperationPanel::cancelTopoPreview ( )
+{
+	TopoPreviewTask*	task	= _previewTask;
+	_previewTask	= 0;
+	delete task;	// Interrompt le calcul
+}	// QtMgx3DOperationPanel::cancelTopoPreview
+
+
+void QtMgx3DOperationPanel::topoPreviewCompletedCallback ( )
+{
+	// Signal éventuellement émis par un calcul depuis interrompu :
+	if ((0 == _previewTask) || (false == _previewTask->isCompleted ( )))
+		return;
+
+	std::unique_ptr<TopoPreviewTask>	task (_previewTask);
+	_previewTask	= 0;
+
+	try
+	{
+		if (false == task->getError ( ).empty ( ))
+			return;	// Aperçu impossible, comme en mode synchrone rien n'est affiché
+
+		previewSegments (task->getRepresentation ( ));
+	}
+	catch (...)
+	{
+	}
+}	// QtMgx3DOperationPanel::topoPreviewCompletedCallback
+
+
+void QtMgx3DOperationPanel::previewSegments (const TopoDisplayRepresentation& dr)
+{
+	const vector<Math::Point>&	points	= dr.getPoints ( );
+	const vector<size_t>&		indices	= dr.getCurveDiscretization ( );
+
+	DisplayProperties	graphicalProps;
+	graphicalProps.setWireColor (Color (
+					255 * Resources::instance ( )._previewColor.getRed ( ),
+					255 * Resources::instance ( )._previewColor.getGreen ( ),
+					255 * Resources::instance ( )._previewColor.getBlue ( )));
+	graphicalProps.setLineWidth (
+					Resources::instance ( )._previewWidth.getValue ( ));
+	RenderingManager::RepresentationID	repID	=
+			getRenderingManager ( ).createSegmentsWireRepresentation (
+								points, indices, graphicalProps, true);
+	registerPreviewedObject (repID);
+
+	getRenderingManager ( ).forceRender ( );
+}	// QtMgx3DOperationPanel::previewSegments
+
+
 vector<RenderingManager::RepresentationID> QtMgx3DOperationPanel::getPreviewedObjects ( )
 {
 	return _previewIDs;
@@ -697,6 +775,7 @@ void QtMgx3DOperationPanel::applyCallback ( )
 	bool	userNotified	= false;	// CP 16/09/24 false par défaut (cas où la création de commande lève une exception => pas de commandResult)																	// CP NEW
 	BEGIN_QT_TRY_CATCH_BLOCK
 
+	cancelTopoPreview ( );	// La topologie va être modifiée
 	highlight (false);	// CP 18/02/25 : ne pas être tenté de modifier la surbrillance d'entités détruites.
 
 	CHECK_NULL_PTR_ERROR (getMgx3DOperationAction ( ))
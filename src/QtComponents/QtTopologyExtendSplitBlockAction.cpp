@@ -225,25 +225,8 @@ void QtTopologyExtendSplitBlockPanel::preview (
 				getContext ( ).getTopoManager ( ).getBlock (blockName, true);
 		CoEdge*			edge		=
 				 getContext ( ).getTopoManager ( ).getCoEdge (edgeName, true);
-		CommandExtendSplitBlock			command (*context, block, edge);
-		TopoDisplayRepresentation	dr (DisplayRepresentation::WIRE);
-		command.getPreviewRepresentation (dr);
-		const vector<Math::Point>&	points	= dr.getPoints ( );
-		const vector<size_t>&		indices	= dr.getCurveDiscretization ( );
-
-		DisplayProperties	graphicalProps;
-		graphicalProps.setWireColor (Color (
-						255 * Resources::instance ( )._previewColor.getRed ( ),
-						255 * Resources::instance ( )._previewColor.getGreen ( ),
-						255 * Resources::instance ( )._previewColor.getBlue ( )));
-		graphicalProps.setLineWidth (
-						Resources::instance ( )._previewWidth.getValue ( ));
-		RenderingManager::RepresentationID	repID	=
-				getRenderingManager ( ).createSegmentsWireRepresentation (
-									points, indices, graphicalProps, true);
-		registerPreviewedObject (repID);
-
-		getRenderingManager ( ).forceRender ( );
+		previewTopoModification (
+						new CommandExtendSplitBlock (*context, block, edge));
 	}
 	catch (...)
 	{
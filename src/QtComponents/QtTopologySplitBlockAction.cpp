@@ -396,39 +396,9 @@ void QtTopologySplitBlockPanel::preview (bool show, bool destroyInteractor)
 			}	// switch (getCutDefinitionMethod ( ))
 		}	// else if (true == allBlocks ( ))
 
-		TopoDisplayRepresentation	dr (DisplayRepresentation::WIRE);
-		command->getPreviewRepresentation (dr);
-// Issue 222. A ce stade, de part sa construction, command->getPreviewRepresentation (dr) a détruit puis reconstruit certains blocs. Détruits car
-// coupés, reconstruits via undo car mode "preview". Mais le redo ne rétablit pas des caractéristiques t.q. "highlighting"".
-// Les lignes ci-dessous ont pour vocation de rétablir le comportement attendu pour ce panneau, dans l'attente de décisions architecturales
-// sur les évolutions de Magix3D.
-		vector<string>	blocksNames	= getBlocksNames ( );
-		for (vector<string>::const_iterator it = blocksNames.begin ( ); blocksNames.end ( ) != it; it++)
-		{
-			Block*	block	= getContext ( ).getTopoManager ( ).getBlock (*it, true);
-			registerHighlightedEntity (*block);
-			DisplayProperties::GraphicalRepresentation*	gr	= 0 == block ? 0 : block->getDisplayProperties ( ).getGraphicalRepresentation ( );
-			if (0 != gr)
-				gr->setHighlighted (true, false);
-		}	// for (vector<string>::const_iterator it = blocksNames.begin ( ); blocksNames.end ( ) != it; it++)
-
-		// Affichage de l'aperçu :
-		const vector<Math::Point>&	points	= dr.getPoints ( );
-		const vector<size_t>&		indices	= dr.getCurveDiscretization ( );
-
-		DisplayProperties	graphicalProps;
-		graphicalProps.setWireColor (Color (
-						255 * Resources::instance ( )._previewColor.getRed ( ),
-						255 * Resources::instance ( )._previewColor.getGreen ( ),
-						255 * Resources::instance ( )._previewColor.getBlue ( )));
-		graphicalProps.setLineWidth (
-						Resources::instance ( )._previewWidth.getValue ( ));
-		RenderingManager::RepresentationID	repID	=
-				getRenderingManager ( ).createSegmentsWireRepresentation (
-									points, indices, graphicalProps, true);
-		registerPreviewedObject (repID);
-
-		getRenderingManager ( ).forceRender ( );
+		// L'aperçu est calculé sans modifier la topologie (blocs non détruits
+		// puis reconstruits, cf. Issue 222), dans un thread dédié :
+		previewTopoModification (command.release ( ));
 
 	}
 	catch (...)
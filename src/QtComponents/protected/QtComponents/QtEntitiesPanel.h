@@ -21,6 +21,7 @@
 #include "SysCoord/SysCoord.h"
 #include "Structured/StructuredMeshEntity.h"
 
+#include <unordered_map>
 #include <vector>
 
 
@@ -519,6 +520,13 @@ struct QTreeViewPopupActions
  *				<P>Ce panneau permet également de sélectionner des entités. La
  *				gestion de la sélection est effectuée au niveau du contexte.
  *				</P>
+ *
+ *				<P>Chaque entité est représentée par un item créé dès son
+ *				ajout (pas de peuplement paresseux) : mémoire et temps de
+ *				création restent proportionnels au nombre d'entités. Seules
+ *				les mises à jour sont incrémentales (recherche d'item
+ *				indexée, retraits groupés par entrée).
+ *				</P>
  */
 class QtEntitiesPanel :public QtEntitiesItemViewPanel, public Internal::SelectionManagerObserver
 {
@@ -854,10 +862,17 @@ class QtEntitiesPanel :public QtEntitiesItemViewPanel, public Internal::Selectio
 	virtual void selectionChanged (std::vector<Mgx3D::Utils::Entity*>& selectedEntities, std::vector<Mgx3D::Utils::Entity*>& deselectedEntities);
 
 	/**
-	 * \return		L'item représentant l'entité transmise en argument.
+	 * \return		L'item représentant l'entité transmise en argument, 0 s'il
+	 *				n'y en a pas. Recherche en temps constant.
 	 */
 	virtual QtEntityTreeWidgetItem* getItem(const Mgx3D::Utils::Entity& entity);
 
+	/**
+	 * Détruit les items représentant les entités transmises en argument. Les
+	 * items d'une même entrée sont retirés en une seule opération.
+	 */
+	virtual void removeItems (const std::vector<Mgx3D::Utils::Entity*>& entities);
+
 	/**
 	 * \param		Item parent
 	 * \param		Libellé de l'item
@@ -1070,6 +1085,9 @@ class QtEntitiesPanel :public QtEntitiesItemViewPanel, public Internal::Selectio
 	/** Une seule dimension - 3D - (pour l'instant) pour les maillages structurés. */
 	QTreeWidgetItem				*_structuredMeshVolumesItem;
 
+	/** Les items représentant les entités. */
+	std::unordered_map<const Mgx3D::Utils::Entity*, QtEntityTreeWidgetItem*>	_entitiesItems;
+
 	/** Le menu contextuel de l'arborescence d'items. */
 	QMenu*					_treeViewPopupMenu;
 	QTreeViewPopupActions			_treeViewActions;
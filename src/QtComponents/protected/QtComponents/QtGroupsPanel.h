@@ -20,6 +20,7 @@
 #include <QTreeWidget>
 
 #include <map>
+#include <unordered_map>
 #include <vector>
 
 
@@ -293,6 +294,11 @@ class QtMgx3DTBTreeWidget : public QTreeWidget
  *				<P>Ce panneau permet également de sélectionner des groupes et de provoquer un affichage 3D filtré, selon des types
  *				de groupes sélectionnés.
  *				</P>
+ *
+ *				<P>Chaque groupe est représenté par un item créé dès son ajout (pas de peuplement paresseux). Seules les mises à
+ *				jour sont incrémentales : recherche d'item indexée, retraits groupés par entrée, insertion au rang en tri
+ *				automatique.
+ *				</P>
  */
 class QtGroupsPanel : public QtEntitiesItemViewPanel, public Internal::SelectionManagerObserver
 {
@@ -462,7 +468,8 @@ class QtGroupsPanel : public QtEntitiesItemViewPanel, public Internal::Selection
 	virtual void createPopupMenus ( );
 
 	/**
-	 * \return		L'item représentant le groupe transmise en argument.
+	 * \return		L'item représentant le groupe transmise en argument, 0 s'il
+	 *				n'y en a pas. Recherche en temps constant.
 	 */
 	virtual QtGroupTreeWidgetItem* getGroupItem (const Mgx3D::Group::GroupEntity& group);
 
@@ -474,7 +481,8 @@ class QtGroupsPanel : public QtEntitiesItemViewPanel, public Internal::Selection
 	virtual QTreeWidgetItem* createEntryItem (QTreeWidgetItem& parent, const std::string& title);
 
 	/**
-	 * \return		Un item représentant le groupe transmis en argument.
+	 * \return		Un item représentant le groupe transmis en argument. En tri
+	 *				automatique l'item est inséré à son rang.
 	 */
 	virtual QtGroupTreeWidgetItem* createGroupItem (Mgx3D::Group::GroupEntity&);
 
@@ -501,7 +509,7 @@ class QtGroupsPanel : public QtEntitiesItemViewPanel, public Internal::Selection
 					Mgx3D::Utils::FilterEntity::objectType oldState, Mgx3D::Utils::FilterEntity::objectType& toRestore);
 
 	/**
-	 * Trier les items.
+	 * Trier les items. Les entrées déjà triées ne sont pas modifiées.
 	 */
 	virtual void sort ( );
 	virtual void typeNameSort ( );
@@ -801,6 +809,9 @@ class QtGroupsPanel : public QtEntitiesItemViewPanel, public Internal::Selection
 	/** Les entrées principales pour chaque niveau. */
 	std::vector<std::map <unsigned long, QTreeWidgetItem*> >	_levelsEntriesItems;
 
+	/** Les items représentant les groupes. */
+	std::unordered_map<const Mgx3D::Group::GroupEntity*, QtGroupTreeWidgetItem*>	_groupsItems;
+
 	/** Le menu contextuel de l'arborescence "Types d'entités". */
 	QMenu*									_typesPopupMenu;
 
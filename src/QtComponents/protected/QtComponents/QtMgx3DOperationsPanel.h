@@ -16,6 +16,13 @@ namespace QtComponents
 	class RenderingManager;
 }	// namespace QtComponents
 
+namespace Topo
+{
+	class CommandEditTopo;
+	class TopoDisplayRepresentation;
+	class TopoPreviewTask;
+}	// namespace Topo
+
 }	// namespace Mgx3D
 
 
@@ -392,6 +399,32 @@ class QtMgx3DOperationPanel : public QWidget
 			const Mgx3D::Utils::DisplayProperties& props,
 			unsigned long mask);
 
+	/**
+	 * Affiche l'aperçu de la commande de modification de la topologie
+	 * transmise en argument, dont le panneau devient propriétaire.
+	 * Si la commande sait calculer son aperçu sans être exécutée (cf.
+	 * <I>CommandEditTopo::hasSideEffectFreePreview</I>) le calcul est effectué
+	 * dans un thread dédié et l'affichage n'a lieu qu'une fois celui-ci
+	 * terminé, l'éventuel calcul précédent étant interrompu. Sinon l'aperçu
+	 * est calculé et affiché immédiatement.
+	 * \see		cancelTopoPreview
+	 * \see		topoPreviewCompletedCallback
+	 */
+	virtual void previewTopoModification (Mgx3D::Topo::CommandEditTopo* command);
+
+	/**
+	 * Interrompt l'éventuel calcul d'aperçu en cours.
+	 * \see		previewTopoModification
+	 */
+	virtual void cancelTopoPreview ( );
+
+	/**
+	 * Affiche en pré-visualisation les segments de la représentation
+	 * transmise en argument, avec les propriétés graphiques d'aperçu.
+	 */
+	virtual void previewSegments (
+				const Mgx3D::Topo::TopoDisplayRepresentation& dr);
+
 	/**
 	 * Ajoute à la liste des interacteurs utilisés celui transmis en argument.
 	 * \see		getPreviewedInteractors
@@ -490,8 +523,22 @@ class QtMgx3DOperationPanel : public QWidget
 	 */
 	virtual void discretisationModifiedCallback ( );
 
+	/**
+	 * Invoqué dans le thread de l'IHM lorsque le calcul d'aperçu lancé par
+	 * <I>previewTopoModification</I> est achevé. Affiche cet aperçu.
+	 * \see		topoPreviewCompleted
+	 */
+	virtual void topoPreviewCompletedCallback ( );
+
 	signals :
 
+	/**
+	 * Signal emis depuis le thread de calcul d'aperçu lorsque celui-ci est
+	 * achevé.
+	 * \see		topoPreviewCompletedCallback
+	 */
+	void topoPreviewCompleted ( );
+
 	/**
 	 * Signal emit lorsque l'utilisateur modifie le paramétrage de la
 	 * discrétisation.
@@ -529,6 +576,9 @@ class QtMgx3DOperationPanel : public QWidget
 	/** Les interacteurs en cours d'utilisation. */
 	std::vector<RenderingManager::Interactor*>		_interactors;
 
+	/** L'éventuel calcul d'aperçu en cours. */
+	Mgx3D::Topo::TopoPreviewTask*					_previewTask;
+
 	/** Le nom du fichier contenant l'aide contextuelle associée à ce panneau
 	 * (chemin relatif par rapport à la racine de l'aide contextuelle du
 	 * logiciel).
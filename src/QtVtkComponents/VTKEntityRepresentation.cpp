@@ -58,7 +58,7 @@ VTKEntityRepresentation::VTKEntityRepresentation (Entity& entity)
 	  _renderer (0),
 	  _surfacicPolyData (0), _surfacicActor (0), _surfacicMapper (0),
       _volumicGrid (0), _volumicActor (0), _volumicMapper (0),
-	  _wirePolyData (0), _wireActor (0), _wireMapper (0),
+	  _wirePolyData (0), _wireActor (0), _wireMapper (0), _batchedWireActor (0),
 	  _isoWirePolyData (0), _isoWireActor (0), _isoWireMapper (0),
 	  _discPolyData (0), _discActor(0), _discMapper(0),
 	  _cloudGrid (0), _cloudActor (0), _cloudMapper (0),
@@ -80,7 +80,7 @@ VTKEntityRepresentation::VTKEntityRepresentation (VTKEntityRepresentation& ver)
 	  _renderer (0),
 	  _surfacicPolyData (0), _surfacicActor (0), _surfacicMapper (0),
       _volumicGrid (0), _volumicActor (0), _volumicMapper (0),
-	  _wirePolyData (0), _wireActor (0), _wireMapper (0),
+	  _wirePolyData (0), _wireActor (0), _wireMapper (0), _batchedWireActor (0),
 	  _isoWirePolyData (0), _isoWireActor (0), _isoWireMapper (0),
 	  _discPolyData (0), _discActor(0), _discMapper(0),
 	  _cloudGrid (0), _cloudActor (0), _cloudMapper (0),
@@ -148,6 +148,11 @@ void VTKEntityRepresentation::show (VTKRenderingManager& renderingManager, bool
 				_wireActor->SetPickable (pickable);
 			renderer.AddViewProp (_wireActor);
 		}
+		if ((0 != _batchedWireActor) && (0 != e))
+		{
+			_batchedWireActor->SetEntityPickable (*e, pickable);
+			_batchedWireActor->SetEntityVisibility (*e, true);
+		}
 		if (0 != _isoWireActor)
 		{
 			if (0 != e)
@@ -206,6 +211,8 @@ void VTKEntityRepresentation::setSelected (bool selected)
 	RenderedEntityRepresentation::setSelected (selected);
 	if ((true == update) && (0 != getEntity ( )))
 	{
+		// Une entité sélectionnée a sa propre représentation filaire :
+		updateWireBatching ( );
 		updateRepresentationProperties ( );
 		if ((true == selected) &&
 		    (true == Resources::instance ( )._selectionOnTop.getValue ( )))
@@ -240,6 +247,7 @@ void VTKEntityRepresentation::setHighlighted (bool highlighted, bool refreshGui)
 	RenderedEntityRepresentation::setHighlighted (highlighted);
 	if ((true == update) && (0 != getEntity ( )))
 	{
+		updateWireBatching ( );
 		updateHighlightRepresentation (highlighted, refreshGui);
 		if ((true == highlighted) && (true == Resources::instance ( )._selectionOnTop.getValue ( )))
 			bringToTop ( );
@@ -282,6 +290,8 @@ void VTKEntityRepresentation::updateRepresentation (unsigned long mask, bool for
 		{
 			if (0 != _wireActor)
 			    _renderer->RemoveViewProp (_wireActor);
+			if ((0 != _batchedWireActor) && (0 != getEntity ( )))
+				_batchedWireActor->SetEntityVisibility (*getEntity ( ), false);
 		}	// if (0 != (oldMask & CURVES))
 		if (0 != (oldMask & ISOCURVES))
 		{
@@ -349,7 +359,7 @@ void VTKEntityRepresentation::updateRepresentation (unsigned long mask, bool for
 	}	// if (0 != (usedMask & SURFACES))
 	if (0 != (usedMask & VOLUMES))
 	{
-	    if (0 == _volumicGrid)
+	    if (false == hasVolumicRepresentation ( ))
 	        createVolumicRepresentation ( );
 	    // _volumicActor peut il être nul sans qu'on soit en erreur ???
 	    if (0 != _renderer && 0 != _volumicActor){
@@ -373,7 +383,7 @@ void VTKEntityRepresentation::updateRepresentation (unsigned long mask, bool for
 // CP : ATTENTION à ce test, selon les cas on instancie ou non _wirePolyData,
 // dans certains cas on utilise un vtkExtractEdges sur une peau et donc
 // _wirePolyData est nulle.
-		if ((0 == _wireActor) || (0 == _wireMapper)){
+		if (((0 == _wireActor) || (0 == _wireMapper)) && (0 == _batchedWireActor)){
 		    if (0 == (usedMask & MESH_SHAPE))
 		        createWireRepresentation ( );
 		    else
@@ -382,6 +392,8 @@ void VTKEntityRepresentation::updateRepresentation (unsigned long mask, bool for
 		if (0 != _renderer)
 			if (0 != _wireActor)
 				_renderer->AddViewProp (_wireActor);
+			else if (0 != _batchedWireActor)
+				_batchedWireActor->SetEntityVisibility (*getEntity ( ), true);
 			else
 				cerr << "Erreur interne en " << __FILE__ << ' ' << __LINE__
 				     << " : _wireActor non instancié." << endl;
@@ -494,6 +506,8 @@ void VTKEntityRepresentation::updateRepresentationProperties ( )
 property->SetInterpolationToFlat ( );
 		property->SetOpacity (properties.getWireOpacity ( ));
 	}	// if (0 != property)
+	if (0 != _batchedWireActor)
+		_batchedWireActor->SetEntityColor (*getEntity ( ), getColor (CURVES));
 
 	// Mode filaire Iso :
 	property	= 0 == _isoWireActor ? 0 : _isoWireActor->GetProperty ( );
@@ -881,6 +895,121 @@ CHECK_NULL_PTR_ERROR (_renderer)
 }	// VTKEntityRepresentation::setRenderingManager
 
 
+bool VTKEntityRepresentation::isWireRepresentationBatchable ( ) const
+{
+	return false;
+}	// VTKEntityRepresentation::isWireRepresentationBatchable
+
+
+bool VTKEntityRepresentation::useBatchedWireRepresentation ( ) const
+{
+	if ((false == isWireRepresentationBatchable ( )) ||
+	    (false == Resources::instance ( )._batchedWireRepresentations.getValue ( )))
+		return false;
+	if ((0 == getEntity ( )) || (0 == _renderer) ||
+	    (0 == dynamic_cast<const VTKRenderingManager*>(getRenderingManager ( ))))
+		return false;
+
+	// Les représentations sélectionnées ou mises en évidence sont
+	// transitoires, elles conservent leurs propres acteurs :
+	if ((true == isSelected ( )) || (true == isHighlighted ( )))
+		return false;
+	if (0 != (getUsedRepresentationMask ( ) & MESH_SHAPE))
+		return false;
+	// La transparence n'est pas gérée maille par maille :
+	if (getDisplayPropertiesAttributes ( ).getWireOpacity ( ) < 1.)
+		return false;
+
+	return true;
+}	// VTKEntityRepresentation::useBatchedWireRepresentation
+
+
+bool VTKEntityRepresentation::createBatchedWireRepresentation (const vector<Math::Point>& points, const vector<size_t>& segments)
+{
+	if (0 != _batchedWireActor)
+	{
+		INTERNAL_ERROR (exc, "Représentation déjà créée.", "VTKEntityRepresentation::createBatchedWireRepresentation")
+		throw exc;
+	}	// if (0 != _batchedWireActor)
+	if (false == useBatchedWireRepresentation ( ))
+		return false;
+
+	VTKRenderingManager*	vrm	= dynamic_cast<VTKRenderingManager*>(getRenderingManager ( ));
+	CHECK_NULL_PTR_ERROR (vrm)
+	Entity&	entity	= *getEntity ( );
+	VTKMgx3DBatchedWireActor&	actor	= vrm->getBatchedWireActor (entity.getType ( ), getLineWidth (entity, CURVES));
+	actor.AddEntity (entity, points, segments, getColor (CURVES));
+	actor.Register (0);
+	_batchedWireActor	= &actor;
+
+	return true;
+}	// VTKEntityRepresentation::createBatchedWireRepresentation
+
+
+void VTKEntityRepresentation::updateWireBatching ( )
+{
+	Entity*	entity	= getEntity ( );
+	if ((0 == entity) || (false == isWireRepresentationBatchable ( )))
+		return;
+	// Rien à faire si la représentation filaire n'est pas créée :
+	if ((0 == _batchedWireActor) && (0 == _wireActor))
+		return;
+
+	const bool	batched	= useBatchedWireRepresentation ( );
+	if ((false == batched) && (0 == _batchedWireActor))
+		return;
+	if ((true == batched) && (0 != _batchedWireActor))
+	{	// L'épaisseur du trait a pu être modifiée :
+		VTKRenderingManager*	vrm	= dynamic_cast<VTKRenderingManager*>(getRenderingManager ( ));
+		CHECK_NULL_PTR_ERROR (vrm)
+		if (&vrm->getBatchedWireActor (entity->getType ( ), getLineWidth (*entity, CURVES)) == _batchedWireActor)
+			return;
+	}	// if ((true == batched) && (0 != _batchedWireActor))
+
+	// On détruit la représentation filaire actuelle et on la recréé :
+	const bool	displayed	= 0 != _batchedWireActor ?
+		_batchedWireActor->GetEntityVisibility (*entity) :
+		(0 != _renderer) && (0 != _renderer->HasViewProp (_wireActor));
+	if (0 != _wireActor)
+	{
+		if ((0 != _renderer) && (0 != _renderer->HasViewProp (_wireActor)))
+			_renderer->RemoveViewProp (_wireActor);
+		_wireActor->Delete ( );
+		_wireActor	= 0;
+	}	// if (0 != _wireActor)
+	if (0 != _wireMapper)
+		_wireMapper->Delete ( );
+	_wireMapper	= 0;
+	if (0 != _wirePolyData)
+		_wirePolyData->Delete ( );
+	_wirePolyData	= 0;
+	if (0 != _batchedWireActor)
+	{
+		_batchedWireActor->RemoveEntity (*entity);
+		_batchedWireActor->UnRegister (0);
+		_batchedWireActor	= 0;
+	}	// if (0 != _batchedWireActor)
+
+	createWireRepresentation ( );
+
+	VTKRenderingManager*	vrm			= dynamic_cast<VTKRenderingManager*>(getRenderingManager ( ));
+	const bool				pickable	=
+		(0 == vrm) || (0 == vrm->getSelectionManager ( )) ?
+		false : vrm->getSelectionManager ( )->isSelectionActivated (*entity);
+	if (0 != _wireActor)
+	{
+		_wireActor->SetPickable (pickable);
+		if ((true == displayed) && (0 != _renderer))
+			_renderer->AddViewProp (_wireActor);
+	}	// if (0 != _wireActor)
+	if (0 != _batchedWireActor)
+	{
+		_batchedWireActor->SetEntityPickable (*entity, pickable);
+		_batchedWireActor->SetEntityVisibility (*entity, displayed);
+	}	// if (0 != _batchedWireActor)
+}	// VTKEntityRepresentation::updateWireBatching
+
+
 vtkPolyData* VTKEntityRepresentation::getSurfacicPolyData ( )
 {
 	return _surfacicPolyData;
@@ -905,6 +1034,12 @@ vtkUnstructuredGrid* VTKEntityRepresentation::getVolumicGrid ( )
 }	// VTKEntityRepresentation::getVolumicGrid
 
 
+bool VTKEntityRepresentation::hasVolumicRepresentation ( ) const
+{
+	return 0 == _volumicGrid ? false : true;
+}	// VTKEntityRepresentation::hasVolumicRepresentation
+
+
 vtkActor* VTKEntityRepresentation::getVolumicActor ( )
 {
 	return _volumicActor;
@@ -1080,6 +1215,17 @@ void VTKEntityRepresentation::destroyRepresentations (bool realyDestroy)
 			_wirePolyData->Delete ( );
 		_wirePolyData	= 0;
 	}	// if (true == realyDestroy)
+	if ((0 != _batchedWireActor) && (0 != getEntity ( )))
+	{
+		if (true == realyDestroy)
+		{
+			_batchedWireActor->RemoveEntity (*getEntity ( ));
+			_batchedWireActor->UnRegister (0);
+			_batchedWireActor	= 0;
+		}	// if (true == realyDestroy)
+		else
+			_batchedWireActor->SetEntityVisibility (*getEntity ( ), false);
+	}	// if ((0 != _batchedWireActor) && (0 != getEntity ( )))
 
 	if (0 != _discActor)
 	{
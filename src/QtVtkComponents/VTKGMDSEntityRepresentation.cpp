@@ -747,9 +747,9 @@ createCoFacesSurfacicRepresentationRatio1(std::vector<Topo::CoFace*> cofaces, gm
 	for (std::vector<Topo::CoFace*>::iterator iter=cofaces.begin(); iter!=cofaces.end(); ++iter){
 		Topo::CoFace* face = *iter;
 
-		std::vector<gmds::TCellID>& loc_polygones = face->faces(); //les polygones de la Topo::CoFace
+		const Topo::MeshCellIds& loc_polygones = face->faces(); //les polygones de la Topo::CoFace
 
-		for (std::vector<gmds::TCellID>::const_iterator iter_p = loc_polygones.begin();
+		for (Topo::MeshCellIds::const_iterator iter_p = loc_polygones.begin();
 				iter_p != loc_polygones.end(); ++iter_p){
 
 			gmds::Face current = gmdsMesh.get<gmds::Face>(*iter_p);
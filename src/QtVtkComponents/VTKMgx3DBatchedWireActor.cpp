@@ -0,0 +1,480 @@
+/**
+ * \file		VTKMgx3DBatchedWireActor.cpp
+ * \date		19/10/2026
+ */
+
+#include "Internal/Context.h"
+
+#include "QtVtkComponents/VTKMgx3DBatchedWireActor.h"
+#include "Utils/Common.h"
+#include "Utils/Entity.h"
+
+#include <TkUtil/Exception.h>
+#include <TkUtil/InternalError.h>
+#include <TkUtil/MemoryError.h>
+
+#include <vtkCellArray.h>
+#include <vtkCellData.h>
+#include <vtkPoints.h>
+#include <vtkProperty.h>
+
+#include <algorithm>
+#include <assert.h>
+
+
+using namespace std;
+using namespace TkUtil;
+using namespace Mgx3D::Utils;
+using namespace Mgx3D::Utils::Math;
+
+
+namespace Mgx3D
+{
+
+namespace QtVtkComponents
+{
+
+// ===========================================================================
+//                      LA CLASSE VTKMgx3DBatchedWireActor
+// ===========================================================================
+
+
+VTKMgx3DBatchedWireActor::VTKMgx3DBatchedWireActor ( )
+	: vtkActor ( ), _pieces ( ), _indices ( ), _cellRanges ( ),
+	  _entityActors ( ), _visibleNum (0), _pickableNum (0), _modified (false),
+	  _polyData (0), _mapper (0), _colors (0)
+{
+	_polyData	= vtkPolyData::New ( );
+	_colors		= vtkUnsignedCharArray::New ( );
+	_colors->SetName ("colors");
+	_colors->SetNumberOfComponents (3);
+	_mapper		= vtkPolyDataMapper::New ( );
+	_mapper->SetInputData (_polyData);
+	// Les couleurs sont portées par les mailles :
+	_mapper->ScalarVisibilityOn ( );
+	_mapper->SetScalarModeToUseCellData ( );
+	_mapper->SetColorModeToDirectScalars ( );
+	SetMapper (_mapper);
+	CHECK_NULL_PTR_ERROR (GetProperty ( ))
+	GetProperty ( )->SetRepresentationToSurface ( );
+	GetProperty ( )->SetInterpolationToFlat ( );
+	VisibilityOff ( );
+	PickableOff ( );
+}	// VTKMgx3DBatchedWireActor::VTKMgx3DBatchedWireActor
+
+
+VTKMgx3DBatchedWireActor::VTKMgx3DBatchedWireActor (const VTKMgx3DBatchedWireActor&)
+	: vtkActor ( ), _pieces ( ), _indices ( ), _cellRanges ( ),
+	  _entityActors ( ), _visibleNum (0), _pickableNum (0), _modified (false),
+	  _polyData (0), _mapper (0), _colors (0)
+{
+	assert (0 && "VTKMgx3DBatchedWireActor copy constructor is not allowed.");
+}	// VTKMgx3DBatchedWireActor copy constructor
+
+
+VTKMgx3DBatchedWireActor& VTKMgx3DBatchedWireActor::operator = (const VTKMgx3DBatchedWireActor&)
+{
+	assert (0 && "VTKMgx3DBatchedWireActor::operator = is not allowed.");
+	return *this;
+}	// VTKMgx3DBatchedWireActor::operator =
+
+
+VTKMgx3DBatchedWireActor::~VTKMgx3DBatchedWireActor ( )
+{
+	for (map<const Entity*, VTKMgx3DActor*>::iterator ita = _entityActors.begin ( ); _entityActors.end ( ) != ita; ita++)
+		(*ita).second->Delete ( );
+	_entityActors.clear ( );
+	SetMapper (0);
+	if (0 != _mapper)
+		_mapper->Delete ( );
+	_mapper		= 0;
+	if (0 != _colors)
+		_colors->Delete ( );
+	_colors		= 0;
+	if (0 != _polyData)
+		_polyData->Delete ( );
+	_polyData	= 0;
+}	// VTKMgx3DBatchedWireActor::~VTKMgx3DBatchedWireActor
+
+
+VTKMgx3DBatchedWireActor* VTKMgx3DBatchedWireActor::New ( )
+{
+	VTKMgx3DBatchedWireActor*	actor	= new VTKMgx3DBatchedWireActor ( );
+#ifndef VTK_5
+	actor->InitializeObjectBase ( );
+#endif	// VTK_5
+
+	return actor;
+}	// VTKMgx3DBatchedWireActor::New
+
+
+const char* VTKMgx3DBatchedWireActor::GetClassName ( )
+{
+	return "VTKMgx3DBatchedWireActor";
+}	// VTKMgx3DBatchedWireActor::GetClassName
+
+
+void VTKMgx3DBatchedWireActor::PrintSelf (ostream& os, vtkIndent indent)
+{
+	vtkActor::PrintSelf (os, indent);
+	os << indent << "Entities : " << _pieces.size ( ) << endl;
+}	// VTKMgx3DBatchedWireActor::PrintSelf
+
+
+int VTKMgx3DBatchedWireActor::RenderOpaqueGeometry (vtkViewport* viewport)
+{
+	UpdateBatch ( );
+
+	return vtkActor::RenderOpaqueGeometry (viewport);
+}	// VTKMgx3DBatchedWireActor::RenderOpaqueGeometry
+
+
+double* VTKMgx3DBatchedWireActor::GetBounds ( )
+{
+	UpdateBatch ( );
+
+	return vtkActor::GetBounds ( );
+}	// VTKMgx3DBatchedWireActor::GetBounds
+
+
+void VTKMgx3DBatchedWireActor::AddEntity (Entity& entity, const vector<Point>& points, const vector<size_t>& segments, const Color& color)
+{
+	if (_indices.end ( ) != _indices.find (&entity))
+	{
+		UTF8String	message (Charset::UTF_8);
+		message << "L'entité " << entity.getName ( ) << " est déjà représentée.";
+		INTERNAL_ERROR (exc, message, "VTKMgx3DBatchedWireActor::AddEntity")
+		throw exc;
+	}	// if (_indices.end ( ) != _indices.find (&entity))
+
+	_pieces.push_back (EntityPiece ( ));
+	EntityPiece&	piece	= _pieces.back ( );
+	piece.entity	= &entity;
+	piece.coords.reserve (3 * points.size ( ));
+	for (vector<Point>::const_iterator itp = points.begin ( ); points.end ( ) != itp; itp++)
+	{
+		piece.coords.push_back ((*itp).getX ( ));
+		piece.coords.push_back ((*itp).getY ( ));
+		piece.coords.push_back ((*itp).getZ ( ));
+	}	// for (vector<Point>::const_iterator itp = points.begin ( ); ...
+	piece.segments.assign (segments.begin ( ), segments.end ( ));
+	piece.color [0]	= color.getRed ( );
+	piece.color [1]	= color.getGreen ( );
+	piece.color [2]	= color.getBlue ( );
+	piece.visible	= true;
+	piece.pickable	= false;
+	piece.firstCell	= -1;
+	_indices [&entity]	= _pieces.size ( ) - 1;
+	_visibleNum++;
+	_modified	= true;
+
+	UpdateActorState ( );
+}	// VTKMgx3DBatchedWireActor::AddEntity
+
+
+void VTKMgx3DBatchedWireActor::RemoveEntity (const Entity& entity)
+{
+	unordered_map<const Entity*, size_t>::iterator	iti	= _indices.find (&entity);
+	if (_indices.end ( ) == iti)
+		return;
+
+	// On remplace la représentation enlevée par la dernière :
+	const size_t	index	= (*iti).second;
+	_indices.erase (iti);
+	if (true == _pieces [index].visible)
+	{
+		_visibleNum--;
+		if (true == _pieces [index].pickable)
+			_pickableNum--;
+	}	// if (true == _pieces [index].visible)
+	if (index != _pieces.size ( ) - 1)
+	{
+		std::swap (_pieces [index], _pieces.back ( ));
+		_indices [_pieces [index].entity]	= index;
+	}	// if (index != _pieces.size ( ) - 1)
+	_pieces.pop_back ( );
+	_modified	= true;
+
+	map<const Entity*, VTKMgx3DActor*>::iterator	ita	= _entityActors.find (&entity);
+	if (_entityActors.end ( ) != ita)
+	{
+		(*ita).second->Delete ( );
+		_entityActors.erase (ita);
+	}	// if (_entityActors.end ( ) != ita)
+
+	UpdateActorState ( );
+}	// VTKMgx3DBatchedWireActor::RemoveEntity
+
+
+bool VTKMgx3DBatchedWireActor::HasEntity (const Entity& entity) const
+{
+	return _indices.end ( ) == _indices.find (&entity) ? false : true;
+}	// VTKMgx3DBatchedWireActor::HasEntity
+
+
+vector<Entity*> VTKMgx3DBatchedWireActor::GetEntities ( ) const
+{
+	vector<Entity*>	entities;
+	entities.reserve (_pieces.size ( ));
+	for (vector<EntityPiece>::const_iterator itp = _pieces.begin ( ); _pieces.end ( ) != itp; itp++)
+		entities.push_back ((*itp).entity);
+
+	return entities;
+}	// VTKMgx3DBatchedWireActor::GetEntities
+
+
+size_t VTKMgx3DBatchedWireActor::GetEntitiesCount ( ) const
+{
+	return _pieces.size ( );
+}	// VTKMgx3DBatchedWireActor::GetEntitiesCount
+
+
+size_t VTKMgx3DBatchedWireActor::GetVisibleEntitiesCount ( ) const
+{
+	return _visibleNum;
+}	// VTKMgx3DBatchedWireActor::GetVisibleEntitiesCount
+
+
+void VTKMgx3DBatchedWireActor::SetEntityVisibility (const Entity& entity, bool visible)
+{
+	unordered_map<const Entity*, size_t>::const_iterator	iti	= _indices.find (&entity);
+	if (_indices.end ( ) == iti)
+		return;
+
+	EntityPiece&	piece	= _pieces [(*iti).second];
+	if (visible == piece.visible)
+		return;
+	piece.visible	= visible;
+	_modified		= true;
+	if (true == visible)
+		_visibleNum++;
+	else
+		_visibleNum--;
+	if (true == piece.pickable)
+	{
+		if (true == visible)
+			_pickableNum++;
+		else
+			_pickableNum--;
+	}	// if (true == piece.pickable)
+
+	UpdateActorState ( );
+}	// VTKMgx3DBatchedWireActor::SetEntityVisibility
+
+
+bool VTKMgx3DBatchedWireActor::GetEntityVisibility (const Entity& entity) const
+{
+	unordered_map<const Entity*, size_t>::const_iterator	iti	= _indices.find (&entity);
+
+	return _indices.end ( ) == iti ? false : _pieces [(*iti).second].visible;
+}	// VTKMgx3DBatchedWireActor::GetEntityVisibility
+
+
+void VTKMgx3DBatchedWireActor::SetEntityColor (const Entity& entity, const Color& color)
+{
+	unordered_map<const Entity*, size_t>::const_iterator	iti	= _indices.find (&entity);
+	if (_indices.end ( ) == iti)
+		return;
+
+	EntityPiece&	piece	= _pieces [(*iti).second];
+	if ((color.getRed ( ) == piece.color [0]) &&
+	    (color.getGreen ( ) == piece.color [1]) &&
+	    (color.getBlue ( ) == piece.color [2]))
+		return;
+	piece.color [0]	= color.getRed ( );
+	piece.color [1]	= color.getGreen ( );
+	piece.color [2]	= color.getBlue ( );
+
+	// Si le vtkPolyData est à jour on se contente d'actualiser les couleurs
+	// des mailles de l'entité :
+	if ((false == _modified) && (-1 != piece.firstCell))
+		UpdatePieceColors (piece);
+}	// VTKMgx3DBatchedWireActor::SetEntityColor
+
+
+void VTKMgx3DBatchedWireActor::SetEntityPickable (const Entity& entity, bool pickable)
+{
+	unordered_map<const Entity*, size_t>::const_iterator	iti	= _indices.find (&entity);
+	if (_indices.end ( ) == iti)
+		return;
+
+	EntityPiece&	piece	= _pieces [(*iti).second];
+	if (pickable == piece.pickable)
+		return;
+	piece.pickable	= pickable;
+	if (true == piece.visible)
+	{
+		if (true == pickable)
+			_pickableNum++;
+		else
+			_pickableNum--;
+	}	// if (true == piece.visible)
+
+	UpdateActorState ( );
+}	// VTKMgx3DBatchedWireActor::SetEntityPickable
+
+
+Entity* VTKMgx3DBatchedWireActor::GetEntity (vtkIdType cellId)
+{
+	UpdateBatch ( );
+
+	if ((0 > cellId) || (true == _cellRanges.empty ( )))
+		return 0;
+
+	// Recherche dichotomique de la dernière représentation dont la première
+	// maille est inférieure ou égale à cellId :
+	vector<pair<vtkIdType, size_t> >::const_iterator	itr	=
+		upper_bound (_cellRanges.begin ( ), _cellRanges.end ( ),
+		             pair<vtkIdType, size_t> (cellId, (size_t)-1));
+	if (_cellRanges.begin ( ) == itr)
+		return 0;
+	itr--;
+	const EntityPiece&	piece	= _pieces [(*itr).second];
+	if (cellId >= piece.firstCell + (vtkIdType)(piece.segments.size ( ) / 2))
+		return 0;
+
+	return true == piece.pickable ? piece.entity : 0;
+}	// VTKMgx3DBatchedWireActor::GetEntity
+
+
+vector<Entity*> VTKMgx3DBatchedWireActor::GetEntitiesInFrustum (vtkPlanes& frustum, bool completelyInside)
+{
+	vector<Entity*>	entities;
+	for (vector<EntityPiece>::const_iterator itp = _pieces.begin ( ); _pieces.end ( ) != itp; itp++)
+	{
+		if ((false == (*itp).visible) || (false == (*itp).pickable) || (true == (*itp).coords.empty ( )))
+			continue;
+
+		// Les plans du tronc de cône sont orientés vers l'extérieur, un point
+		// est intérieur si la fonction est négative ou nulle. Rem : un segment
+		// traversant le tronc de cône sans qu'aucune de ses extrémités ne
+		// soit à l'intérieur n'est pas pris en compte.
+		bool	inside	= completelyInside;
+		for (size_t i = 0; i < (*itp).coords.size ( ); i += 3)
+		{
+			double	coords [3]	= { (*itp).coords [i], (*itp).coords [i + 1], (*itp).coords [i + 2] };
+			const bool	in	= frustum.EvaluateFunction (coords) <= 0. ? true : false;
+			if (in != completelyInside)
+			{
+				inside	= in;
+				break;
+			}	// if (in != completelyInside)
+		}	// for (size_t i = 0; i < (*itp).coords.size ( ); i += 3)
+
+		if (true == inside)
+			entities.push_back ((*itp).entity);
+	}	// for (vector<EntityPiece>::const_iterator itp = _pieces.begin ( ); ...
+
+	return entities;
+}	// VTKMgx3DBatchedWireActor::GetEntitiesInFrustum
+
+
+VTKMgx3DActor* VTKMgx3DBatchedWireActor::GetEntityActor (Entity& entity)
+{
+	if (false == HasEntity (entity))
+	{
+		UTF8String	message (Charset::UTF_8);
+		message << "L'entité " << entity.getName ( ) << " n'est pas représentée.";
+		INTERNAL_ERROR (exc, message, "VTKMgx3DBatchedWireActor::GetEntityActor")
+		throw exc;
+	}	// if (false == HasEntity (entity))
+
+	map<const Entity*, VTKMgx3DActor*>::iterator	ita	= _entityActors.find (&entity);
+	if (_entityActors.end ( ) != ita)
+		return (*ita).second;
+
+	VTKMgx3DActor*	actor	= VTKMgx3DActor::New ( );
+	CHECK_NULL_PTR_ERROR (actor)
+	actor->SetEntity (&entity);
+	actor->SetRepresentationType (DisplayRepresentation::WIRE);
+	actor->PickableOn ( );
+	_entityActors [&entity]	= actor;
+
+	return actor;
+}	// VTKMgx3DBatchedWireActor::GetEntityActor
+
+
+void VTKMgx3DBatchedWireActor::UpdateBatch ( )
+{
+	if (false == _modified)
+		return;
+	_modified	= false;
+	_cellRanges.clear ( );
+
+	size_t	pointsNum	= 0, cellsNum	= 0;
+	for (vector<EntityPiece>::iterator itp = _pieces.begin ( ); _pieces.end ( ) != itp; itp++)
+	{
+		(*itp).firstCell	= -1;
+		if (false == (*itp).visible)
+			continue;
+		pointsNum	+= (*itp).coords.size ( ) / 3;
+		cellsNum	+= (*itp).segments.size ( ) / 2;
+	}	// for (vector<EntityPiece>::iterator itp = _pieces.begin ( ); ...
+
+	vtkPoints*		points		= vtkPoints::New ( );
+	vtkCellArray*	cellArray	= vtkCellArray::New ( );
+	CHECK_NULL_PTR_ERROR (points)
+	CHECK_NULL_PTR_ERROR (cellArray)
+	points->SetDataTypeToDouble ( );
+	points->SetNumberOfPoints (pointsNum);
+	cellArray->Allocate (3 * cellsNum, 3 * cellsNum);
+	_colors->SetNumberOfTuples (cellsNum);
+
+	vtkIdType	pointId	= 0, cellId	= 0;
+	for (size_t p = 0; p < _pieces.size ( ); p++)
+	{
+		EntityPiece&	piece	= _pieces [p];
+		if (false == piece.visible)
+			continue;
+
+		const vtkIdType	firstPoint	= pointId;
+		for (size_t i = 0; i < piece.coords.size ( ); i += 3, pointId++)
+			points->SetPoint (pointId, &piece.coords [i]);
+		piece.firstCell	= cellId;
+		for (size_t s = 0; s < piece.segments.size ( ); s += 2, cellId++)
+		{
+			vtkIdType	pts [2]	= { firstPoint + piece.segments [s], firstPoint + piece.segments [s + 1] };
+			cellArray->InsertNextCell (2, pts);
+		}	// for (size_t s = 0; s < piece.segments.size ( ); s += 2, cellId++)
+		if (cellId != piece.firstCell)
+			_cellRanges.push_back (pair<vtkIdType, size_t> (piece.firstCell, p));
+		UpdatePieceColors (piece);
+	}	// for (size_t p = 0; p < _pieces.size ( ); p++)
+
+	_polyData->Initialize ( );
+	_polyData->SetPoints (points);
+	_polyData->SetLines (cellArray);
+	_polyData->GetCellData ( )->SetScalars (_colors);
+	_polyData->BuildCells ( );
+	_polyData->Modified ( );
+	points->Delete ( );		points		= 0;
+	cellArray->Delete ( );	cellArray	= 0;
+}	// VTKMgx3DBatchedWireActor::UpdateBatch
+
+
+void VTKMgx3DBatchedWireActor::UpdateActorState ( )
+{
+	// Un vtkPolyData vide n'a pas de boite englobante valide, on masque
+	// l'acteur lorsqu'il n'y a rien à afficher :
+	const bool	visible		= 0 == _visibleNum ? false : true;
+	const bool	pickable	= 0 == _pickableNum ? false : true;
+	if (visible != (bool)GetVisibility ( ))
+		SetVisibility (visible);
+	if (pickable != (bool)GetPickable ( ))
+		SetPickable (pickable);
+}	// VTKMgx3DBatchedWireActor::UpdateActorState
+
+
+void VTKMgx3DBatchedWireActor::UpdatePieceColors (const EntityPiece& piece)
+{
+	const vtkIdType	last	= piece.firstCell + piece.segments.size ( ) / 2;
+	for (vtkIdType c = piece.firstCell; c < last; c++)
+		for (int i = 0; i < 3; i++)
+			_colors->SetValue (3 * c + i, piece.color [i]);
+	_colors->Modified ( );
+}	// VTKMgx3DBatchedWireActor::UpdatePieceColors
+
+
+}	// namespace QtVtkComponents
+
+}	// namespace Mgx3D
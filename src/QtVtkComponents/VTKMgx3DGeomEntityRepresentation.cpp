@@ -102,7 +102,7 @@ void VTKMgx3DGeomEntityRepresentation::createSurfacicRepresentation ( )
 
 void VTKMgx3DGeomEntityRepresentation::createWireRepresentation ( )
 {
-	if ((0 != _wirePolyData) || (0 != _wireMapper) || (0 != _wireActor))
+	if ((0 != _wirePolyData) || (0 != _wireMapper) || (0 != _wireActor) || (0 != _batchedWireActor))
 	{
 		INTERNAL_ERROR (exc, "Représentation déjà créée.", "VTKMgx3DGeomEntityRepresentation::createWireRepresentation")
 		throw exc;
@@ -116,10 +116,19 @@ void VTKMgx3DGeomEntityRepresentation::createWireRepresentation ( )
 	getEntity ( )->getRepresentation (gr, true);
 	vector<Math::Point>&	points		= gr.getPoints ( );
 	vector<size_t>&			segments	= gr.getCurveDiscretization ( );
+	// Regroupement éventuel avec les autres entités du même type :
+	if (true == createBatchedWireRepresentation (points, segments))
+		return;
 	VTKMgx3DEntityRepresentation::createSegmentsWireRepresentation(getEntity ( ), _wireActor, _wireMapper, _wirePolyData, points, segments);
 }	// VTKMgx3DGeomEntityRepresentation::createWireRepresentation
 
 
+bool VTKMgx3DGeomEntityRepresentation::isWireRepresentationBatchable ( ) const
+{
+	return true;
+}	// VTKMgx3DGeomEntityRepresentation::isWireRepresentationBatchable
+
+
 void VTKMgx3DGeomEntityRepresentation::createIsoWireRepresentation ( )
 {
 	if ((0 != _isoWirePolyData) || (0 != _isoWireMapper) || (0 != _isoWireActor))
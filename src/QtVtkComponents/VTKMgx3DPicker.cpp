@@ -2,16 +2,19 @@
 
 #include "QtVtkComponents/VTKMgx3DPicker.h"
 #include "QtVtkComponents/VTKMgx3DActor.h"
+#include "QtVtkComponents/VTKMgx3DBatchedWireActor.h"
 #include "QtVtkComponents/VTKConfiguration.h"
 
 #include <TkUtil/MemoryError.h>
 
 #include <vtkCamera.h>
+#include <vtkCellPicker.h>
 #include <vtkCommand.h>
 #include <vtkLine.h>		// vtkLine::DistanceToLine
 #include <vtkMath.h>
 #include <vtkPoints.h>
 #include <vtkProp3DCollection.h>
+#include <vtkSmartPointer.h>
 
 #include <assert.h>
 #include <iostream>
@@ -83,8 +86,26 @@ void VTKMgx3DPicker::CompletePicking ( )
 
 	_entities.clear ( );
 
+	// Les acteurs regroupant des représentations filaires sont remplacés par
+	// l'acteur "mandataire" de l'entité pointée :
+	vector<vtkActor*>	actors;
+	const vector<vtkActor*>&	pickedActors	= GetPickedActors ( );
+	for (vector<vtkActor*>::const_iterator ita = pickedActors.begin ( );
+	     pickedActors.end ( ) != ita; ita++)
+	{
+		VTKMgx3DBatchedWireActor*	batched	=
+							dynamic_cast<VTKMgx3DBatchedWireActor*>(*ita);
+		if (0 == batched)
+			actors.push_back (*ita);
+		else
+		{
+			Entity*	entity	= PickBatchedEntity (*batched);
+			if (0 != entity)
+				actors.push_back (batched->GetEntityActor (*entity));
+		}	// else if (0 == batched)
+	}	// for (vector<vtkActor*>::const_iterator ita = pickedActors.begin ( );
+
 	// On refait le tri si nécessaire en privilégiant les acteurs de type VTKMgx3DActor :
-	vector<vtkActor*>	actors	= GetPickedActors ( );
 	vector<vtkActor*>	resorted, others;
 	for (vector<vtkActor*>::const_iterator ita = actors.begin ( );
 	     actors.end ( ) != ita; ita++)
@@ -144,6 +165,28 @@ void VTKMgx3DPicker::CompletePicking ( )
 }	// VTKMgx3DPicker::CompletePicking
 
 
+Entity* VTKMgx3DPicker::PickBatchedEntity (VTKMgx3DBatchedWireActor& actor)
+{
+	vtkPicker*		picker		= GetPicker ( );
+	vtkRenderer*	renderer	= 0 == picker ? 0 : picker->GetRenderer ( );
+	if (0 == renderer)
+		return 0;
+
+	// On recherche la maille pointée parmi celles de l'acteur :
+	actor.UpdateBatch ( );
+	vtkSmartPointer<vtkCellPicker>	cellPicker	= vtkSmartPointer<vtkCellPicker>::New ( );
+	cellPicker->SetTolerance (GetCellTolerance ( ));
+	cellPicker->PickFromListOn ( );
+	cellPicker->AddPickList (&actor);
+	double	point [3]	= { 0., 0., 0. };
+	picker->GetSelectionPoint (point);
+	if (0 == cellPicker->Pick (point [0], point [1], point [2], renderer))
+		return 0;
+
+	return actor.GetEntity (cellPicker->GetCellId ( ));
+}	// VTKMgx3DPicker::PickBatchedEntity
+
+
 }	// namespace QtVtkComponents
 
 }	// namespace Mgx3D
@@ -164,11 +164,8 @@ bool VTKMgx3DSelectionManager::IsSelected (const vtkActor& actor) const
 	if (0 == entity)
 		return VTKECMSelectionManager::IsSelected (actor);
 
-	const vector<Entity*>	entities	= getEntities ( );
-	for (vector<Entity*>::const_iterator ite = entities.begin ( );
-	     entities.end ( ) != ite; ite++)
-		if (*ite == entity)
-			return true;
+	if (true == isSelected (*entity))
+		return true;
 
 	return VTKECMSelectionManager::IsSelected (actor);
 }	// VTKMgx3DSelectionManager::IsSelected
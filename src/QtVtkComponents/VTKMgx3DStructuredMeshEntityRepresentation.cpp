@@ -12,14 +12,14 @@
 #include <TkUtil/InternalError.h>
 #include <TkUtil/MemoryError.h>
 
-#include <vtkCellArray.h>
 #include <vtkCellData.h>
+#include <vtkDataObject.h>
 #include <vtkDoubleArray.h>
-#include <vtkIdTypeArray.h>
 #include <vtkProperty.h>
-#include <vtkSmartPointer.h>
+#include <vtkVersion.h>
 
 #include <cstdint>
+#include <cstring>
 #include <iostream>
 
 using namespace std;
@@ -42,13 +42,15 @@ namespace QtVtkComponents
 
 
 VTKMgx3DStructuredMeshEntityRepresentation::VTKMgx3DStructuredMeshEntityRepresentation (StructuredMeshEntity& entity)
-	: QtVtkComponents::VTKMgx3DEntityRepresentation (entity)
+	: QtVtkComponents::VTKMgx3DEntityRepresentation (entity),
+	  _rectilinearGrid (0), _densityFilter (0)
 {
 }	// VTKMgx3DStructuredMeshEntityRepresentation::VTKMgx3DStructuredMeshEntityRepresentation
 
 
 VTKMgx3DStructuredMeshEntityRepresentation::VTKMgx3DStructuredMeshEntityRepresentation (VTKMgx3DStructuredMeshEntityRepresentation& ver)
-	: QtVtkComponents::VTKMgx3DEntityRepresentation (*(ver.getEntity ( )))
+	: QtVtkComponents::VTKMgx3DEntityRepresentation (*(ver.getEntity ( ))),
+	  _rectilinearGrid (0), _densityFilter (0)
 {
 	MGX_FORBIDDEN ("VTKMgx3DStructuredMeshEntityRepresentation copy constructor is not allowed.");
 }	// VTKMgx3DStructuredMeshEntityRepresentation::VTKMgx3DStructuredMeshEntityRepresentation
@@ -160,16 +162,15 @@ void VTKMgx3DStructuredMeshEntityRepresentation::createVolumicRepresentation (co
 	}   // if (0 == getRenderingManager ( ))
 
 	const double	threshold	= getRenderingManager ( )->getStructuredDataThresholdValue ( );
-	if ((0 != _volumicGrid) || (0 != _volumicMapper) || (0 != _volumicActor))
+	if ((0 != _rectilinearGrid) || (0 != _volumicMapper) || (0 != _volumicActor))
 	{
 		INTERNAL_ERROR (exc, "Représentation déjà créée.",
                "VTKMgx3DStructuredMeshEntityRepresentation::createVolumicRepresentation")
 		throw exc;
-	}	// if ((0 != _volumicGrid) || ...
+	}	// if ((0 != _rectilinearGrid) || ...
 
-	_volumicGrid	= vtkUnstructuredGrid::New ( );
-	_volumicMapper	= vtkDataSetMapper::New ( );
-	_volumicMapper->SetInputData (_volumicGrid);
+	_rectilinearGrid	= vtkRectilinearGrid::New ( );
+	_volumicMapper		= vtkDataSetMapper::New ( );
 //	_volumicMapper->ScalarVisibilityOff ( );
 #if	VTK_MAJOR_VERSION < 8
 	_volumicMapper->SetImmediateModeRendering (!Internal::Resources::instance ( )._useDisplayList);
@@ -193,109 +194,62 @@ void VTKMgx3DStructuredMeshEntityRepresentation::createVolumicRepresentation (co
 	const Color&	volumicColor   = properties.getVolumicColor ( );
 //	_volumicActor->GetProperty ( )->SetColor (volumicColor.getRed ( ), volumicColor.getGreen ( ), volumicColor.getBlue ( ));
 	_volumicActor->SetMapper (_volumicMapper);
-	CHECK_NULL_PTR_ERROR (_volumicGrid)
-	vtkPoints*  points  = vtkPoints::New ( );
-	CHECK_NULL_PTR_ERROR (points)
-	_volumicGrid->Initialize ( );
-
-	const int64_t	ni	= mesh.ni ( ), nj	= mesh.nj ( ), nk	= mesh.nk ( );
-	const size_t	pointsNum	= (ni+1) * (nj+1) * (nk+1);
-	const size_t	cellsNum	= mesh.cellNum ( );
-	// Les sommets :
-	points->SetDataTypeToDouble ( );
-	points->Allocate ((ni+1) * (nj+1) * (nk+1));
-	for (int64_t i = 0; i <= ni; i++)
-	{
-		const vtkIdType iOffset = i * (nj + 1) * (nk + 1);
-		for (int64_t j = 0; j <= nj; j++)
-		{
-			const vtkIdType jOffset = j * (nk + 1);
-			for (int64_t k = 0; k <= nk; k++)
-			{
-				const vtkIdType offset  = iOffset + jOffset + k;
-				// Warum : inverser i et k (issu des tests préliminaires à intégration dans Mgx3D)
-				const double    coords [3]  = { abs [i], ord [j], ele [k] };
-//const double    coords [3]  = { abs [k], ord [j], ele [i] };
-				points->InsertPoint (offset, coords);
-			}	// for (int64_t k = 0; i <= nk; k++)
-		}	// for (int64_t j = 0; j <= nj; j++)
-	}	// for (int64_t i = 0; i <= ni; i++)
-	_volumicGrid->SetPoints (points);
-	points->Delete ( );		points		= 0;
-
-	vtkCellArray*	cellArray	= vtkCellArray::New ( );
-	vtkIdTypeArray*	idArray		= vtkIdTypeArray::New ( );
-	idArray->Allocate (9 * (ni * nj * nk), ni * nj * nk);
-	vtkIdType*	cellsPtr	= idArray->GetPointer (0);
-	int*		cellTypes	= new int [ni * nj * nk];
-	size_t		c		= 0;
-	for (int64_t i = 0; i < ni; i++)
+
+	// Les composantes des noeuds sur les 3 axes, recopiées (ni+1 + nj+1 + nk+1
+	// valeurs) :
+	const double*	axes [3]	= { abs, ord, ele };
+	const int64_t	dims [3]	= { mesh.ni ( ) + 1, mesh.nj ( ) + 1, mesh.nk ( ) + 1 };
+	vtkDoubleArray*	coords [3]	= { 0, 0, 0 };
+	for (int d = 0; d < 3; d++)
 	{
-		const vtkIdType iOffset		= i * (nj + 1) * (nk + 1);
-		const vtkIdType ip1Offset	= (i + 1) * (nj + 1) * (nk + 1);
-		for (int64_t j = 0; j < nj; j++)
-		{
-			const vtkIdType jOffset		= j * (nk + 1);
-			const vtkIdType jp1Offset	= (j + 1) * (nk + 1);
-			for (int64_t k = 0; k < nk; k++)
-			{
-				const int64_t	id	= k * nj * ni + j * ni + i;
-				if (densities [id] < threshold)
-					continue;
-
-				*cellsPtr++ = 8;    // Hexahedron
-				*cellsPtr++ = iOffset + jOffset + k;
-				*cellsPtr++ = ip1Offset + jOffset + k;
-				*cellsPtr++ = ip1Offset + jp1Offset + k;
-				*cellsPtr++ = iOffset + jp1Offset + k;
-				*cellsPtr++ = iOffset + jOffset + k + 1;
-				*cellsPtr++ = ip1Offset + jOffset + k + 1;
-				*cellsPtr++ = ip1Offset + jp1Offset + k + 1;
-				*cellsPtr++ = iOffset + jp1Offset + k + 1;
-				cellTypes [c++] = VTK_HEXAHEDRON;
-			}	// for (int64_t k = 0; k < nk; k++)
-		}	// for (int64_t j = 0; j < nj; j++)
-	}	// for (int64_t i = 0; i <= ni; i++)
-
-	idArray->SetNumberOfValues (9 * c);
-	cellArray->SetCells (c, idArray);
-	cellArray->Squeeze ( );
-	_volumicGrid->SetCells (cellTypes, cellArray);
-	delete [] cellTypes;	cellTypes	= 0;
-	cellArray->Delete ( );	cellArray	= 0;
-	idArray->Delete ( );	idArray		= 0;
-
-	// Les valeurs aux mailles :
-	vtkSmartPointer<vtkDoubleArray> vdensities  = vtkDoubleArray::New ( );
+		coords [d]	= vtkDoubleArray::New ( );
+		CHECK_NULL_PTR_ERROR (coords [d])
+		coords [d]->SetNumberOfValues (dims [d]);
+		memcpy (coords [d]->GetPointer (0), axes [d], dims [d] * sizeof (double));
+	}	// for (int d = 0; d < 3; d++)
+	_rectilinearGrid->SetDimensions (dims [0], dims [1], dims [2]);
+	_rectilinearGrid->SetXCoordinates (coords [0]);
+	_rectilinearGrid->SetYCoordinates (coords [1]);
+	_rectilinearGrid->SetZCoordinates (coords [2]);
+	for (int d = 0; d < 3; d++)
+		coords [d]->Delete ( );
+
+	// Les valeurs aux mailles, recopiées car le maillage peut remplacer son
+	// tableau (setCellDensities) : la maille (i, j, k) est rangée en
+	// k * nj * ni + j * ni + i, ce qui correspond à la numérotation des
+	// mailles d'une grille rectilinéaire VTK.
+	const int64_t	cellNum		= mesh.cellNum ( );
+	vtkDoubleArray*	vdensities	= vtkDoubleArray::New ( );
+	CHECK_NULL_PTR_ERROR (vdensities)
 	vdensities->SetName ("densities");
-	vdensities->SetNumberOfValues (ni * nj * nk);
-	c		= 0;
-	int64_t	n	= 0;
-	for (int64_t i = 0; i < ni; i++)
+	vdensities->SetNumberOfValues (cellNum);
+	memcpy (vdensities->GetPointer (0), densities, cellNum * sizeof (double));
+	double	densityMin	= 0 == cellNum ? 0. : densities [0];
+	for (int64_t id = 1; id < cellNum; id++)
+		if (densities [id] < densityMin)
+			densityMin	= densities [id];
+	_rectilinearGrid->GetCellData ( )->SetScalars (vdensities);
+	vdensities->Delete ( );		vdensities	= 0;
+
+	// Seuillage à la demande : on n'affiche que les mailles dont la densité
+	// atteint le seuil.
+	if (threshold > densityMin)
 	{
-		for (int64_t j = 0; j < nj; j++)
-		{
-			for (int64_t k = 0; k < nk; k++, n++)
-			{
-				const int64_t	    id	= k * nj * ni + j * ni + i;
-				const double	d	= densities [id];
-				if (d < threshold)
-					continue;
-	
-				vdensities->SetValue (c++, d);
-			}	// for (int64_t k = 0; k < nk; k++, n++)
-		}	// for (int64_t j = 0; j < nj; j++)
-	}	// for (int64_t i = 0; i < ni; i++)
-
-	if (0 == c)
-	{
-		_volumicActor->SetMapper (0);
-		_volumicMapper->SetInputData (0);
-	}
-	vdensities->SetNumberOfValues (c);
-	vdensities->Squeeze ( );
-	_volumicGrid->GetCellData ( )->AddArray (vdensities);
-	_volumicGrid->GetCellData ( )->SetActiveAttribute ("densities", vtkDataSetAttributes::SCALARS);
+		_densityFilter	= vtkThreshold::New ( );
+		CHECK_NULL_PTR_ERROR (_densityFilter)
+		_densityFilter->SetInputData (_rectilinearGrid);
+		_densityFilter->SetInputArrayToProcess (0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_CELLS, "densities");
+#if (VTK_MAJOR_VERSION > 9) || ((VTK_MAJOR_VERSION == 9) && (VTK_MINOR_VERSION >= 1))
+		_densityFilter->SetLowerThreshold (threshold);
+		_densityFilter->SetThresholdFunction (vtkThreshold::THRESHOLD_UPPER);
+#else	// VTK >= 9.1
+		_densityFilter->ThresholdByUpper (threshold);
+#endif	// VTK >= 9.1
+		_volumicMapper->SetInputConnection (_densityFilter->GetOutputPort ( ));
+	}	// if (threshold > densityMin)
+	else
+		_volumicMapper->SetInputData (_rectilinearGrid);
+
 	_volumicMapper->SetScalarModeToUseCellData ( );
 	_volumicMapper->ScalarVisibilityOn ( );
 	_volumicMapper->SetColorModeToMapScalars ( );
@@ -308,6 +262,28 @@ void VTKMgx3DStructuredMeshEntityRepresentation::createVolumicRepresentation (co
 }	// VTKMgx3DStructuredMeshEntityRepresentation::createVolumicRepresentation
 
 
+bool VTKMgx3DStructuredMeshEntityRepresentation::hasVolumicRepresentation ( ) const
+{
+	return 0 == _rectilinearGrid ? false : true;
+}	// VTKMgx3DStructuredMeshEntityRepresentation::hasVolumicRepresentation
+
+
+void VTKMgx3DStructuredMeshEntityRepresentation::destroyRepresentations (bool realyDestroy)
+{
+	VTKMgx3DEntityRepresentation::destroyRepresentations (realyDestroy);
+
+	if (true == realyDestroy)
+	{
+		if (0 != _densityFilter)
+			_densityFilter->Delete ( );
+		_densityFilter		= 0;
+		if (0 != _rectilinearGrid)
+			_rectilinearGrid->Delete ( );
+		_rectilinearGrid	= 0;
+	}	// if (true == realyDestroy)
+}	// VTKMgx3DStructuredMeshEntityRepresentation::destroyRepresentations
+
+
 void VTKMgx3DStructuredMeshEntityRepresentation::createWireRepresentation ( )
 {
 	if ((0 != _wirePolyData) || (0 != _wireMapper) || (0 != _wireActor))
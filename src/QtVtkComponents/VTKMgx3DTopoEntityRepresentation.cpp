@@ -269,7 +269,7 @@ void VTKMgx3DTopoEntityRepresentation::createSurfacicRepresentation ( )
 
 void VTKMgx3DTopoEntityRepresentation::createWireRepresentation ( )
 {
-	if ((0 != _wirePolyData) || (0 != _wireMapper) || (0 != _wireActor))
+	if ((0 != _wirePolyData) || (0 != _wireMapper) || (0 != _wireActor) || (0 != _batchedWireActor))
 	{
 		INTERNAL_ERROR (exc, "Représentation déjà créée.", "VTKMgx3DTopoEntityRepresentation::createWireRepresentation")
 		throw exc;
@@ -282,10 +282,19 @@ void VTKMgx3DTopoEntityRepresentation::createWireRepresentation ( )
 	getEntity ( )->getRepresentation (tr, true);
 	vector<Math::Point>&	points		= tr.getPoints ( );
 	vector<size_t>&			segments	= tr.getCurveDiscretization ( );
+	// Regroupement éventuel avec les autres entités du même type :
+	if (true == createBatchedWireRepresentation (points, segments))
+		return;
 	VTKMgx3DEntityRepresentation::createSegmentsWireRepresentation (getEntity ( ), _wireActor, _wireMapper, _wirePolyData, points, segments);
 }	// VTKMgx3DTopoEntityRepresentation::createWireRepresentation
 
 
+bool VTKMgx3DTopoEntityRepresentation::isWireRepresentationBatchable ( ) const
+{
+	return true;
+}	// VTKMgx3DTopoEntityRepresentation::isWireRepresentationBatchable
+
+
 void VTKMgx3DTopoEntityRepresentation::createMeshShapeCloudRepresentation ( )
 {
 	if ((0 != _cloudGrid) || (0 != _cloudMapper) || (0 != _cloudActor))
@@ -789,7 +789,7 @@ VTKRenderingManager::VTKRenderingManager (QtVtkGraphicWidget* vtkWidget, bool of
 	  _focalPointAxesActor (0), _focalPointAxesTag ((unsigned long)-1),
 	  _trihedron (0), _trihedronCommandTag (0), _viewCubeActor (0), _viewCubeCommandTag (0),_trihedronRenderer (0), _viewCubeRenderer (0),
 	  _axisActor (0), _axisProperties ( ),
-	  _colorTables ( )
+	  _colorTables ( ), _batchedWireActors ( )
 {
 	// ==========================================================================================================
 	// IMPORTANT : Si backend OpenGL2 pas de Render prématuré car plante dans la phase d'initialisation 
@@ -888,7 +888,7 @@ VTKRenderingManager::VTKRenderingManager ( )
 	  _focalPointAxesActor (0), _focalPointAxesTag ((unsigned long)-1),
 	  _trihedron (0), _trihedronCommandTag (0), _viewCubeActor (0), _viewCubeCommandTag (0), _trihedronRenderer (0), _viewCubeRenderer (0),
 	  _axisActor (0), _axisProperties ( ),
-	  _colorTables ( )
+	  _colorTables ( ), _batchedWireActors ( )
 {
 }	// VTKRenderingManager::VTKRenderingManager
 
@@ -902,7 +902,7 @@ VTKRenderingManager::VTKRenderingManager (const VTKRenderingManager&)
 	  _focalPointAxesActor (0), _focalPointAxesTag ((unsigned long)-1),
 	  _trihedron (0), _trihedronCommandTag (0), _viewCubeActor (0), _viewCubeCommandTag (0), _trihedronRenderer (0), _viewCubeRenderer (0),
 	  _axisActor (0), _axisProperties ( ),
-	  _colorTables ( )
+	  _colorTables ( ), _batchedWireActors ( )
 {
 	MGX_FORBIDDEN ("VTKRenderingManager copy constructor is not allowed.");
 }	// VTKRenderingManager::VTKRenderingManager (const VTKRenderingManager&)
@@ -922,6 +922,14 @@ VTKRenderingManager::~VTKRenderingManager ( )
 	while (false == _colorTables.empty ( ))
 		removeColorTable (_colorTables [0]);
 
+	for (map<pair<Entity::objectType, double>, VTKMgx3DBatchedWireActor*>::iterator itb = _batchedWireActors.begin ( ); _batchedWireActors.end ( ) != itb; itb++)
+	{
+		if (true == hasRenderer ( ))
+			getRenderer ( ).RemoveViewProp ((*itb).second);
+		(*itb).second->Delete ( );
+	}	// for (map<pair<Entity::objectType, double>, ...
+	_batchedWireActors.clear ( );
+
 	if (0 != _magix3dPicker)
 	{
 		if (0 != _pickerCommandTag)
@@ -1010,7 +1018,14 @@ bool VTKRenderingManager::hasDisplayedRepresentation ( ) const
 	{
 		vtkPropCollection*	props	= getRenderer ( ).GetViewProps ( );
 		CHECK_NULL_PTR_ERROR (props)
-		has = 0 == props->GetNumberOfItems ( ) ? false : true;
+		// Les acteurs regroupant des représentations filaires restent dans le
+		// renderer même lorsqu'ils n'ont rien à afficher (aucune entité, ou
+		// entités toutes masquées) :
+		size_t	batchedNum	= 0;
+		for (map<pair<Entity::objectType, double>, VTKMgx3DBatchedWireActor*>::const_iterator itb = _batchedWireActors.begin ( ); _batchedWireActors.end ( ) != itb; itb++)
+			if (0 == (*itb).second->GetVisibleEntitiesCount ( ))
+				batchedNum++;
+		has = batchedNum == (size_t)props->GetNumberOfItems ( ) ? false : true;
 	}	// if (true == hasRenderer ( ))
 
 	return has;
@@ -1036,6 +1051,14 @@ vector<Entity*> VTKRenderingManager::getDisplayedEntities ( )
 		if ((0 != mgxActor) && (0 != mgxActor->GetEntity ( )))
 			entities.insert (mgxActor->GetEntity ( ));
 	}	// for (actors->InitTraversal ( ); ...
+	// Les entités dont la représentation filaire est regroupée :
+	for (map<pair<Entity::objectType, double>, VTKMgx3DBatchedWireActor*>::const_iterator itb = _batchedWireActors.begin ( ); _batchedWireActors.end ( ) != itb; itb++)
+	{
+		const vector<Entity*>	batched	= (*itb).second->GetEntities ( );
+		for (vector<Entity*>::const_iterator ite = batched.begin ( ); batched.end ( ) != ite; ite++)
+			if (true == (*itb).second->GetEntityVisibility (**ite))
+				entities.insert (*ite);
+	}	// for (map<pair<Entity::objectType, double>, ...
 
 	vector<Entity*>	uniqueEntities;
 	for (set<Entity*>::const_iterator it = entities.begin ( );
@@ -1046,6 +1069,45 @@ vector<Entity*> VTKRenderingManager::getDisplayedEntities ( )
 }	// VTKRenderingManager::getDisplayedEntities
 
 
+VTKMgx3DBatchedWireActor& VTKRenderingManager::getBatchedWireActor (Entity::objectType type, double lineWidth)
+{
+	const pair<Entity::objectType, double>	key (type, lineWidth);
+	map<pair<Entity::objectType, double>, VTKMgx3DBatchedWireActor*>::iterator	itb	= _batchedWireActors.find (key);
+	if (_batchedWireActors.end ( ) != itb)
+		return *((*itb).second);
+
+	VTKMgx3DBatchedWireActor*	actor	= VTKMgx3DBatchedWireActor::New ( );
+	CHECK_NULL_PTR_ERROR (actor)
+	CHECK_NULL_PTR_ERROR (actor->GetProperty ( ))
+	actor->GetProperty ( )->SetLineWidth (lineWidth);
+	_batchedWireActors [key]	= actor;
+	getRenderer ( ).AddViewProp (actor);
+
+	return *actor;
+}	// VTKRenderingManager::getBatchedWireActor
+
+
+vector<VTKMgx3DBatchedWireActor*> VTKRenderingManager::getBatchedWireActors ( ) const
+{
+	vector<VTKMgx3DBatchedWireActor*>	actors;
+	for (map<pair<Entity::objectType, double>, VTKMgx3DBatchedWireActor*>::const_iterator itb = _batchedWireActors.begin ( ); _batchedWireActors.end ( ) != itb; itb++)
+		actors.push_back ((*itb).second);
+
+	return actors;
+}	// VTKRenderingManager::getBatchedWireActors
+
+
+size_t VTKRenderingManager::getViewPropsCount ( ) const
+{
+	if (false == hasRenderer ( ))
+		return 0;
+
+	vtkPropCollection*	props	= getRenderer ( ).GetViewProps ( );
+
+	return 0 == props ? 0 : props->GetNumberOfItems ( );
+}	// VTKRenderingManager::getViewPropsCount
+
+
 void VTKRenderingManager::getDisplayedValues (vector<RenderingManager::ColorTableDefinition>& definitions)
 {
 	if (false == hasRenderer ( ))
@@ -9,6 +9,7 @@
 #include "QtVtkComponents/VTKSelectionManagerDimFilter.h"
 #include "QtVtkComponents/VTKConfiguration.h"
 #include "QtVtkComponents/VTKMgx3DActor.h"
+#include "QtVtkComponents/VTKMgx3DBatchedWireActor.h"
 #include "Internal/SelectionManagerDimFilter.h"
 
 #include <TkUtil/Exception.h>
@@ -111,6 +112,25 @@ void VTKSelectionManagerDimFilter::activateSelection (
 		props->InitTraversal ( );
 		for (vtkProp* prop = props->GetNextProp ( ); 0 != prop; prop = props->GetNextProp ( ))
 		{
+			// Représentations filaires regroupées : le caractère sélectionnable
+			// est porté par chaque entité.
+			VTKMgx3DBatchedWireActor*	batched	=
+							dynamic_cast<VTKMgx3DBatchedWireActor*>(prop);
+			if (0 != batched)
+			{
+				const vector<Entity*>	entities	= batched->GetEntities ( );
+				for (vector<Entity*>::const_iterator ite = entities.begin ( );
+				     entities.end ( ) != ite; ite++)
+				{
+					const bool	pickable	=
+						SelectionManager::NO_DIM == dimensions ?
+						false : isSelectionActivated (**ite);
+					(*ite)->getDisplayProperties ( ).getGraphicalRepresentation ( )->setSelectable (pickable);
+					batched->SetEntityPickable (**ite, pickable);
+				}	// for (vector<Entity*>::const_iterator ite = ...
+				continue;
+			}	// if (0 != batched)
+
 			VTKMgx3DActor*	mgxActor	= dynamic_cast<VTKMgx3DActor*>(prop);
 			Entity*			entity		= 0 == mgxActor ? 0 : mgxActor->GetEntity  ( );
 			if (0 != entity)
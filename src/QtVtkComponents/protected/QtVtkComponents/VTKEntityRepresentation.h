@@ -7,6 +7,7 @@
 #define VTK_ENTITY_REPRESENTATION_H
 
 #include "QtVtkComponents/VTKMgx3DActor.h"
+#include "QtVtkComponents/VTKMgx3DBatchedWireActor.h"
 #include "QtVtkComponents/VTKRenderingManager.h"
 #include "QtComponents/RenderedEntityRepresentation.h"
 #include "VtkComponents/vtkUnstructuredGridRefinementFilter.h"
@@ -163,6 +164,13 @@ class VTKEntityRepresentation : public QtComponents::RenderedEntityRepresentatio
      */
     virtual void createVolumicRepresentation ( ) {}
 
+	/**
+	 * \return	<I>true</I> si la représentation volumique de l'entité est
+	 *			créée, <I>false</I> dans le cas contraire.
+	 * \see		createVolumicRepresentation
+	 */
+	virtual bool hasVolumicRepresentation ( ) const;
+
 	/**
 	 * Créé la représentation filaire de l'entité représentée.
 	 * \see createCloudRepresentation
@@ -183,6 +191,44 @@ class VTKEntityRepresentation : public QtComponents::RenderedEntityRepresentatio
      */
     virtual void createMeshShapeWireRepresentation ( ) {}
 
+	/**
+	 * \return	<I>true</I> si la représentation filaire de l'entité peut
+	 *			être regroupée avec celles des autres entités de même type
+	 *			(cf. <I>VTKMgx3DBatchedWireActor</I>), <I>false</I> dans le
+	 *			cas contraire. Retourne <I>false</I> par défaut.
+	 * \see		useBatchedWireRepresentation
+	 */
+	virtual bool isWireRepresentationBatchable ( ) const;
+
+	/**
+	 * \return	<I>true</I> si la représentation filaire de l'entité doit
+	 *			actuellement être regroupée : elle est regroupable, la
+	 *			préférence <I>batchedWireRepresentations</I> est activée, et
+	 *			l'entité n'est ni sélectionnée, ni mise en évidence, ni
+	 *			transparente.
+	 * \see		isWireRepresentationBatchable
+	 */
+	virtual bool useBatchedWireRepresentation ( ) const;
+
+	/**
+	 * Confie la représentation filaire transmise en argument à l'acteur
+	 * regroupant celles des entités de même type si
+	 * <I>useBatchedWireRepresentation</I> le permet.
+	 * \return	<I>true</I> si la représentation est regroupée, <I>false</I>
+	 *			s'il faut créer les acteurs propres à l'entité.
+	 * \see		createWireRepresentation
+	 */
+	virtual bool createBatchedWireRepresentation (
+						const std::vector<Utils::Math::Point>& points,
+						const std::vector<size_t>& segments);
+
+	/**
+	 * Regroupe ou individualise la représentation filaire affichée si
+	 * <I>useBatchedWireRepresentation</I> a changé (ex : suite à une
+	 * sélection).
+	 */
+	virtual void updateWireBatching ( );
+
 	/**
      * Créé la représentation de la discrétisation.
      * \see createWireRepresentation
@@ -329,6 +375,10 @@ class VTKEntityRepresentation : public QtComponents::RenderedEntityRepresentatio
 	/** Le mapper associé en mode filaire. */
 	vtkPolyDataMapper*		   	_wireMapper;
 
+	/** L'éventuel acteur regroupant la représentation filaire avec celles
+	 * d'autres entités, auquel cas _wireActor est nul. */
+	VTKMgx3DBatchedWireActor*	_batchedWireActor;
+
 	/** Le maillage complémentaire ISO représentant l'entité en mode filaire. */
 	vtkPolyData*				_isoWirePolyData;
 
@@ -0,0 +1,239 @@
+/**
+ * \file		VTKMgx3DBatchedWireActor.h
+ * \date		19/10/2026
+ */
+#ifndef VTK_MGX3D_BATCHED_WIRE_ACTOR_H
+#define VTK_MGX3D_BATCHED_WIRE_ACTOR_H
+
+
+#include "QtVtkComponents/VTKMgx3DActor.h"
+#include "Utils/Point.h"
+
+#include <TkUtil/PaintAttributes.h>
+
+#include <vtkActor.h>
+#include <vtkPlanes.h>
+#include <vtkPolyData.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkUnsignedCharArray.h>
+
+#include <iostream>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+
+namespace Mgx3D
+{
+
+namespace QtVtkComponents
+{
+
+/**
+ * <P>Acteur <I>VTK</I> regroupant les représentations filaires de plusieurs
+ * entités de même type (ex : arêtes topologiques) dans un unique
+ * <I>vtkPolyData</I>. L'objectif est de limiter le nombre d'acteurs confiés
+ * au <I>renderer</I> lorsque de très nombreuses entités sont affichées.</P>
+ *
+ * <P>Chaque entité occupe un intervalle contigu de mailles. Sa couleur est
+ * portée par un tableau de couleurs aux mailles, son caractère affiché ou
+ * non est pris en compte lors de la reconstruction du <I>vtkPolyData</I>.
+ * Cette reconstruction est différée au prochain rendu (ou calcul de boite
+ * englobante), ce qui permet d'ajouter/enlever de nombreuses entités à coût
+ * constant.</P>
+ *
+ * <P>Les entités sélectionnées ou mises en évidence ne sont pas regroupées :
+ * leur représentation étant transitoire elles conservent leur propre acteur
+ * (cf. <I>VTKEntityRepresentation</I>).</P>
+ *
+ * <P>Le <I>picking</I> étant basé sur les acteurs, la méthode
+ * <I>GetEntityActor</I> retourne pour une entité regroupée un acteur
+ * <I>VTKMgx3DActor</I> "mandataire", non affiché, permettant aux
+ * gestionnaires de sélection de retrouver l'entité pointée.</P>
+ */
+class VTKMgx3DBatchedWireActor : public vtkActor
+{
+	public :
+
+	/**
+	 * Destructeur. RAS.
+	 */
+	virtual ~VTKMgx3DBatchedWireActor ( );
+
+	/**
+	 * Instanciateur VTK. RAS.
+	 */
+	static VTKMgx3DBatchedWireActor* New ( );
+
+	virtual const char* GetClassName ( );
+
+	virtual void PrintSelf (std::ostream& os, vtkIndent indent);
+
+	/**
+	 * Reconstruit si nécessaire le <I>vtkPolyData</I> avant le rendu.
+	 */
+	virtual int RenderOpaqueGeometry (vtkViewport* viewport);
+
+	/**
+	 * Reconstruit si nécessaire le <I>vtkPolyData</I> avant le calcul de la
+	 * boite englobante.
+	 */
+	virtual double* GetBounds ( );
+
+	/**
+	 * Ajoute la représentation filaire de l'entité transmise en argument.
+	 * \param		Entité représentée
+	 * \param		Sommets de la représentation
+	 * \param		Segments de la représentation (couples d'indices dans le
+	 *				vecteur des sommets).
+	 * \param		Couleur de la représentation.
+	 * \exception	Lève une exception si l'entité est déjà représentée.
+	 * \see			RemoveEntity
+	 */
+	virtual void AddEntity (
+			Mgx3D::Utils::Entity& entity,
+			const std::vector<Mgx3D::Utils::Math::Point>& points,
+			const std::vector<size_t>& segments, const TkUtil::Color& color);
+
+	/**
+	 * Enlève la représentation filaire de l'entité transmise en argument.
+	 * Ne fait rien si l'entité n'est pas représentée.
+	 * \see			AddEntity
+	 */
+	virtual void RemoveEntity (const Mgx3D::Utils::Entity& entity);
+
+	/**
+	 * \return		<I>true</I> si l'entité est représentée par cet acteur,
+	 *				<I>false</I> dans le cas contraire.
+	 */
+	virtual bool HasEntity (const Mgx3D::Utils::Entity& entity) const;
+
+	/**
+	 * \return		Les entités représentées par cet acteur.
+	 */
+	virtual std::vector<Mgx3D::Utils::Entity*> GetEntities ( ) const;
+
+	/**
+	 * \return		Le nombre d'entités représentées par cet acteur.
+	 */
+	virtual size_t GetEntitiesCount ( ) const;
+
+	/**
+	 * \return		Le nombre d'entités représentées et affichées par cet
+	 *				acteur (cf. <I>GetEntityVisibility</I>).
+	 */
+	virtual size_t GetVisibleEntitiesCount ( ) const;
+
+	/**
+	 * Affiche ou masque la représentation de l'entité.
+	 */
+	virtual void SetEntityVisibility (const Mgx3D::Utils::Entity& entity, bool visible);
+	virtual bool GetEntityVisibility (const Mgx3D::Utils::Entity& entity) const;
+
+	/**
+	 * Modifie la couleur de la représentation de l'entité. Ne reconstruit pas
+	 * le <I>vtkPolyData</I>, seules les couleurs des mailles de l'entité sont
+	 * actualisées.
+	 */
+	virtual void SetEntityColor (const Mgx3D::Utils::Entity& entity, const TkUtil::Color& color);
+
+	/**
+	 * Rend sélectionnable ou non l'entité à la souris. L'acteur est
+	 * sélectionnable si au moins une de ses entités affichées l'est.
+	 */
+	virtual void SetEntityPickable (const Mgx3D::Utils::Entity& entity, bool pickable);
+
+	/**
+	 * \return		L'entité représentée par la maille transmise en argument,
+	 *				ou 0 si cette entité n'est pas sélectionnable.
+	 */
+	virtual Mgx3D::Utils::Entity* GetEntity (vtkIdType cellId);
+
+	/**
+	 * \return		Les entités affichées et sélectionnables dont au moins un
+	 *				sommet (ou tous les sommets si <I>completelyInside</I> vaut
+	 *				<I>true</I>) est dans le tronc de cône transmis en argument.
+	 */
+	virtual std::vector<Mgx3D::Utils::Entity*> GetEntitiesInFrustum (
+									vtkPlanes& frustum, bool completelyInside);
+
+	/**
+	 * \return		Un acteur "mandataire", non affiché, associé à l'entité
+	 *				transmise en argument. Cet acteur est détenu par l'instance
+	 *				et reste valide tant que l'entité est représentée.
+	 */
+	virtual VTKMgx3DActor* GetEntityActor (Mgx3D::Utils::Entity& entity);
+
+	/**
+	 * Reconstruit le <I>vtkPolyData</I> s'il n'est plus à jour.
+	 */
+	virtual void UpdateBatch ( );
+
+
+	protected :
+
+	VTKMgx3DBatchedWireActor ( );
+
+
+	private :
+
+	VTKMgx3DBatchedWireActor (const VTKMgx3DBatchedWireActor&);
+	VTKMgx3DBatchedWireActor& operator = (const VTKMgx3DBatchedWireActor&);
+
+	/**
+	 * La représentation filaire d'une entité.
+	 */
+	struct EntityPiece
+	{
+		Mgx3D::Utils::Entity*		entity;
+		/** Les coordonnées des sommets (3 par sommet). */
+		std::vector<double>			coords;
+		/** Les segments (couples d'indices locaux des sommets). */
+		std::vector<vtkIdType>		segments;
+		unsigned char				color [3];
+		bool						visible, pickable;
+		/** Indice de la première maille dans le vtkPolyData, -1 si absente. */
+		vtkIdType					firstCell;
+	};	// struct EntityPiece
+
+	/**
+	 * Actualise la visibilité et le caractère sélectionnable de l'acteur.
+	 */
+	void UpdateActorState ( );
+
+	/**
+	 * Applique la couleur de l'entité à ses mailles.
+	 */
+	void UpdatePieceColors (const EntityPiece& piece);
+
+	/** Les représentations des entités. */
+	std::vector<EntityPiece>						_pieces;
+
+	/** Indice de la représentation de chaque entité dans _pieces. */
+	std::unordered_map<const Mgx3D::Utils::Entity*, size_t>	_indices;
+
+	/** Première maille et indice dans _pieces des représentations présentes
+	 * dans le vtkPolyData, par ordre croissant de maille. */
+	std::vector<std::pair<vtkIdType, size_t> >		_cellRanges;
+
+	/** Les acteurs "mandataires" utilisés pour le picking. */
+	std::map<const Mgx3D::Utils::Entity*, VTKMgx3DActor*>	_entityActors;
+
+	/** Nombre de représentations affichées, et affichées et sélectionnables. */
+	size_t											_visibleNum, _pickableNum;
+
+	/** <I>true</I> si le vtkPolyData doit être reconstruit. */
+	bool											_modified;
+
+	vtkPolyData*									_polyData;
+	vtkPolyDataMapper*								_mapper;
+	vtkUnsignedCharArray*							_colors;
+};	// class VTKMgx3DBatchedWireActor
+
+
+}	// namespace QtVtkComponents
+
+}	// namespace Mgx3D
+
+
+#endif	// VTK_MGX3D_BATCHED_WIRE_ACTOR_H
@@ -74,6 +74,13 @@ class VTKMgx3DGeomEntityRepresentation :
 	 */
 	virtual void createWireRepresentation ( );
 
+	/**
+	 * \return	<I>true</I> : la représentation filaire peut être regroupée
+	 *			avec celles des autres entités de même type.
+	 * \see		createBatchedWireRepresentation
+	 */
+	virtual bool isWireRepresentationBatchable ( ) const;
+
 	/**
 	 * Créé la représentation filaire complémentaire "ISO" de l'entité
 	 * représentée.
@@ -21,6 +21,8 @@ namespace Mgx3D
 namespace QtVtkComponents
 {
 
+class VTKMgx3DBatchedWireActor;
+
 /**
  * Classe de picker <I>VTK</I> spécialisé pour le logiciel <I>Magix 3D</I>.
  *
@@ -61,6 +63,13 @@ class VTKMgx3DPicker : public VTKECMPicker
 	 * \see			GetPickedEntities
 	 */
 	virtual void CompletePicking ( );
+
+	/**
+	 * \return		L'entité dont la représentation, regroupée dans l'acteur
+	 *				transmis en argument, est pointée, ou 0.
+	 * \see			CompletePicking
+	 */
+	virtual Mgx3D::Utils::Entity* PickBatchedEntity (VTKMgx3DBatchedWireActor& actor);
 	
 	/**
 	 * Constructeur par défaut. RAS.
@@ -10,6 +10,9 @@
 
 #include <Structured/StructuredMeshEntity.h>
 
+#include <vtkRectilinearGrid.h>
+#include <vtkThreshold.h>
+
 
 namespace Mgx3D 
 {
@@ -33,10 +36,13 @@ namespace QtVtkComponents
  * \warning	<B>Cette classe permet d'afficher des maillages structurés non issus de ||
  *		Magix3D. Ses mécanismes sont très différents de ceux des entités Magix 3D   ||
  *		types entités géométriques ou topologiques.</B>                             ||
- *		L'implémentation actuelle repose sur la classe vtkUnstructuredGrid.         ||
- *		Intérêt : on n'affiche que les mailles contenant un matériau. C'est d'autant||
- *		plus intéressant en cas de demande de transparence, opération très coûteuse ||
- *		en cas de rendu composite.                                                  ||
+ *		L'implémentation actuelle repose sur la classe vtkRectilinearGrid :         ||
+ *		seules les composantes des noeuds sur les 3 axes et les densités aux       ||
+ *		mailles sont transmises à VTK.                                              ||
+ *		Si le seuil d'affichage des données structurées est supérieur à la plus     ||
+ *		petite densité on n'affiche que les mailles qui l'atteignent, via un filtre ||
+ *		vtkThreshold. C'est d'autant plus intéressant en cas de demande de          ||
+ *		transparence, opération très coûteuse en cas de rendu composite.            ||
  * ===========================================================================================
  */
 class VTKMgx3DStructuredMeshEntityRepresentation : public QtVtkComponents::VTKMgx3DEntityRepresentation
@@ -90,6 +96,18 @@ class VTKMgx3DStructuredMeshEntityRepresentation : public QtVtkComponents::VTKMg
 	 */
 	virtual void createVolumicRepresentation (const Mgx3D::Structured::StructuredMesh& mesh);
 
+	/**
+	 * \return	<I>true</I> si la grille rectilinéaire est créée, <I>false</I>
+	 *			dans le cas contraire.
+	 */
+	virtual bool hasVolumicRepresentation ( ) const;
+
+	/**
+	 * Détruit les représentations graphiques actuelles, dont la grille
+	 * rectilinéaire et le filtre sur les densités.
+	 */
+	virtual void destroyRepresentations (bool realyDestroy);
+
 	/**
 	 * Créé la représentation surfacique de l'entité représentée.
 	 * \see createCloudRepresentation
@@ -131,6 +149,12 @@ class VTKMgx3DStructuredMeshEntityRepresentation : public QtVtkComponents::VTKMg
 	 */
 	VTKMgx3DStructuredMeshEntityRepresentation (VTKMgx3DStructuredMeshEntityRepresentation&);
 	VTKMgx3DStructuredMeshEntityRepresentation& operator = (const VTKMgx3DStructuredMeshEntityRepresentation&);
+
+	/** La grille représentée, dont les densités sont portées par les mailles. */
+	vtkRectilinearGrid*		_rectilinearGrid;
+
+	/** Le filtre sur les densités, nul en l'absence de seuil. */
+	vtkThreshold*			_densityFilter;
 };	// class VTKMgx3DStructuredMeshEntityRepresentation
 
 
@@ -135,6 +135,13 @@ class VTKMgx3DTopoEntityRepresentation :
 	 */
 	virtual void createWireRepresentation ( );
 
+	/**
+	 * \return	<I>true</I> : la représentation filaire peut être regroupée
+	 *			avec celles des autres entités de même type.
+	 * \see		createBatchedWireRepresentation
+	 */
+	virtual bool isWireRepresentationBatchable ( ) const;
+
     /**
      * Créé la représentation "nuage" de l'entité représentée avec projection sur la modélisation.
      * \see createCloudRepresentation
@@ -8,6 +8,7 @@
 
 
 #include "QtVtkComponents/vtkMgx3DInteractorStyle.h"
+#include "QtVtkComponents/VTKMgx3DBatchedWireActor.h"
 #include "QtVtkComponents/VTKMgx3DPicker.h"
 #include "QtVtkComponents/VTKMgx3DPickerCommand.h"
 #include "QtVtkComponents/VTKMgx3DSelectionManager.h"
@@ -32,6 +33,7 @@
 #include <vtkRenderWindow.h>
 #include <vtkScalarBarWidget.h>
 
+#include <map>
 #include <vector>
 
 
@@ -102,6 +104,29 @@ class VTKRenderingManager : public QtComponents::RenderingManager
 	 */
 	virtual void useGlobalDisplayProperties (bool global);
 
+	/**
+	 * \return		L'acteur regroupant les représentations filaires des
+	 *				entités du type et de l'épaisseur de trait transmis en
+	 *				argument. Cet acteur est créé et confié au <I>renderer</I>
+	 *				lors du premier appel.
+	 * \see			getBatchedWireActors
+	 * \see			Resources::_batchedWireRepresentations
+	 */
+	virtual VTKMgx3DBatchedWireActor& getBatchedWireActor (
+						Mgx3D::Utils::Entity::objectType type, double lineWidth);
+
+	/**
+	 * \return		Les acteurs regroupant des représentations filaires.
+	 * \see			getBatchedWireActor
+	 */
+	virtual std::vector<VTKMgx3DBatchedWireActor*> getBatchedWireActors ( ) const;
+
+	/**
+	 * \return		Le nombre d'objets graphiques (<I>props</I>) confiés au
+	 *				<I>renderer</I>.
+	 */
+	virtual size_t getViewPropsCount ( ) const;
+
 	//@}	// Les entités représentées.
 
 
@@ -1031,6 +1056,11 @@ class VTKRenderingManager : public QtComponents::RenderingManager
 
 	/** Les éventuelles tables de couleur affichées. */
 	std::vector<VTKColorTable*>						_colorTables;
+
+	/** Les acteurs regroupant les représentations filaires, par type
+	 * d'entité et épaisseur de trait. */
+	std::map<std::pair<Mgx3D::Utils::Entity::objectType, double>, VTKMgx3DBatchedWireActor*>
+													_batchedWireActors;
 };	// class VTKRenderingManager
 
 
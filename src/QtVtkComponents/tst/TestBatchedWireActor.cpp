@@ -0,0 +1,134 @@
+/**
+ * \file		TestBatchedWireActor.cpp
+ * \date		19/10/2026
+ *
+ * Vérifie le regroupement des représentations filaires dans un acteur
+ * VTKMgx3DBatchedWireActor : mailles du vtkPolyData, entités affichées ou
+ * masquées, correspondance maille -> entité et retrait d'entités.
+ */
+
+#include "QtVtkComponents/VTKMgx3DBatchedWireActor.h"
+#include "Utils/DisplayProperties.h"
+#include "Utils/Entity.h"
+#include "Utils/Property.h"
+
+#include <vtkMapper.h>
+#include <vtkPolyData.h>
+
+#include <iostream>
+#include <vector>
+
+
+using namespace std;
+using namespace Mgx3D::Utils;
+using namespace Mgx3D::Utils::Math;
+using namespace Mgx3D::QtVtkComponents;
+
+
+/** Entité minimale, seule son adresse est utilisée par l'acteur. */
+class TestEntity : public Entity
+{
+	public :
+
+	TestEntity (unsigned long id)
+		: Entity (id, new Property ("test"), new DisplayProperties ( ), 0)
+	{ }
+	virtual ~TestEntity ( )
+	{ }
+};	// class TestEntity
+
+
+static int	errors	= 0;
+
+#define CHECK(condition)                                                      \
+if (false == (condition))                                                     \
+{                                                                             \
+	cerr << __FILE__ << ':' << __LINE__ << " : " << #condition << endl;       \
+	errors++;                                                                 \
+}
+
+
+static vtkIdType linesNum (VTKMgx3DBatchedWireActor& actor)
+{
+	actor.UpdateBatch ( );
+	vtkPolyData*	polyData	= vtkPolyData::SafeDownCast (actor.GetMapper ( )->GetInput ( ));
+	return 0 == polyData ? -1 : polyData->GetNumberOfLines ( );
+}	// linesNum
+
+
+int main (int, char*[])
+{
+	VTKMgx3DBatchedWireActor*	actor	= VTKMgx3DBatchedWireActor::New ( );
+	TestEntity					e1 (1), e2 (2), e3 (3);
+
+	// e1 : 1 segment, e2 : 2 segments, e3 : 3 segments
+	vector<Point>	points;
+	for (int i = 0; i < 4; i++)
+		points.push_back (Point (i, 0., 0.));
+	const size_t	segs []	= { 0, 1, 1, 2, 2, 3 };
+	actor->AddEntity (e1, vector<Point> (points.begin ( ), points.begin ( ) + 2), vector<size_t> (segs, segs + 2), TkUtil::Color (255, 0, 0));
+	actor->AddEntity (e2, vector<Point> (points.begin ( ), points.begin ( ) + 3), vector<size_t> (segs, segs + 4), TkUtil::Color (0, 255, 0));
+	actor->AddEntity (e3, points, vector<size_t> (segs, segs + 6), TkUtil::Color (0, 0, 255));
+	CHECK (3 == actor->GetEntitiesCount ( ))
+	CHECK (3 == actor->GetVisibleEntitiesCount ( ))
+	CHECK (6 == linesNum (*actor))
+	CHECK (0 != actor->GetVisibility ( ))
+	bool	added	= false;
+	try
+	{
+		actor->AddEntity (e1, points, vector<size_t> (segs, segs + 2), TkUtil::Color (255, 0, 0));
+		added	= true;
+	}
+	catch (...)
+	{
+	}
+	CHECK (false == added)
+
+	// Maille -> entité, seulement pour les entités sélectionnables
+	CHECK (0 == actor->GetEntity (0))
+	actor->SetEntityPickable (e1, true);
+	actor->SetEntityPickable (e2, true);
+	actor->SetEntityPickable (e3, true);
+	CHECK (&e1 == actor->GetEntity (0))
+	CHECK (&e2 == actor->GetEntity (1))
+	CHECK (&e2 == actor->GetEntity (2))
+	CHECK (&e3 == actor->GetEntity (5))
+	CHECK (0 == actor->GetEntity (6))
+
+	// Masquage : les mailles de e2 disparaissent, les entités restent
+	// représentées
+	actor->SetEntityVisibility (e2, false);
+	CHECK (false == actor->GetEntityVisibility (e2))
+	CHECK (true == actor->GetEntityVisibility (e1))
+	CHECK (3 == actor->GetEntitiesCount ( ))
+	CHECK (2 == actor->GetVisibleEntitiesCount ( ))
+	CHECK (4 == linesNum (*actor))
+	CHECK (&e1 == actor->GetEntity (0))
+	CHECK (&e3 == actor->GetEntity (1))
+	CHECK (&e3 == actor->GetEntity (3))
+
+	// Retrait
+	actor->RemoveEntity (e1);
+	CHECK (false == actor->HasEntity (e1))
+	CHECK (2 == actor->GetEntitiesCount ( ))
+	CHECK (1 == actor->GetVisibleEntitiesCount ( ))
+	CHECK (3 == linesNum (*actor))
+	CHECK (&e3 == actor->GetEntity (0))
+
+	// Plus rien d'affiché : l'acteur est masqué
+	actor->SetEntityVisibility (e3, false);
+	CHECK (0 == actor->GetVisibleEntitiesCount ( ))
+	CHECK (0 == actor->GetVisibility ( ))
+	actor->SetEntityVisibility (e2, true);
+	CHECK (0 != actor->GetVisibility ( ))
+	CHECK (2 == linesNum (*actor))
+
+	actor->RemoveEntity (e2);
+	actor->RemoveEntity (e3);
+	CHECK (0 == actor->GetEntitiesCount ( ))
+	actor->Delete ( );
+
+	if (0 != errors)
+		cerr << errors << " erreur(s)." << endl;
+	return 0 == errors ? 0 : 1;
+}	// main
@@ -6,6 +6,7 @@
 #include "QtComponents/QtMgx3DApplication.h"
 #include "QtComponents/QtMgx3DMainWindow.h"
 #include "QtVtkComponents/VTKMgx3DActor.h"
+#include "QtVtkComponents/VTKMgx3DBatchedWireActor.h"
 #include "VtkComponents/vtkECMAreaPicker.h"
 
 #include <TkUtil/InformationLog.h>
@@ -21,6 +22,7 @@
 #include <vtkRenderWindow.h>
 #include <vtkAbstractPropPicker.h>
 #include <vtkAssemblyPath.h>
+#include <vtkIdTypeArray.h>
 #include <vtkInformation.h>
 #include <vtkProp3DCollection.h>
 #include <vtkSelection.h>
@@ -564,10 +566,17 @@ void vtkMgx3DInteractorStyle::OnLeftButtonUp ( )
 					VTKMgx3DActor*	a	= dynamic_cast<VTKMgx3DActor*>(p);
 					if (0 != a)
 						entities.insert (a->GetEntity ( ));
+					VTKMgx3DBatchedWireActor*	batched	= dynamic_cast<VTKMgx3DBatchedWireActor*>(p);
+					if ((0 != batched) && (0 != areaPicker->GetFrustum ( )))
+					{	// Représentations filaires regroupées : recherche des entités concernées
+						const vector<Entity*>	inside	= batched->GetEntitiesInFrustum (*areaPicker->GetFrustum ( ), areaPicker->GetSelectCompletelyInside ( ));
+						entities.insert (inside.begin ( ), inside.end ( ));
+					}	// if ((0 != batched) && (0 != areaPicker->GetFrustum ( )))
 				}	// while (0 != (p = pickedProps->GetNextProp3D (csi)))
 
 				if (false == isControlKeyPressed ( ))
 				{
+					Mgx3D::Internal::SelectionManager::NotificationLocker	notificationLocker (*SelectionManager);
 					SelectionManager->clearSelection ( );
 					vector<Entity*>	selection;
 					for (set<Entity*>::const_iterator ite = entities.begin ( ); entities.end ( ) != ite; ite++)
@@ -610,10 +619,22 @@ void vtkMgx3DInteractorStyle::OnLeftButtonUp ( )
 						if (capturedEntities.end ( ) == find (capturedEntities.begin ( ), capturedEntities.end ( ), entity))
 							capturedEntities.push_back (entity);	// Ne recenser qu'un seul exemplaire. On peut avoir des représentations pleines + filaires ...
 					}	// if (0 != mgxActor)
+					VTKMgx3DBatchedWireActor*	batched	= dynamic_cast<VTKMgx3DBatchedWireActor*>(selector.GetPropFromID (propId));
+					vtkIdTypeArray*				cellIds	= 0 == batched ? 0 : vtkIdTypeArray::SafeDownCast (node->GetSelectionList ( ));
+					if (0 != cellIds)
+					{	// Représentations filaires regroupées : une entité par maille sélectionnée
+						for (vtkIdType c = 0; c < cellIds->GetNumberOfTuples ( ); c++)
+						{
+							Entity*	entity	= batched->GetEntity (cellIds->GetValue (c));
+							if ((0 != entity) && (capturedEntities.end ( ) == find (capturedEntities.begin ( ), capturedEntities.end ( ), entity)))
+								capturedEntities.push_back (entity);
+						}	// for (vtkIdType c = 0; c < cellIds->GetNumberOfTuples ( ); c++)
+					}	// if (0 != cellIds)
 				}	// for (unsigned int n = 0; n < selection->GetNumberOfNodes ( ); n++)
 
 				if (false == isControlKeyPressed ( ))
 				{
+					Mgx3D::Internal::SelectionManager::NotificationLocker	notificationLocker (*SelectionManager);
 					SelectionManager->clearSelection ( );
 					SelectionManager->addToSelection (capturedEntities);
 				}
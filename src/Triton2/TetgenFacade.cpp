@@ -6,9 +6,25 @@
 /*----------------------------------------------------------------------------*/
 #include "Triton2/TetgenInterface/TetgenFacade.h"
 /*----------------------------------------------------------------------------*/
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+/*----------------------------------------------------------------------------*/
 using namespace triton;
 using namespace gmds;
 /*----------------------------------------------------------------------------*/
+/* tetrahedralize is not reentrant: exactinit stores the robust predicates
+ * settings, including the static filters computed from the bounding box of
+ * the input, in global variables. Two facades, possibly owned by different
+ * commands, must then never run it at the same time. */
+static std::mutex tetrahedralize_mutex;
+static void serializedTetrahedralize(tetgenbehavior& ABehav, tetgenio& AIn,
+                                     tetgenio& AOut)
+{
+    std::lock_guard<std::mutex> lock(tetrahedralize_mutex);
+    tetrahedralize(&ABehav, &AIn, &AOut);
+}
+/*----------------------------------------------------------------------------*/
 TetgenFacade::TetgenFacade(){
 
 }
@@ -27,7 +43,7 @@ void TetgenFacade::generateCDTMesh(gmds::Mesh& ABoundaryMesh,
     char * param = const_cast<char*>("pq1.2a0.1");
     tetgenbehavior behav;
     behav.parse_commandline(param);
-    tetrahedralize(&behav, &tetgenInput_, &tetgenOutput_);
+    serializedTetrahedralize(behav, tetgenInput_, tetgenOutput_);
 	buildGMDSOutput(AVolMesh);
 }
 /*----------------------------------------------------------------------------*/
@@ -45,7 +61,7 @@ void TetgenFacade::generateTetMesh(gmds::Mesh& ABoundaryMesh,
     char * param = const_cast<char*>("pq1.414a0.1");
     tetgenbehavior behav;
     behav.parse_commandline(param);
-    tetrahedralize(&behav, &tetgenInput_, &tetgenOutput_);
+    serializedTetrahedralize(behav, tetgenInput_, tetgenOutput_);
 	buildGMDSOutput(AVolMesh);
 }
 /*----------------------------------------------------------------------------*/
@@ -63,7 +79,7 @@ void TetgenFacade::generateTetMeshDistTet(gmds::Mesh& ABoundaryMesh,
     char * param = const_cast<char*>("pq1.414a0.01");
     tetgenbehavior behav;
     behav.parse_commandline(param);
-    tetrahedralize(&behav, &tetgenInput_, &tetgenOutput_);
+    serializedTetrahedralize(behav, tetgenInput_, tetgenOutput_);
 
 	buildGMDSOutput(AVolMesh);
 }
@@ -80,7 +96,7 @@ void TetgenFacade::generateTetMesh(std::vector<gmds::Node>& ANodes,
     char * param = const_cast<char*>("Yq1.2pa0.1");
     tetgenbehavior behav;
     behav.parse_commandline(param);
-    tetrahedralize(&behav, &tetgenInput_, &tetgenOutput_);
+    serializedTetrahedralize(behav, tetgenInput_, tetgenOutput_);
 
 	fillGMDSOutput(AMesh, ANodes);
 }
@@ -94,17 +110,22 @@ void TetgenFacade::generateTetMesh(
 		const std::string&  AParam )
 {
 	buildTetgenInput(ANodes,AFacets);
-    
-	char * param = const_cast<char*>(AParam.c_str());
-    tetgenbehavior behav;
-    behav.parse_commandline(param);
-    tetrahedralize(&behav, &tetgenInput_, &tetgenOutput_);
+
+	runTetgen(AParam);
 
 	ACreatedNodes.clear();
 	ACreatedRegions.clear();
 	fillGMDSOutput(AMesh, ANodes, ACreatedNodes, ACreatedRegions);
 }
 /*----------------------------------------------------------------------------*/
+void TetgenFacade::runTetgen(const std::string& AParam)
+{
+	char * param = const_cast<char*>(AParam.c_str());
+    tetgenbehavior behav;
+    behav.parse_commandline(param);
+    serializedTetrahedralize(behav, tetgenInput_, tetgenOutput_);
+}
+/*----------------------------------------------------------------------------*/
 void TetgenFacade::buildTetgenInput(
 		std::vector<gmds::Node>& ANodes,
 		std::vector< std::vector<gmds::Face> >& AFacets)
@@ -119,56 +140,66 @@ void TetgenFacade::buildTetgenInput(
 	// no marker list associated to the points
 	tetgenInput_.pointmarkerlist = NULL;
 	/* now we fill in the XYZ tetgen tabular with the node coordinates coming from
-	 * the GMDS structure */
-	int index = 1;
-	std::map<gmds::TCellID,int> gmds2tetgen_nodes;
-	for(int i=0;i<ANodes.size();i++){
-		Node n = ANodes[i];
-		tetgenInput_.pointlist[(index - 1) * 3 + 0] = n.X();
-		tetgenInput_.pointlist[(index - 1) * 3 + 1] = n.Y();
-		tetgenInput_.pointlist[(index - 1) * 3 + 2] = n.Z();
-		/* we keep in mind the association from the GMDS node to the corresponding node
-		 * index in tetgen. */
-		gmds2tetgen_nodes.insert(std::pair<TCellID,int>(n.id(),index));
-		index++;
+	 * the GMDS structure. The tetgen index of a node is its position in ANodes
+	 * (plus 1), and the association from the GMDS ids is kept in a vector
+	 * indexed by these ids. */
+	TCellID max_id = 0;
+	for(unsigned int i=0;i<ANodes.size();i++)
+		max_id = std::max(max_id, ANodes[i].id());
+	std::vector<int> gmds2tetgen_nodes(ANodes.empty()?0:max_id+1, 0);
+	for(unsigned int i=0;i<ANodes.size();i++){
+		math::Point p = ANodes[i].point();
+		tetgenInput_.pointlist[i * 3 + 0] = p.X();
+		tetgenInput_.pointlist[i * 3 + 1] = p.Y();
+		tetgenInput_.pointlist[i * 3 + 2] = p.Z();
+		gmds2tetgen_nodes[ANodes[i].id()] = i+1;
 	}
 	//==============================================================================
-	std::vector<gmds::Face> allFaces;
+	/* a planar surface gives a single facet made of all its faces, otherwise
+	 * each face is a facet on its own (the polygons of a facet must be coplanar) */
+	std::vector<bool> planar(AFacets.size(), false);
+	int nb_facets = 0;
 	for(unsigned int surface_index=0;surface_index<AFacets.size(); surface_index++){
-		std::vector<gmds::Face> local_faces = AFacets[surface_index];
-		allFaces.insert(allFaces.end(),local_faces.begin(),local_faces.end());
-
-
+		if(AFacets[surface_index].empty())
+			continue;
+		planar[surface_index] = isPlanar(AFacets[surface_index]);
+		nb_facets += (planar[surface_index]?1:AFacets[surface_index].size());
 	}
 
-	tetgenInput_.numberoffacets = allFaces.size();
+	tetgenInput_.numberoffacets = nb_facets;
 	tetgenInput_.facetlist = new tetgenio::facet[tetgenInput_.numberoffacets];
 	// the marker list will be fill with the number index of the used surface.
 	tetgenInput_.facetmarkerlist = new int[tetgenInput_.numberoffacets];
-	/* now we traverse each single surface and not the global mesh to get the faces
-	 * composing it	 */
-	for(unsigned int index=0;index<allFaces.size(); index++){
-		// we are going to fill the tetgen facet corresponding to the GMDS surface
-		tetgenio::facet *f = &tetgenInput_.facetlist[index];
-		tetgenio::init(f);
-		f->numberofholes = 0;
-		f->numberofpolygons = 1;
-		f->polygonlist = new tetgenio::polygon[f->numberofpolygons];
-
-		tetgenInput_.facetmarkerlist[index] = index;
 
+	int facet_index = 0;
+	std::vector<TCellID> node_ids;
+	for(unsigned int surface_index=0;surface_index<AFacets.size(); surface_index++){
+		const std::vector<gmds::Face>& faces = AFacets[surface_index];
+		for(unsigned int face_index=0;face_index<faces.size(); face_index++){
+			tetgenio::facet *f = &tetgenInput_.facetlist[facet_index];
+			// a new facet for the first face of a planar surface, or for each face
+			if(!planar[surface_index] || face_index==0){
+				tetgenio::init(f);
+				f->numberofholes = 0;
+				f->numberofpolygons = (planar[surface_index]?faces.size():1);
+				f->polygonlist = new tetgenio::polygon[f->numberofpolygons];
+				tetgenInput_.facetmarkerlist[facet_index] = surface_index;
+			}
 
-		Face f_GMDS = allFaces[index];
-		std::vector<TCellID> node_ids;
-		f_GMDS.getIDs<Node>(node_ids);
+			Face f_GMDS = faces[face_index];
+			node_ids.clear();
+			f_GMDS.getIDs<Node>(node_ids);
 
-		tetgenio::polygon *p = &f->polygonlist[0];
-		tetgenio::init(p);
-		p->numberofvertices = 3;
-		p->vertexlist = new int[p->numberofvertices];
-		for(int node_i =0; node_i<node_ids.size();node_i++)
-			p->vertexlist[node_i] = gmds2tetgen_nodes[node_ids[node_i] ];
+			tetgenio::polygon *p = &f->polygonlist[planar[surface_index]?face_index:0];
+			tetgenio::init(p);
+			p->numberofvertices = node_ids.size();
+			p->vertexlist = new int[p->numberofvertices];
+			for(unsigned int node_i =0; node_i<node_ids.size();node_i++)
+				p->vertexlist[node_i] = gmds2tetgen_nodes[node_ids[node_i] ];
 
+			if(!planar[surface_index] || face_index+1==faces.size())
+				facet_index++;
+		}
 	}
 
 	// ANCIENNE VERSION
@@ -208,6 +239,48 @@ void TetgenFacade::buildTetgenInput(
 //	}
 }
 /*----------------------------------------------------------------------------*/
+bool TetgenFacade::isPlanar(const std::vector<gmds::Face>& AFaces) const
+{
+	// normal of the first face (Newell's method)
+	std::vector<Node> nodes = AFaces[0].getAll<Node>();
+	double nx = 0, ny = 0, nz = 0;
+	for(unsigned int i=0;i<nodes.size();i++){
+		math::Point p1 = nodes[i].point();
+		math::Point p2 = nodes[(i+1)%nodes.size()].point();
+		nx += (p1.Y()-p2.Y())*(p1.Z()+p2.Z());
+		ny += (p1.Z()-p2.Z())*(p1.X()+p2.X());
+		nz += (p1.X()-p2.X())*(p1.Y()+p2.Y());
+	}
+	double norm = std::sqrt(nx*nx+ny*ny+nz*nz);
+	if(norm==0.0)
+		return false;
+	nx/=norm; ny/=norm; nz/=norm;
+
+	// distance of all the nodes to this plane, compared to the surface size
+	math::Point p0 = nodes[0].point();
+	double min[3] = {p0.X(),p0.Y(),p0.Z()};
+	double max[3] = {p0.X(),p0.Y(),p0.Z()};
+	double max_dist = 0.0;
+	for(unsigned int i=0;i<AFaces.size();i++){
+		nodes = AFaces[i].getAll<Node>();
+		for(unsigned int j=0;j<nodes.size();j++){
+			math::Point p = nodes[j].point();
+			double xyz[3] = {p.X(),p.Y(),p.Z()};
+			max_dist = std::max(max_dist, std::fabs(nx*(xyz[0]-p0.X())
+					+ny*(xyz[1]-p0.Y())+nz*(xyz[2]-p0.Z())));
+			for(int k=0;k<3;k++){
+				min[k] = std::min(min[k], xyz[k]);
+				max[k] = std::max(max[k], xyz[k]);
+			}
+		}
+	}
+	double size = std::sqrt((max[0]-min[0])*(max[0]-min[0])
+			+(max[1]-min[1])*(max[1]-min[1])
+			+(max[2]-min[2])*(max[2]-min[2]));
+
+	return max_dist <= 1e-10*size;
+}
+/*----------------------------------------------------------------------------*/
 void TetgenFacade::buildTetgenInput(gmds::Mesh& AMesh)
 {
 	tetgenInput_.mesh_dim = 3;
@@ -332,74 +405,9 @@ void TetgenFacade::buildGMDSOutput(gmds::Mesh& AMesh)
 void TetgenFacade::fillGMDSOutput(gmds::Mesh& AMesh,
 		 std::vector<gmds::Node>& ANodes)
 {
-	std::vector<Node> tetgen2GMDSNode;
-	tetgen2GMDSNode.reserve(tetgenOutput_.numberofpoints);
-	Node n;
-	for(int i = 0; i < tetgenOutput_.numberofpoints; i++){
-		/* First, we try to find if a node is already located in this
-		 * location. It is so a very unstable (unpredicatable) function
-		 * depending on the mesh precision
-		 */
-		math::Point p_netgen(tetgenOutput_.pointlist[i * 3 + 0],
-					tetgenOutput_.pointlist[i * 3 + 1],
-					tetgenOutput_.pointlist[i * 3 + 2]);
-		bool found=false;
-		TCellID found_id;
-		unsigned int k=0;
-		for(;k<ANodes.size() && !found;k++){
-			math::Point p_init = ANodes[k].point();
-			if(p_init==p_netgen){
-				found =true;
-				found_id=ANodes[k].id();
-			}
-		}
-
-		if(!found){
-			//new node. we add it
-			n= AMesh.newNode(tetgenOutput_.pointlist[i * 3 + 0],
-					tetgenOutput_.pointlist[i * 3 + 1],
-					tetgenOutput_.pointlist[i * 3 + 2]);
-			tetgen2GMDSNode.push_back(n);
-		}
-		else{
-			//existing node
-
-			n = AMesh.get<Node>(found_id);
-			tetgen2GMDSNode.push_back(n);
-		}
-	}
-//	std::cout<<"Result"<<"\n";
-//	std::cout<<"\t number of points: "<<tetgenOutput_.numberofpoints<<"\n";
-//	std::cout<<"\t number of edges : "<<tetgenOutput_.numberofedges<<"\n";
-//	std::cout<<"\t number of faces : "<<tetgenOutput_.numberoftrifaces<<"\n";
-//	std::cout<<"\t number of tet   : "<<tetgenOutput_.numberoftetrahedra<<"\n";
-
-	for(int i = 0; i < tetgenOutput_.numberoftetrahedra; i++){
-		AMesh.newTet(tetgen2GMDSNode[tetgenOutput_.tetrahedronlist[i * 4 + 0] -1],
-					 tetgen2GMDSNode[tetgenOutput_.tetrahedronlist[i * 4 + 1] -1],
-					 tetgen2GMDSNode[tetgenOutput_.tetrahedronlist[i * 4 + 2] -1],
-					 tetgen2GMDSNode[tetgenOutput_.tetrahedronlist[i * 4 + 3] -1]);
-	}
-
-//	std::set<std::string> used_tag;
-//
-//	if(MeshDescriptor<M>::hasFaces){
-//		for(int i = 0; i < tetgenOutput_.numberoftrifaces; i++){
-//			Face f = AMesh.newTriangle(
-//						 tetgen2GMDSNode[tetgenOutput_.trifacelist[i * 3 + 0] -1],
-//						 tetgen2GMDSNode[tetgenOutput_.trifacelist[i * 3 + 1] -1],
-//						 tetgen2GMDSNode[tetgenOutput_.trifacelist[i * 3 + 2] -1]);
-//			std::stringstream ost;
-//			ost<<tetgenOutput_.trifacemarkerlist[i];
-//
-//			if(used_tag.find(ost.str())==used_tag.end()){
-//				used_tag.insert(ost.str());
-//				AMesh.newSurface(ost.str());
-//			}
-//
-//			AMesh.getSurface(ost.str()).add(f);
-	//		}
-	//	}
+	std::vector<Node> created_nodes;
+	std::vector<Region> created_regions;
+	fillGMDSOutput(AMesh, ANodes, created_nodes, created_regions);
 }
 /*----------------------------------------------------------------------------*/
 void TetgenFacade::fillGMDSOutput(gmds::Mesh& AMesh,
@@ -407,42 +415,21 @@ void TetgenFacade::fillGMDSOutput(gmds::Mesh& AMesh,
 		std::vector<Node>& ACreatedNodes,
 		std::vector<Region>& ACreatedRegions)
 {
+	/* tetgen keeps the input points, in the same order, at the beginning of
+	 * its output point list. The next ones are the Steiner points. */
+	if(tetgenOutput_.numberofpoints < (int)ANodes.size())
+		throw gmds::GMDSException("Tetgen output misses some input points");
+
 	std::vector<Node> tetgen2GMDSNode;
 	tetgen2GMDSNode.reserve(tetgenOutput_.numberofpoints);
-	Node n;
-	for(int i = 0; i < tetgenOutput_.numberofpoints; i++){
-		/* First, we try to find if a node is already located in this
-		 * location. It is so a very unstable (unpredicatable) function
-		 * depending on the mesh precision
-		 */
-		math::Point p_netgen(tetgenOutput_.pointlist[i * 3 + 0],
-					tetgenOutput_.pointlist[i * 3 + 1],
-					tetgenOutput_.pointlist[i * 3 + 2]);
-		bool found=false;
-		TCellID found_id;
-		unsigned int k=0;
-		for(;k<ANodes.size() && !found;k++){
-			math::Point p_init = ANodes[k].point();
-			if(p_init==p_netgen){
-				found =true;
-				found_id=ANodes[k].id();
-			}
-		}
-
-		if(!found){
-			//new node. we add it
-			n= AMesh.newNode(tetgenOutput_.pointlist[i * 3 + 0],
-					tetgenOutput_.pointlist[i * 3 + 1],
-					tetgenOutput_.pointlist[i * 3 + 2]);
-			tetgen2GMDSNode.push_back(n);
-			ACreatedNodes.push_back(n);
-		}
-		else{
-			//existing node
-
-			n = AMesh.get<Node>(found_id);
-			tetgen2GMDSNode.push_back(n);
-		}
+	tetgen2GMDSNode.insert(tetgen2GMDSNode.end(), ANodes.begin(), ANodes.end());
+	ACreatedNodes.reserve(ACreatedNodes.size()+tetgenOutput_.numberofpoints-ANodes.size());
+	for(int i = ANodes.size(); i < tetgenOutput_.numberofpoints; i++){
+		Node n= AMesh.newNode(tetgenOutput_.pointlist[i * 3 + 0],
+				tetgenOutput_.pointlist[i * 3 + 1],
+				tetgenOutput_.pointlist[i * 3 + 2]);
+		tetgen2GMDSNode.push_back(n);
+		ACreatedNodes.push_back(n);
 	}
 
 //	std::cout<<"Result"<<"\n";
@@ -451,6 +438,7 @@ void TetgenFacade::fillGMDSOutput(gmds::Mesh& AMesh,
 //	std::cout<<"\t number of faces : "<<tetgenOutput_.numberoftrifaces<<"\n";
 //	std::cout<<"\t number of tet   : "<<tetgenOutput_.numberoftetrahedra<<"\n";
 
+	ACreatedRegions.reserve(ACreatedRegions.size()+tetgenOutput_.numberoftetrahedra);
 	for(int i = 0; i < tetgenOutput_.numberoftetrahedra; i++){
 		Region r =
 				AMesh.newTet(tetgen2GMDSNode[tetgenOutput_.tetrahedronlist[i * 4 + 0] -1],
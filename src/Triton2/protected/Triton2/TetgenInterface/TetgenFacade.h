@@ -17,6 +17,8 @@
 /*----------------------------------------------------------------------------*/
 #include <sstream>
 #include <map>
+#include <string>
+#include <vector>
 /*----------------------------------------------------------------------------*/
 namespace triton{
 /*----------------------------------------------------------------------------*/
@@ -95,8 +97,44 @@ public:
 						 const std::string&  AParam = "Yq1.2pa0.1");
 
 
+	/*------------------------------------------------------------------------*/
+    /** \brief  Initializes the tetgen input from boundary nodes and faces.
+     * 			Nodes are numbered densely following their order in ANodes.
+     * 			Each planar surface of AFacets gives a single facet made of
+     * 			several polygons, a non planar one gives a facet per face.
+     *
+     *	\param ANodes  the boundary nodes, each one only once
+     *	\param AFacets the boundary faces, grouped by surface
+     */
 	void buildTetgenInput(std::vector<gmds::Node>& ANodes,
 			std::vector< std::vector<gmds::Face> >& AFacets);
+
+	/*------------------------------------------------------------------------*/
+    /** \brief  Tetrahedralizes the input built by buildTetgenInput. No GMDS
+     * 			mesh is accessed. Tetgen is not reentrant (the robust
+     * 			predicates settings are global and reset from the input
+     * 			bounding box by each run): the runs of all the facades are
+     * 			serialized, a call waits for the one in progress in another
+     * 			thread.
+     *
+     *	\param AParam the tetgen command line switches
+     */
+	void runTetgen(const std::string& AParam);
+
+	/*------------------------------------------------------------------------*/
+    /** \brief  Adds the tetgen output to AMesh. The first output points are
+     * 			the input ones (ANodes), only the next ones are created.
+     *
+     *	\param AMesh           the mesh to fill in
+     *	\param ANodes          the nodes given to buildTetgenInput
+     *	\param ACreatedNodes   the created nodes
+     *	\param ACreatedRegions the created tetrahedra
+     */
+	void fillGMDSOutput(gmds::Mesh& AMesh,
+			std::vector<gmds::Node>& ANodes,
+			std::vector<gmds::Node>& ACreatedNodes,
+			 std::vector<gmds::Region>& ACreatedRegions);
+
 private:
 
 	/*------------------------------------------------------------------------*/
@@ -115,10 +153,12 @@ private:
 	void buildGMDSOutput(gmds::Mesh& AMesh);
 	void fillGMDSOutput(gmds::Mesh& AMesh, std::vector<gmds::Node>& ANodes);
 
-	void fillGMDSOutput(gmds::Mesh& AMesh,
-			std::vector<gmds::Node>& ANodes,
-			std::vector<gmds::Node>& ACreatedNodes,
-			 std::vector<gmds::Region>& ACreatedRegions);
+	/*------------------------------------------------------------------------*/
+    /** \brief  Checks that all the nodes of a surface lie in the same plane
+     *
+     *	\param AFaces the faces of the surface
+     */
+	bool isPlanar(const std::vector<gmds::Face>& AFaces) const;
 
 private:
 	tetgenio tetgenInput_;
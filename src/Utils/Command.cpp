@@ -10,11 +10,15 @@
 #include <TkUtil/ErrorLog.h>
 #include <TkUtil/InformationLog.h>
 #include <TkUtil/InternalError.h>
+#include <TkUtil/MemoryError.h>
 #include <TkUtil/NetworkData.h>
 #include <TkUtil/TraceLog.h>
 #include <TkUtil/UTF8String.h>
 /*----------------------------------------------------------------------------*/
 #include <time.h>
+
+#include <chrono>
+#include <mutex>
 /*----------------------------------------------------------------------------*/
 using namespace Mgx3D::Utils::Math;
 using namespace TkUtil;
@@ -73,21 +77,14 @@ Command& Command::operator = (const Command& c)
 
 Command::~Command ( )
 {
-	UTF8String	message1 (Charset::UTF_8), message2 (Charset::UTF_8);
-	message1 << "Destruction de la commande " << getName( ) << " de nom unique " << getUniqueName ( );
-	message2	= message1;
-	message1 << " en cours.";
-	MGX_TRACE_LOG_3 (trace1, message1)
-	log (trace1);
+	MGX_TRACE (getLogStream ( ), Log::TRACE_3, "Destruction de la commande " << getName( ) << " de nom unique " << getUniqueName ( ) << " en cours.");
 
 	notifyObserversForDestruction ( );
 	unregisterReferences ( );
 	delete _commandMutex;
 	_commandMutex	= 0;
 
-	message2 << " effectué.";
-	MGX_TRACE_LOG_3 (trace2, message2)
-	log (trace2);
+	MGX_TRACE (getLogStream ( ), Log::TRACE_3, "Destruction de la commande " << getName( ) << " de nom unique " << getUniqueName ( ) << " effectué.");
 }	// Command::~Command
 
 
@@ -363,9 +360,7 @@ void Command::setStatus (Command::status status)
 {
 	AutoMutex	automutex (getCommandMutex ( ));
 
-	UTF8String	message (Charset::UTF_8);
-	message << "Changement de status de la commande " << getName ( ) << " de nom unique " << getUniqueName ( ) << " : " << statusToString (getStatus ( )) << " -> ";
-
+	const Command::status	oldStatus	= _status;
 	bool changeStatus = (_status != status);
 	_status	= status;
 	switch (_status)
@@ -383,6 +378,7 @@ void Command::setStatus (Command::status status)
 		case Command::FAIL			:
 			_isCompleted	= true;
 			getTimer ( ).stop ( );
+			_completion.notify_all ( );
 	}	// switch (_status)
 
 	// On prévient les observateurs avant l'appel à log () qui peut lever une exception ...
@@ -392,12 +388,39 @@ void Command::setStatus (Command::status status)
         notifyObserversForModification (COMMAND_STATE);
 	}
 
-	message << statusToString (status) << ", chronomètre = " << MgxNumeric::userRepresentation (getTimer ( )) << ".";
-    MGX_TRACE_LOG_1 (trace1, message)
-	log (trace1);
+	MGX_TRACE (getLogStream ( ), Log::TRACE_1, "Changement de status de la commande " << getName ( ) << " de nom unique " << getUniqueName ( ) << " : " << statusToString (oldStatus) << " -> "
+	           << statusToString (status) << ", chronomètre = " << MgxNumeric::userRepresentation (getTimer ( )) << ".");
 }	// Command::setStatus
 
 
+bool Command::isIndependent (const Command& command) const
+{
+	if (&command == this)
+		return false;
+
+	const unsigned long	written	= getWrittenResources ( );
+	const unsigned long	otherWritten	= command.getWrittenResources ( );
+
+	return (0 == (written & (command.getReadResources ( ) | otherWritten))) &&
+	       (0 == (otherWritten & getReadResources ( )));
+}	// Command::isIndependent
+
+
+bool Command::waitFor (unsigned long milliseconds)
+{
+	CHECK_NULL_PTR_ERROR (getCommandMutex ( ))
+	unique_lock<Mutex>	lock (*getCommandMutex ( ));
+	if (0 == milliseconds)
+	{
+		_completion.wait (lock, [this] { return _isCompleted; });
+		return true;
+	}	// if (0 == milliseconds)
+
+	return _completion.wait_for (lock, chrono::milliseconds (milliseconds),
+	                             [this] { return _isCompleted; });
+}	// Command::waitFor
+
+
 void Command::setProgression (double progress)
 {
 	AutoMutex	automutex (getCommandMutex ( ));
@@ -412,11 +435,8 @@ void Command::setProgression (double progress)
 	}	// if ((0. > progress) || (1. < progress))
 
 	getTimer ( ).stop ( );	// Temps intermédiaire, chrono non arrêté.
-	UTF8String	message (Charset::UTF_8);
-	message << "Progression de la commande " << getName ( ) << " de nom unique " << getUniqueName ( ) << " : " << ios_base::fixed 
-	        << IN_UTIL setprecision (2) << progress << ", chronomètre = " << MgxNumeric::userRepresentation (getTimer ( )) << ".";
-	MGX_TRACE_LOG_1 (trace1, message)
-	log (trace1);
+	MGX_TRACE (getLogStream ( ), Log::TRACE_1, "Progression de la commande " << getName ( ) << " de nom unique " << getUniqueName ( ) << " : " << ios_base::fixed 
+	           << IN_UTIL setprecision (2) << progress << ", chronomètre = " << MgxNumeric::userRepresentation (getTimer ( )) << ".");
 
 	_progress	= progress;
 	notifyObserversForModification (COMMAND_PROGRESSION);
@@ -448,13 +468,10 @@ void Command::setPlayType (Command::PLAY_TYPE pt)
 {
 	AutoMutex	automutex (getCommandMutex ( ));
 
-	UTF8String	message (Charset::UTF_8);
-	message << "Changement de type de jeu de la commande " << getName ( ) << " de nom unique " << getUniqueName ( ) << " : "
-	        << playTypeToString (getPlayType ( )) << " -> " << playTypeToString (pt) << ".";
+	MGX_TRACE (getLogStream ( ), Log::TRACE_5, "Changement de type de jeu de la commande " << getName ( ) << " de nom unique " << getUniqueName ( ) << " : "
+	           << playTypeToString (getPlayType ( )) << " -> " << playTypeToString (pt) << ".");
 
 	_playType	= pt;
-    MGX_TRACE_LOG_5 (trace1, message)
-	log (trace1);
 }	// Command::setPlayType
 
 void Command::taskCompleted ( )
@@ -486,12 +503,7 @@ void Command::atCompletion ( )
 {
 	AutoMutex	autoMutex (&_mutex);
 
-	UTF8String	message1 (Charset::UTF_8), message2 (Charset::UTF_8);
-	message1 << "Commande " << getName ( ) << " de nom unique " << getUniqueName ( ) << " terminée. Exécution des fonctions de fin de tache ";
-	message2	= message1;
-	message1 << " en cours.";
-	MGX_TRACE_LOG_3 (trace1, message1)
-	log (trace1);
+	MGX_TRACE (getLogStream ( ), Log::TRACE_3, "Commande " << getName ( ) << " de nom unique " << getUniqueName ( ) << " terminée. Exécution des fonctions de fin de tache  en cours.");
 
 	for (map<CommandTask, void*>::iterator it = _completionTasks.begin ( ); _completionTasks.end ( ) != it; it++)
 	{
@@ -504,9 +516,7 @@ void Command::atCompletion ( )
 		COMPLETE_TRY_CATCH_BLOCK
 	}	// for (map<CommandTask, void*>::iterator it = ...
 
-	message2 << " effectuée.";
-	MGX_TRACE_LOG_3 (trace2, message2)
-	log (trace2);
+	MGX_TRACE (getLogStream ( ), Log::TRACE_3, "Commande " << getName ( ) << " de nom unique " << getUniqueName ( ) << " terminée. Exécution des fonctions de fin de tache  effectuée.");
 }	// Command::atCompletion
 
 
@@ -530,6 +540,9 @@ void Command::startingOrcompletionLog (bool beginning)
 {
 	AutoMutex	automutex (&_mutex);
 
+	if (false == MGX_TRACE_ENABLED (getLogStream ( ), Log::TRACE_1))
+		return;
+
 	UTF8String	message (Charset::UTF_8);
 	message << (true == beginning ? "Lancement" : "Terminaison") << " de la commande " << getName ( ) << " de nom unique " << getUniqueName ( ) << ".";
 	if (false == beginning)
@@ -18,9 +18,10 @@
 #include <TkUtil/LogOutputStream.h>
 #include <TkUtil/ThreadManager.h>
 
-#include <sched.h>		// sched_yield
 #include <errno.h>		// errno
 #include <algorithm>
+#include <chrono>
+#include <mutex>
 #include <string.h>
 using namespace Mgx3D::Utils::Math;
 using namespace TkUtil;
@@ -42,7 +43,8 @@ CommandManager::CommandManager (const string& name)
 	  _runners ( ), _runnersMutex (false),
 	  _commandObservers ( ), _logStream (0),
 	  _undoManager (new UndoRedoManager ("UndoRedoManager")),
-	  _commands ( ), _queuedCommands ( ),
+	  _commands ( ), _queuedCommands ( ), _undoOrder ( ),
+	  _dispatchRequested (false),
 	  _policy (runningPolicy),
 	  _queuingMutex (false), _sequentialMutex (false), _sequentialCommand (0),
 	  _currentStatus (Command::DONE), _currentCommandName ( )
@@ -54,7 +56,8 @@ CommandManager::CommandManager (const CommandManager&)
 	: ReferencedNamedObject ("unamed"),
 	  _runners ( ), _runnersMutex (false),
 	  _commandObservers ( ), _logStream (0), _undoManager(0),
-	  _commands ( ), _queuedCommands ( ),
+	  _commands ( ), _queuedCommands ( ), _undoOrder ( ),
+	  _dispatchRequested (false),
 	  _policy (runningPolicy),
 	  _queuingMutex (false), _sequentialMutex (false), _sequentialCommand (0),
 	  _currentStatus (Command::FAIL), _currentCommandName ( )
@@ -97,6 +100,8 @@ void CommandManager::clear()
 {
 	_undoManager->clear();
 	_commands.clear(); // est-ce que cette réinitialisation est judicieuse ? / observateurs
+	AutoMutex	runnersAutoMutex (&_runnersMutex);
+	_undoOrder.clear ( );
 }
 
 const string& CommandManager::getName ( ) const
@@ -143,16 +148,36 @@ void CommandManager::addCommand (Command* cmd, Command::PLAY_TYPE pt)
 
 	AutoMutex	autoMutex (getMutex ( ));
 
+	// Une commande soumise pour une première exécution est recensée avant son
+	// éventuelle mise en file d'attente afin d'être observée et sauvegardée
+	// (script) dans l'ordre de soumission :
+	if ((Command::DO == pt) || (Command::QUEUED == pt))
+	{
+		_commands.push_back (command);
+		//std::cout<<"_commands.size() = "<<_commands.size()<<std::endl;
+		registerObservable (command, false);
+		AutoMutex	runnersAutoMutex (&_runnersMutex);
+		_undoOrder.push_back (command);
+	}	// if ((Command::DO == pt) || (Command::QUEUED == pt))
+
+	// Quoi qu'il arrive les observateurs de commandes doivent être informés du
+	// devenir de la commande confiée :
+	for (vector<ObjectBase*>::iterator ito = _commandObservers.begin ( );
+			_commandObservers.end ( ) != ito; ito++)
+		if (false == (*ito)->isObservableRegistered (command, false))
+			(*ito)->registerObservable (command, false);
+
 	// Force-t-on la mise en file d'attente ? Oui si :
 	// - pt	= QUEUED
 	// - (SEQUENTIAL == policy) && (true == hasRunningCommands ( ))
 	// - (SEQUENTIAL == policy) && (true == hasQueuedCommands ( ))
+	// - (DO == pt) et commande à lancer dans un thread dédié alors qu'elle
+	//   dépend d'une commande en cours ou en file d'attente.
 	// _sequentialMutex déjà verrouillé.
 	// L'objectif en undo/redo est bien sûr de s'affranchir de ce type de
 	// problème, mais également de (re)jouer/défaire les opérations toujours
 	// dans le même ordre.
 	bool	hasRunning		= hasRunningCommands ( );
-	bool	hasQueued		= false;
 	try
 	{
 		_sequentialMutex.lock ( );
@@ -170,27 +195,18 @@ void CommandManager::addCommand (Command* cmd, Command::PLAY_TYPE pt)
 				((SEQUENTIAL == getPolicy ( )) &&
 						((true == hasRunning) || (true == hasQueuedCommands( ))) ||
 						((true == hasRunning) &&
-								((Command::UNDO == pt) || Command::REDO == pt)))
+								((Command::UNDO == pt) || Command::REDO == pt)) ||
+						((Command::DO == pt) && (true == runInThread (command, pt)) &&
+								(false == canStartNow (command, pt))))
 		)
 		{
+			_sequentialMutex.unlock ( );
 			addToQueue (cmd, pt);
+			if ((Command::QUEUED == pt) || (Command::DO == pt))
+				notifyObserversForModification (NEW_COMMAND);
 			return;
 		}
 
-		if (Command::DO == pt)
-		{
-			_commands.push_back (command);
-			//std::cout<<"_commands.size() = "<<_commands.size()<<std::endl;
-			registerObservable (command, false);
-		}	// if (_commands.end ( ) == find ( ...
-
-		// Quoi qu'il arrive les observateurs de commandes doivent être informés du
-		// devenir de la commande confiée :
-		for (vector<ObjectBase*>::iterator ito = _commandObservers.begin ( );
-				_commandObservers.end ( ) != ito; ito++)
-			if (false == (*ito)->isObservableRegistered (command, false))
-				(*ito)->registerObservable (command, false);
-
 		UTF8String	message (Charset::UTF_8);
 		message << "Ajout de la commande " << command->getName ( )
 	        		<< " de nom unique " << command->getUniqueName ( )
@@ -224,6 +240,11 @@ void CommandManager::addCommand (Command* cmd, Command::PLAY_TYPE pt)
 					<< ". Type d'exécution à effectuer : "
 					<< Command::playTypeToString (pt)
 			<< ".";
+			if (Command::DO == pt)
+			{
+				AutoMutex	runnersAutoMutex (&_runnersMutex);
+				removeFromUndoOrder (command);
+			}	// if (Command::DO == pt)
 			try
 			{
 				unregisterObservable (command, false);
@@ -242,35 +263,35 @@ void CommandManager::addCommand (Command* cmd, Command::PLAY_TYPE pt)
 		if ((Command::QUEUED == pt) || (Command::DO == pt))
 			notifyObserversForModification (NEW_COMMAND);
 
-		unsigned long	estimatedTime = 0;
-		// pas la peine de faire une estimation pour undo (surtout pour éviter d'être bloqué avec commande en erreur)
-		if (Command::UNDO != pt)
-			estimatedTime = command->getEstimatedDuration (pt);
-//unsigned long	estimatedTime	= 999999999999;
-		if ((SEQUENTIAL == getPolicy ( )) ||
-				(false == command->threadable ( ))   ||
-				(estimatedTime < sequentialDuration) ||
-				(Command::UNDO == pt)             ||
-				(Command::REDO == pt)
-		)
+		if (false == runInThread (command, pt))
 			executeSequential (command, pt);
 		else
 			executeThreaded (command, pt);
 
-		hasRunning	= hasRunningCommands ( );
-		hasQueued	= hasQueuedCommands ( );
 		_sequentialMutex.unlock ( );
 
 	}
 	catch (...)
 	{
 		_sequentialMutex.unlock ( );
+		// Commande non exécutée : elle ne doit pas retarder le stockage des
+		// commandes suivantes dans le gestionnaire de undo/redo.
+		if ((Command::DO == pt) && (false == command->isCompleted ( )))
+		{
+			{
+				AutoMutex	runnersAutoMutex (&_runnersMutex);
+				removeFromUndoOrder (command);
+			}
+			storeCompletedCommands (command);
+		}	// if ((Command::DO == pt) && (false == command->isCompleted ( )))
 		throw;
 	}
 
-	// S'il y a des commandes en file d'attente et aucune en cours de traitement
-	// on en lance une :
-	if ((false == hasRunning) && (true == hasQueued))
+	// S'il y a des commandes en file d'attente on lance celles qui peuvent
+	// l'être. L'état est lu après déverrouillage de _sequentialMutex : un
+	// lanceur qui s'achève ensuite lancera lui-même les commandes suivantes
+	// (commandRunnerCompleted).
+	if (true == hasQueuedCommands ( ))
 		runQueuedCommand ( );
 }	// CommandManager::addCommand
 
@@ -314,7 +335,7 @@ bool CommandManager::hasRunningCommands ( ) const
 	if (0 == _runners.size ( ))
 		return false;
 
-	for (vector<CommandRunner*>::const_iterator itr = _runners.begin ( );
+	for (unordered_set<CommandRunner*>::const_iterator itr = _runners.begin ( );
 	     _runners.end ( ) != itr; itr++)
 		if (false == (*itr)->getCommand ( )->isCompleted ( ))
 			return true;
@@ -336,15 +357,8 @@ CommandRunner* CommandManager::getCommandRunner (Command* command)
 	if (0 == command)
 		return 0;
 
-	AutoMutex	autoMutex (getMutex ( ));
 	AutoMutex	runnersAutoMutex (&_runnersMutex);
-
-	for (vector<CommandRunner*>::iterator itr = _runners.begin ( );
-	     _runners.end ( ) != itr; itr++)
-		if ((*itr)->getCommand ( ) == command)
-			return *itr;
-
-	return 0;
+	return findRunner (command);
 }	// CommandManager::getCommandRunner
 
 
@@ -353,39 +367,85 @@ void CommandManager::commandRunnerDeleted (CommandRunner* runner)
 	if (0 == runner)
 		return;
 
-	AutoMutex	autoMutex (getMutex ( ));
 	AutoMutex	runnersAutoMutex (&_runnersMutex);
-	for (vector<CommandRunner*>::iterator itr = _runners.begin ( );
-	     _runners.end ( ) != itr; itr++)
-		if (*itr == runner)
-		{
-			_runners.erase (itr);
-			break;
-		}	// if (*itr == runner)
+	removeRunner (runner);
 }	// CommandManager::commandRunnerDeleted
 
 
-void CommandManager::wait ( )
+void CommandManager::commandRunnerCompleted (CommandRunner* runner)
+{
+	{
+		AutoMutex	runnersAutoMutex (&_runnersMutex);
+		removeRunner (runner);
+	}
+
+	// Le thread principal exécute une commande séquentielle ou est dans
+	// addCommand, ou un autre lanceur lance des commandes : il effectuera une
+	// nouvelle passe. La demande de passe est émise après déréférencement du
+	// lanceur, et effacée par le thread qui lance avant sa recherche de
+	// commandes exécutables : elle ne peut être perdue.
+	do
+	{
+		if (false == _sequentialMutex.tryLock ( ))
+		{
+			_dispatchRequested	= true;
+			return;
+		}	// if (false == _sequentialMutex.tryLock ( ))
+		MutexUnlocker	unlocker (&_sequentialMutex);
+		_dispatchRequested	= false;
+
+		Command::PLAY_TYPE	pt		= Command::DO;
+		for (Command* command = popRunnableQueuedCommand (pt, false);
+		     0 != command; command = popRunnableQueuedCommand (pt, false))
+		{
+			UTF8String	message (Charset::UTF_8);
+			message << "Lancement de la commande en file d'attente "
+			        << command->getName ( )
+			        << " de nom unique " << command->getUniqueName ( )
+			        << " à l'achèvement d'un lanceur de commande.";
+			MGX_TRACE_LOG_1 (trace, message)
+			log (trace);
+			startRunner (command, pt);
+		}	// for (Command* command = popRunnableQueuedCommand (pt, false); ...
+	}
+	while (true == _dispatchRequested);
+}	// CommandManager::commandRunnerCompleted
+
+
+bool CommandManager::wait (unsigned long milliseconds)
 {
-	AutoMutex	autoMutex (getMutex ( ));
 	UTF8String	message1 (Charset::UTF_8), message2 (Charset::UTF_8);
-	message1 << "Attente des " << (unsigned long)_runners.size ( )
-	         << " commandes en cours d'exécution par le gestionnaire "
-	         << getName ( ) << " ...";
+	{
+		AutoMutex	runnersAutoMutex (&_runnersMutex);
+		message1 << "Attente des " << (unsigned long)_runners.size ( )
+		         << " commandes en cours d'exécution par le gestionnaire "
+		         << getName ( ) << " ...";
+	}
 	MGX_TRACE_LOG_1 (trace1, message1)
 	log (trace1);
 
-	while (0 != _runners.size ( ))
+	// Attente passive : removeRunner signale chaque déréférencement de lanceur.
+	bool	completed	= true;
 	{
-		errno	= 0;
-		if (0 != sched_yield ( ))
-			cout << "CommandManager::wait. Erreur lors de l'appel de "
-			     << "sched_yield : " <<  strerror (errno) << endl;
-	}	// while (0 != _runners.size ( ))
-	message2 << "Toutes les commandes du gestionnaire " << getName ( )
-	         << " sont achevées.";
+		unique_lock<Mutex>	lock (_runnersMutex);
+		if (0 == milliseconds)
+			_runnersCondition.wait (lock, [this] { return _runners.empty ( ); });
+		else
+			completed	= _runnersCondition.wait_for (lock,
+						chrono::milliseconds (milliseconds),
+						[this] { return _runners.empty ( ); });
+	}
+
+	if (true == completed)
+		message2 << "Toutes les commandes du gestionnaire " << getName ( )
+		         << " sont achevées.";
+	else
+		message2 << "Délai d'attente des commandes du gestionnaire "
+		         << getName ( ) << " écoulé.";
 	MGX_TRACE_LOG_1 (trace2, message2)
 	log (trace2);
+
+	return completed;
 }	// CommandManager::wait
 
 
@@ -443,7 +503,7 @@ void CommandManager::setLogStream (TkUtil::LogOutputStream* stream)
 	UndoRedoManager*	urm	= dynamic_cast<UndoRedoManager*>(&getUndoManager());
 	if (0 != urm)
 		urm->setLogStream (stream);
-	for (vector<CommandRunner*>::iterator itr = _runners.begin ( );
+	for (unordered_set<CommandRunner*>::iterator itr = _runners.begin ( );
 	     _runners.end ( ) != itr; itr++)
 		(*itr)->setLogStream (stream);
 }	// CommandManager::setLogStream
@@ -478,28 +538,23 @@ void CommandManager::observableModified (ReferencedObject* object, unsigned long
 	    (Command::FAIL == status))
 	{
 		AutoMutex		runnersAutoMutex (&_runnersMutex);
-	    for (vector<CommandRunner*>::iterator itr = _runners.begin ( );
-	            _runners.end ( ) != itr; itr++)
+		if (true == removeRunner (findRunner (command)))
 		{
-	        //		if ((*itr)->getCommand ( ) == command)
-	        if (command->getCommandRunner ( ) == *itr)
-			{
-				AutoMutex	queuingAutoMutex (&_queuingMutex);
-				_runners.erase (itr);
-				message2 << "Lanceur de commande associé à la commande "
-				         << command->getName ( )
-				         << " déréférencé auprès du gestionnaire "
-				         << getName ( ) << ".";
-				MGX_TRACE_LOG_1 (trace2, message2)
-				log (trace2);
-				break;
-			}	// if ((*itr)->getCommand ( ) == command)
-		}	// for (vector<CommandRunner*>::iterator itr = ...
+			message2 << "Lanceur de commande associé à la commande "
+			         << command->getName ( )
+			         << " déréférencé auprès du gestionnaire "
+			         << getName ( ) << ".";
+			MGX_TRACE_LOG_1 (trace2, message2)
+			log (trace2);
+		}	// if (true == removeRunner (findRunner (command)))
 	}	// if ((Command::DONE == status) || (Command::CANCELED == status) || ...
 
-    // L'ajouter au gestionnaire de undo/redo ?
-    if (Command::DONE == status)
-        getUndoManager ( ).store (command);
+    // L'ajouter au gestionnaire de undo/redo ? Dans l'ordre de soumission des
+    // commandes, certaines pouvant s'achever avant des commandes antérieures
+    // exécutées simultanément.
+	if ((Command::DONE == status) || (Command::CANCELED == status) ||
+	    (Command::FAIL == status))
+		storeCompletedCommands (command);
 
     // suppression des commandes déjouées
     if (Command::STARTING == status && command->getPlayType() == Command::DO)
@@ -528,23 +583,17 @@ void CommandManager::observableDeleted (ReferencedObject* object)
 		AutoMutex	autoMutex (getMutex ( ));
 		AutoMutex	runnersAutoMutex (&_runnersMutex);
 
-		for (vector<CommandRunner*>::iterator itr = _runners.begin ( );
-		     _runners.end ( ) != itr; itr++)
+		if (true == removeRunner (findRunner (command)))
 		{
-			if ((*itr)->getCommand ( ) == command)
-			{
-				AutoMutex	queuingAutoMutex (&_queuingMutex);
-				_runners.erase (itr);
-				UTF8String	message (Charset::UTF_8);
-				message << "Lanceur de commande associé à la commande "
-				        << command->getName ( )
-				        << " déréférencé auprès du gestionnaire "
-				        << getName ( ) << ".";
-				MGX_TRACE_LOG_1 (trace, message)
-				log (trace);
-				break;
-			}	// if ((*itr)->getCommand ( ) == command)
-		}	// for (vector<CommandRunner*>::iterator itr = ...
+			UTF8String	message (Charset::UTF_8);
+			message << "Lanceur de commande associé à la commande "
+			        << command->getName ( )
+			        << " déréférencé auprès du gestionnaire "
+			        << getName ( ) << ".";
+			MGX_TRACE_LOG_1 (trace, message)
+			log (trace);
+		}	// if (true == removeRunner (findRunner (command)))
+		removeFromUndoOrder (command);
 
 		// On enlève la commande de la liste des commandes prises en charge :
 		for (vector<Command*>::iterator itc = _commands.begin ( );
@@ -645,10 +694,11 @@ void CommandManager::redo ()
 void CommandManager::executeSequential (Command* cmd, Command::PLAY_TYPE pt)
 {
 	// Magix3D Issue #54 Un thread séquentiel (ex : écriture d'un maillage) ne doit pas s'exécuter en concurrence avec un autre thread (ex : génération d'un maillage) 
-	// => on s'assure qu'il n'y a pas d'éventuels autre thread en cours.
+	// => on s'assure qu'il n'y a pas d'éventuels autre thread en cours dont la commande dépend (ressources lues ou modifiées, cf. Command::isIndependent).
 	// On rappelle ici que la génération de maillage est threadable afin de ne pas bloquer l'IHM et par là m^eme inquiéter l'utilisateur durant une opération 
 	// potentiellement longue.
-	ThreadManager::instance ( ).join ( );	// CP Magix3D Issue #54
+	if (0 != cmd)
+		waitForConflictingCommands (cmd, pt);	// CP Magix3D Issue #54
 
 	MutexUnlocker	unlocker (&_sequentialMutex);
 	if (0 == cmd)
@@ -719,23 +769,11 @@ void CommandManager::executeThreaded (Command* cmd, Command::PLAY_TYPE pt)
 	         << estimatedTime << " secondes.";
 	MGX_TRACE_LOG_1 (trace1, message1)
 	log (trace1);
-	CommandRunner*	runner	= new CommandRunner (this, command, pt);
-	command->setCommandRunner (runner);
-	runner->setLogStream (getLogStream ( ));
-	_runnersMutex.lock ( );
-	_runners.push_back (runner);
-		if (Command::UNDO == pt)
-			getUndoManager ( ).undo ( );
-		else if (Command::REDO == pt)
-			getUndoManager ( ).redo ( );
-	_runnersMutex.unlock ( );
-	// Rem CP 14/03/11 : les runners ne se suicident plus, ils sont pris
-	// en charge par l'API TkUtil::ThreadManager qui les détruira une fois
-	// l'exécution complétement terminée.
-	// C'est également TkUtil::ThreadManager qui démarrera la commande
-	// (cf. API TkUtil::ThreadManager).
-//	runner->startTask ( );
-	ThreadManager::instance ( ).addTask (runner);
+	if (Command::UNDO == pt)
+		getUndoManager ( ).undo ( );
+	else if (Command::REDO == pt)
+		getUndoManager ( ).redo ( );
+	startRunner (command, pt);
 	message2 << "Lancement de la commande " << command->getName ( )
 	         << " de type " << Command::playTypeToString (pt)
 	         << " dans un thread dédié effectué.";
@@ -747,41 +785,94 @@ void CommandManager::executeThreaded (Command* cmd, Command::PLAY_TYPE pt)
 void CommandManager::runQueuedCommand ( )
 {
 	if (0 != _sequentialMutex.getLockCount ( ))
+	{
+		_dispatchRequested	= true;
 		return;
+	}	// if (0 != _sequentialMutex.getLockCount ( ))
 
-	if ((false == hasRunningCommands ( )) && (0 != _queuedCommands.size ( )))
+	// Cf. commandRunnerCompleted : une passe demandée pendant que
+	// _sequentialMutex est verrouillé est effectuée ici.
+	do
 	{
+		_sequentialMutex.lock ( );	// Déverrouillé par executeXXX
+		_dispatchRequested	= false;
+		Command::PLAY_TYPE	pt	= Command::DO;
+		Command*			cmd	= popRunnableQueuedCommand (pt, true);
+		if (0 == cmd)
 		{
-			Command*				cmd	= 0;
-			Command::PLAY_TYPE	pt;
-			{
-				AutoMutex	mutex (&_queuingMutex);
-				cmd	= (*(_queuedCommands.begin ( ))).first;
-				pt	= (*(_queuedCommands.begin ( ))).second;
-				if (Command::QUEUED == pt)
-					pt	= Command::DO;
-				_queuedCommands.pop_front (  );
-				if (0 == cmd)
-					return;
-			}
+			_sequentialMutex.unlock ( );
+			continue;
+		}	// if (0 == cmd)
 
-			unsigned long	estimatedTime	= cmd->getEstimatedDuration (pt);
-			if ((SEQUENTIAL == getPolicy ( )) ||
-			    (false == cmd->threadable ( ))       ||
-			    (estimatedTime < sequentialDuration) ||
-			    (Command::UNDO == pt)             ||
-			    (Command::REDO == pt)
-				)
-			{
-				executeSequential (cmd, pt);
-			}
-			else
-				executeThreaded (cmd, pt);
-		}	// if (true == _queuingMutex.tryLock ( ))
-	}	// if ((false == hasRunningCommands ( )) && ...
+		if (false == runInThread (cmd, pt))
+			executeSequential (cmd, pt);
+		else
+			executeThreaded (cmd, pt);
+		_dispatchRequested	= true;	// D'autres peuvent être lancées
+	}
+	while (true == _dispatchRequested);
 }	// CommandManager::runQueuedCommand
 
 
+Command* CommandManager::popRunnableQueuedCommand (
+							Command::PLAY_TYPE& pt, bool sequentialAllowed)
+{
+	AutoMutex	runnersAutoMutex (&_runnersMutex);
+	AutoMutex	queuingAutoMutex (&_queuingMutex);
+
+	// Une commande ne double pas une commande de la file dont elle dépend.
+	// En politique SEQUENTIAL ou pour un undo/redo l'ordre de la file est
+	// strict.
+	bool					strict	= SEQUENTIAL == getPolicy ( ) ? true : false;
+	vector<Command*>		skipped;
+	for (deque< pair<Command*, Command::PLAY_TYPE> >::iterator itq =
+			_queuedCommands.begin ( ); _queuedCommands.end ( ) != itq; itq++)
+	{
+		Command*			command	= itq->first;
+		Command::PLAY_TYPE	type	=
+					Command::QUEUED == itq->second ? Command::DO : itq->second;
+		bool	blocked	= (Command::DO != type) || (true == strict) ?
+							!skipped.empty ( ) : false;
+		for (vector<Command*>::const_iterator its = skipped.begin ( );
+		     (false == blocked) && (skipped.end ( ) != its); its++)
+			blocked	= !command->isIndependent (**its);
+
+		if ((false == blocked) && (true == isRunnable (command, type)) &&
+		    ((true == sequentialAllowed) || (true == runInThread (command, type))))
+		{
+			pt	= type;
+			_queuedCommands.erase (itq);
+			return command;
+		}	// if ((false == blocked) && ...
+
+		if (Command::DO != type)
+			strict	= true;
+		skipped.push_back (command);
+	}	// for (deque< pair<Command*, Command::PLAY_TYPE> >::iterator itq = ...
+
+	return 0;
+}	// CommandManager::popRunnableQueuedCommand
+
+
+bool CommandManager::isRunnable (Command* command, Command::PLAY_TYPE pt) const
+{
+	if ((Command::DO != pt) || (SEQUENTIAL == getPolicy ( )) ||
+	    (false == getUndoManager ( ).getUndoneCommands ( ).empty ( )))
+		return _runners.empty ( );
+
+	for (unordered_set<CommandRunner*>::const_iterator itr = _runners.begin ( );
+	     _runners.end ( ) != itr; itr++)
+	{
+		const Command*	running	= (*itr)->getCommand ( );
+		if ((0 != running) && (false == running->isCompleted ( )) &&
+		    (false == command->isIndependent (*running)))
+			return false;
+	}	// for (unordered_set<CommandRunner*>::const_iterator itr = ...
+
+	return true;
+}	// CommandManager::isRunnable
+
+
 void CommandManager::addToQueue (Command* command, Command::PLAY_TYPE pt)
 {
 	if (0 == command)
@@ -807,6 +898,129 @@ void CommandManager::addToQueue (Command* command, Command::PLAY_TYPE pt)
 	log (trace);
 }	// CommandManager::addToQueue
 
+
+bool CommandManager::runInThread (Command* command, Command::PLAY_TYPE pt) const
+{
+	// Pas la peine de faire une estimation pour undo/redo (surtout pour
+	// éviter d'être bloqué avec commande en erreur) :
+	if ((Command::UNDO == pt) || (Command::REDO == pt) ||
+	    (SEQUENTIAL == getPolicy ( )) || (false == command->threadable ( )))
+		return false;
+
+	return command->getEstimatedDuration (pt) < sequentialDuration ? false : true;
+}	// CommandManager::runInThread
+
+
+void CommandManager::startRunner (Command* command, Command::PLAY_TYPE pt)
+{
+	CommandRunner*	runner	= new CommandRunner (this, command, pt);
+	command->setCommandRunner (runner);
+	runner->setLogStream (getLogStream ( ));
+	{
+		AutoMutex	runnersAutoMutex (&_runnersMutex);
+		_runners.insert (runner);
+	}
+	// Rem CP 14/03/11 : les runners ne se suicident plus, ils sont pris
+	// en charge par l'API TkUtil::ThreadManager qui les détruira une fois
+	// l'exécution complétement terminée.
+	// C'est également TkUtil::ThreadManager qui démarrera la commande
+	// (cf. API TkUtil::ThreadManager).
+//	runner->startTask ( );
+	ThreadManager::instance ( ).addTask (runner);
+}	// CommandManager::startRunner
+
+
+CommandRunner* CommandManager::findRunner (Command* command) const
+{
+	// Le lanceur enregistré dans la commande n'est déréférencé que s'il est
+	// toujours référencé, donc non détruit. Son adresse a pu être réutilisée
+	// par le lanceur d'une autre commande, d'où la vérification de l'identité
+	// de la commande.
+	CommandRunner*	runner	= 0 == command ? 0 : command->getCommandRunner ( );
+	if ((0 == runner) || (_runners.end ( ) == _runners.find (runner)) ||
+	    (runner->getCommand ( ) != command))
+		return 0;
+
+	return runner;
+}	// CommandManager::findRunner
+
+
+bool CommandManager::removeRunner (CommandRunner* runner)
+{
+	if ((0 == runner) || (0 == _runners.erase (runner)))
+		return false;
+
+	// Le lanceur était référencé, donc sa commande n'est pas détruite
+	// (cf. observableDeleted) : elle ne doit plus pointer sur lui.
+	Command*	command	= runner->getCommand ( );
+	if ((0 != command) && (runner == command->getCommandRunner ( )))
+		command->setCommandRunner (0);
+
+	_runnersCondition.notify_all ( );
+	return true;
+}	// CommandManager::removeRunner
+
+
+bool CommandManager::canStartNow (Command* command, Command::PLAY_TYPE pt) const
+{
+	AutoMutex	runnersAutoMutex (&_runnersMutex);
+	if (false == isRunnable (command, pt))
+		return false;
+
+	AutoMutex	queuingAutoMutex (&_queuingMutex);
+	for (deque< pair<Command*, Command::PLAY_TYPE> >::const_iterator itq =
+			_queuedCommands.begin ( ); _queuedCommands.end ( ) != itq; itq++)
+		if ((Command::DO != pt) || (Command::UNDO == itq->second) ||
+		    (Command::REDO == itq->second) ||
+		    (false == command->isIndependent (*(itq->first))))
+			return false;
+
+	return true;
+}	// CommandManager::canStartNow
+
+
+void CommandManager::waitForConflictingCommands (
+									Command* command, Command::PLAY_TYPE pt)
+{
+	unique_lock<Mutex>	lock (_runnersMutex);
+	_runnersCondition.wait (lock,
+					[this, command, pt] { return isRunnable (command, pt); });
+}	// CommandManager::waitForConflictingCommands
+
+
+void CommandManager::storeCompletedCommands (Command* command)
+{
+	vector<Command*>	completed;
+	{
+		AutoMutex	runnersAutoMutex (&_runnersMutex);
+		// undo/redo, ou commande retirée de la liste :
+		if ((Command::DONE == command->getStatus ( )) && (_undoOrder.end ( ) ==
+				find (_undoOrder.begin ( ), _undoOrder.end ( ), command)))
+			completed.push_back (command);
+
+		while ((false == _undoOrder.empty ( )) &&
+		       (true == _undoOrder.front ( )->isCompleted ( )))
+		{
+			if (Command::DONE == _undoOrder.front ( )->getStatus ( ))
+				completed.push_back (_undoOrder.front ( ));
+			_undoOrder.pop_front ( );
+		}	// while ((false == _undoOrder.empty ( )) && ...
+	}
+
+	for (vector<Command*>::iterator itc = completed.begin ( );
+	     completed.end ( ) != itc; itc++)
+		getUndoManager ( ).store (*itc);
+}	// CommandManager::storeCompletedCommands
+
+
+void CommandManager::removeFromUndoOrder (Command* command)
+{
+	deque<Command*>::iterator	it	=
+					find (_undoOrder.begin ( ), _undoOrder.end ( ), command);
+	if (_undoOrder.end ( ) != it)
+		_undoOrder.erase (it);
+}	// CommandManager::removeFromUndoOrder
+
 }	// namespace Utils
 
 }	// namespace Mgx3D
@@ -99,6 +99,12 @@ UTF8String CommandResult::getErrorMessage ( ) const
 }	// CommandResult::getErrorMessage
 
 
+bool CommandResult::waitFor (unsigned long milliseconds)
+{
+	return getCommand ( ).waitFor (milliseconds);
+}	// CommandResult::waitFor
+
+
 bool CommandResult::isUserNotified ( ) const
 {
 	return getCommand ( ).isUserNotified ( );
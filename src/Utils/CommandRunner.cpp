@@ -183,6 +183,28 @@ printf ("%s %d COMMAND INTERRUPTED.\n", __FILE__, __LINE__);
 			log (TkUtil::TraceLog (message2, TkUtil::Log::TRACE_1));
 		}	// else if (true == hasError)
 	}	// if (0 != getCommand ( ))
+
+	// Signalement de l'achèvement au gestionnaire (réveil des threads en
+	// attente, lancement de la commande suivante en file d'attente) :
+	if (0 != _manager)
+	{
+		try
+		{
+			_manager->commandRunnerCompleted (this);
+		}
+		catch (const Exception& exc)
+		{
+			UTF8String	error (Charset::UTF_8);
+			error << "Erreur lors du lancement de la commande suivante à "
+			      << "l'achèvement de la commande " << _cmdName
+			      << " (nom unique : " << _cmdUniqueName << ") : "
+			      << exc.getFullMessage ( );
+			log (ErrorLog (error));
+		}
+		catch (...)
+		{
+		}
+	}	// if (0 != _manager)
 }	// CommandRunner::execute
 
 
@@ -0,0 +1,321 @@
+#include "Utils/Common.h"
+#include "Utils/Profiler.h"
+
+#include <TkUtil/Exception.h>
+#include <TkUtil/UTF8String.h>
+
+#include <algorithm>
+#include <cxxabi.h>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace TkUtil;
+using namespace std;
+
+
+namespace Mgx3D
+{
+
+namespace Utils
+{
+
+// ============================================================================
+//                         LA CLASSE Profiler::ScopedTimer
+// ============================================================================
+
+Profiler::ScopedTimer::ScopedTimer (const char* name, const string& category)
+	: _name (name), _category ( ), _type (0),
+	  _enabled (Profiler::isEnabled ( )), _start ( )
+{
+	if (true == _enabled)
+	{
+		_category	= category;
+		_start		= chrono::steady_clock::now ( );
+	}	// if (true == _enabled)
+}	// ScopedTimer::ScopedTimer
+
+
+Profiler::ScopedTimer::ScopedTimer (const char* name, const type_info& category)
+	: _name (name), _category ( ), _type (&category),
+	  _enabled (Profiler::isEnabled ( )), _start ( )
+{
+	if (true == _enabled)
+		_start	= chrono::steady_clock::now ( );
+}	// ScopedTimer::ScopedTimer
+
+
+Profiler::ScopedTimer::ScopedTimer (const Profiler::ScopedTimer&)
+	: _name (0), _category ( ), _type (0), _enabled (false), _start ( )
+{
+	MGX_FORBIDDEN ("ScopedTimer copy constructor is not allowed.");
+}	// ScopedTimer::ScopedTimer
+
+
+Profiler::ScopedTimer& Profiler::ScopedTimer::operator = (const Profiler::ScopedTimer&)
+{
+	MGX_FORBIDDEN ("ScopedTimer assignment operator is not allowed.");
+	return *this;
+}	// ScopedTimer::operator =
+
+
+Profiler::ScopedTimer::~ScopedTimer ( )
+{
+	// Le profileur a pu être désactivé entre temps, on enregistre quand même
+	// la mesure commencée.
+	if (false == _enabled)
+		return;
+
+	const chrono::steady_clock::time_point	end	= chrono::steady_clock::now ( );
+	try
+	{
+		if (0 != _type)
+			_category	= Profiler::typeName (*_type);
+		Profiler::instance ( ).addEvent (_name, _category, _start, end);
+	}
+	catch (...)
+	{
+	}
+}	// ScopedTimer::~ScopedTimer
+
+
+// ============================================================================
+//                               LA CLASSE Profiler
+// ============================================================================
+
+atomic<bool>	Profiler::_enabled (false);
+size_t			Profiler::maxEvents	= 1000000;
+
+
+Profiler::Profiler ( )
+	: _mutex ( ), _origin (chrono::steady_clock::now ( )),
+	  _events ( ), _statistics ( ), _counters ( )
+{
+}	// Profiler::Profiler
+
+
+Profiler::Profiler (const Profiler&)
+	: _mutex ( ), _origin ( ), _events ( ), _statistics ( ), _counters ( )
+{
+	MGX_FORBIDDEN ("Profiler copy constructor is not allowed.");
+}	// Profiler::Profiler
+
+
+Profiler& Profiler::operator = (const Profiler&)
+{
+	MGX_FORBIDDEN ("Profiler assignment operator is not allowed.");
+	return *this;
+}	// Profiler::operator =
+
+
+Profiler& Profiler::instance ( )
+{
+	static Profiler	profiler;
+
+	return profiler;
+}	// Profiler::instance
+
+
+void Profiler::setEnabled (bool enabled)
+{
+	_enabled.store (enabled);
+}	// Profiler::setEnabled
+
+
+void Profiler::reset ( )
+{
+	lock_guard<mutex>	lock (_mutex);
+	_origin	= chrono::steady_clock::now ( );
+	_events.clear ( );
+	_statistics.clear ( );
+	_counters.clear ( );
+}	// Profiler::reset
+
+
+void Profiler::addEvent (const char* name, const string& category,
+                         const chrono::steady_clock::time_point& start,
+                         const chrono::steady_clock::time_point& end)
+{
+	const string	fullName	= true == category.empty ( ) ?
+			string (0 == name ? "" : name) :
+			category + '/' + (0 == name ? "" : name);
+	const double	duration	= chrono::duration<double> (end - start).count ( );
+	const unsigned long	thread	= threadId ( );
+
+	lock_guard<mutex>	lock (_mutex);
+	Statistics&	statistics	= _statistics [fullName];
+	if ((0 == statistics.count) || (duration < statistics.min))
+		statistics.min	= duration;
+	if ((0 == statistics.count) || (duration > statistics.max))
+		statistics.max	= duration;
+	statistics.count++;
+	statistics.total	+= duration;
+
+	if (_events.size ( ) >= maxEvents)
+		return;
+	Event	event;
+	event.name		= 0 == name ? "" : name;
+	event.category	= category;
+	event.thread	= thread;
+	event.start		=
+		chrono::duration_cast<chrono::microseconds>(start - _origin).count ( );
+	event.duration	=
+		chrono::duration_cast<chrono::microseconds>(end - start).count ( );
+	_events.push_back (event);
+}	// Profiler::addEvent
+
+
+void Profiler::count (const char* name, double value)
+{
+	lock_guard<mutex>	lock (_mutex);
+	_counters [0 == name ? "" : name]	+= value;
+}	// Profiler::count
+
+
+/**
+ * \return	La chaîne transmise en argument conforme au format JSON.
+ */
+static string jsonString (const string& str)
+{
+	string	json ("\"");
+	for (string::const_iterator it = str.begin ( ); str.end ( ) != it; it++)
+	{
+		const unsigned char	c	= *it;
+		switch (c)
+		{
+			case '"'	: json += "\\\"";	break;
+			case '\\'	: json += "\\\\";	break;
+			case '\n'	: json += "\\n";	break;
+			case '\t'	: json += "\\t";	break;
+			default		:
+				if (c < 0x20)
+				{
+					char	buffer [8];
+					snprintf (buffer, sizeof (buffer), "\\u%04x", c);
+					json += buffer;
+				}
+				else
+					json += *it;	// UTF-8 conservé tel quel
+		}	// switch (c)
+	}	// for (string::const_iterator it = str.begin ( ); ...
+	json += '"';
+
+	return json;
+}	// jsonString
+
+
+void Profiler::writeChromeTrace (const string& fileName) const
+{
+	ofstream	stream (fileName.c_str ( ), ios::out | ios::trunc);
+	if (false == stream.good ( ))
+	{
+		UTF8String	message (Charset::UTF_8);
+		message << "Impossible d'ouvrir le fichier " << fileName
+		        << " en écriture pour y enregistrer les mesures du profileur.";
+		throw Exception (message);
+	}	// if (false == stream.good ( ))
+
+	lock_guard<mutex>	lock (_mutex);
+	stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	stream << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,"
+	       << "\"args\":{\"name\":\"Magix3D\"}}";
+	for (vector<Event>::const_iterator ite = _events.begin ( );
+	     _events.end ( ) != ite; ite++)
+	{
+		stream << ",\n{\"name\":" << jsonString ((*ite).name)
+		       << ",\"cat\":" << jsonString (true == (*ite).category.empty ( ) ?
+		                                     string ("Magix3D") : (*ite).category)
+		       << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << (*ite).thread
+		       << ",\"ts\":" << (*ite).start << ",\"dur\":" << (*ite).duration;
+		if (false == (*ite).category.empty ( ))
+			stream << ",\"args\":{\"command\":" << jsonString ((*ite).category)
+			       << "}";
+		stream << "}";
+	}	// for (vector<Event>::const_iterator ite = _events.begin ( ); ...
+
+	// Les compteurs, en fin de trace :
+	const long long	end	= true == _events.empty ( ) ? 0 :
+	                  _events.back ( ).start + _events.back ( ).duration;
+	for (map<string, double>::const_iterator itc = _counters.begin ( );
+	     _counters.end ( ) != itc; itc++)
+		stream << ",\n{\"name\":" << jsonString (itc->first)
+		       << ",\"ph\":\"C\",\"pid\":1,\"tid\":0,\"ts\":" << end
+		       << ",\"args\":{\"value\":" << itc->second << "}}";
+	stream << "\n]}\n";
+
+	if (false == stream.good ( ))
+	{
+		UTF8String	message (Charset::UTF_8);
+		message << "Erreur lors de l'écriture des mesures du profileur dans le "
+		        << "fichier " << fileName << ".";
+		throw Exception (message);
+	}	// if (false == stream.good ( ))
+}	// Profiler::writeChromeTrace
+
+
+string Profiler::getSummary ( ) const
+{
+	lock_guard<mutex>	lock (_mutex);
+
+	vector< pair<string, Statistics> >	statistics (
+									_statistics.begin ( ), _statistics.end ( ));
+	sort (statistics.begin ( ), statistics.end ( ),
+	      [] (const pair<string, Statistics>& s1, const pair<string, Statistics>& s2)
+	      { return s1.second.total > s2.second.total; });
+
+	ostringstream	summary;
+	summary << setw (12) << "Total (s)" << setw (10) << "Nombre"
+	        << setw (14) << "Moyenne (ms)" << setw (12) << "Min (ms)"
+	        << setw (12) << "Max (ms)" << "  Mesure" << endl;
+	summary << fixed;
+	for (vector< pair<string, Statistics> >::const_iterator its =
+			statistics.begin ( ); statistics.end ( ) != its; its++)
+	{
+		const Statistics&	s	= its->second;
+		summary << setw (12) << setprecision (3) << s.total
+		        << setw (10) << s.count
+		        << setw (14) << setprecision (3) << 1000. * s.total / s.count
+		        << setw (12) << setprecision (3) << 1000. * s.min
+		        << setw (12) << setprecision (3) << 1000. * s.max
+		        << "  " << its->first << endl;
+	}	// for (vector< pair<string, Statistics> >::const_iterator its = ...
+
+	if (false == _counters.empty ( ))
+	{
+		summary << endl << setw (12) << "Valeur" << "  Compteur" << endl;
+		summary << defaultfloat;
+		for (map<string, double>::const_iterator itc = _counters.begin ( );
+		     _counters.end ( ) != itc; itc++)
+			summary << setw (12) << itc->second << "  " << itc->first << endl;
+	}	// if (false == _counters.empty ( ))
+
+	return summary.str ( );
+}	// Profiler::getSummary
+
+
+string Profiler::typeName (const type_info& type)
+{
+	int		status		= 0;
+	char*	demangled	= abi::__cxa_demangle (type.name ( ), 0, 0, &status);
+	string	name (0 == demangled ? type.name ( ) : demangled);
+	free (demangled);
+
+	const string::size_type	pos	= name.rfind ("::");
+
+	return string::npos == pos ? name : name.substr (pos + 2);
+}	// Profiler::typeName
+
+
+unsigned long Profiler::threadId ( )
+{
+	static atomic<unsigned long>	next (1);
+	thread_local unsigned long		id	= next++;
+
+	return id;
+}	// Profiler::threadId
+
+}	// namespace Utils
+
+}	// namespace Mgx3D
@@ -3,6 +3,11 @@
 #include "Utils/Magix3DEvents.h"
 #include "Utils/Command.h"
 #include <TkUtil/MemoryError.h>
+#include <TkUtil/TraceLog.h>
+#include <TkUtil/UTF8String.h>
+
+#include <cstdlib>
+#include <unistd.h>	// getpid
 
 
 using namespace TkUtil;
@@ -14,7 +19,8 @@ namespace Utils {
 /*----------------------------------------------------------------------------*/
 UndoRedoManager::UndoRedoManager(const std::string& name)
 	: ReferencedObject ( ),
-	  m_name (name), m_done ( ), m_undone ( ), m_mutex (0), m_logStream (0)
+	  m_name (name), m_done ( ), m_undone ( ), m_mutex (0), m_logStream (0),
+	  m_memoryBudget (0), m_budgetPolicy (SPILL), m_spillDirectory ( )
 {
 	m_mutex	= new Mutex ( );
 }
@@ -54,6 +60,8 @@ void UndoRedoManager::store(Command* command)
 		registerObservable (cmd, true);
     m_done.push_back(command);
 
+	enforceMemoryBudget ( );
+
 	notifyObserversForModification (COMMAND_STACK);
 }
 /*----------------------------------------------------------------------------*/
@@ -150,6 +158,102 @@ Command* UndoRedoManager::redo()
     return c;
 }
 /*----------------------------------------------------------------------------*/
+void UndoRedoManager::setUndoMemoryBudget (
+			size_t bytes, BUDGET_POLICY policy, const std::string& spillDirectory)
+{
+	AutoMutex	autoMutex (mutex ( ));
+
+	m_memoryBudget		= bytes;
+	m_budgetPolicy		= policy;
+	m_spillDirectory	= spillDirectory;
+	if (true == m_spillDirectory.empty ( ))
+	{
+		const char*	tmpDir	= getenv ("TMPDIR");
+		m_spillDirectory	= 0 == tmpDir ? "/tmp" : tmpDir;
+	}	// if (true == m_spillDirectory.empty ( ))
+
+	enforceMemoryBudget ( );
+}	// UndoRedoManager::setUndoMemoryBudget
+/*----------------------------------------------------------------------------*/
+size_t UndoRedoManager::getUndoMemorySize ( ) const
+{
+	AutoMutex	autoMutex (mutex ( ));
+
+	size_t	size	= 0;
+	for (std::vector<Command*>::const_iterator itd = m_done.begin ( );
+	     itd != m_done.end ( ); itd++)
+		size	+= (*itd)->getUndoMemorySize ( );
+	for (std::vector<Command*>::const_iterator itud = m_undone.begin ( );
+	     itud != m_undone.end ( ); itud++)
+		size	+= (*itud)->getUndoMemorySize ( );
+
+	return size;
+}	// UndoRedoManager::getUndoMemorySize
+/*----------------------------------------------------------------------------*/
+void UndoRedoManager::enforceMemoryBudget ( )
+{
+	AutoMutex	autoMutex (mutex ( ));
+
+	if ((0 == m_memoryBudget) || (m_done.size ( ) < 2))
+		return;
+
+	size_t	size	= getUndoMemorySize ( );
+	if (size <= m_memoryBudget)
+		return;
+
+	// On parcourt les commandes de la plus ancienne à l'avant dernière, la
+	// dernière devant rester immédiatement annulable :
+	// Une commande n'est retirée qu'avec toutes celles qui la précèdent, la
+	// première qui ne peut pas l'être bloque donc le retrait des suivantes.
+	size_t	dropped		= 0;
+	bool	droppable	= true;
+	for (size_t i = 0; (i < m_done.size ( ) - 1) && (size > m_memoryBudget); i++)
+	{
+		Command*		cmd			= m_done [i];
+		const size_t	cmdSize		= cmd->getUndoMemorySize ( );
+		if (false == cmd->isDroppableFromUndoStack ( ))
+			droppable	= false;
+		if ((0 == cmdSize) || (true == cmd->isUndoDataSpilled ( )))
+			continue;
+
+		if (SPILL == m_budgetPolicy)
+		{
+			UTF8String	fileName (Charset::UTF_8);
+			fileName << m_spillDirectory << "/mgx3d_undo_" << (unsigned long)getpid ( )
+			         << "_" << cmd->getUniqueName ( ) << ".brep";
+			if (true == cmd->spillUndoData (fileName.utf8 ( )))
+			{
+				size	-= cmdSize - cmd->getUndoMemorySize ( );
+				continue;
+			}	// if (true == cmd->spillUndoData (fileName.utf8 ( )))
+		}	// if (SPILL == m_budgetPolicy)
+
+		if (false == droppable)
+			continue;
+
+		// La commande et toutes celles qui la précèdent ne sont plus annulables.
+		size	-= cmdSize;
+		for (size_t j = dropped; j < i; j++)
+			size	-= m_done [j]->getUndoMemorySize ( );
+		dropped	= i + 1;
+	}	// for (size_t i = 0; ...
+
+	if (0 != dropped)
+	{
+		std::vector<Command*>	oldCommands (m_done.begin ( ), m_done.begin ( ) + dropped);
+		m_done.erase (m_done.begin ( ), m_done.begin ( ) + dropped);
+		for (std::vector<Command*>::iterator iter = oldCommands.begin();
+		     iter != oldCommands.end(); ++iter)
+			unregisterObservable (*iter, true);
+
+		UTF8String	message (Charset::UTF_8);
+		message << "Budget mémoire de la pile d'annulation dépassé : "
+		        << (unsigned long)dropped
+		        << " commande(s) parmi les plus anciennes ne sont plus annulables.";
+		log (TraceLog (message, Log::WARNING));
+	}	// if (0 != dropped)
+}	// UndoRedoManager::enforceMemoryBudget
+/*----------------------------------------------------------------------------*/
 bool UndoRedoManager::hasCommand (Command* command)
 {
 	AutoMutex	autoMutex (mutex ( ));
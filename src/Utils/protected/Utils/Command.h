@@ -8,6 +8,7 @@
 #include <TkUtil/ReferencedObject.h>
 #include <TkUtil/Timer.h>
 /*----------------------------------------------------------------------------*/
+#include <condition_variable>
 #include <map>
 /*----------------------------------------------------------------------------*/
 namespace Mgx3D {
@@ -128,6 +129,18 @@ class Command : public TkUtil::ReferencedNamedObject
 	virtual bool isCompleted ( ) const
 	{ return _isCompleted; }
 
+	/**
+	 * Attend que la commande soit achevée (succès ou non), sans consommer de
+	 * temps processeur.
+	 * \param	Durée maximale d'attente, en millisecondes. 0 : attente sans
+	 *			limite.
+	 * \return	<I>true</I> si la commande est achevée, <I>false</I> si la
+	 *			durée d'attente est écoulée.
+	 * \see		isCompleted
+	 * \see		CommandManager::wait
+	 */
+	virtual bool waitFor (unsigned long milliseconds = 0);
+
 	/**
 	 * \return	L'état d'avancement de la commande, compris entre 0 et 1.
 	 * \see		getStatus
@@ -284,6 +297,57 @@ class Command : public TkUtil::ReferencedNamedObject
 	virtual bool threadable ( ) const
 	{ return false; }
 
+	/**
+	 * Les ressources (au sens gestionnaires de la session) lues ou modifiées
+	 * par une commande. Elles permettent au gestionnaire de commandes
+	 * d'exécuter simultanément des commandes indépendantes.
+	 * \see	getReadResources
+	 * \see	getWrittenResources
+	 */
+	enum RESOURCE
+	{
+		NO_RESOURCE		= 0,
+		GEOMETRY		= 1 << 0,
+		TOPOLOGY		= 1 << 1,
+		MESH			= 1 << 2,
+		GROUPS			= 1 << 3,
+		STRUCTURED_DATA	= 1 << 4,
+		SESSION			= 1 << 5,	// Noms, unités, repère, ...
+		ALL_RESOURCES	= 0xffff
+	};
+
+	/**
+	 * \return		Les ressources (combinaison de valeurs <I>RESOURCE</I>)
+	 *				lues par la commande lors de son exécution.
+	 *				Retourne <I>ALL_RESOURCES</I> par défaut.
+	 * \see		getWrittenResources
+	 * \see		isIndependent
+	 */
+	virtual unsigned long getReadResources ( ) const
+	{ return ALL_RESOURCES; }
+
+	/**
+	 * \return		Les ressources (combinaison de valeurs <I>RESOURCE</I>)
+	 *				modifiées par la commande lors de son exécution.
+	 *				Retourne <I>ALL_RESOURCES</I> par défaut. Une commande
+	 *				se limitant à écrire un fichier (export) retourne
+	 *				<I>NO_RESOURCE</I> et peut ainsi être exécutée en même
+	 *				temps que toute commande ne modifiant pas ce qu'elle lit.
+	 * \see		getReadResources
+	 * \see		isIndependent
+	 */
+	virtual unsigned long getWrittenResources ( ) const
+	{ return ALL_RESOURCES; }
+
+	/**
+	 * \return		<I>true</I> si la commande ne modifie aucune ressource
+	 *				accédée par la commande transmise en argument et
+	 *				réciproquement, <I>false</I> dans le cas contraire. Deux
+	 *				commandes indépendantes peuvent être exécutées
+	 *				simultanément.
+	 */
+	virtual bool isIndependent (const Command& command) const;
+
 	/**
 	 * \return		Eventuelle instance de la classe <I>CommandRunner</I> exécutant cette commande dans un autre thread. Mécanisme
 	 *				interne, à ne pas utiliser.
@@ -358,6 +422,55 @@ class Command : public TkUtil::ReferencedNamedObject
 	virtual unsigned long getEstimatedDuration (PLAY_TYPE playType = DO)
 	{ return 0; }
 
+	/**
+	 * Méthodes relatives à l'empreinte mémoire des données conservées par la
+	 * commande pour pouvoir être annulée/rejouée. Elles permettent au
+	 * gestionnaire d'annulation de respecter un budget mémoire.
+	 */
+	//@{
+	/**
+	 * \return		Une estimation, en octets, de la mémoire occupée par les
+	 *				données d'annulation/rejeu de la commande. 0 par défaut.
+	 */
+	virtual size_t getUndoMemorySize ( ) const
+	{ return 0; }
+
+	/**
+	 * Ecrit les données d'annulation/rejeu dans le fichier transmis en
+	 * argument et libère la mémoire correspondante.
+	 * \return		<I>true</I> si les données ont été déchargées,
+	 *				<I>false</I> si la commande ne sait pas le faire.
+	 * \see			restoreUndoData
+	 */
+	virtual bool spillUndoData (const std::string& fileName)
+	{ return false; }
+
+	/**
+	 * Recharge en mémoire les données préalablement déchargées par
+	 * <I>spillUndoData</I>. Ne fait rien si elles sont déjà en mémoire.
+	 */
+	virtual void restoreUndoData ( )
+	{ }
+
+	/**
+	 * \return		<I>true</I> si les données d'annulation/rejeu sont
+	 *				déchargées sur disque.
+	 */
+	virtual bool isUndoDataSpilled ( ) const
+	{ return false; }
+
+	/**
+	 * \return		<I>true</I> si la commande effectuée peut être retirée de
+	 *				la pile d'annulation et détruite sans modifier la session
+	 *				(elle n'est simplement plus annulable). Par défaut, seules
+	 *				les commandes sans données d'annulation le peuvent, celles
+	 *				qui savent décharger leurs données (cf. spillUndoData) le
+	 *				déclarent.
+	 */
+	virtual bool isDroppableFromUndoStack ( ) const
+	{ return 0 == getUndoMemorySize ( ); }
+	//@}
+
 	/**
 	 * <P>
 	 * Tâche éventuellement effectuée par la commande à un moment donné (exemple : en fin de commande, remise en service d'une partie des menus de l'IHM).
@@ -518,6 +631,10 @@ class Command : public TkUtil::ReferencedNamedObject
 	/** La commande est-elle achevée ? */
 	bool							_isCompleted;
 
+	/** Signale l'achèvement de la commande aux threads en attente
+	 * (<I>waitFor</I>). Utilisée avec <I>_commandMutex</I>. */
+	std::condition_variable_any		_completion;
+
 	/** Manière dont est jouée la commande. */
 	PLAY_TYPE						_playType;
 
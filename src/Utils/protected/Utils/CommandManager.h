@@ -14,8 +14,11 @@
 
 #include <TkUtil/ReferencedObject.h>
 
+#include <atomic>
+#include <condition_variable>
 #include <deque>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace TkUtil {
@@ -52,7 +55,9 @@ class CommandManager : public TkUtil::ReferencedNamedObject
 	 * Politique de fonctionnement du gestionnaire de commande :<BR>
 	 * <UL>
 	 * <LI><I>THREADED</I> : lancement possible de commandes dans des threads
-	 * dédiés,
+	 * dédiés. Des commandes indépendantes (cf. <I>Command::isIndependent</I>)
+	 * peuvent alors s'exécuter simultanément, une commande dépendant d'une
+	 * commande en cours étant mise en file d'attente,
 	 * <LI>SEQUENTIAL</I> : les tâches sont lancées séquentiellement. Si une
 	 * commande est soumise alors qu'une autre est en cours d'exécution, cette
 	 * nouvelle commande est mise en file d'attente. Les commandes en file
@@ -136,10 +141,13 @@ class CommandManager : public TkUtil::ReferencedNamedObject
 	 * </P>
 	 * <P>La commande peut être mise en file d'attente si le contexte interdit
 	 * son lancement immédiat (exemple : commande à exécution séquentielle alors
-	 * qu'une commande est déjà en cours d'exécution).
+	 * qu'une commande est déjà en cours d'exécution, commande à exécuter dans
+	 * un thread dédié dépendant d'une commande en cours ou en file d'attente).
+	 * Une commande à exécution séquentielle attend quant à elle l'achèvement
+	 * des seules commandes en cours dont elle dépend.
 	 * </P>
-	 * <P>En fin d'exécution invoque <I>runQueuedCommand</I> si aucune commande
-	 * n'est en cours d'exécution et qu'il y a des commandes en file d'attente.
+	 * <P>En fin d'exécution invoque <I>runQueuedCommand</I> s'il y a des
+	 * commandes en file d'attente.
 	 * </P>
 	 * \param	Commande prise en charge
 	 * \param	Type d'exécution à effectuer sur la commande, ou
@@ -198,9 +206,26 @@ class CommandManager : public TkUtil::ReferencedNamedObject
 	virtual void commandRunnerDeleted (CommandRunner* runner);
 
 	/**
-	 * Attend que toutes les commandes en cours soient achevées.
+	 * <P>A appeler par le lanceur, depuis son thread, une fois l'exécution
+	 * de sa commande achevée. Déréférence le lanceur, réveille les threads en
+	 * attente (<I>wait</I>) et lance si possible la commande suivante en file
+	 * d'attente.</P>
+	 * <P>Seules les commandes à exécuter dans un thread dédié sont lancées
+	 * ici, les autres le seront par <I>addCommand</I> ou
+	 * <I>processQueuedCommands</I>.</P>
 	 */
-	virtual void wait ( );
+	virtual void commandRunnerCompleted (CommandRunner* runner);
+
+	/**
+	 * Attend, sans consommer de temps processeur, que toutes les commandes en
+	 * cours d'exécution dans des threads dédiés soient achevées.
+	 * \param	Durée maximale d'attente, en millisecondes. 0 : attente sans
+	 *			limite.
+	 * \return	<I>true</I> si toutes les commandes sont achevées,
+	 *			<I>false</I> si la durée d'attente est écoulée.
+	 * \see		Command::waitFor
+	 */
+	virtual bool wait (unsigned long milliseconds = 0);
 
 	/**
 	 * \return		Le status courant, à savoir le status de la dernière
@@ -319,7 +344,8 @@ class CommandManager : public TkUtil::ReferencedNamedObject
 	 * selon la manière transmise en second argument.
 	 * </P>
 	 * <P>Cette méthode s'assure via mutex qu'aucune autre commande ne peut être
-	 * jouée pendant son exécution.
+	 * lancée pendant son exécution, et attend au préalable l'achèvement des
+	 * commandes en cours dont elle dépend (<I>isRunnable</I>).
 	 * </P>
 	 * \param		Commande à exécuter
 	 * \param		Manière d'exécution
@@ -340,12 +366,40 @@ class CommandManager : public TkUtil::ReferencedNamedObject
 	virtual void executeThreaded (Command* command, Command::PLAY_TYPE pt);
 
 	/**
-	 * Lance de manière séquentielle la commande la plus ancienne de la file
-	 * d'attente si les conditions le permettent.
+	 * Lance les commandes de la file d'attente dont les conditions permettent
+	 * l'exécution, dans leur ordre de soumission.
+	 * \see			popRunnableQueuedCommand
 	 * \see			executeSequential
+	 * \see			executeThreaded
 	 */
 	virtual void runQueuedCommand ( );
 
+	/**
+	 * Retire de la file d'attente et retourne la plus ancienne commande
+	 * exécutable (<I>isRunnable</I>) qui ne dépend d'aucune commande la
+	 * précédant dans la file.
+	 * \param		En retour, le type d'exécution de la commande.
+	 * \param		<I>false</I> si seules les commandes à exécuter dans un
+	 *				thread dédié peuvent être retournées.
+	 * \return		La commande retirée, ou 0.
+	 * \warning	<B>_runnersMutex et _queuingMutex ne doivent pas être
+	 *				verrouillés.</B>
+	 */
+	virtual Command* popRunnableQueuedCommand (
+						Command::PLAY_TYPE& pt, bool sequentialAllowed);
+
+	/**
+	 * \return	<I>true</I> si la commande peut être exécutée alors que les
+	 *			commandes des lanceurs en cours le sont, <I>false</I> dans le
+	 *			cas contraire. Seules les premières exécutions de commandes
+	 *			indépendantes (<I>Command::isIndependent</I>) peuvent être
+	 *			simultanées, hors politique <I>SEQUENTIAL</I> et en l'absence
+	 *			de commandes annulées (dont la destruction, lors de la prochaine
+	 *			exécution, modifie la session).
+	 * \warning	<B>_runnersMutex doit être verrouillé.</B>
+	 */
+	virtual bool isRunnable (Command* command, Command::PLAY_TYPE pt) const;
+
 	/**
 	 * Met la commande transmise en file d'attente. Si <I>pt</I>
 	 * vaut <I>Command::QUEUED</I> alors la commande ets mise en file
@@ -353,6 +407,13 @@ class CommandManager : public TkUtil::ReferencedNamedObject
 	 */
 	virtual void addToQueue (Command* command, Command::PLAY_TYPE pt);
 
+	/**
+	 * \return	<I>true</I> si la commande doit être exécutée dans un thread
+	 *			dédié selon la politique courante, <I>false</I> si elle doit
+	 *			l'être séquentiellement.
+	 */
+	virtual bool runInThread (Command* command, Command::PLAY_TYPE pt) const;
+
 	/**
 	 * Envoit le <I>log</I> transmis en argument dans le flux de messages
 	 * associé a l'instance.
@@ -369,13 +430,69 @@ class CommandManager : public TkUtil::ReferencedNamedObject
 	CommandManager (const CommandManager&);
 	CommandManager& operator = (const CommandManager&);
 
+	/**
+	 * Confie la commande à un nouveau lanceur et démarre ce dernier.
+	 * \warning	<B>_runnersMutex ne doit pas être verrouillé.</B>
+	 */
+	void startRunner (Command* command, Command::PLAY_TYPE pt);
+
+	/**
+	 * \return	Le lanceur référencé exécutant la commande transmise en
+	 *			argument, ou 0.
+	 * \warning	<B>_runnersMutex doit être verrouillé.</B>
+	 */
+	CommandRunner* findRunner (Command* command) const;
+
+	/**
+	 * Déréférence le lanceur, le retire de sa commande et réveille les
+	 * threads en attente.
+	 * \return	<I>true</I> si le lanceur était référencé.
+	 * \warning	<B>_runnersMutex doit être verrouillé.</B>
+	 */
+	bool removeRunner (CommandRunner* runner);
+
+	/**
+	 * \return	<I>true</I> si la commande peut être lancée dès à présent :
+	 *			elle est exécutable et ne dépend d'aucune commande en file
+	 *			d'attente.
+	 * \warning	<B>_runnersMutex et _queuingMutex ne doivent pas être
+	 *				verrouillés.</B>
+	 */
+	bool canStartNow (Command* command, Command::PLAY_TYPE pt) const;
+
+	/**
+	 * Attend, sans consommer de temps processeur, l'achèvement des commandes
+	 * en cours dont dépend la commande transmise en argument.
+	 * \see	isRunnable
+	 */
+	void waitForConflictingCommands (Command* command, Command::PLAY_TYPE pt);
+
+	/**
+	 * Confie au gestionnaire de <I>undo/redo</I> la commande achevée transmise
+	 * en argument, si elle l'a été avec succès, en respectant l'ordre de
+	 * soumission des commandes exécutées simultanément : elle n'y est confiée
+	 * qu'une fois les commandes soumises avant elle achevées.
+	 */
+	void storeCompletedCommands (Command* command);
+
+	/**
+	 * Retire la commande transmise en argument de la liste des commandes en
+	 * attente de stockage dans le gestionnaire de <I>undo/redo</I>.
+	 * \warning	<B>_runnersMutex doit être verrouillé.</B>
+	 */
+	void removeFromUndoOrder (Command* command);
+
 	/** Les commandes en cours d'exécution. */
-	std::vector <CommandRunner*>		_runners;
+	std::unordered_set <CommandRunner*>	_runners;
 
 	/** Un mutex non récursif pour protéger la liste des commandes en cours
 	 * d'exécution. */
 	mutable TkUtil::Mutex				_runnersMutex;
 
+	/** Signale le déréférencement des lanceurs (<I>wait</I>). Utilisée avec
+	 * <I>_runnersMutex</I>. */
+	std::condition_variable_any			_runnersCondition;
+
 	/** Les observateurs de commandes. */
 	std::vector <TkUtil::ObjectBase*>	_commandObservers;
 
@@ -399,6 +516,16 @@ class CommandManager : public TkUtil::ReferencedNamedObject
 	 * ajoutées à la fin. Elle sont dépilées par le début => FIFO. */
 	std::deque< std::pair <Command*, Command::PLAY_TYPE> >	_queuedCommands;
 
+	/** Les commandes soumises pour une première exécution dont le stockage
+	 * dans le gestionnaire de <I>undo/redo</I> est en attente, par ordre de
+	 * soumission. Protégée par <I>_runnersMutex</I>. */
+	std::deque<Command*>				_undoOrder;
+
+	/** <I>true</I> si une passe de lancement des commandes en file d'attente
+	 * a été demandée alors qu'elle ne pouvait être effectuée
+	 * (<I>_sequentialMutex</I> verrouillé). */
+	std::atomic<bool>					_dispatchRequested;
+
 	/** La politique d'exécution des commandes. */
 	CommandManager::POLICY			_policy;
 
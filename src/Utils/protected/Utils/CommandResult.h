@@ -89,6 +89,17 @@ class CommandResult : public TkUtil::ObjectBase
 	 * \see		getStrStatus
 	 */
 	virtual TkUtil::UTF8String getErrorMessage ( ) const;
+
+	/**
+	 * Attend l'achèvement de la commande associée.
+	 * \param	Durée maximale d'attente, en millisecondes. 0 : attente sans
+	 *			limite.
+	 * \return	<I>true</I> si la commande est achevée, <I>false</I> si la
+	 *			durée d'attente est écoulée.
+	 * \except	Lève une exception en l'absence de commande (ex : détruite).
+	 * \see		Command::waitFor
+	 */
+	virtual bool waitFor (unsigned long milliseconds = 0);
 	
 #ifndef SWIG
 	/**
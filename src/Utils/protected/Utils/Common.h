@@ -69,6 +69,29 @@ TkUtil::TraceLog	name (TkUtil::UTF8String (text, TkUtil::Charset::UTF_8), TkUtil
 #define MGX_TRACE_LOG_5(name, text)                                              \
 TkUtil::TraceLog	name (TkUtil::UTF8String (text, TkUtil::Charset::UTF_8), TkUtil::Log::TRACE_5, TkUtil::UTF8String (__FILE__, TkUtil::Charset::UTF_8), __LINE__);
 
+/**
+ * Macros de traces dont le message n'est formaté que si le niveau de trace
+ * est affiché par le flux de logs (le masque du flux est testé avant).
+ * Exemple :
+ * MGX_TRACE (getLogStream ( ), TkUtil::Log::TRACE_4, "TopoManager::newEdge(" << v1->getName ( ) << ")");
+ * @param		stream est le flux de logs (TkUtil::LogOutputStream*, éventuellement nul)
+ * @param		type est le niveau de trace souhaité
+ * @param		text est le message, sous forme d'une suite d'opérandes de <<
+ */
+#define MGX_TRACE_ENABLED(stream, type)                                          \
+((0 != (stream)) && (0 != ((stream)->getMask ( ) & (type))))
+
+#define MGX_TRACE(stream, type, text)                                            \
+do {                                                                             \
+	TkUtil::LogOutputStream*	mgx_trace_stream	= (stream);                      \
+	if (MGX_TRACE_ENABLED (mgx_trace_stream, type))                              \
+	{                                                                            \
+		TkUtil::UTF8String	mgx_trace_message (TkUtil::Charset::UTF_8);          \
+		mgx_trace_message << text;                                               \
+		mgx_trace_stream->log (TkUtil::TraceLog (mgx_trace_message, type));      \
+	}                                                                            \
+} while (false)
+
 
 /*----------------------------------------------------------------------------*/
 } // end namespace Mgx3D
@@ -0,0 +1,199 @@
+/*----------------------------------------------------------------------------*/
+/** \file		Profiler.h
+ *  \date		19/10/2026
+ */
+/*----------------------------------------------------------------------------*/
+
+#ifndef UTILS_PROFILER_H
+#define UTILS_PROFILER_H
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+
+namespace Mgx3D
+{
+
+namespace Utils
+{
+
+/**
+ * <P>Profileur à faible surcoût des commandes et des principaux algorithmes.
+ * Les durées sont mesurées par des chronomètres de portée
+ * (<I>ScopedTimer</I>, macro <I>MGX_PROFILE_SCOPE</I>) et des compteurs
+ * (macro <I>MGX_PROFILE_COUNT</I>), agrégés par nom (ex :
+ * <I>CommandNewBox/internalExecute</I>).</P>
+ *
+ * <P>Inactif par défaut : un chronomètre se limite alors à la lecture d'un
+ * booléen atomique. Actif, chaque mesure est conservée (dans la limite de
+ * <I>maxEvents</I>) pour être exportée au format <I>Chrome/Perfetto</I>
+ * (<I>writeChromeTrace</I>), et agrégée dans un tableau récapitulatif
+ * (<I>getSummary</I>).</P>
+ */
+class Profiler
+{
+	public :
+
+	/**
+	 * Chronomètre mesurant la durée de vie de l'instance. Ne fait rien si le
+	 * profileur est inactif lors de sa construction.
+	 */
+	class ScopedTimer
+	{
+		public :
+
+		/**
+		 * \param	Nom de la mesure. Doit rester valide durant la vie de
+		 *			l'instance.
+		 * \param	Eventuelle catégorie (ex : type de commande), préfixe du nom
+		 *			dans les agrégats.
+		 */
+		ScopedTimer (const char* name, const std::string& category = std::string ( ));
+		ScopedTimer (const char* name, const std::type_info& category);
+
+		/**
+		 * Enregistre la mesure auprès du profileur.
+		 */
+		~ScopedTimer ( );
+
+
+		private :
+
+		ScopedTimer (const ScopedTimer&);
+		ScopedTimer& operator = (const ScopedTimer&);
+
+		const char*								_name;
+		std::string								_category;
+		const std::type_info*					_type;
+		bool									_enabled;
+		std::chrono::steady_clock::time_point	_start;
+	};	// class ScopedTimer
+
+	/**
+	 * \return		L'instance unique du profileur.
+	 */
+	static Profiler& instance ( );
+
+	/**
+	 * \return		<I>true</I> si le profileur est actif.
+	 */
+	static bool isEnabled ( )
+	{ return _enabled.load (std::memory_order_relaxed); }
+
+	/**
+	 * Active ou désactive le profileur. Les mesures déjà effectuées sont
+	 * conservées.
+	 * \see		reset
+	 */
+	void setEnabled (bool enabled);
+
+	/**
+	 * Oublie les mesures effectuées. La date de début des traces devient la
+	 * date courante.
+	 */
+	void reset ( );
+
+	/**
+	 * Enregistre une mesure.
+	 */
+	void addEvent (const char* name, const std::string& category,
+	               const std::chrono::steady_clock::time_point& start,
+	               const std::chrono::steady_clock::time_point& end);
+
+	/**
+	 * Ajoute <I>value</I> au compteur de nom <I>name</I>.
+	 */
+	void count (const char* name, double value = 1.);
+
+	/**
+	 * Ecrit les mesures dans le fichier transmis en argument, au format JSON
+	 * <I>Trace Event</I> lu par <I>chrome://tracing</I> et <I>Perfetto</I>.
+	 * \exception	Une exception est levée en cas d'erreur d'écriture.
+	 */
+	void writeChromeTrace (const std::string& fileName) const;
+
+	/**
+	 * \return		Un tableau récapitulatif des mesures agrégées, par durée
+	 *				totale décroissante, et des compteurs.
+	 */
+	std::string getSummary ( ) const;
+
+	/**
+	 * \return		Le nom (non décoré) du type transmis en argument, sans
+	 *				espaces de noms.
+	 */
+	static std::string typeName (const std::type_info& type);
+
+	/** Nombre maximum de mesures conservées pour la trace, au delà elles sont
+	 * seulement agrégées. */
+	static size_t					maxEvents;
+
+
+	private :
+
+	Profiler ( );
+	Profiler (const Profiler&);
+	Profiler& operator = (const Profiler&);
+
+	/** Une mesure. Les dates sont en microsecondes depuis <I>_origin</I>. */
+	struct Event
+	{
+		std::string		name, category;
+		unsigned long	thread;
+		long long		start, duration;
+	};	// struct Event
+
+	/** Mesures agrégées, en secondes. */
+	struct Statistics
+	{
+		Statistics ( )
+			: count (0), total (0.), min (0.), max (0.)
+		{ }
+		size_t			count;
+		double			total, min, max;
+	};	// struct Statistics
+
+	/** \return		L'identifiant (séquentiel) du thread courant. */
+	static unsigned long threadId ( );
+
+	static std::atomic<bool>				_enabled;
+	mutable std::mutex						_mutex;
+	std::chrono::steady_clock::time_point	_origin;
+	std::vector<Event>						_events;
+	std::map<std::string, Statistics>		_statistics;
+	std::map<std::string, double>			_counters;
+};	// class Profiler
+
+}	// namespace Utils
+
+}	// namespace Mgx3D
+
+
+#define MGX_PROFILE_CONCAT_(a, b) a##b
+#define MGX_PROFILE_CONCAT(a, b) MGX_PROFILE_CONCAT_(a, b)
+
+/**
+ * Mesure la durée du bloc d'instructions courant sous le nom <I>name</I>
+ * (chaîne de caractères littérale) et l'éventuelle catégorie transmise.
+ */
+#define MGX_PROFILE_SCOPE(...)                                                \
+	Mgx3D::Utils::Profiler::ScopedTimer                                       \
+		MGX_PROFILE_CONCAT(mgxProfileTimer_, __LINE__) (__VA_ARGS__);
+
+/**
+ * Incrémente le compteur <I>name</I> de <I>value</I> si le profileur est
+ * actif.
+ */
+#define MGX_PROFILE_COUNT(name, value)                                        \
+	{                                                                         \
+	if (true == Mgx3D::Utils::Profiler::isEnabled ( ))                        \
+		Mgx3D::Utils::Profiler::instance ( ).count (name, value);             \
+	}
+
+
+#endif	// UTILS_PROFILER_H
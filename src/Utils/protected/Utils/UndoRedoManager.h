@@ -108,6 +108,45 @@ public:
      */
     virtual Command* redo();
 
+	/**
+	 * Méthodes relatives au budget mémoire de la pile d'annulation.
+	 */
+	//@{
+	/** Comportement lorsque le budget mémoire est dépassé. */
+	enum BUDGET_POLICY {
+		/** Les données d'annulation des commandes les plus anciennes sont
+		 * écrites sur disque et rechargées à la demande. */
+		SPILL,
+		/** Les commandes les plus anciennes sont retirées de la pile (elles
+		 * ne peuvent plus être annulées). */
+		DROP
+	};
+
+	/**
+	 * \param	Budget mémoire, en octets, des données d'annulation de
+	 *			l'ensemble des commandes effectuées. 0 : pas de limite (défaut).
+	 * \param	Comportement en cas de dépassement.
+	 * \param	Répertoire (local) recevant les fichiers de déchargement.
+	 *			Si vide, le répertoire temporaire du système est utilisé.
+	 */
+	virtual void setUndoMemoryBudget (
+				size_t bytes, BUDGET_POLICY policy = SPILL,
+				const std::string& spillDirectory = std::string ( ));
+
+	/**
+	 * \return	Le budget mémoire de la pile d'annulation, en octets.
+	 */
+	virtual size_t getUndoMemoryBudget ( ) const
+	{ return m_memoryBudget; }
+
+	/**
+	 * \return	Une estimation, en octets, de la mémoire occupée par les
+	 *			données d'annulation des commandes (effectuées et annulées)
+	 *			qui ne sont pas déchargées sur disque.
+	 */
+	virtual size_t getUndoMemorySize ( ) const;
+	//@}
+
 	/**
 	 * Méthodes relatives à l'affichage d'informations relatives à l'instance
 	 * dans des flux.
@@ -151,6 +190,15 @@ public:
 	 */
 	virtual void log (const TkUtil::Log& log);
 
+	/**
+	 * Décharge sur disque, ou retire de la pile, les commandes effectuées les
+	 * plus anciennes jusqu'à ce que le budget mémoire soit respecté. La
+	 * dernière commande effectuée n'est jamais concernée, et une commande
+	 * n'est retirée que si elle et celles qui la précèdent le permettent
+	 * (cf. Command::isDroppableFromUndoStack).
+	 */
+	virtual void enforceMemoryBudget ( );
+
 
 private:
 
@@ -164,6 +212,12 @@ private:
 	mutable TkUtil::Mutex*				m_mutex;
 	/** L'éventuel afficheur. */
 	TkUtil::LogOutputStream*			m_logStream;
+	/** Budget mémoire de la pile d'annulation (0 : sans limite). */
+	size_t								m_memoryBudget;
+	/** Comportement en cas de dépassement du budget. */
+	BUDGET_POLICY						m_budgetPolicy;
+	/** Répertoire des fichiers de déchargement. */
+	std::string							m_spillDirectory;
 
 };
 /*----------------------------------------------------------------------------*/
@@ -18,6 +18,7 @@ using std::ptrdiff_t;
 #include "Internal/Context.h"
 #include "Internal/M3DCommandManager.h"
 #include "Internal/M3DCommandResult.h"
+#include "Utils/CommandManager.h"
 #include "Utils/Point.h"
 #include "Utils/Spherical.h"
 #include "Utils/Cylindrical.h"
@@ -159,6 +160,16 @@ using std::ptrdiff_t;
 
 %typemap(in) std::vector<Mgx3D::Utils::Math::Point>& { 
   //std::cout<<"on entre dans typemap(in) pour vector<Point>"<<std::endl;
+  // Tableau contigu de réels (numpy.ndarray de forme (n, 3), array.array('d'), memoryview, ...) :
+  // lecture directe via le protocole buffer, sans passer par des objets Point
+  if (!PyList_Check($input) && PyObject_CheckBuffer($input)) {
+    $1 = new std::vector<Mgx3D::Utils::Math::Point>();
+    if (0 != pyMagix3DBufferToPoints($input, *$1)) {
+      delete $1;
+      return NULL;
+    }
+  }
+  else {
   if (!PyList_Check($input)) {
     PyErr_SetString(PyExc_TypeError, "On attendait une liste");
     return NULL;
@@ -192,12 +203,98 @@ using std::ptrdiff_t;
     }
       
   }
+  }	// else if (!PyList_Check($input) && PyObject_CheckBuffer($input))
 }
 
 %typemap(freearg) std::vector<Mgx3D::Utils::Math::Point>& {
   delete ($1);
 }
 
+// -------------------------------
+// Accès en bloc aux tableaux de réels et d'entiers : les données sont recopiées
+// une seule fois dans un bytearray et retournées sous forme de memoryview typé
+// ('d' pour les réels, 'q' pour les entiers). numpy.asarray (mv) l'utilise
+// alors sans recopie, et sans créer d'objet python par valeur.
+
+%{
+static PyObject* pyMagix3DToMemoryView (const void* data, size_t count, size_t itemSize, const char* format, Py_ssize_t nbColumns)
+{
+	if ((0 == count) && (1 < nbColumns))
+	{	// memoryview.cast refuse une dimension nulle : vue (0, nbColumns)
+		// construite directement. Le format (chaîne littérale) n'est pas
+		// recopié, et buf ne doit pas être nul bien que vide.
+		static char	empty	= 0;
+		Py_ssize_t	shape [2]	= {0, nbColumns};
+		Py_ssize_t	strides [2]	= {(Py_ssize_t)(nbColumns * itemSize), (Py_ssize_t)itemSize};
+		Py_buffer	view;
+		memset (&view, 0, sizeof (view));
+		view.buf		= &empty;
+		view.len		= 0;
+		view.itemsize	= (Py_ssize_t)itemSize;
+		view.readonly	= 1;
+		view.ndim		= 2;
+		view.format		= (char*)format;
+		view.shape		= shape;
+		view.strides	= strides;
+		return PyMemoryView_FromBuffer (&view);
+	}
+	PyObject*	bytes	= PyByteArray_FromStringAndSize ((const char*)data, (Py_ssize_t)(count * itemSize));
+	if (0 == bytes)
+		return 0;
+	PyObject*	raw		= PyMemoryView_FromObject (bytes);
+	Py_DECREF (bytes);	// Référencé par raw
+	if (0 == raw)
+		return 0;
+	PyObject*	typed	= 0;
+	if ((1 < nbColumns) && (0 == count % nbColumns))
+	{
+		PyObject*	shape	= Py_BuildValue ("(nn)", (Py_ssize_t)(count / nbColumns), nbColumns);
+		typed	= PyObject_CallMethod (raw, "cast", "sO", format, shape);
+		Py_XDECREF (shape);
+	}
+	else
+		typed	= PyObject_CallMethod (raw, "cast", "s", format);
+	Py_DECREF (raw);
+	return typed;
+}	// pyMagix3DToMemoryView
+
+static PyObject* pyMagix3DToMemoryView (const std::vector<double>& values, Py_ssize_t nbColumns)
+{
+	return pyMagix3DToMemoryView (values.data ( ), values.size ( ), sizeof (double), "d", nbColumns);
+}	// pyMagix3DToMemoryView
+
+static PyObject* pyMagix3DToMemoryView (const std::vector<long>& values)
+{
+	std::vector<long long>	values64 (values.begin ( ), values.end ( ));
+	return pyMagix3DToMemoryView (values64.data ( ), values64.size ( ), sizeof (long long), "q", 1);
+}	// pyMagix3DToMemoryView
+
+// Lecture d'un tableau contigu de réels (x0, y0, z0, x1, ...) via le protocole
+// buffer. Retourne 0 en cas de succès, -1 (avec une exception python) sinon.
+static int pyMagix3DBufferToPoints (PyObject* obj, std::vector<Mgx3D::Utils::Math::Point>& points)
+{
+	Py_buffer	view;
+	if (0 != PyObject_GetBuffer (obj, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT))
+		return -1;
+	int	status	= 0;
+	if ((0 == view.format) || (0 != strcmp (view.format, "d")) || (0 != (view.len / view.itemsize) % 3))
+	{
+		PyErr_SetString (PyExc_ValueError, "Erreur, on attendait un tableau contigu de réels en double précision (3 coordonnées par point)");
+		status	= -1;
+	}
+	else
+	{
+		const double*	coords	= (const double*)view.buf;
+		const size_t	nb		= (size_t)(view.len / view.itemsize) / 3;
+		points.resize (nb);
+		for (size_t i = 0; i < nb; i++)
+			points [i]	= Mgx3D::Utils::Math::Point (coords [3*i], coords [3*i+1], coords [3*i+2]);
+	}
+	PyBuffer_Release (&view);
+	return status;
+}	// pyMagix3DBufferToPoints
+%}
+
 // -------------------------------
 
 %typemap(out) std::vector<std::vector<std::string> > {
@@ -359,6 +456,96 @@ using std::ptrdiff_t;
 	return &temp[0];
   }
 }
+// Accès en bloc au maillage et à la topologie (cf. pyMagix3DToMemoryView)
+%extend Mgx3D::Mesh::MeshManager {
+  /// Coordonnées des noeuds d'une Surface (dim 2) ou d'un Volume (dim 3) : memoryview de forme (n, 3)
+  PyObject* getNodesCoordinatesArray (const std::string& name, int dim) {
+    std::vector<double>	coords;
+    std::vector<long>	cells;
+    $self->getNodesAndCells (name, dim, coords, cells);
+    return pyMagix3DToMemoryView (coords, 3);
+  }
+  /** Mailles d'une Surface (dim 2) ou d'un Volume (dim 3) : pour chaque maille le nombre de noeuds
+   *  suivi de leurs indices dans getNodesCoordinatesArray */
+  PyObject* getCellsArray (const std::string& name, int dim) {
+    std::vector<double>	coords;
+    std::vector<long>	cells;
+    $self->getNodesAndCells (name, dim, coords, cells);
+    return pyMagix3DToMemoryView (cells);
+  }
+  /// Identifiants GMDS des noeuds de getNodesCoordinatesArray
+  PyObject* getNodesIdsArray (const std::string& name, int dim) {
+    std::vector<double>	coords;
+    std::vector<long>	cells, ids;
+    $self->getNodesAndCells (name, dim, coords, cells, &ids);
+    return pyMagix3DToMemoryView (ids);
+  }
+}
+%extend Mgx3D::Topo::TopoManager {
+  /// Coordonnées de tous les sommets, dans l'ordre de getVertices () : memoryview de forme (n, 3)
+  PyObject* getVerticesCoordinatesArray ( ) {
+    std::vector<double>	coords;
+    $self->getVerticesCoordinates (coords);
+    return pyMagix3DToMemoryView (coords, 3);
+  }
+  /** Sommets de tous les blocs, dans l'ordre de getBlocks () : pour chaque bloc le nombre de sommets
+   *  suivi de leurs indices dans getVertices () */
+  PyObject* getBlocksVerticesArray ( ) {
+    std::vector<long>	indices;
+    $self->getBlocksVerticesIndices (indices);
+    return pyMagix3DToMemoryView (indices);
+  }
+  /** Aperçu de splitBlocks calculé sans modifier la topologie : extrémités des segments de la
+   *  coupe, rangées par paires, memoryview de forme (2n, 3) */
+  PyObject* getSplitBlocksPreviewArray (std::vector<std::string>& blocs_names, std::string narete, double ratio) {
+    std::vector<double>	coords;
+    $self->getSplitBlocksPreview (blocs_names, narete, ratio, coords);
+    return pyMagix3DToMemoryView (coords, 3);
+  }
+}
+// Exécution des commandes dans des threads dédiés (tests de l'exécution simultanée de commandes)
+%extend Mgx3D::Internal::Context {
+  /** Durée estimée (en secondes) à partir de laquelle une commande est exécutée dans un thread
+   *  dédié, retourne la précédente (cf. Utils::CommandManager::sequentialDuration) */
+  unsigned long setCommandsSequentialDuration (unsigned long duration) {
+    unsigned long	previous	= Mgx3D::Utils::CommandManager::sequentialDuration;
+    Mgx3D::Utils::CommandManager::sequentialDuration	= duration;
+    return previous;
+  }
+  /// true si des commandes sont en file d'attente
+  bool hasQueuedCommands ( ) {
+    return $self->getCommandManager ( ).hasQueuedCommands ( );
+  }
+}
+// Coût des traces inutilisées (cf. benchmarks/)
+%{
+/// contexte en cours de setUnusedTracesFormatting (true) et ses masques d'avant l'activation
+static Mgx3D::Internal::Context*	pyMagix3DUnusedTracesContext	= 0;
+static TkUtil::Log::TYPE			pyMagix3DSavedDispatcherMask	= 0;
+static TkUtil::Log::TYPE			pyMagix3DSavedStdoutMask		= 0;
+%}
+%extend Mgx3D::Internal::Context {
+  /** Force (true) la construction des traces TRACE_1 à TRACE_5 sans les afficher : les messages
+   *  sont formatés puis écartés par la sortie standard, comme avant le test du niveau fait par
+   *  MGX_TRACE. false rétablit les masques d'avant l'activation. */
+  void setUnusedTracesFormatting (bool enable) {
+    const TkUtil::Log::TYPE	traces	= TkUtil::Log::TRACE_1 | TkUtil::Log::TRACE_2 |
+        TkUtil::Log::TRACE_3 | TkUtil::Log::TRACE_4 | TkUtil::Log::TRACE_5;
+    TkUtil::OstreamLogOutputStream&	stdoutStream	= $self->getStdLogStream ( );
+    if ((true == enable) && (0 == pyMagix3DUnusedTracesContext)) {
+      pyMagix3DUnusedTracesContext	= $self;
+      pyMagix3DSavedDispatcherMask	= $self->getLogDispatcher ( ).getMask ( );
+      pyMagix3DSavedStdoutMask		= stdoutStream.getMask ( );
+      $self->getLogDispatcher ( ).setMask (pyMagix3DSavedDispatcherMask | traces);
+      stdoutStream.setMask (pyMagix3DSavedStdoutMask & ~traces);
+    }
+    else if ((false == enable) && ($self == pyMagix3DUnusedTracesContext)) {
+      $self->getLogDispatcher ( ).setMask (pyMagix3DSavedDispatcherMask);
+      stdoutStream.setMask (pyMagix3DSavedStdoutMask);
+      pyMagix3DUnusedTracesContext	= 0;
+    }
+  }
+}
 %extend Mgx3D::Utils::Math::Cylindrical {
   char *__str__() {
     static char temp[256];
@@ -0,0 +1,84 @@
+import array
+import pyMagix3D as Mgx3D
+
+def test_mesh_bulk_arrays(capfd):
+    ctx = Mgx3D.getStdContext()
+    ctx.clearSession() # Clean the session after the previous test
+    tm = ctx.getTopoManager()
+    mm = ctx.getMeshManager()
+
+    # Création d'une boite avec une topologie
+    tm.newBoxWithTopo (Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 2, 3), 4, 5, 6, "B")
+    mm.newAllBlocksMesh()
+
+    coords = mm.getNodesCoordinatesArray("B", 3)
+    cells = mm.getCellsArray("B", 3)
+    ids = mm.getNodesIdsArray("B", 3)
+    assert coords.format == 'd'
+    assert coords.shape == (5*6*7, 3)
+    assert len(ids) == 5*6*7
+    assert cells.format == 'q'
+    # 8 noeuds par hexaèdre, précédés de leur nombre
+    assert len(cells) == 4*5*6*9
+    assert all(cells[i] == 8 for i in range(0, len(cells), 9))
+    assert max(cells[i] for i in range(len(cells)) if i%9) == 5*6*7-1
+    xs = [coords[i, 0] for i in range(coords.shape[0])]
+    zs = [coords[i, 2] for i in range(coords.shape[0])]
+    assert min(xs) == 0. and max(xs) == 1.
+    assert min(zs) == 0. and max(zs) == 3.
+
+    out, err = capfd.readouterr()
+    assert len(err) == 0
+
+def test_topo_bulk_arrays(capfd):
+    ctx = Mgx3D.getStdContext()
+    ctx.clearSession() # Clean the session after the previous test
+    tm = ctx.getTopoManager()
+
+    tm.newBoxWithTopo (Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), 10, 10, 10)
+    tm.splitBlock ("Bl0000", "Ar0000", .5)
+
+    vertices = tm.getVertices()
+    coords = tm.getVerticesCoordinatesArray()
+    assert coords.shape == (len(vertices), 3)
+    for i, v in enumerate(vertices):
+        pt = tm.getCoord(v)
+        assert coords[i, 0] == pt.getX() and coords[i, 1] == pt.getY() and coords[i, 2] == pt.getZ()
+
+    corners = tm.getBlocksVerticesArray()
+    assert len(corners) == 9*tm.getNbBlocks()
+    assert corners[0] == 8
+
+    # déplacement en bloc de tous les sommets, à partir d'un tableau contigu
+    flat = coords.cast('B').cast('d')
+    moved = array.array('d', [c + 1. for c in flat])
+    tm.setVerticesCoordinates(vertices, moved)
+    for i, v in enumerate(vertices):
+        assert tm.getCoord(v).getX() == coords[i, 0] + 1.
+
+    # puis à partir d'une liste de points, comme dans le script, et annulation
+    tm.setVerticesCoordinates(vertices[:1], [Mgx3D.Point(-1, -1, -1)])
+    assert tm.getCoord(vertices[0]).getX() == -1.
+    ctx.undo()
+    ctx.undo()
+    assert tm.getCoord(vertices[0]).getX() == coords[0, 0]
+
+    out, err = capfd.readouterr()
+    assert len(err) == 0
+
+def test_empty_bulk_arrays(capfd):
+    ctx = Mgx3D.getStdContext()
+    ctx.clearSession() # Clean the session after the previous test
+    tm = ctx.getTopoManager()
+
+    # session vide : tableaux vides, de même forme que dans le cas général
+    coords = tm.getVerticesCoordinatesArray()
+    assert coords.format == 'd'
+    assert coords.shape == (0, 3)
+    assert len(coords) == 0
+    corners = tm.getBlocksVerticesArray()
+    assert corners.format == 'q'
+    assert len(corners) == 0
+
+    out, err = capfd.readouterr()
+    assert len(err) == 0
@@ -0,0 +1,64 @@
+import pyMagix3D as Mgx3D
+
+def completed(result):
+    return result.getStatus() in (Mgx3D.Command.DONE, Mgx3D.Command.CANCELED, Mgx3D.Command.FAIL)
+
+def test_independent_commands_dispatch():
+    ctx = Mgx3D.getStdContext()
+    ctx.clearSession() # Clean the session after the previous test
+    m3d = ctx.getM3DCommandManager()
+
+    # Toute commande threadable est exécutée dans un thread dédié
+    duration = ctx.setCommandsSequentialDuration(0)
+    try:
+        long1 = m3d.newLongCommand(Mgx3D.Command.NO_RESOURCE)
+        # Indépendante de la commande en cours : lancée sans attendre
+        long2 = m3d.newLongCommand(Mgx3D.Command.NO_RESOURCE)
+        assert ctx.hasQueuedCommands() == False
+        # Dépendante de toute commande : mise en file d'attente
+        long3 = m3d.newLongCommand(Mgx3D.Command.ALL_RESOURCES)
+        assert ctx.hasQueuedCommands() == True
+        # Indépendante des commandes en cours mais pas de long3 qui la
+        # précède dans la file : mise en file d'attente, et ne double pas long3
+        long4 = m3d.newLongCommand(Mgx3D.Command.GEOMETRY)
+        assert ctx.hasQueuedCommands() == True
+        while True:
+            # état de long4 lu avant celui de long3
+            status4 = long4.getStatus()
+            if completed(long3):
+                break
+            assert status4 == Mgx3D.Command.INITED
+            long3.waitFor(10)
+        for result in (long1, long2, long3, long4):
+            assert result.waitFor() == True
+            assert result.getStatus() == Mgx3D.Command.DONE
+        assert ctx.hasQueuedCommands() == False
+    finally:
+        ctx.setCommandsSequentialDuration(duration)
+
+def test_independent_commands_undo_order():
+    ctx = Mgx3D.getStdContext()
+    ctx.clearSession() # Clean the session after the previous test
+    tm = ctx.getTopoManager()
+    mm = ctx.getMeshManager()
+    m3d = ctx.getM3DCommandManager()
+
+    tm.newBoxWithTopo (Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), 10, 10, 10)
+    duration = ctx.setCommandsSequentialDuration(0)
+    try:
+        # Le maillage, indépendant de la longue commande, s'achève avant elle
+        long1 = m3d.newLongCommand(Mgx3D.Command.NO_RESOURCE)
+        mesh = mm.newAllBlocksMesh()
+        assert mesh.waitFor() == True
+        assert long1.waitFor() == True
+        assert mm.getNbRegions() == 1000
+    finally:
+        ctx.setCommandsSequentialDuration(duration)
+
+    # Les commandes sont annulées dans l'ordre inverse de leur soumission
+    ctx.undo()
+    assert mm.getNbRegions() == 0
+    ctx.undo()
+    assert tm.getNbBlocks() == 1
+    ctx.undo()
+    assert tm.getNbBlocks() == 0
@@ -0,0 +1,17 @@
+import pyMagix3D as Mgx3D
+
+def test_command_wait_for():
+    ctx = Mgx3D.getStdContext()
+    ctx.clearSession() # Clean the session after the previous test
+    tm = ctx.getTopoManager()
+    mm = ctx.getMeshManager()
+
+    # Création d'une boite avec une topologie
+    result = tm.newBoxWithTopo (Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), 10, 10, 10)
+    # Une commande achevée ne bloque pas, avec ou sans délai
+    assert result.waitFor() == True
+    assert result.waitFor(100) == True
+    # Création du maillage, éventuellement dans un thread dédié
+    result = mm.newAllBlocksMesh()
+    assert result.waitFor() == True
+    assert mm.getNbRegions() == 1000
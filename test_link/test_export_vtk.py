@@ -1,4 +1,9 @@
+import array
 import os
+import re
+import struct
+import zlib
+import pytest
 import pyMagix3D as Mgx3D
 
 
@@ -59,3 +64,115 @@ def test_export_imported_step(capfd):
     assert len(err) == 0
 
     os.remove(vtkfilename)
+
+def read_vtu_arrays(vtufilename):
+    """ Les tableaux (section, attributs, valeurs) d'un fichier vtu écrit par
+    writeVTK, les données ajoutées étant décodées comme le ferait VTK """
+    with open(vtufilename, "rb") as f:
+        content = f.read()
+    start = content.index(b"<AppendedData")
+    data = content.index(b"_", start) + 1
+    header = content[:start].decode()
+    compressed = 'compressor="vtkZLibDataCompressor"' in header
+    formats = {"Int64": "q", "UInt8": "B", "Float64": "d"}
+    arrays = []
+    section = None
+    for tag in re.findall(r"<([^>]*)>", header):
+        name = tag.split()[0]
+        if name in ("FieldData", "PointData", "CellData", "Points", "Cells"):
+            section = name
+        elif name == "DataArray":
+            attributes = dict(re.findall(r'(\w+)="([^"]*)"', tag))
+            pos = data + int(attributes["offset"])
+            if compressed:
+                nb_blocks, block_size, last_size = struct.unpack_from("<3Q", content, pos)
+                sizes = struct.unpack_from("<%dQ" % nb_blocks, content, pos + 24)
+                pos += 24 + 8*nb_blocks
+                raw = b""
+                for size in sizes:
+                    raw += zlib.decompress(content[pos:pos+size])
+                    pos += size
+                assert nb_blocks == 0 or len(raw) == (nb_blocks-1)*block_size + (last_size or block_size)
+            else:
+                size, = struct.unpack_from("<Q", content, pos)
+                raw = content[pos+8:pos+8+size]
+            arrays.append((section, attributes, array.array(formats[attributes["type"]], raw)))
+    return arrays
+
+@pytest.mark.parametrize("compressed", [False, True])
+def test_write_mesh_vtu(capfd, compressed):
+    ctx = Mgx3D.getStdContext()
+    ctx.clearSession() # Clean the session after the previous test
+    mm = ctx.getMeshManager()
+
+    # assez de mailles pour un assemblage en parallèle et plusieurs blocs compressés
+    n = 30
+    ctx.getTopoManager().newBoxWithTopo (Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), n, n, n)
+    ctx.getGeomManager().addToGroup (["Vol0000"], 3, "BOX")
+    ctx.getGeomManager().addToGroup (["Surf0000"], 2, "XMIN")
+    mm.newAllBlocksMesh()
+
+    vtufilename = "/dev/shm/box_mesh.vtu"
+    try:
+        mm.writeVTK(vtufilename, compressed)
+    except RuntimeError as exc:
+        if compressed and "zlib" in str(exc):
+            pytest.skip("Magix3D n'a pas été compilé avec zlib")
+        raise
+    assert os.path.exists(vtufilename)
+    with open(vtufilename, "rb") as f:
+        header = f.read(4096)
+    assert header.startswith(b"<?xml")
+    assert (b'compressor="vtkZLibDataCompressor"' in header) == compressed
+
+    arrays = read_vtu_arrays(vtufilename)
+    groups = {a["Name"]: (a, values) for section, a, values in arrays if section == "FieldData"}
+    assert groups["BOX"][0]["Mgx3DGroup"] == "Volume"
+    assert groups["XMIN"][0]["Mgx3DGroup"] == "Surface"
+    points = [values for section, a, values in arrays if section == "Points"][0]
+    cells = {a["Name"]: values for section, a, values in arrays if section == "Cells"}
+    connectivity, offsets, types = cells["connectivity"], cells["offsets"], cells["types"]
+    assert len(points) == 3*(n+1)**3
+    assert len(offsets) == len(types) and offsets[-1] == len(connectivity)
+
+    def cell_coords(c):
+        first = offsets[c-1] if c else 0
+        return tuple(tuple(points[3*i:3*i+3]) for i in connectivity[first:offsets[c]])
+
+    def group_cells(name):
+        attributes, ranges = groups[name]
+        assert len(ranges) == 2*int(attributes["NumberOfTuples"])
+        return [c for r in range(0, len(ranges), 2) for c in range(ranges[r], ranges[r+1])]
+
+    # le volume : tous les hexaèdres, de mêmes noeuds que dans la session
+    box = group_cells("BOX")
+    assert box == [c for c in range(len(types)) if types[c] == 12]
+    assert len(groups["BOX"][1]) == 2 # un seul intervalle
+    coords = mm.getNodesCoordinatesArray("BOX", 3)
+    session_cells = mm.getCellsArray("BOX", 3)
+    expected = []
+    for i in range(0, len(session_cells), 9):
+        assert session_cells[i] == 8
+        expected.append(tuple(tuple(coords[k, j] for j in range(3)) for k in session_cells[i+1:i+9]))
+    assert sorted(cell_coords(c) for c in box) == sorted(expected)
+
+    # la surface : des quadrangles d'un même plan
+    xmin = group_cells("XMIN")
+    assert len(xmin) == n*n
+    assert all(types[c] == 9 for c in xmin)
+    nodes = set(pt for c in xmin for pt in cell_coords(c))
+    assert any(len(set(pt[j] for pt in nodes)) == 1 for j in range(3))
+
+    # les mêmes groupes en tableaux d'entiers des mailles
+    masks = {a["Name"]: values for section, a, values in arrays if section == "CellData"}
+    assert all(a["type"] == "UInt8" for section, a, values in arrays if section == "CellData")
+    assert [c for c in range(len(types)) if masks["BOX"][c]] == box
+    assert [c for c in range(len(types)) if masks["XMIN"][c]] == sorted(xmin)
+    assert not [section for section, a, values in arrays if section == "PointData"]
+
+    # relecture : mêmes noeuds, mailles et groupes
+    assert mm.compareWithMesh(vtufilename)
+    os.remove(vtufilename)
+
+    out, err = capfd.readouterr()
+    assert len(err) == 0
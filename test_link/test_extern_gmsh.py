@@ -58,3 +58,44 @@ def test_bridge_delaunay_mesh():
     assert(mm.getNbFaces() > 2720)
     assert(mm.getNbFaces() < 2840)
 
+
+def test_box_delaunay_mesh_batched():
+    ctx = Mgx3D.getStdContext()
+    tm = ctx.getTopoManager()
+    mm = ctx.getMeshManager()
+    faces = ["Fa0000", "Fa0001", "Fa0002", "Fa0003", "Fa0004", "Fa0005"]
+    edges = ["Ar0000", "Ar0001", "Ar0002", "Ar0003", "Ar0004", "Ar0005",
+             "Ar0006", "Ar0007", "Ar0008", "Ar0009", "Ar0010", "Ar0011"]
+
+    # Référence du maillage par fragmentation (cf. test_box_delaunay_mesh) :
+    # une face carrée à un bras par arête donne 4 triangles autour d'un noeud
+    # central. Les 6 faces, maillées dans un même modèle GMSH, donnent donc
+    # 8 + 6 noeuds et 6 x 4 triangles.
+    ctx.clearSession() # Clean the session after the previous test
+    tm.newBoxWithTopo (Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), False)
+    tm.setMeshingProperty (Mgx3D.EdgeMeshingPropertyUniform(1), edges)
+    tm.setMeshingProperty (Mgx3D.FaceMeshingPropertyDelaunayGMSH(0, 1e22), faces)
+    mm.newFacesMesh (faces)
+    assert(mm.getNbNodes() == 14)
+    assert(mm.getNbFaces() == 24)
+
+    # maillage face par face
+    ctx.clearSession()
+    tm.newBoxWithTopo (Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), False)
+    tm.setMeshingProperty (Mgx3D.FaceMeshingPropertyDelaunayGMSH(0, 1e22), faces)
+    for fa in faces:
+        mm.newFacesMesh ( [fa] )
+    nb_nodes_one_by_one = mm.getNbNodes()
+    nb_faces_one_by_one = mm.getNbFaces()
+
+    # maillage de toutes les faces dans un même modèle GMSH
+    ctx.clearSession()
+    tm.newBoxWithTopo (Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), False)
+    tm.setMeshingProperty (Mgx3D.FaceMeshingPropertyDelaunayGMSH(0, 1e22), faces)
+    mm.newFacesMesh (faces)
+    assert(mm.getNbNodes() == nb_nodes_one_by_one)
+    assert(mm.getNbFaces() == nb_faces_one_by_one)
+
+    # surface fermée triangulée conforme (sans noeud en double sur les arêtes) :
+    # V - E + F = 2 et 3F = 2E
+    assert(mm.getNbFaces() == 2*mm.getNbNodes() - 4)
@@ -0,0 +1,85 @@
+import pyMagix3D as Mgx3D
+
+def check_created_entities_exist(tm, result):
+    """ Les entités topologiques rapportées comme créées existent toutes """
+    assert set(result.getBlocks()) <= set(tm.getBlocks())
+    assert set(result.getFaces()) <= set(tm.getCoFaces())
+    assert set(result.getEdges()) <= set(tm.getCoEdges())
+    assert set(result.getTopoVertices()) <= set(tm.getVertices())
+
+def test_composite_same_entities(capfd):
+    ctx = Mgx3D.getStdContext()
+    ctx.clearSession() # Clean the session after the previous test
+    tm = ctx.getTopoManager()
+
+    # commande composite : les blocs créés par les sous-commandes de création
+    # sont modifiés par le collage, les faces communes créées puis détruites
+    result = tm.newIJBoxesWithTopo(2, 1, False)
+    assert tm.getNbBlocks() == 2
+    assert sorted(result.getBlocks()) == sorted(tm.getBlocks())
+    assert sorted(result.getFaces()) == sorted(tm.getCoFaces())
+    assert sorted(result.getEdges()) == sorted(tm.getCoEdges())
+    assert sorted(result.getTopoVertices()) == sorted(tm.getVertices())
+    nb_cofaces = tm.getNbFaces()
+
+    ctx.undo()
+    assert tm.getNbBlocks() == 0
+    ctx.redo()
+    assert tm.getNbBlocks() == 2
+    assert tm.getNbFaces() == nb_cofaces
+
+    out, err = capfd.readouterr()
+    assert len(err) == 0
+
+def test_created_then_deleted(capfd):
+    ctx = Mgx3D.getStdContext()
+    ctx.clearSession() # Clean the session after the previous test
+    tm = ctx.getTopoManager()
+
+    tm.newBoxWithTopo(Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), 10, 10, 10)
+    vertices = tm.getVertices()
+    # les entités intermédiaires créées puis détruites par le découpage
+    # (type NONE) ne sont pas rapportées comme créées
+    result = tm.splitBlock("Bl0000", "Ar0000", .5)
+    assert tm.getNbBlocks() == 2
+    check_created_entities_exist(tm, result)
+    assert set(vertices) <= set(tm.getVertices())
+
+    ctx.undo()
+    assert tm.getNbBlocks() == 1
+    assert sorted(tm.getVertices()) == sorted(vertices)
+    ctx.redo()
+    assert tm.getNbBlocks() == 2
+
+    out, err = capfd.readouterr()
+    assert len(err) == 0
+
+def test_clean_temporary_entities(capfd):
+    ctx = Mgx3D.getStdContext()
+    ctx.clearSession() # Clean the session after the previous test
+    gm = ctx.getGeomManager()
+    tm = ctx.getTopoManager()
+
+    tm.newBoxWithTopo(Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), 10, 10, 10)
+    tm.newBoxWithTopo(Mgx3D.Point(1, 0, 0), Mgx3D.Point(2.5, 1, 1), 15, 10, 10)
+    gm.fuse(["Vol0000","Vol0001"])
+    nb_coedges = tm.getNbEdges()
+
+    # les entités temporaires de la fusion sont détruites et retirées de
+    # l'InfoCommand (cleanTemporaryEntities) : seules des entités existantes
+    # sont rapportées, et l'annulation ne les utilise pas
+    result = tm.fuse2Blocks("Bl0000","Bl0001")
+    assert tm.getNbBlocks() == 1
+    assert tm.getNbFaces() == 10
+    check_created_entities_exist(tm, result)
+
+    ctx.undo()
+    assert tm.getNbBlocks() == 2
+    assert tm.getNbFaces() == 11
+    assert tm.getNbEdges() == nb_coedges
+    ctx.redo()
+    assert tm.getNbBlocks() == 1
+    assert tm.getNbFaces() == 10
+
+    out, err = capfd.readouterr()
+    assert len(err) == 0
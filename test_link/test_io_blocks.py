@@ -1,4 +1,6 @@
 import os
+import struct
+import pytest
 import pyMagix3D as Mgx3D
 
 test_folder = os.path.dirname(__file__)
@@ -50,4 +52,97 @@ def test_export_no_assoc():
     assert tm.getNbEdges()==39
     assert len(tm.getVertices()) == 20
 
-    os.remove(mgxt_filename)
\ No newline at end of file
+    os.remove(mgxt_filename)
+def topo_signature(tm):
+    """ connectivité, associations géométriques et groupes de la topologie """
+    signature = []
+    for dim, names in [(0, tm.getVertices()), (1, tm.getCoEdges()),
+                       (2, tm.getCoFaces()), (3, tm.getBlocks())]:
+        for name in names:
+            infos = tm.getInfos(name, dim)
+            signature.append((name, infos.geom_entity, sorted(infos.groups()),
+                              sorted(infos.vertices()), sorted(infos.coedges()),
+                              sorted(infos.cofaces())))
+            if dim == 1:
+                signature.append(tm.getNbMeshingEdges(name))
+    return signature
+
+def blocks_corners(tm):
+    """ coordonnées des sommets de chaque bloc, indépendamment des noms """
+    coords = tm.getVerticesCoordinatesArray()
+    corners = tm.getBlocksVerticesArray()
+    blocks = []
+    i = 0
+    while i < len(corners):
+        nb = corners[i]
+        blocks.append(tuple(sorted(tuple(round(coords[corners[j], k], 6) for k in range(3))
+                                   for j in range(i+1, i+1+nb))))
+        i += nb+1
+    return sorted(blocks)
+
+def test_export_binary():
+    ctx = Mgx3D.getStdContext()
+    ctx.clearSession() # Clean the session after the previous test
+    gm = ctx.getGeomManager ()
+    tm = ctx.getTopoManager ()
+
+    ctx.getTopoManager().newSphereWithTopo (Mgx3D.Point(0, 0, 0), 1, Mgx3D.Portion.DEMI, True, .5, 10, 10)
+    tm.setNbMeshingEdges ("Ar0000", 7, [])
+    corners = blocks_corners(tm)
+    mgxt_filename = "/dev/shm/half_sphere_export.mgxt"
+    mgxb_filename = "/dev/shm/half_sphere_export.mgxb"
+    tm.exportBlocks(mgxt_filename, True)
+    tm.exportBlocks(mgxb_filename, True)
+    assert os.path.getsize(mgxb_filename) < os.path.getsize(mgxt_filename)
+
+    # les 2 formats donnent la même topologie, avec les mêmes blocs que
+    # celle exportée
+    signatures = []
+    for filename in [mgxt_filename, mgxb_filename]:
+        ctx.clearSession()
+        ctx.getGeomManager().newSphere (Mgx3D.Point(0, 0, 0), 1, Mgx3D.Portion.DEMI)
+        tm.importBlocks(filename, True)
+        assert tm.getNbBlocks()==6
+        assert tm.getNbFaces()==26
+        assert tm.getNbEdges()==39
+        assert len(tm.getVertices()) == 20
+        assert blocks_corners(tm) == corners
+        signatures.append(topo_signature(tm))
+    assert signatures[0] == signatures[1]
+    # les entités sont associées à la géométrie et rangées dans ses groupes
+    assert any(s[1] != "" for s in signatures[1] if isinstance(s, tuple))
+    assert any(len(s[2]) != 0 for s in signatures[1] if isinstance(s, tuple))
+
+    os.remove(mgxt_filename)
+    os.remove(mgxb_filename)
+
+def test_import_corrupted_binary():
+    ctx = Mgx3D.getStdContext()
+    ctx.clearSession() # Clean the session after the previous test
+    tm = ctx.getTopoManager ()
+
+    tm.newBoxWithTopo (Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), 10, 10, 10)
+    mgxb_filename = "/dev/shm/box_export.mgxb"
+    tm.exportBlocks(mgxb_filename, False)
+    with open(mgxb_filename, "rb") as f:
+        content = f.read()
+
+    # fichier tronqué
+    with open(mgxb_filename, "wb") as f:
+        f.write(content[:len(content)//2])
+    ctx.clearSession()
+    with pytest.raises(RuntimeError):
+        tm.importBlocks(mgxb_filename, False)
+
+    # indice de sommet de bloc hors limites : étiquette, taille de la
+    # section, nombre de valeurs puis premier indice
+    corrupted = bytearray(content)
+    first_node = content.index(b"BLCK") + 4 + 8 + 8
+    corrupted[first_node:first_node+4] = struct.pack("<i", 1000000)
+    with open(mgxb_filename, "wb") as f:
+        f.write(corrupted)
+    ctx.clearSession()
+    with pytest.raises(RuntimeError):
+        tm.importBlocks(mgxb_filename, False)
+
+    os.remove(mgxb_filename)
@@ -0,0 +1,33 @@
+import json
+import pyMagix3D as Mgx3D
+
+def test_profiling(tmp_path):
+    ctx = Mgx3D.getStdContext()
+    ctx.clearSession() # Clean the session after the previous test
+    tm = ctx.getTopoManager()
+    mm = ctx.getMeshManager()
+
+    ctx.resetProfiling()
+    ctx.setProfiling(True)
+    assert ctx.isProfiling() == True
+    tm.newBoxWithTopo (Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), 5, 5, 5)
+    mm.newAllBlocksMesh().waitFor()
+    ctx.setProfiling(False)
+
+    # Récapitulatif par type de commande et par étape
+    summary = ctx.getProfilingSummary()
+    assert "internalExecute" in summary
+    assert "CommandNewBlocksMesh/preMesh blocks" in summary
+
+    # Trace au format Trace Event
+    trace = tmp_path / "trace.json"
+    ctx.saveProfilingTrace(str(trace))
+    events = json.loads(trace.read_text())["traceEvents"]
+    names = [e["name"] for e in events if e["ph"] == "X"]
+    assert "execute" in names
+    assert "internalExecute" in names
+
+    # Inactif : plus de mesures
+    ctx.resetProfiling()
+    tm.newBoxWithTopo (Mgx3D.Point(2, 0, 0), Mgx3D.Point(3, 1, 1), 2, 2, 2)
+    assert "internalExecute" not in ctx.getProfilingSummary()
@@ -1,4 +1,5 @@
 import math
+import random
 import pyMagix3D as Mgx3D
 
 def test_projection_cube(capfd):
@@ -167,3 +168,58 @@ def test_curve_on_surf_proj(capfd):
     out, err = capfd.readouterr()
     assert len(err) == 0
 
+
+# La recherche de l'entité la plus proche par hiérarchie de boites englobantes
+# doit donner la même surface et le même point projeté qu'une recherche
+# exhaustive sur les mêmes surfaces (ici des rectangles, projection analytique)
+def test_projection_nearest_matches_exhaustive(capfd):
+    ctx = Mgx3D.getStdContext()
+    ctx.clearSession() # Clean the session after the previous test
+    tm = ctx.getTopoManager ()
+    gm = ctx.getGeomManager ()
+    # 3x3x2 boites séparées, soit 108 surfaces planes, bien plus que
+    # les 4 entités d'une feuille de la hiérarchie
+    for i in range(3):
+        for j in range(3):
+            for k in range(2):
+                gm.newBox (Mgx3D.Point(3*i, 3*j, 3*k), Mgx3D.Point(3*i+1+.1*j, 3*j+1+.1*k, 3*k+1+.1*i))
+    surfaces = gm.getSurfaces()
+    assert len(surfaces) == 108
+    rectangles = []
+    for surf in surfaces:
+        corners = [gm.getCoord(pt) for pt in gm.getInfos(surf, 2).vertices()]
+        rectangles.append(([min(c.getX() for c in corners), min(c.getY() for c in corners), min(c.getZ() for c in corners)],
+                           [max(c.getX() for c in corners), max(c.getY() for c in corners), max(c.getZ() for c in corners)]))
+
+    def exhaustive(p):
+        # (distance, indice de la surface, projeté) pour chaque surface
+        found = []
+        for index, (pmin, pmax) in enumerate(rectangles):
+            foot = [min(max(p[d], pmin[d]), pmax[d]) for d in range(3)]
+            found.append((math.dist(p, foot), index, foot))
+        return sorted(found)
+
+    # points dont le projeté est intérieur à une unique surface la plus proche,
+    # pour que le résultat ne dépende pas des arrondis de la projection OCC
+    rnd = random.Random(47)
+    expected = []
+    while len(expected) < 200:
+        p = [rnd.uniform(-1, 8), rnd.uniform(-1, 8), rnd.uniform(-1, 5)]
+        found = exhaustive(p)
+        (dist, index, foot), second = found[0], found[1]
+        pmin, pmax = rectangles[index]
+        interior = all(pmin[d] == pmax[d] or pmin[d]+.05 < foot[d] < pmax[d]-.05 for d in range(3))
+        if interior and second[0] > dist+.05:
+            tm.newTopoVertex (Mgx3D.Point(p[0], p[1], p[2]), "")
+            expected.append((surfaces[index], foot))
+
+    vertices = tm.getVertices()
+    assert len(vertices) == len(expected)
+    tm.projectVerticesOnNearestGeomEntities (vertices, surfaces, True)
+    for vtx, (surf, foot) in zip(vertices, expected):
+        assert tm.getInfos(vtx, 0).geom_entity == surf
+        p = tm.getCoord(vtx)
+        assert math.dist([p.getX(), p.getY(), p.getZ()], foot) < 1e-6
+
+    out, err = capfd.readouterr()
+    assert len(err) == 0
@@ -53,3 +53,44 @@ def test_set_face_meshing_property(capfd):
 
     out, err = capfd.readouterr()
     assert len(err) == 0
+
+def test_set_parallel_meshing_property_after_topology_modification():
+    ctx = Mgx3D.getStdContext()
+    ctx.clearSession() # Clean the session after the previous test
+    tm = ctx.getTopoManager()
+
+    def edges_with(nb):
+        return [e for e in tm.getCoEdges() if tm.getNbMeshingEdges(e) == nb]
+
+    tm.newBoxWithTopo (Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), 10, 10, 10)
+    # les cordes des 3 directions sont indexées
+    for e in tm.getCoEdges():
+        tm.setParallelMeshingProperty (Mgx3D.EdgeMeshingPropertyUniform(10), e)
+    tm.setParallelMeshingProperty (Mgx3D.EdgeMeshingPropertyUniform(12), "Ar0000")
+    assert len(edges_with(12)) == 4
+
+    # la coupe sépare la corde de Ar0000 en deux et allonge les deux autres
+    tm.splitBlock ("Bl0000", "Ar0000", .5)
+    halves = [e for e in tm.getCoEdges() if tm.getNbMeshingEdges(e) != 10]
+    assert len(halves) == 8
+    tm.setParallelMeshingProperty (Mgx3D.EdgeMeshingPropertyUniform(5), halves[0])
+    assert len(edges_with(5)) == 4
+    tm.setParallelMeshingProperty (Mgx3D.EdgeMeshingPropertyUniform(3), edges_with(10)[0])
+    assert len(edges_with(3)) == 6
+
+    # le rejeu de la coupe rend les cordes coupées
+    ctx.undo()
+    ctx.undo()
+    ctx.undo()
+    assert len(tm.getCoEdges()) == 12
+    ctx.redo()
+    assert len(tm.getCoEdges()) == 20
+    tm.setParallelMeshingProperty (Mgx3D.EdgeMeshingPropertyUniform(3), edges_with(10)[0])
+    assert len(edges_with(3)) == 6
+
+    # et son annulation les cordes initiales
+    ctx.undo()
+    ctx.undo()
+    assert len(tm.getCoEdges()) == 12
+    tm.setParallelMeshingProperty (Mgx3D.EdgeMeshingPropertyUniform(4), edges_with(10)[0])
+    assert len(edges_with(4)) == 4
@@ -36,4 +36,54 @@ def test_split_block_2(capfd):
     assert ctx.getMeshManager().getNbFaces() == 3230
 
     out, err = capfd.readouterr()
-    assert len(err) == 0
\ No newline at end of file
+    assert len(err) == 0
+def check_split_preview(tm, blocks, edge, ratio):
+    """ L'aperçu calculé sans modifier la topologie doit correspondre à la
+    coupe effectuée par splitBlocks """
+    def coords(v):
+        pt = tm.getCoord(v)
+        return (pt.getX(), pt.getY(), pt.getZ())
+    def same(p1, p2):
+        return all(abs(a - b) < 1e-9 for a, b in zip(p1, p2))
+
+    vertices = set(tm.getVertices())
+    coedges = set(tm.getCoEdges())
+    nb_blocks = tm.getNbBlocks()
+    nb_cofaces = tm.getNbFaces()
+
+    preview = tm.getSplitBlocksPreviewArray(blocks, edge, ratio)
+    segments = [(tuple(preview[i, j] for j in range(3)), tuple(preview[i+1, j] for j in range(3)))
+                for i in range(0, preview.shape[0], 2)]
+    assert len(segments) > 0
+    # l'aperçu n'a pas modifié la topologie
+    assert tm.getNbBlocks() == nb_blocks
+    assert tm.getNbFaces() == nb_cofaces
+    assert set(tm.getCoEdges()) == coedges
+    assert set(tm.getVertices()) == vertices
+
+    tm.splitBlocks(blocks, edge, ratio)
+    assert tm.getNbBlocks() > nb_blocks
+    new_vertices = [coords(v) for v in tm.getVertices() if v not in vertices]
+    new_coedges = [[coords(v) for v in tm.getInfos(ce, 1).vertices()]
+                   for ce in tm.getCoEdges() if ce not in coedges]
+
+    # chaque segment de l'aperçu est une arête de la coupe
+    for p1, p2 in segments:
+        assert any((same(p1, ce[0]) and same(p2, ce[1])) or (same(p1, ce[1]) and same(p2, ce[0]))
+                   for ce in new_coedges)
+    # chaque sommet créé par la coupe est une extrémité d'un segment de l'aperçu
+    for pt in new_vertices:
+        assert any(same(pt, p1) or same(pt, p2) for p1, p2 in segments)
+
+def test_split_block_preview(capfd):
+    ctx = Mgx3D.getStdContext()
+    ctx.clearSession() # Clean the session after the previous test
+    tm = ctx.getTopoManager()
+
+    tm.newBoxWithTopo (Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 2, 3), 10, 10, 10)
+    check_split_preview(tm, ["Bl0000"], "Ar0001", .3)
+    # coupe d'un des blocs issus de la première, cf test_split_block_1
+    check_split_preview(tm, ["Bl0001"], "Ar0012", .5)
+
+    out, err = capfd.readouterr()
+    assert len(err) == 0
@@ -0,0 +1,118 @@
+import pytest
+import pyMagix3D as Mgx3D
+
+def test_undo_budget_spill(capfd):
+    ctx = Mgx3D.getStdContext()
+    ctx.clearSession() # Clean the session after the previous test
+    gm = ctx.getGeomManager ()
+    tm = ctx.getTopoManager()
+
+    tm.newBoxWithTopo (Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), 10, 10, 10)
+    tm.newBoxWithTopo (Mgx3D.Point(1, 0, 0), Mgx3D.Point(2, 1, 1), 10, 10, 10)
+    tm.newBoxWithTopo (Mgx3D.Point(2, 0, 0), Mgx3D.Point(3, 1, 1), 10, 10, 10)
+    gm.fuse (["Vol0000","Vol0001", "Vol0002"])
+    gm.joinSurfaces (["Surf0005","Surf0011"])
+    assert gm.getNbSurfaces()==13
+    size = ctx.getUndoMemorySize()
+    assert size > 0
+
+    # budget quasi nul : les mémentos de la fusion sont écrits sur disque
+    ctx.setUndoMemoryBudget(1.e-6)
+    gm.joinSurfaces (["Surf0009","Surf0003"])
+    assert gm.getNbSurfaces()==12
+
+    # et relus lors des annulations
+    ctx.undo()
+    ctx.undo()
+    assert gm.getNbSurfaces()==14
+    ctx.undo()
+    assert gm.getNbSurfaces()==18
+    ctx.redo()
+    assert gm.getNbSurfaces()==14
+    ctx.setUndoMemoryBudget(0)
+
+    out, err = capfd.readouterr()
+    assert len(err) == 0
+
+def test_undo_budget_spill_keeps_sharing(capfd):
+    ctx = Mgx3D.getStdContext()
+    ctx.clearSession() # Clean the session after the previous test
+    gm = ctx.getGeomManager ()
+
+    gm.newBox (Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1))
+    gm.newBox (Mgx3D.Point(1, 0, 0), Mgx3D.Point(2, 1, 1))
+    gm.newBox (Mgx3D.Point(2, 0, 0), Mgx3D.Point(3, 1, 1))
+    gm.fuse (["Vol0000","Vol0001", "Vol0002"])
+    nb_curves = gm.getNbCurves()
+
+    # les mémentos de la première fusion de surfaces sont déchargés par la
+    # seconde, puis relus par l'annulation alors que les faces voisines sont
+    # toujours en place
+    ctx.setUndoMemoryBudget(1.e-6)
+    gm.joinSurfaces (["Surf0005","Surf0011"])
+    gm.joinSurfaces (["Surf0009","Surf0003"])
+    ctx.undo()
+    ctx.undo()
+    ctx.setUndoMemoryBudget(0)
+    assert gm.getNbSurfaces()==14
+    assert gm.getNbCurves()==nb_curves
+
+    # les arêtes relues sont les mêmes (IsSame) que celles des faces voisines :
+    # le BRep des surfaces ne les duplique pas
+    gm.exportBREP(gm.getSurfaces(), "test_undo_budget_sharing.brep")
+    ctx.clearSession()
+    gm.importBREP("test_undo_budget_sharing.brep")
+    assert gm.getNbSurfaces()==14
+    assert gm.getNbCurves()==nb_curves
+
+    out, err = capfd.readouterr()
+    assert len(err) == 0
+
+def test_undo_budget_drop(capfd):
+    ctx = Mgx3D.getStdContext()
+    ctx.clearSession() # Clean the session after the previous test
+    gm = ctx.getGeomManager ()
+    tm = ctx.getTopoManager()
+
+    tm.newBoxWithTopo (Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), 10, 10, 10)
+    tm.newBoxWithTopo (Mgx3D.Point(1, 0, 0), Mgx3D.Point(2, 1, 1), 10, 10, 10)
+    gm.fuse (["Vol0000","Vol0001"])
+    ctx.setUndoMemoryBudget(1.e-6, False)
+    gm.joinSurfaces (["Surf0005","Surf0011"])
+    # la fusion n'est plus annulable, seule la dernière commande l'est
+    ctx.undo()
+    assert gm.getNbVolumes()==1
+    with pytest.raises(RuntimeError):
+        ctx.undo()
+    assert gm.getNbVolumes()==1
+    ctx.setUndoMemoryBudget(0)
+
+def test_undo_budget_keeps_mesh(capfd):
+    ctx = Mgx3D.getStdContext()
+    ctx.clearSession() # Clean the session after the previous test
+    tm = ctx.getTopoManager()
+    mm = ctx.getMeshManager()
+
+    tm.newBoxWithTopo (Mgx3D.Point(0, 0, 0), Mgx3D.Point(1, 1, 1), 10, 10, 10, "B")
+    mm.newAllBlocksMesh()
+    assert mm.getNbVolumes()==1
+    assert mm.getNbRegions()==1000
+
+    # budget dépassé par le maillage : la commande de maillage ne peut être
+    # retirée de la pile sans détruire ses groupes, elle reste annulable
+    ctx.setUndoMemoryBudget(1.e-6, False)
+    tm.newBoxWithTopo (Mgx3D.Point(2, 0, 0), Mgx3D.Point(3, 1, 1), 10, 10, 10, "C")
+    tm.newBoxWithTopo (Mgx3D.Point(4, 0, 0), Mgx3D.Point(5, 1, 1), 10, 10, 10, "D")
+    assert mm.getNbVolumes()==1
+    assert mm.getNbRegions()==1000
+    assert len(mm.getNodesCoordinatesArray("B", 3)) == 11*11*11
+
+    ctx.undo()
+    ctx.undo()
+    ctx.undo()
+    assert mm.getNbVolumes()==0
+    assert mm.getNbRegions()==0
+    ctx.setUndoMemoryBudget(0)
+
+    out, err = capfd.readouterr()
+    assert len(err) == 0